@@ -37,10 +37,16 @@ namespace JSC {
 struct APICallbackFunction {
     template <typename T> static EncodedJSValue callImpl(JSGlobalObject*, CallFrame*);
     template <typename T> static EncodedJSValue constructImpl(JSGlobalObject*, CallFrame*);
+    static EncodedJSValue callWithCallback(JSGlobalObject*, CallFrame*, JSObjectCallAsFunctionCallback);
 };
 
 template <typename T>
 EncodedJSValue APICallbackFunction::callImpl(JSGlobalObject* globalObject, CallFrame* callFrame)
+{
+    return callWithCallback(globalObject, callFrame, jsCast<T*>(callFrame->jsCallee())->functionCallback());
+}
+
+inline EncodedJSValue APICallbackFunction::callWithCallback(JSGlobalObject* globalObject, CallFrame* callFrame, JSObjectCallAsFunctionCallback callback)
 {
     VM& vm = getVM(globalObject);
     auto scope = DECLARE_THROW_SCOPE(vm);
@@ -58,7 +64,7 @@ EncodedJSValue APICallbackFunction::callImpl(JSGlobalObject* globalObject, CallF
     JSValueRef result;
     {
         JSLock::DropAllLocks dropAllLocks(globalObject);
-        result = jsCast<T*>(toJS(functionRef))->functionCallback()(execRef, functionRef, thisObjRef, argumentCount, arguments.data(), &exception);
+        result = callback(execRef, functionRef, thisObjRef, argumentCount, arguments.data(), &exception);
     }
     if (exception) {
         throwException(globalObject, scope, toJS(globalObject, exception));
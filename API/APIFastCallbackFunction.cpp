@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "APIFastCallbackFunction.h"
+
+#include "APICallbackFunction.h"
+#include "APICast.h"
+#include "DOMJITSignature.h"
+#include "FrameTracers.h"
+#include "JITThunks.h"
+#include "JSCInlines.h"
+#include "JSCallbackFunction.h"
+#include "NativeExecutable.h"
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+static JSC_DECLARE_HOST_FUNCTION(callAPIFastCallbackFunction);
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationCallAPIFastCallback0, EncodedJSValue, (JSGlobalObject*, JSObject*, const APIFastCallbackData*));
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationCallAPIFastCallback1, EncodedJSValue, (JSGlobalObject*, JSObject*, void*, const APIFastCallbackData*));
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationCallAPIFastCallback2, EncodedJSValue, (JSGlobalObject*, JSObject*, void*, void*, const APIFastCallbackData*));
+
+static SpeculatedType speculationFor(JSFastCallbackArgumentType type)
+{
+    switch (type) {
+    case kJSFastCallbackArgumentTypeInt32:
+        return SpecInt32Only;
+    case kJSFastCallbackArgumentTypeBoolean:
+        return SpecBoolean;
+    case kJSFastCallbackArgumentTypeString:
+        return SpecString;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return SpecNone;
+}
+
+static bool isValid(JSObjectCallAsFunctionCallback callAsFunction, const JSFastCallbackDefinition& definition)
+{
+    if (!callAsFunction || !definition.callAsFunction)
+        return false;
+    if (definition.argumentCount > JSC_DOMJIT_SIGNATURE_MAX_ARGUMENTS)
+        return false;
+    for (unsigned i = 0; i < definition.argumentCount; ++i) {
+        switch (definition.argumentTypes[i]) {
+        case kJSFastCallbackArgumentTypeInt32:
+        case kJSFastCallbackArgumentTypeBoolean:
+        case kJSFastCallbackArgumentTypeString:
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool isSameDefinition(const JSFastCallbackDefinition& a, const JSFastCallbackDefinition& b)
+{
+    if (a.callAsFunction != b.callAsFunction || a.argumentCount != b.argumentCount)
+        return false;
+    for (unsigned i = 0; i < a.argumentCount; ++i) {
+        if (a.argumentTypes[i] != b.argumentTypes[i])
+            return false;
+    }
+    return true;
+}
+
+APIFastCallbackData::APIFastCallbackData(JSObjectCallAsFunctionCallback callAsFunction, const JSFastCallbackDefinition& definition)
+    : m_callAsFunction(callAsFunction)
+    , m_definition(definition)
+{
+    // `this` is checked against JSObject, so every call through the signature has an object receiver.
+    // The callback may do anything, so we claim to read and write the whole heap.
+    switch (definition.argumentCount) {
+    case 0:
+        m_signature = makeUnique<DOMJIT::Signature>(operationCallAPIFastCallback0, this, JSObject::info(), DOMJIT::Effect(), SpecHeapTop);
+        break;
+    case 1:
+        m_signature = makeUnique<DOMJIT::Signature>(operationCallAPIFastCallback1, this, JSObject::info(), DOMJIT::Effect(), SpecHeapTop, speculationFor(definition.argumentTypes[0]));
+        break;
+    case 2:
+        m_signature = makeUnique<DOMJIT::Signature>(operationCallAPIFastCallback2, this, JSObject::info(), DOMJIT::Effect(), SpecHeapTop, speculationFor(definition.argumentTypes[0]), speculationFor(definition.argumentTypes[1]));
+        break;
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+        break;
+    }
+}
+
+const APIFastCallbackData* APIFastCallbackData::get(JSObjectCallAsFunctionCallback callAsFunction, const JSFastCallbackDefinition& definition)
+{
+    if (!isValid(callAsFunction, definition))
+        return nullptr;
+
+    // Embedders register a bounded set of callbacks, usually once per class, so a linear scan is enough.
+    static Lock lock;
+    static NeverDestroyed<Vector<std::unique_ptr<APIFastCallbackData>>> table;
+    auto locker = holdLock(lock);
+    for (auto& data : table.get()) {
+        if (data->callAsFunction() == callAsFunction && isSameDefinition(data->definition(), definition))
+            return data.get();
+    }
+    table->append(makeUnique<APIFastCallbackData>(callAsFunction, definition));
+    return table->last().get();
+}
+
+static EncodedJSValue callFastCallback(JSGlobalObject* globalObject, JSObject* thisObject, const APIFastCallbackData& data, void* const* rawArguments)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    const JSFastCallbackDefinition& definition = data.definition();
+
+    JSFastCallbackArgument arguments[JSC_DOMJIT_SIGNATURE_MAX_ARGUMENTS];
+    // Keeps resolved ropes alive while the callback looks at their characters.
+    String strings[JSC_DOMJIT_SIGNATURE_MAX_ARGUMENTS];
+    for (unsigned i = 0; i < definition.argumentCount; ++i) {
+        // Int32 and boolean operands are unboxed, and only their low 32 bits are defined.
+        uintptr_t bits = bitwise_cast<uintptr_t>(rawArguments[i]);
+        switch (definition.argumentTypes[i]) {
+        case kJSFastCallbackArgumentTypeInt32:
+            arguments[i].int32 = static_cast<int32_t>(static_cast<uint32_t>(bits));
+            break;
+        case kJSFastCallbackArgumentTypeBoolean:
+            arguments[i].boolean = !!static_cast<uint32_t>(bits);
+            break;
+        case kJSFastCallbackArgumentTypeString: {
+            strings[i] = bitwise_cast<JSString*>(bits)->value(globalObject);
+            RETURN_IF_EXCEPTION(scope, { });
+            const String& string = strings[i];
+            arguments[i].string.is8Bit = string.is8Bit();
+            arguments[i].string.length = string.length();
+            arguments[i].string.characters = string.is8Bit() ? static_cast<const void*>(string.characters8()) : static_cast<const void*>(string.characters16());
+            break;
+        }
+        }
+    }
+
+    JSObject* thisObj = jsCast<JSObject*>(JSValue(thisObject).toThis(globalObject, ECMAMode::sloppy()));
+    JSValueRef exception = nullptr;
+    JSValueRef result = definition.callAsFunction(toRef(globalObject), toRef(thisObj), arguments, &exception);
+    if (exception) {
+        throwException(globalObject, scope, toJS(globalObject, exception));
+        return JSValue::encode(jsUndefined());
+    }
+
+    // result must be a valid JSValue.
+    if (!result)
+        return JSValue::encode(jsUndefined());
+
+    return JSValue::encode(toJS(globalObject, result));
+}
+
+JSC_DEFINE_JIT_OPERATION(operationCallAPIFastCallback0, EncodedJSValue, (JSGlobalObject* globalObject, JSObject* thisObject, const APIFastCallbackData* data))
+{
+    VM& vm = globalObject->vm();
+    CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
+    JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+    return callFastCallback(globalObject, thisObject, *data, nullptr);
+}
+
+JSC_DEFINE_JIT_OPERATION(operationCallAPIFastCallback1, EncodedJSValue, (JSGlobalObject* globalObject, JSObject* thisObject, void* argument0, const APIFastCallbackData* data))
+{
+    VM& vm = globalObject->vm();
+    CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
+    JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+    void* arguments[] = { argument0 };
+    return callFastCallback(globalObject, thisObject, *data, arguments);
+}
+
+JSC_DEFINE_JIT_OPERATION(operationCallAPIFastCallback2, EncodedJSValue, (JSGlobalObject* globalObject, JSObject* thisObject, void* argument0, void* argument1, const APIFastCallbackData* data))
+{
+    VM& vm = globalObject->vm();
+    CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
+    JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+    void* arguments[] = { argument0, argument1 };
+    return callFastCallback(globalObject, thisObject, *data, arguments);
+}
+
+JSC_DEFINE_HOST_FUNCTION(callAPIFastCallbackFunction, (JSGlobalObject* globalObject, CallFrame* callFrame))
+{
+    JSFunction* callee = jsCast<JSFunction*>(callFrame->jsCallee());
+    const DOMJIT::Signature* signature = jsCast<NativeExecutable*>(callee->executable())->signatureFor(CodeForCall);
+    auto* data = static_cast<const APIFastCallbackData*>(signature->functionData);
+    return APICallbackFunction::callWithCallback(globalObject, callFrame, data->callAsFunction());
+}
+
+JSObject* createAPIFastCallbackFunction(VM& vm, JSGlobalObject* globalObject, const APIFastCallbackData& data, const String& name)
+{
+#if ENABLE(JIT)
+    if (Options::useJIT()) {
+        NativeExecutable* executable = vm.jitStubs->uncachedHostFunctionStub(vm, callAPIFastCallbackFunction, data.signature(), name);
+        // Match JSCallbackFunction, whose length is always 0.
+        return JSFunction::create(vm, globalObject, executable, 0, name);
+    }
+#endif
+    return JSCallbackFunction::create(vm, globalObject, data.callAsFunction(), name);
+}
+
+} // namespace JSC
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "JSObjectRefPrivate.h"
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class JSGlobalObject;
+class JSObject;
+class VM;
+
+namespace DOMJIT {
+class Signature;
+}
+
+// Pairs a classic JSObjectCallAsFunctionCallback with a typed fast path. Instances are interned and
+// immortal: optimized code embeds a pointer to them, and so does every function created from them.
+class APIFastCallbackData {
+    WTF_MAKE_NONCOPYABLE(APIFastCallbackData);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    // Returns nullptr if the definition cannot be expressed as a fast path.
+    static const APIFastCallbackData* get(JSObjectCallAsFunctionCallback, const JSFastCallbackDefinition&);
+
+    JSObjectCallAsFunctionCallback callAsFunction() const { return m_callAsFunction; }
+    const JSFastCallbackDefinition& definition() const { return m_definition; }
+    const DOMJIT::Signature* signature() const { return m_signature.get(); }
+
+    APIFastCallbackData(JSObjectCallAsFunctionCallback, const JSFastCallbackDefinition&);
+
+private:
+    JSObjectCallAsFunctionCallback m_callAsFunction;
+    JSFastCallbackDefinition m_definition;
+    std::unique_ptr<const DOMJIT::Signature> m_signature;
+};
+
+// Creates a function that DFG and FTL can call through the fast path, and that calls the classic
+// callback everywhere else. Without the JIT this is an ordinary JSCallbackFunction.
+JSObject* createAPIFastCallbackFunction(VM&, JSGlobalObject*, const APIFastCallbackData&, const String& name);
+
+} // namespace JSC
@@ -63,6 +63,38 @@ JS_EXPORT void JSDisableGCTimer(void);
 */
 JS_EXPORT JSObjectRef JSGetMemoryUsageStatistics(JSContextRef ctx);
 
+/*! @typedef JSValueProtectHandle A handle to a value protected by JSValueProtectWithHandle. 0 is never a valid handle. */
+typedef unsigned JSValueProtectHandle;
+
+/*!
+@function
+@abstract Protects a JavaScript value from garbage collection and returns a handle to it.
+@param ctx The execution context to use.
+@param value The JSValue to protect.
+@result A handle that keeps value alive until it is passed to JSValueReleaseProtectHandle.
+@discussion Unlike JSValueProtect, this does not look value up in a shared table, so it stays cheap
+for embedders that protect and release many values. Every call returns a new handle that must be
+released on its own. Handles belong to the context group of ctx.
+*/
+JS_EXPORT JSValueProtectHandle JSValueProtectWithHandle(JSContextRef ctx, JSValueRef value);
+
+/*!
+@function
+@abstract Gets the value protected by a handle.
+@param ctx The execution context to use.
+@param handle A handle returned by JSValueProtectWithHandle that has not been released.
+@result The protected value, or NULL if handle is 0.
+*/
+JS_EXPORT JSValueRef JSValueGetProtectedValue(JSContextRef ctx, JSValueProtectHandle handle);
+
+/*!
+@function
+@abstract Releases a handle returned by JSValueProtectWithHandle, allowing its value to be garbage collected.
+@param ctx The execution context to use.
+@param handle The handle to release. Passing 0 does nothing.
+*/
+JS_EXPORT void JSValueReleaseProtectHandle(JSContextRef ctx, JSValueProtectHandle handle);
+
 #ifdef __cplusplus
 }
 #endif
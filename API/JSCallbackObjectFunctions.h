@@ -27,6 +27,7 @@
 #pragma once
 
 #include "APICast.h"
+#include "APIFastCallbackFunction.h"
 #include "Error.h"
 #include "ExceptionHelpers.h"
 #include "JSCallbackFunction.h"
@@ -683,7 +684,11 @@ EncodedJSValue JSCallbackObject<Parent>::staticFunctionGetterImpl(JSGlobalObject
             if (OpaqueJSClassStaticFunctionsTable* staticFunctions = jsClass->staticFunctions(globalObject)) {
                 if (StaticFunctionEntry* entry = staticFunctions->get(name)) {
                     if (JSObjectCallAsFunctionCallback callAsFunction = entry->callAsFunction) {
-                        JSObject* o = JSCallbackFunction::create(vm, thisObj->globalObject(vm), callAsFunction, name);
+                        JSObject* o;
+                        if (entry->fastCallback)
+                            o = createAPIFastCallbackFunction(vm, thisObj->globalObject(vm), *entry->fastCallback, name);
+                        else
+                            o = JSCallbackFunction::create(vm, thisObj->globalObject(vm), callAsFunction, name);
                         thisObj->putDirect(vm, propertyName, o, entry->attributes);
                         return JSValue::encode(o);
                     }
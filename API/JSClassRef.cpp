@@ -27,6 +27,7 @@
 #include "JSClassRef.h"
 
 #include "APICast.h"
+#include "APIFastCallbackFunction.h"
 #include "InitializeThreading.h"
 #include "JSCInlines.h"
 #include "JSCallbackObject.h"
@@ -35,7 +36,18 @@ using namespace JSC;
 
 const JSClassDefinition kJSClassDefinitionEmpty = { 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
 
-OpaqueJSClass::OpaqueJSClass(const JSClassDefinition* definition, OpaqueJSClass* protoClass) 
+static const APIFastCallbackData* fastCallbackFor(const JSStaticFastFunction* fastFunction, const JSStaticFunction& staticFunction)
+{
+    if (!fastFunction || !staticFunction.callAsFunction)
+        return nullptr;
+    for (; fastFunction->name; ++fastFunction) {
+        if (!strcmp(fastFunction->name, staticFunction.name))
+            return APIFastCallbackData::get(staticFunction.callAsFunction, fastFunction->fastDefinition);
+    }
+    return nullptr;
+}
+
+OpaqueJSClass::OpaqueJSClass(const JSClassDefinition* definition, OpaqueJSClass* protoClass, const JSStaticFastFunction* fastFunctions)
     : parentClass(definition->parentClass)
     , prototypeClass(nullptr)
     , initialize(definition->initialize)
@@ -68,7 +80,7 @@ OpaqueJSClass::OpaqueJSClass(const JSClassDefinition* definition, OpaqueJSClass*
         while (staticFunction->name) {
             String functionName = String::fromUTF8(staticFunction->name);
             if (!functionName.isNull())
-                m_staticFunctions->set(functionName.impl(), makeUnique<StaticFunctionEntry>(staticFunction->callAsFunction, staticFunction->attributes));
+                m_staticFunctions->set(functionName.impl(), makeUnique<StaticFunctionEntry>(staticFunction->callAsFunction, staticFunction->attributes, fastCallbackFor(fastFunctions, *staticFunction)));
             ++staticFunction;
         }
     }
@@ -100,12 +112,12 @@ OpaqueJSClass::~OpaqueJSClass()
         JSClassRelease(prototypeClass);
 }
 
-Ref<OpaqueJSClass> OpaqueJSClass::createNoAutomaticPrototype(const JSClassDefinition* definition)
+Ref<OpaqueJSClass> OpaqueJSClass::createNoAutomaticPrototype(const JSClassDefinition* definition, const JSStaticFastFunction* fastFunctions)
 {
-    return adoptRef(*new OpaqueJSClass(definition, nullptr));
+    return adoptRef(*new OpaqueJSClass(definition, nullptr, fastFunctions));
 }
 
-Ref<OpaqueJSClass> OpaqueJSClass::create(const JSClassDefinition* clientDefinition)
+Ref<OpaqueJSClass> OpaqueJSClass::create(const JSClassDefinition* clientDefinition, const JSStaticFastFunction* fastFunctions)
 {
     JSClassDefinition definition = *clientDefinition; // Avoid modifying client copy.
 
@@ -115,8 +127,8 @@ Ref<OpaqueJSClass> OpaqueJSClass::create(const JSClassDefinition* clientDefiniti
     
     // We are supposed to use JSClassRetain/Release but since we know that we currently have
     // the only reference to this class object we cheat and use a RefPtr instead.
-    RefPtr<OpaqueJSClass> protoClass = adoptRef(new OpaqueJSClass(&protoDefinition, nullptr));
-    return adoptRef(*new OpaqueJSClass(&definition, protoClass.get()));
+    RefPtr<OpaqueJSClass> protoClass = adoptRef(new OpaqueJSClass(&protoDefinition, nullptr, fastFunctions));
+    return adoptRef(*new OpaqueJSClass(&definition, protoClass.get(), nullptr));
 }
 
 OpaqueJSClassContextData::OpaqueJSClassContextData(JSC::VM&, OpaqueJSClass* jsClass)
@@ -137,7 +149,7 @@ OpaqueJSClassContextData::OpaqueJSClassContextData(JSC::VM&, OpaqueJSClass* jsCl
         OpaqueJSClassStaticFunctionsTable::const_iterator end = jsClass->m_staticFunctions->end();
         for (OpaqueJSClassStaticFunctionsTable::const_iterator it = jsClass->m_staticFunctions->begin(); it != end; ++it) {
             ASSERT(!it->key->isAtom());
-            staticFunctions->add(it->key->isolatedCopy(), makeUnique<StaticFunctionEntry>(it->value->callAsFunction, it->value->attributes));
+            staticFunctions->add(it->key->isolatedCopy(), makeUnique<StaticFunctionEntry>(it->value->callAsFunction, it->value->attributes, it->value->fastCallback));
         }
     }
 }
@@ -30,9 +30,14 @@
 #include "Protect.h"
 #include "Weak.h"
 #include <JavaScriptCore/JSObjectRef.h>
+#include <JavaScriptCore/JSObjectRefPrivate.h>
 #include <wtf/HashMap.h>
 #include <wtf/text/WTFString.h>
 
+namespace JSC {
+class APIFastCallbackData;
+}
+
 struct StaticValueEntry {
     WTF_MAKE_FAST_ALLOCATED;
 public:
@@ -53,13 +58,14 @@ public:
 struct StaticFunctionEntry {
     WTF_MAKE_FAST_ALLOCATED;
 public:
-    StaticFunctionEntry(JSObjectCallAsFunctionCallback _callAsFunction, JSPropertyAttributes _attributes)
-        : callAsFunction(_callAsFunction), attributes(_attributes)
+    StaticFunctionEntry(JSObjectCallAsFunctionCallback _callAsFunction, JSPropertyAttributes _attributes, const JSC::APIFastCallbackData* _fastCallback = nullptr)
+        : callAsFunction(_callAsFunction), attributes(_attributes), fastCallback(_fastCallback)
     {
     }
 
     JSObjectCallAsFunctionCallback callAsFunction;
     JSPropertyAttributes attributes;
+    const JSC::APIFastCallbackData* fastCallback;
 };
 
 typedef HashMap<RefPtr<StringImpl>, std::unique_ptr<StaticValueEntry>> OpaqueJSClassStaticValuesTable;
@@ -88,8 +94,8 @@ public:
 };
 
 struct OpaqueJSClass : public ThreadSafeRefCounted<OpaqueJSClass> {
-    static Ref<OpaqueJSClass> create(const JSClassDefinition*);
-    static Ref<OpaqueJSClass> createNoAutomaticPrototype(const JSClassDefinition*);
+    static Ref<OpaqueJSClass> create(const JSClassDefinition*, const JSStaticFastFunction* = nullptr);
+    static Ref<OpaqueJSClass> createNoAutomaticPrototype(const JSClassDefinition*, const JSStaticFastFunction* = nullptr);
     JS_EXPORT_PRIVATE ~OpaqueJSClass();
     
     String className();
@@ -117,7 +123,7 @@ private:
 
     OpaqueJSClass();
     OpaqueJSClass(const OpaqueJSClass&);
-    OpaqueJSClass(const JSClassDefinition*, OpaqueJSClass* protoClass);
+    OpaqueJSClass(const JSClassDefinition*, OpaqueJSClass* protoClass, const JSStaticFastFunction*);
 
     OpaqueJSClassContextData& contextData(JSC::JSGlobalObject*);
 
@@ -28,16 +28,23 @@
 #include "JSContextRefInternal.h"
 
 #include "APICast.h"
+#include "APIUtils.h"
+#include "BlockDirectory.h"
 #include "CallFrame.h"
+#include "CompilerTimingScope.h"
+#include "HeapAllocationSampler.h"
 #include "InitializeThreading.h"
 #include "JSAPIGlobalObject.h"
 #include "JSAPIWrapperObject.h"
+#include "JSArray.h"
 #include "JSCallbackObject.h"
 #include "JSClassRef.h"
 #include "JSObjectInlines.h"
+#include "ObjectConstructor.h"
 #include "StackVisitor.h"
 #include "StrongInlines.h"
 #include "StructureInlines.h"
+#include "Subspace.h"
 #include "Watchdog.h"
 #include <wtf/text/StringBuilder.h>
 
@@ -112,6 +119,65 @@ void JSContextGroupClearExecutionTimeLimit(JSContextGroupRef group)
         vm.watchdog()->setTimeLimit(Watchdog::noTimeLimit);
 }
 
+void JSContextGroupReset(JSContextGroupRef group, bool clearCodeCache)
+{
+    if (!group) {
+        ASSERT_NOT_REACHED();
+        return;
+    }
+
+    VM& vm = *toJS(group);
+    JSLockHolder locker(&vm);
+    RELEASE_ASSERT(!vm.entryScope);
+
+    sanitizeStackForVM(vm);
+    if (clearCodeCache)
+        vm.deleteAllCode(PreventCollectionAndDeleteAllCode);
+    else
+        vm.deleteAllLinkedCode(PreventCollectionAndDeleteAllCode);
+    vm.clearSourceProviderCaches();
+    vm.heap.collectNow(Synchronousness::Sync, CollectionScope::Full);
+    vm.heap.sweepSynchronously();
+}
+
+void JSContextGroupNotifyIdle(JSContextGroupRef group, double idleTime)
+{
+    if (!group) {
+        ASSERT_NOT_REACHED();
+        return;
+    }
+
+    VM& vm = *toJS(group);
+    JSLockHolder locker(&vm);
+    RELEASE_ASSERT(!vm.entryScope);
+
+    vm.heap.notifyIdle(Seconds(idleTime));
+}
+
+JSStringRef JSContextGroupReleaseMemory(JSContextGroupRef group, JSMemoryPressureLevel level)
+{
+    if (!group) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+
+    VM& vm = *toJS(group);
+    JSLockHolder locker(&vm);
+    RELEASE_ASSERT(!vm.entryScope);
+
+    VM::MemoryPressureResponse response = vm.respondToMemoryPressure(level == kJSMemoryPressureCritical ? VM::MemoryPressure::Critical : VM::MemoryPressure::Moderate);
+
+    StringBuilder json;
+    json.append("{\"codeCache\":", response.codeCacheBytes);
+    json.append(",\"regExpCode\":", response.regExpCodeBytes);
+    json.append(",\"sourceProviderCache\":", response.sourceProviderCacheBytes);
+    json.append(",\"machineCode\":", response.machineCodeBytes);
+    json.append(",\"bytecode\":", response.bytecodeBytes);
+    json.append(",\"executableMemory\":", response.executableMemoryBytes);
+    json.append(",\"heap\":", response.heapBytes, '}');
+    return OpaqueJSString::tryCreate(json.toString()).leakRef();
+}
+
 // From the API's perspective, a global context remains alive iff it has been JSGlobalContextRetained.
 
 JSGlobalContextRef JSGlobalContextCreate(JSClassRef globalObjectClass)
@@ -268,6 +334,191 @@ void JSGlobalContextSetUnhandledRejectionCallback(JSGlobalContextRef ctx, JSObje
     globalObject->setUnhandledRejectionCallback(vm, object);
 }
 
+JSObjectRef JSContextGetHeapOccupancyStatistics(JSContextRef ctx, JSValueRef* exception)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    struct DirectoryOccupancy {
+        CString subspaceName;
+        size_t cellSize;
+        BlockDirectory::OccupancyStatistics statistics;
+    };
+
+    // Gather everything before allocating any result objects, since allocating may add directories.
+    Vector<DirectoryOccupancy> directories;
+    vm.heap.objectSpace().forEachDirectory(
+        [&] (BlockDirectory& directory) -> IterationStatus {
+            directories.append({ directory.subspace()->name(), directory.cellSize(), directory.occupancyStatistics() });
+            return IterationStatus::Continue;
+        });
+
+    JSArray* result = constructEmptyArray(globalObject, nullptr);
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+
+    for (unsigned i = 0; i < directories.size(); ++i) {
+        const DirectoryOccupancy& directory = directories[i];
+        const BlockDirectory::OccupancyStatistics& statistics = directory.statistics;
+
+        JSArray* histogram = constructEmptyArray(globalObject, nullptr);
+        if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+            return nullptr;
+        for (unsigned bucket = 0; bucket < BlockDirectory::OccupancyStatistics::numberOfOccupancyBuckets; ++bucket) {
+            histogram->putDirectIndex(globalObject, bucket, jsNumber(statistics.occupancyHistogram[bucket]));
+            if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+                return nullptr;
+        }
+
+        JSObject* object = constructEmptyObject(globalObject);
+        object->putDirect(vm, Identifier::fromString(vm, "subspace"), jsString(vm, String(directory.subspaceName.data())));
+        object->putDirect(vm, Identifier::fromString(vm, "cellSize"), jsNumber(directory.cellSize));
+        object->putDirect(vm, Identifier::fromString(vm, "blockCount"), jsNumber(statistics.blockCount));
+        object->putDirect(vm, Identifier::fromString(vm, "emptyBlockCount"), jsNumber(statistics.emptyBlockCount));
+        object->putDirect(vm, Identifier::fromString(vm, "liveCellCount"), jsNumber(statistics.liveCellCount));
+        object->putDirect(vm, Identifier::fromString(vm, "freeCellCount"), jsNumber(statistics.cellCapacity - statistics.liveCellCount));
+        object->putDirect(vm, Identifier::fromString(vm, "liveBytes"), jsNumber(statistics.liveCellCount * directory.cellSize));
+        object->putDirect(vm, Identifier::fromString(vm, "capacityBytes"), jsNumber(statistics.cellCapacity * directory.cellSize));
+        object->putDirect(vm, Identifier::fromString(vm, "occupancyHistogram"), histogram);
+
+        result->putDirectIndex(globalObject, i, object);
+        if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+            return nullptr;
+    }
+
+    return toRef(result);
+}
+
+void JSContextStartHeapAllocationSampling(JSContextRef ctx, size_t sampleInterval)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return;
+    }
+
+    VM& vm = toJS(ctx)->vm();
+    JSLockHolder locker(vm);
+    vm.heap.startAllocationSampling(sampleInterval);
+}
+
+JSObjectRef JSContextStopHeapAllocationSampling(JSContextRef ctx, JSValueRef* exception)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    // Stop before allocating any result objects so that we do not sample ourselves.
+    std::unique_ptr<HeapAllocationSampler> sampler = vm.heap.stopAllocationSampling();
+    if (!sampler)
+        return nullptr;
+    Vector<HeapAllocationSampler::Sample> samples = sampler->takeSamples();
+
+    JSArray* result = constructEmptyArray(globalObject, nullptr);
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+
+    for (unsigned i = 0; i < samples.size(); ++i) {
+        const HeapAllocationSampler::Sample& sample = samples[i];
+
+        JSArray* stackTrace = constructEmptyArray(globalObject, nullptr);
+        if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+            return nullptr;
+        for (unsigned frameIndex = 0; frameIndex < sample.stackTrace.size(); ++frameIndex) {
+            const HeapAllocationSampler::Frame& frame = sample.stackTrace[frameIndex];
+            JSObject* frameObject = constructEmptyObject(globalObject);
+            frameObject->putDirect(vm, Identifier::fromString(vm, "functionName"), jsString(vm, frame.functionName));
+            frameObject->putDirect(vm, Identifier::fromString(vm, "url"), jsString(vm, frame.url));
+            frameObject->putDirect(vm, Identifier::fromString(vm, "line"), jsNumber(frame.line));
+            frameObject->putDirect(vm, Identifier::fromString(vm, "column"), jsNumber(frame.column));
+            stackTrace->putDirectIndex(globalObject, frameIndex, frameObject);
+            if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+                return nullptr;
+        }
+
+        JSObject* object = constructEmptyObject(globalObject);
+        object->putDirect(vm, Identifier::fromString(vm, "bytes"), jsNumber(sample.bytes));
+        object->putDirect(vm, Identifier::fromString(vm, "cellSize"), jsNumber(sample.cellSize));
+        object->putDirect(vm, Identifier::fromString(vm, "isLive"), jsBoolean(sample.isLive()));
+        object->putDirect(vm, Identifier::fromString(vm, "stackTrace"), stackTrace);
+
+        result->putDirectIndex(globalObject, i, object);
+        if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+            return nullptr;
+    }
+
+    return toRef(result);
+}
+
+JSStringRef JSContextCreateRuntimeCountersSnapshot(JSContextRef ctx, unsigned maxCodeBlocks)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+
+    VM& vm = toJS(ctx)->vm();
+    JSLockHolder lock(vm);
+    return OpaqueJSString::tryCreate(vm.runtimeCounters().snapshotAsJSON(vm, maxCodeBlocks)).leakRef();
+}
+
+JSObjectRef JSContextGetCompilerPhaseStatistics(JSContextRef ctx, JSValueRef* exception)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    JSArray* result = constructEmptyArray(globalObject, nullptr);
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+
+    Vector<CompilerPhaseStatistics> phases = compilerPhaseStatistics();
+    for (unsigned i = 0; i < phases.size(); ++i) {
+        const CompilerPhaseStatistics& statistics = phases[i];
+
+        JSArray* histogram = constructEmptyArray(globalObject, nullptr);
+        if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+            return nullptr;
+        for (unsigned bucket = 0; bucket < CompilerPhaseStatistics::numberOfHistogramBuckets; ++bucket) {
+            histogram->putDirectIndex(globalObject, bucket, jsNumber(statistics.histogram[bucket]));
+            if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+                return nullptr;
+        }
+
+        JSObject* object = constructEmptyObject(globalObject);
+        object->putDirect(vm, Identifier::fromString(vm, "compiler"), jsString(vm, String(statistics.compilerName)));
+        object->putDirect(vm, Identifier::fromString(vm, "phase"), jsString(vm, String(statistics.name)));
+        object->putDirect(vm, Identifier::fromString(vm, "count"), jsNumber(statistics.count));
+        object->putDirect(vm, Identifier::fromString(vm, "totalMilliseconds"), jsNumber(statistics.total.milliseconds()));
+        object->putDirect(vm, Identifier::fromString(vm, "maxMilliseconds"), jsNumber(statistics.max.milliseconds()));
+        object->putDirect(vm, Identifier::fromString(vm, "microsecondLog2Histogram"), histogram);
+
+        result->putDirectIndex(globalObject, i, object);
+        if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+            return nullptr;
+    }
+
+    return toRef(result);
+}
+
 class BacktraceFunctor {
 public:
     BacktraceFunctor(StringBuilder& builder, unsigned remainingCapacityForFrameCapture)
@@ -94,6 +94,71 @@ JS_EXPORT void JSContextGroupSetExecutionTimeLimit(JSContextGroupRef group, doub
 */
 JS_EXPORT void JSContextGroupClearExecutionTimeLimit(JSContextGroupRef group) JSC_API_AVAILABLE(macos(10.6), ios(7.0));
 
+/*!
+@function
+@abstract Returns a context group to a clean state so that it can be reused.
+@param group The JavaScript context group to reset.
+@param clearCodeCache Pass true to also drop the group's cached unlinked bytecode. Pass false to keep it, so that scripts shared between users of the group compile quickly.
+@discussion Discards all compiled code, waits for pending JIT compilations, runs a full
+ garbage collection and returns empty heap blocks. The group's JIT thunks and heap
+ address space are kept, which makes this much cheaper than creating a new group.
+
+ Resetting cannot destroy global contexts that are still referenced, so release every
+ global context and value created in the group first. This must not be called while
+ the group is executing JavaScript.
+*/
+JS_EXPORT void JSContextGroupReset(JSContextGroupRef group, bool clearCodeCache);
+
+/*!
+@function
+@abstract Lets a context group's heap and JIT use an idle period of the embedder's event loop.
+@param group The JavaScript context group that should do the work.
+@param idleTime The number of seconds the embedder expects to stay idle.
+@discussion Within idleTime, this installs JIT compilations that have finished, runs the garbage
+ collection the GC timers were waiting to run if the previous collection of that kind took less
+ than the time that is left, finishes sweeping, and then returns empty heap blocks.
+
+ While idle notifications keep coming, GC timers that fire between two of them wait for the next
+ one instead of collecting, for up to one second after the last notification. Collections that
+ allocation forces still happen at any time. This must not be called while the group is executing
+ JavaScript.
+*/
+JS_EXPORT void JSContextGroupNotifyIdle(JSContextGroupRef group, double idleTime);
+
+/*!
+@enum JSMemoryPressureLevel
+@constant kJSMemoryPressureModerate Release caches and code that has not run recently, keeping what is in use.
+@constant kJSMemoryPressureCritical Release every cache and all compiled code.
+*/
+typedef enum {
+    kJSMemoryPressureModerate,
+    kJSMemoryPressureCritical
+} JSMemoryPressureLevel;
+
+/*!
+@function
+@abstract Releases memory held by a context group's caches and compiled code.
+@param group The JavaScript context group that should release memory.
+@param level How much to release.
+@result A JSON string holding the number of bytes released in each category.
+@discussion In order, this trims the source code cache, halving it under moderate pressure and
+ emptying it under critical pressure. Next it drops regular expression bytecode and JIT code, and
+ discards the parser's function caches. Under moderate pressure it then jettisons compiled code that
+ has not run for ten seconds, by default. Under critical pressure it discards all compiled code. Finally it runs
+ a full garbage collection that returns empty heap blocks and the executable memory of the code it
+ released. The result has the following fields:
+ codeCache: bytes of cached top-level bytecode evicted
+ regExpCode: bytes of regular expression bytecode and JIT code released
+ sourceProviderCache: bytes of parser function caches released
+ machineCode: bytes of JIT code belonging to CodeBlocks that were thrown away
+ bytecode: bytes of bytecode belonging to CodeBlocks that were thrown away
+ executableMemory: drop in committed executable memory
+ heap: drop in the capacity of the garbage collected heap
+
+ This must not be called while the group is executing JavaScript.
+*/
+JS_EXPORT JSStringRef JSContextGroupReleaseMemory(JSContextGroupRef group, JSMemoryPressureLevel level);
+
 /*!
 @function
 @abstract Gets a whether or not remote inspection is enabled on the context.
@@ -138,6 +203,78 @@ JS_EXPORT void JSGlobalContextSetIncludesNativeCallStackWhenReportingExceptions(
 */
 JS_EXPORT void JSGlobalContextSetUnhandledRejectionCallback(JSGlobalContextRef ctx, JSObjectRef function, JSValueRef* exception) JSC_API_AVAILABLE(macos(10.15.4), ios(13.4));
 
+/*!
+@function
+@abstract Produces an array describing how full each GC heap size class is.
+@param ctx The execution context to use.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result An array with one object per block directory, or NULL if an exception was thrown.
+@discussion Unlike a heap snapshot, this does not visit individual objects, so it is cheap enough to call on large heaps. Live counts reflect the most recent garbage collection. Each object in the result has the following fields:
+ subspace: name of the subspace the size class belongs to
+ cellSize: size of a cell in this size class, in bytes
+ blockCount: number of blocks in this size class
+ emptyBlockCount: number of blocks with no live cells
+ liveCellCount: number of live cells
+ freeCellCount: number of cells that are available for allocation
+ liveBytes: liveCellCount * cellSize
+ capacityBytes: total number of bytes available for cells in this size class
+ occupancyHistogram: array of 10 block counts, where entry i counts the non-empty blocks that are between i and i + 1 tenths full
+*/
+JS_EXPORT JSObjectRef JSContextGetHeapOccupancyStatistics(JSContextRef ctx, JSValueRef* exception);
+
+/*!
+@function
+@abstract Starts sampling allocations in the GC heap.
+@param ctx The execution context to use.
+@param sampleInterval The average number of bytes allocated between two samples.
+@discussion Sample points are spread randomly over the allocated bytes, so each sample stands for sampleInterval bytes of allocation on average. Starting again discards any samples taken so far.
+*/
+JS_EXPORT void JSContextStartHeapAllocationSampling(JSContextRef ctx, size_t sampleInterval);
+
+/*!
+@function
+@abstract Stops sampling allocations in the GC heap and returns the samples taken.
+@param ctx The execution context to use.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result An array with one object per sample, or NULL if sampling was not started or an exception was thrown.
+@discussion Liveness reflects the most recent garbage collection. Each object in the result has the following fields:
+ bytes: number of allocated bytes this sample stands for
+ cellSize: size class of the sampled allocation, in bytes
+ isLive: whether the sampled cell survived every garbage collection since it was allocated
+ stackTrace: array of the innermost frames at the time of the allocation, each with functionName, url, line and column
+*/
+JS_EXPORT JSObjectRef JSContextStopHeapAllocationSampling(JSContextRef ctx, JSValueRef* exception);
+
+/*!
+@function
+@abstract Takes a snapshot of the counters that track deoptimization and tier-up.
+@param ctx The execution context to use.
+@param maxCodeBlocks The maximum number of CodeBlocks to list in inlineCacheSlowPaths.
+@result A JSON string. Counts are cumulative for the lifetime of the context group, so rates come from comparing two snapshots.
+@discussion The snapshot is cheap enough to take periodically and has the following fields:
+ osrExits: number of OSR exits for each exit kind
+ jettisons: number of optimized CodeBlocks thrown away for each jettison reason
+ functionsByTier: number of functions, evals and programs whose installed code is in each tier
+ inlineCacheSlowPaths: the CodeBlocks whose inline caches took their slow paths most often, each with name, hash, tier, inlineCacheCount, slowPathCount and osrExitCount
+*/
+JS_EXPORT JSStringRef JSContextCreateRuntimeCountersSnapshot(JSContextRef ctx, unsigned maxCodeBlocks);
+
+/*!
+@function
+@abstract Produces an array describing how long each JIT compiler phase has taken.
+@param ctx The execution context to use.
+@param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+@result An array with one object per compiler phase, or NULL if an exception was thrown.
+@discussion Phase times are only collected while the collectCompilerPhaseStatistics, logPhaseTimes or reportTotalPhaseTimes option is set, and they are shared by every context group in the process. Each object in the result has the following fields:
+ compiler: name of the compiler, for example DFG, FTL, B3 or Air
+ phase: name of the phase, or "total compile" and "queue wait" for whole DFG and FTL plans
+ count: number of times the phase ran
+ totalMilliseconds: time spent in all runs of the phase
+ maxMilliseconds: time spent in the slowest run of the phase
+ microsecondLog2Histogram: array of 24 run counts, where entry i counts the runs that took less than 2^i microseconds and the last entry also counts slower runs
+*/
+JS_EXPORT JSObjectRef JSContextGetCompilerPhaseStatistics(JSContextRef ctx, JSValueRef* exception);
+
 #ifdef __cplusplus
 }
 #endif
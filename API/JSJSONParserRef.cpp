@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "JSJSONParserRefPrivate.h"
+
+#include "APICast.h"
+#include "JSCInlines.h"
+#include "LiteralParser.h"
+#include <wtf/text/ASCIIFastPath.h>
+
+using namespace JSC;
+
+struct OpaqueJSJSONParser {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    bool append(const char* bytes, size_t length);
+    void clear();
+
+    void appendCharacters(const LChar*, size_t length);
+    void appendCharacters(const UChar*, size_t length);
+    bool decodeAndAppend(const char* bytes, size_t length);
+
+    Vector<LChar> characters8;
+    Vector<UChar> characters16;
+    bool is8Bit { true };
+    bool failed { false };
+    // The start of a multi-byte sequence that the previous chunk ended in the middle of.
+    Vector<char, 4> pendingBytes;
+};
+
+static size_t utf8SequenceLength(uint8_t leadByte)
+{
+    if (leadByte < 0x80)
+        return 1;
+    if ((leadByte & 0xE0) == 0xC0)
+        return 2;
+    if ((leadByte & 0xF0) == 0xE0)
+        return 3;
+    if ((leadByte & 0xF8) == 0xF0)
+        return 4;
+    return 1;
+}
+
+// Returns the number of trailing bytes that begin a sequence the chunk does not complete.
+static size_t incompleteUTF8SuffixLength(const char* bytes, size_t length)
+{
+    for (size_t suffixLength = 1; suffixLength <= std::min<size_t>(length, 4); ++suffixLength) {
+        uint8_t byte = bytes[length - suffixLength];
+        if ((byte & 0xC0) == 0x80)
+            continue;
+        return utf8SequenceLength(byte) > suffixLength ? suffixLength : 0;
+    }
+    return 0;
+}
+
+void OpaqueJSJSONParser::appendCharacters(const LChar* characters, size_t length)
+{
+    if (is8Bit)
+        characters8.append(characters, length);
+    else
+        characters16.append(characters, length);
+}
+
+void OpaqueJSJSONParser::appendCharacters(const UChar* characters, size_t length)
+{
+    if (is8Bit) {
+        characters16.reserveInitialCapacity(characters8.size() + length);
+        characters16.append(characters8.data(), characters8.size());
+        characters8.clear();
+        is8Bit = false;
+    }
+    characters16.append(characters, length);
+}
+
+bool OpaqueJSJSONParser::decodeAndAppend(const char* bytes, size_t length)
+{
+    if (!length)
+        return true;
+    auto* latin1 = reinterpret_cast<const LChar*>(bytes);
+    if (charactersAreAllASCII(latin1, length)) {
+        appendCharacters(latin1, length);
+        return true;
+    }
+    String decoded = String::fromUTF8(latin1, length);
+    if (decoded.isNull())
+        return false;
+    if (decoded.is8Bit())
+        appendCharacters(decoded.characters8(), decoded.length());
+    else
+        appendCharacters(decoded.characters16(), decoded.length());
+    return true;
+}
+
+bool OpaqueJSJSONParser::append(const char* bytes, size_t length)
+{
+    if (failed)
+        return false;
+
+    if (!pendingBytes.isEmpty()) {
+        size_t missingLength = utf8SequenceLength(pendingBytes[0]) - pendingBytes.size();
+        size_t takenLength = std::min(missingLength, length);
+        pendingBytes.append(bytes, takenLength);
+        bytes += takenLength;
+        length -= takenLength;
+        if (takenLength < missingLength)
+            return true;
+        if (!decodeAndAppend(pendingBytes.data(), pendingBytes.size())) {
+            failed = true;
+            return false;
+        }
+        pendingBytes.clear();
+    }
+
+    size_t suffixLength = incompleteUTF8SuffixLength(bytes, length);
+    if (!decodeAndAppend(bytes, length - suffixLength)) {
+        failed = true;
+        return false;
+    }
+    pendingBytes.append(bytes + length - suffixLength, suffixLength);
+
+    if ((is8Bit ? characters8.size() : characters16.size()) > String::MaxLength) {
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+void OpaqueJSJSONParser::clear()
+{
+    characters8.clear();
+    characters16.clear();
+    pendingBytes.clear();
+    is8Bit = true;
+    failed = false;
+}
+
+JSJSONParserRef JSJSONParserCreate(void)
+{
+    return new OpaqueJSJSONParser;
+}
+
+void JSJSONParserRelease(JSJSONParserRef parser)
+{
+    delete parser;
+}
+
+bool JSJSONParserAppendUTF8Bytes(JSJSONParserRef parser, const char* bytes, size_t length)
+{
+    return parser->append(bytes, length);
+}
+
+JSValueRef JSJSONParserFinish(JSContextRef ctx, JSJSONParserRef parser)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    JSLockHolder locker(globalObject);
+
+    JSValue result;
+    if (!parser->failed && parser->pendingBytes.isEmpty()) {
+        if (parser->is8Bit) {
+            LiteralParser<LChar> literalParser(globalObject, parser->characters8.data(), parser->characters8.size(), StrictJSON);
+            result = literalParser.tryLiteralParse();
+        } else {
+            LiteralParser<UChar> literalParser(globalObject, parser->characters16.data(), parser->characters16.size(), StrictJSON);
+            result = literalParser.tryLiteralParse();
+        }
+    }
+    parser->clear();
+    return toRef(globalObject, result);
+}
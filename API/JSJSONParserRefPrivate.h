@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#ifndef JSJSONParserRefPrivate_h
+#define JSJSONParserRefPrivate_h
+
+#include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*! @typedef JSJSONParserRef A parser that accumulates JSON text delivered in pieces. */
+typedef struct OpaqueJSJSONParser* JSJSONParserRef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @function
+ @abstract Creates a parser for JSON text that arrives as a sequence of UTF-8 chunks.
+ @result A JSJSONParserRef with no input. Ownership follows the Create Rule.
+ @discussion The parser is not tied to a context, so chunks can be appended on any thread, for example as they arrive from the network, without holding the API lock.
+ */
+JS_EXPORT JSJSONParserRef JSJSONParserCreate(void);
+
+/*!
+ @function
+ @abstract Releases a JSON parser.
+ @param parser The parser to release.
+ */
+JS_EXPORT void JSJSONParserRelease(JSJSONParserRef parser);
+
+/*!
+ @function
+ @abstract Appends a chunk of UTF-8 encoded JSON text to a parser.
+ @param parser The parser to append to.
+ @param bytes The UTF-8 bytes to append. A multi-byte sequence may be split across chunks.
+ @param length The number of bytes to append.
+ @result false if the input seen so far is not valid UTF-8, otherwise true. Once this returns false, the parser rejects all further input.
+ @discussion The bytes are decoded into the parser's own buffer as they arrive, so the complete document is never held as a separate UTF-8 copy or as a JavaScript string.
+ */
+JS_EXPORT bool JSJSONParserAppendUTF8Bytes(JSJSONParserRef parser, const char* bytes, size_t length);
+
+/*!
+ @function
+ @abstract Parses the JSON text appended to a parser.
+ @param ctx The execution context to use.
+ @param parser The parser whose input should be parsed.
+ @result A JSValue containing the parsed value, or NULL if the input was not valid JSON or ended in the middle of a UTF-8 sequence.
+ @discussion The parser's input is discarded afterwards, so the parser can be reused for another document.
+ */
+JS_EXPORT JSValueRef JSJSONParserFinish(JSContextRef ctx, JSJSONParserRef parser);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSJSONParserRefPrivate_h */
@@ -29,6 +29,7 @@
 #include "JSObjectRefPrivate.h"
 
 #include "APICast.h"
+#include "APIFastCallbackFunction.h"
 #include "APIUtils.h"
 #include "DateConstructor.h"
 #include "FunctionConstructor.h"
@@ -64,6 +65,16 @@ JSClassRef JSClassCreate(const JSClassDefinition* definition)
     return &jsClass.leakRef();
 }
 
+JSClassRef JSClassCreateWithFastStaticFunctions(const JSClassDefinition* definition, const JSStaticFastFunction* fastFunctions)
+{
+    JSC::initialize();
+    auto jsClass = (definition->attributes & kJSClassAttributeNoAutomaticPrototype)
+        ? OpaqueJSClass::createNoAutomaticPrototype(definition, fastFunctions)
+        : OpaqueJSClass::create(definition, fastFunctions);
+
+    return &jsClass.leakRef();
+}
+
 JSClassRef JSClassRetain(JSClassRef jsClass)
 {
     jsClass->ref();
@@ -107,6 +118,21 @@ JSObjectRef JSObjectMakeFunctionWithCallback(JSContextRef ctx, JSStringRef name,
     return toRef(JSCallbackFunction::create(vm, globalObject, callAsFunction, name ? name->string() : "anonymous"_s));
 }
 
+JSObjectRef JSObjectMakeFunctionWithFastCallback(JSContextRef ctx, JSStringRef name, JSObjectCallAsFunctionCallback callAsFunction, const JSFastCallbackDefinition* fastDefinition)
+{
+    if (!ctx || !fastDefinition) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    const APIFastCallbackData* data = APIFastCallbackData::get(callAsFunction, *fastDefinition);
+    if (!data)
+        return nullptr;
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    return toRef(createAPIFastCallbackFunction(vm, globalObject, *data, name ? name->string() : "anonymous"_s));
+}
+
 JSObjectRef JSObjectMakeConstructor(JSContextRef ctx, JSClassRef jsClass, JSObjectCallAsConstructorCallback callAsConstructor)
 {
     if (!ctx) {
@@ -71,6 +71,98 @@ JS_EXPORT JSObjectRef JSObjectGetProxyTarget(JSObjectRef);
 
 JS_EXPORT JSGlobalContextRef JSObjectGetGlobalContext(JSObjectRef object);
 
+/*!
+@enum JSFastCallbackArgumentType
+@constant kJSFastCallbackArgumentTypeInt32 The argument is a 32-bit integer, delivered in the int32 field.
+@constant kJSFastCallbackArgumentTypeBoolean The argument is a boolean, delivered in the boolean field.
+@constant kJSFastCallbackArgumentTypeString The argument is a string, delivered in the string field.
+*/
+typedef enum {
+    kJSFastCallbackArgumentTypeInt32,
+    kJSFastCallbackArgumentTypeBoolean,
+    kJSFastCallbackArgumentTypeString
+} JSFastCallbackArgumentType;
+
+/*!
+@struct JSStringView
+@abstract A borrowed view of a string's characters, valid only for the duration of the callback it was passed to.
+@field characters Latin-1 characters if is8Bit is true, otherwise UTF-16 code units. Not null-terminated.
+@field length The number of characters.
+@field is8Bit Whether characters points to Latin-1 characters.
+*/
+typedef struct {
+    const void* characters;
+    size_t length;
+    bool is8Bit;
+} JSStringView;
+
+/*!
+@union JSFastCallbackArgument
+@abstract An argument passed to a JSObjectFastCallAsFunctionCallback. The valid field is determined by the JSFastCallbackArgumentType declared for it.
+*/
+typedef union {
+    int int32;
+    bool boolean;
+    JSStringView string;
+} JSFastCallbackArgument;
+
+/*!
+@typedef JSObjectFastCallAsFunctionCallback
+@abstract The callback invoked by optimized code when a function with a fast callback is called with arguments of the declared types.
+@param ctx The execution context to use.
+@param thisObject The object that is the 'this' of the call.
+@param arguments The typed arguments, one per declared argument type.
+@param exception A pointer to a JSValueRef in which to return an exception, if any.
+@result The function's return value, or NULL to return undefined.
+@discussion The callback is invoked without releasing the JavaScriptCore lock, and must produce the same result as the classic callback it was registered with would for the same arguments.
+*/
+typedef JSValueRef (*JSObjectFastCallAsFunctionCallback)(JSContextRef ctx, JSObjectRef thisObject, const JSFastCallbackArgument arguments[], JSValueRef* exception);
+
+/*!
+@struct JSFastCallbackDefinition
+@abstract Describes the typed fast path of a function.
+@field callAsFunction The callback invoked on the fast path.
+@field argumentCount The number of arguments the fast path accepts. At most 2.
+@field argumentTypes The type of each argument.
+*/
+typedef struct {
+    JSObjectFastCallAsFunctionCallback callAsFunction;
+    unsigned argumentCount;
+    JSFastCallbackArgumentType argumentTypes[2];
+} JSFastCallbackDefinition;
+
+/*!
+@function
+@abstract Convenience method for creating a JavaScript function with a typed fast path.
+@param ctx The execution context to use.
+@param name A JSString containing the function's name. This will be used when converting the function to string. Pass NULL to create an anonymous function.
+@param callAsFunction The JSObjectCallAsFunctionCallback to invoke when the fast path does not apply.
+@param fastDefinition The JSFastCallbackDefinition describing the fast path.
+@result A JSObject that is a function.
+@discussion When optimizing JIT code calls the function as a method with exactly argumentCount arguments of the declared types, fastDefinition's callback is called directly, without boxing the arguments. Every other call goes to callAsFunction. Returns NULL if fastDefinition is invalid.
+*/
+JS_EXPORT JSObjectRef JSObjectMakeFunctionWithFastCallback(JSContextRef ctx, JSStringRef name, JSObjectCallAsFunctionCallback callAsFunction, const JSFastCallbackDefinition* fastDefinition);
+
+/*!
+@struct JSStaticFastFunction
+@abstract Attaches a typed fast path to a function in a JSClassDefinition's staticFunctions table.
+@field name The name of the static function, matching its JSStaticFunction entry.
+@field fastDefinition The JSFastCallbackDefinition describing the fast path.
+*/
+typedef struct {
+    const char* name;
+    JSFastCallbackDefinition fastDefinition;
+} JSStaticFastFunction;
+
+/*!
+@function
+@abstract Creates a JavaScript class whose static functions have typed fast paths.
+@param definition A JSClassDefinition that defines the class.
+@param fastFunctions An array of JSStaticFastFunction terminated by an entry whose name is NULL. Entries that do not name a static function in definition are ignored.
+@result A JSClass with the given definition. Ownership follows the Create Rule.
+*/
+JS_EXPORT JSClassRef JSClassCreateWithFastStaticFunctions(const JSClassDefinition* definition, const JSStaticFastFunction* fastFunctions);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "JSPropertyKeyListRefPrivate.h"
+
+#include "APICast.h"
+#include "APIUtils.h"
+#include "JSCInlines.h"
+#include "OpaqueJSString.h"
+#include "PropertyDescriptor.h"
+#include <wtf/HashSet.h>
+#include <wtf/ThreadSafeRefCounted.h>
+
+using namespace JSC;
+
+struct OpaqueJSPropertyKeyList : public ThreadSafeRefCounted<OpaqueJSPropertyKeyList> {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    OpaqueJSPropertyKeyList(VM& vm)
+        : vm(vm)
+    {
+    }
+
+    void get(JSGlobalObject*, JSObject*, JSValueRef* values);
+    void set(JSGlobalObject*, JSObject*, const JSValueRef* values, unsigned attributes);
+
+    Ref<VM> vm;
+    Vector<Identifier> keys;
+    // Index and duplicate keys can't be described by a single structure transition.
+    bool isCacheable { true };
+
+    // Every key was an own data property of objects with this structure, at these offsets.
+    Weak<Structure> getStructure;
+    Vector<PropertyOffset> getOffsets;
+
+    // Defining the keys with setAttributes took objects from setOldStructure to setNewStructure,
+    // placing the values at these offsets.
+    Weak<Structure> setOldStructure;
+    Weak<Structure> setNewStructure;
+    unsigned setAttributes { 0 };
+    Vector<PropertyOffset> setOffsets;
+};
+
+void OpaqueJSPropertyKeyList::get(JSGlobalObject* globalObject, JSObject* object, JSValueRef* values)
+{
+    auto scope = DECLARE_THROW_SCOPE(vm.get());
+    Structure* structure = object->structure(vm.get());
+    if (getStructure.get() == structure) {
+        for (size_t i = 0; i < keys.size(); ++i)
+            values[i] = toRef(globalObject, object->getDirect(getOffsets[i]));
+        return;
+    }
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        JSValue value = object->get(globalObject, keys[i]);
+        RETURN_IF_EXCEPTION(scope, void());
+        values[i] = toRef(globalObject, value);
+    }
+
+    // Getters may have changed the object, and other objects can intercept property lookups.
+    if (!isCacheable || object->type() != FinalObjectType || structure->isDictionary() || object->structure(vm.get()) != structure)
+        return;
+
+    Vector<PropertyOffset> offsets;
+    offsets.reserveInitialCapacity(keys.size());
+    for (auto& key : keys) {
+        unsigned attributes;
+        PropertyOffset offset = structure->get(vm.get(), key, attributes);
+        if (!isValidOffset(offset) || (attributes & PropertyAttribute::AccessorOrCustomAccessorOrValue))
+            return;
+        offsets.uncheckedAppend(offset);
+    }
+    getStructure = Weak<Structure>(structure);
+    getOffsets = WTFMove(offsets);
+}
+
+void OpaqueJSPropertyKeyList::set(JSGlobalObject* globalObject, JSObject* object, const JSValueRef* values, unsigned attributes)
+{
+    auto scope = DECLARE_THROW_SCOPE(vm.get());
+    Structure* structure = object->structure(vm.get());
+    Structure* newStructure = setNewStructure.get();
+    if (newStructure && setOldStructure.get() == structure && setAttributes == attributes) {
+        // Every intermediate transition was taken when the cache was filled, so the watchpoints on
+        // these structures have already fired and we can go straight to the final structure, like
+        // putDirectInternal does for a single existing transition.
+        size_t oldCapacity = structure->outOfLineCapacity();
+        size_t newCapacity = newStructure->outOfLineCapacity();
+        if (oldCapacity != newCapacity) {
+            Butterfly* newButterfly = object->allocateMoreOutOfLineStorage(vm.get(), oldCapacity, newCapacity);
+            object->nukeStructureAndSetButterfly(vm.get(), structure->id(), newButterfly);
+        }
+        for (size_t i = 0; i < keys.size(); ++i)
+            object->putDirect(vm.get(), setOffsets[i], toJS(globalObject, values[i]));
+        object->setStructure(vm.get(), newStructure);
+        return;
+    }
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        PropertyDescriptor descriptor(toJS(globalObject, values[i]), attributes);
+        object->methodTable(vm.get())->defineOwnProperty(object, globalObject, keys[i], descriptor, false);
+        RETURN_IF_EXCEPTION(scope, void());
+    }
+
+    // Only cache plain objects gaining exactly these keys, so that the old structure alone determines the outcome.
+    if (!isCacheable || object->type() != FinalObjectType || structure->isDictionary())
+        return;
+    newStructure = object->structure(vm.get());
+    if (newStructure == structure || newStructure->isDictionary())
+        return;
+
+    Vector<PropertyOffset> offsets;
+    offsets.reserveInitialCapacity(keys.size());
+    for (auto& key : keys) {
+        unsigned newAttributes;
+        if (isValidOffset(structure->get(vm.get(), key)))
+            return;
+        PropertyOffset offset = newStructure->get(vm.get(), key, newAttributes);
+        if (!isValidOffset(offset) || newAttributes != attributes)
+            return;
+        offsets.uncheckedAppend(offset);
+    }
+    setOldStructure = Weak<Structure>(structure);
+    setNewStructure = Weak<Structure>(newStructure);
+    setAttributes = attributes;
+    setOffsets = WTFMove(offsets);
+}
+
+JSPropertyKeyListRef JSPropertyKeyListCreate(JSContextRef ctx, const JSStringRef keys[], size_t keyCount)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+
+    auto list = adoptRef(*new OpaqueJSPropertyKeyList(vm));
+    HashSet<UniquedStringImpl*> seenKeys;
+    list->keys.reserveInitialCapacity(keyCount);
+    for (size_t i = 0; i < keyCount; ++i) {
+        Identifier key = keys[i]->identifier(&vm);
+        if (parseIndex(key) || !seenKeys.add(key.impl()).isNewEntry)
+            list->isCacheable = false;
+        list->keys.uncheckedAppend(WTFMove(key));
+    }
+    return &list.leakRef();
+}
+
+JSPropertyKeyListRef JSPropertyKeyListRetain(JSPropertyKeyListRef keys)
+{
+    keys->ref();
+    return keys;
+}
+
+void JSPropertyKeyListRelease(JSPropertyKeyListRef keys)
+{
+    // The identifiers and weak handles must be destroyed with the lock held.
+    JSLockHolder locker(keys->vm.get());
+    keys->deref();
+}
+
+size_t JSPropertyKeyListGetCount(JSPropertyKeyListRef keys)
+{
+    return keys->keys.size();
+}
+
+bool JSObjectGetProperties(JSContextRef ctx, JSObjectRef object, JSPropertyKeyListRef keys, JSValueRef values[], JSValueRef* exception)
+{
+    if (!ctx || !object || !keys) {
+        ASSERT_NOT_REACHED();
+        return false;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    if (&keys->vm.get() != &vm) {
+        ASSERT_NOT_REACHED();
+        return false;
+    }
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    keys->get(globalObject, toJS(object), values);
+    return handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidNotThrow;
+}
+
+bool JSObjectSetProperties(JSContextRef ctx, JSObjectRef object, JSPropertyKeyListRef keys, const JSValueRef values[], JSPropertyAttributes attributes, JSValueRef* exception)
+{
+    if (!ctx || !object || !keys) {
+        ASSERT_NOT_REACHED();
+        return false;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    if (&keys->vm.get() != &vm) {
+        ASSERT_NOT_REACHED();
+        return false;
+    }
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    keys->set(globalObject, toJS(object), values, attributes);
+    return handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidNotThrow;
+}
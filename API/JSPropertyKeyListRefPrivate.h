@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#ifndef JSPropertyKeyListRefPrivate_h
+#define JSPropertyKeyListRefPrivate_h
+
+#include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/JSObjectRef.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*! @typedef JSPropertyKeyListRef An ordered list of property names, resolved once, for reading or writing several properties in one call. */
+typedef struct OpaqueJSPropertyKeyList* JSPropertyKeyListRef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @function
+ @abstract Creates a list of property keys.
+ @param ctx The execution context to use. The list can only be used with contexts in the same context group.
+ @param keys An array of JSStrings naming the properties.
+ @param keyCount The number of keys.
+ @result A JSPropertyKeyListRef. Ownership follows the Create Rule.
+ @discussion The list keeps its context group alive, and remembers the object shape it was last used with, so that reading the same keys from, or adding them to, objects built the same way skips the per-property lookups.
+ */
+JS_EXPORT JSPropertyKeyListRef JSPropertyKeyListCreate(JSContextRef ctx, const JSStringRef keys[], size_t keyCount);
+
+/*!
+ @function
+ @abstract Retains a list of property keys.
+ @param keys The JSPropertyKeyList to retain.
+ @result A JSPropertyKeyList that is the same as keys.
+ */
+JS_EXPORT JSPropertyKeyListRef JSPropertyKeyListRetain(JSPropertyKeyListRef keys);
+
+/*!
+ @function
+ @abstract Releases a list of property keys.
+ @param keys The JSPropertyKeyList to release.
+ */
+JS_EXPORT void JSPropertyKeyListRelease(JSPropertyKeyListRef keys);
+
+/*!
+ @function
+ @abstract Gets the number of keys in a list.
+ @param keys The JSPropertyKeyList whose count you want to know.
+ @result The number of keys in the list.
+ */
+JS_EXPORT size_t JSPropertyKeyListGetCount(JSPropertyKeyListRef keys);
+
+/*!
+ @function
+ @abstract Gets several properties from an object.
+ @param ctx The execution context to use.
+ @param object The JSObject whose properties you want to get.
+ @param keys The JSPropertyKeyList naming the properties.
+ @param values An array with room for one JSValue per key, filled in the order of the keys.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result false if an exception was thrown, otherwise true.
+ @discussion Equivalent to calling JSObjectGetProperty for each key in order.
+ */
+JS_EXPORT bool JSObjectGetProperties(JSContextRef ctx, JSObjectRef object, JSPropertyKeyListRef keys, JSValueRef values[], JSValueRef* exception);
+
+/*!
+ @function
+ @abstract Defines several data properties on an object.
+ @param ctx The execution context to use.
+ @param object The JSObject on which to define the properties.
+ @param keys The JSPropertyKeyList naming the properties.
+ @param values An array with one JSValue per key.
+ @param attributes A logically ORed set of JSPropertyAttributes to give to every property.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result false if an exception was thrown, otherwise true.
+ @discussion Each key becomes an own data property of object, in order, as it would in an object literal: setters on the prototype chain are not invoked.
+ */
+JS_EXPORT bool JSObjectSetProperties(JSContextRef ctx, JSObjectRef object, JSPropertyKeyListRef keys, const JSValueRef values[], JSPropertyAttributes attributes, JSValueRef* exception);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSPropertyKeyListRefPrivate_h */
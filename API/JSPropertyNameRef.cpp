@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "JSPropertyNameRefPrivate.h"
+
+#include "APICast.h"
+#include "APIUtils.h"
+#include "JSCInlines.h"
+#include "OpaqueJSString.h"
+#include "PropertyDescriptor.h"
+#include <wtf/ThreadSafeRefCounted.h>
+
+using namespace JSC;
+
+struct OpaqueJSPropertyName : public ThreadSafeRefCounted<OpaqueJSPropertyName> {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    OpaqueJSPropertyName(VM& vm, Identifier&& identifier)
+        : vm(vm)
+        , identifier(WTFMove(identifier))
+        , isCacheable(!parseIndex(this->identifier))
+    {
+    }
+
+    JSValue get(JSGlobalObject*, JSObject*);
+    void set(JSGlobalObject*, JSObject*, JSValue, unsigned attributes);
+
+    void updateCache(JSObject*);
+
+    Ref<VM> vm;
+    Identifier identifier;
+    bool isCacheable;
+
+    // Objects with this structure have the property as an own data property at this offset.
+    Weak<Structure> cachedStructure;
+    PropertyOffset cachedOffset { invalidOffset };
+    unsigned cachedAttributes { 0 };
+};
+
+void OpaqueJSPropertyName::updateCache(JSObject* object)
+{
+    if (!isCacheable || object->type() != FinalObjectType)
+        return;
+    Structure* structure = object->structure(vm.get());
+    if (structure->isDictionary())
+        return;
+    unsigned attributes;
+    PropertyOffset offset = structure->get(vm.get(), identifier, attributes);
+    if (!isValidOffset(offset) || (attributes & PropertyAttribute::AccessorOrCustomAccessorOrValue))
+        return;
+    cachedStructure = Weak<Structure>(structure);
+    cachedOffset = offset;
+    cachedAttributes = attributes;
+}
+
+JSValue OpaqueJSPropertyName::get(JSGlobalObject* globalObject, JSObject* object)
+{
+    auto scope = DECLARE_THROW_SCOPE(vm.get());
+    if (cachedStructure.get() == object->structure(vm.get()))
+        return object->getDirect(cachedOffset);
+
+    JSValue value = object->get(globalObject, identifier);
+    RETURN_IF_EXCEPTION(scope, { });
+    updateCache(object);
+    return value;
+}
+
+void OpaqueJSPropertyName::set(JSGlobalObject* globalObject, JSObject* object, JSValue value, unsigned attributes)
+{
+    auto scope = DECLARE_THROW_SCOPE(vm.get());
+    Structure* structure = object->structure(vm.get());
+    // An own, writable data property is replaced by [[Set]] regardless of attributes, as in JSObjectSetProperty.
+    if (cachedStructure.get() == structure && !(cachedAttributes & PropertyAttribute::ReadOnly)) {
+        object->putDirect(vm.get(), cachedOffset, value);
+        structure->didReplaceProperty(cachedOffset);
+        return;
+    }
+
+    bool doesNotHaveProperty = attributes && !object->hasProperty(globalObject, identifier);
+    RETURN_IF_EXCEPTION(scope, void());
+    if (doesNotHaveProperty) {
+        PropertyDescriptor descriptor(value, attributes);
+        object->methodTable(vm.get())->defineOwnProperty(object, globalObject, identifier, descriptor, false);
+    } else {
+        PutPropertySlot slot(object);
+        object->methodTable(vm.get())->put(object, globalObject, identifier, value, slot);
+    }
+    RETURN_IF_EXCEPTION(scope, void());
+    updateCache(object);
+}
+
+JSPropertyNameRef JSPropertyNameCreate(JSContextRef ctx, JSStringRef name)
+{
+    if (!ctx || !name) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    return &adoptRef(*new OpaqueJSPropertyName(vm, name->identifier(&vm))).leakRef();
+}
+
+JSPropertyNameRef JSPropertyNameRetain(JSPropertyNameRef name)
+{
+    name->ref();
+    return name;
+}
+
+void JSPropertyNameRelease(JSPropertyNameRef name)
+{
+    // The identifier and weak handle must be destroyed with the lock held.
+    JSLockHolder locker(name->vm.get());
+    name->deref();
+}
+
+JSValueRef JSObjectGetPropertyWithName(JSContextRef ctx, JSObjectRef object, JSPropertyNameRef name, JSValueRef* exception)
+{
+    if (!ctx || !object || !name) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    if (&name->vm.get() != &vm) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    JSValue value = name->get(globalObject, toJS(object));
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+    return toRef(globalObject, value);
+}
+
+void JSObjectSetPropertyWithName(JSContextRef ctx, JSObjectRef object, JSPropertyNameRef name, JSValueRef value, JSPropertyAttributes attributes, JSValueRef* exception)
+{
+    if (!ctx || !object || !name) {
+        ASSERT_NOT_REACHED();
+        return;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    if (&name->vm.get() != &vm) {
+        ASSERT_NOT_REACHED();
+        return;
+    }
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    name->set(globalObject, toJS(object), toJS(globalObject, value), attributes);
+    handleExceptionIfNeeded(scope, ctx, exception);
+}
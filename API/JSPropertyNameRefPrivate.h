@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#ifndef JSPropertyNameRefPrivate_h
+#define JSPropertyNameRefPrivate_h
+
+#include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/JSObjectRef.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <stdbool.h>
+
+/*! @typedef JSPropertyNameRef A property name that has been resolved once, for repeated use with objects of one context group. */
+typedef struct OpaqueJSPropertyName* JSPropertyNameRef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @function
+ @abstract Creates a reusable property name.
+ @param ctx The execution context to use. The name can only be used with contexts in the same context group.
+ @param name A JSString containing the property's name.
+ @result A JSPropertyNameRef. Ownership follows the Create Rule.
+ @discussion Unlike a JSStringRef, the name is not looked up again in the context group's string table on every use. It also remembers where it was last found, so accessing it on objects of the same shape skips the property lookup. The name keeps its context group alive.
+ */
+JS_EXPORT JSPropertyNameRef JSPropertyNameCreate(JSContextRef ctx, JSStringRef name);
+
+/*!
+ @function
+ @abstract Retains a property name.
+ @param name The JSPropertyName to retain.
+ @result A JSPropertyName that is the same as name.
+ */
+JS_EXPORT JSPropertyNameRef JSPropertyNameRetain(JSPropertyNameRef name);
+
+/*!
+ @function
+ @abstract Releases a property name.
+ @param name The JSPropertyName to release.
+ */
+JS_EXPORT void JSPropertyNameRelease(JSPropertyNameRef name);
+
+/*!
+ @function
+ @abstract Gets a property from an object.
+ @param ctx The execution context to use.
+ @param object The JSObject whose property you want to get.
+ @param name The JSPropertyName of the property.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result The property's value if object has the property, otherwise the undefined value.
+ @discussion Equivalent to JSObjectGetProperty.
+ */
+JS_EXPORT JSValueRef JSObjectGetPropertyWithName(JSContextRef ctx, JSObjectRef object, JSPropertyNameRef name, JSValueRef* exception);
+
+/*!
+ @function
+ @abstract Sets a property on an object.
+ @param ctx The execution context to use.
+ @param object The JSObject whose property you want to set.
+ @param name The JSPropertyName of the property.
+ @param value A JSValueRef to use as the property's value.
+ @param attributes A logically ORed set of JSPropertyAttributes to give to the property.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @discussion Equivalent to JSObjectSetProperty.
+ */
+JS_EXPORT void JSObjectSetPropertyWithName(JSContextRef ctx, JSObjectRef object, JSPropertyNameRef name, JSValueRef value, JSPropertyAttributes attributes, JSValueRef* exception);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSPropertyNameRefPrivate_h */
@@ -26,6 +26,9 @@
 #include "config.h"
 
 #include "APICast.h"
+#include "BytecodeCacheError.h"
+#include "CachedBytecode.h"
+#include "CodeCache.h"
 #include "Completion.h"
 #include "Exception.h"
 #include "JSGlobalObjectInlines.h"
@@ -56,6 +59,18 @@ public:
 
     VM& vm() const { return m_vm; }
 
+    RefPtr<CachedBytecode> cachedBytecode() const final
+    {
+        auto locker = holdLock(m_cachedBytecodeLock);
+        return m_cachedBytecode;
+    }
+
+    void setCachedBytecode(Ref<CachedBytecode>&& cachedBytecode)
+    {
+        auto locker = holdLock(m_cachedBytecodeLock);
+        m_cachedBytecode = WTFMove(cachedBytecode);
+    }
+
 private:
     OpaqueJSScript(VM& vm, const SourceOrigin& sourceOrigin, String&& filename, int startingLineNumber, const String& source)
         : SourceProvider(sourceOrigin, WTFMove(filename), TextPosition(OrdinalNumber::fromOneBasedInt(startingLineNumber), OrdinalNumber()), SourceProviderSourceType::Program)
@@ -68,6 +83,8 @@ private:
 
     VM& m_vm;
     Ref<StringImpl> m_source;
+    mutable Lock m_cachedBytecodeLock;
+    RefPtr<CachedBytecode> m_cachedBytecode;
 };
 
 static bool parseScript(VM& vm, const SourceCode& source, ParserError& error)
@@ -140,6 +157,59 @@ void JSScriptRelease(JSScriptRef script)
     script->deref();
 }
 
+bool JSScriptGenerateBytecode(JSScriptRef script, JSStringRef* errorMessage)
+{
+    // The script's own VM may be running on another thread, so generate into a private one. The
+    // serialized bytecode does not depend on the VM that produced it.
+    VM& vm = VM::create().leakRef();
+    JSLockHolder locker(&vm);
+
+    BytecodeCacheError error;
+    RefPtr<CachedBytecode> cachedBytecode = generateProgramBytecode(vm, SourceCode(makeRef(*script)), FileSystem::invalidPlatformFileHandle, error);
+    vm.deref();
+
+    if (!cachedBytecode) {
+        if (errorMessage)
+            *errorMessage = OpaqueJSString::tryCreate(error.message()).leakRef();
+        return false;
+    }
+
+    script->setCachedBytecode(cachedBytecode.releaseNonNull());
+    return true;
+}
+
+size_t JSScriptCopyBytecode(JSScriptRef script, void* buffer, size_t bufferSize)
+{
+    RefPtr<CachedBytecode> cachedBytecode = script->cachedBytecode();
+    if (!cachedBytecode)
+        return 0;
+
+    size_t size = cachedBytecode->size();
+    if (buffer && bufferSize >= size)
+        memcpy(buffer, cachedBytecode->data(), size);
+    return size;
+}
+
+bool JSScriptSetBytecode(JSScriptRef script, const void* bytes, size_t length)
+{
+    if (!bytes || !length)
+        return false;
+
+    VM& vm = script->vm();
+    JSLockHolder locker(&vm);
+
+    MallocPtr<uint8_t, VMMalloc> buffer = MallocPtr<uint8_t, VMMalloc>::malloc(length);
+    memcpy(buffer.get(), bytes, length);
+    Ref<CachedBytecode> cachedBytecode = CachedBytecode::create(WTFMove(buffer), length, { });
+
+    SourceCode sourceCode(makeRef(*script));
+    if (!isCachedBytecodeStillValid(vm, cachedBytecode.copyRef(), sourceCodeKeyForSerializedProgram(vm, sourceCode), SourceCodeType::ProgramType))
+        return false;
+
+    script->setCachedBytecode(WTFMove(cachedBytecode));
+    return true;
+}
+
 JSValueRef JSScriptEvaluate(JSContextRef context, JSScriptRef script, JSValueRef thisValueRef, JSValueRef* exception)
 {
     JSGlobalObject* globalObject = toJS(context);
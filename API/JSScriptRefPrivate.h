@@ -91,6 +91,38 @@ JS_EXPORT void JSScriptRelease(JSScriptRef script);
  */
 JS_EXPORT JSValueRef JSScriptEvaluate(JSContextRef ctx, JSScriptRef script, JSValueRef thisValue, JSValueRef* exception);
 
+/*!
+ @function
+ @abstract Parses a JavaScript script and generates its bytecode ahead of evaluation.
+ @param script The script to generate bytecode for.
+ @param errorMessage A pointer to a JSStringRef in which to store an error message if bytecode could not be generated. Pass NULL if you do not care to store an error message.
+ @result true if bytecode was generated, otherwise false.
+ @discussion This function may be called on any thread and does not take the lock of the script's context group, so it can overlap parsing with other work. The bytecode is generated in a private VM and kept on the script, and a later JSScriptEvaluate uses it instead of parsing the script again. The script must not be retained, released or evaluated on another thread while this function runs.
+ */
+JS_EXPORT bool JSScriptGenerateBytecode(JSScriptRef script, JSStringRef* errorMessage);
+
+/*!
+ @function
+ @abstract Copies a script's generated bytecode into a buffer so it can be persisted.
+ @param script The script whose bytecode to copy.
+ @param buffer The buffer to copy the bytecode into, or NULL to only query its size.
+ @param bufferSize The size of buffer, in bytes.
+ @result The size of the script's bytecode in bytes, or 0 if the script has no bytecode. Nothing is copied if bufferSize is smaller than the result.
+ @discussion Bytecode is only available after JSScriptGenerateBytecode or JSScriptSetBytecode has succeeded. The bytes are only meaningful to the same build of JavaScriptCore and to a script with the same source.
+ */
+JS_EXPORT size_t JSScriptCopyBytecode(JSScriptRef script, void* buffer, size_t bufferSize);
+
+/*!
+ @function
+ @abstract Gives a script bytecode previously copied out with JSScriptCopyBytecode.
+ @param script The script to give the bytecode to.
+ @param bytes The bytecode. It is copied, so the caller keeps ownership of it.
+ @param length The length of bytes, in bytes.
+ @result true if the bytecode was accepted, or false if it was produced for a different source or by a different build of JavaScriptCore.
+ @discussion This lets an application persist the bytecode of its startup scripts and skip parsing and bytecode generation on later launches. Rejected bytecode leaves the script unchanged.
+ */
+JS_EXPORT bool JSScriptSetBytecode(JSScriptRef script, const void* bytes, size_t length);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,863 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "JSSerializedValueRefPrivate.h"
+
+#include "APICast.h"
+#include "APIUtils.h"
+#include "ArrayBuffer.h"
+#include "Error.h"
+#include "JSArrayBuffer.h"
+#include "JSBigInt.h"
+#include "JSCInlines.h"
+#include "JSDataView.h"
+#include "JSMap.h"
+#include "JSSet.h"
+#include "JSTypedArrays.h"
+#include "ObjectConstructor.h"
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/SharedTask.h>
+#include <wtf/ThreadSafeRefCounted.h>
+
+using namespace JSC;
+
+struct OpaqueJSSerializedValue : public ThreadSafeRefCounted<OpaqueJSSerializedValue> {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    OpaqueJSSerializedValue(Vector<uint8_t>&& data, Vector<ArrayBufferContents>&& transferredContents, Vector<ArrayBufferContents>&& sharedContents)
+        : data(WTFMove(data))
+        , sharedContents(WTFMove(sharedContents))
+        , transferredContents(WTFMove(transferredContents))
+    {
+    }
+
+    Vector<ArrayBufferContents> takeTransferredContents()
+    {
+        auto locker = holdLock(lock);
+        return std::exchange(transferredContents, { });
+    }
+
+    // The encoding and the shared contents are only read after construction, so any thread may decode them.
+    const Vector<uint8_t> data;
+    const Vector<ArrayBufferContents> sharedContents;
+
+private:
+    Lock lock;
+    Vector<ArrayBufferContents> transferredContents;
+};
+
+namespace {
+
+enum class SerializationTag : uint8_t {
+    Undefined,
+    Null,
+    True,
+    False,
+    Int32,
+    Double,
+    String,
+    BigInt,
+    NewShapeObject,
+    ShapeObject,
+    GenericObject,
+    Array,
+    SparseArray,
+    Hole,
+    Map,
+    Set,
+    ArrayBuffer,
+    TransferredArrayBuffer,
+    SharedArrayBuffer,
+    ArrayBufferView,
+    BackReference,
+};
+
+// Objects are numbered in the order they are first written so that later references to them,
+// including cyclic ones, can be written as that number. Plain objects are written against a
+// shape, which lists their property names once per Structure rather than once per object.
+class Serializer {
+public:
+    Serializer(JSGlobalObject* globalObject, bool transferArrayBuffers)
+        : m_globalObject(globalObject)
+        , m_vm(globalObject->vm())
+        , m_transferArrayBuffers(transferArrayBuffers)
+    {
+    }
+
+    RefPtr<OpaqueJSSerializedValue> serialize(JSValue value)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        bool success = write(value);
+        EXCEPTION_ASSERT(!scope.exception() == success);
+        if (!success)
+            return nullptr;
+
+        if (m_protectedObjects.hasOverflowed() || m_protectedStructures.hasOverflowed()) {
+            throwOutOfMemoryError(m_globalObject, scope);
+            return nullptr;
+        }
+
+        // Nothing is detached until the whole graph has been written, so a failure leaves every buffer usable.
+        Vector<ArrayBufferContents> transferredContents;
+        for (auto& buffer : m_transferredBuffers) {
+            ArrayBufferContents contents;
+            if (!buffer->transferTo(m_vm, contents)) {
+                throwOutOfMemoryError(m_globalObject, scope);
+                return nullptr;
+            }
+            transferredContents.append(WTFMove(contents));
+        }
+
+        return adoptRef(*new OpaqueJSSerializedValue(WTFMove(m_data), WTFMove(transferredContents), WTFMove(m_sharedContents)));
+    }
+
+private:
+    struct Shape {
+        unsigned id { 0 };
+        Vector<PropertyOffset> offsets;
+    };
+
+    void writeTag(SerializationTag tag) { m_data.append(static_cast<uint8_t>(tag)); }
+
+    void writeVarUInt(uint64_t value)
+    {
+        do {
+            uint8_t byte = value & 0x7f;
+            value >>= 7;
+            if (value)
+                byte |= 0x80;
+            m_data.append(byte);
+        } while (value);
+    }
+
+    void writeBytes(const void* bytes, size_t length)
+    {
+        m_data.append(static_cast<const uint8_t*>(bytes), length);
+    }
+
+    void writeString(const String& string)
+    {
+        bool is8Bit = string.isNull() || string.is8Bit();
+        writeVarUInt(static_cast<uint64_t>(string.length()) << 1 | is8Bit);
+        if (string.isEmpty())
+            return;
+        if (is8Bit)
+            writeBytes(string.characters8(), string.length());
+        else
+            writeBytes(string.characters16(), string.length() * sizeof(UChar));
+    }
+
+    void registerObject(JSObject* object)
+    {
+        m_objectIds.add(object, m_objectIds.size());
+        // Getters can drop the last reference to an object we have numbered, and a new object at the
+        // same address must not be mistaken for it.
+        m_protectedObjects.append(object);
+    }
+
+    bool write(JSValue value)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+        if (value.isUndefined())
+            writeTag(SerializationTag::Undefined);
+        else if (value.isNull())
+            writeTag(SerializationTag::Null);
+        else if (value.isBoolean())
+            writeTag(value.asBoolean() ? SerializationTag::True : SerializationTag::False);
+        else if (value.isInt32()) {
+            int32_t number = value.asInt32();
+            writeTag(SerializationTag::Int32);
+            writeVarUInt((static_cast<uint32_t>(number) << 1) ^ static_cast<uint32_t>(number >> 31));
+        } else if (value.isNumber()) {
+            double number = value.asNumber();
+            writeTag(SerializationTag::Double);
+            writeBytes(&number, sizeof(number));
+        } else if (value.isString()) {
+            String string = asString(value)->value(m_globalObject);
+            RETURN_IF_EXCEPTION(scope, false);
+            writeTag(SerializationTag::String);
+            writeString(string);
+        } else if (value.isBigInt()) {
+            String string = value.toWTFString(m_globalObject);
+            RETURN_IF_EXCEPTION(scope, false);
+            writeTag(SerializationTag::BigInt);
+            writeString(string);
+        } else if (value.isObject())
+            RELEASE_AND_RETURN(scope, writeObject(asObject(value)));
+        else {
+            throwTypeError(m_globalObject, scope, "Value cannot be serialized"_s);
+            return false;
+        }
+        return true;
+    }
+
+    bool writeObject(JSObject* object)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        if (UNLIKELY(!m_vm.isSafeToRecurseSoft())) {
+            throwStackOverflowError(m_globalObject, scope);
+            return false;
+        }
+
+        auto iterator = m_objectIds.find(object);
+        if (iterator != m_objectIds.end()) {
+            writeTag(SerializationTag::BackReference);
+            writeVarUInt(iterator->value);
+            return true;
+        }
+
+        switch (object->type()) {
+        case FinalObjectType:
+            RELEASE_AND_RETURN(scope, writePlainObject(object));
+        case ArrayType:
+            RELEASE_AND_RETURN(scope, writeArray(jsCast<JSArray*>(object)));
+        case JSMapType:
+            RELEASE_AND_RETURN(scope, writeMap(jsCast<JSMap*>(object)));
+        case JSSetType:
+            RELEASE_AND_RETURN(scope, writeSet(jsCast<JSSet*>(object)));
+        case ArrayBufferType:
+            RELEASE_AND_RETURN(scope, writeArrayBuffer(jsCast<JSArrayBuffer*>(object)));
+        default:
+            if (typedArrayTypeForType(object->type()) != NotTypedArray)
+                RELEASE_AND_RETURN(scope, writeArrayBufferView(jsCast<JSArrayBufferView*>(object)));
+            break;
+        }
+
+        throwTypeError(m_globalObject, scope, "Value cannot be serialized"_s);
+        return false;
+    }
+
+    bool writePlainObject(JSObject* object)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+        // Objects whose properties can only be read by running code, or whose Structure does not
+        // describe all of their properties, take the property-by-property path.
+        Structure* structure = object->structure(m_vm);
+        if (structure->isDictionary() || structure->hasGetterSetterProperties() || structure->hasCustomGetterSetterProperties() || hasIndexedProperties(object->indexingType()))
+            RELEASE_AND_RETURN(scope, writeGenericObject(object));
+
+        registerObject(object);
+
+        MarkedArgumentBuffer values;
+        auto addResult = m_shapes.add(structure, Shape());
+        if (addResult.isNewEntry) {
+            // Getters can also let the Structure die, and a new Structure at the same address must not reuse this shape.
+            m_protectedStructures.append(structure);
+            Shape& shape = addResult.iterator->value;
+            shape.id = m_shapes.size() - 1;
+            Vector<String> names;
+            structure->forEachProperty(m_vm, [&] (const PropertyMapEntry& entry) -> bool {
+                if (entry.key->isSymbol() || (entry.attributes & PropertyAttribute::DontEnum))
+                    return true;
+                shape.offsets.append(entry.offset);
+                names.append(entry.key);
+                return true;
+            });
+
+            writeTag(SerializationTag::NewShapeObject);
+            writeVarUInt(names.size());
+            for (auto& name : names)
+                writeString(name);
+        } else {
+            writeTag(SerializationTag::ShapeObject);
+            writeVarUInt(addResult.iterator->value.id);
+        }
+
+        // Read every value before writing any, since writing one can run a getter that changes this object.
+        for (PropertyOffset offset : addResult.iterator->value.offsets)
+            values.append(object->getDirect(offset));
+        if (UNLIKELY(values.hasOverflowed())) {
+            throwOutOfMemoryError(m_globalObject, scope);
+            return false;
+        }
+
+        for (unsigned i = 0; i < values.size(); ++i) {
+            bool success = write(values.at(i));
+            EXCEPTION_ASSERT(!scope.exception() == success);
+            if (!success)
+                return false;
+        }
+        return true;
+    }
+
+    bool writeGenericObject(JSObject* object)
+    {
+        registerObject(object);
+        writeTag(SerializationTag::GenericObject);
+        return writeOwnProperties(object);
+    }
+
+    bool writeOwnProperties(JSObject* object)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        PropertyNameArray names(m_vm, PropertyNameMode::Strings, PrivateSymbolMode::Exclude);
+        object->methodTable(m_vm)->getOwnPropertyNames(object, m_globalObject, names, DontEnumPropertiesMode::Exclude);
+        RETURN_IF_EXCEPTION(scope, false);
+
+        writeVarUInt(names.size());
+        for (auto& name : names) {
+            JSValue value = object->get(m_globalObject, name);
+            RETURN_IF_EXCEPTION(scope, false);
+            writeString(name.string());
+            bool success = write(value);
+            EXCEPTION_ASSERT(!scope.exception() == success);
+            if (!success)
+                return false;
+        }
+        return true;
+    }
+
+    bool writeArray(JSArray* array)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        registerObject(array);
+
+        unsigned length = array->length();
+        // An ArrayStorage array can be far longer than the number of elements it has, so only write the ones that exist.
+        if (hasAnyArrayStorage(array->indexingType())) {
+            writeTag(SerializationTag::SparseArray);
+            writeVarUInt(length);
+            RELEASE_AND_RETURN(scope, writeOwnProperties(array));
+        }
+
+        writeTag(SerializationTag::Array);
+        writeVarUInt(length);
+        for (unsigned i = 0; i < length; ++i) {
+            JSValue value = array->tryGetIndexQuickly(i);
+            if (!value) {
+                bool hasProperty = array->hasProperty(m_globalObject, i);
+                RETURN_IF_EXCEPTION(scope, false);
+                if (!hasProperty) {
+                    writeTag(SerializationTag::Hole);
+                    continue;
+                }
+                value = array->get(m_globalObject, i);
+                RETURN_IF_EXCEPTION(scope, false);
+            }
+            bool success = write(value);
+            EXCEPTION_ASSERT(!scope.exception() == success);
+            if (!success)
+                return false;
+        }
+        return true;
+    }
+
+    template<typename HashMapType>
+    bool writeEntries(HashMapType* map, SerializationTag tag, bool hasValues)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        registerObject(map);
+
+        // Snapshot the entries first, since writing them can run getters that change the map.
+        MarkedArgumentBuffer entries;
+        for (auto* bucket = map->head()->next(); bucket; bucket = bucket->next()) {
+            if (bucket->deleted())
+                continue;
+            entries.append(bucket->key());
+            if (hasValues)
+                entries.append(HashMapType::BucketType::extractValue(*bucket));
+        }
+        if (UNLIKELY(entries.hasOverflowed())) {
+            throwOutOfMemoryError(m_globalObject, scope);
+            return false;
+        }
+
+        writeTag(tag);
+        writeVarUInt(hasValues ? entries.size() / 2 : entries.size());
+        for (unsigned i = 0; i < entries.size(); ++i) {
+            bool success = write(entries.at(i));
+            EXCEPTION_ASSERT(!scope.exception() == success);
+            if (!success)
+                return false;
+        }
+        return true;
+    }
+
+    bool writeMap(JSMap* map) { return writeEntries(map, SerializationTag::Map, true); }
+    bool writeSet(JSSet* set) { return writeEntries(set, SerializationTag::Set, false); }
+
+    bool writeArrayBuffer(JSArrayBuffer* jsBuffer)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        ArrayBuffer* buffer = jsBuffer->impl();
+        if (buffer->isDetached()) {
+            throwTypeError(m_globalObject, scope, "Detached ArrayBuffer cannot be serialized"_s);
+            return false;
+        }
+        registerObject(jsBuffer);
+
+        if (buffer->isShared()) {
+            ArrayBufferContents contents;
+            if (!buffer->shareWith(contents)) {
+                throwOutOfMemoryError(m_globalObject, scope);
+                return false;
+            }
+            writeTag(SerializationTag::SharedArrayBuffer);
+            writeVarUInt(m_sharedContents.size());
+            m_sharedContents.append(WTFMove(contents));
+            return true;
+        }
+
+        // Empty buffers have no contents to move.
+        if (m_transferArrayBuffers && buffer->byteLength()) {
+            writeTag(SerializationTag::TransferredArrayBuffer);
+            writeVarUInt(m_transferredBuffers.size());
+            m_transferredBuffers.append(buffer);
+            return true;
+        }
+
+        writeTag(SerializationTag::ArrayBuffer);
+        writeVarUInt(buffer->byteLength());
+        writeBytes(buffer->data(), buffer->byteLength());
+        return true;
+    }
+
+    bool writeArrayBufferView(JSArrayBufferView* view)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        if (view->isDetached()) {
+            throwTypeError(m_globalObject, scope, "Detached ArrayBuffer cannot be serialized"_s);
+            return false;
+        }
+
+        JSArrayBuffer* jsBuffer = view->possiblySharedJSBuffer(m_globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+
+        writeTag(SerializationTag::ArrayBufferView);
+        writeVarUInt(typedArrayTypeForType(view->type()));
+        writeVarUInt(view->byteOffset());
+        writeVarUInt(view->length());
+        bool success = writeObject(jsBuffer);
+        EXCEPTION_ASSERT(!scope.exception() == success);
+        if (!success)
+            return false;
+
+        // The view is numbered after its buffer, which is the order the reader creates them in.
+        registerObject(view);
+        return true;
+    }
+
+    JSGlobalObject* m_globalObject;
+    VM& m_vm;
+    bool m_transferArrayBuffers;
+    Vector<uint8_t> m_data;
+    HashMap<JSObject*, unsigned> m_objectIds;
+    MarkedArgumentBuffer m_protectedObjects;
+    HashMap<Structure*, Shape> m_shapes;
+    MarkedArgumentBuffer m_protectedStructures;
+    Vector<RefPtr<ArrayBuffer>> m_transferredBuffers;
+    Vector<ArrayBufferContents> m_sharedContents;
+};
+
+class Deserializer {
+public:
+    Deserializer(JSGlobalObject* globalObject, OpaqueJSSerializedValue& serializedValue)
+        : m_globalObject(globalObject)
+        , m_vm(globalObject->vm())
+        , m_serializedValue(serializedValue)
+        , m_transferredContents(serializedValue.takeTransferredContents())
+    {
+    }
+
+    JSValue deserialize()
+    {
+        JSValue result = read();
+        RELEASE_ASSERT(!result || m_position == m_serializedValue.data.size());
+        return result;
+    }
+
+private:
+    SerializationTag peekTag()
+    {
+        RELEASE_ASSERT(m_position < m_serializedValue.data.size());
+        return static_cast<SerializationTag>(m_serializedValue.data[m_position]);
+    }
+
+    SerializationTag readTag()
+    {
+        SerializationTag tag = peekTag();
+        ++m_position;
+        return tag;
+    }
+
+    uint64_t readVarUInt()
+    {
+        uint64_t result = 0;
+        unsigned shift = 0;
+        uint8_t byte;
+        do {
+            RELEASE_ASSERT(m_position < m_serializedValue.data.size() && shift < 64);
+            byte = m_serializedValue.data[m_position++];
+            result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        return result;
+    }
+
+    const uint8_t* readBytes(size_t length)
+    {
+        RELEASE_ASSERT(length <= m_serializedValue.data.size() - m_position);
+        const uint8_t* bytes = m_serializedValue.data.data() + m_position;
+        m_position += length;
+        return bytes;
+    }
+
+    unsigned readUnsigned()
+    {
+        uint64_t value = readVarUInt();
+        RELEASE_ASSERT(value <= std::numeric_limits<unsigned>::max());
+        return static_cast<unsigned>(value);
+    }
+
+    String readString()
+    {
+        uint64_t header = readVarUInt();
+        uint64_t length = header >> 1;
+        RELEASE_ASSERT(length <= std::numeric_limits<unsigned>::max());
+        if (!length)
+            return emptyString();
+        if (header & 1)
+            return String(readBytes(length), static_cast<unsigned>(length));
+        UChar* characters;
+        String result = String::createUninitialized(static_cast<unsigned>(length), characters);
+        memcpy(characters, readBytes(length * sizeof(UChar)), length * sizeof(UChar));
+        return result;
+    }
+
+    bool appendObject(JSObject* object)
+    {
+        m_objects.append(object);
+        if (LIKELY(!m_objects.hasOverflowed()))
+            return true;
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        throwOutOfMemoryError(m_globalObject, scope);
+        return false;
+    }
+
+    JSValue read()
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+        SerializationTag tag = readTag();
+        switch (tag) {
+        case SerializationTag::Undefined:
+            return jsUndefined();
+        case SerializationTag::Null:
+            return jsNull();
+        case SerializationTag::True:
+            return jsBoolean(true);
+        case SerializationTag::False:
+            return jsBoolean(false);
+        case SerializationTag::Int32: {
+            uint32_t encoded = readUnsigned();
+            return jsNumber(static_cast<int32_t>((encoded >> 1) ^ -(encoded & 1)));
+        }
+        case SerializationTag::Double: {
+            double number;
+            memcpy(&number, readBytes(sizeof(number)), sizeof(number));
+            return jsNumber(purifyNaN(number));
+        }
+        case SerializationTag::String:
+            return jsString(m_vm, readString());
+        case SerializationTag::BigInt: {
+            String string = readString();
+            RELEASE_AND_RETURN(scope, JSBigInt::stringToBigInt(m_globalObject, string));
+        }
+        case SerializationTag::BackReference: {
+            unsigned id = readUnsigned();
+            RELEASE_ASSERT(id < static_cast<unsigned>(m_objects.size()));
+            return m_objects.at(id);
+        }
+        case SerializationTag::Hole:
+            break;
+        default:
+            RELEASE_AND_RETURN(scope, readObject(tag));
+        }
+        RELEASE_ASSERT_NOT_REACHED();
+        return JSValue();
+    }
+
+    JSValue readObject(SerializationTag tag)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        if (UNLIKELY(!m_vm.isSafeToRecurseSoft())) {
+            throwStackOverflowError(m_globalObject, scope);
+            return JSValue();
+        }
+
+        switch (tag) {
+        case SerializationTag::NewShapeObject: {
+            unsigned count = readUnsigned();
+            Vector<Identifier> names;
+            names.reserveInitialCapacity(count);
+            for (unsigned i = 0; i < count; ++i)
+                names.uncheckedAppend(Identifier::fromString(m_vm, readString()));
+            m_shapes.append(WTFMove(names));
+            RELEASE_AND_RETURN(scope, readShapeObject(m_shapes.size() - 1));
+        }
+        case SerializationTag::ShapeObject: {
+            unsigned shapeIndex = readUnsigned();
+            RELEASE_ASSERT(shapeIndex < m_shapes.size());
+            RELEASE_AND_RETURN(scope, readShapeObject(shapeIndex));
+        }
+        case SerializationTag::GenericObject: {
+            JSObject* object = constructEmptyObject(m_vm, m_globalObject->objectStructureForObjectConstructor());
+            if (!appendObject(object))
+                return JSValue();
+            bool success = readOwnProperties(object);
+            EXCEPTION_ASSERT(!scope.exception() == success);
+            if (!success)
+                return JSValue();
+            return object;
+        }
+        case SerializationTag::SparseArray: {
+            unsigned length = readUnsigned();
+            JSArray* array = constructEmptyArray(m_globalObject, nullptr);
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            if (!appendObject(array))
+                return JSValue();
+            bool success = readOwnProperties(array);
+            EXCEPTION_ASSERT(!scope.exception() == success);
+            if (!success)
+                return JSValue();
+            array->setLength(m_globalObject, length, true);
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            return array;
+        }
+        case SerializationTag::Array: {
+            unsigned length = readUnsigned();
+            JSArray* array = constructEmptyArray(m_globalObject, nullptr, length);
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            if (!appendObject(array))
+                return JSValue();
+            for (unsigned i = 0; i < length; ++i) {
+                if (peekTag() == SerializationTag::Hole) {
+                    readTag();
+                    continue;
+                }
+                JSValue value = read();
+                RETURN_IF_EXCEPTION(scope, JSValue());
+                array->putDirectIndex(m_globalObject, i, value);
+                RETURN_IF_EXCEPTION(scope, JSValue());
+            }
+            return array;
+        }
+        case SerializationTag::Map: {
+            JSMap* map = JSMap::create(m_globalObject, m_vm, m_globalObject->mapStructure());
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            if (!appendObject(map))
+                return JSValue();
+            unsigned count = readUnsigned();
+            for (unsigned i = 0; i < count; ++i) {
+                JSValue key = read();
+                RETURN_IF_EXCEPTION(scope, JSValue());
+                JSValue value = read();
+                RETURN_IF_EXCEPTION(scope, JSValue());
+                map->set(m_globalObject, key, value);
+                RETURN_IF_EXCEPTION(scope, JSValue());
+            }
+            return map;
+        }
+        case SerializationTag::Set: {
+            JSSet* set = JSSet::create(m_globalObject, m_vm, m_globalObject->setStructure());
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            if (!appendObject(set))
+                return JSValue();
+            unsigned count = readUnsigned();
+            for (unsigned i = 0; i < count; ++i) {
+                JSValue key = read();
+                RETURN_IF_EXCEPTION(scope, JSValue());
+                set->add(m_globalObject, key);
+                RETURN_IF_EXCEPTION(scope, JSValue());
+            }
+            return set;
+        }
+        case SerializationTag::ArrayBuffer: {
+            unsigned byteLength = readUnsigned();
+            RefPtr<ArrayBuffer> buffer = ArrayBuffer::tryCreate(readBytes(byteLength), byteLength);
+            if (!buffer) {
+                throwOutOfMemoryError(m_globalObject, scope);
+                return JSValue();
+            }
+            RELEASE_AND_RETURN(scope, createArrayBuffer(WTFMove(buffer)));
+        }
+        case SerializationTag::TransferredArrayBuffer: {
+            unsigned index = readUnsigned();
+            if (index >= m_transferredContents.size() || !m_transferredContents[index]) {
+                throwTypeError(m_globalObject, scope, "ArrayBuffer was already transferred out of this serialized value"_s);
+                return JSValue();
+            }
+            RELEASE_AND_RETURN(scope, createArrayBuffer(ArrayBuffer::create(WTFMove(m_transferredContents[index]))));
+        }
+        case SerializationTag::SharedArrayBuffer: {
+            unsigned index = readUnsigned();
+            RELEASE_ASSERT(index < m_serializedValue.sharedContents.size());
+            const ArrayBufferContents& contents = m_serializedValue.sharedContents[index];
+            // As with JSSharedMemoryRef, the wrapper keeps the memory alive and gets contents of its own.
+            auto buffer = ArrayBuffer::createFromBytes(contents.data(), contents.sizeInBytes(), createSharedTask<void(void*)>([protectedValue = makeRef(m_serializedValue)] (void*) { }));
+            buffer->makeShared();
+            RELEASE_AND_RETURN(scope, createArrayBuffer(WTFMove(buffer)));
+        }
+        case SerializationTag::ArrayBufferView: {
+            TypedArrayType type = static_cast<TypedArrayType>(readUnsigned());
+            unsigned byteOffset = readUnsigned();
+            unsigned length = readUnsigned();
+            JSValue bufferValue = read();
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            RefPtr<ArrayBuffer> buffer = jsCast<JSArrayBuffer*>(bufferValue)->impl();
+
+            Structure* structure = m_globalObject->typedArrayStructure(type);
+            JSObject* view = nullptr;
+            switch (type) {
+#define CREATE_VIEW(name) \
+            case Type##name: \
+                view = JS##name##Array::create(m_globalObject, structure, WTFMove(buffer), byteOffset, length); \
+                break;
+            FOR_EACH_TYPED_ARRAY_TYPE_EXCLUDING_DATA_VIEW(CREATE_VIEW)
+#undef CREATE_VIEW
+            case TypeDataView:
+                view = JSDataView::create(m_globalObject, structure, WTFMove(buffer), byteOffset, length);
+                break;
+            case NotTypedArray:
+                RELEASE_ASSERT_NOT_REACHED();
+            }
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            if (!appendObject(view))
+                return JSValue();
+            return view;
+        }
+        default:
+            break;
+        }
+        RELEASE_ASSERT_NOT_REACHED();
+        return JSValue();
+    }
+
+    JSValue readShapeObject(unsigned shapeIndex)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        JSObject* object = constructEmptyObject(m_vm, m_globalObject->objectStructureForObjectConstructor());
+        if (!appendObject(object))
+            return JSValue();
+        // Reading a value can add shapes, so index m_shapes afresh for every property.
+        for (unsigned i = 0; i < m_shapes[shapeIndex].size(); ++i) {
+            JSValue value = read();
+            RETURN_IF_EXCEPTION(scope, JSValue());
+            object->putDirect(m_vm, m_shapes[shapeIndex][i], value);
+        }
+        return object;
+    }
+
+    bool readOwnProperties(JSObject* object)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        unsigned count = readUnsigned();
+        for (unsigned i = 0; i < count; ++i) {
+            Identifier name = Identifier::fromString(m_vm, readString());
+            JSValue value = read();
+            RETURN_IF_EXCEPTION(scope, false);
+            if (Optional<uint32_t> index = parseIndex(name))
+                object->putDirectIndex(m_globalObject, index.value(), value);
+            else
+                object->putDirect(m_vm, name, value);
+            RETURN_IF_EXCEPTION(scope, false);
+        }
+        return true;
+    }
+
+    JSValue createArrayBuffer(RefPtr<ArrayBuffer>&& buffer)
+    {
+        JSArrayBuffer* jsBuffer = JSArrayBuffer::create(m_vm, m_globalObject->arrayBufferStructure(buffer->sharingMode()), WTFMove(buffer));
+        if (!appendObject(jsBuffer))
+            return JSValue();
+        return jsBuffer;
+    }
+
+    JSGlobalObject* m_globalObject;
+    VM& m_vm;
+    OpaqueJSSerializedValue& m_serializedValue;
+    Vector<ArrayBufferContents> m_transferredContents;
+    size_t m_position { 0 };
+    MarkedArgumentBuffer m_objects;
+    Vector<Vector<Identifier>> m_shapes;
+};
+
+} // anonymous namespace
+
+JSSerializedValueRef JSValueCreateSerializedValue(JSContextRef ctx, JSValueRef value, bool transferArrayBuffers, JSValueRef* exception)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    RefPtr<OpaqueJSSerializedValue> result = Serializer(globalObject, transferArrayBuffers).serialize(toJS(globalObject, value));
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+
+    return result.leakRef();
+}
+
+JSSerializedValueRef JSSerializedValueRetain(JSSerializedValueRef serializedValue)
+{
+    serializedValue->ref();
+    return serializedValue;
+}
+
+void JSSerializedValueRelease(JSSerializedValueRef serializedValue)
+{
+    serializedValue->deref();
+}
+
+size_t JSSerializedValueGetByteLength(JSSerializedValueRef serializedValue)
+{
+    return serializedValue->data.size();
+}
+
+JSValueRef JSValueMakeFromSerializedValue(JSContextRef ctx, JSSerializedValueRef serializedValue, JSValueRef* exception)
+{
+    if (!ctx || !serializedValue) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    JSValue result = Deserializer(globalObject, *serializedValue).deserialize();
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+
+    return toRef(globalObject, result);
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#ifndef JSSerializedValueRefPrivate_h
+#define JSSerializedValueRefPrivate_h
+
+#include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*! @typedef JSSerializedValueRef A reference-counted, context-independent copy of a JavaScript value graph that can be materialized in any context, including contexts in other context groups on other threads. */
+typedef struct OpaqueJSSerializedValue* JSSerializedValueRef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @function
+ @abstract Serializes a value and everything reachable from it so that it can be recreated in another context.
+ @param ctx The execution context to use.
+ @param value The JSValue to serialize.
+ @param transferArrayBuffers true to move the contents of ArrayBuffers into the result instead of copying them. The ArrayBuffers are detached once serialization succeeds.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A JSSerializedValueRef, or NULL if an exception occurred. Ownership follows the Create Rule.
+ @discussion Primitives, BigInts, plain objects, arrays, Maps, Sets, ArrayBuffers, SharedArrayBuffers, typed arrays and DataViews can be serialized, and cycles and shared references are preserved. Only own enumerable string-keyed properties of plain objects are copied, and prototypes are not. Getters on plain objects run while serializing. Any other value, such as a function or a symbol, throws a TypeError. SharedArrayBuffers are always shared with the result rather than copied.
+ */
+JS_EXPORT JSSerializedValueRef JSValueCreateSerializedValue(JSContextRef ctx, JSValueRef value, bool transferArrayBuffers, JSValueRef* exception);
+
+/*!
+ @function
+ @abstract Retains a serialized value.
+ @param serializedValue The JSSerializedValue to retain.
+ @result A JSSerializedValue that is the same as serializedValue.
+ */
+JS_EXPORT JSSerializedValueRef JSSerializedValueRetain(JSSerializedValueRef serializedValue);
+
+/*!
+ @function
+ @abstract Releases a serialized value.
+ @param serializedValue The JSSerializedValue to release.
+ */
+JS_EXPORT void JSSerializedValueRelease(JSSerializedValueRef serializedValue);
+
+/*!
+ @function
+ @abstract Gets the size of the encoding of a serialized value.
+ @param serializedValue The JSSerializedValue whose size you want.
+ @result The number of bytes in the encoding, not counting the contents of transferred ArrayBuffers and SharedArrayBuffers.
+ */
+JS_EXPORT size_t JSSerializedValueGetByteLength(JSSerializedValueRef serializedValue);
+
+/*!
+ @function
+ @abstract Creates a JavaScript value from a serialized value.
+ @param ctx The execution context to use.
+ @param serializedValue The JSSerializedValue to materialize.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A new JSValue that is a deep copy of the serialized value, or NULL if an exception occurred.
+ @discussion A serialized value can be materialized any number of times, from any thread. Transferred ArrayBuffer contents go to the first value created; creating another value from a serialized value that transferred any then throws a TypeError.
+ */
+JS_EXPORT JSValueRef JSValueMakeFromSerializedValue(JSContextRef ctx, JSSerializedValueRef serializedValue, JSValueRef* exception);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSSerializedValueRefPrivate_h */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "JSSharedBytesRefPrivate.h"
+
+#include "APICast.h"
+#include "APIUtils.h"
+#include "ArrayBuffer.h"
+#include "JSArrayBuffer.h"
+#include "JSCInlines.h"
+#include <wtf/SharedTask.h>
+#include <wtf/ThreadSafeRefCounted.h>
+
+using namespace JSC;
+
+struct OpaqueJSSharedBytes : public ThreadSafeRefCounted<OpaqueJSSharedBytes> {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    OpaqueJSSharedBytes(const void* bytes, unsigned byteLength, JSTypedArrayBytesDeallocator bytesDeallocator, void* deallocatorContext)
+        : bytes(bytes)
+        , byteLength(byteLength)
+        , bytesDeallocator(bytesDeallocator)
+        , deallocatorContext(deallocatorContext)
+    {
+    }
+
+    ~OpaqueJSSharedBytes()
+    {
+        if (bytesDeallocator)
+            bytesDeallocator(const_cast<void*>(bytes), deallocatorContext);
+    }
+
+    const void* bytes;
+    unsigned byteLength;
+    JSTypedArrayBytesDeallocator bytesDeallocator;
+    void* deallocatorContext;
+};
+
+JSSharedBytesRef JSSharedBytesCreate(const void* bytes, size_t byteLength, JSTypedArrayBytesDeallocator bytesDeallocator, void* deallocatorContext)
+{
+    // ArrayBuffer lengths are unsigned.
+    if (byteLength > std::numeric_limits<unsigned>::max())
+        return nullptr;
+    return &adoptRef(*new OpaqueJSSharedBytes(bytes, static_cast<unsigned>(byteLength), bytesDeallocator, deallocatorContext)).leakRef();
+}
+
+JSSharedBytesRef JSSharedBytesRetain(JSSharedBytesRef bytes)
+{
+    bytes->ref();
+    return bytes;
+}
+
+void JSSharedBytesRelease(JSSharedBytesRef bytes)
+{
+    bytes->deref();
+}
+
+size_t JSSharedBytesGetByteLength(JSSharedBytesRef bytes)
+{
+    return bytes->byteLength;
+}
+
+JSObjectRef JSObjectMakeArrayBufferWithSharedBytes(JSContextRef ctx, JSSharedBytesRef bytes, JSValueRef* exception)
+{
+    if (!ctx || !bytes) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    // Each wrapper holds a reference, released when the wrapper's contents are destroyed, so the bytes
+    // outlive every VM that can still see them.
+    auto buffer = ArrayBuffer::createFromBytes(bytes->bytes, bytes->byteLength, createSharedTask<void(void*)>([protectedBytes = makeRef(*bytes)] (void*) { }));
+    // Detaching one wrapper must never take the bytes away from the others.
+    buffer->pinAndLock();
+
+    JSArrayBuffer* jsBuffer = JSArrayBuffer::create(vm, globalObject->arrayBufferStructure(ArrayBufferSharingMode::Default), WTFMove(buffer));
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+
+    return toRef(jsBuffer);
+}
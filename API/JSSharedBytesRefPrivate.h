@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#ifndef JSSharedBytesRefPrivate_h
+#define JSSharedBytesRefPrivate_h
+
+#include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/JSObjectRef.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <stddef.h>
+
+/*! @typedef JSSharedBytesRef A reference-counted, immutable block of bytes that ArrayBuffers in any number of contexts and context groups can wrap without copying. */
+typedef struct OpaqueJSSharedBytes* JSSharedBytesRef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @function
+ @abstract Wraps a block of bytes so that it can be shared by ArrayBuffers in several context groups.
+ @param bytes A pointer to the bytes. The embedder must not modify them while they are wrapped.
+ @param byteLength The number of bytes.
+ @param bytesDeallocator A function called, on whichever thread drops the last reference, to free the bytes. Pass NULL if the bytes are not owned.
+ @param deallocatorContext A pointer passed to bytesDeallocator.
+ @result A JSSharedBytesRef, or NULL if byteLength is too large for an ArrayBuffer. Ownership follows the Create Rule.
+ @discussion The result is not tied to a context and can be used from any thread.
+ */
+JS_EXPORT JSSharedBytesRef JSSharedBytesCreate(const void* bytes, size_t byteLength, JSTypedArrayBytesDeallocator bytesDeallocator, void* deallocatorContext);
+
+/*!
+ @function
+ @abstract Retains shared bytes.
+ @param bytes The JSSharedBytes to retain.
+ @result A JSSharedBytes that is the same as bytes.
+ */
+JS_EXPORT JSSharedBytesRef JSSharedBytesRetain(JSSharedBytesRef bytes);
+
+/*!
+ @function
+ @abstract Releases shared bytes.
+ @param bytes The JSSharedBytes to release.
+ @discussion The bytes are freed once they have been released and every ArrayBuffer wrapping them has been garbage collected.
+ */
+JS_EXPORT void JSSharedBytesRelease(JSSharedBytesRef bytes);
+
+/*!
+ @function
+ @abstract Gets the number of bytes in shared bytes.
+ @param bytes The JSSharedBytes whose length you want.
+ @result The number of bytes.
+ */
+JS_EXPORT size_t JSSharedBytesGetByteLength(JSSharedBytesRef bytes);
+
+/*!
+ @function
+ @abstract Creates an ArrayBuffer that wraps shared bytes without copying them.
+ @param ctx The execution context to use.
+ @param bytes The JSSharedBytes to wrap.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A JSObjectRef whose JSTypedArrayType is kJSTypedArrayTypeArrayBuffer, or NULL if an exception occurred.
+ @discussion The ArrayBuffer is an ordinary ArrayBuffer that keeps the bytes alive. It cannot be detached, so transferring it copies the bytes instead of taking them away from the other wrappers. Scripts are trusted not to write to it: JavaScriptCore does not enforce that the bytes stay unchanged.
+ */
+JS_EXPORT JSObjectRef JSObjectMakeArrayBufferWithSharedBytes(JSContextRef ctx, JSSharedBytesRef bytes, JSValueRef* exception);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSSharedBytesRefPrivate_h */
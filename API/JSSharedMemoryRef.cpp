@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "JSSharedMemoryRefPrivate.h"
+
+#include "APICast.h"
+#include "APIUtils.h"
+#include "ArrayBuffer.h"
+#include "Error.h"
+#include "JSArrayBuffer.h"
+#include "JSCInlines.h"
+#include <wtf/SharedTask.h>
+#include <wtf/ThreadSafeRefCounted.h>
+
+using namespace JSC;
+
+struct OpaqueJSSharedMemory : public ThreadSafeRefCounted<OpaqueJSSharedMemory> {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    // The contents are only read after construction, so any thread may wrap them.
+    explicit OpaqueJSSharedMemory(ArrayBufferContents&& contents)
+        : contents(WTFMove(contents))
+    {
+        ASSERT(this->contents.isShared());
+    }
+
+    ArrayBufferContents contents;
+};
+
+static JSSharedMemoryRef createSharedMemory(ArrayBuffer& buffer)
+{
+    ArrayBufferContents contents;
+    if (!buffer.shareWith(contents))
+        return nullptr;
+    return &adoptRef(*new OpaqueJSSharedMemory(WTFMove(contents))).leakRef();
+}
+
+JSSharedMemoryRef JSSharedMemoryCreate(size_t byteLength)
+{
+    // ArrayBuffer lengths are unsigned.
+    if (byteLength > std::numeric_limits<unsigned>::max())
+        return nullptr;
+
+    RefPtr<ArrayBuffer> buffer = ArrayBuffer::tryCreate(static_cast<unsigned>(byteLength), 1);
+    if (!buffer)
+        return nullptr;
+    buffer->makeShared();
+    return createSharedMemory(*buffer);
+}
+
+JSSharedMemoryRef JSSharedMemoryRetain(JSSharedMemoryRef memory)
+{
+    memory->ref();
+    return memory;
+}
+
+void JSSharedMemoryRelease(JSSharedMemoryRef memory)
+{
+    memory->deref();
+}
+
+size_t JSSharedMemoryGetByteLength(JSSharedMemoryRef memory)
+{
+    return memory->contents.sizeInBytes();
+}
+
+JSSharedMemoryRef JSObjectGetSharedArrayBufferMemory(JSContextRef ctx, JSObjectRef objectRef, JSValueRef*)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+
+    JSArrayBuffer* jsBuffer = jsDynamicCast<JSArrayBuffer*>(vm, toJS(objectRef));
+    if (!jsBuffer || !jsBuffer->isShared())
+        return nullptr;
+    return createSharedMemory(*jsBuffer->impl());
+}
+
+JSObjectRef JSObjectMakeSharedArrayBufferWithSharedMemory(JSContextRef ctx, JSSharedMemoryRef memory, JSValueRef* exception)
+{
+    if (!ctx || !memory) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    if (!Options::useSharedArrayBuffer()) {
+        setException(ctx, exception, createTypeError(globalObject, "SharedArrayBuffer is not enabled"_s));
+        return nullptr;
+    }
+
+    // The wrapper keeps the memory alive through its destructor, and sharing it gives the wrapper its
+    // own SharedArrayBufferContents so that it never frees memory other context groups can still see.
+    auto buffer = ArrayBuffer::createFromBytes(memory->contents.data(), memory->contents.sizeInBytes(), createSharedTask<void(void*)>([protectedMemory = makeRef(*memory)] (void*) { }));
+    buffer->makeShared();
+
+    JSArrayBuffer* jsBuffer = JSArrayBuffer::create(vm, globalObject->arrayBufferStructure(ArrayBufferSharingMode::Shared), WTFMove(buffer));
+    if (handleExceptionIfNeeded(scope, ctx, exception) == ExceptionStatus::DidThrow)
+        return nullptr;
+
+    return toRef(jsBuffer);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#ifndef JSSharedMemoryRefPrivate_h
+#define JSSharedMemoryRefPrivate_h
+
+#include <JavaScriptCore/JSContextRef.h>
+#include <JavaScriptCore/JSObjectRef.h>
+#include <JavaScriptCore/JSValueRef.h>
+#include <stddef.h>
+
+/*! @typedef JSSharedMemoryRef A reference-counted block of memory that SharedArrayBuffers in any number of contexts and context groups can share, so that scripts running on different threads can communicate through it. */
+typedef struct OpaqueJSSharedMemory* JSSharedMemoryRef;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ @function
+ @abstract Allocates zero-filled memory that can be shared by SharedArrayBuffers in several context groups.
+ @param byteLength The number of bytes to allocate.
+ @result A JSSharedMemoryRef, or NULL if the memory could not be allocated. Ownership follows the Create Rule.
+ @discussion The result is not tied to a context and can be used from any thread.
+ */
+JS_EXPORT JSSharedMemoryRef JSSharedMemoryCreate(size_t byteLength);
+
+/*!
+ @function
+ @abstract Retains shared memory.
+ @param memory The JSSharedMemory to retain.
+ @result A JSSharedMemory that is the same as memory.
+ */
+JS_EXPORT JSSharedMemoryRef JSSharedMemoryRetain(JSSharedMemoryRef memory);
+
+/*!
+ @function
+ @abstract Releases shared memory.
+ @param memory The JSSharedMemory to release.
+ @discussion The memory is freed once it has been released and every SharedArrayBuffer using it has been garbage collected.
+ */
+JS_EXPORT void JSSharedMemoryRelease(JSSharedMemoryRef memory);
+
+/*!
+ @function
+ @abstract Gets the number of bytes in shared memory.
+ @param memory The JSSharedMemory whose length you want.
+ @result The number of bytes.
+ */
+JS_EXPORT size_t JSSharedMemoryGetByteLength(JSSharedMemoryRef memory);
+
+/*!
+ @function
+ @abstract Gets the memory behind a SharedArrayBuffer so that it can be handed to another context group.
+ @param ctx The execution context to use.
+ @param object The SharedArrayBuffer whose memory you want.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A JSSharedMemoryRef, or NULL if object is not a SharedArrayBuffer. Ownership follows the Create Rule.
+ */
+JS_EXPORT JSSharedMemoryRef JSObjectGetSharedArrayBufferMemory(JSContextRef ctx, JSObjectRef object, JSValueRef* exception);
+
+/*!
+ @function
+ @abstract Creates a SharedArrayBuffer that uses shared memory.
+ @param ctx The execution context to use.
+ @param memory The JSSharedMemory to use.
+ @param exception A pointer to a JSValueRef in which to store an exception, if any. Pass NULL if you do not care to store an exception.
+ @result A SharedArrayBuffer, or NULL if an exception occurred.
+ @discussion Writes made through the result are visible to every other SharedArrayBuffer using the same memory, including ones in other context groups running on other threads, and Atomics.wait and Atomics.notify work across them. SharedArrayBuffer support must be enabled; otherwise a TypeError is thrown.
+ */
+JS_EXPORT JSObjectRef JSObjectMakeSharedArrayBufferWithSharedMemory(JSContextRef ctx, JSSharedMemoryRef memory, JSValueRef* exception);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSSharedMemoryRefPrivate_h */
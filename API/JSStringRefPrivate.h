@@ -27,6 +27,7 @@
 #define JSStringRefPrivate_h
 
 #include <JavaScriptCore/JSStringRef.h>
+#include <JavaScriptCore/JSValueRef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,27 @@ extern "C" {
 
 JS_EXPORT JSStringRef JSStringCreateWithCharactersNoCopy(const JSChar* chars, size_t numChars);
 
+/*!
+@typedef JSStringBytesDeallocator
+@abstract A function invoked when the UTF-8 bytes passed to JSValueMakeStringWithUTF8BytesNoCopy are no longer needed.
+@param bytes The bytes that were passed in.
+@param deallocatorContext The deallocatorContext that was passed in.
+*/
+typedef void (*JSStringBytesDeallocator)(void* bytes, void* deallocatorContext);
+
+/*!
+@function
+@abstract Creates a JavaScript string from UTF-8 bytes owned by the caller.
+@param ctx The execution context to use.
+@param bytes The UTF-8 bytes of the string. They must not be modified until deallocator is called.
+@param length The number of bytes.
+@param deallocator A function to call when the bytes are no longer needed, or NULL.
+@param deallocatorContext A pointer to pass to deallocator.
+@result A JSValue of the string type, or NULL if bytes is not valid UTF-8.
+@discussion When the bytes are all ASCII, the string uses them in place as its Latin-1 characters and deallocator is called once the string has been garbage collected. Other input is transcoded to UTF-16 and deallocator is called before this function returns. In every case deallocator is called exactly once.
+*/
+JS_EXPORT JSValueRef JSValueMakeStringWithUTF8BytesNoCopy(JSContextRef ctx, const char* bytes, size_t length, JSStringBytesDeallocator deallocator, void* deallocatorContext);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,12 +30,16 @@
 #include "APIUtils.h"
 #include "DateInstance.h"
 #include "JSAPIWrapperObject.h"
+#include "JSBasePrivate.h"
 #include "JSCInlines.h"
 #include "JSCallbackObject.h"
 #include "JSONObject.h"
+#include "JSStringRefPrivate.h"
 #include "LiteralParser.h"
 #include "Protect.h"
 #include <wtf/Assertions.h>
+#include <wtf/text/ASCIIFastPath.h>
+#include <wtf/text/ExternalStringImpl.h>
 #include <wtf/text/WTFString.h>
 
 #if PLATFORM(MAC)
@@ -384,6 +388,43 @@ JSValueRef JSValueMakeString(JSContextRef ctx, JSStringRef string)
     return toRef(globalObject, jsString(vm, string ? string->string() : String()));
 }
 
+JSValueRef JSValueMakeStringWithUTF8BytesNoCopy(JSContextRef ctx, const char* bytes, size_t length, JSStringBytesDeallocator deallocator, void* deallocatorContext)
+{
+    auto deallocate = [=] {
+        if (deallocator)
+            deallocator(const_cast<char*>(bytes), deallocatorContext);
+    };
+
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        deallocate();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+
+    if (length > String::MaxLength) {
+        deallocate();
+        return nullptr;
+    }
+
+    auto* characters = reinterpret_cast<const LChar*>(bytes);
+    if (length && charactersAreAllASCII(characters, length)) {
+        // ASCII is its own Latin-1 encoding, so the string can be backed by the caller's bytes.
+        auto impl = ExternalStringImpl::create(characters, length, [deallocate] (ExternalStringImpl*, void*, unsigned) {
+            deallocate();
+        });
+        return toRef(globalObject, jsString(vm, String(WTFMove(impl))));
+    }
+
+    String string = length ? String::fromUTF8(characters, length) : emptyString();
+    deallocate();
+    if (string.isNull())
+        return nullptr;
+    return toRef(globalObject, jsString(vm, WTFMove(string)));
+}
+
 JSValueRef JSValueMakeFromJSONString(JSContextRef ctx, JSStringRef string)
 {
     if (!ctx) {
@@ -513,3 +554,43 @@ void JSValueUnprotect(JSContextRef ctx, JSValueRef value)
     JSValue jsValue = toJSForGC(globalObject, value);
     gcUnprotect(jsValue);
 }
+
+JSValueProtectHandle JSValueProtectWithHandle(JSContextRef ctx, JSValueRef value)
+{
+    if (!ctx || !value) {
+        ASSERT_NOT_REACHED();
+        return 0;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+
+    return vm.heap.protectWithHandle(toJSForGC(globalObject, value));
+}
+
+JSValueRef JSValueGetProtectedValue(JSContextRef ctx, JSValueProtectHandle handle)
+{
+    if (!ctx) {
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+
+    JSValue value = vm.heap.protectedValue(handle);
+    if (!value)
+        return nullptr;
+    return toRef(globalObject, value);
+}
+
+void JSValueReleaseProtectHandle(JSContextRef ctx, JSValueProtectHandle handle)
+{
+    if (!ctx || !handle)
+        return;
+    JSGlobalObject* globalObject = toJS(ctx);
+    VM& vm = globalObject->vm();
+    JSLockHolder locker(vm);
+
+    vm.heap.releaseProtectHandle(handle);
+}
@@ -34,6 +34,7 @@
 
 #include "JSBasePrivate.h"
 #include "JSHeapFinalizerPrivate.h"
+#include "JSJSONParserRefPrivate.h"
 #include "JSMarkingConstraintPrivate.h"
 #include "JSObjectRefPrivate.h"
 #include "JSScriptRefPrivate.h"
@@ -104,6 +105,12 @@ static void assertEqualsAsNumber(JSValueRef value, double expectedValue)
     }
 }
 
+static void countDeallocatedBytes(void* bytes, void* deallocatorContext)
+{
+    UNUSED_PARAM(bytes);
+    ++*(unsigned*)deallocatorContext;
+}
+
 static void assertEqualsAsUTF8String(JSValueRef value, const char* expectedValue)
 {
     JSStringRef valueAsString = JSValueToStringCopy(context, value, NULL);
@@ -1477,6 +1484,14 @@ int main(int argc, char* argv[])
     ASSERT(JSStringGetCharactersPtr(constantStringRef) == constantString);
     JSStringRelease(constantStringRef);
 
+    static char asciiBytes[] = "Hello";
+    JSValueRef asciiNoCopyString = JSValueMakeStringWithUTF8BytesNoCopy(context, asciiBytes, strlen(asciiBytes), NULL, NULL);
+    assertEqualsAsUTF8String(asciiNoCopyString, "Hello");
+    unsigned utf8BytesDeallocated = 0;
+    JSValueRef utf8NoCopyString = JSValueMakeStringWithUTF8BytesNoCopy(context, "caf\xC3\xA9", 5, countDeallocatedBytes, &utf8BytesDeallocated);
+    assertEqualsAsUTF8String(utf8NoCopyString, "caf\xC3\xA9");
+    ASSERT(utf8BytesDeallocated == 1);
+
     ASSERT(JSValueGetType(context, NULL) == kJSTypeNull);
     ASSERT(JSValueGetType(context, jsUndefined) == kJSTypeUndefined);
     ASSERT(JSValueGetType(context, jsNull) == kJSTypeNull);
@@ -1621,6 +1636,29 @@ int main(int argc, char* argv[])
         failed = 1;
     } else
         printf("PASS: Correctly returned null for invalid JSON data.\n");
+    {
+        // "\xC3\xA9" is split between the second and third chunks.
+        JSJSONParserRef jsonParser = JSJSONParserCreate();
+        bool appended = JSJSONParserAppendUTF8Bytes(jsonParser, "{\"aPro", 6)
+            && JSJSONParserAppendUTF8Bytes(jsonParser, "perty\":\"\xC3", 9)
+            && JSJSONParserAppendUTF8Bytes(jsonParser, "\xA9\"}", 3);
+        JSValueRef chunkedJSONObject = appended ? JSJSONParserFinish(context, jsonParser) : NULL;
+        JSStringRef chunkedPropertyName = JSStringCreateWithUTF8CString("aProperty");
+        if (!chunkedJSONObject || !JSValueIsObject(context, chunkedJSONObject)) {
+            printf("FAIL: Did not parse JSON appended in chunks\n");
+            failed = 1;
+        } else {
+            printf("PASS: Parsed JSON appended in chunks.\n");
+            assertEqualsAsUTF8String(JSObjectGetProperty(context, JSValueToObject(context, chunkedJSONObject, 0), chunkedPropertyName, 0), "\xC3\xA9");
+        }
+        JSStringRelease(chunkedPropertyName);
+        if (JSJSONParserAppendUTF8Bytes(jsonParser, "[\xFF]", 3)) {
+            printf("FAIL: Should reject invalid UTF-8 appended to a JSON parser\n");
+            failed = 1;
+        } else
+            printf("PASS: Correctly rejected invalid UTF-8 appended to a JSON parser.\n");
+        JSJSONParserRelease(jsonParser);
+    }
     JSValueRef exception;
     JSStringRef str = JSValueCreateJSONString(context, jsonObject, 0, 0);
     if (!JSStringIsEqualToUTF8CString(str, "{\"aProperty\":true}")) {
@@ -1963,6 +2001,31 @@ int main(int argc, char* argv[])
     ASSERT(JSValueIsEqual(context, v, o, NULL));
     JSScriptRelease(scriptObject);
 
+    scriptObject = JSScriptCreateReferencingImmortalASCIIText(contextGroup, 0, 0, thisScript, strlen(thisScript), 0, 0);
+    ASSERT(JSScriptGenerateBytecode(scriptObject, NULL));
+    v = JSScriptEvaluate(context, scriptObject, NULL, NULL);
+    ASSERT(JSValueIsEqual(context, v, globalObject, NULL));
+    {
+        size_t bytecodeSize = JSScriptCopyBytecode(scriptObject, NULL, 0);
+        ASSERT(bytecodeSize);
+        void* bytecode = malloc(bytecodeSize);
+        ASSERT(JSScriptCopyBytecode(scriptObject, bytecode, bytecodeSize) == bytecodeSize);
+        JSScriptRelease(scriptObject);
+
+        scriptObject = JSScriptCreateReferencingImmortalASCIIText(contextGroup, 0, 0, thisScript, strlen(thisScript), 0, 0);
+        ASSERT(!JSScriptCopyBytecode(scriptObject, NULL, 0));
+        ASSERT(JSScriptSetBytecode(scriptObject, bytecode, bytecodeSize));
+        v = JSScriptEvaluate(context, scriptObject, NULL, NULL);
+        ASSERT(JSValueIsEqual(context, v, globalObject, NULL));
+        JSScriptRelease(scriptObject);
+
+        const char* otherScript = "this.toString();";
+        scriptObject = JSScriptCreateReferencingImmortalASCIIText(contextGroup, 0, 0, otherScript, strlen(otherScript), 0, 0);
+        ASSERT(!JSScriptSetBytecode(scriptObject, bytecode, bytecodeSize));
+        free(bytecode);
+    }
+    JSScriptRelease(scriptObject);
+
     script = JSStringCreateWithUTF8CString("eval(this);");
     v = JSEvaluateScript(context, script, NULL, NULL, 1, NULL);
     ASSERT(JSValueIsEqual(context, v, globalObject, NULL));
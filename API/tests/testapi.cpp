@@ -26,16 +26,30 @@
 #include "config.h"
 
 #include "APICast.h"
+#include "CodeBlock.h"
+#include "CodeCache.h"
+#include "DeferredWorkTimer.h"
+#include "HeapSnapshotBuilder.h"
+#include "JSFunctionInlines.h"
 #include "JSGlobalObjectInlines.h"
 #include "MarkedJSValueRefArray.h"
+#include "Options.h"
+#include <JavaScriptCore/JSBasePrivate.h>
 #include <JavaScriptCore/JSContextRefPrivate.h>
 #include <JavaScriptCore/JSObjectRefPrivate.h>
+#include <JavaScriptCore/JSPropertyKeyListRefPrivate.h>
+#include <JavaScriptCore/JSPropertyNameRefPrivate.h>
+#include <JavaScriptCore/JSScriptRefPrivate.h>
+#include <JavaScriptCore/JSSerializedValueRefPrivate.h>
+#include <JavaScriptCore/JSSharedBytesRefPrivate.h>
+#include <JavaScriptCore/JSSharedMemoryRefPrivate.h>
 #include <JavaScriptCore/JavaScript.h>
 #include <wtf/DataLog.h>
 #include <wtf/Expected.h>
 #include <wtf/Noncopyable.h>
 #include <wtf/NumberOfCores.h>
 #include <wtf/Vector.h>
+#include <wtf/text/StringBuilder.h>
 #include <wtf/text/StringCommon.h>
 
 extern "C" void configureJSCForTesting();
@@ -151,6 +165,33 @@ public:
     void markedJSValueArrayAndGC();
     void classDefinitionWithJSSubclass();
     void proxyReturnedWithJSSubclassing();
+    void heapOccupancyStatistics();
+    void heapAllocationSampling();
+    void heapSnapshotSerialization();
+    void runtimeCountersSnapshot();
+    void compilerPhaseStatistics();
+    void structureIDTableStatistics();
+    void fastCallbackFunctions();
+    void batchedPropertyAccess();
+    void reusablePropertyNames();
+    void sharedBytesAcrossContextGroups();
+    void scriptBytecodeRestore();
+    void contextGroupReset();
+    void contextGroupNotifyIdle();
+    void contextGroupReleaseMemory();
+    void sharedMemoryAcrossContextGroups();
+    void serializedValuesAcrossContextGroups();
+    void protectHandles();
+    void wasmCallIndirectTraps();
+    void ropeAppendBuffers();
+    void bigIntKaratsubaMultiplication();
+    void atomicsWaitAsync();
+    void objectCloneCache();
+    void controlFlowProfilerCoverage();
+    void wasmWorklistInterleaving();
+    void finalizationRegistryCleanupSlices();
+    void heapSnapshotDelta();
+    void branchDirectionProfiling();
 
     int failed() const { return m_failed; }
 
@@ -171,6 +212,9 @@ private:
     bool functionReturnsTrue(const char* functionSource, ArgumentTypes... arguments);
 
     bool scriptResultIs(ScriptResult, JSValueRef);
+    // Runs the VM's deferred work, such as settling promises, until condition returns true or ten
+    // seconds have passed.
+    bool runDeferredWorkUntil(const char* condition);
 
     // Ways to make sets of interesting things.
     APIVector<JSObjectRef> interestingObjects();
@@ -255,6 +299,22 @@ bool TestAPI::scriptResultIs(ScriptResult result, JSValueRef value)
     return JSValueIsStrictEqual(context, result.value(), value);
 }
 
+bool TestAPI::runDeferredWorkUntil(const char* condition)
+{
+    JSC::VM& vm = toJS(context)->vm();
+    MonotonicTime deadline = MonotonicTime::now() + 10_s;
+    while (!functionReturnsTrue(condition)) {
+        if (MonotonicTime::now() > deadline)
+            return false;
+        {
+            JSC::JSLockHolder locker(vm);
+            vm.deferredWorkTimer->doWork(vm);
+        }
+        sleep(1_ms);
+    }
+    return true;
+}
+
 template<typename... Strings>
 bool TestAPI::check(bool condition, Strings... messages)
 {
@@ -705,6 +765,1024 @@ void TestAPI::proxyReturnedWithJSSubclassing()
     check(functionReturnsTrue("(function (subclass, Superclass) { return subclass.__proto__ == Superclass.prototype; })", subclass, Superclass), "proxy's prototype should match Superclass.prototype");
 }
 
+void TestAPI::heapOccupancyStatistics()
+{
+    evaluateScript("globalThis.retained = []; for (let i = 0; i < 1000; ++i) retained.push({ i });");
+    JSSynchronousGarbageCollectForDebugging(context);
+
+    JSValueRef exception = nullptr;
+    JSObjectRef statistics = JSContextGetHeapOccupancyStatistics(context, &exception);
+    check(!exception, "getting heap occupancy statistics should not throw");
+    check(JSValueIsArray(context, statistics), "heap occupancy statistics should be an array");
+
+    check(functionReturnsTrue("(function (statistics) { return statistics.length > 0; })", statistics), "heap occupancy statistics should describe at least one size class");
+    check(functionReturnsTrue("(function (statistics) { return statistics.every((sizeClass) => sizeClass.liveBytes <= sizeClass.capacityBytes && sizeClass.emptyBlockCount <= sizeClass.blockCount); })", statistics), "live bytes and empty blocks should be bounded by capacity");
+    check(functionReturnsTrue("(function (statistics) { return statistics.every((sizeClass) => sizeClass.occupancyHistogram.reduce((a, b) => a + b, 0) === sizeClass.blockCount - sizeClass.emptyBlockCount); })", statistics), "occupancy histogram should account for every non-empty block");
+    check(functionReturnsTrue("(function (statistics) { return statistics.some((sizeClass) => sizeClass.liveCellCount > 0); })", statistics), "some size class should have live cells after allocating retained objects");
+}
+
+void TestAPI::heapAllocationSampling()
+{
+    JSContextStartHeapAllocationSampling(context, 1024);
+    evaluateScript("globalThis.retained = []; (function allocateRetained() { for (let i = 0; i < 10000; ++i) retained.push({ i }); })();");
+    JSSynchronousGarbageCollectForDebugging(context);
+
+    JSValueRef exception = nullptr;
+    JSObjectRef samples = JSContextStopHeapAllocationSampling(context, &exception);
+    check(!exception, "stopping heap allocation sampling should not throw");
+    check(JSValueIsArray(context, samples), "heap allocation samples should be an array");
+
+    check(functionReturnsTrue("(function (samples) { return samples.length > 0; })", samples), "allocating hundreds of kilobytes should produce samples");
+    check(functionReturnsTrue("(function (samples) { return samples.every((sample) => sample.bytes >= 1024 && sample.bytes % 1024 === 0 && sample.cellSize > 0); })", samples), "every sample should stand for a whole number of sample intervals");
+    check(functionReturnsTrue("(function (samples) { return samples.some((sample) => sample.stackTrace.some((frame) => frame.functionName === 'allocateRetained')); })", samples), "some sample should be attributed to the allocating function");
+    check(!JSContextStopHeapAllocationSampling(context, nullptr), "stopping heap allocation sampling twice should return null");
+}
+
+void TestAPI::heapSnapshotSerialization()
+{
+    evaluateScript("var heapSnapshotObjects = []; for (let i = 0; i < 1000; ++i) heapSnapshotObjects.push({ heapSnapshotNext: heapSnapshotObjects[i - 1] });");
+
+    JSC::VM& vm = toJS(context)->vm();
+    auto serialize = [&] (JSC::HeapSnapshotBuilder::EdgeEncoding edgeEncoding, unsigned& chunkCount) {
+        JSC::JSLockHolder locker(vm);
+        JSC::HeapSnapshotBuilder builder(vm.ensureHeapProfiler());
+        builder.buildSnapshot();
+        StringBuilder json;
+        chunkCount = 0;
+        builder.writeJSON([&] (String&& chunk) {
+            json.append(chunk);
+            chunkCount++;
+        }, [] (const JSC::HeapSnapshotNode&) { return true; }, 4 * KB, edgeEncoding);
+        return json.toString();
+    };
+
+    // Decodes "edges" if it is base64, then checks that every edge joins listed nodes, names an edge
+    // type and edge name that exist, and that edges come sorted by their from node.
+    const char* edgesAreConsistent = "(function (json, expectBase64) {"
+        "const snapshot = JSON.parse(json);"
+        "let edges = snapshot.edges;"
+        "if (expectBase64 !== (snapshot.edgeEncoding === 'base64') || expectBase64 !== (typeof edges === 'string')) return false;"
+        "if (expectBase64) {"
+        "    const alphabet = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/';"
+        "    if (edges.length % 4) return false;"
+        "    const bytes = [];"
+        "    for (let i = 0; i < edges.length; i += 4) {"
+        "        let bits = 0;"
+        "        for (let j = 0; j < 4; ++j) bits = bits * 64 + (edges[i + j] === '=' ? 0 : alphabet.indexOf(edges[i + j]));"
+        "        bytes.push(bits >> 16, (bits >> 8) & 0xff, bits & 0xff);"
+        "    }"
+        "    bytes.length -= (edges.match(/=*$/)[0]).length;"
+        "    if (bytes.length % 16) return false;"
+        "    edges = [];"
+        "    for (let i = 0; i < bytes.length; i += 4) edges.push((bytes[i] | bytes[i + 1] << 8 | bytes[i + 2] << 16 | bytes[i + 3] << 24) >>> 0);"
+        "}"
+        "if (!edges.length || edges.length % 4) return false;"
+        "const nodes = new Set([0]);"
+        "for (let i = 0; i < snapshot.nodes.length; i += 4) nodes.add(snapshot.nodes[i]);"
+        "const namedEdges = new Set();"
+        "for (let i = 0; i < edges.length; i += 4) {"
+        "    const [from, to, type, data] = edges.slice(i, i + 4);"
+        "    if (!nodes.has(from) || !nodes.has(to) || type >= snapshot.edgeTypes.length) return false;"
+        "    if (i && from < edges[i - 4]) return false;"
+        "    const typeName = snapshot.edgeTypes[type];"
+        "    if (typeName === 'Property' || typeName === 'Variable') {"
+        "        if (data >= snapshot.edgeNames.length) return false;"
+        "        namedEdges.add(snapshot.edgeNames[data]);"
+        "    }"
+        "}"
+        "return namedEdges.has('heapSnapshotObjects') && namedEdges.has('heapSnapshotNext');"
+        "})";
+
+    unsigned chunkCount;
+    String json = serialize(JSC::HeapSnapshotBuilder::EdgeEncoding::JSON, chunkCount);
+    check(chunkCount > 1, "a heap snapshot should be written in more than one chunk when it is larger than the chunk size");
+    check(functionReturnsTrue(edgesAreConsistent, JSValueMakeString(context, APIString(json)), JSValueMakeBoolean(context, false)), "chunks of a heap snapshot should join into JSON whose edges join listed nodes");
+
+    String base64JSON = serialize(JSC::HeapSnapshotBuilder::EdgeEncoding::Base64, chunkCount);
+    check(chunkCount > 1, "a heap snapshot with base64 edges should be written in more than one chunk when it is larger than the chunk size");
+    check(functionReturnsTrue(edgesAreConsistent, JSValueMakeString(context, APIString(base64JSON)), JSValueMakeBoolean(context, true)), "base64 edges should decode to four little-endian words per edge that join listed nodes");
+}
+
+void TestAPI::runtimeCountersSnapshot()
+{
+    evaluateScript("function readX(o) { return o.x; } for (let i = 0; i < 1000; ++i) readX({ x: i, ['y' + i]: i });");
+
+    JSStringRef snapshot = JSContextCreateRuntimeCountersSnapshot(context, 10);
+    JSValueRef counters = JSValueMakeFromJSONString(context, snapshot);
+    JSStringRelease(snapshot);
+    check(counters && JSValueIsObject(context, counters), "runtime counters snapshot should be a JSON object");
+
+    check(functionReturnsTrue("(function (counters) { return typeof counters.osrExits.BadType === 'number' && typeof counters.jettisons.OSRExit === 'number'; })", counters), "snapshot should count OSR exits and jettisons by kind");
+    check(functionReturnsTrue("(function (counters) { return Object.values(counters.functionsByTier).reduce((a, b) => a + b, 0) > 0; })", counters), "snapshot should count functions in each tier");
+    check(functionReturnsTrue("(function (counters) { return Array.isArray(counters.inlineCacheSlowPaths) && counters.inlineCacheSlowPaths.length <= 10; })", counters), "snapshot should list at most the requested number of CodeBlocks");
+}
+
+void TestAPI::compilerPhaseStatistics()
+{
+    // testCAPIViaCpp turns on collectCompilerPhaseStatistics before any test starts. Run a hot function
+    // until the DFG has compiled something; compiles may finish on a compiler thread.
+    const char* hasDFGCompile = "(function (statistics) { const dfg = statistics.filter((phase) => phase.compiler === 'DFG').map((phase) => phase.phase); return dfg.includes('total compile') && dfg.includes('bytecode parser'); })";
+    JSObjectRef statistics = nullptr;
+    for (unsigned round = 0; round < 100; ++round) {
+        evaluateScript("function compilerPhaseStatisticsHot(x) { return x * 2 + 1; } for (let i = 0; i < 100000; ++i) compilerPhaseStatisticsHot(i);");
+        statistics = JSContextGetCompilerPhaseStatistics(context, nullptr);
+        if (!JSC::Options::useDFGJIT() || !statistics || functionReturnsTrue(hasDFGCompile, statistics))
+            break;
+    }
+    check(statistics && JSValueIsArray(context, statistics), "compiler phase statistics should be an array");
+    if (JSC::Options::useDFGJIT())
+        check(functionReturnsTrue(hasDFGCompile, statistics), "a hot function should show up as a DFG compile and its bytecode parser phase");
+    check(functionReturnsTrue("(function (statistics) { return statistics.every((phase) => typeof phase.compiler === 'string' && typeof phase.phase === 'string' && phase.count > 0 && phase.maxMilliseconds <= phase.totalMilliseconds && phase.microsecondLog2Histogram.length === 24); })", statistics), "every phase should have a name, a count, times and a histogram");
+}
+
+void TestAPI::structureIDTableStatistics()
+{
+    // testCAPIViaCpp turns on $vm and StructureID table compaction before any test starts.
+    if (!functionReturnsTrue("(function () { return !!$vm.structureIDTableStatistics(); })"))
+        return;
+
+    // Give a few thousand objects a Structure of their own, drop them, and run a full collection so that
+    // their IDs are freed and the free list is compacted.
+    evaluateScript("var structureIDTableObjects = []; for (let i = 0; i < 5000; ++i) { let object = { }; object['structureIDTableProperty' + i] = i; structureIDTableObjects.push(object); } structureIDTableObjects = null;");
+    ScriptResult result = evaluateScript("$vm.gc(); $vm.structureIDTableStatistics()");
+    if (!check(result && JSValueIsObject(context, result.value()), "$vm.structureIDTableStatistics() should return an object"))
+        return;
+    JSValueRef statistics = result.value();
+    check(functionReturnsTrue("(function (statistics) { return statistics.size > 1 && statistics.size <= statistics.capacity; })", statistics), "the StructureID table should account for its live entries");
+    check(functionReturnsTrue("(function (statistics) { return statistics.highestUsedIndex + 1 >= statistics.size && statistics.highestUsedIndex < statistics.capacity; })", statistics), "compaction should count every used entry at or below the highest used index");
+    check(functionReturnsTrue("(function (statistics) { return statistics.reservedEntries + statistics.highestUsedIndex < statistics.capacity; })", statistics), "only entries above the highest used index should be held back from the free list");
+
+    // Entries held back from the free list must come back once the rest runs out.
+    check(functionReturnsTrue("(function (before) { let objects = []; for (let i = 0; i < before.capacity; ++i) { let object = { }; object['structureIDTableRefill' + i] = i; objects.push(object); } const after = $vm.structureIDTableStatistics(); return after.size > before.capacity - before.reservedEntries && after.size <= after.capacity; })", statistics), "allocation should use the reserved entries, and grow the table, once the free list runs out");
+}
+
+void TestAPI::fastCallbackFunctions()
+{
+    auto add = [] (JSContextRef ctx, JSObjectRef, JSObjectRef, size_t argumentCount, const JSValueRef arguments[], JSValueRef*) -> JSValueRef {
+        double result = 0;
+        for (size_t i = 0; i < argumentCount; ++i)
+            result += JSValueToNumber(ctx, arguments[i], nullptr);
+        return JSValueMakeNumber(ctx, result);
+    };
+    auto fastAdd = [] (JSContextRef ctx, JSObjectRef, const JSFastCallbackArgument arguments[], JSValueRef*) -> JSValueRef {
+        return JSValueMakeNumber(ctx, static_cast<double>(arguments[0].int32) + arguments[1].int32);
+    };
+    JSFastCallbackDefinition addDefinition = { fastAdd, 2, { kJSFastCallbackArgumentTypeInt32, kJSFastCallbackArgumentTypeInt32 } };
+    JSObjectRef addFunction = JSObjectMakeFunctionWithFastCallback(context, APIString("add"), add, &addDefinition);
+    check(!!addFunction, "creating a function with a fast callback should succeed");
+
+    auto length = [] (JSContextRef ctx, JSObjectRef, JSObjectRef, size_t argumentCount, const JSValueRef arguments[], JSValueRef*) -> JSValueRef {
+        if (!argumentCount)
+            return JSValueMakeNumber(ctx, 0);
+        JSStringRef string = JSValueToStringCopy(ctx, arguments[0], nullptr);
+        size_t result = JSStringGetLength(string);
+        JSStringRelease(string);
+        return JSValueMakeNumber(ctx, result);
+    };
+    auto fastLength = [] (JSContextRef ctx, JSObjectRef, const JSFastCallbackArgument arguments[], JSValueRef*) -> JSValueRef {
+        return JSValueMakeNumber(ctx, arguments[0].string.length);
+    };
+    static const JSStaticFunction staticFunctions[] = { { "length", length, kJSPropertyAttributeNone }, { nullptr, nullptr, 0 } };
+    static const JSStaticFastFunction fastFunctions[] = { { "length", { fastLength, 1, { kJSFastCallbackArgumentTypeString } } }, { nullptr, { nullptr, 0, { } } } };
+    JSClassDefinition definition = kJSClassDefinitionEmpty;
+    definition.staticFunctions = staticFunctions;
+    JSClassRef jsClass = JSClassCreateWithFastStaticFunctions(&definition, fastFunctions);
+    JSObjectRef object = JSObjectMake(context, jsClass, nullptr);
+    JSClassRelease(jsClass);
+
+    const char* test = "(function (add, object) { const api = { add }; let result = true; for (let i = 0; i < 100000; ++i) result = result && api.add(i, 1) === i + 1 && object.length('x' + i) === String(i).length + 1; return result && api.add(0.5, 1) === 1.5 && object.length(42) === 2 && api.add(1, 2, 3) === 6; })";
+    check(functionReturnsTrue(test, addFunction, object), "fast and classic callbacks should agree");
+
+    JSFastCallbackDefinition invalidDefinition = { fastAdd, 3, { } };
+    check(!JSObjectMakeFunctionWithFastCallback(context, nullptr, add, &invalidDefinition), "fast callbacks should take at most two arguments");
+}
+
+void TestAPI::batchedPropertyAccess()
+{
+    JSStringRef keyNames[] = { JSStringCreateWithUTF8CString("x"), JSStringCreateWithUTF8CString("y"), JSStringCreateWithUTF8CString("name") };
+    JSPropertyKeyListRef keys = JSPropertyKeyListCreate(context, keyNames, 3);
+    for (JSStringRef keyName : keyNames)
+        JSStringRelease(keyName);
+    check(JSPropertyKeyListGetCount(keys) == 3, "key list should hold every key");
+
+    JSObjectRef records = JSObjectMakeArray(context, 0, nullptr, nullptr);
+    for (unsigned i = 0; i < 10; ++i) {
+        JSObjectRef record = JSObjectMake(context, nullptr, nullptr);
+        JSValueRef values[] = { JSValueMakeNumber(context, i), JSValueMakeNumber(context, i * 2), JSValueMakeString(context, APIString("record")) };
+        check(JSObjectSetProperties(context, record, keys, values, kJSPropertyAttributeNone, nullptr), "setting properties on a plain object should not throw");
+        JSObjectSetPropertyAtIndex(context, records, i, record, nullptr);
+
+        JSValueRef results[3];
+        check(JSObjectGetProperties(context, record, keys, results, nullptr), "getting properties from a plain object should not throw");
+        check(JSValueToNumber(context, results[0], nullptr) == i && JSValueToNumber(context, results[1], nullptr) == i * 2 && JSValueIsString(context, results[2]), "getting properties should return the values that were set");
+    }
+    check(functionReturnsTrue("(function (records) { return records.every((record, i) => record.x === i && record.y === i * 2 && record.name === 'record' && Object.keys(record).join() === 'x,y,name'); })", records), "set properties should be ordinary own data properties");
+
+    JSObjectRef withGetter = const_cast<JSObjectRef>(evaluateScript("({ get x() { return 'getter'; }, y: 1, name: 'n' })").value());
+    JSValueRef results[3];
+    check(JSObjectGetProperties(context, withGetter, keys, results, nullptr), "getting properties through a getter should not throw");
+    check(JSValueIsString(context, results[0]), "getting properties should call getters");
+
+    JSObjectRef throwing = const_cast<JSObjectRef>(evaluateScript("({ get y() { throw new Error('y'); } })").value());
+    JSValueRef exception = nullptr;
+    check(!JSObjectGetProperties(context, throwing, keys, results, &exception) && exception, "exceptions thrown by getters should be reported");
+
+    JSPropertyKeyListRelease(keys);
+}
+
+void TestAPI::reusablePropertyNames()
+{
+    JSStringRef nameString = JSStringCreateWithUTF8CString("value");
+    JSPropertyNameRef name = JSPropertyNameCreate(context, nameString);
+    JSStringRelease(nameString);
+
+    JSObjectRef objects = JSObjectMakeArray(context, 0, nullptr, nullptr);
+    for (unsigned i = 0; i < 10; ++i) {
+        JSObjectRef object = JSObjectMake(context, nullptr, nullptr);
+        check(JSValueIsUndefined(context, JSObjectGetPropertyWithName(context, object, name, nullptr)), "a missing property should be undefined");
+        JSObjectSetPropertyWithName(context, object, name, JSValueMakeNumber(context, i), kJSPropertyAttributeNone, nullptr);
+        JSObjectSetPropertyWithName(context, object, name, JSValueMakeNumber(context, i + 1), kJSPropertyAttributeNone, nullptr);
+        check(JSValueToNumber(context, JSObjectGetPropertyWithName(context, object, name, nullptr), nullptr) == i + 1, "getting a property should return the last value set");
+        JSObjectSetPropertyAtIndex(context, objects, i, object, nullptr);
+    }
+    check(functionReturnsTrue("(function (objects) { return objects.every((object, i) => object.value === i + 1); })", objects), "properties set by name should be visible to JavaScript");
+
+    JSObjectRef readOnly = const_cast<JSObjectRef>(evaluateScript("Object.defineProperty({}, 'value', { value: 1, writable: false })").value());
+    JSObjectSetPropertyWithName(context, readOnly, name, JSValueMakeNumber(context, 2), kJSPropertyAttributeNone, nullptr);
+    check(JSValueToNumber(context, JSObjectGetPropertyWithName(context, readOnly, name, nullptr), nullptr) == 1, "read-only properties should not be replaced");
+
+    JSObjectRef withSetter = const_cast<JSObjectRef>(evaluateScript("({ set value(v) { this.seen = v; } })").value());
+    JSObjectSetPropertyWithName(context, withSetter, name, JSValueMakeNumber(context, 3), kJSPropertyAttributeNone, nullptr);
+    check(functionReturnsTrue("(function (object) { return object.seen === 3; })", withSetter), "setting a property by name should call setters");
+
+    JSPropertyNameRelease(name);
+}
+
+void TestAPI::sharedBytesAcrossContextGroups()
+{
+    static const uint8_t data[] = { 1, 2, 3, 4 };
+    static bool deallocated;
+    deallocated = false;
+    JSSharedBytesRef bytes = JSSharedBytesCreate(data, sizeof(data), [] (void*, void*) { deallocated = true; }, nullptr);
+    check(JSSharedBytesGetByteLength(bytes) == sizeof(data), "shared bytes should report their length");
+
+    JSGlobalContextRef otherContext = JSGlobalContextCreate(nullptr);
+    JSObjectRef otherBuffer = JSObjectMakeArrayBufferWithSharedBytes(otherContext, bytes, nullptr);
+    check(JSObjectGetArrayBufferBytesPtr(otherContext, otherBuffer, nullptr) == data, "wrapping shared bytes should not copy them");
+    JSGlobalContextRelease(otherContext);
+
+    JSObjectRef buffer = JSObjectMakeArrayBufferWithSharedBytes(context, bytes, nullptr);
+    JSSharedBytesRelease(bytes);
+    check(!deallocated, "shared bytes should stay alive while an ArrayBuffer wraps them");
+    check(functionReturnsTrue("(function (buffer) { return new Uint8Array(buffer).join() === '1,2,3,4'; })", buffer), "scripts should see the shared bytes");
+}
+
+void TestAPI::scriptBytecodeRestore()
+{
+    const char* source = "(function () { let sum = 0; for (let i = 0; i < 1000; ++i) sum += i; return sum; })()";
+    auto codeCacheStatistics = [] (JSContextGroupRef group) {
+        JSC::VM& vm = *toJS(group);
+        JSC::JSLockHolder locker(vm);
+        return vm.codeCache()->statistics();
+    };
+
+    JSContextGroupRef generatingGroup = JSContextGroupCreate();
+    JSScriptRef script = JSScriptCreateReferencingImmortalASCIIText(generatingGroup, nullptr, 1, source, strlen(source), nullptr, nullptr);
+    check(!JSScriptCopyBytecode(script, nullptr, 0), "a script should have no bytecode before it is generated");
+    check(JSScriptGenerateBytecode(script, nullptr), "bytecode generation should succeed");
+    size_t bytecodeSize = JSScriptCopyBytecode(script, nullptr, 0);
+    Vector<uint8_t> bytecode(bytecodeSize);
+    check(bytecodeSize && JSScriptCopyBytecode(script, bytecode.data(), bytecode.size()) == bytecodeSize, "generated bytecode should be copied out whole");
+    JSScriptRelease(script);
+    JSContextGroupRelease(generatingGroup);
+
+    // A new group has never seen the source, so evaluating it must decode the restored bytecode
+    // instead of parsing.
+    JSContextGroupRef group = JSContextGroupCreate();
+    JSGlobalContextRef restoringContext = JSGlobalContextCreateInGroup(group, nullptr);
+    script = JSScriptCreateReferencingImmortalASCIIText(group, nullptr, 1, source, strlen(source), nullptr, nullptr);
+    check(JSScriptSetBytecode(script, bytecode.data(), bytecode.size()), "bytecode for the same source should be accepted");
+    JSC::CodeCacheMap::Statistics before = codeCacheStatistics(group);
+    JSValueRef result = JSScriptEvaluate(restoringContext, script, nullptr, nullptr);
+    JSC::CodeCacheMap::Statistics after = codeCacheStatistics(group);
+    check(JSValueToNumber(restoringContext, result, nullptr) == 499500, "restored bytecode should run");
+    check(after.diskHits == before.diskHits + 1 && after.misses == before.misses, "evaluating a script with restored bytecode should not parse it");
+
+    Vector<uint8_t> copiedBack(bytecodeSize);
+    check(JSScriptCopyBytecode(script, copiedBack.data(), copiedBack.size()) == bytecodeSize && copiedBack == bytecode, "restored bytecode should be copied back unchanged");
+    JSScriptRelease(script);
+
+    const char* otherSource = "(function () { return 42; })()";
+    script = JSScriptCreateReferencingImmortalASCIIText(group, nullptr, 1, otherSource, strlen(otherSource), nullptr, nullptr);
+    check(!JSScriptSetBytecode(script, bytecode.data(), bytecode.size()), "bytecode for another source should be rejected");
+    check(!JSScriptCopyBytecode(script, nullptr, 0), "rejected bytecode should leave the script without bytecode");
+    before = codeCacheStatistics(group);
+    result = JSScriptEvaluate(restoringContext, script, nullptr, nullptr);
+    after = codeCacheStatistics(group);
+    check(JSValueToNumber(restoringContext, result, nullptr) == 42 && after.misses == before.misses + 1 && after.diskHits == before.diskHits, "a script whose bytecode was rejected should be parsed");
+    JSScriptRelease(script);
+
+    JSGlobalContextRelease(restoringContext);
+    JSContextGroupRelease(group);
+}
+
+void TestAPI::contextGroupReset()
+{
+    JSContextGroupRef group = JSContextGroupCreate();
+    JSC::VM& vm = *toJS(group);
+    auto heapCapacity = [&] {
+        JSC::JSLockHolder locker(vm);
+        return vm.heap.capacity();
+    };
+    auto codeCacheStatistics = [&] {
+        JSC::JSLockHolder locker(vm);
+        return vm.codeCache()->statistics();
+    };
+
+    JSGlobalContextRef tenant = JSGlobalContextCreateInGroup(group, nullptr);
+    JSStringRef script = JSStringCreateWithUTF8CString("(function () { let sum = 0; for (let i = 0; i < 1000; ++i) sum += i; return sum; })()");
+    JSStringRef garbageScript = JSStringCreateWithUTF8CString("globalThis.leaked = []; for (let i = 0; i < 200000; ++i) leaked.push({ i });");
+    JSValueRef result = JSEvaluateScript(tenant, script, nullptr, nullptr, 1, nullptr);
+    check(JSValueToNumber(tenant, result, nullptr) == 499500, "the first tenant should run");
+    JSEvaluateScript(tenant, garbageScript, nullptr, nullptr, 1, nullptr);
+    size_t capacityWithLeakedObjects = heapCapacity();
+    JSGlobalContextRelease(tenant);
+
+    // Everything the released tenant kept alive is reclaimed and its empty blocks are returned, but
+    // the unlinked code it compiled stays cached for the next tenant.
+    JSContextGroupReset(group, false);
+    check(heapCapacity() < capacityWithLeakedObjects / 2, "a reset should return the blocks the previous tenant left behind");
+    JSC::CodeCacheMap::Statistics before = codeCacheStatistics();
+    check(before.entries, "a reset that keeps the code cache should keep its entries");
+
+    tenant = JSGlobalContextCreateInGroup(group, nullptr);
+    JSStringRef leakedName = JSStringCreateWithUTF8CString("leaked");
+    check(!JSObjectHasProperty(tenant, JSContextGetGlobalObject(tenant), leakedName), "a new tenant should not see the previous tenant's globals");
+    result = JSEvaluateScript(tenant, script, nullptr, nullptr, 1, nullptr);
+    JSC::CodeCacheMap::Statistics after = codeCacheStatistics();
+    check(JSValueToNumber(tenant, result, nullptr) == 499500, "code should run again after a reset");
+    check(after.hits == before.hits + 1 && after.misses == before.misses, "the next tenant should find the previous tenant's code in the code cache");
+    JSGlobalContextRelease(tenant);
+
+    JSContextGroupReset(group, true);
+    check(!codeCacheStatistics().entries, "a reset that clears the code cache should leave it empty");
+    JSStringRelease(leakedName);
+    JSStringRelease(garbageScript);
+    JSStringRelease(script);
+    JSContextGroupRelease(group);
+}
+
+void TestAPI::contextGroupNotifyIdle()
+{
+    JSContextGroupRef group = JSContextGroupCreate();
+    JSC::VM& vm = *toJS(group);
+    auto heapCapacity = [&] {
+        JSC::JSLockHolder locker(vm);
+        return vm.heap.capacity();
+    };
+
+    JSGlobalContextRef tenant = JSGlobalContextCreateInGroup(group, nullptr);
+    JSStringRef script = JSStringCreateWithUTF8CString("globalThis.garbage = []; for (let i = 0; i < 200000; ++i) garbage.push({ i }); garbage.length");
+    JSValueRef result = JSEvaluateScript(tenant, script, nullptr, nullptr, 1, nullptr);
+    check(JSValueToNumber(tenant, result, nullptr) == 200000, "the script should run before going idle");
+    JSStringRef dropScript = JSStringCreateWithUTF8CString("delete globalThis.garbage");
+    JSEvaluateScript(tenant, dropScript, nullptr, nullptr, 1, nullptr);
+
+    // A collection without a sweep leaves the dead objects' blocks allocated until they are swept.
+    {
+        JSC::JSLockHolder locker(vm);
+        vm.heap.collectSync(JSC::CollectionScope::Full);
+    }
+    size_t capacityAfterCollection = heapCapacity();
+
+    JSContextGroupNotifyIdle(group, 0);
+    check(heapCapacity() == capacityAfterCollection, "an idle period with no time left should not sweep");
+
+    JSContextGroupNotifyIdle(group, 10);
+    check(heapCapacity() < capacityAfterCollection / 2, "an idle period should finish sweeping and return the empty blocks");
+
+    result = JSEvaluateScript(tenant, script, nullptr, nullptr, 1, nullptr);
+    check(JSValueToNumber(tenant, result, nullptr) == 200000, "the script should run again after an idle period");
+    JSStringRelease(dropScript);
+    JSStringRelease(script);
+    JSGlobalContextRelease(tenant);
+    JSContextGroupRelease(group);
+}
+
+void TestAPI::contextGroupReleaseMemory()
+{
+    JSContextGroupRef group = JSContextGroupCreate();
+    JSGlobalContextRef tenant = JSGlobalContextCreateInGroup(group, nullptr);
+    JSStringRef script = JSStringCreateWithUTF8CString("(function () { let count = 0; for (let i = 0; i < 1000; ++i) count += /a+b/.test('aaab' + i); return count; })()");
+    JSValueRef result = JSEvaluateScript(tenant, script, nullptr, nullptr, 1, nullptr);
+    check(JSValueToNumber(tenant, result, nullptr) == 1000, "the script should run before releasing memory");
+
+    for (JSMemoryPressureLevel level : { kJSMemoryPressureModerate, kJSMemoryPressureCritical }) {
+        JSStringRef json = JSContextGroupReleaseMemory(group, level);
+        check(!!json, "releasing memory should report what it released");
+        JSValueRef released = JSValueMakeFromJSONString(context, json);
+        JSStringRelease(json);
+        check(functionReturnsTrue("(function (released) { return ['codeCache', 'regExpCode', 'sourceProviderCache', 'machineCode', 'bytecode', 'executableMemory', 'heap'].every((key) => typeof released[key] === 'number'); })", released), "the report should have a byte count for each category");
+    }
+
+    result = JSEvaluateScript(tenant, script, nullptr, nullptr, 1, nullptr);
+    check(JSValueToNumber(tenant, result, nullptr) == 1000, "the script should run again after releasing memory");
+    JSStringRelease(script);
+    JSGlobalContextRelease(tenant);
+    JSContextGroupRelease(group);
+}
+
+void TestAPI::sharedMemoryAcrossContextGroups()
+{
+    JSGlobalContextRef writerContext = JSGlobalContextCreate(nullptr);
+    JSGlobalContextRef readerContext = JSGlobalContextCreate(nullptr);
+
+    JSSharedMemoryRef memory = JSSharedMemoryCreate(16);
+    check(JSSharedMemoryGetByteLength(memory) == 16, "shared memory should report its length");
+
+    JSStringRef writeScript = JSStringCreateWithUTF8CString("(function (buffer) { Atomics.store(new Int32Array(buffer), 1, 42); })");
+    JSObjectRef write = const_cast<JSObjectRef>(JSEvaluateScript(writerContext, writeScript, nullptr, nullptr, 1, nullptr));
+    JSValueRef writerBuffer = JSObjectMakeSharedArrayBufferWithSharedMemory(writerContext, memory, nullptr);
+    check(!!writerBuffer, "the writer should get a SharedArrayBuffer");
+    JSObjectCallAsFunction(writerContext, write, nullptr, 1, &writerBuffer, nullptr);
+
+    JSStringRef readScript = JSStringCreateWithUTF8CString("(function (buffer) { return buffer instanceof SharedArrayBuffer && Atomics.load(new Int32Array(buffer), 1); })");
+    JSObjectRef read = const_cast<JSObjectRef>(JSEvaluateScript(readerContext, readScript, nullptr, nullptr, 1, nullptr));
+    JSValueRef readerBuffer = JSObjectMakeSharedArrayBufferWithSharedMemory(readerContext, memory, nullptr);
+    JSSharedMemoryRelease(memory);
+    JSValueRef result = JSObjectCallAsFunction(readerContext, read, nullptr, 1, &readerBuffer, nullptr);
+    check(JSValueToNumber(readerContext, result, nullptr) == 42, "a write in one context group should be visible in the other");
+
+    JSSharedMemoryRef memoryFromScript = JSObjectGetSharedArrayBufferMemory(readerContext, JSValueToObject(readerContext, readerBuffer, nullptr), nullptr);
+    check(JSSharedMemoryGetByteLength(memoryFromScript) == 16, "the memory behind a SharedArrayBuffer should be retrievable");
+    JSSharedMemoryRelease(memoryFromScript);
+    check(!JSObjectGetSharedArrayBufferMemory(readerContext, read, nullptr), "only SharedArrayBuffers have shared memory");
+
+    JSStringRelease(readScript);
+    JSStringRelease(writeScript);
+    JSGlobalContextRelease(readerContext);
+    JSGlobalContextRelease(writerContext);
+}
+
+void TestAPI::serializedValuesAcrossContextGroups()
+{
+    JSGlobalContextRef sourceContext = JSGlobalContextCreate(nullptr);
+    JSGlobalContextRef targetContext = JSGlobalContextCreate(nullptr);
+
+    JSStringRef sourceScript = JSStringCreateWithUTF8CString(
+        "var points = [];"
+        "for (var i = 0; i < 3; ++i) points.push({ x: i, y: -i, name: 'p' + i });"
+        "var graph = { points, holes: [1, , 3], big: 12345678901234567890n, map: new Map([['k', points[1]]]), set: new Set([1.5, 'two']), bytes: new Uint16Array([1, 2, 3]).subarray(1), buffer: new ArrayBuffer(8) };"
+        "graph.self = graph;"
+        "graph.sparse = []; graph.sparse.length = 2 ** 32 - 1; graph.sparse[7] = 'seven';"
+        "graph");
+    JSValueRef source = JSEvaluateScript(sourceContext, sourceScript, nullptr, nullptr, 1, nullptr);
+
+    JSSerializedValueRef copied = JSValueCreateSerializedValue(sourceContext, source, false, nullptr);
+    check(!!copied && JSSerializedValueGetByteLength(copied) > 0, "a plain value graph should serialize");
+    JSSerializedValueRef transferred = JSValueCreateSerializedValue(sourceContext, source, true, nullptr);
+    check(!!transferred, "a value graph should serialize while transferring its ArrayBuffers");
+    check(JSSerializedValueGetByteLength(transferred) < JSSerializedValueGetByteLength(copied), "transferred buffers should not be copied into the encoding");
+
+    JSStringRef detachedScript = JSStringCreateWithUTF8CString("graph.buffer.byteLength === 0 && graph.bytes.length === 0");
+    check(JSValueToBoolean(sourceContext, JSEvaluateScript(sourceContext, detachedScript, nullptr, nullptr, 1, nullptr)), "transferring should detach the source buffers");
+
+    JSStringRef checkScript = JSStringCreateWithUTF8CString(
+        "(function (graph) {"
+        "    return graph.self === graph && graph.points.length === 3 && graph.points[2].name === 'p2' && graph.points[1].y === -1"
+        "        && !(1 in graph.holes) && graph.holes.length === 3 && graph.big === 12345678901234567890n"
+        "        && graph.map.get('k') === graph.points[1] && graph.set.has(1.5) && graph.set.has('two')"
+        "        && graph.bytes instanceof Uint16Array && graph.bytes.length === 2 && graph.bytes[1] === 3 && graph.bytes.buffer.byteLength === 6"
+        "        && graph.buffer.byteLength === 8 && Object.getPrototypeOf(graph) === Object.prototype"
+        "        && Array.isArray(graph.sparse) && graph.sparse.length === 2 ** 32 - 1 && graph.sparse[7] === 'seven' && !(6 in graph.sparse);"
+        "})");
+    JSObjectRef checkFunction = const_cast<JSObjectRef>(JSEvaluateScript(targetContext, checkScript, nullptr, nullptr, 1, nullptr));
+
+    JSValueRef copy = JSValueMakeFromSerializedValue(targetContext, copied, nullptr);
+    check(JSValueToBoolean(targetContext, JSObjectCallAsFunction(targetContext, checkFunction, nullptr, 1, &copy, nullptr)), "a copied graph should keep its shape and sharing in another context group");
+    JSValueRef secondCopy = JSValueMakeFromSerializedValue(targetContext, copied, nullptr);
+    check(!!secondCopy && !JSValueIsStrictEqual(targetContext, copy, secondCopy), "a serialized value should materialize more than once");
+
+    JSValueRef transferredCopy = JSValueMakeFromSerializedValue(targetContext, transferred, nullptr);
+    check(JSValueToBoolean(targetContext, JSObjectCallAsFunction(targetContext, checkFunction, nullptr, 1, &transferredCopy, nullptr)), "a transferred graph should keep its buffer contents");
+    JSValueRef exception = nullptr;
+    check(!JSValueMakeFromSerializedValue(targetContext, transferred, &exception) && exception, "transferred buffers should only materialize once");
+
+    JSStringRef functionScript = JSStringCreateWithUTF8CString("({ f() { } })");
+    exception = nullptr;
+    JSValueRef withFunction = JSEvaluateScript(sourceContext, functionScript, nullptr, nullptr, 1, nullptr);
+    check(!JSValueCreateSerializedValue(sourceContext, withFunction, false, &exception) && exception, "functions should not serialize");
+
+    JSSerializedValueRelease(transferred);
+    JSSerializedValueRelease(copied);
+    JSStringRelease(functionScript);
+    JSStringRelease(checkScript);
+    JSStringRelease(detachedScript);
+    JSStringRelease(sourceScript);
+    JSGlobalContextRelease(targetContext);
+    JSGlobalContextRelease(sourceContext);
+}
+
+void TestAPI::protectHandles()
+{
+    JSValueRef object = evaluateScript("({ marker: 42 })").value();
+    JSValueProtectHandle first = JSValueProtectWithHandle(context, object);
+    JSValueProtectHandle second = JSValueProtectWithHandle(context, JSValueMakeNumber(context, 1));
+    check(first && second && first != second, "protecting values should hand out distinct nonzero handles");
+
+    object = nullptr;
+    JSSynchronousGarbageCollectForDebugging(context);
+    check(functionReturnsTrue("(function (object) { return object.marker === 42; })", JSValueGetProtectedValue(context, first)), "a protected object should survive collection");
+    check(JSValueToNumber(context, JSValueGetProtectedValue(context, second), nullptr) == 1, "handles should also protect non-cell values");
+
+    JSValueReleaseProtectHandle(context, first);
+    JSValueProtectHandle reused = JSValueProtectWithHandle(context, JSValueMakeNumber(context, 2));
+    check(reused == first, "released handles should be reused");
+    check(!JSValueGetProtectedValue(context, 0), "handle 0 should never be valid");
+
+    JSValueReleaseProtectHandle(context, reused);
+    JSValueReleaseProtectHandle(context, second);
+    JSValueReleaseProtectHandle(context, 0);
+}
+
+void TestAPI::wasmCallIndirectTraps()
+{
+    // drive(index, iterations) makes `iterations` good call_indirects through table[0] in a loop, so it tiers up
+    // to OMG, then one through table[index]. table[1] is null and table[2] has the wrong signature.
+    check(functionReturnsTrue("(function () {"
+        "    if (typeof WebAssembly === 'undefined')"
+        "        return true;"
+        "    const bytes = new Uint8Array(["
+        "        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x10, 0x03, 0x60, 0x00, 0x01, 0x7f, 0x60,"
+        "        0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x04, 0x03, 0x00, 0x02, 0x01,"
+        "        0x04, 0x04, 0x01, 0x70, 0x00, 0x03, 0x07, 0x09, 0x01, 0x05, 0x64, 0x72, 0x69, 0x76, 0x65, 0x00,"
+        "        0x02, 0x09, 0x0d, 0x02, 0x00, 0x41, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x41, 0x02, 0x0b, 0x01, 0x01,"
+        "        0x0a, 0x2d, 0x03, 0x04, 0x00, 0x41, 0x00, 0x0b, 0x04, 0x00, 0x41, 0x01, 0x0b, 0x21, 0x00, 0x02,"
+        "        0x40, 0x03, 0x40, 0x20, 0x01, 0x45, 0x0d, 0x01, 0x41, 0x00, 0x11, 0x00, 0x00, 0x1a, 0x20, 0x01,"
+        "        0x41, 0x01, 0x6b, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x00, 0x11, 0x00, 0x00, 0x0b"
+        "    ]);"
+        "    const { drive } = new WebAssembly.Instance(new WebAssembly.Module(bytes)).exports;"
+        "    const messageFor = (index) => { try { drive(index, 10000); } catch (e) { return e instanceof WebAssembly.RuntimeError && e.message; } };"
+        "    for (let i = 0; i < 50; ++i) {"
+        "        if (drive(0, 10000) !== 0)"
+        "            return false;"
+        "        if (messageFor(1) !== 'call_indirect to a null table entry')"
+        "            return false;"
+        "        if (messageFor(2) !== 'call_indirect to a signature that does not match')"
+        "            return false;"
+        "    }"
+        "    return true;"
+        "})"), "call_indirect should trap on null table entries and mismatched signatures in every tier");
+}
+
+void TestAPI::ropeAppendBuffers()
+{
+    // Reading a rope with indexOf() resolves it. Long ropes that append to the previous one are resolved
+    // into a shared buffer that later appends fill in place, so every value kept along the way is compared
+    // against one built by join(), which never goes through a rope.
+    evaluateScript(
+        "function ropeAppendBufferResolve(string) { string.indexOf('\\0'); return string; }"
+        "function ropeAppendBufferAppends(initial, chunks) {"
+        "    let string = initial;"
+        "    let expected = initial;"
+        "    const values = [];"
+        "    const expectedValues = [];"
+        "    for (const chunk of chunks) {"
+        "        string += chunk;"
+        "        values.push(ropeAppendBufferResolve(string));"
+        "        expected = [expected, chunk].join('');"
+        "        expectedValues.push(expected);"
+        "    }"
+        "    return values.every((value, i) => value.length === expectedValues[i].length && value === expectedValues[i]);"
+        "}"
+        "function ropeAppendBufferChunks(count, special) {"
+        "    const chunks = [];"
+        "    for (let i = 0; i < count; ++i)"
+        "        chunks.push(special && special[i] !== undefined ? special[i] : 'chunk' + i + ';');"
+        "    return chunks;"
+        "}");
+
+    check(functionReturnsTrue("(function () { return ropeAppendBufferAppends('a'.repeat(5000), ropeAppendBufferChunks(300)); })"), "strings kept across += of a long string should never change");
+    check(functionReturnsTrue("(function () { return ropeAppendBufferAppends('a'.repeat(5000), ropeAppendBufferChunks(300, { 150: '\\u2603', 151: 'x' })); })"), "appending a 16-bit string to an 8-bit append buffer should not change earlier values");
+    check(functionReturnsTrue("(function () { return ropeAppendBufferAppends('\\u2603'.repeat(5000), ropeAppendBufferChunks(300)); })"), "appending 8-bit strings to a 16-bit append buffer should not change earlier values");
+    check(functionReturnsTrue("(function () { return ropeAppendBufferAppends('a'.repeat(5000), ropeAppendBufferChunks(300, { 100: 'b'.repeat(30000), 200: 'c'.repeat(100000) })); })"), "appends that exhaust the buffer's capacity should move to a new buffer without changing earlier values");
+
+    check(functionReturnsTrue("(function () {"
+        "    let string = ropeAppendBufferResolve('ab'.repeat(2500) + 'c');"
+        "    let expected = 'ab'.repeat(2500) + 'c';"
+        "    const values = [];"
+        "    const expectedValues = [];"
+        "    for (let i = 0; i < 6; ++i) {"
+        "        string = ropeAppendBufferResolve(i % 2 ? string + string : string + 'x' + string);"
+        "        expected = i % 2 ? [expected, expected].join('') : [expected, 'x', expected].join('');"
+        "        values.push(string);"
+        "        expectedValues.push(expected);"
+        "    }"
+        "    return values.every((value, i) => value === expectedValues[i]);"
+        "})"), "a string appended to itself should resolve correctly and leave earlier values alone");
+
+    check(functionReturnsTrue("(function () {"
+        "    let string = 'a'.repeat(5000);"
+        "    for (let i = 0; i < 10; ++i)"
+        "        ropeAppendBufferResolve(string += 'chunk' + i + ';');"
+        "    const expectedString = ['a'.repeat(5000), ...ropeAppendBufferChunks(10)].join('');"
+        "    const head = string.slice(0, string.length - 3);"
+        "    const middle = string.slice(3);"
+        "    const fromHead = ropeAppendBufferResolve(head + 'HEAD'.repeat(1000));"
+        "    const fromMiddle = ropeAppendBufferResolve(middle + 'MIDDLE');"
+        "    const left = ropeAppendBufferResolve(string + 'left');"
+        "    const right = ropeAppendBufferResolve(string + 'right');"
+        "    const longer = ropeAppendBufferResolve(left + 'longer');"
+        "    string = ropeAppendBufferResolve(string + 'more');"
+        "    return head === expectedString.slice(0, expectedString.length - 3)"
+        "        && middle === expectedString.slice(3)"
+        "        && fromHead === [expectedString.slice(0, expectedString.length - 3), 'HEAD'.repeat(1000)].join('')"
+        "        && fromMiddle === [expectedString.slice(3), 'MIDDLE'].join('')"
+        "        && left === [expectedString, 'left'].join('')"
+        "        && right === [expectedString, 'right'].join('')"
+        "        && longer === [expectedString, 'left', 'longer'].join('')"
+        "        && string === [expectedString, 'more'].join('');"
+        "})"), "appending to substrings of the buffer, or to the same string twice, should not change any other string");
+}
+
+void TestAPI::bigIntKaratsubaMultiplication()
+{
+    // Products of operands with at least 40 digits go through Karatsuba. The reference multiplies by one
+    // 32-bit chunk of the shorter operand at a time, which always takes the schoolbook path, and shifts
+    // and adds the partial products.
+    check(functionReturnsTrue("(function () {"
+        "    let seed = 0x2545f491;"
+        "    const random32 = () => { seed ^= seed << 13; seed ^= seed >>> 17; seed ^= seed << 5; seed >>>= 0; return seed; };"
+        "    const randomBigInt = (digits) => { let hex = ''; for (let i = 0; i < digits * 2; ++i) hex += random32().toString(16).padStart(8, '0'); return BigInt('0x' + hex) | 1n; };"
+        "    const allOnes = (bits) => (1n << BigInt(bits)) - 1n;"
+        "    const reference = (a, b) => {"
+        "        const negative = (a < 0n) !== (b < 0n);"
+        "        if (a < 0n) a = -a;"
+        "        if (b < 0n) b = -b;"
+        "        if (a < b) [a, b] = [b, a];"
+        "        let result = 0n;"
+        "        for (let shift = 0n; b; shift += 32n, b >>= 32n)"
+        "            result += (a * (b & 0xffffffffn)) << shift;"
+        "        return negative ? -result : result;"
+        "    };"
+        "    const sizes = [[40, 40], [41, 40], [79, 80], [80, 80], [81, 81], [127, 129], [160, 161], [200, 40], [1000, 45], [333, 334], [500, 500]];"
+        "    for (const [xDigits, yDigits] of sizes) {"
+        "        const x = randomBigInt(xDigits);"
+        "        const y = randomBigInt(yDigits);"
+        "        const operands = ["
+        "            [x, y], [-x, y], [x, -y], [-x, -y],"
+        "            [allOnes(64 * xDigits), allOnes(64 * yDigits)],"
+        "            [x << 1280n, y],"
+        "            [x, (1n << BigInt(64 * yDigits - 1)) + 1n],"
+        "        ];"
+        "        for (const [a, b] of operands) {"
+        "            if (a * b !== reference(a, b))"
+        "                return false;"
+        "        }"
+        "    }"
+        "    return true;"
+        "})"), "Karatsuba multiplication of large BigInts should agree with schoolbook multiplication");
+}
+
+void TestAPI::atomicsWaitAsync()
+{
+    check(functionReturnsTrue("(function () {"
+        "    const i32 = new Int32Array(new SharedArrayBuffer(16));"
+        "    const notEqual = Atomics.waitAsync(i32, 0, 1);"
+        "    const timedOut = Atomics.waitAsync(i32, 0, 0, 0);"
+        "    return notEqual.async === false && notEqual.value === 'not-equal'"
+        "        && timedOut.async === false && timedOut.value === 'timed-out'"
+        "        && Atomics.notify(i32, 0) === 0;"
+        "})"), "Atomics.waitAsync should answer synchronously when the value differs or the timeout is 0");
+
+    // Settled promises record their results in waitAsyncResults. Notify counts async waiters, and
+    // only the waiters it counts are woken.
+    check(functionReturnsTrue("(function () {"
+        "    globalThis.waitAsyncArray = new Int32Array(new SharedArrayBuffer(16));"
+        "    globalThis.waitAsyncResults = [];"
+        "    const waits = ["
+        "        Atomics.waitAsync(waitAsyncArray, 0, 0),"
+        "        Atomics.waitAsync(waitAsyncArray, 0, 0),"
+        "        Atomics.waitAsync(waitAsyncArray, 0, 0),"
+        "        Atomics.waitAsync(waitAsyncArray, 1, 0, 10),"
+        "    ];"
+        "    waits.forEach((wait, i) => wait.value.then(value => waitAsyncResults[i] = value));"
+        "    return waits.every(wait => wait.async === true && wait.value instanceof Promise)"
+        "        && Atomics.notify(waitAsyncArray, 0, 2) === 2;"
+        "})"), "Atomics.notify should count the waiters Atomics.waitAsync added");
+
+    check(runDeferredWorkUntil("(function () { return waitAsyncResults[3] !== undefined; })"), "a timed wait should settle");
+    check(functionReturnsTrue("(function () {"
+        "    return waitAsyncResults[0] === 'ok' && waitAsyncResults[1] === 'ok'"
+        "        && waitAsyncResults[2] === undefined && waitAsyncResults[3] === 'timed-out';"
+        "})"), "only the notified waiters should be woken, and a timed wait should time out");
+    check(functionReturnsTrue("(function () { return Atomics.notify(waitAsyncArray, 0) === 1 && Atomics.notify(waitAsyncArray, 0) === 0; })"), "Atomics.notify should wake the last async waiter once");
+    check(runDeferredWorkUntil("(function () { return waitAsyncResults[2] === 'ok'; })"), "the last waiter should be woken");
+
+    // Tearing down a VM drops its waiters: nothing is left for a notify from another context group.
+    JSSharedMemoryRef memory = JSSharedMemoryCreate(16);
+    JSGlobalContextRef waiterContext = JSGlobalContextCreate(nullptr);
+    JSStringRef waitScript = JSStringCreateWithUTF8CString("(function (buffer) {"
+        "    const i32 = new Int32Array(buffer);"
+        "    return Atomics.waitAsync(i32, 0, 0).async && Atomics.waitAsync(i32, 0, 0, 1).async;"
+        "})");
+    JSObjectRef wait = const_cast<JSObjectRef>(JSEvaluateScript(waiterContext, waitScript, nullptr, nullptr, 1, nullptr));
+    JSValueRef waiterBuffer = JSObjectMakeSharedArrayBufferWithSharedMemory(waiterContext, memory, nullptr);
+    JSValueRef waited = JSObjectCallAsFunction(waiterContext, wait, nullptr, 1, &waiterBuffer, nullptr);
+    check(JSValueToBoolean(waiterContext, waited), "another context group should be able to wait asynchronously");
+    JSStringRelease(waitScript);
+    JSGlobalContextRelease(waiterContext);
+
+    // Let the 1ms timeout fire after its VM is gone.
+    sleep(10_ms);
+    JSValueRef buffer = JSObjectMakeSharedArrayBufferWithSharedMemory(context, memory, nullptr);
+    JSSharedMemoryRelease(memory);
+    check(functionReturnsTrue("(function (buffer) { return Atomics.notify(new Int32Array(buffer), 0) === 0; })", buffer), "a destroyed VM should leave no waiters behind");
+}
+
+void TestAPI::objectCloneCache()
+{
+    // The first copy from each source structure goes property by property and fills the cache, and
+    // the later ones hit it. Twelve properties do not fit inline, so hits also grow the target's
+    // out-of-line storage.
+    ScriptResult clones = callFunction("(function () {"
+        "    const keys = 'abcdefghijkl'.split('');"
+        "    globalThis.objectCloneCacheKeys = keys;"
+        "    const clones = [[], [], []];"
+        "    for (let i = 0; i < 5; ++i) {"
+        "        const source = {};"
+        "        keys.forEach((key, index) => source[key] = i * 100 + index);"
+        "        clones[0].push({ ...source });"
+        "        clones[1].push(Object.assign({}, source));"
+        "        clones[2].push(Object.assign({ first: i }, source));"
+        "    }"
+        "    return clones;"
+        "})");
+    if (!check(!!clones, "cloning objects should not throw"))
+        return;
+
+    check(functionReturnsTrue("(function (clones) {"
+        "    const keys = objectCloneCacheKeys;"
+        "    return clones.every((group, groupIndex) => group.every((clone, i) => {"
+        "        const hasFirst = groupIndex === 2;"
+        "        return JSON.stringify(Object.keys(clone)) === JSON.stringify(hasFirst ? ['first', ...keys] : keys)"
+        "            && keys.every((key, index) => clone[key] === i * 100 + index)"
+        "            && (!hasFirst || clone.first === i);"
+        "    }));"
+        "})", clones.value()), "copies that hit the clone cache should have the source's values in the source's order");
+
+    {
+        JSC::JSGlobalObject* globalObject = toJS(context);
+        JSC::VM& vm = globalObject->vm();
+        JSC::JSLockHolder locker(vm);
+        JSC::JSObject* groups = toJS(JSValueToObject(context, clones.value(), nullptr));
+        bool sameStructures = true;
+        for (unsigned i = 0; i < 3; ++i) {
+            JSC::JSObject* group = JSC::asObject(groups->get(globalObject, i));
+            JSC::StructureID firstStructureID = JSC::asObject(group->get(globalObject, 0u))->structureID();
+            for (unsigned j = 1; j < 5; ++j)
+                sameStructures &= JSC::asObject(group->get(globalObject, j))->structureID() == firstStructureID;
+        }
+        check(sameStructures, "copies that hit the clone cache should end up with the same structure as the first copy");
+    }
+
+    check(functionReturnsTrue("(function (clones) {"
+        "    const [first, second] = clones[1];"
+        "    first.extra = 1;"
+        "    delete first.a;"
+        "    return second.extra === undefined && second.a === 100 && first.b === 1 && !('a' in first);"
+        "})", clones.value()), "objects made by the clone cache should transition independently");
+
+    // Object.assign() must still notice a setter that appears on the target's prototype after the
+    // pair of structures was cached.
+    check(functionReturnsTrue("(function () {"
+        "    const proto = {};"
+        "    const source = { a: 1, b: 2 };"
+        "    Object.assign(Object.create(proto), source);"
+        "    Object.assign(Object.create(proto), source);"
+        "    let setterValue;"
+        "    Object.defineProperty(proto, 'a', { set(value) { setterValue = value; } });"
+        "    const target = Object.assign(Object.create(proto), source);"
+        "    return setterValue === 1 && !target.hasOwnProperty('a') && target.b === 2;"
+        "})"), "Object.assign() should call setters on the target's prototype even when the copy is cached");
+}
+
+void TestAPI::controlFlowProfilerCoverage()
+{
+    // The control flow profiler has to be on before any code is generated, so use a group of our own.
+    JSContextGroupRef group = JSContextGroupCreate();
+    {
+        JSC::VM& vm = *toJS(group);
+        JSC::JSLockHolder locker(vm);
+        vm.enableControlFlowProfiler();
+    }
+    JSGlobalContextRef profiledContext = JSGlobalContextCreateInGroup(group, nullptr);
+
+    // The loops are long enough for coverage mode to let the function tier up, so the blocks are
+    // marked by optimized code as well as by the LLInt.
+    JSStringRef script = JSStringCreateWithUTF8CString(
+        "function coverage(x) { if (x) { return 'taken'; } else { return 'notTaken'; } }"
+        "function executed(text) { return $vm.hasBasicBlockExecuted(coverage, text); }"
+        "(function () {"
+        "    for (let i = 0; i < 100000; ++i) coverage(true);"
+        "    if (!executed(\"return 'taken'\") || executed(\"return 'notTaken'\"))"
+        "        return false;"
+        "    $vm.resetBasicBlockExecutionCounts();"
+        "    if (executed(\"return 'taken'\") || $vm.basicBlockExecutionCount(coverage, \"return 'taken'\"))"
+        "        return false;"
+        "    coverage(false);"
+        "    if (!executed(\"return 'notTaken'\") || executed(\"return 'taken'\"))"
+        "        return false;"
+        "    $vm.resetBasicBlockExecutionCounts();"
+        "    for (let i = 0; i < 100000; ++i) coverage(true);"
+        "    return executed(\"return 'taken'\") && !executed(\"return 'notTaken'\");"
+        "})()");
+    JSValueRef exception = nullptr;
+    JSValueRef result = JSEvaluateScript(profiledContext, script, nullptr, nullptr, 1, &exception);
+    check(!exception && JSValueToBoolean(profiledContext, result), "resetting basic block execution counts should start a fresh coverage interval in every tier");
+
+    JSStringRelease(script);
+    JSGlobalContextRelease(profiledContext);
+    JSContextGroupRelease(group);
+}
+
+void TestAPI::wasmWorklistInterleaving()
+{
+    // makeModule(count, additions) builds a module of count functions, each returning its index plus
+    // additions, and exports the last one as f. The big module takes many partial compiles, and
+    // the small ones, enqueued after it, should get their turns in between instead of waiting for it.
+    if (!functionReturnsTrue("(function () {"
+        "    if (typeof WebAssembly === 'undefined')"
+        "        return false;"
+        "    const unsignedLEB = (value) => { const bytes = []; do { let byte = value & 0x7f; value >>>= 7; if (value) byte |= 0x80; bytes.push(byte); } while (value); return bytes; };"
+        "    const signedLEB = (value) => { const bytes = []; for (;;) { const byte = value & 0x7f; value >>= 7; if ((!value && !(byte & 0x40)) || (value === -1 && (byte & 0x40))) { bytes.push(byte); return bytes; } bytes.push(byte | 0x80); } };"
+        "    const append = (bytes, more) => { for (const byte of more) bytes.push(byte); };"
+        "    const section = (bytes, id, body) => { bytes.push(id); append(bytes, unsignedLEB(body.length)); append(bytes, body); };"
+        "    const makeModule = (count, additions) => {"
+        "        const bytes = [0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00];"
+        "        section(bytes, 1, [0x01, 0x60, 0x00, 0x01, 0x7f]);"
+        "        const functions = unsignedLEB(count);"
+        "        for (let i = 0; i < count; ++i) functions.push(0x00);"
+        "        section(bytes, 3, functions);"
+        "        const exports = [0x01, 0x01, 0x66, 0x00];"
+        "        append(exports, unsignedLEB(count - 1));"
+        "        section(bytes, 7, exports);"
+        "        const code = unsignedLEB(count);"
+        "        for (let i = 0; i < count; ++i) {"
+        "            const body = [0x00, 0x41];"
+        "            append(body, signedLEB(i));"
+        "            for (let j = 0; j < additions; ++j) append(body, [0x41, 0x01, 0x6a]);"
+        "            body.push(0x0b);"
+        "            append(code, unsignedLEB(body.length));"
+        "            append(code, body);"
+        "        }"
+        "        section(bytes, 10, code);"
+        "        return new Uint8Array(bytes);"
+        "    };"
+        "    globalThis.wasmCompileOrder = [];"
+        "    WebAssembly.compile(makeModule(3000, 50)).then(module => { globalThis.bigWasmModule = module; wasmCompileOrder.push('big'); });"
+        "    for (let i = 0; i < 3; ++i)"
+        "        WebAssembly.compile(makeModule(2, i)).then(module => { if (new WebAssembly.Instance(module).exports.f() === 1 + i) wasmCompileOrder.push('small'); });"
+        "    return true;"
+        "})"))
+        return;
+
+    check(runDeferredWorkUntil("(function () { return wasmCompileOrder.length === 4; })"), "every module should compile");
+    check(functionReturnsTrue("(function () {"
+        "    return wasmCompileOrder.join() === 'small,small,small,big' && new WebAssembly.Instance(bigWasmModule).exports.f() === 2999 + 50;"
+        "})"), "small modules should not wait behind a big module's compilation");
+}
+
+void TestAPI::finalizationRegistryCleanupSlices()
+{
+    // Each callback waits for the clock to tick, so a 1ms slice can only fit a few of them.
+    evaluateScript(
+        "globalThis.cleanedUp = [];"
+        "globalThis.cleanupSliceRegistry = new FinalizationRegistry(held => { cleanedUp.push(held); for (const start = Date.now(); Date.now() === start;) { } });"
+        "(function () { for (let i = 0; i < 200; ++i) cleanupSliceRegistry.register({ }, i); })();");
+    JSSynchronousGarbageCollectForDebugging(context);
+
+    JSC::VM& vm = toJS(context)->vm();
+    {
+        JSC::JSLockHolder locker(vm);
+        vm.deferredWorkTimer->doWork(vm);
+    }
+    check(functionReturnsTrue("(function () { return cleanedUp.length > 0 && cleanedUp.length < 100; })"), "one run of deferred work should only do one time slice of cleanup");
+
+    // Conservative scanning may keep a few of the objects alive.
+    check(runDeferredWorkUntil("(function () { return cleanedUp.length >= 190; })"), "later turns should finish the cleanup");
+    check(functionReturnsTrue("(function () { return new Set(cleanedUp).size === cleanedUp.length && cleanedUp.every(held => held >= 0 && held < 200); })"), "every held value should be cleaned up once");
+}
+
+void TestAPI::heapSnapshotDelta()
+{
+    evaluateScript(
+        "var deltaKept = { };"
+        "var deltaDropped = [];"
+        "for (let i = 0; i < 100; ++i) deltaDropped.push({ });"
+        "globalThis.namedHeapSnapshotEdges = function (snapshot, name) {"
+        "    const edges = [];"
+        "    for (let i = 0; i < snapshot.edges.length; i += 4) {"
+        "        const [from, to, type, data] = snapshot.edges.slice(i, i + 4);"
+        "        const typeName = snapshot.edgeTypes[type];"
+        "        if ((typeName === 'Property' || typeName === 'Variable') && snapshot.edgeNames[data] === name) edges.push({ from, to });"
+        "    }"
+        "    return edges;"
+        "};"
+        "globalThis.heapSnapshotNodeIdentifiers = function (snapshot) {"
+        "    const identifiers = new Set();"
+        "    for (let i = 0; i < snapshot.nodes.length; i += 4) identifiers.add(snapshot.nodes[i]);"
+        "    return identifiers;"
+        "};");
+
+    JSC::VM& vm = toJS(context)->vm();
+    auto snapshotJSON = [&] (bool delta) {
+        JSC::JSLockHolder locker(vm);
+        JSC::HeapSnapshotBuilder builder(vm.ensureHeapProfiler());
+        if (delta)
+            builder.buildDeltaSnapshot();
+        else
+            builder.buildSnapshot();
+        return JSValueMakeString(context, APIString(builder.json()));
+    };
+
+    check(functionReturnsTrue("(function (json) {"
+        "const snapshot = JSON.parse(json);"
+        "const [kept] = namedHeapSnapshotEdges(snapshot, 'deltaKept');"
+        "const [dropped] = namedHeapSnapshotEdges(snapshot, 'deltaDropped');"
+        "if (!kept || !dropped) return false;"
+        "globalThis.deltaKeptIdentifier = kept.to;"
+        "globalThis.deltaDroppedIdentifiers = [];"
+        "for (let i = 0; i < snapshot.edges.length; i += 4) {"
+        "    if (snapshot.edges[i] === dropped.to && snapshot.edgeTypes[snapshot.edges[i + 2]] === 'Index') deltaDroppedIdentifiers.push(snapshot.edges[i + 1]);"
+        "}"
+        "return deltaDroppedIdentifiers.length === 100;"
+        "})", snapshotJSON(false)), "a full heap snapshot should list the objects the delta is taken against");
+
+    evaluateScript(
+        "deltaDropped = null;"
+        "deltaKept.deltaNewChild = { };"
+        "var deltaNewHolder = { deltaOldReference: deltaKept };");
+
+    JSValueRef deltaJSON = snapshotJSON(true);
+    check(functionReturnsTrue("(function (json) {"
+        "const snapshot = JSON.parse(json);"
+        "const nodes = heapSnapshotNodeIdentifiers(snapshot);"
+        "return snapshot.delta === true && !nodes.has(deltaKeptIdentifier) && !deltaDroppedIdentifiers.some(identifier => nodes.has(identifier));"
+        "})", deltaJSON), "a delta heap snapshot should only list nodes that are new since the previous snapshot");
+    check(functionReturnsTrue("(function (json) {"
+        "const snapshot = JSON.parse(json);"
+        "const nodes = heapSnapshotNodeIdentifiers(snapshot);"
+        "const toOlder = namedHeapSnapshotEdges(snapshot, 'deltaOldReference');"
+        "const fromOlder = namedHeapSnapshotEdges(snapshot, 'deltaNewChild');"
+        "return toOlder.length === 1 && nodes.has(toOlder[0].from) && toOlder[0].to === deltaKeptIdentifier"
+        "    && fromOlder.length === 1 && fromOlder[0].from === deltaKeptIdentifier && nodes.has(fromOlder[0].to);"
+        "})", deltaJSON), "a delta heap snapshot should keep edges between new nodes and older nodes");
+    check(functionReturnsTrue("(function (json) { return !namedHeapSnapshotEdges(JSON.parse(json), 'deltaKept').length; })", deltaJSON), "a delta heap snapshot should drop edges between two older nodes");
+    // Conservative scanning may keep a few of the dropped objects alive.
+    check(functionReturnsTrue("(function (json) {"
+        "const collected = new Set(JSON.parse(json).collectedNodes);"
+        "return !collected.has(deltaKeptIdentifier) && deltaDroppedIdentifiers.filter(identifier => collected.has(identifier)).length >= 90;"
+        "})", deltaJSON), "a delta heap snapshot should list the older nodes collected since the previous snapshot");
+}
+
+void TestAPI::branchDirectionProfiling()
+{
+    JSObjectRef function = JSValueToObject(context, evaluateScript(
+        "(function () {"
+        "    function branchDirections(flag) { if (flag) return 1; return 0; }"
+        "    for (let i = 0; i < 800; ++i) branchDirections(!(i % 4));"
+        "    return branchDirections;"
+        "})()").value(), nullptr);
+
+    JSC::VM& vm = toJS(context)->vm();
+    JSC::JSLockHolder locker(vm);
+    JSC::JSFunction* branchDirections = JSC::jsCast<JSC::JSFunction*>(toJS(function));
+    // Later tiers do not profile, so read the counts the LLInt and Baseline JIT left behind.
+    JSC::CodeBlock* codeBlock = branchDirections->jsExecutable()->codeBlockForCall()->baselineAlternative();
+
+    unsigned branchCount = 0;
+    unsigned trueCount = 0;
+    unsigned falseCount = 0;
+    for (const auto& instruction : codeBlock->instructions()) {
+        if (instruction->is<JSC::OpJtrue>()) {
+            auto& metadata = instruction->as<JSC::OpJtrue>().metadata(codeBlock);
+            trueCount += metadata.m_takenCount;
+            falseCount += metadata.m_notTakenCount;
+            branchCount++;
+        } else if (instruction->is<JSC::OpJfalse>()) {
+            auto& metadata = instruction->as<JSC::OpJfalse>().metadata(codeBlock);
+            trueCount += metadata.m_notTakenCount;
+            falseCount += metadata.m_takenCount;
+            branchCount++;
+        }
+    }
+
+    check(branchCount == 1, "the profiled function should have one jtrue or jfalse");
+    check(trueCount + falseCount >= 100 && trueCount + falseCount <= 800, "a branch should count every time it runs before tiering up past the Baseline JIT");
+    check(std::max(falseCount, 3 * trueCount) - std::min(falseCount, 3 * trueCount) <= 3, "a branch should count how often it goes each way");
+}
+
 void configureJSCForTesting()
 {
     JSC::Config::configureForTesting();
@@ -747,12 +1825,57 @@ int testCAPIViaCpp(const char* filter)
     RUN(markedJSValueArrayAndGC());
     RUN(classDefinitionWithJSSubclass());
     RUN(proxyReturnedWithJSSubclassing());
+    RUN(heapOccupancyStatistics());
+    RUN(heapAllocationSampling());
+    RUN(heapSnapshotSerialization());
+    RUN(runtimeCountersSnapshot());
+    RUN(compilerPhaseStatistics());
+    RUN(structureIDTableStatistics());
+    RUN(fastCallbackFunctions());
+    RUN(batchedPropertyAccess());
+    RUN(reusablePropertyNames());
+    RUN(sharedBytesAcrossContextGroups());
+    RUN(scriptBytecodeRestore());
+    RUN(contextGroupReset());
+    RUN(contextGroupNotifyIdle());
+    RUN(contextGroupReleaseMemory());
+    RUN(sharedMemoryAcrossContextGroups());
+    RUN(serializedValuesAcrossContextGroups());
+    RUN(protectHandles());
+    RUN(wasmCallIndirectTraps());
+    RUN(ropeAppendBuffers());
+    RUN(bigIntKaratsubaMultiplication());
+    RUN(atomicsWaitAsync());
+    RUN(objectCloneCache());
+    RUN(controlFlowProfilerCoverage());
+    RUN(wasmWorklistInterleaving());
+    RUN(finalizationRegistryCleanupSlices());
+    RUN(heapSnapshotDelta());
+    RUN(branchDirectionProfiling());
 
     if (tasks.isEmpty()) {
         dataLogLn("Filtered all tests: ERROR");
         return 1;
     }
 
+    // sharedMemoryAcrossContextGroups and atomicsWaitAsync need SharedArrayBuffer,
+    // compilerPhaseStatistics needs phase times, structureIDTableStatistics needs $vm and StructureID
+    // table compaction, controlFlowProfilerCoverage needs coverage mode, and
+    // finalizationRegistryCleanupSlices needs a cleanup time slice. Options are global, so turn them on
+    // before any test starts running rather than flipping them under the other tests' feet.
+    bool useSharedArrayBuffer = JSC::Options::useSharedArrayBuffer();
+    JSC::Options::useSharedArrayBuffer() = true;
+    bool collectCompilerPhaseStatistics = JSC::Options::collectCompilerPhaseStatistics();
+    JSC::Options::collectCompilerPhaseStatistics() = true;
+    bool useDollarVM = JSC::Options::useDollarVM();
+    JSC::Options::useDollarVM() = true;
+    bool useStructureIDTableCompaction = JSC::Options::useStructureIDTableCompaction();
+    JSC::Options::useStructureIDTableCompaction() = true;
+    bool useControlFlowProfilerCoverageMode = JSC::Options::useControlFlowProfilerCoverageMode();
+    JSC::Options::useControlFlowProfilerCoverageMode() = true;
+    double finalizationRegistryCleanupSliceMilliseconds = JSC::Options::finalizationRegistryCleanupSliceMilliseconds();
+    JSC::Options::finalizationRegistryCleanupSliceMilliseconds() = 1;
+
     Lock lock;
 
     static Atomic<int> failed { 0 };
@@ -780,6 +1903,13 @@ int testCAPIViaCpp(const char* filter)
     for (auto& thread : threads)
         thread->waitForCompletion();
 
+    JSC::Options::useSharedArrayBuffer() = useSharedArrayBuffer;
+    JSC::Options::collectCompilerPhaseStatistics() = collectCompilerPhaseStatistics;
+    JSC::Options::useDollarVM() = useDollarVM;
+    JSC::Options::useStructureIDTableCompaction() = useStructureIDTableCompaction;
+    JSC::Options::useControlFlowProfilerCoverageMode() = useControlFlowProfilerCoverageMode;
+    JSC::Options::finalizationRegistryCleanupSliceMilliseconds() = finalizationRegistryCleanupSliceMilliseconds;
+
     dataLogLn("C-API tests in C++ had ", failed.load(), " failures");
     return failed.load();
 }
@@ -37,6 +37,9 @@
 #include "JITCompilationEffort.h"
 #include "MacroAssembler.h"
 #include "MacroAssemblerCodeRef.h"
+#if OS(LINUX)
+#include "PerfLog.h"
+#endif
 #include <wtf/DataLog.h>
 #include <wtf/FastMalloc.h>
 #include <wtf/Noncopyable.h>
@@ -120,6 +123,14 @@ public:
         return !m_didAllocate;
     }
 
+#if OS(LINUX)
+    // Written out alongside the code when it is logged for perf.
+    void setPerfDebugInfo(Vector<PerfLog::DebugEntry>&& debugInfo)
+    {
+        m_perfDebugInfo = WTFMove(debugInfo);
+    }
+#endif
+
     bool isValid() const
     {
         return !didFailToAllocate();
@@ -375,6 +386,9 @@ private:
     bool m_alreadyDisassembled { false };
     MacroAssemblerCodePtr<LinkBufferPtrTag> m_code;
     Vector<RefPtr<SharedTask<void(LinkBuffer&)>>> m_linkTasks;
+#if OS(LINUX)
+    Vector<PerfLog::DebugEntry> m_perfDebugInfo;
+#endif
 };
 
 #if OS(LINUX)
@@ -120,6 +120,22 @@ struct CodeLoadRecord {
     uint64_t codeIndex { 0 };
 };
 
+struct CodeDebugInfoRecord {
+    RecordHeader header {
+        RecordType::JITCodeDebugInfo,
+        0,
+        0,
+    };
+    uint64_t codeAddress { 0 };
+    uint64_t entryCount { 0 };
+};
+
+struct DebugEntry {
+    uint64_t codeAddress { 0 };
+    uint32_t line { 0 };
+    uint32_t discriminator { 0 };
+};
+
 } // namespace JITDump
 
 PerfLog& PerfLog::singleton()
@@ -180,7 +196,27 @@ void PerfLog::flush(const AbstractLocker&)
     fflush(m_file);
 }
 
-void PerfLog::log(CString&& name, const uint8_t* executableAddress, size_t size)
+void PerfLog::writeDebugInfo(const AbstractLocker& locker, const uint8_t* executableAddress, const Vector<DebugEntry>& entries)
+{
+    JITDump::CodeDebugInfoRecord record;
+    record.header.timestamp = generateTimestamp();
+    record.header.totalSize = sizeof(JITDump::CodeDebugInfoRecord);
+    for (auto& entry : entries)
+        record.header.totalSize += sizeof(JITDump::DebugEntry) + entry.fileName.length() + 1;
+    record.codeAddress = bitwise_cast<uintptr_t>(executableAddress);
+    record.entryCount = entries.size();
+
+    write(locker, &record, sizeof(JITDump::CodeDebugInfoRecord));
+    for (auto& entry : entries) {
+        JITDump::DebugEntry debugEntry;
+        debugEntry.codeAddress = bitwise_cast<uintptr_t>(entry.executableAddress);
+        debugEntry.line = entry.line;
+        write(locker, &debugEntry, sizeof(JITDump::DebugEntry));
+        write(locker, entry.fileName.data(), entry.fileName.length() + 1);
+    }
+}
+
+void PerfLog::log(CString&& name, const uint8_t* executableAddress, size_t size, const Vector<DebugEntry>& debugInfo)
 {
     if (!size) {
         dataLogLnIf(PerfLogInternal::verbose, "0 size record ", name, " ", RawPointer(executableAddress));
@@ -200,6 +236,8 @@ void PerfLog::log(CString&& name, const uint8_t* executableAddress, size_t size)
     record.codeSize = size;
     record.codeIndex = logger.m_codeIndex++;
 
+    if (!debugInfo.isEmpty())
+        logger.writeDebugInfo(locker, executableAddress, debugInfo);
     logger.write(locker, &record, sizeof(JITDump::CodeLoadRecord));
     logger.write(locker, name.data(), name.length() + 1);
     logger.write(locker, executableAddress, size);
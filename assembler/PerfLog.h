@@ -29,6 +29,7 @@
 
 #include <stdio.h>
 #include <wtf/Lock.h>
+#include <wtf/Vector.h>
 #include <wtf/text/CString.h>
 
 namespace JSC {
@@ -37,13 +38,22 @@ class PerfLog {
     WTF_MAKE_FAST_ALLOCATED;
     WTF_MAKE_NONCOPYABLE(PerfLog);
 public:
-    static void log(CString&&, const uint8_t* executableAddress, size_t);
+    struct DebugEntry {
+        const uint8_t* executableAddress;
+        unsigned line;
+        CString fileName;
+    };
+
+    // perf applies a debug info record to the code load record that follows it, so both are written
+    // together.
+    static void log(CString&&, const uint8_t* executableAddress, size_t, const Vector<DebugEntry>& debugInfo = { });
 
 private:
     PerfLog();
     static PerfLog& singleton();
 
     void write(const AbstractLocker&, const void*, size_t);
+    void writeDebugInfo(const AbstractLocker&, const uint8_t* executableAddress, const Vector<DebugEntry>&);
     void flush(const AbstractLocker&);
 
     FILE* m_file { nullptr };
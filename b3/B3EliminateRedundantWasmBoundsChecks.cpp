@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "B3EliminateRedundantWasmBoundsChecks.h"
+
+#if ENABLE(B3_JIT)
+
+#include "B3BasicBlockInlines.h"
+#include "B3Dominators.h"
+#include "B3EnsureLoopPreHeaders.h"
+#include "B3NaturalLoops.h"
+#include "B3PhaseScope.h"
+#include "B3ProcedureInlines.h"
+#include "B3ValueInlines.h"
+#include "B3WasmBoundsCheckValue.h"
+#include <wtf/HashMap.h>
+
+namespace JSC { namespace B3 {
+
+namespace {
+
+namespace B3EliminateRedundantWasmBoundsChecksInternal {
+static constexpr bool verbose = false;
+}
+
+// A check of ptr with offset o that passed tells us that ptr + o < size. This only lets us reason
+// about ptr + c without 32-bit wraparound if size itself fits in 32 bits, which is always the case
+// for the pinned size of a 32-bit memory.
+bool boundsFitIn32Bits(WasmBoundsCheckValue* check)
+{
+    switch (check->boundsType()) {
+    case WasmBoundsCheckValue::Type::Pinned:
+        return true;
+    case WasmBoundsCheckValue::Type::Maximum:
+        return check->bounds().maximum <= (static_cast<uint64_t>(1) << 32);
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return false;
+}
+
+bool haveSameBounds(WasmBoundsCheckValue* a, WasmBoundsCheckValue* b)
+{
+    if (a->boundsType() != b->boundsType())
+        return false;
+    switch (a->boundsType()) {
+    case WasmBoundsCheckValue::Type::Pinned:
+        return a->bounds().pinnedSize == b->bounds().pinnedSize;
+    case WasmBoundsCheckValue::Type::Maximum:
+        return a->bounds().maximum == b->bounds().maximum;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return false;
+}
+
+// Trapping earlier than we used to is only unobservable if nothing in between can be observed.
+// Other bounds checks are fine since they would raise the same trap.
+bool isObservable(Value* value)
+{
+    if (value->opcode() == WasmBoundsCheck)
+        return false;
+    Effects effects = value->effects();
+    return effects.writes || effects.writesPinned || effects.exitsSideways || effects.terminal;
+}
+
+class RedundantWasmBoundsCheckElimination {
+public:
+    RedundantWasmBoundsCheckElimination(Procedure& proc)
+        : m_proc(proc)
+    {
+    }
+
+    bool run()
+    {
+        bool hasBoundsChecks = false;
+        for (Value* value : m_proc.values()) {
+            if (value->opcode() == WasmBoundsCheck) {
+                hasBoundsChecks = true;
+                break;
+            }
+        }
+        if (!hasBoundsChecks)
+            return false;
+
+        bool changed = hoistFromLoopHeaders();
+
+        m_proc.resetValueOwners();
+        Dominators& dominators = m_proc.dominators();
+
+        // Pre-order visits every block's dominators before the block itself.
+        for (BasicBlock* block : m_proc.blocksInPreOrder()) {
+            HashMap<Value*, WasmBoundsCheckValue*> foldableChecks;
+            for (Value* value : *block) {
+                if (isObservable(value)) {
+                    foldableChecks.clear();
+                    continue;
+                }
+                if (value->opcode() != WasmBoundsCheck)
+                    continue;
+
+                WasmBoundsCheckValue* check = value->as<WasmBoundsCheckValue>();
+                if (isImpliedByDominatingCheck(dominators, check)) {
+                    dataLogLnIf(B3EliminateRedundantWasmBoundsChecksInternal::verbose, "Eliminating ", *check);
+                    check->replaceWithNop();
+                    changed = true;
+                    continue;
+                }
+
+                Value* pointer = check->child(0);
+                auto addResult = foldableChecks.add(pointer, check);
+                if (!addResult.isNewEntry) {
+                    WasmBoundsCheckValue* earlierCheck = addResult.iterator->value;
+                    if (haveSameBounds(earlierCheck, check)) {
+                        // Nothing observable happened since earlierCheck, so it may as well check
+                        // for our bigger offset too.
+                        ASSERT(check->offset() > earlierCheck->offset());
+                        dataLogLnIf(B3EliminateRedundantWasmBoundsChecksInternal::verbose, "Folding ", *check, " into ", *earlierCheck);
+                        earlierCheck->setOffset(check->offset());
+                        check->replaceWithNop();
+                        changed = true;
+                        continue;
+                    }
+                    addResult.iterator->value = check;
+                }
+
+                m_checksOfPointer.add(pointer, Vector<WasmBoundsCheckValue*>()).iterator->value.append(check);
+            }
+        }
+
+        return changed;
+    }
+
+private:
+    bool hoistFromLoopHeaders()
+    {
+        ensureLoopPreHeaders(m_proc);
+
+        NaturalLoops& loops = m_proc.naturalLoops();
+        if (!loops.numLoops())
+            return false;
+
+        m_proc.resetValueOwners();
+        Dominators& dominators = m_proc.dominators();
+
+        bool changed = false;
+        for (unsigned loopIndex = loops.numLoops(); loopIndex--;) {
+            const NaturalLoop& loop = loops.loop(loopIndex);
+            BasicBlock* header = loop.header();
+
+            BasicBlock* preHeader = nullptr;
+            for (BasicBlock* predecessor : header->predecessors()) {
+                if (!loops.belongsTo(predecessor, loop))
+                    preHeader = predecessor;
+            }
+            // The pre-header must lead nowhere but into the loop, or we would trap on paths that
+            // never run the check.
+            if (!preHeader || preHeader->numSuccessors() != 1)
+                continue;
+
+            // A check at the top of the header runs before anything observable in every iteration.
+            // Since memory never shrinks, the check passes in every iteration if it passes in the
+            // first one, which is exactly when the pre-header runs it.
+            for (Value*& value : *header) {
+                if (isObservable(value))
+                    break;
+                if (value->opcode() != WasmBoundsCheck)
+                    continue;
+                Value* pointer = value->child(0);
+                if (!dominators.dominates(pointer->owner, preHeader))
+                    continue;
+                dataLogLnIf(B3EliminateRedundantWasmBoundsChecksInternal::verbose, "Hoisting ", *value, " to ", *preHeader);
+                preHeader->appendNonTerminal(value);
+                value = m_proc.add<Value>(Nop, Void, value->origin());
+                changed = true;
+            }
+        }
+        return changed;
+    }
+
+    bool isImpliedByDominatingCheck(Dominators& dominators, WasmBoundsCheckValue* check)
+    {
+        auto isImpliedBy = [&] (Value* pointer, uint64_t offset) {
+            auto iter = m_checksOfPointer.find(pointer);
+            if (iter == m_checksOfPointer.end())
+                return false;
+            for (WasmBoundsCheckValue* dominatingCheck : iter->value) {
+                if (dominatingCheck->offset() < offset)
+                    continue;
+                if (!haveSameBounds(dominatingCheck, check))
+                    continue;
+                if (!dominators.dominates(dominatingCheck->owner, check->owner))
+                    continue;
+                return true;
+            }
+            return false;
+        };
+
+        Value* pointer = check->child(0);
+        if (isImpliedBy(pointer, check->offset()))
+            return true;
+
+        // If we know that base + o < size <= 2^32, then base + c cannot wrap for any c <= o.
+        if (pointer->opcode() == Add && pointer->child(1)->hasInt32() && boundsFitIn32Bits(check)) {
+            uint64_t constant = static_cast<uint32_t>(pointer->child(1)->asInt32());
+            if (isImpliedBy(pointer->child(0), constant + check->offset()))
+                return true;
+        }
+        return false;
+    }
+
+    Procedure& m_proc;
+    HashMap<Value*, Vector<WasmBoundsCheckValue*>> m_checksOfPointer;
+};
+
+} // anonymous namespace
+
+bool eliminateRedundantWasmBoundsChecks(Procedure& proc)
+{
+    PhaseScope phaseScope(proc, "eliminateRedundantWasmBoundsChecks");
+    RedundantWasmBoundsCheckElimination elimination(proc);
+    return elimination.run();
+}
+
+} } // namespace JSC::B3
+
+#endif // ENABLE(B3_JIT)
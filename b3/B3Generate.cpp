@@ -33,6 +33,7 @@
 #include "B3DuplicateTails.h"
 #include "B3EliminateCommonSubexpressions.h"
 #include "B3EliminateDeadCode.h"
+#include "B3EliminateRedundantWasmBoundsChecks.h"
 #include "B3FixSSA.h"
 #include "B3FoldPathConstants.h"
 #include "B3HoistLoopInvariantValues.h"
@@ -89,6 +90,8 @@ void generateToAir(Procedure& procedure)
             hoistLoopInvariantValues(procedure);
         if (eliminateCommonSubexpressions(procedure))
             eliminateCommonSubexpressions(procedure);
+        if (Options::useB3WasmBoundsCheckElimination())
+            eliminateRedundantWasmBoundsChecks(procedure);
         eliminateDeadCode(procedure);
         inferSwitches(procedure);
         reduceLoopStrength(procedure);
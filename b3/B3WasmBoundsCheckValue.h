@@ -49,6 +49,7 @@ public:
     };
 
     unsigned offset() const { return m_offset; }
+    void setOffset(unsigned offset) { m_offset = offset; }
     Type boundsType() const { return m_boundsType; }
     Bounds bounds() const { return m_bounds; }
 
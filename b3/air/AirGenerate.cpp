@@ -110,8 +110,22 @@ void prepareForGeneration(Code& code)
     
     eliminateDeadCode(code);
 
-    size_t numTmps = code.numTmps(Bank::GP) + code.numTmps(Bank::FP);
-    if (code.optLevel() == 1 || numTmps > Options::maximumTmpsForGraphColoring()) {
+    // Graph coloring's cost grows with the number of interference edges, which tracks both the Tmp
+    // count and the number of instructions the Tmps are live across. Very large procedures take the
+    // linear scan allocator instead, trading some code quality for bounded compile time.
+    auto shouldAllocateByLinearScan = [&] {
+        if (code.optLevel() == 1)
+            return true;
+        size_t numTmps = code.numTmps(Bank::GP) + code.numTmps(Bank::FP);
+        if (numTmps > Options::maximumTmpsForGraphColoring())
+            return true;
+        size_t numInsts = 0;
+        for (BasicBlock* block : code)
+            numInsts += block->size();
+        return numInsts > Options::maximumInstsForGraphColoring();
+    };
+
+    if (shouldAllocateByLinearScan()) {
         // When we're compiling quickly, we do register and stack allocation in one linear scan
         // phase. It's fast because it computes liveness only once.
         allocateRegistersAndStackByLinearScan(code);
@@ -974,6 +974,7 @@ void testLICMDefaultCall();
 void testDepend32();
 void testDepend64();
 void testWasmBoundsCheck(unsigned offset);
+void testWasmBoundsCheckElimination();
 void testWasmAddress();
 void testFastTLSLoad();
 void testFastTLSStore();
@@ -1133,6 +1133,51 @@ void testWasmBoundsCheck(unsigned offset)
     CHECK_EQ(invoke<int32_t>(*code, 2, bound), computeResult(2));
 }
 
+void testWasmBoundsCheckElimination()
+{
+    Procedure proc;
+    if (proc.optLevel() < 2)
+        return;
+    GPRReg pinned = GPRInfo::argumentGPR1;
+    proc.pinRegister(pinned);
+
+    proc.setWasmBoundsCheckGenerator([=] (CCallHelpers& jit, GPRReg pinnedGPR) {
+        CHECK_EQ(pinnedGPR, pinned);
+
+        jit.move(CCallHelpers::TrustedImm32(42), GPRInfo::returnValueGPR);
+        jit.emitFunctionEpilogue();
+        jit.ret();
+    });
+
+    BasicBlock* root = proc.addBlock();
+    Value* pointer = root->appendNew<ArgumentRegValue>(proc, Origin(), GPRInfo::argumentGPR0);
+    if (pointerType() != Int32)
+        pointer = root->appendNew<Value>(proc, Trunc, Origin(), pointer);
+    root->appendNew<WasmBoundsCheckValue>(proc, Origin(), pinned, pointer, 10);
+    Value* offsetPointer = root->appendNew<Value>(
+        proc, Add, Origin(), pointer, root->appendNew<Const32Value>(proc, Origin(), 4));
+    // Implied by the first check.
+    root->appendNew<WasmBoundsCheckValue>(proc, Origin(), pinned, offsetPointer, 6);
+    // Folded into the first check.
+    root->appendNew<WasmBoundsCheckValue>(proc, Origin(), pinned, pointer, 20);
+    Value* result = root->appendNew<Const32Value>(proc, Origin(), 0x42);
+    root->appendNewControlValue(proc, Return, Origin(), result);
+
+    auto code = compileProc(proc);
+
+    unsigned numBoundsChecks = 0;
+    for (Value* value : proc.values()) {
+        if (value->opcode() == WasmBoundsCheck)
+            numBoundsChecks++;
+    }
+    CHECK_EQ(numBoundsChecks, 1u);
+
+    uint32_t bound = 30;
+    CHECK_EQ(invoke<int32_t>(*code, 9, bound), 0x42);
+    CHECK_EQ(invoke<int32_t>(*code, 10, bound), 42);
+    CHECK_EQ(invoke<int32_t>(*code, 0xfffffffc, bound), 42);
+}
+
 void testWasmAddress()
 {
     Procedure proc;
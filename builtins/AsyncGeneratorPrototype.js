@@ -141,7 +141,7 @@ function awaitValue(generator, value, onFulfilled)
     "use strict";
 
     var onRejected = function (result) { @doAsyncGeneratorBodyCall(generator, result, @GeneratorResumeModeThrow); };
-    @resolveWithoutPromise(value, onFulfilled, onRejected);
+    @resolveWithoutPromiseForAsyncAwait(value, onFulfilled, onRejected);
 }
 
 @globalPrivate
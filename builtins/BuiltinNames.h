@@ -70,6 +70,7 @@ namespace JSC {
     macro(Set) \
     macro(throwTypeErrorFunction) \
     macro(typedArrayLength) \
+    macro(typedArrayFill) \
     macro(typedArraySort) \
     macro(typedArrayGetOriginalConstructor) \
     macro(typedArraySubarrayCreate) \
@@ -93,6 +93,7 @@ function newRegistryEntry(key)
         state: @ModuleFetch,
         fetch: @undefined,
         instantiate: @undefined,
+        dependencyInstantiate: @undefined,
         satisfy: @undefined,
         dependencies: [], // To keep the module order, we store the module keys in the array.
         module: @undefined, // JSModuleRecord
@@ -190,6 +191,16 @@ function requestInstantiate(entry, parameters, fetcher)
     if (entry.instantiate)
         return entry.instantiate;
 
+    // Non-top-level requests never carry parameters, so they share the attempt that was started
+    // when the entry was discovered as a dependency instead of fetching it again. A failed attempt
+    // is not shared, so that requestFetch can retry.
+    var dependencyInstantiate = entry.dependencyInstantiate;
+    if (dependencyInstantiate && parameters === @undefined) {
+        if ((@getPromiseInternalField(dependencyInstantiate, @promiseFieldFlags) & @promiseStateMask) !== @promiseStateRejected)
+            return dependencyInstantiate;
+        entry.dependencyInstantiate = @undefined;
+    }
+
     var instantiatePromise = (async () => {
         var source = await this.requestFetch(entry, parameters, fetcher);
         // https://html.spec.whatwg.org/#fetch-a-single-module-script
@@ -210,6 +221,13 @@ function requestInstantiate(entry, parameters, fetcher)
             var depEntry = this.ensureRegistered(depKey);
             @putByValDirect(dependencies, i, depEntry);
             dependenciesMap.@set(depName, depEntry);
+            // Start fetching the dependency the moment it is discovered, and parse it as soon as its
+            // source arrives, rather than waiting for requestSatisfy to walk down to it. requestSatisfy
+            // picks up the same promise through entry.dependencyInstantiate while it is pending or has
+            // succeeded. A failure is handled here, so it is not an unhandled rejection when loading
+            // failed elsewhere first, and it drops the promise so that the next request fetches again.
+            if (!depEntry.dependencyInstantiate)
+                this.startDependencyInstantiate(depEntry, fetcher);
         }
         entry.dependencies = dependencies;
         entry.module = moduleRecord;
@@ -219,6 +237,18 @@ function requestInstantiate(entry, parameters, fetcher)
     return instantiatePromise;
 }
 
+function startDependencyInstantiate(entry, fetcher)
+{
+    "use strict";
+
+    var dependencyInstantiate = this.requestInstantiate(entry, @undefined, fetcher);
+    entry.dependencyInstantiate = dependencyInstantiate;
+    dependencyInstantiate.catch(() => {
+        if (entry.dependencyInstantiate === dependencyInstantiate)
+            entry.dependencyInstantiate = @undefined;
+    });
+}
+
 function requestSatisfy(entry, parameters, fetcher, visited)
 {
     // https://html.spec.whatwg.org/#internal-module-script-graph-fetching-procedure
@@ -330,6 +330,32 @@ function resolveWithoutPromise(resolution, onFulfilled, onRejected)
     @enqueueJob(@promiseResolveThenableJob, resolution, then, @createResolvingFunctionsWithoutPromise(onFulfilled, onRejected));
 }
 
+// Await on a native promise does not look up "then" and attaches the handlers directly, as in PromiseResolve(%Promise%, value).
+// This saves the intermediate thenable job, so an already settled promise resumes after a single job.
+// This function has strong guarantee that each handler function (onFulfilled and onRejected) will be called at most once.
+@globalPrivate
+function resolveWithoutPromiseForAsyncAwait(resolution, onFulfilled, onRejected)
+{
+    "use strict";
+
+    if (@isPromise(resolution)) {
+        var constructor;
+        try {
+            constructor = resolution.constructor;
+        } catch (error) {
+            @rejectWithoutPromise(error, onFulfilled, onRejected);
+            return;
+        }
+
+        if (constructor === @Promise || constructor === @InternalPromise) {
+            @performPromiseThen(resolution, onFulfilled, onRejected, @undefined);
+            return;
+        }
+    }
+
+    @resolveWithoutPromise(resolution, onFulfilled, onRejected);
+}
+
 // This function has strong guarantee that each handler function (onFulfilled and onRejected) will be called at most once.
 @globalPrivate
 function rejectWithoutPromise(reason, onFulfilled, onRejected)
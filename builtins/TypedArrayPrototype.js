@@ -99,9 +99,7 @@ function fill(value /* [, start [, end]] */)
     if (@isDetached(this))
         @throwTypeError("Underlying ArrayBuffer has been detached from the view");
 
-    for (var i = start; i < end; i++)
-        this[i] = number;
-    return this;
+    return @typedArrayFill(this, number, start, end);
 }
 
 function find(callback /* [, thisArg] */)
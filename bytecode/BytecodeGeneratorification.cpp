@@ -46,6 +46,7 @@ struct YieldData {
     InstructionStream::Offset point { 0 };
     VirtualRegister argument { 0 };
     FastBitVector liveness;
+    FastBitVector needsSave;
 };
 
 class BytecodeGeneratorification {
@@ -195,15 +196,86 @@ public:
 
         for (YieldData& data : m_generatorification.yields())
             data.liveness = getLivenessInfoAtInstruction(codeBlock, instructions, m_generatorification.graph(), BytecodeIndex(m_generatorification.instructions().at(data.point).next().offset()));
+
+        computeLocalsNeedingSave(codeBlock, instructions);
     }
 
 private:
+    // A local restored from the generator frame at a resume point still matches its frame slot until it is
+    // redefined. We do not need to store it again at the next yield if this holds along every path to that yield.
+    // This is a forward must-analysis over such "clean" locals: the entry block and exception handlers start with
+    // nothing clean, merges intersect, defs make a local dirty, and a yield makes exactly its resumed locals clean.
+    void computeLocalsNeedingSave(UnlinkedCodeBlockGenerator* codeBlock, InstructionStreamWriter& instructions)
+    {
+        BytecodeGraph& graph = m_generatorification.graph();
+        unsigned numberOfVariables = codeBlock->numCalleeLocals();
+
+        Vector<FastBitVector> cleanAtHead(graph.size());
+        for (BytecodeBasicBlock& block : graph) {
+            FastBitVector& clean = cleanAtHead[block.index()];
+            clean.resize(numberOfVariables);
+            if (block.isEntryBlock() || block.isExitBlock() || instructions.at(block.leaderOffset())->opcodeID() == op_catch)
+                clean.clearAll();
+            else
+                clean.setAll();
+        }
+
+        auto stepOverBlock = [&] (BytecodeBasicBlock& block, FastBitVector& clean, bool recordYields) {
+            unsigned cursor = 0;
+            for (uint8_t length : block.delta()) {
+                BytecodeIndex bytecodeIndex = BytecodeIndex(block.leaderOffset() + cursor);
+                cursor += length;
+                auto instruction = instructions.at(bytecodeIndex);
+                if (instruction->is<OpYield>()) {
+                    YieldData& data = m_generatorification.yields()[instruction->as<OpYield>().m_yieldPoint];
+                    if (recordYields) {
+                        data.needsSave = data.liveness;
+                        data.needsSave.exclude(clean);
+                    }
+                    clean = data.liveness;
+                    continue;
+                }
+                for (Checkpoint checkpoint = 0; checkpoint < instruction->numberOfCheckpoints(); ++checkpoint) {
+                    stepOverBytecodeIndexDef(codeBlock, instructions, graph, bytecodeIndex.withCheckpoint(checkpoint), [&] (unsigned local) {
+                        clean[local] = false;
+                    });
+                }
+            }
+        };
+
+        FastBitVector clean;
+        FastBitVector newHead;
+        bool changed;
+        do {
+            changed = false;
+            for (BytecodeBasicBlock& block : graph) {
+                if (block.isExitBlock())
+                    continue;
+                clean = cleanAtHead[block.index()];
+                stepOverBlock(block, clean, false);
+                for (unsigned successorIndex : block.successors()) {
+                    newHead = cleanAtHead[successorIndex];
+                    newHead.filter(clean);
+                    changed |= cleanAtHead[successorIndex].setAndCheck(newHead);
+                }
+            }
+        } while (changed);
+
+        for (BytecodeBasicBlock& block : graph) {
+            if (block.isEntryBlock() || block.isExitBlock())
+                continue;
+            clean = cleanAtHead[block.index()];
+            stepOverBlock(block, clean, true);
+        }
+    }
+
     BytecodeGeneratorification& m_generatorification;
 };
 
 void BytecodeGeneratorification::run()
 {
     // We calculate the liveness at each merge point. This gives us the information which registers should be saved and resumed conservatively.
+    // Registers that still match their generator frame slot since the previous resume are resumed but not saved again.
 
     VM& vm = m_bytecodeGenerator.vm();
     {
@@ -237,7 +309,7 @@ void BytecodeGeneratorification::run()
         auto instruction = m_instructions.at(data.point);
         // Emit save sequence.
         rewriter.insertFragmentBefore(instruction, [&] (BytecodeRewriter::Fragment& fragment) {
-            data.liveness.forEachSetBit([&](size_t index) {
+            data.needsSave.forEachSetBit([&](size_t index) {
                 VirtualRegister operand = virtualRegisterForLocal(index);
                 Storage storage = storageForGeneratorLocal(vm, index);
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "BytecodeJumpThreading.h"
+
+#include "BytecodeStructs.h"
+#include "InstructionStream.h"
+#include "PreciseJumpTargetsInlines.h"
+#include "UnlinkedCodeBlockGenerator.h"
+
+namespace JSC {
+
+static constexpr unsigned maximumThreadedJumpChainLength = 8;
+
+void performJumpThreading(UnlinkedCodeBlockGenerator* codeBlock, InstructionStreamWriter& instructions)
+{
+    auto finalTarget = [&] (InstructionStream::Offset offset, int32_t relativeTarget) {
+        InstructionStream::Offset target = offset + relativeTarget;
+        for (unsigned i = 0; i < maximumThreadedJumpChainLength && target < instructions.size(); ++i) {
+            auto instruction = instructions.at(target);
+            if (instruction->opcodeID() != op_jmp)
+                break;
+            InstructionStream::Offset next = target + jumpTargetForInstruction<OpJmp>(codeBlock, instruction);
+            // Stop on a jump to itself, or on the chain's way back to the jump being threaded.
+            if (next == target || next == offset)
+                break;
+            target = next;
+        }
+        return static_cast<int32_t>(target - offset);
+    };
+
+    for (auto instruction : instructions) {
+        InstructionStream::Offset offset = instruction.offset();
+        updateStoredJumpTargetsForInstruction(codeBlock, 0, instruction, [&] (int32_t relativeTarget) {
+            // Switch tables use 0 for cases that fall back to the default target; keep those as they are.
+            if (!relativeTarget)
+                return relativeTarget;
+            return finalTarget(offset, relativeTarget);
+        });
+    }
+}
+
+} // namespace JSC
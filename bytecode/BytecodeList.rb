@@ -694,12 +694,20 @@ op :jtrue,
     args: {
         condition: VirtualRegister,
         targetLabel: BoundLabel,
+    },
+    metadata: {
+        takenCount: unsigned,
+        notTakenCount: unsigned,
     }
 
 op :jfalse,
     args: {
         condition: VirtualRegister,
         targetLabel: BoundLabel,
+    },
+    metadata: {
+        takenCount: unsigned,
+        notTakenCount: unsigned,
     }
 
 op :jeq_null,
@@ -268,6 +268,20 @@ private:
     const Identifier& m_ident;
 };
 
+static uint16_t initialReoptimizationRetryCounter(UnlinkedCodeBlock* unlinkedCodeBlock)
+{
+#if ENABLE(JIT)
+    // Speculations that made other CodeBlocks of this UnlinkedCodeBlock exit are already in the
+    // shared exit profile. Sharing the backoff too keeps every new copy of a function (one per
+    // global object, say) from repeating the same exit and reoptimize cycles at full speed.
+    if (Options::shareReoptimizationRetryCounter())
+        return std::min(unlinkedCodeBlock->takeReoptimizationRetryCounter(), Options::reoptimizationRetryCounterMax());
+#else
+    UNUSED_PARAM(unlinkedCodeBlock);
+#endif
+    return 0;
+}
+
 } // anonymous namespace
 
 CodeBlock::CodeBlock(VM& vm, Structure* structure, CopyParsedBlockTag, CodeBlock& other)
@@ -304,6 +318,7 @@ CodeBlock::CodeBlock(VM& vm, Structure* structure, CopyParsedBlockTag, CodeBlock
     , m_reoptimizationRetryCounter(0)
     , m_metadata(other.m_metadata)
     , m_creationTime(MonotonicTime::now())
+    , m_lastExecutionTime(m_creationTime)
 {
     ASSERT(heap()->isDeferred());
     ASSERT(m_scopeRegister.isLocal());
@@ -355,9 +370,10 @@ CodeBlock::CodeBlock(VM& vm, Structure* structure, ScriptExecutable* ownerExecut
     , m_instructionsRawPointer(unlinkedCodeBlock->instructions().rawPointer())
     , m_osrExitCounter(0)
     , m_optimizationDelayCounter(0)
-    , m_reoptimizationRetryCounter(0)
+    , m_reoptimizationRetryCounter(initialReoptimizationRetryCounter(unlinkedCodeBlock))
     , m_metadata(unlinkedCodeBlock->metadata().link())
     , m_creationTime(MonotonicTime::now())
+    , m_lastExecutionTime(m_creationTime)
 {
     ASSERT(heap()->isDeferred());
     ASSERT(m_scopeRegister.isLocal());
@@ -1091,7 +1107,17 @@ bool CodeBlock::shouldJettisonDueToOldAge(const ConcurrentJSLocker&)
     if (UNLIKELY(Options::forceCodeBlockToJettisonDueToOldAge()))
         return true;
     
-    if (timeSinceCreation() < timeToLive(jitType()))
+    if (!canTrackExecution()) {
+        if (timeSinceCreation() < timeToLive(jitType()))
+            return false;
+        return true;
+    }
+
+    // The cold code threshold only selects machine code to throw away, so it does not apply to LLInt CodeBlocks.
+    if (JITCode::isJIT(jitType()) && m_lastExecutionTime <= m_vm->heap.codeBlockSet().coldCodeThreshold())
+        return true;
+
+    if (MonotonicTime::now() - m_lastExecutionTime < timeToLive(jitType()))
         return false;
     
     return true;
@@ -1534,44 +1560,50 @@ void CodeBlock::finalizeUnconditionally(VM& vm)
     }
 #endif // ENABLE(DFG_JIT)
 
-    auto updateActivity = [&] {
-        if (!VM::useUnlinkedCodeBlockJettisoning())
-            return;
-        JITCode* jitCode = m_jitCode.get();
-        double count = 0;
-        bool alwaysActive = false;
-        switch (JITCode::jitTypeFor(jitCode)) {
-        case JITType::None:
-        case JITType::HostCallThunk:
-            return;
-        case JITType::InterpreterThunk:
-            count = m_llintExecuteCounter.count();
-            break;
-        case JITType::BaselineJIT:
-            count = m_jitExecuteCounter.count();
-            break;
-        case JITType::DFGJIT:
-#if ENABLE(FTL_JIT)
-            count = static_cast<DFG::JITCode*>(jitCode)->tierUpCounter.count();
-#else
-            alwaysActive = true;
-#endif
-            break;
-        case JITType::FTLJIT:
-            alwaysActive = true;
-            break;
-        }
-        if (alwaysActive || m_previousCounter < count) {
-            // CodeBlock is active right now, so resetting UnlinkedCodeBlock's age.
-            m_unlinkedCode->resetAge();
-        }
-        m_previousCounter = count;
-    };
     updateActivity();
 
     VM::SpaceAndSet::setFor(*subspace()).remove(this);
 }
 
+void CodeBlock::updateActivity()
+{
+    JITCode* jitCode = m_jitCode.get();
+    double count = 0;
+    bool alwaysActive = false;
+    switch (JITCode::jitTypeFor(jitCode)) {
+    case JITType::None:
+    case JITType::HostCallThunk:
+        return;
+    case JITType::InterpreterThunk:
+        count = m_llintExecuteCounter.count();
+        break;
+    case JITType::BaselineJIT:
+        count = m_jitExecuteCounter.count();
+        break;
+    case JITType::DFGJIT:
+#if ENABLE(FTL_JIT)
+        count = static_cast<DFG::JITCode*>(jitCode)->tierUpCounter.count();
+#else
+        alwaysActive = true;
+#endif
+        break;
+    case JITType::FTLJIT:
+        alwaysActive = true;
+        break;
+    }
+    // A counter that was reset to a new threshold since we last looked has also been executing. Code
+    // whose execution we cannot count keeps its creation time: it ages out by creation time, and the
+    // cold code budget does not pick it (see canTrackExecution()).
+    bool didExecute = m_previousCounter != count || m_vm->heap.codeBlockSet().isCurrentlyExecuting(this);
+    if (didExecute)
+        m_lastExecutionTime = MonotonicTime::now();
+    if ((alwaysActive || didExecute) && VM::useUnlinkedCodeBlockJettisoning()) {
+        // CodeBlock is active right now, so resetting UnlinkedCodeBlock's age.
+        m_unlinkedCode->resetAge();
+    }
+    m_previousCounter = count;
+}
+
 void CodeBlock::destroy(JSCell* cell)
 {
     static_cast<CodeBlock*>(cell)->~CodeBlock();
@@ -2194,6 +2226,7 @@ void CodeBlock::jettison(Profiler::JettisonReason reason, ReoptimizationMode mod
     CODEBLOCK_LOG_EVENT(codeBlock, "jettison", ("due to ", reason, ", counting = ", mode == CountReoptimization, ", detail = ", pointerDump(detail)));
 
     RELEASE_ASSERT(reason != Profiler::NotJettisoned);
+    vm.runtimeCounters().didJettison(reason);
     
 #if ENABLE(DFG_JIT)
     if (DFG::shouldDumpDisassembly()) {
@@ -2273,6 +2306,11 @@ void CodeBlock::jettison(Profiler::JettisonReason reason, ReoptimizationMode mod
     if (alternative())
         alternative()->optimizeAfterWarmUp();
 
+    // Optimized code that lived long enough to age out held up its speculations, so later
+    // CodeBlocks of this function don't need the backoff that earlier exits built up.
+    if (reason == Profiler::JettisonDueToOldAge)
+        m_unlinkedCode->resetReoptimizationRetryCounter();
+
     if (reason != Profiler::JettisonDueToOldAge && reason != Profiler::JettisonDueToVMTraps)
         tallyFrequentExitSites();
 #endif // ENABLE(DFG_JIT)
@@ -2477,6 +2515,7 @@ void CodeBlock::countReoptimization()
     m_reoptimizationRetryCounter++;
     if (m_reoptimizationRetryCounter > Options::reoptimizationRetryCounterMax())
         m_reoptimizationRetryCounter = Options::reoptimizationRetryCounterMax();
+    m_unlinkedCode->noteReoptimizationRetryCounter(m_reoptimizationRetryCounter);
 }
 
 unsigned CodeBlock::numberOfDFGCompiles()
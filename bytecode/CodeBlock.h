@@ -312,6 +312,16 @@ public:
 
     // O(n) operation. Use getICStatusMap() unless you really only intend to get one stub info.
     StructureStubInfo* findStubInfo(CodeOrigin);
+
+    template<typename Func>
+    void forEachStructureStubInfo(const Func& func)
+    {
+        ConcurrentJSLocker locker(m_lock);
+        if (auto* jitData = m_jitData.get()) {
+            for (StructureStubInfo* stubInfo : jitData->m_stubInfos)
+                func(*stubInfo);
+        }
+    }
     // O(n) operation. Use getICStatusMap() unless you really only intend to get one by-val-info.
     ByValInfo* findByValInfo(CodeOrigin);
 
@@ -983,6 +993,31 @@ private:
         return MonotonicTime::now() - m_creationTime;
     }
 
+    // Only as precise as the GC cycle: this is refreshed when a collection finds us on the
+    // stack or sees our execution counter move since the previous collection.
+    MonotonicTime lastExecutionTime() const { return m_lastExecutionTime; }
+    // Refreshes lastExecutionTime(). Every collection calls this. Outside of one, only call it while no
+    // JS runs on the VM, because it cannot see CodeBlocks that are on the stack.
+    void updateActivity();
+
+    // FTL code, and DFG code when there is no FTL to tier up to, has no execution counter, so
+    // lastExecutionTime() says nothing about whether it still runs.
+    bool canTrackExecution() const
+    {
+        switch (jitType()) {
+        case JITType::DFGJIT:
+#if ENABLE(FTL_JIT)
+            return true;
+#else
+            return false;
+#endif
+        case JITType::FTLJIT:
+            return false;
+        default:
+            return true;
+        }
+    }
+
     void createRareDataIfNecessary()
     {
         if (!m_rareData) {
@@ -1055,6 +1090,7 @@ private:
     RefPtr<MetadataTable> m_metadata;
 
     MonotonicTime m_creationTime;
+    MonotonicTime m_lastExecutionTime;
     double m_previousCounter { 0 };
 
     std::unique_ptr<RareData> m_rareData;
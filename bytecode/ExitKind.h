@@ -59,6 +59,8 @@ enum ExitKind : uint8_t {
     BigInt32Overflow, // We exited because of an BigInt32 overflow.
 };
 
+static constexpr unsigned numberOfExitKinds = static_cast<unsigned>(BigInt32Overflow) + 1;
+
 const char* exitKindToString(ExitKind);
 bool exitKindMayJettison(ExitKind);
 
@@ -52,7 +52,8 @@ GetByStatus GetByStatus::computeFromLLInt(CodeBlock* profiledBlock, BytecodeInde
     auto instruction = profiledBlock->instructions().at(bytecodeIndex.offset());
 
     StructureID structureID;
-    const Identifier* identifier = nullptr;
+    UniquedStringImpl* uid = nullptr;
+    CacheableIdentifier cacheableIdentifier;
     switch (instruction->opcodeID()) {
     case op_get_by_id: {
         auto& metadata = instruction->as<OpGetById>().metadata(profiledBlock);
@@ -62,12 +63,12 @@ GetByStatus GetByStatus::computeFromLLInt(CodeBlock* profiledBlock, BytecodeInde
             return GetByStatus(NoInformation, false);
         structureID = metadata.m_modeMetadata.defaultMode.structureID;
 
-        identifier = &(profiledBlock->identifier(instruction->as<OpGetById>().m_property));
+        uid = profiledBlock->identifier(instruction->as<OpGetById>().m_property).impl();
         break;
     }
     case op_get_by_id_direct:
         structureID = instruction->as<OpGetByIdDirect>().metadata(profiledBlock).m_structureID;
-        identifier = &(profiledBlock->identifier(instruction->as<OpGetByIdDirect>().m_property));
+        uid = profiledBlock->identifier(instruction->as<OpGetByIdDirect>().m_property).impl();
         break;
     case op_try_get_by_id: {
         // FIXME: We should not just bail if we see a try_get_by_id.
@@ -87,7 +88,7 @@ GetByStatus GetByStatus::computeFromLLInt(CodeBlock* profiledBlock, BytecodeInde
         if (metadata.m_modeMetadata.mode != GetByIdMode::Default)
             return GetByStatus(NoInformation, false);
         structureID = metadata.m_modeMetadata.defaultMode.structureID;
-        identifier = &vm.propertyNames->next;
+        uid = vm.propertyNames->next.impl();
         break;
     }
 
@@ -97,21 +98,29 @@ GetByStatus GetByStatus::computeFromLLInt(CodeBlock* profiledBlock, BytecodeInde
             if (metadata.m_doneModeMetadata.mode != GetByIdMode::Default)
                 return GetByStatus(NoInformation, false);
             structureID = metadata.m_doneModeMetadata.defaultMode.structureID;
-            identifier = &vm.propertyNames->done;
+            uid = vm.propertyNames->done.impl();
         } else {
             ASSERT(bytecodeIndex.checkpoint() == OpIteratorNext::getValue);
             if (metadata.m_valueModeMetadata.mode != GetByIdMode::Default)
                 return GetByStatus(NoInformation, false);
             structureID = metadata.m_valueModeMetadata.defaultMode.structureID;
-            identifier = &vm.propertyNames->value;
+            uid = vm.propertyNames->value.impl();
         }
         break;
     }
 
-    case op_get_private_name:
-        // FIXME: Consider using LLInt caches or IC information to populate GetByStatus
-        // https://bugs.webkit.org/show_bug.cgi?id=217245
-        return GetByStatus(NoInformation, false);
+    case op_get_private_name: {
+        // The LLInt caches the private name it saw along with the structure. The variant carries the
+        // name so that the DFG can check that the property operand is the same symbol.
+        auto& metadata = instruction->as<OpGetPrivateName>().metadata(profiledBlock);
+        JSCell* property = metadata.m_property.get();
+        if (!property || !property->isSymbol())
+            return GetByStatus(NoInformation, false);
+        structureID = metadata.m_structureID;
+        cacheableIdentifier = CacheableIdentifier::createFromCell(property);
+        uid = cacheableIdentifier.uid();
+        break;
+    }
 
     default: {
         ASSERT_NOT_REACHED();
@@ -128,14 +137,14 @@ GetByStatus GetByStatus::computeFromLLInt(CodeBlock* profiledBlock, BytecodeInde
         return GetByStatus(NoInformation, false);
 
     unsigned attributes;
-    PropertyOffset offset = structure->getConcurrently(identifier->impl(), attributes);
+    PropertyOffset offset = structure->getConcurrently(uid, attributes);
     if (!isValidOffset(offset))
         return GetByStatus(NoInformation, false);
     if (attributes & PropertyAttribute::CustomAccessorOrValue)
         return GetByStatus(NoInformation, false);
 
     GetByStatus result(Simple, false);
-    result.appendVariant(GetByIdVariant(nullptr, StructureSet(structure), offset));
+    result.appendVariant(GetByIdVariant(cacheableIdentifier, StructureSet(structure), offset));
     return result;
 }
 
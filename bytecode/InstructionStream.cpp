@@ -26,6 +26,8 @@
 #include "config.h"
 #include "InstructionStream.h"
 
+#include "CachedBytecode.h"
+
 namespace JSC {
 
 DEFINE_ALLOCATOR_WITH_HEAP_IDENTIFIER(InstructionStream);
@@ -34,16 +36,26 @@ InstructionStream::InstructionStream(InstructionBuffer&& instructions)
     : m_instructions(WTFMove(instructions))
 { }
 
+InstructionStream::InstructionStream(WTF::Ref<CachedBytecode>&& cachedBytecode, const uint8_t* instructions, size_t size)
+    : m_mappedBytecode(WTFMove(cachedBytecode))
+    , m_mappedInstructions(instructions)
+    , m_mappedSize(size)
+{
+    ASSERT(instructions && size);
+}
+
+InstructionStream::~InstructionStream() = default;
+
 size_t InstructionStream::sizeInBytes() const
 {
-    return m_instructions.size();
+    return size();
 }
 
 bool InstructionStream::contains(Instruction* instruction) const
 {
 
     const uint8_t* pointer = bitwise_cast<const uint8_t*>(instruction);
-    return pointer >= m_instructions.data() && pointer < (m_instructions.data() + m_instructions.size());
+    return pointer >= data() && pointer < (data() + size());
 }
 
 }
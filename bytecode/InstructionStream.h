@@ -28,10 +28,13 @@
 
 #include "BytecodeIndex.h"
 #include "Instruction.h"
+#include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
 
 namespace JSC {
 
+class CachedBytecode;
+
 DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(InstructionStream);
 
 class InstructionStream {
@@ -47,35 +50,27 @@ public:
     using Offset = unsigned;
 
 private:
-    template<class InstructionBuffer>
+    template<class InstructionStreamType>
     class BaseRef {
         WTF_MAKE_FAST_ALLOCATED;
 
         friend class InstructionStream;
 
     public:
-        BaseRef(const BaseRef<InstructionBuffer>& other)
-            : m_instructions(other.m_instructions)
-            ,  m_index(other.m_index)
-        { }
-
-        void operator=(const BaseRef<InstructionBuffer>& other)
-        {
-            m_instructions = other.m_instructions;
-            m_index = other.m_index;
-        }
+        BaseRef(const BaseRef<InstructionStreamType>& other) = default;
+        BaseRef& operator=(const BaseRef<InstructionStreamType>& other) = default;
 
         inline const Instruction* operator->() const { return unwrap(); }
         inline const Instruction* ptr() const { return unwrap(); }
 
-        bool operator!=(const BaseRef<InstructionBuffer>& other) const
+        bool operator!=(const BaseRef<InstructionStreamType>& other) const
         {
-            return &m_instructions != &other.m_instructions || m_index != other.m_index;
+            return m_stream != other.m_stream || m_index != other.m_index;
         }
 
         BaseRef next() const
         {
-            return BaseRef { m_instructions, m_index + ptr()->size() };
+            return BaseRef { *m_stream, m_index + ptr()->size() };
         }
 
         inline Offset offset() const { return m_index; }
@@ -83,45 +78,46 @@ private:
 
         bool isValid() const
         {
-            return m_index < m_instructions.size();
+            return m_index < m_stream->size();
         }
 
     private:
-        inline const Instruction* unwrap() const { return reinterpret_cast<const Instruction*>(&m_instructions[m_index]); }
+        inline const Instruction* unwrap() const { return reinterpret_cast<const Instruction*>(m_stream->data() + m_index); }
 
     protected:
-        BaseRef(InstructionBuffer& instructions, size_t index)
-            : m_instructions(instructions)
+        BaseRef(InstructionStreamType& stream, size_t index)
+            : m_stream(&stream)
             , m_index(index)
         { }
 
-        InstructionBuffer& m_instructions;
+        InstructionStreamType* m_stream;
         Offset m_index;
     };
 
 public:
-    using Ref = BaseRef<const InstructionBuffer>;
+    using Ref = BaseRef<const InstructionStream>;
 
-    class MutableRef : public BaseRef<InstructionBuffer> {
+    class MutableRef : public BaseRef<InstructionStream> {
         friend class InstructionStreamWriter;
 
     protected:
-        using BaseRef<InstructionBuffer>::BaseRef;
+        using BaseRef<InstructionStream>::BaseRef;
 
     public:
-        Ref freeze() const  { return Ref { m_instructions, m_index }; }
+        Ref freeze() const  { return Ref { *m_stream, m_index }; }
         inline Instruction* operator->() { return unwrap(); }
         inline const Instruction* operator->() const { return unwrap(); }
         inline Instruction* ptr() { return unwrap(); }
         inline const Instruction* ptr() const { return unwrap(); }
         inline operator Ref()
         {
-            return Ref { m_instructions, m_index };
+            return Ref { *m_stream, m_index };
         }
 
     private:
-        inline Instruction* unwrap() { return reinterpret_cast<Instruction*>(&m_instructions[m_index]); }
-        inline const Instruction* unwrap() const { return reinterpret_cast<const Instruction*>(&m_instructions[m_index]); }
+        // Only writers hand out MutableRefs, and their instructions are never mapped.
+        inline Instruction* unwrap() { return reinterpret_cast<Instruction*>(&m_stream->m_instructions[m_index]); }
+        inline const Instruction* unwrap() const { return reinterpret_cast<const Instruction*>(&m_stream->m_instructions[m_index]); }
     };
 
 private:
@@ -149,31 +145,33 @@ private:
     };
 
 public:
+    JS_EXPORT_PRIVATE ~InstructionStream();
+
     inline iterator begin() const
     {
-        return iterator { m_instructions, 0 };
+        return iterator { *this, 0 };
     }
 
     inline iterator end() const
     {
-        return iterator { m_instructions, m_instructions.size() };
+        return iterator { *this, size() };
     }
 
     inline const Ref at(BytecodeIndex index) const { return at(index.offset()); }
     inline const Ref at(Offset offset) const
     {
-        ASSERT(offset < m_instructions.size());
-        return Ref { m_instructions, offset };
+        ASSERT(offset < size());
+        return Ref { *this, offset };
     }
 
     inline size_t size() const
     {
-        return m_instructions.size();
+        return m_mappedInstructions ? m_mappedSize : m_instructions.size();
     }
 
     const void* rawPointer() const
     {
-        return m_instructions.data();
+        return data();
     }
 
     bool contains(Instruction*) const;
@@ -181,7 +179,20 @@ public:
 protected:
     explicit InstructionStream(InstructionBuffer&&);
 
+    const uint8_t* data() const
+    {
+        return m_mappedInstructions ? m_mappedInstructions : m_instructions.data();
+    }
+
     InstructionBuffer m_instructions;
+
+private:
+    // Instructions used in place from a bytecode cache, which is kept alive for as long as they are.
+    InstructionStream(WTF::Ref<CachedBytecode>&&, const uint8_t* instructions, size_t);
+
+    RefPtr<CachedBytecode> m_mappedBytecode;
+    const uint8_t* m_mappedInstructions { nullptr };
+    size_t m_mappedSize { 0 };
 };
 
 class InstructionStreamWriter : public InstructionStream {
@@ -201,7 +212,7 @@ public:
     inline MutableRef ref(Offset offset)
     {
         ASSERT(offset < m_instructions.size());
-        return MutableRef { m_instructions, offset };
+        return MutableRef { *this, offset };
     }
 
     void seek(unsigned position)
@@ -283,7 +294,7 @@ public:
 
     MutableRef ref()
     {
-        return MutableRef { m_instructions, m_position };
+        return MutableRef { *this, m_position };
     }
 
     void swap(InstructionStreamWriter& other)
@@ -321,12 +332,12 @@ private:
 public:
     iterator begin()
     {
-        return iterator { m_instructions, 0 };
+        return iterator { *this, 0 };
     }
 
     iterator end()
     {
-        return iterator { m_instructions, m_instructions.size() };
+        return iterator { *this, m_instructions.size() };
     }
 
 private:
@@ -51,6 +51,7 @@ class JSGlobalObject;
     v(AggregateError, nullptr) \
     v(typedArrayLength, nullptr) \
     v(typedArrayGetOriginalConstructor, nullptr) \
+    v(typedArrayFill, nullptr) \
     v(typedArraySort, nullptr) \
     v(isTypedArrayView, nullptr) \
     v(isSharedTypedArrayView, nullptr) \
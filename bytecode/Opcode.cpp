@@ -31,11 +31,13 @@
 #include "Opcode.h"
 
 #include "BytecodeStructs.h"
+#include "InstructionStream.h"
+#include <wtf/DataLog.h>
+#include <wtf/Lock.h>
 #include <wtf/PrintStream.h>
 
 #if ENABLE(OPCODE_STATS)
 #include <array>
-#include <wtf/DataLog.h>
 #endif
 
 namespace JSC {
@@ -64,6 +66,55 @@ const char* const wasmOpcodeNames[] = {
 #undef OPCODE_NAME_ENTRY
 };
 
+// Static counts of adjacent opcode pairs in generated bytecode, for judging which sequences are
+// common enough to be worth fusing in the BytecodeGenerator. Dumped at exit.
+static Lock generatedOpcodePairsLock;
+static uint64_t* generatedOpcodePairCounts;
+
+static void dumpGeneratedOpcodePairs()
+{
+    auto locker = holdLock(generatedOpcodePairsLock);
+    Vector<std::pair<uint64_t, std::pair<unsigned, unsigned>>> pairs;
+    uint64_t total = 0;
+    for (unsigned first = 0; first < numOpcodeIDs; ++first) {
+        for (unsigned second = 0; second < numOpcodeIDs; ++second) {
+            if (uint64_t count = generatedOpcodePairCounts[first * numOpcodeIDs + second]) {
+                pairs.append({ count, { first, second } });
+                total += count;
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end(), [] (const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    dataLogLn("Generated bytecode pairs: ", total);
+    for (unsigned i = 0; i < std::min<size_t>(pairs.size(), 100); ++i) {
+        auto& pair = pairs[i];
+        dataLogF("%30s %-30s %10llu %6.2f%%\n", opcodeNames[pair.second.first], opcodeNames[pair.second.second],
+            static_cast<unsigned long long>(pair.first), static_cast<double>(pair.first) / total * 100);
+    }
+}
+
+void recordGeneratedOpcodePairs(const InstructionStream& instructions)
+{
+    auto locker = holdLock(generatedOpcodePairsLock);
+    if (!generatedOpcodePairCounts) {
+        generatedOpcodePairCounts = static_cast<uint64_t*>(fastZeroedMalloc(sizeof(uint64_t) * numOpcodeIDs * numOpcodeIDs));
+        atexit(dumpGeneratedOpcodePairs);
+    }
+
+    // Pairs that straddle a jump target are counted too; they cannot be fused, but they are rare
+    // enough not to change which sequences come out on top.
+    Optional<OpcodeID> previous;
+    for (const auto& instruction : instructions) {
+        OpcodeID current = instruction->opcodeID();
+        if (previous)
+            generatedOpcodePairCounts[*previous * numOpcodeIDs + current]++;
+        previous = current;
+    }
+}
+
 #if ENABLE(OPCODE_STATS)
 
 inline const char* padOpcodeName(OpcodeID op, unsigned width)
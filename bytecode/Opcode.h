@@ -170,6 +170,9 @@ typedef OpcodeID Opcode;
 extern const char* const opcodeNames[];
 extern const char* const wasmOpcodeNames[];
 
+class InstructionStream;
+void recordGeneratedOpcodePairs(const InstructionStream&);
+
 #if ENABLE(OPCODE_STATS)
 
 struct OpcodeStats {
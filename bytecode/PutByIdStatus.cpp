@@ -34,6 +34,7 @@
 #include "PolymorphicAccess.h"
 #include "StructureInlines.h"
 #include "StructureStubInfo.h"
+#include "Symbol.h"
 #include <wtf/ListDump.h>
 
 namespace JSC {
@@ -49,21 +50,31 @@ PutByIdStatus PutByIdStatus::computeFromLLInt(CodeBlock* profiledBlock, Bytecode
     
     auto instruction = profiledBlock->instructions().at(bytecodeIndex.offset());
 
-    // We are not yet using `computeFromLLInt` in any place for `put_private_name`.
-    // We can add support for it if this is required in future changes, since we have
-    // IC implemented for this operation on LLInt.
-    ASSERT(!instruction->is<OpPutPrivateName>());
-
-    auto bytecode = instruction->as<OpPutById>();
-    auto& metadata = bytecode.metadata(profiledBlock);
+    StructureID structureID;
+    StructureID newStructureID;
+    bool isDirect;
+    if (instruction->is<OpPutPrivateName>()) {
+        auto& metadata = instruction->as<OpPutPrivateName>().metadata(profiledBlock);
+        // The LLInt cache is only good for the private name it was filled with.
+        JSCell* property = metadata.m_property.get();
+        if (!property || !property->isSymbol() || asSymbol(property)->uid() != uid)
+            return PutByIdStatus(NoInformation);
+        structureID = metadata.m_oldStructureID;
+        newStructureID = metadata.m_newStructureID;
+        isDirect = true;
+    } else {
+        auto bytecode = instruction->as<OpPutById>();
+        auto& metadata = bytecode.metadata(profiledBlock);
+        structureID = metadata.m_oldStructureID;
+        newStructureID = metadata.m_newStructureID;
+        isDirect = bytecode.m_flags.isDirect();
+    }
 
-    StructureID structureID = metadata.m_oldStructureID;
     if (!structureID)
         return PutByIdStatus(NoInformation);
     
     Structure* structure = vm.heap.structureIDTable().get(structureID);
 
-    StructureID newStructureID = metadata.m_newStructureID;
     if (!newStructureID) {
         PropertyOffset offset = structure->getConcurrently(uid);
         if (!isValidOffset(offset))
@@ -81,7 +92,7 @@ PutByIdStatus PutByIdStatus::computeFromLLInt(CodeBlock* profiledBlock, Bytecode
         return PutByIdStatus(NoInformation);
     
     ObjectPropertyConditionSet conditionSet;
-    if (!(bytecode.m_flags.isDirect())) {
+    if (!isDirect) {
         conditionSet =
             generateConditionsForPropertySetterMissConcurrently(
                 vm, profiledBlock->globalObject(), structure, uid);
@@ -123,6 +123,9 @@ public:
 
     bool containsPC(void* pc) const;
 
+    // Called on every entry into one of this IC's slow path operations, whether or not it repatches.
+    void didTakeSlowPath() { WTF::incrementWithSaturation(slowPathCount); }
+
     uint32_t inlineSize() const
     {
         int32_t inlineSize = MacroAssembler::differenceBetweenCodePtr(start, doneLocation);
@@ -374,6 +377,8 @@ public:
     uint8_t repatchCount { 0 };
     uint8_t numberOfCoolDowns { 0 };
 
+    uint32_t slowPathCount { 0 };
+
     CallSiteIndex callSiteIndex;
 
     uint8_t bufferingCountdown;
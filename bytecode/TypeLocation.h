@@ -55,6 +55,9 @@ public:
     unsigned m_divotEnd;
     unsigned m_divotForFunctionOffsetIfReturnStatement;
     RuntimeType m_lastSeenType;
+    // When false, code running in the baseline JIT or the DFG does not log values for this site, so
+    // m_instructionTypeSet and m_globalTypeSet only hold the types seen while the LLInt ran it.
+    bool m_isSampledInJIT { true };
 };
 
 } // namespace JSC
@@ -290,6 +290,25 @@ public:
     DFG::ExitProfile& exitProfile() { return m_exitProfile; }
 #endif
 
+#if ENABLE(JIT)
+    // The most reoptimizations any CodeBlock linked from this UnlinkedCodeBlock has needed. New
+    // CodeBlocks start their backoff here instead of relearning it through their own OSR exits.
+    // Every CodeBlock that starts from it decays it by one, so it only stays high while new
+    // CodeBlocks keep needing to reoptimize.
+    unsigned takeReoptimizationRetryCounter()
+    {
+        unsigned counter = m_reoptimizationRetryCounter;
+        if (m_reoptimizationRetryCounter)
+            m_reoptimizationRetryCounter--;
+        return counter;
+    }
+    void noteReoptimizationRetryCounter(unsigned counter)
+    {
+        m_reoptimizationRetryCounter = std::max<unsigned>(m_reoptimizationRetryCounter, counter);
+    }
+    void resetReoptimizationRetryCounter() { m_reoptimizationRetryCounter = 0; }
+#endif
+
     UnlinkedMetadataTable& metadata() { return m_metadata.get(); }
 
     size_t metadataSizeInBytes()
@@ -376,6 +395,9 @@ private:
 #if ENABLE(DFG_JIT)
     DFG::ExitProfile m_exitProfile;
 #endif
+#if ENABLE(JIT)
+    uint8_t m_reoptimizationRetryCounter { 0 };
+#endif
 
     // Constant Pools
     RefCountedArray<Identifier> m_identifiers;
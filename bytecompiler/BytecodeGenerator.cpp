@@ -35,6 +35,7 @@
 #include "BuiltinNames.h"
 #include "BytecodeGeneratorBaseInlines.h"
 #include "BytecodeGeneratorification.h"
+#include "BytecodeJumpThreading.h"
 #include "BytecodeUseDef.h"
 #include "CatchScope.h"
 #include "DefinePropertyAttributes.h"
@@ -282,7 +283,12 @@ ParserError BytecodeGenerator::generate()
     if (isGeneratorOrAsyncFunctionBodyParseMode(m_codeBlock->parseMode()))
         performGeneratorification(*this, m_codeBlock.get(), m_writer, m_generatorFrameSymbolTable.get(), m_generatorFrameSymbolTableIndex);
 
+    if (Options::useBytecodeJumpThreading())
+        performJumpThreading(m_codeBlock.get(), m_writer);
+
     RELEASE_ASSERT(static_cast<unsigned>(m_codeBlock->numCalleeLocals()) < static_cast<unsigned>(FirstConstantRegisterIndex));
+    if (UNLIKELY(Options::dumpGeneratedBytecodePairs()))
+        recordGeneratedOpcodePairs(m_writer);
     m_codeBlock->finalize(m_writer.finalize());
     if (m_expressionTooDeep)
         return ParserError(ParserError::OutOfMemory);
@@ -1347,6 +1353,20 @@ bool BytecodeGenerator::fuseTestAndJmp(RegisterID* cond, Label& target)
     return false;
 }
 
+template<typename JmpOp>
+bool BytecodeGenerator::fuseMoveAndJmp(RegisterID* cond, Label& target)
+{
+    ASSERT(canDoPeepholeOptimization());
+    auto mov = m_lastInstruction->as<OpMov>();
+    if (cond->index() == mov.m_dst.offset() && cond->isTemporary() && !cond->refCount()) {
+        rewind();
+
+        JmpOp::emit(this, mov.m_src, target.bind(this));
+        return true;
+    }
+    return false;
+}
+
 void BytecodeGenerator::emitJumpIfTrue(RegisterID* cond, Label& target)
 {
     if (canDoPeepholeOptimization()) {
@@ -1389,6 +1409,9 @@ void BytecodeGenerator::emitJumpIfTrue(RegisterID* cond, Label& target)
         } else if (m_lastOpcodeID == op_is_undefined_or_null && target.isForward()) {
             if (fuseTestAndJmp<OpIsUndefinedOrNull, OpJundefinedOrNull>(cond, target))
                 return;
+        } else if (m_lastOpcodeID == op_mov) {
+            if (fuseMoveAndJmp<OpJtrue>(cond, target))
+                return;
         }
     }
 
@@ -1440,6 +1463,9 @@ void BytecodeGenerator::emitJumpIfFalse(RegisterID* cond, Label& target)
         } else if (m_lastOpcodeID == op_is_undefined_or_null && target.isForward()) {
             if (fuseTestAndJmp<OpIsUndefinedOrNull, OpJnundefinedOrNull>(cond, target))
                 return;
+        } else if (m_lastOpcodeID == op_mov) {
+            if (fuseMoveAndJmp<OpJfalse>(cond, target))
+                return;
         }
     }
 
@@ -899,6 +899,9 @@ namespace JSC {
         template<typename UnaryOp, typename JmpOp>
         bool fuseTestAndJmp(RegisterID* cond, Label& target);
 
+        template<typename JmpOp>
+        bool fuseMoveAndJmp(RegisterID* cond, Label& target);
+
         void emitEnter();
         void emitCheckTraps();
 
@@ -5247,6 +5247,16 @@ void ByteCodeParser::parseGetById(const Instruction* currentInstruction)
     handleGetById(bytecode.m_dst, prediction, base, CacheableIdentifier::createFromIdentifierOwnedByCodeBlock(m_inlineStackTop->m_profiledBlock, uid), identifierNumber, getByStatus, type, nextOpcodeIndex());
 }
 
+static uint32_t iterationModesToCompile(uint32_t seenModes)
+{
+    // We inline at most one fast iteration mode per site. Any other fast mode the site has seen goes
+    // through the generic path, which handles every iterable.
+    uint32_t fastModes = seenModes & ~static_cast<uint32_t>(IterationMode::Generic);
+    if (WTF::bitCount(fastModes) <= 1)
+        return seenModes;
+    return (fastModes & -fastModes) | static_cast<uint32_t>(IterationMode::Generic);
+}
+
 static uint64_t makeDynamicVarOpInfo(unsigned identifierNumber, unsigned getPutInfo)
 {
     static_assert(sizeof(identifierNumber) == 4,
@@ -6271,19 +6281,17 @@ void ByteCodeParser::parseBlock(unsigned limit)
             CacheableIdentifier identifier;
             unsigned identifierNumber = std::numeric_limits<unsigned>::max();
             PutByIdStatus putByIdStatus;
+            bool hasExitSite = m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadIdent)
+                || m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadType)
+                || m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadConstantValue);
+            bool baselineHasCache = false;
             {
                 ConcurrentJSLocker locker(m_inlineStackTop->m_profiledBlock->m_lock);
                 ByValInfo* byValInfo = m_inlineStackTop->m_baselineMap.get(CodeOrigin(currentCodeOrigin().bytecodeIndex())).byValInfo;
-                // FIXME: When the bytecode is not compiled in the baseline JIT, byValInfo becomes null.
-                // At that time, there is no information. For `put_private_name`, we might have some info from
-                // LLInt IC, including cached cell that we could use if ByVal is not available.
-                // https://bugs.webkit.org/show_bug.cgi?id=216779
-                if (byValInfo 
-                    && byValInfo->stubInfo
+                baselineHasCache = byValInfo && byValInfo->stubInfo;
+                if (baselineHasCache
                     && !byValInfo->tookSlowPath
-                    && !m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadIdent)
-                    && !m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadType)
-                    && !m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadConstantValue)) {
+                    && !hasExitSite) {
                     tryCompileAsPutByOffset = true;
                     identifier = byValInfo->cachedId;
                     ASSERT(identifier.isSymbolCell());
@@ -6299,6 +6307,25 @@ void ByteCodeParser::parseBlock(unsigned limit)
                 }
             }
 
+            // When the baseline JIT has not cached this access yet, fall back to the private name the
+            // LLInt cached. The status then comes from the LLInt cache or from upper tier ICs.
+            if (!baselineHasCache && !hasExitSite) {
+                JSCell* cachedProperty = bytecode.metadata(codeBlock).m_property.get();
+                if (cachedProperty && cachedProperty->isSymbol()) {
+                    tryCompileAsPutByOffset = true;
+                    identifier = CacheableIdentifier::createFromCell(cachedProperty);
+                    identifierNumber = m_graph.identifiers().ensure(identifier.uid());
+                    UniquedStringImpl* uid = m_graph.identifiers()[identifierNumber];
+                    FrozenValue* frozen = m_graph.freezeStrong(cachedProperty);
+
+                    addToGraph(CheckIsConstant, OpInfo(frozen), property);
+
+                    putByIdStatus = PutByIdStatus::computeFor(
+                        m_inlineStackTop->m_profiledBlock, m_inlineStackTop->m_baselineMap,
+                        m_icContextStack, currentCodeOrigin(), uid);
+                }
+            }
+
             if (tryCompileAsPutByOffset)
                 handlePutPrivateNameById(base, identifier, identifierNumber, value, putByIdStatus, bytecode.m_putKind);
             else
@@ -6515,8 +6542,10 @@ void ByteCodeParser::parseBlock(unsigned limit)
         case op_profile_type: {
             auto bytecode = currentInstruction->as<OpProfileType>();
             auto& metadata = bytecode.metadata(codeBlock);
-            Node* valueToProfile = get(bytecode.m_targetVirtualRegister);
-            addToGraph(ProfileType, OpInfo(metadata.m_typeLocation), valueToProfile);
+            if (metadata.m_typeLocation->m_isSampledInJIT) {
+                Node* valueToProfile = get(bytecode.m_targetVirtualRegister);
+                addToGraph(ProfileType, OpInfo(metadata.m_typeLocation), valueToProfile);
+            }
             NEXT_OPCODE(op_profile_type);
         }
 
@@ -6543,7 +6572,11 @@ void ByteCodeParser::parseBlock(unsigned limit)
             auto bytecode = currentInstruction->as<OpJtrue>();
             unsigned relativeOffset = jumpTarget(bytecode.m_targetLabel);
             Node* condition = get(bytecode.m_condition);
-            addToGraph(Branch, OpInfo(branchData(m_currentIndex.offset() + relativeOffset, m_currentIndex.offset() + currentInstruction->size())), condition);
+            auto& metadata = bytecode.metadata(codeBlock);
+            BranchData* data = branchData(m_currentIndex.offset() + relativeOffset, m_currentIndex.offset() + currentInstruction->size());
+            data->taken.profiledCount = metadata.m_takenCount;
+            data->notTaken.profiledCount = metadata.m_notTakenCount;
+            addToGraph(Branch, OpInfo(data), condition);
             LAST_OPCODE(op_jtrue);
         }
 
@@ -6551,7 +6584,12 @@ void ByteCodeParser::parseBlock(unsigned limit)
             auto bytecode = currentInstruction->as<OpJfalse>();
             unsigned relativeOffset = jumpTarget(bytecode.m_targetLabel);
             Node* condition = get(bytecode.m_condition);
-            addToGraph(Branch, OpInfo(branchData(m_currentIndex.offset() + currentInstruction->size(), m_currentIndex.offset() + relativeOffset)), condition);
+            auto& metadata = bytecode.metadata(codeBlock);
+            BranchData* data = branchData(m_currentIndex.offset() + currentInstruction->size(), m_currentIndex.offset() + relativeOffset);
+            // The Branch is taken when the condition is true, which is when op_jfalse falls through.
+            data->taken.profiledCount = metadata.m_notTakenCount;
+            data->notTaken.profiledCount = metadata.m_takenCount;
+            addToGraph(Branch, OpInfo(data), condition);
             LAST_OPCODE(op_jfalse);
         }
 
@@ -7042,7 +7080,7 @@ void ByteCodeParser::parseBlock(unsigned limit)
         case op_iterator_open: {
             auto bytecode = currentInstruction->as<OpIteratorOpen>();
             auto& metadata = bytecode.metadata(codeBlock);
-            uint32_t seenModes = metadata.m_iterationMetadata.seenModes;
+            uint32_t seenModes = iterationModesToCompile(metadata.m_iterationMetadata.seenModes);
 
             unsigned numberOfRemainingModes = WTF::bitCount(seenModes);
             ASSERT(numberOfRemainingModes <= numberOfIterationModes);
@@ -7110,6 +7148,71 @@ void ByteCodeParser::parseBlock(unsigned limit)
                 generatedCase = true;
             }
 
+            IterationMode mapOrSetMode = (seenModes & IterationMode::FastMap) ? IterationMode::FastMap : IterationMode::FastSet;
+            if (seenModes & mapOrSetMode) {
+                bool isMap = mapOrSetMode == IterationMode::FastMap;
+                auto& protocolWatchpointSet = isMap ? globalObject->mapIteratorProtocolWatchpointSet() : globalObject->setIteratorProtocolWatchpointSet();
+                JSFunction* symbolIteratorFunction = isMap ? globalObject->mapProtoSymbolIteratorFunction() : globalObject->setProtoSymbolIteratorFunction();
+                if (protocolWatchpointSet.isStillValid() && symbolIteratorFunction) {
+                    m_graph.watchpoints().addLazily(protocolWatchpointSet);
+
+                    FrozenValue* frozenSymbolIteratorFunction = m_graph.freeze(symbolIteratorFunction);
+                    UseKind useKind = isMap ? MapObjectUse : SetObjectUse;
+                    numberOfRemainingModes--;
+                    if (!numberOfRemainingModes) {
+                        addToGraph(CheckIsConstant, OpInfo(frozenSymbolIteratorFunction), symbolIterator);
+                        addToGraph(Check, Edge(get(bytecode.m_iterable), useKind));
+                    } else {
+                        BasicBlock* fastMapOrSetBlock = allocateUntargetableBlock();
+                        genericBlock = allocateUntargetableBlock();
+
+                        Node* isKnownIterFunction = addToGraph(CompareEqPtr, OpInfo(frozenSymbolIteratorFunction), symbolIterator);
+                        Node* isMapOrSet = addToGraph(IsCellWithType, OpInfo(isMap ? JSMapType : JSSetType), get(bytecode.m_iterable));
+
+                        BranchData* branchData = m_graph.m_branchData.add();
+                        branchData->taken = BranchTarget(fastMapOrSetBlock);
+                        branchData->notTaken = BranchTarget(genericBlock);
+
+                        Node* andResult = addToGraph(ArithBitAnd, isMapOrSet, isKnownIterFunction);
+
+                        // We know the ArithBitAnd cannot have effects so it's ok to exit here.
+                        m_exitOK = true;
+                        addToGraph(ExitOK);
+
+                        addToGraph(Branch, OpInfo(branchData), andResult);
+                        flushForTerminal();
+
+                        m_currentBlock = fastMapOrSetBlock;
+                        clearCaches();
+                    }
+
+                    // Map.prototype[Symbol.iterator] is entries() and Set.prototype[Symbol.iterator] is values().
+                    Node* iterable = get(bytecode.m_iterable);
+                    Node* bucket = addToGraph(GetMapBucketHead, Edge(iterable, useKind));
+                    Node* kindNode = jsConstant(jsNumber(static_cast<uint32_t>(isMap ? IterationKind::Entries : IterationKind::Values)));
+                    Node* next = jsConstant(JSValue());
+                    Structure* iteratorStructure = isMap ? globalObject->mapIteratorStructure() : globalObject->setIteratorStructure();
+                    Node* iterator = addToGraph(NewInternalFieldObject, OpInfo(m_graph.registerStructure(iteratorStructure)));
+                    static_assert(static_cast<uint32_t>(JSMapIterator::Field::MapBucket) == static_cast<uint32_t>(JSSetIterator::Field::SetBucket));
+                    static_assert(static_cast<uint32_t>(JSMapIterator::Field::IteratedObject) == static_cast<uint32_t>(JSSetIterator::Field::IteratedObject));
+                    static_assert(static_cast<uint32_t>(JSMapIterator::Field::Kind) == static_cast<uint32_t>(JSSetIterator::Field::Kind));
+                    addToGraph(PutInternalField, OpInfo(static_cast<uint32_t>(JSMapIterator::Field::MapBucket)), iterator, bucket);
+                    addToGraph(PutInternalField, OpInfo(static_cast<uint32_t>(JSMapIterator::Field::IteratedObject)), iterator, iterable);
+                    addToGraph(PutInternalField, OpInfo(static_cast<uint32_t>(JSMapIterator::Field::Kind)), iterator, kindNode);
+                    set(bytecode.m_iterator, iterator);
+
+                    // Set m_next to JSValue() so if we exit between here and iterator_next instruction it knows we are in the fast case.
+                    set(bytecode.m_next, next);
+
+                    m_currentIndex = nextOpcodeIndex();
+                    m_exitOK = true;
+                    processSetLocalQueue();
+
+                    addToGraph(Jump, OpInfo(continuation));
+                    generatedCase = true;
+                }
+            }
+
             m_currentIndex = startIndex;
 
             if (seenModes & IterationMode::Generic) {
@@ -7195,7 +7298,7 @@ void ByteCodeParser::parseBlock(unsigned limit)
         case op_iterator_next: {
             auto bytecode = currentInstruction->as<OpIteratorNext>();
             auto& metadata = bytecode.metadata(codeBlock);
-            uint32_t seenModes = metadata.m_iterationMetadata.seenModes;
+            uint32_t seenModes = iterationModesToCompile(metadata.m_iterationMetadata.seenModes);
 
             unsigned numberOfRemainingModes = WTF::bitCount(seenModes);
             ASSERT(numberOfRemainingModes <= numberOfIterationModes);
@@ -7314,6 +7417,103 @@ void ByteCodeParser::parseBlock(unsigned limit)
                 generatedCase = true;
             }
 
+            IterationMode mapOrSetMode = (seenModes & IterationMode::FastMap) ? IterationMode::FastMap : IterationMode::FastSet;
+            if (seenModes & mapOrSetMode) {
+                bool isMap = mapOrSetMode == IterationMode::FastMap;
+                auto& protocolWatchpointSet = isMap ? globalObject->mapIteratorProtocolWatchpointSet() : globalObject->setIteratorProtocolWatchpointSet();
+                if (protocolWatchpointSet.isStillValid()) {
+                    m_graph.watchpoints().addLazily(protocolWatchpointSet);
+
+                    if (numberOfRemainingModes != 1) {
+                        Node* hasNext = addToGraph(IsEmpty, get(bytecode.m_next));
+                        genericBlock = allocateUntargetableBlock();
+                        BasicBlock* fastMapOrSetBlock = allocateUntargetableBlock();
+
+                        BranchData* branchData = m_graph.m_branchData.add();
+                        branchData->taken = BranchTarget(fastMapOrSetBlock);
+                        branchData->notTaken = BranchTarget(genericBlock);
+                        addToGraph(Branch, OpInfo(branchData), hasNext);
+
+                        m_currentBlock = fastMapOrSetBlock;
+                        clearCaches();
+                    } else
+                        addToGraph(CheckIsConstant, OpInfo(m_graph.freeze(JSValue())), get(bytecode.m_next));
+
+                    Structure* iteratorStructure = isMap ? globalObject->mapIteratorStructure() : globalObject->setIteratorStructure();
+                    BucketOwnerType ownerType = isMap ? BucketOwnerType::Map : BucketOwnerType::Set;
+                    FrozenValue* sentinel = m_graph.freeze(isMap ? m_vm->sentinelMapBucket() : m_vm->sentinelSetBucket());
+                    uint32_t bucketField = static_cast<uint32_t>(JSMapIterator::Field::MapBucket);
+                    addToGraph(CheckStructure, OpInfo(m_graph.addStructureSet(iteratorStructure)), get(bytecode.m_iterator));
+
+                    BasicBlock* isDoneBlock = allocateUntargetableBlock();
+                    BasicBlock* doLoadBlock = allocateUntargetableBlock();
+
+                    auto prediction = getPredictionWithoutOSRExit(BytecodeIndex(m_currentIndex.offset(), OpIteratorNext::getValue));
+
+                    // The bucket is read again in each successor rather than carried across blocks. We only
+                    // advance the iterator once nothing left in this bytecode can exit.
+                    auto loadNextBucket = [&] {
+                        Node* bucket = addToGraph(GetInternalField, OpInfo(bucketField), OpInfo(SpecCellOther), get(bytecode.m_iterator));
+                        return addToGraph(GetMapBucketNext, OpInfo(ownerType), bucket);
+                    };
+
+                    {
+                        Node* isDone = addToGraph(CompareEqPtr, OpInfo(sentinel), loadNextBucket());
+                        BranchData* branchData = m_graph.m_branchData.add();
+                        branchData->taken = BranchTarget(isDoneBlock);
+                        branchData->notTaken = BranchTarget(doLoadBlock);
+                        addToGraph(Branch, OpInfo(branchData), isDone);
+                    }
+
+                    {
+                        m_currentBlock = doLoadBlock;
+                        clearCaches();
+                        Node* bucket = loadNextBucket();
+                        Node* value;
+                        if (isMap) {
+                            // for-of over a Map yields [key, value] pairs.
+                            addVarArgChild(addToGraph(LoadKeyFromMapBucket, OpInfo(BucketOwnerType::Map), OpInfo(SpecHeapTop), bucket));
+                            addVarArgChild(addToGraph(LoadValueFromMapBucket, OpInfo(BucketOwnerType::Map), OpInfo(SpecHeapTop), bucket));
+                            value = addToGraph(Node::VarArg, NewArray, OpInfo(ArrayWithContiguous), OpInfo(2));
+                        } else
+                            value = addToGraph(LoadKeyFromMapBucket, OpInfo(BucketOwnerType::Set), OpInfo(prediction), bucket);
+                        set(bytecode.m_value, value);
+                        set(bytecode.m_done, jsConstant(jsBoolean(false)));
+                        addToGraph(PutInternalField, OpInfo(bucketField), get(bytecode.m_iterator), bucket);
+
+                        // Do our set locals. We don't want to advance the iterator again so we move to the next bytecode.
+                        m_currentIndex = nextOpcodeIndex();
+                        m_exitOK = true;
+                        processSetLocalQueue();
+
+                        addToGraph(Jump, OpInfo(continuation));
+                    }
+
+                    // Roll back the checkpoint.
+                    m_currentIndex = startIndex;
+
+                    {
+                        m_currentBlock = isDoneBlock;
+                        clearCaches();
+                        Node* bottomNode = jsConstant(m_graph.bottomValueMatchingSpeculation(prediction));
+
+                        set(bytecode.m_value, bottomNode);
+                        set(bytecode.m_done, jsConstant(jsBoolean(true)));
+                        addToGraph(PutInternalField, OpInfo(bucketField), get(bytecode.m_iterator), jsConstant(sentinel));
+
+                        // Do our set locals. We don't want to run this again so we have to move the exit origin forward.
+                        m_currentIndex = nextOpcodeIndex();
+                        m_exitOK = true;
+                        processSetLocalQueue();
+
+                        addToGraph(Jump, OpInfo(continuation));
+                    }
+
+                    m_currentIndex = startIndex;
+                    generatedCase = true;
+                }
+            }
+
             if (seenModes & IterationMode::Generic) {
                 if (genericBlock) {
                     ASSERT(generatedCase);
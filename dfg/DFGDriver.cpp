@@ -85,6 +85,9 @@ static CompilationResult compileImpl(
     vm.getCTIStub(throwExceptionFromCallSlowPathGenerator);
     vm.getCTIStub(linkCallThunkGenerator);
     vm.getCTIStub(linkPolymorphicCallThunkGenerator);
+    vm.getCTIStub(virtualCallThunkGenerator);
+    vm.getCTIStub(virtualTailCallThunkGenerator);
+    vm.getCTIStub(virtualConstructThunkGenerator);
     
     if (vm.typeProfiler())
         vm.typeProfilerLog()->processLogEntries(vm, "Preparing for DFG compilation."_s);
@@ -322,8 +322,14 @@ void JITCompiler::link(LinkBuffer& linkBuffer)
         }
     }
 
-    if (m_pcToCodeOriginMapBuilder.didBuildMapping())
-        m_codeBlock->setPCToCodeOriginMap(makeUnique<PCToCodeOriginMap>(WTFMove(m_pcToCodeOriginMapBuilder), linkBuffer));
+    if (m_pcToCodeOriginMapBuilder.didBuildMapping()) {
+        auto map = makeUnique<PCToCodeOriginMap>(WTFMove(m_pcToCodeOriginMapBuilder), linkBuffer);
+#if OS(LINUX)
+        if (UNLIKELY(Options::logJITCodeForPerf()))
+            map->recordDebugInfoForPerf(m_codeBlock, linkBuffer);
+#endif
+        m_codeBlock->setPCToCodeOriginMap(WTFMove(map));
+    }
 }
 
 static void emitStackOverflowCheck(JITCompiler& jit, MacroAssembler::JumpList& stackOverflow)
@@ -141,12 +141,14 @@ struct BranchTarget {
     BranchTarget()
         : block(nullptr)
         , count(PNaN)
+        , profiledCount(PNaN)
     {
     }
     
     explicit BranchTarget(BasicBlock* block)
         : block(block)
         , count(PNaN)
+        , profiledCount(PNaN)
     {
     }
     
@@ -160,6 +162,8 @@ struct BranchTarget {
     
     BasicBlock* block;
     float count;
+    // How many times the profiling tiers went to this target, or NaN if the branch is not profiled.
+    float profiledCount;
 };
 
 struct BranchData {
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "DFGOSREntryRegionRestrictionPhase.h"
+
+#if ENABLE(DFG_JIT)
+
+#include "DFGBlockSet.h"
+#include "DFGGraph.h"
+#include "DFGInsertionSet.h"
+#include "DFGNaturalLoops.h"
+#include "DFGPhase.h"
+#include "JSCJSValueInlines.h"
+
+namespace JSC { namespace DFG {
+
+namespace DFGOSREntryRegionRestrictionPhaseInternal {
+static constexpr bool verbose = false;
+}
+
+class OSREntryRegionRestrictionPhase : public Phase {
+public:
+    OSREntryRegionRestrictionPhase(Graph& graph)
+        : Phase(graph, "OSR entry region restriction")
+    {
+    }
+
+    bool run()
+    {
+        RELEASE_ASSERT(m_graph.m_plan.mode() == FTLForOSREntryMode);
+        RELEASE_ASSERT(m_graph.m_form == ThreadedCPS);
+
+        BasicBlock* target = findOSREntryTarget();
+        if (!target)
+            return false;
+
+        m_graph.ensureCPSNaturalLoops();
+        const CPSNaturalLoop* loop = m_graph.m_cpsNaturalLoops->headerOf(target);
+        if (!loop)
+            return false;
+
+        BlockSet region;
+        for (unsigned i = loop->size(); i--;)
+            region.add(loop->at(i).node());
+
+        BlockSet exitTargets;
+        for (unsigned i = loop->size(); i--;) {
+            BasicBlock* block = loop->at(i).node();
+            for (BasicBlock* successor : block->successors()) {
+                if (!region.contains(successor))
+                    exitTargets.add(successor);
+            }
+        }
+
+        bool changed = false;
+        InsertionSet insertionSet(m_graph);
+        for (BasicBlock* block : exitTargets.iterable(m_graph)) {
+            // We can only exit at a node that is allowed to exit. If there is none, the block's
+            // code simply stays in the compile.
+            for (unsigned nodeIndex = 0; nodeIndex < block->size(); ++nodeIndex) {
+                NodeOrigin origin = block->at(nodeIndex)->origin;
+                if (!origin.exitOK)
+                    continue;
+                dataLogLnIf(DFGOSREntryRegionRestrictionPhaseInternal::verbose, "Exiting the OSR entry region at ", *block);
+                insertionSet.insertNode(nodeIndex, SpecNone, ForceOSRExit, origin);
+                insertionSet.execute(block);
+                changed = true;
+                break;
+            }
+        }
+
+        return changed;
+    }
+
+private:
+    BasicBlock* findOSREntryTarget()
+    {
+        BytecodeIndex bytecodeIndex = m_graph.m_plan.osrEntryBytecodeIndex();
+        for (BasicBlock* block : m_graph.blocksInNaturalOrder()) {
+            unsigned nodeIndex = 0;
+            Node* firstNode = block->at(0);
+            while (firstNode->isSemanticallySkippable())
+                firstNode = block->at(++nodeIndex);
+            if (firstNode->op() == LoopHint
+                && firstNode->origin.semantic == CodeOrigin(bytecodeIndex))
+                return block;
+        }
+        return nullptr;
+    }
+};
+
+bool performOSREntryRegionRestriction(Graph& graph)
+{
+    return runPhase<OSREntryRegionRestrictionPhase>(graph);
+}
+
+} } // namespace JSC::DFG
+
+#endif // ENABLE(DFG_JIT)
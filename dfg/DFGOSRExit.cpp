@@ -41,6 +41,7 @@
 #include "JSCJSValueInlines.h"
 #include "OperandsInlines.h"
 #include "ProbeContext.h"
+#include "USDTProbes.h"
 
 #include <wtf/Scope.h>
 
@@ -164,6 +165,7 @@ JSC_DEFINE_JIT_OPERATION(operationCompileOSRExit, void, (CallFrame* callFrame))
 
     uint32_t exitIndex = vm.osrExitIndex;
     OSRExit& exit = codeBlock->jitCode()->dfg()->osrExit[exitIndex];
+    JSC_USDT_PROBE3(osr__exit__compile, static_cast<int>(JITType::DFGJIT), codeBlock, exitIndex);
 
     ASSERT(!vm.callFrameForCatch || exit.m_kind == GenericUnwind);
     EXCEPTION_ASSERT_UNUSED(scope, !!scope.exception() || !exit.isExceptionHandler());
@@ -40,6 +40,8 @@ namespace JSC { namespace DFG {
 
 void handleExitCounts(VM& vm, CCallHelpers& jit, const OSRExitBase& exit)
 {
+    jit.add64(AssemblyHelpers::TrustedImm32(1), AssemblyHelpers::AbsoluteAddress(vm.runtimeCounters().addressOfOSRExitCount(exit.m_kind)));
+
     if (!exitKindMayJettison(exit.m_kind)) {
         // FIXME: We may want to notice that we're frequently exiting
         // at an op_catch that we didn't compile an entrypoint for, and
@@ -26,6 +26,7 @@
 #include "config.h"
 #include "DFGOperations.h"
 
+#include "ArraySearch.h"
 #include "ButterflyInlines.h"
 #include "CacheableIdentifierInlines.h"
 #include "ClonedArguments.h"
@@ -39,6 +40,7 @@
 #include "DateInstance.h"
 #include "DefinePropertyAttributes.h"
 #include "DirectArguments.h"
+#include "FTLCapabilities.h"
 #include "FTLForOSREntryJITCode.h"
 #include "FTLOSREntry.h"
 #include "FrameTracers.h"
@@ -2839,6 +2841,12 @@ JSC_DEFINE_JIT_OPERATION(operationArrayIndexOfValueInt32OrContiguous, UCPUStrict
 
     int32_t length = butterfly->publicLength();
     auto data = butterfly->contiguous().data();
+    if (isBitwiseStrictEqualityCandidate(searchElement)) {
+        if (index >= length)
+            return toUCPUStrictInt32(-1);
+        size_t result = arraySearchForward(bitwise_cast<const EncodedJSValue*>(data), index, length, encodedValue);
+        return toUCPUStrictInt32(result == notFound ? -1 : static_cast<int32_t>(result));
+    }
     for (; index < length; ++index) {
         JSValue value = data[index].get();
         if (!value)
@@ -2864,13 +2872,11 @@ JSC_DEFINE_JIT_OPERATION(operationArrayIndexOfValueDouble, UCPUStrictInt32, (JSG
     double number = searchElement.asNumber();
 
     int32_t length = butterfly->publicLength();
-    const double* data = butterfly->contiguousDouble().data();
-    for (; index < length; ++index) {
-        // This comparison ignores NaN.
-        if (data[index] == number)
-            return toUCPUStrictInt32(index);
-    }
-    return toUCPUStrictInt32(-1);
+    if (index >= length)
+        return toUCPUStrictInt32(-1);
+    // This comparison ignores NaN.
+    size_t result = arraySearchForward(butterfly->contiguousDouble().data(), index, length, number);
+    return toUCPUStrictInt32(result == notFound ? -1 : static_cast<int32_t>(result));
 }
 
 JSC_DEFINE_JIT_OPERATION(operationLoadVarargs, void, (JSGlobalObject* globalObject, int32_t firstElementDest, EncodedJSValue encodedArguments, uint32_t offset, uint32_t lengthIncludingThis, uint32_t mandatoryMinimum))
@@ -3033,11 +3039,9 @@ JSC_DEFINE_JIT_OPERATION(operationNewArrayWithSpreadSlow, JSCell*, (JSGlobalObje
         JSValue value = JSValue::decode(values[i]);
         if (JSImmutableButterfly* array = jsDynamicCast<JSImmutableButterfly*>(vm, value)) {
             // We are spreading.
-            for (unsigned i = 0; i < array->publicLength(); i++) {
-                result->putDirectIndex(globalObject, index, array->get(i));
-                RETURN_IF_EXCEPTION(scope, nullptr);
-                ++index;
-            }
+            CommonSlowPaths::copySpreadIntoNewArray(globalObject, result, index, array);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            index += array->publicLength();
         } else {
             // We are not spreading.
             result->putDirectIndex(globalObject, index, value);
@@ -3659,6 +3663,12 @@ static bool shouldTriggerFTLCompile(CodeBlock* codeBlock, JITCode* jitCode)
 
 static void triggerFTLReplacementCompile(VM& vm, CodeBlock* codeBlock, JITCode* jitCode)
 {
+    if (FTL::canCompileOnlyLoopRegions(codeBlock->baselineVersion())) {
+        CODEBLOCK_LOG_EVENT(codeBlock, "delayFTLCompile", ("only loop regions can be compiled"));
+        jitCode->setOptimizationThresholdBasedOnCompilationResult(codeBlock, CompilationDeferred);
+        return;
+    }
+
     if (codeBlock->codeType() == GlobalCode) {
         // Global code runs once, so we don't want to do anything. We don't want to defer indefinitely,
         // since this may have been spuriously called from tier-up initiated in a loop, and that loop may
@@ -3854,7 +3864,7 @@ static char* tierUpCommon(VM& vm, CallFrame* callFrame, BytecodeIndex originByte
     if (!shouldTriggerFTLCompile(codeBlock, jitCode) && !triggeredSlowPathToStartCompilation)
         return nullptr;
 
-    if (!jitCode->neverExecutedEntry && !triggeredSlowPathToStartCompilation) {
+    if (!jitCode->neverExecutedEntry && !triggeredSlowPathToStartCompilation && !FTL::canCompileOnlyLoopRegions(codeBlock->baselineVersion())) {
         triggerFTLReplacementCompile(vm, codeBlock, jitCode);
 
         if (!codeBlock->hasOptimizedReplacement())
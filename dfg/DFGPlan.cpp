@@ -35,6 +35,7 @@
 #include "DFGCFGSimplificationPhase.h"
 #include "DFGCPSRethreadingPhase.h"
 #include "DFGCSEPhase.h"
+#include "DFGCheckTrapsEliminationPhase.h"
 #include "DFGCleanUpPhase.h"
 #include "DFGConstantFoldingPhase.h"
 #include "DFGConstantHoistingPhase.h"
@@ -52,6 +53,7 @@
 #include "DFGLivenessAnalysisPhase.h"
 #include "DFGLoopPreHeaderCreationPhase.h"
 #include "DFGOSRAvailabilityAnalysisPhase.h"
+#include "DFGOSREntryRegionRestrictionPhase.h"
 #include "DFGOSREntrypointCreationPhase.h"
 #include "DFGObjectAllocationSinkingPhase.h"
 #include "DFGPhantomInsertionPhase.h"
@@ -77,6 +79,7 @@
 #include "OperandsInlines.h"
 #include "ProfilerDatabase.h"
 #include "TrackedReferences.h"
+#include "USDTProbes.h"
 #include "VMInlines.h"
 
 #if ENABLE(FTL_JIT)
@@ -159,6 +162,7 @@ bool Plan::computeCompileTimes() const
 {
     return reportCompileTimes()
         || Options::reportTotalCompileTimes()
+        || Options::collectCompilerPhaseStatistics()
         || (m_vm && m_vm->m_perBytecodeProfiler);
 }
 
@@ -185,7 +189,9 @@ void Plan::compileInThread(ThreadData* threadData)
     if (logCompilationChanges(m_mode) || Options::logPhaseTimes())
         dataLog("DFG(Plan) compiling ", *m_codeBlock, " with ", m_mode, ", instructions size = ", m_codeBlock->instructionsSize(), "\n");
 
+    JSC_USDT_PROBE2(dfg__compile__start, static_cast<int>(m_mode), m_codeBlock);
     CompilationPath path = compileInThreadImpl();
+    JSC_USDT_PROBE3(dfg__compile__end, static_cast<int>(m_mode), m_codeBlock, static_cast<int>(path));
 
     RELEASE_ASSERT(path == CancelPath || m_finalizer);
     RELEASE_ASSERT((path == CancelPath) == (m_stage == Cancelled));
@@ -202,6 +208,8 @@ void Plan::compileInThread(ThreadData* threadData)
             } else
                 totalDFGCompileTime += after - before;
         }
+        if (path != CancelPath)
+            recordCompilerTime(isFTL() ? "FTL" : "DFG", "total compile", after - before);
     }
     const char* pathName = nullptr;
     switch (path) {
@@ -306,6 +314,10 @@ Plan::CompilationPath Plan::compileInThreadImpl()
             return FailPath;
         }
         RUN_PHASE(performCPSRethreading);
+#if ENABLE(FTL_JIT)
+        if (FTL::canCompileOnlyLoopRegions(dfg.m_profiledBlock))
+            RUN_PHASE(performOSREntryRegionRestriction);
+#endif
     }
     
     if (validationEnabled())
@@ -333,6 +345,7 @@ Plan::CompilationPath Plan::compileInThreadImpl()
     RUN_PHASE(performConstantFolding);
     changed = false;
     RUN_PHASE(performCFGSimplification);
+    RUN_PHASE(performCheckTrapsElimination);
     RUN_PHASE(performLocalCSE);
     
     if (validationEnabled())
@@ -115,6 +115,9 @@ public:
     DeferredCompilationCallback* callback() const { return m_callback.get(); }
     void setCallback(Ref<DeferredCompilationCallback>&& callback) { m_callback = WTFMove(callback); }
 
+    MonotonicTime timeEnqueued() const { return m_timeEnqueued; }
+    void setTimeEnqueued(MonotonicTime timeEnqueued) { m_timeEnqueued = timeEnqueued; }
+
 private:
     bool computeCompileTimes() const;
     bool reportCompileTimes() const;
@@ -167,6 +170,7 @@ private:
     RefPtr<DeferredCompilationCallback> m_callback;
 
     MonotonicTime m_timeBeforeFTL;
+    MonotonicTime m_timeEnqueued;
 };
 
 #endif // ENABLE(DFG_JIT)
@@ -10082,6 +10082,28 @@ void SpeculativeJIT::compileCallDOM(Node* node)
     // https://bugs.webkit.org/show_bug.cgi?id=203204
     auto function = CFunctionPtr(signature->functionWithoutTypeCheck);
     unsigned argumentCountIncludingThis = signature->argumentCount + 1;
+    if (signature->functionData) {
+        // The data pointer is immortal, so it is safe to embed it directly.
+        TrustedImmPtr functionData(signature->functionData);
+        switch (argumentCountIncludingThis) {
+        case 1:
+            callOperation(reinterpret_cast<J_JITOperation_GPP>(function.get()), extractResult(resultRegs), TrustedImmPtr::weakPointer(m_graph, m_graph.globalObjectFor(node->origin.semantic)), regs[0], functionData);
+            break;
+        case 2:
+            callOperation(reinterpret_cast<J_JITOperation_GPPP>(function.get()), extractResult(resultRegs), TrustedImmPtr::weakPointer(m_graph, m_graph.globalObjectFor(node->origin.semantic)), regs[0], regs[1], functionData);
+            break;
+        case 3:
+            callOperation(reinterpret_cast<J_JITOperation_GPPPP>(function.get()), extractResult(resultRegs), TrustedImmPtr::weakPointer(m_graph, m_graph.globalObjectFor(node->origin.semantic)), regs[0], regs[1], regs[2], functionData);
+            break;
+        default:
+            RELEASE_ASSERT_NOT_REACHED();
+            break;
+        }
+        m_jit.exceptionCheck();
+        jsValueResult(resultRegs, node);
+        return;
+    }
+
     switch (argumentCountIncludingThis) {
     case 1:
         callOperation(reinterpret_cast<J_JITOperation_GP>(function.get()), extractResult(resultRegs), TrustedImmPtr::weakPointer(m_graph, m_graph.globalObjectFor(node->origin.semantic)), regs[0]);
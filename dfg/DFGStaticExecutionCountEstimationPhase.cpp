@@ -67,6 +67,8 @@ public:
             switch (terminal->op()) {
             case Branch: {
                 BranchData* data = terminal->branchData();
+                if (applyProfiledCounts(block, *data))
+                    break;
                 applyCounts(data->taken);
                 applyCounts(data->notTaken);
                 break;
@@ -98,6 +100,28 @@ private:
     {
         target.count = target.block->executionCount;
     }
+
+    // Splits the block's estimated execution count between the two sides of the branch using the
+    // directions recorded by the LLInt and Baseline JIT. A side that was never taken gets a weight
+    // of zero, which B3 treats as rare and lays out of line.
+    bool applyProfiledCounts(BasicBlock* block, BranchData& data)
+    {
+        if (!Options::useProfiledBranchWeights())
+            return false;
+
+        float taken = data.taken.profiledCount;
+        float notTaken = data.notTaken.profiledCount;
+        if (!(taken == taken) || !(notTaken == notTaken))
+            return false;
+
+        float total = taken + notTaken;
+        if (total < Options::minimumProfiledBranchCount() || data.taken.block == data.notTaken.block)
+            return false;
+
+        data.taken.count = block->executionCount * (taken / total);
+        data.notTaken.count = block->executionCount * (notTaken / total);
+        return true;
+    }
 };
 
 bool performStaticExecutionCountEstimation(Graph& graph)
@@ -83,6 +83,10 @@ public:
         if (!Options::useOSREntryToFTL())
             level = FTL::CanCompile;
         
+        // Only loops of such code blocks can be FTL compiled, so there is no point in tiering up
+        // at function returns.
+        bool onlyLoopRegions = FTL::canCompileOnlyLoopRegions(m_graph.m_profiledBlock);
+
         m_graph.ensureCPSNaturalLoops();
         CPSNaturalLoops& naturalLoops = *m_graph.m_cpsNaturalLoops;
         HashMap<const NaturalLoop*, BytecodeIndex> naturalLoopToLoopHint = buildNaturalLoopToLoopHintMap(naturalLoops);
@@ -128,7 +132,7 @@ public:
             }
 
             NodeAndIndex terminal = block->findTerminal();
-            if (terminal.node->isFunctionTerminal()) {
+            if (terminal.node->isFunctionTerminal() && !onlyLoopRegions) {
                 insertionSet.insertNode(
                     terminal.index, SpecNone, CheckTierUpAtReturn, terminal.node->origin);
             }
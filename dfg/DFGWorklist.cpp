@@ -26,6 +26,8 @@
 #include "config.h"
 #include "DFGWorklist.h"
 
+#include "CodeBlock.h"
+#include "CompilerTimingScope.h"
 #include "DFGSafepoint.h"
 #include "DeferGC.h"
 #include "JSCellInlines.h"
@@ -58,7 +60,7 @@ private:
         if (m_worklist.m_queue.isEmpty())
             return PollResult::Wait;
         
-        m_plan = m_worklist.m_queue.takeFirst();
+        m_plan = m_worklist.takeNextPlan(locker);
         if (!m_plan) {
             if (Options::verboseCompilationQueue()) {
                 m_worklist.dump(locker, WTF::dataFile());
@@ -106,6 +108,9 @@ private:
         }
         
         dataLogLnIf(Options::verboseCompilationQueue(), m_worklist, ": Compiling ", m_plan->key(), " asynchronously");
+        Seconds queueLatency = MonotonicTime::now() - m_plan->timeEnqueued();
+        dataLogLnIf(Options::reportCompilationQueueLatency(), m_worklist.m_threadName, ": ", m_plan->key(), " waited ", queueLatency.milliseconds(), " ms in the queue");
+        recordCompilerTime(m_plan->isFTL() ? "FTL" : "DFG", "queue wait", queueLatency);
         
         // There's no way for the GC to be safepointing since we own rightToRun.
         if (m_plan->vm()->heap.worldIsStopped()) {
@@ -240,11 +245,46 @@ void Worklist::enqueue(Ref<Plan>&& plan)
         dataLog(": Enqueueing plan to optimize ", plan->key(), "\n");
     }
     ASSERT(m_plans.find(plan->key()) == m_plans.end());
+    plan->setTimeEnqueued(MonotonicTime::now());
     m_plans.add(plan->key(), plan.copyRef());
     m_queue.append(WTFMove(plan));
     m_planEnqueued->notifyOne(locker);
 }
 
+RefPtr<Plan> Worklist::takeNextPlan(const AbstractLocker&)
+{
+    // A null plan asks a thread to stop, and is taken in order like any other plan.
+    RefPtr<Plan>& first = m_queue.first();
+    if (!Options::useCostAwareCompilationQueue() || !first)
+        return m_queue.takeFirst();
+
+    // Cheap compiles go first so that a burst of large compiles does not delay code that would pay
+    // off sooner. A plan that has already waited too long is taken in order, so nothing starves.
+    MonotonicTime now = MonotonicTime::now();
+    if (now - first->timeEnqueued() >= Seconds::fromMilliseconds(Options::maximumCompilationQueueDelayMilliseconds()))
+        return m_queue.takeFirst();
+
+    auto costOf = [] (Plan& plan) -> unsigned {
+        CodeBlock* codeBlock = plan.codeBlock();
+        return codeBlock ? codeBlock->bytecodeCost() : 0;
+    };
+
+    auto best = m_queue.begin();
+    unsigned bestCost = costOf(**best);
+    for (auto iter = m_queue.begin(); iter != m_queue.end(); ++iter) {
+        if (!*iter)
+            break;
+        unsigned cost = costOf(**iter);
+        if (cost < bestCost) {
+            best = iter;
+            bestCost = cost;
+        }
+    }
+    RefPtr<Plan> result = WTFMove(*best);
+    m_queue.remove(best);
+    return result;
+}
+
 Worklist::State Worklist::compilationState(CompilationKey key)
 {
     LockHolder locker(*m_lock);
@@ -93,6 +93,7 @@ private:
     static void threadFunction(void* argument);
     
     void removeAllReadyPlansForVM(VM&, Vector<RefPtr<Plan>, 8>&);
+    RefPtr<Plan> takeNextPlan(const AbstractLocker&);
 
     void dump(const AbstractLocker&, PrintStream&) const;
     
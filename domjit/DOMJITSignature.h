@@ -52,12 +52,27 @@ public:
     {
     }
 
+    // Signatures built at runtime (for example, for API fast callbacks) can carry an opaque pointer that
+    // the JIT passes as an extra trailing argument to functionWithoutTypeCheck.
+    template<typename... Arguments>
+    constexpr Signature(CFunctionPtr functionWithoutTypeCheck, const void* functionData, const ClassInfo* classInfo, Effect effect, SpeculatedType result, Arguments... arguments)
+        : functionWithoutTypeCheck(functionWithoutTypeCheck.get())
+        , classInfo(classInfo)
+        , result(result)
+        , arguments {static_cast<SpeculatedType>(arguments)...}
+        , argumentCount(sizeof...(Arguments))
+        , effect(effect)
+        , functionData(functionData)
+    {
+    }
+
     const FunctionPtr functionWithoutTypeCheck;
     const ClassInfo* const classInfo;
     const SpeculatedType result;
     const SpeculatedType arguments[JSC_DOMJIT_SIGNATURE_MAX_ARGUMENTS];
     const unsigned argumentCount;
     const Effect effect;
+    const void* const functionData { nullptr };
 };
 
 } }
@@ -33,7 +33,11 @@
 #include "JSLock.h"
 #include "JSObject.h"
 #include "VM.h"
+#include <JavaScriptCore/JavaScript.h>
 #include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/Vector.h>
 #include <wtf/text/StringCommon.h>
 
 using namespace JSC;
@@ -43,6 +47,8 @@ namespace {
 Lock crashLock;
 const char* nameFilter;
 unsigned requestedIterationCount;
+unsigned runCount = 5;
+bool shouldOutputJSON;
 
 #define CHECK(x) do {                                                   \
         if (!!(x))                                                      \
@@ -52,6 +58,28 @@ unsigned requestedIterationCount;
         CRASH();                                                        \
     } while (false)
 
+struct BenchmarkResult {
+    const char* name;
+    unsigned iterationCount;
+    double medianMilliseconds;
+    double p95Milliseconds;
+    double minMilliseconds;
+    double maxMilliseconds;
+};
+
+Vector<BenchmarkResult>& benchmarkResults()
+{
+    static NeverDestroyed<Vector<BenchmarkResult>> results;
+    return results;
+}
+
+// Nearest-rank percentile of already sorted run times.
+double percentile(const Vector<double>& sortedTimes, double fraction)
+{
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sortedTimes.size()));
+    return sortedTimes[std::min(std::max<size_t>(rank, 1), sortedTimes.size()) - 1];
+}
+
 template<typename Callback>
 NEVER_INLINE void benchmarkImpl(const char* name, unsigned iterationCount, const Callback& callback)
 {
@@ -60,28 +88,189 @@ NEVER_INLINE void benchmarkImpl(const char* name, unsigned iterationCount, const
 
     if (requestedIterationCount)
         iterationCount = requestedIterationCount;
-    
-    MonotonicTime before = MonotonicTime::now();
+
+    // The first run warms up allocators, inline caches and the JITs, and is not reported.
     callback(iterationCount);
-    MonotonicTime after = MonotonicTime::now();
-    dataLog(name, ": ", (after - before).milliseconds(), " ms.\n");
+
+    Vector<double> times;
+    for (unsigned run = 0; run < runCount; ++run) {
+        MonotonicTime before = MonotonicTime::now();
+        callback(iterationCount);
+        MonotonicTime after = MonotonicTime::now();
+        times.append((after - before).milliseconds());
+    }
+    std::sort(times.begin(), times.end());
+
+    BenchmarkResult result { name, iterationCount, percentile(times, 0.5), percentile(times, 0.95), times.first(), times.last() };
+    benchmarkResults().append(result);
+    if (!shouldOutputJSON)
+        dataLog(name, ": median ", result.medianMilliseconds, " ms, p95 ", result.p95Milliseconds, " ms (", runCount, " runs of ", iterationCount, ").\n");
+}
+
+void dumpResultsAsJSON()
+{
+    dataLog("{\"runs\": ", runCount, ", \"benchmarks\": [");
+    const char* separator = "";
+    for (auto& result : benchmarkResults()) {
+        dataLog(separator, "\n    {\"name\": \"", result.name, "\", \"iterations\": ", result.iterationCount,
+            ", \"medianMs\": ", result.medianMilliseconds, ", \"p95Ms\": ", result.p95Milliseconds,
+            ", \"minMs\": ", result.minMilliseconds, ", \"maxMs\": ", result.maxMilliseconds, "}");
+        separator = ",";
+    }
+    dataLog("\n]}\n");
+}
+
+JSValueRef returnArgumentCount(JSContextRef ctx, JSObjectRef, JSObjectRef, size_t argumentCount, const JSValueRef[], JSValueRef*)
+{
+    return JSValueMakeNumber(ctx, argumentCount);
+}
+
+void runCAPIBenchmarks()
+{
+    JSGlobalContextRef context = JSGlobalContextCreate(nullptr);
+    JSObjectRef globalObject = JSContextGetGlobalObject(context);
+
+    JSStringRef nameF = JSStringCreateWithUTF8CString("f");
+    JSStringRef nameG = JSStringCreateWithUTF8CString("g");
+    JSObjectRef object = JSObjectMake(context, nullptr, nullptr);
+    JSObjectSetProperty(context, object, nameF, JSValueMakeNumber(context, 42), kJSPropertyAttributeNone, nullptr);
+    JSObjectSetProperty(context, object, nameG, JSValueMakeNumber(context, 43), kJSPropertyAttributeNone, nullptr);
+
+    benchmarkImpl(
+        "C API Get Property",
+        1000000,
+        [&] (unsigned iterationCount) {
+            for (unsigned i = iterationCount; i--;) {
+                CHECK(JSValueToNumber(context, JSObjectGetProperty(context, object, nameF, nullptr), nullptr) == 42);
+                CHECK(JSValueToNumber(context, JSObjectGetProperty(context, object, nameG, nullptr), nullptr) == 43);
+            }
+        });
+
+    benchmarkImpl(
+        "C API Set Property Replace",
+        1000000,
+        [&] (unsigned iterationCount) {
+            for (unsigned i = iterationCount; i--;) {
+                JSObjectSetProperty(context, object, nameF, JSValueMakeNumber(context, i), kJSPropertyAttributeNone, nullptr);
+                JSObjectSetProperty(context, object, nameG, JSValueMakeNumber(context, i), kJSPropertyAttributeNone, nullptr);
+            }
+        });
+
+    JSObjectRef callback = JSObjectMakeFunctionWithCallback(context, nameF, returnArgumentCount);
+    JSValueProtect(context, callback);
+    benchmarkImpl(
+        "C API Callback Invocation",
+        1000000,
+        [&] (unsigned iterationCount) {
+            JSValueRef arguments[] = { object, object };
+            for (unsigned i = iterationCount; i--;)
+                CHECK(JSValueToNumber(context, JSObjectCallAsFunction(context, callback, nullptr, WTF_ARRAY_LENGTH(arguments), arguments, nullptr), nullptr) == 2);
+        });
+
+    JSStringRef callbackName = JSStringCreateWithUTF8CString("nativeCallback");
+    JSObjectSetProperty(context, globalObject, callbackName, callback, kJSPropertyAttributeNone, nullptr);
+    JSStringRef callbackLoop = JSStringCreateWithUTF8CString("(function (count) { for (let i = 0; i < count; ++i) nativeCallback(i); })");
+    JSObjectRef callbackLoopFunction = JSValueToObject(context, JSEvaluateScript(context, callbackLoop, nullptr, nullptr, 1, nullptr), nullptr);
+    JSValueProtect(context, callbackLoopFunction);
+    benchmarkImpl(
+        "C API Callback Invocation From JS",
+        1000000,
+        [&] (unsigned iterationCount) {
+            JSValueRef count = JSValueMakeNumber(context, iterationCount);
+            JSObjectCallAsFunction(context, callbackLoopFunction, nullptr, 1, &count, nullptr);
+        });
+
+    benchmarkImpl(
+        "C API String Creation and Conversion",
+        100000,
+        [&] (unsigned iterationCount) {
+            char buffer[64];
+            for (unsigned i = iterationCount; i--;) {
+                JSStringRef string = JSStringCreateWithUTF8CString("The quick brown fox jumps over the lazy dog");
+                JSValueRef value = JSValueMakeString(context, string);
+                JSStringRelease(string);
+                JSStringRef copy = JSValueToStringCopy(context, value, nullptr);
+                CHECK(JSStringGetUTF8CString(copy, buffer, sizeof(buffer)) == 44);
+                JSStringRelease(copy);
+            }
+        });
+
+    benchmarkImpl(
+        "C API Typed Array Creation",
+        100000,
+        [&] (unsigned iterationCount) {
+            for (unsigned i = iterationCount; i--;)
+                CHECK(JSObjectMakeTypedArray(context, kJSTypedArrayTypeUint8Array, 64, nullptr));
+        });
+
+    benchmarkImpl(
+        "C API Value Protect Churn",
+        100000,
+        [&] (unsigned iterationCount) {
+            JSObjectRef objects[16];
+            for (unsigned i = iterationCount; i--;) {
+                for (auto& protectedObject : objects) {
+                    protectedObject = JSObjectMake(context, nullptr, nullptr);
+                    JSValueProtect(context, protectedObject);
+                }
+                for (auto& protectedObject : objects)
+                    JSValueUnprotect(context, protectedObject);
+            }
+        });
+
+    JSContextGroupRef group = JSContextGetGroup(context);
+    benchmarkImpl(
+        "C API Context Creation",
+        1000,
+        [&] (unsigned iterationCount) {
+            for (unsigned i = iterationCount; i--;)
+                JSGlobalContextRelease(JSGlobalContextCreateInGroup(group, nullptr));
+        });
+
+    JSStringRef script = JSStringCreateWithUTF8CString("var total = 0; for (var i = 0; i < 10; ++i) total += i; total");
+    benchmarkImpl(
+        "C API Evaluate Script With Cache Hit",
+        10000,
+        [&] (unsigned iterationCount) {
+            for (unsigned i = iterationCount; i--;)
+                CHECK(JSValueToNumber(context, JSEvaluateScript(context, script, nullptr, nullptr, 1, nullptr), nullptr) == 45);
+        });
+
+    JSStringRelease(script);
+    JSValueUnprotect(context, callbackLoopFunction);
+    JSValueUnprotect(context, callback);
+    JSStringRelease(callbackLoop);
+    JSStringRelease(callbackName);
+    JSStringRelease(nameG);
+    JSStringRelease(nameF);
+    JSGlobalContextRelease(context);
 }
 
 } // anonymous namespace
 
 int main(int argc, char** argv)
 {
-    if (argc >= 2) {
-        if (argv[1][0] == '-') {
-            dataLog("Usage: dynbench [<filter> [<iteration count>]]\n");
+    int argumentIndex = 1;
+    for (; argumentIndex < argc && argv[argumentIndex][0] == '-'; ++argumentIndex) {
+        if (!strcmp(argv[argumentIndex], "--json"))
+            shouldOutputJSON = true;
+        else if (!strcmp(argv[argumentIndex], "--runs") && argumentIndex + 1 < argc) {
+            if (sscanf(argv[++argumentIndex], "%u", &runCount) != 1 || !runCount) {
+                dataLog("Could not parse run count ", argv[argumentIndex], "\n");
+                return 1;
+            }
+        } else {
+            dataLog("Usage: dynbench [--json] [--runs <run count>] [<filter> [<iteration count>]]\n");
             return 1;
         }
+    }
 
-        nameFilter = argv[1];
+    if (argumentIndex < argc) {
+        nameFilter = argv[argumentIndex++];
 
-        if (argc >= 3) {
-            if (sscanf(argv[2], "%u", &requestedIterationCount) != 1) {
-                dataLog("Could not parse iteration count ", argv[2], "\n");
+        if (argumentIndex < argc) {
+            if (sscanf(argv[argumentIndex], "%u", &requestedIterationCount) != 1) {
+                dataLog("Could not parse iteration count ", argv[argumentIndex], "\n");
                 return 1;
             }
         }
@@ -236,6 +425,11 @@ int main(int argc, char** argv)
             });
     }
 
+    runCAPIBenchmarks();
+
+    if (shouldOutputJSON)
+        dumpResultsAsJSON();
+
     crashLock.lock();
     return 0;
 }
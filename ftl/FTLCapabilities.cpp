@@ -432,16 +432,29 @@ inline CapabilityLevel canCompile(Node* node)
     case FiatInt52:
     case ArithIMul:
     case ProfileType:
-    case ProfileControlFlow:
     case LastNodeType:
         return CannotCompile;
+
+    case ProfileControlFlow:
+        if (!Options::useControlFlowProfilerCoverageMode())
+            return CannotCompile;
+        break;
     }
     return CanCompileAndOSREnter;
 }
 
+bool canCompileOnlyLoopRegions(CodeBlock* codeBlock)
+{
+    return Options::useFTLLoopRegionCompilation()
+        && codeBlock->bytecodeCost() > Options::maximumFTLCandidateBytecodeCost();
+}
+
 CapabilityLevel canCompile(Graph& graph)
 {
-    if (graph.m_codeBlock->bytecodeCost() > Options::maximumFTLCandidateBytecodeCost()) {
+    // An FTLForOSREntryMode compile of such a code block only covers the entry loop, and a
+    // DFGMode query is asking whether to install OSR entry tier-up checks.
+    bool isLoopRegionCompile = graph.m_plan.mode() != FTLMode && canCompileOnlyLoopRegions(graph.m_profiledBlock);
+    if (graph.m_codeBlock->bytecodeCost() > Options::maximumFTLCandidateBytecodeCost() && !isLoopRegionCompile) {
         if (verboseCapabilities())
             dataLog("FTL rejecting ", *graph.m_codeBlock, " because it's too big.\n");
         return CannotCompile;
@@ -39,6 +39,10 @@ enum CapabilityLevel {
 
 CapabilityLevel canCompile(DFG::Graph&);
 
+// Code blocks over maximumFTLCandidateBytecodeCost are never FTL compiled whole, but their hot
+// loops may still be compiled as OSR entry regions.
+bool canCompileOnlyLoopRegions(CodeBlock*);
+
 } } // namespace JSC::FTL
 
 #endif // ENABLE(FTL_JIT)
@@ -143,8 +143,14 @@ void compile(State& state, Safepoint::Result& safepointResult)
     }
     
     B3::PCToOriginMap originMap = state.proc->releasePCToOriginMap();
-    if (vm.shouldBuilderPCToCodeOriginMapping())
-        codeBlock->setPCToCodeOriginMap(makeUnique<PCToCodeOriginMap>(PCToCodeOriginMapBuilder(vm, WTFMove(originMap)), *state.finalizer->b3CodeLinkBuffer));
+    if (vm.shouldBuilderPCToCodeOriginMapping()) {
+        auto map = makeUnique<PCToCodeOriginMap>(PCToCodeOriginMapBuilder(vm, WTFMove(originMap)), *state.finalizer->b3CodeLinkBuffer);
+#if OS(LINUX)
+        if (UNLIKELY(Options::logJITCodeForPerf()))
+            map->recordDebugInfoForPerf(codeBlock, *state.finalizer->b3CodeLinkBuffer);
+#endif
+        codeBlock->setPCToCodeOriginMap(WTFMove(map));
+    }
 
     CodeLocationLabel<JSEntryPtrTag> label = state.finalizer->b3CodeLinkBuffer->locationOf<JSEntryPtrTag>(state.proc->code().entrypointLabel(0));
     state.generatedFunction = label;
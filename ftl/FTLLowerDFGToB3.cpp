@@ -1489,6 +1489,9 @@ private:
         case CountExecution:
             compileCountExecution();
             break;
+        case ProfileControlFlow:
+            compileProfileControlFlow();
+            break;
         case SuperSamplerBegin:
             compileSuperSamplerBegin();
             break;
@@ -12478,6 +12481,13 @@ private:
         m_out.store64(m_out.add(m_out.load64(counter), m_out.constInt64(1)), counter);
     }
 
+    void compileProfileControlFlow()
+    {
+        // Only reachable in coverage mode, where a basic block merely needs a non-zero count.
+        ASSERT(Options::useControlFlowProfilerCoverageMode());
+        m_out.store32As8(m_out.int32One, m_out.absolute(m_node->basicBlockLocation()->executionCountAddress()));
+    }
+
     void compileSuperSamplerBegin()
     {
         TypedPointer counter = m_out.absolute(bitwise_cast<void*>(&g_superSamplerCount));
@@ -14444,7 +14454,7 @@ private:
 
         // FIXME: We should have a way to call functions with the vector of registers.
         // https://bugs.webkit.org/show_bug.cgi?id=163099
-        Vector<LValue, JSC_DOMJIT_SIGNATURE_MAX_ARGUMENTS_INCLUDING_THIS> operands;
+        Vector<LValue, JSC_DOMJIT_SIGNATURE_MAX_ARGUMENTS_INCLUDING_THIS + 1> operands;
 
         unsigned index = 0;
         DFG_NODE_DO_TO_CHILDREN(m_graph, m_node, [&](Node*, Edge edge) {
@@ -14469,12 +14479,14 @@ private:
             ++index;
         });
 
-        unsigned argumentCountIncludingThis = signature->argumentCount + 1;
+        // The data pointer is immortal and is passed as an extra trailing argument.
+        if (signature->functionData)
+            operands.append(m_out.constIntPtr(signature->functionData));
         LValue result;
         // FIXME: Revisit JSGlobalObject.
         // https://bugs.webkit.org/show_bug.cgi?id=203204
         auto function = CFunctionPtr(signature->functionWithoutTypeCheck);
-        switch (argumentCountIncludingThis) {
+        switch (operands.size()) {
         case 1:
             result = vmCall(Int64, reinterpret_cast<J_JITOperation_GP>(function.get()), weakPointer(globalObject), operands[0]);
             break;
@@ -14484,6 +14496,9 @@ private:
         case 3:
             result = vmCall(Int64, reinterpret_cast<J_JITOperation_GPPP>(function.get()), weakPointer(globalObject), operands[0], operands[1], operands[2]);
             break;
+        case 4:
+            result = vmCall(Int64, reinterpret_cast<J_JITOperation_GPPPP>(function.get()), weakPointer(globalObject), operands[0], operands[1], operands[2], operands[3]);
+            break;
         default:
             RELEASE_ASSERT_NOT_REACHED();
             break;
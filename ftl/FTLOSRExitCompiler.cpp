@@ -42,6 +42,7 @@
 #include "MaxFrameExtentForSlowPathCall.h"
 #include "OperandsInlines.h"
 #include "ProbeContext.h"
+#include "USDTProbes.h"
 
 #include <wtf/Scope.h>
 
@@ -576,6 +577,7 @@ JSC_DEFINE_JIT_OPERATION(operationCompileFTLOSRExit, void*, (CallFrame* callFram
 
     JITCode* jitCode = codeBlock->jitCode()->ftl();
     OSRExit& exit = jitCode->osrExit[exitID];
+    JSC_USDT_PROBE3(osr__exit__compile, static_cast<int>(JITType::FTLJIT), codeBlock, exitID);
     
     if (shouldDumpDisassembly() || Options::verboseOSR() || Options::verboseFTLOSRExit()) {
         dataLog("    Owning block: ", pointerDump(codeBlock), "\n");
@@ -46,6 +46,10 @@ public:
     
     virtual void dump(PrintStream&) const = 0;
 
+    // Bytes of freed blocks whose pages were returned to the OS but whose address range is kept
+    // for reuse.
+    virtual size_t decommittedBytes() { return 0; }
+
     void registerDirectory(Heap&, BlockDirectory*);
     BlockDirectory* firstDirectory() const { return m_directories.first(); }
 
@@ -28,6 +28,7 @@
 
 #include "BlockDirectoryInlines.h"
 #include "Heap.h"
+#include "MarkedBlockInlines.h"
 #include "SubspaceInlines.h"
 #include "SuperSampler.h"
 
@@ -70,6 +71,28 @@ bool BlockDirectory::isPagedOut(MonotonicTime deadline)
     return false;
 }
 
+BlockDirectory::OccupancyStatistics BlockDirectory::occupancyStatistics()
+{
+    OccupancyStatistics result;
+    auto locker = holdLock(m_bitvectorLock);
+    m_bits.live().forEachSetBit(
+        [&] (size_t index) {
+            MarkedBlock::Handle* block = m_blocks[index];
+            size_t cellsPerBlock = block->cellsPerBlock();
+            result.blockCount++;
+            result.cellCapacity += cellsPerBlock;
+            if (m_bits.isEmpty(index)) {
+                result.emptyBlockCount++;
+                return;
+            }
+            size_t liveCells = m_bits.isAllocated(index) ? cellsPerBlock : std::min<size_t>(block->markCount(), cellsPerBlock);
+            result.liveCellCount += liveCells;
+            unsigned bucket = liveCells * OccupancyStatistics::numberOfOccupancyBuckets / cellsPerBlock;
+            result.occupancyHistogram[std::min(bucket, OccupancyStatistics::numberOfOccupancyBuckets - 1)]++;
+        });
+    return result;
+}
+
 MarkedBlock::Handle* BlockDirectory::findEmptyBlockToSteal()
 {
     m_emptyCursor = m_bits.empty().findBit(m_emptyCursor, true);
@@ -80,6 +103,17 @@ MarkedBlock::Handle* BlockDirectory::findEmptyBlockToSteal()
 
 MarkedBlock::Handle* BlockDirectory::findBlockForAllocation(LocalAllocator& allocator)
 {
+    if (UNLIKELY(Options::useSparseBlockAvoidance())) {
+        // Fill up the dense blocks first. Sparse blocks are only handed out together with empty
+        // ones, once nothing else is left, so that they get a chance to become empty and be freed.
+        allocator.m_denseAllocationCursor = (m_bits.canAllocateButNotEmpty() & ~m_bits.sparse()).findBit(allocator.m_denseAllocationCursor, true);
+        if (allocator.m_denseAllocationCursor < m_blocks.size()) {
+            unsigned blockIndex = allocator.m_denseAllocationCursor++;
+            setIsCanAllocateButNotEmpty(NoLockingNecessary, blockIndex, false);
+            return m_blocks[blockIndex];
+        }
+    }
+
     for (;;) {
         allocator.m_allocationCursor = (m_bits.canAllocateButNotEmpty() | m_bits.empty()).findBit(allocator.m_allocationCursor, true);
         if (allocator.m_allocationCursor >= m_blocks.size())
@@ -87,6 +121,8 @@ MarkedBlock::Handle* BlockDirectory::findBlockForAllocation(LocalAllocator& allo
         
         unsigned blockIndex = allocator.m_allocationCursor++;
         MarkedBlock::Handle* result = m_blocks[blockIndex];
+        if (m_bits.isEmpty(blockIndex))
+            m_emptyBlocksTakenSinceLastCollection++;
         setIsCanAllocateButNotEmpty(NoLockingNecessary, blockIndex, false);
         return result;
     }
@@ -100,6 +136,7 @@ MarkedBlock::Handle* BlockDirectory::tryAllocateBlock(Heap& heap)
     if (!handle)
         return nullptr;
     
+    m_emptyBlocksTakenSinceLastCollection++;
     markedSpace().didAddBlock(handle);
     
     return handle;
@@ -239,6 +276,16 @@ void BlockDirectory::endMarking()
     m_bits.empty() = m_bits.live() & ~m_bits.markingNotEmpty();
     m_bits.canAllocateButNotEmpty() = m_bits.live() & m_bits.markingNotEmpty() & ~m_bits.markingRetired();
 
+    if (UNLIKELY(Options::useSparseBlockAvoidance())) {
+        m_bits.sparse().clearAll();
+        m_bits.canAllocateButNotEmpty().forEachSetBit(
+            [&] (size_t index) {
+                MarkedBlock::Handle* block = m_blocks[index];
+                if (block->markCount() < Options::sparseMarkedBlockUtilization() * block->cellsPerBlock())
+                    m_bits.setIsSparse(index, true);
+            });
+    }
+
     if (needsDestruction()) {
         // There are some blocks that we didn't allocate out of in the last cycle, but we swept them. This
         // will forget that we did that and we will end up sweeping them again and attempting to call their
@@ -289,6 +336,47 @@ void BlockDirectory::shrink()
         });
 }
 
+bool BlockDirectory::shouldRetainEmptyBlock()
+{
+    if (!Options::useEmptyBlockRetention())
+        return false;
+    // The block being asked about is already counted as empty.
+    return m_bits.empty().bitCount() <= static_cast<size_t>(std::ceil(m_emptyBlockDemand));
+}
+
+size_t BlockDirectory::releaseExcessEmptyBlocks(MonotonicTime now)
+{
+    if (!Options::useEmptyBlockRetention())
+        return 0;
+
+    if (m_lastEmptyBlockDemandUpdate) {
+        Seconds halfLife = Seconds::fromMilliseconds(Options::emptyBlockRetentionHalfLifeMilliseconds());
+        m_emptyBlockDemand *= std::exp2(-((now - m_lastEmptyBlockDemandUpdate) / halfLife));
+    }
+    m_emptyBlockDemand = std::max(m_emptyBlockDemand, static_cast<double>(m_emptyBlocksTakenSinceLastCollection));
+    m_emptyBlocksTakenSinceLastCollection = 0;
+    m_lastEmptyBlockDemandUpdate = now;
+
+    // Destructible blocks have to be swept before they can be freed. The sweeper asks
+    // shouldRetainEmptyBlock() about those as it gets to them.
+    Vector<unsigned> candidates;
+    (m_bits.empty() & ~m_bits.destructible()).forEachSetBit(
+        [&] (size_t index) {
+            candidates.append(index);
+        });
+
+    size_t emptyBlockCount = m_bits.empty().bitCount();
+    size_t retainedBlockCount = static_cast<size_t>(std::ceil(m_emptyBlockDemand));
+    size_t freedBlockCount = 0;
+    // Free from the end so that the blocks we keep are the ones allocators find first.
+    while (!candidates.isEmpty() && emptyBlockCount > retainedBlockCount) {
+        markedSpace().freeBlock(m_blocks[candidates.takeLast()]);
+        emptyBlockCount--;
+        freedBlockCount++;
+    }
+    return freedBlockCount;
+}
+
 void BlockDirectory::assertNoUnswept()
 {
     if (!ASSERT_ENABLED)
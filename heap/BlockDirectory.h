@@ -31,6 +31,7 @@
 #include "FreeList.h"
 #include "LocalAllocator.h"
 #include "MarkedBlock.h"
+#include <array>
 #include <wtf/DataLog.h>
 #include <wtf/FastBitVector.h>
 #include <wtf/MonotonicTime.h>
@@ -68,6 +69,13 @@ public:
     void snapshotUnsweptForFullCollection();
     void sweep();
     void shrink();
+
+    // Empty blocks are kept around for reuse in proportion to how many blocks this directory has
+    // recently needed. That demand decays with Options::emptyBlockRetentionHalfLifeMilliseconds, so
+    // the blocks left over from an allocation spike are returned to the AlignedMemoryAllocator
+    // once the spike is over. Returns the number of blocks freed.
+    size_t releaseExcessEmptyBlocks(MonotonicTime now);
+    bool shouldRetainEmptyBlock();
     void assertNoUnswept();
     size_t cellSize() const { return m_cellSize; }
     const CellAttributes& attributes() const { return m_attributes; }
@@ -86,6 +94,23 @@ public:
     void removeBlock(MarkedBlock::Handle*);
 
     bool isPagedOut(MonotonicTime deadline);
+
+    struct OccupancyStatistics {
+        static constexpr unsigned numberOfOccupancyBuckets = 10;
+
+        size_t blockCount { 0 };
+        size_t emptyBlockCount { 0 };
+        size_t liveCellCount { 0 };
+        size_t cellCapacity { 0 };
+        // occupancyHistogram[i] is the number of non-empty blocks that are between i and i + 1
+        // tenths full.
+        std::array<size_t, numberOfOccupancyBuckets> occupancyHistogram { };
+    };
+
+    // This is computed from per-block summaries only (the directory bits and mark counts), so it
+    // never visits individual cells. Live counts reflect the last collection, plus blocks that have
+    // been allocated full since then.
+    JS_EXPORT_PRIVATE OccupancyStatistics occupancyStatistics();
     
     Lock& bitvectorLock() { return m_bitvectorLock; }
 
@@ -160,6 +185,12 @@ private:
     // this number is bound by capacity of Vector m_blocks, which must be within unsigned.
     unsigned m_emptyCursor { 0 };
     unsigned m_unsweptCursor { 0 }; // Points to the next block that is a candidate for incremental sweeping.
+
+    // Number of empty or new blocks handed out to allocators since the last collection, and the
+    // decayed maximum of that count, which is how many empty blocks we keep.
+    unsigned m_emptyBlocksTakenSinceLastCollection { 0 };
+    double m_emptyBlockDemand { 0 };
+    MonotonicTime m_lastEmptyBlockDemandUpdate;
     
     // FIXME: All of these should probably be references.
     // https://bugs.webkit.org/show_bug.cgi?id=166988
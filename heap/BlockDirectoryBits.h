@@ -39,6 +39,7 @@ namespace JSC {
     macro(destructible, Destructible) /* The set of all blocks that may have destructors to run. */\
     macro(eden, Eden) /* The set of all blocks that have new objects since the last GC. */\
     macro(unswept, Unswept) /* The set of all blocks that could be swept by the incremental sweeper. */\
+    macro(sparse, Sparse) /* The set of canAllocateButNotEmpty blocks that are less than sparseMarkedBlockUtilization full. Only computed when useSparseBlockAvoidance is enabled. */\
     \
     /* These are computed during marking. */\
     macro(markingNotEmpty, MarkingNotEmpty) /* The set of all blocks that are not empty. */ \
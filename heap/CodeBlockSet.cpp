@@ -58,6 +58,72 @@ bool CodeBlockSet::isCurrentlyExecuting(CodeBlock* codeBlock)
     return m_currentlyExecuting.contains(codeBlock);
 }
 
+CodeBlockSet::CodeMemoryStatistics CodeBlockSet::codeMemoryStatistics()
+{
+    auto locker = holdLock(m_lock);
+    CodeMemoryStatistics result;
+    for (CodeBlock* codeBlock : m_codeBlocks) {
+        JITType jitType = codeBlock->jitType();
+        TierStatistics* tier;
+        switch (jitType) {
+        case JITType::InterpreterThunk:
+            tier = &result.llint;
+            break;
+        case JITType::BaselineJIT:
+            tier = &result.baseline;
+            break;
+        case JITType::DFGJIT:
+            tier = &result.dfg;
+            break;
+        case JITType::FTLJIT:
+            tier = &result.ftl;
+            break;
+        default:
+            continue;
+        }
+        tier->codeBlocks++;
+        tier->bytecodeBytes += codeBlock->instructionsSize();
+        // LLInt CodeBlocks all share the interpreter's thunks, so they own no machine code.
+        if (JITCode::isJIT(jitType))
+            tier->machineCodeBytes += codeBlock->jitCode()->size();
+    }
+    result.coldCodeBlocks = m_coldCodeBlocks;
+    result.coldMachineCodeBytes = m_coldMachineCodeBytes;
+    return result;
+}
+
+void CodeBlockSet::updateColdCodeThreshold(size_t budget)
+{
+    auto locker = holdLock(m_lock);
+    clearColdCodeThreshold();
+    m_coldCodeBlocks = 0;
+    m_coldMachineCodeBytes = 0;
+
+    Vector<std::pair<MonotonicTime, size_t>> candidates;
+    size_t totalBytes = 0;
+    for (CodeBlock* codeBlock : m_codeBlocks) {
+        if (!JITCode::isJIT(codeBlock->jitType()))
+            continue;
+        size_t bytes = codeBlock->jitCode()->size();
+        totalBytes += bytes;
+        if (codeBlock->canTrackExecution())
+            candidates.append({ codeBlock->lastExecutionTime(), bytes });
+    }
+    if (totalBytes <= budget)
+        return;
+
+    std::sort(candidates.begin(), candidates.end(), [] (const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    for (auto& candidate : candidates) {
+        if (totalBytes - m_coldMachineCodeBytes <= budget)
+            break;
+        m_coldCodeThreshold = candidate.first;
+        m_coldCodeBlocks++;
+        m_coldMachineCodeBytes += candidate.second;
+    }
+}
+
 void CodeBlockSet::dump(PrintStream& out) const
 {
     CommaPrinter comma;
@@ -28,6 +28,7 @@
 #include "CollectionScope.h"
 #include <wtf/HashSet.h>
 #include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/Noncopyable.h>
 #include <wtf/PrintStream.h>
 
@@ -46,6 +47,22 @@ class CodeBlockSet {
     WTF_MAKE_FAST_ALLOCATED;
     WTF_MAKE_NONCOPYABLE(CodeBlockSet);
 public:
+    struct TierStatistics {
+        size_t codeBlocks { 0 };
+        size_t machineCodeBytes { 0 };
+        size_t bytecodeBytes { 0 };
+    };
+
+    struct CodeMemoryStatistics {
+        TierStatistics llint;
+        TierStatistics baseline;
+        TierStatistics dfg;
+        TierStatistics ftl;
+        // What the last full collection found over Options::codeMemoryBudget(), if anything.
+        size_t coldCodeBlocks { 0 };
+        size_t coldMachineCodeBytes { 0 };
+    };
+
     CodeBlockSet();
     ~CodeBlockSet();
 
@@ -70,6 +87,17 @@ public:
     
     template<typename Functor> void iterateCurrentlyExecuting(const Functor&);
     
+    JS_EXPORT_PRIVATE CodeMemoryStatistics codeMemoryStatistics();
+
+    // Orders JIT CodeBlocks by when they were last seen executing, and picks the latest time
+    // at which the least recently executed ones must be dropped to bring their machine code
+    // back under budget. CodeBlocks that last executed at or before that time are cold, and
+    // are jettisoned for old age by the collection that follows.
+    void updateColdCodeThreshold(size_t budget);
+    void clearColdCodeThreshold() { m_coldCodeThreshold = -MonotonicTime::infinity(); }
+    void raiseColdCodeThreshold(MonotonicTime threshold) { m_coldCodeThreshold = std::max(m_coldCodeThreshold, threshold); }
+    MonotonicTime coldCodeThreshold() const { return m_coldCodeThreshold; }
+
     void dump(PrintStream&) const;
     
     void add(CodeBlock*);
@@ -78,6 +106,9 @@ public:
 private:
     HashSet<CodeBlock*> m_codeBlocks;
     HashSet<CodeBlock*> m_currentlyExecuting;
+    MonotonicTime m_coldCodeThreshold { -MonotonicTime::infinity() };
+    size_t m_coldCodeBlocks { 0 };
+    size_t m_coldMachineCodeBytes { 0 };
     Lock m_lock;
 };
 
@@ -61,6 +61,8 @@ enum class CollectorPhase : uint8_t {
     End
 };
 
+constexpr unsigned numberOfCollectorPhases = static_cast<unsigned>(CollectorPhase::End) + 1;
+
 bool worldShouldBeSuspended(CollectorPhase phase);
 
 } // namespace JSC
@@ -136,7 +136,7 @@ void* CompleteSubspace::tryAllocateSlow(VM& vm, size_t size, GCDeferralContext*
     
     vm.heap.collectIfNecessaryOrDefer(deferralContext);
     
-    size = WTF::roundUpToMultipleOf<MarkedSpace::sizeStep>(size);
+    size = MarkedSpace::preciseAllocationSizeFor(size);
     PreciseAllocation* allocation = PreciseAllocation::tryCreate(vm.heap, size, this, m_space.m_preciseAllocations.size());
     if (!allocation)
         return nullptr;
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "ConcurrentSweeper.h"
+
+#include "BlockDirectoryInlines.h"
+#include "MarkedSpaceInlines.h"
+
+namespace JSC {
+
+Ref<ConcurrentSweeper> ConcurrentSweeper::create()
+{
+    Box<Lock> lock = Box<Lock>::create();
+    auto locker = holdLock(*lock);
+    return adoptRef(*new ConcurrentSweeper(locker, lock, AutomaticThreadCondition::create()));
+}
+
+ConcurrentSweeper::ConcurrentSweeper(const AbstractLocker& locker, Box<Lock> lock, Ref<AutomaticThreadCondition>&& condition)
+    : AutomaticThread(locker, lock, condition.copyRef())
+    , m_lock(lock)
+    , m_workCondition(WTFMove(condition))
+{
+}
+
+void ConcurrentSweeper::startSweeping(MarkedSpace& markedSpace)
+{
+    auto locker = holdLock(*m_lock);
+    if (m_shouldStop)
+        return;
+
+    markedSpace.forEachDirectory(
+        [&] (BlockDirectory& directory) -> IterationStatus {
+            if (directory.needsDestruction())
+                return IterationStatus::Continue;
+            // Empty blocks get a bump free list, which is already cheap, so we only bother with the
+            // partially occupied ones.
+            directory.forEachBlock(
+                [&] (MarkedBlock::Handle* block) {
+                    if (directory.isCanAllocateButNotEmpty(NoLockingNecessary, block))
+                        m_queue.add(block);
+                });
+            return IterationStatus::Continue;
+        });
+
+    if (!m_queue.isEmpty())
+        m_workCondition->notifyOne(locker);
+}
+
+void ConcurrentSweeper::stopSweeping()
+{
+    auto locker = holdLock(*m_lock);
+    m_queue.clear();
+    waitForCurrentBlock(locker);
+}
+
+void ConcurrentSweeper::shutdown()
+{
+    auto locker = holdLock(*m_lock);
+    m_shouldStop = true;
+    m_queue.clear();
+    waitForCurrentBlock(locker);
+    m_workCondition->notifyAll(locker);
+}
+
+void ConcurrentSweeper::willTouchBlock(MarkedBlock::Handle* block)
+{
+    auto locker = holdLock(*m_lock);
+    m_queue.remove(block);
+    while (m_currentBlock == block)
+        m_didFinishBlockCondition.wait(*m_lock);
+}
+
+void ConcurrentSweeper::waitForCurrentBlock(const AbstractLocker&)
+{
+    while (m_currentBlock)
+        m_didFinishBlockCondition.wait(*m_lock);
+}
+
+AutomaticThread::PollResult ConcurrentSweeper::poll(const AbstractLocker&)
+{
+    if (m_shouldStop)
+        return PollResult::Stop;
+    if (m_queue.isEmpty())
+        return PollResult::Wait;
+    return PollResult::Work;
+}
+
+AutomaticThread::WorkResult ConcurrentSweeper::work()
+{
+    MarkedBlock::Handle* block;
+    {
+        auto locker = holdLock(*m_lock);
+        if (m_queue.isEmpty())
+            return WorkResult::Continue;
+        block = m_queue.takeFirst();
+        m_currentBlock = block;
+    }
+
+    block->buildFreeListConcurrently();
+
+    {
+        auto locker = holdLock(*m_lock);
+        m_currentBlock = nullptr;
+        m_didFinishBlockCondition.notifyAll();
+    }
+    return WorkResult::Continue;
+}
+
+void ConcurrentSweeper::threadDidStart()
+{
+    Thread::registerGCThread(GCThreadType::Helper);
+}
+
+} // namespace JSC
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "MarkedBlock.h"
+#include <wtf/AutomaticThread.h>
+#include <wtf/Box.h>
+#include <wtf/Condition.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/Lock.h>
+
+namespace JSC {
+
+class MarkedSpace;
+
+// The ConcurrentSweeper builds free lists for blocks in subspaces without destructors on a helper
+// thread, while the mutator runs, so that the allocation slow path can usually adopt a ready-made
+// free list instead of sweeping. It only runs between collections: the collector stops it before it
+// starts marking, and the mutator claims a block (see willTouchBlock()) before sweeping or freeing it.
+class ConcurrentSweeper final : public AutomaticThread {
+public:
+    static Ref<ConcurrentSweeper> create();
+
+    const char* name() const final { return "JSC Concurrent Sweeper"; }
+
+    // Called at the end of a collection, with the world stopped.
+    void startSweeping(MarkedSpace&);
+
+    // Called before the collector starts marking. Waits for the block that is currently being swept.
+    void stopSweeping();
+
+    void shutdown();
+
+    // The mutator must call this before it sweeps, steals or frees a block that may have been queued.
+    void willTouchBlock(MarkedBlock::Handle*);
+
+private:
+    ConcurrentSweeper(const AbstractLocker&, Box<Lock>, Ref<AutomaticThreadCondition>&&);
+
+    PollResult poll(const AbstractLocker&) final;
+    WorkResult work() final;
+    void threadDidStart() final;
+
+    void waitForCurrentBlock(const AbstractLocker&);
+
+    Box<Lock> m_lock;
+    Ref<AutomaticThreadCondition> m_workCondition;
+    Condition m_didFinishBlockCondition;
+    ListHashSet<MarkedBlock::Handle*> m_queue;
+    MarkedBlock::Handle* m_currentBlock { nullptr };
+    bool m_shouldStop { false };
+};
+
+} // namespace JSC
@@ -97,16 +97,79 @@ void ConservativeRoots::genericAddSpan(void* begin, void* end, MarkHook& markHoo
     TinyBloomFilter filter = m_heap.objectSpace().blocks().filter(); // Make a local copy of filter to show the compiler it won't alias, and can be register-allocated.
     HeapVersion markingVersion = m_heap.objectSpace().markingVersion();
     HeapVersion newlyAllocatedVersion = m_heap.objectSpace().newlyAllocatedVersion();
-    for (char** it = static_cast<char**>(begin); it != static_cast<char**>(end); ++it)
-        genericAddPointer(*it, markingVersion, newlyAllocatedVersion, filter, markHook);
+
+    // Most stack words are small integers, doubles or return addresses, and none of those can point
+    // at a cell or at a stub routine. Rule them out with two range compares each before doing the
+    // per-pointer lookups. The ranges are unsigned offsets so that each test is one compare.
+    Range<uintptr_t> heapRange = conservativeHeapRange();
+    uintptr_t heapBegin = heapRange.begin();
+    uintptr_t heapSize = heapRange.end() - heapRange.begin();
+    Range<uintptr_t> markHookRange = markHook.range();
+    uintptr_t markHookBegin = markHookRange.begin();
+    uintptr_t markHookSize = markHookRange.end() - markHookRange.begin();
+    auto mayMatter = [&] (void* word) -> bool {
+        void* pointer = removeArrayPtrTag(word);
+        bool inHeap = bitwise_cast<uintptr_t>(pointer) - heapBegin < heapSize;
+        bool inMarkHook = removeCodePtrTag<uintptr_t>(pointer) - markHookBegin < markHookSize;
+        return inHeap | inMarkHook;
+    };
+
+    // Test a few words at a time without branching so that the common all-miss case stays branch
+    // free and the compiler is free to vectorize the compares.
+    constexpr size_t wordsPerGroup = 4;
+    char** it = static_cast<char**>(begin);
+    for (; static_cast<size_t>(static_cast<char**>(end) - it) >= wordsPerGroup; it += wordsPerGroup) {
+        bool anyMayMatter = false;
+        for (size_t i = 0; i < wordsPerGroup; ++i)
+            anyMayMatter |= mayMatter(it[i]);
+        if (LIKELY(!anyMayMatter))
+            continue;
+        for (size_t i = 0; i < wordsPerGroup; ++i) {
+            if (mayMatter(it[i]))
+                genericAddPointer(it[i], markingVersion, newlyAllocatedVersion, filter, markHook);
+        }
+    }
+    for (; it != static_cast<char**>(end); ++it) {
+        if (mayMatter(*it))
+            genericAddPointer(*it, markingVersion, newlyAllocatedVersion, filter, markHook);
+    }
+}
+
+Range<uintptr_t> ConservativeRoots::conservativeHeapRange() const
+{
+    MarkedSpace& objectSpace = m_heap.objectSpace();
+    uintptr_t begin = std::numeric_limits<uintptr_t>::max();
+    uintptr_t end = 0;
+
+    const MarkedBlockSet& blocks = objectSpace.blocks();
+    if (blocks.lowestBlock() <= blocks.highestBlock()) {
+        begin = blocks.lowestBlock();
+        // A butterfly pointer can point just past the end of the last block. HeapUtil accepts up to
+        // sizeof(IndexingHeader) bytes past a block's end, inclusive.
+        end = blocks.highestBlock() + MarkedBlock::blockSize + sizeof(IndexingHeader) + 1;
+    }
+
+    if (size_t preciseAllocationsSize = objectSpace.preciseAllocationsForThisCollectionSize()) {
+        PreciseAllocation* first = objectSpace.preciseAllocationsForThisCollectionBegin()[0];
+        PreciseAllocation* last = objectSpace.preciseAllocationsForThisCollectionBegin()[preciseAllocationsSize - 1];
+        begin = std::min(begin, bitwise_cast<uintptr_t>(first->cell()));
+        // Matches PreciseAllocation::belowUpperBound(), which is inclusive.
+        end = std::max(end, bitwise_cast<uintptr_t>(last->cell()) + last->cellSize() + sizeof(IndexingHeader) + 1);
+    }
+
+    if (begin >= end)
+        return Range<uintptr_t> { 0, 0 };
+    return Range<uintptr_t> { begin, end };
 }
 
 class DummyMarkHook {
 public:
     void mark(void*) { }
     void markKnownJSCell(JSCell*) { }
+    Range<uintptr_t> range() const { return Range<uintptr_t> { 0, 0 }; }
 };
 
+
 void ConservativeRoots::add(void* begin, void* end)
 {
     DummyMarkHook dummy;
@@ -133,6 +196,8 @@ public:
             m_codeBlocks.mark(m_codeBlocksLocker, jsCast<CodeBlock*>(cell));
     }
 
+    Range<uintptr_t> range() const { return m_stubRoutines.range(); }
+
 private:
     JITStubRoutineSet& m_stubRoutines;
     CodeBlockSet& m_codeBlocks;
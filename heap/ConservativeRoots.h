@@ -26,6 +26,7 @@
 #pragma once
 
 #include "Heap.h"
+#include <wtf/Range.h>
 
 namespace JSC {
 
@@ -53,6 +54,8 @@ private:
 
     template<typename MarkHook>
     void genericAddSpan(void*, void* end, MarkHook&);
+
+    WTF::Range<uintptr_t> conservativeHeapRange() const;
     
     void grow();
 
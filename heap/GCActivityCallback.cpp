@@ -55,6 +55,12 @@ void GCActivityCallback::doWork(VM& vm)
         return;
     }
 
+    Seconds delay;
+    if (heap.shouldDeferTimerCollection(delay)) {
+        setTimeUntilFire(delay);
+        return;
+    }
+
     doCollection(vm);
 }
 
@@ -86,6 +92,13 @@ void GCActivityCallback::willCollect()
     cancel();
 }
 
+void GCActivityCallback::scheduleCollectionSoon()
+{
+    // We leave m_delay alone: it only matters to scheduleTimer(), which can only move the fire
+    // date earlier, and doWork() resets it through willCollect().
+    setTimeUntilFire(0_s);
+}
+
 void GCActivityCallback::cancel()
 {
     m_delay = s_decade;
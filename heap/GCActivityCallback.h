@@ -55,6 +55,8 @@ public:
     void didAllocate(Heap&, size_t);
     void willCollect();
     void cancel();
+    // Unlike the other methods, this may be called from any thread.
+    void scheduleCollectionSoon();
     bool isEnabled() const { return m_enabled; }
     void setEnabled(bool enabled) { m_enabled = enabled; }
 
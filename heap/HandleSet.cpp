@@ -28,7 +28,9 @@
 
 #include "HandleBlock.h"
 #include "HandleBlockInlines.h"
+#include "HeapInlines.h"
 #include "JSCJSValueInlines.h"
+#include "VM.h"
 
 namespace JSC {
 
@@ -58,18 +60,35 @@ void HandleSet::grow()
 
 void HandleSet::visitStrongHandles(SlotVisitor& visitor)
 {
-    Node* end = m_strongList.end();
-    for (Node* node = m_strongList.begin(); node != end; node = node->next()) {
+    auto visit = [&] (SentinelLinkedList<Node>& list) {
+        Node* end = list.end();
+        for (Node* node = list.begin(); node != end; node = node->next()) {
 #if ENABLE(GC_VALIDATION)
-        RELEASE_ASSERT(isLiveNode(node));
+            RELEASE_ASSERT(isLiveNode(node));
 #endif
-        visitor.appendUnbarriered(*node->slot());
-    }
+            visitor.appendUnbarriered(*node->slot());
+        }
+    };
+
+    visit(m_newStrongList);
+
+    if (m_vm.heap.collectionScope() == CollectionScope::Full)
+        visit(m_strongList);
+}
+
+void HandleSet::promoteNewStrongHandles()
+{
+    ASSERT(!Thread::mayBeGCThread() || m_vm.heap.worldIsStopped());
+    m_strongList.takeFrom(m_newStrongList);
 }
 
 void HandleSet::writeBarrier(HandleSlot slot, const JSValue& value)
 {
-    if (!value == !*slot && slot->isCell() == value.isCell())
+    bool wasCell = *slot && slot->isCell();
+    bool isCell = value && value.isCell();
+    if (!wasCell && !isCell)
+        return;
+    if (isCell && *slot == value)
         return;
 
     Node* node = toNode(slot);
@@ -77,12 +96,13 @@ void HandleSet::writeBarrier(HandleSlot slot, const JSValue& value)
     RELEASE_ASSERT(isLiveNode(node));
 #endif
     SentinelLinkedList<Node>::remove(node);
-    if (!value || !value.isCell()) {
+    if (!isCell) {
         m_immediateList.push(node);
         return;
     }
 
-    m_strongList.push(node);
+    // Any new cell, even one replacing another cell, has to be visited by the next Eden collection.
+    m_newStrongList.push(node);
 #if ENABLE(GC_VALIDATION)
     RELEASE_ASSERT(isLiveNode(node));
 #endif
@@ -91,11 +111,13 @@ void HandleSet::writeBarrier(HandleSlot slot, const JSValue& value)
 unsigned HandleSet::protectedGlobalObjectCount()
 {
     unsigned count = 0;
-    Node* end = m_strongList.end();
-    for (Node* node = m_strongList.begin(); node != end; node = node->next()) {
-        JSValue value = *node->slot();
-        if (value.isObject() && asObject(value.asCell())->isGlobalObject())
-            count++;
+    for (auto* list : { &m_strongList, &m_newStrongList }) {
+        Node* end = list->end();
+        for (Node* node = list->begin(); node != end; node = node->next()) {
+            JSValue value = *node->slot();
+            if (value.isObject() && asObject(value.asCell())->isGlobalObject())
+                count++;
+        }
     }
     return count;
 }
@@ -74,6 +74,7 @@ public:
     void deallocate(HandleSlot);
 
     void visitStrongHandles(SlotVisitor&);
+    void promoteNewStrongHandles();
 
     JS_EXPORT_PRIVATE void writeBarrier(HandleSlot, const JSValue&);
 
@@ -95,7 +96,11 @@ private:
     VM& m_vm;
     DoublyLinkedList<HandleBlock> m_blockList;
 
+    // Strong handles whose cell was already visited by the last collection, and strong handles that
+    // were given a cell since then. Eden collections only need to visit the latter: the former point
+    // at old cells that are still marked.
     SentinelLinkedList<Node> m_strongList;
+    SentinelLinkedList<Node> m_newStrongList;
     SentinelLinkedList<Node> m_immediateList;
     SinglyLinkedList<Node> m_freeList;
 };
@@ -182,14 +187,16 @@ inline HandleNode* HandleNode::next()
 
 template<typename Functor> void HandleSet::forEachStrongHandle(const Functor& functor, const HashCountedSet<JSCell*>& skipSet)
 {
-    HandleSet::Node* end = m_strongList.end();
-    for (HandleSet::Node* node = m_strongList.begin(); node != end; node = node->next()) {
-        JSValue value = *node->slot();
-        if (!value || !value.isCell())
-            continue;
-        if (skipSet.contains(value.asCell()))
-            continue;
-        functor(value.asCell());
+    for (auto* list : { &m_strongList, &m_newStrongList }) {
+        HandleSet::Node* end = list->end();
+        for (HandleSet::Node* node = list->begin(); node != end; node = node->next()) {
+            JSValue value = *node->slot();
+            if (!value || !value.isCell())
+                continue;
+            if (skipSet.contains(value.asCell()))
+                continue;
+            functor(value.asCell());
+        }
     }
 }
 
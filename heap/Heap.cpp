@@ -25,6 +25,7 @@
 #include "CodeBlock.h"
 #include "CodeBlockSetInlines.h"
 #include "CollectingScope.h"
+#include "ConcurrentSweeper.h"
 #include "ConservativeRoots.h"
 #include "DFGWorklistInlines.h"
 #include "EdenGCActivityCallback.h"
@@ -37,6 +38,9 @@
 #include "GCSegmentedArrayInlines.h"
 #include "GCTypeMap.h"
 #include "HasOwnPropertyCache.h"
+#include "HeapAllocationSampler.h"
+#include "HeapBudgetCoordinator.h"
+#include "HeapGrowthPolicy.h"
 #include "HeapHelperPool.h"
 #include "HeapIterationScope.h"
 #include "HeapProfiler.h"
@@ -48,6 +52,7 @@
 #include "JITStubRoutineSet.h"
 #include "JITWorklist.h"
 #include "JSFinalizationRegistry.h"
+#include "JSString.h"
 #include "JSVirtualMachineInternal.h"
 #include "JSWeakMap.h"
 #include "JSWeakObjectRef.h"
@@ -57,7 +62,11 @@
 #include "MarkStackMergingConstraint.h"
 #include "MarkedJSValueRefArray.h"
 #include "MarkedSpaceInlines.h"
+#include "MarkerTopology.h"
 #include "MarkingConstraintSet.h"
+#include "MegamorphicCache.h"
+#include "ObjectCloneCache.h"
+#include "PauseTimeMutatorScheduler.h"
 #include "PreventCollectionScope.h"
 #include "SamplingProfiler.h"
 #include "ShadowChicken.h"
@@ -71,6 +80,7 @@
 #include "SynchronousStopTheWorldMutatorScheduler.h"
 #include "TypeProfiler.h"
 #include "TypeProfilerLog.h"
+#include "USDTProbes.h"
 #include "VM.h"
 #include "WeakMapImplInlines.h"
 #include "WeakSetInlines.h"
@@ -81,6 +91,7 @@
 #include <wtf/Scope.h>
 #include <wtf/SimpleStats.h>
 #include <wtf/Threading.h>
+#include <wtf/text/StringHash.h>
 
 #if USE(BMALLOC_MEMORY_FOOTPRINT_API)
 #include <bmalloc/bmalloc.h>
@@ -310,12 +321,22 @@ Heap::Heap(VM& vm, HeapType heapType)
         std::unique_ptr<SlotVisitor> visitor = makeUnique<SlotVisitor>(*this, toCString("P", i + 1));
         if (Options::optimizeParallelSlotVisitorsForStoppedMutator())
             visitor->optimizeForStoppedMutator();
+        // Marker 0 is the collector's own visitor, which runs wherever the collector does.
+        if (Options::useNUMAAwareMarking())
+            visitor->setMarkerNode(MarkerTopology::singleton().nodeForMarker(i + 1));
         m_availableParallelSlotVisitors.append(visitor.get());
         m_parallelSlotVisitors.append(WTFMove(visitor));
     }
+
+    forEachSlotVisitor(
+        [&] (SlotVisitor& visitor) {
+            m_stealableSlotVisitors.append(&visitor);
+        });
     
     if (Options::useConcurrentGC()) {
-        if (Options::useStochasticMutatorScheduler())
+        if (Options::usePauseTimeMutatorScheduler())
+            m_scheduler = makeUnique<PauseTimeMutatorScheduler>(*this);
+        else if (Options::useStochasticMutatorScheduler())
             m_scheduler = makeUnique<StochasticSpaceTimeMutatorScheduler>(*this);
         else
             m_scheduler = makeUnique<SpaceTimeMutatorScheduler>(*this);
@@ -327,6 +348,14 @@ Heap::Heap(VM& vm, HeapType heapType)
     
     if (Options::verifyHeap())
         m_verifier = makeUnique<HeapVerifier>(this, Options::numberOfGCCyclesToRecordForVerification());
+
+    if (Options::useConcurrentSweeping())
+        m_concurrentSweeper = ConcurrentSweeper::create();
+
+    if (HeapBudgetCoordinator::isEnabled()) {
+        HeapBudgetCoordinator::singleton().registerHeap(*this);
+        m_isRegisteredWithBudgetCoordinator = true;
+    }
     
     m_collectorSlotVisitor->optimizeForStoppedMutator();
 
@@ -343,6 +372,9 @@ Heap::~Heap()
     // Scribble m_worldState to make it clear that the heap has already been destroyed if we crash in checkConn
     m_worldState.store(0xbadbeeffu);
 
+    if (m_isRegisteredWithBudgetCoordinator)
+        HeapBudgetCoordinator::singleton().unregisterHeap(*this);
+
     forEachSlotVisitor(
         [&] (SlotVisitor& visitor) {
             visitor.clearMarkStacks();
@@ -394,6 +426,14 @@ void Heap::lastChanceToFinalize()
     }
     
     m_isShuttingDown = true;
+
+    if (m_concurrentSweeper)
+        m_concurrentSweeper->shutdown();
+
+    if (m_isRegisteredWithBudgetCoordinator) {
+        HeapBudgetCoordinator::singleton().unregisterHeap(*this);
+        m_isRegisteredWithBudgetCoordinator = false;
+    }
     
     RELEASE_ASSERT(!m_vm.entryScope);
     RELEASE_ASSERT(m_mutatorState == MutatorState::Running);
@@ -575,6 +615,21 @@ bool Heap::unprotect(JSValue k)
     return m_protectedValues.remove(k.asCell());
 }
 
+ProtectedValueTable::Handle Heap::protectWithHandle(JSValue value)
+{
+    ASSERT(value);
+    ASSERT(m_vm.currentThreadIsHoldingAPILock());
+
+    return m_protectedValueTable.add(value);
+}
+
+void Heap::releaseProtectHandle(ProtectedValueTable::Handle handle)
+{
+    ASSERT(m_vm.currentThreadIsHoldingAPILock());
+
+    m_protectedValueTable.remove(handle);
+}
+
 void Heap::addReference(JSCell* cell, ArrayBuffer* buffer)
 {
     if (m_arrayBuffers.addReference(cell, buffer)) {
@@ -718,11 +773,90 @@ void Heap::gatherScratchBufferRoots(ConservativeRoots& roots)
 void Heap::beginMarking()
 {
     TimingScope timingScope(*this, "Heap::beginMarking");
+    m_collectionNumber++;
+    m_ephemeronBucketsScanned.store(0);
+    m_ephemeronValuesVisited.store(0);
+    m_ephemeronFullTableVisits.store(0);
+    m_ephemeronIncrementalTableVisits.store(0);
     m_jitStubRoutines->clearMarks();
+    if (Options::codeMemoryBudget() && m_collectionScope && m_collectionScope.value() == CollectionScope::Full)
+        m_codeBlocks->updateColdCodeThreshold(Options::codeMemoryBudget());
+    else
+        m_codeBlocks->clearColdCodeThreshold();
+    if (m_requestedColdCodeThreshold && m_collectionScope && m_collectionScope.value() == CollectionScope::Full) {
+        m_codeBlocks->raiseColdCodeThreshold(m_requestedColdCodeThreshold);
+        m_requestedColdCodeThreshold = MonotonicTime();
+    }
     m_objectSpace.beginMarking();
     setMutatorShouldBeFenced(true);
 }
 
+void Heap::deduplicateStrings()
+{
+    if (!Options::useStringDeduplication())
+        return;
+    if (!m_collectionScope || m_collectionScope.value() != CollectionScope::Full)
+        return;
+
+    // Host functions hold on to JSString values by reference across allocations, so we can only swap
+    // the StringImpl out from under a JSString when the mutator is not inside the VM.
+    if (vm().entryScope)
+        return;
+
+#if ENABLE(DFG_JIT)
+    // Plans can hold onto a JSString's StringImpl without a reference to it.
+    for (unsigned i = DFG::numberOfWorklists(); i--;) {
+        if (DFG::Worklist* worklist = DFG::existingWorklistForIndexOrNull(i)) {
+            if (worklist->isActiveForVM(vm()))
+                return;
+        }
+    }
+#endif
+
+    // Only a StringImpl whose sole owner is its JSString can be freed by pointing that JSString at an
+    // equal string. Atoms are unique already.
+    unsigned minimumLength = Options::stringDeduplicationMinimumLength();
+    Vector<JSString*> candidates;
+    vm().stringSpace.forEachMarkedCell(
+        [&] (HeapCell* cell, HeapCell::Kind) {
+            JSString* string = static_cast<JSString*>(cell);
+            if (string->isRope())
+                return;
+            StringImpl* impl = string->valueInternal().impl();
+            if (impl->length() < minimumLength || impl->isAtom() || !impl->hasOneRef())
+                return;
+            candidates.append(string);
+        });
+    if (candidates.size() < 2)
+        return;
+
+    // Hashing reads every character, so it is split across the helpers. Each candidate is the only
+    // owner of its StringImpl, so no two threads ever cache a hash into the same one.
+    Atomic<size_t> nextIndex { 0 };
+    m_helperClient.runFunctionInParallel(
+        [&] () {
+            for (;;) {
+                size_t index = nextIndex.exchangeAdd(1);
+                if (index >= candidates.size())
+                    return;
+                candidates[index]->valueInternal().impl()->hash();
+            }
+        });
+
+    HashSet<String> canonicalStrings;
+    for (JSString* string : candidates) {
+        String& value = string->valueInternal();
+        auto addResult = canonicalStrings.add(value);
+        if (addResult.isNewEntry)
+            continue;
+        m_stringBytesDeduplicated += value.impl()->costDuringGC();
+        m_stringsDeduplicated++;
+        value = *addResult.iterator;
+    }
+
+    dataLogIf(Options::logGC(), "dedup=", m_stringsDeduplicated, " strings ", m_stringBytesDeduplicated / 1024, "kb ");
+}
+
 void Heap::removeDeadCompilerWorklistEntries()
 {
 #if ENABLE(DFG_JIT)
@@ -1053,6 +1187,58 @@ void Heap::sweepSynchronously()
     }
 }
 
+void Heap::notifyIdle(Seconds idleTime)
+{
+    MonotonicTime now = MonotonicTime::now();
+    MonotonicTime deadline = now + idleTime;
+    m_lastIdleNotificationTime = now;
+
+    // Installing finished compilations is cheap and lets the code run as soon as the mutator is busy again.
+#if ENABLE(JIT)
+    if (JITWorklist* worklist = JITWorklist::existingGlobalWorklistOrNull())
+        worklist->poll(vm());
+#endif
+#if ENABLE(DFG_JIT)
+    for (unsigned i = DFG::numberOfWorklists(); i--;) {
+        if (DFG::Worklist* worklist = DFG::existingWorklistForIndexOrNull(i))
+            worklist->completeAllReadyPlansForVM(vm());
+    }
+#endif
+
+    // Run the collection that the activity callbacks are waiting to run, if the last one of that
+    // kind would have fit in the time that is left.
+    if (!vm().entryScope && !isDeferred() && !m_collectionScope) {
+        auto isScheduled = [] (GCActivityCallback* callback) {
+            return callback && callback->isEnabled() && callback->timeUntilFire();
+        };
+        Seconds remaining = deadline - MonotonicTime::now();
+        if (isScheduled(m_fullActivityCallback.get()) && m_lastFullGCLength <= remaining)
+            collectSync(CollectionScope::Full);
+        else if (isScheduled(m_edenActivityCallback.get()) && m_lastEdenGCLength <= remaining)
+            collectSync(CollectionScope::Eden);
+    }
+
+    if (!sweeper().sweepUntil(vm(), deadline))
+        return;
+
+    if (!m_didShrinkSinceLastCollection && MonotonicTime::now() < deadline) {
+        m_objectSpace.shrink();
+        m_didShrinkSinceLastCollection = true;
+    }
+}
+
+bool Heap::shouldDeferTimerCollection(Seconds& delay) const
+{
+    if (!m_lastIdleNotificationTime)
+        return false;
+    MonotonicTime latestCollectionTime = m_lastIdleNotificationTime + Seconds::fromMilliseconds(Options::maximumIdleGCDeferralMilliseconds());
+    MonotonicTime now = MonotonicTime::now();
+    if (now >= latestCollectionTime)
+        return false;
+    delay = latestCollectionTime - now;
+    return true;
+}
+
 void Heap::collect(Synchronousness synchronousness, GCRequest request)
 {
     switch (synchronousness) {
@@ -1266,6 +1452,10 @@ NEVER_INLINE bool Heap::runBeginPhase(GCConductor conn)
     }
     
     willStartCollection();
+
+    // The concurrent sweeper reads mark bits, so it must be idle before we start changing them.
+    if (m_concurrentSweeper)
+        m_concurrentSweeper->stopSweeping();
         
     if (UNLIKELY(m_verifier)) {
         // Verify that live objects from the last GC cycle haven't been corrupted by
@@ -1307,6 +1497,12 @@ NEVER_INLINE bool Heap::runBeginPhase(GCConductor conn)
             Thread::registerGCThread(GCThreadType::Helper);
 
             {
+                // Helper threads are not tied to a visitor, so steer this thread to the node of the
+                // visitor it picked up while it drains.
+                Optional<MarkerTopology::NodePinningScope> pinningScope;
+                if (Options::useNUMAAwareMarking())
+                    pinningScope.emplace(MarkerTopology::singleton(), slotVisitor->markerNode());
+
                 ParallelModeEnabler parallelModeEnabler(*slotVisitor);
                 slotVisitor->drainFromShared(SlotVisitor::HelperDrain);
             }
@@ -1484,6 +1680,9 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
         m_markingConditionVariable.notifyAll();
     }
     m_helperClient.finish();
+
+    if (UNLIKELY(Options::logGC()) && (m_ephemeronFullTableVisits.load() || m_ephemeronIncrementalTableVisits.load()))
+        dataLog("eph=", m_ephemeronFullTableVisits.load(), "+", m_ephemeronIncrementalTableVisits.load(), " tables, ", m_ephemeronBucketsScanned.load(), " buckets, ", m_ephemeronValuesVisited.load(), " values ");
     
     iterateExecutingAndCompilingCodeBlocks(
         [&] (CodeBlock* codeBlock) {
@@ -1497,6 +1696,9 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
         m_verifier->gatherLiveCells(HeapVerifier::Phase::AfterMarking);
         m_verifier->verify(HeapVerifier::Phase::AfterMarking);
     }
+
+    if (UNLIKELY(m_allocationSampler))
+        m_allocationSampler->didFinishMarking();
         
     {
         auto* previous = Thread::current().setCurrentAtomStringTable(nullptr);
@@ -1508,6 +1710,8 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
             vm().typeProfiler()->invalidateTypeSetCache(vm());
 
         m_structureIDTable.flushOldTables();
+        if (Options::useStructureIDTableCompaction() && m_collectionScope && m_collectionScope.value() == CollectionScope::Full)
+            m_structureIDTable.compactFreeList();
 
         reapWeakHandles();
         pruneStaleEntriesFromWeakGCMaps();
@@ -1515,6 +1719,7 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
         snapshotUnswept();
         finalizeUnconditionalFinalizers(); // We rely on these unconditional finalizers running before clearCurrentlyExecuting since CodeBlock's finalizer relies on querying currently executing.
         removeDeadCompilerWorklistEntries();
+        deduplicateStrings();
     }
 
     notifyIncrementalSweeper();
@@ -1526,8 +1731,12 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
     m_codeBlocks->clearCurrentlyExecuting();
         
     m_objectSpace.prepareForAllocation();
+    m_handleSet.promoteNewStrongHandles();
     updateAllocationLimits();
 
+    if (m_concurrentSweeper && !m_isShuttingDown)
+        m_concurrentSweeper->startSweeping(m_objectSpace);
+
     if (UNLIKELY(m_verifier)) {
         m_verifier->trimDeadCells();
         m_verifier->verify(HeapVerifier::Phase::AfterGC);
@@ -1588,6 +1797,14 @@ NEVER_INLINE bool Heap::finishChangingPhase(GCConductor conn)
         dataLog(conn, ": Going to phase: ", m_nextPhase, " (from ", m_currentPhase, ")\n");
     
     m_phaseVersion++;
+    JSC_USDT_PROBE2(gc__phase, static_cast<int>(m_currentPhase), static_cast<int>(m_nextPhase));
+
+    if (UNLIKELY(Options::recordGCPauseTimes())) {
+        MonotonicTime now = MonotonicTime::now();
+        auto locker = holdLock(m_pauseRecordingLock);
+        m_pauseRecording.phaseTimes[static_cast<unsigned>(m_currentPhase)] += now - m_currentPhaseStartTime;
+        m_currentPhaseStartTime = now;
+    }
     
     bool suspendedBefore = worldShouldBeSuspended(m_currentPhase);
     bool suspendedAfter = worldShouldBeSuspended(m_nextPhase);
@@ -1624,6 +1841,27 @@ NEVER_INLINE bool Heap::finishChangingPhase(GCConductor conn)
     return true;
 }
 
+auto Heap::pauseRecording() -> PauseRecording
+{
+    auto locker = holdLock(m_pauseRecordingLock);
+    return m_pauseRecording;
+}
+
+void Heap::resetPauseRecording()
+{
+    auto locker = holdLock(m_pauseRecordingLock);
+    m_pauseRecording = { MonotonicTime::now(), { }, { } };
+    m_currentPhaseStartTime = m_pauseRecording.start;
+    m_constraintSet->forEach([] (MarkingConstraint& constraint) {
+        constraint.resetRecordedStats();
+    });
+}
+
+void Heap::forEachMarkingConstraint(const ScopedLambda<void(MarkingConstraint&)>& func)
+{
+    m_constraintSet->forEach(func);
+}
+
 void Heap::stopThePeriphery(GCConductor conn)
 {
     if (m_worldIsStopped) {
@@ -1678,6 +1916,11 @@ NEVER_INLINE void Heap::resumeThePeriphery()
         RELEASE_ASSERT_NOT_REACHED();
     }
     m_worldIsStopped = false;
+
+    if (UNLIKELY(Options::recordGCPauseTimes())) {
+        auto locker = holdLock(m_pauseRecordingLock);
+        m_pauseRecording.pauses.append({ m_stopTime, MonotonicTime::now() });
+    }
     
     // FIXME: This could be vastly improved: we want to grab the locks in the order in which they
     // become available. We basically want a lockAny() method that will lock whatever lock is available
@@ -2098,10 +2341,27 @@ void Heap::finalize()
     if (HasOwnPropertyCache* cache = vm().hasOwnPropertyCache())
         cache->clear();
 
+    if (MegamorphicCache* cache = vm().megamorphicCache())
+        cache->clear();
+
+    if (ObjectCloneCache* cache = vm().objectCloneCache())
+        cache->clear();
+
     immutableButterflyToStringCache.clear();
+
+    // Let go of the rope append buffer once no string uses it anymore.
+    if (vm().ropeAppendBuffer && vm().ropeAppendBuffer->hasOneRef())
+        vm().ropeAppendBuffer = nullptr;
+    vm().numericStrings.clearJSStringCache();
+#if USE(JSVALUE64)
+    vm().llintPolymorphicGetByIdCache.clear();
+#endif
+    vm().dictionaryFlatteningPolicy.clear();
     
     for (const HeapFinalizerCallback& callback : m_heapFinalizerCallbacks)
         callback.run(vm());
+
+    m_objectSpace.releaseExcessEmptyBlocks();
     
     if (shouldSweepSynchronously())
         sweepSynchronously();
@@ -2327,6 +2587,29 @@ void Heap::updateAllocationLimits()
         }
     }
 
+    if (m_growthPolicy) {
+        HeapGrowthInputs inputs;
+        inputs.scope = m_collectionScope ? *m_collectionScope : CollectionScope::Full;
+        inputs.liveBytes = currentHeapSize;
+        inputs.sizeAfterLastFullCollection = m_sizeAfterLastFullCollect;
+        inputs.bytesAllocatedThisCycle = m_bytesAllocatedThisCycle;
+        inputs.mutatorTimeThisCycle = m_afterGC ? m_beforeGC - m_afterGC : Seconds();
+        inputs.allocationRate = inputs.mutatorTimeThisCycle ? m_bytesAllocatedThisCycle / inputs.mutatorTimeThisCycle.seconds() : 0;
+        inputs.lastFullCollectionDuration = m_lastFullGCLength;
+        inputs.lastEdenCollectionDuration = m_lastEdenGCLength;
+        inputs.ramSize = m_ramSize;
+
+        HeapGrowthLimits limits { m_maxHeapSize, m_shouldDoFullCollection };
+        m_growthPolicy->computeLimits(inputs, limits);
+
+        // The heap cannot already be past the point where the next collection should have started.
+        m_maxHeapSize = std::max(limits.maxHeapSize, currentHeapSize);
+        m_maxEdenSize = m_maxHeapSize - currentHeapSize;
+        m_shouldDoFullCollection = limits.shouldDoFullCollection;
+        if (verbose)
+            dataLog("Policy: maxHeapSize = ", m_maxHeapSize, ", maxEdenSize = ", m_maxEdenSize, "\n");
+    }
+
 #if USE(BMALLOC_MEMORY_FOOTPRINT_API)
     // Get critical memory threshold for next cycle.
     overCriticalMemoryThreshold(MemoryThresholdCallType::Direct);
@@ -2337,12 +2620,38 @@ void Heap::updateAllocationLimits()
         dataLog("sizeAfterLastCollect = ", m_sizeAfterLastCollect, "\n");
     m_bytesAllocatedThisCycle = 0;
 
+    if (m_isRegisteredWithBudgetCoordinator)
+        reportFootprintToBudgetCoordinator();
+
     dataLogIf(Options::logGC(), "=> ", currentHeapSize / 1024, "kb, ");
 }
 
+void Heap::reportFootprintToBudgetCoordinator()
+{
+    ASSERT(m_isRegisteredWithBudgetCoordinator);
+    m_bytesAllocatedSinceBudgetReport = 0;
+    HeapBudgetCoordinator::singleton().didUpdateFootprint(
+        *this, m_sizeAfterLastCollect + m_bytesAllocatedThisCycle, m_sizeAfterLastCollect, m_sizeAfterLastFullCollect,
+        overCriticalMemoryThreshold());
+}
+
+void Heap::scheduleCollectionForBudget(CollectionScope scope)
+{
+    // The activity callbacks are created with the Heap and live as long as it does, and
+    // JSRunLoopTimer scheduling is thread safe.
+    GCActivityCallback* callback = nullptr;
+    if (scope == CollectionScope::Full)
+        callback = m_fullActivityCallback.get();
+    else
+        callback = m_edenActivityCallback.get();
+    if (callback && callback->isEnabled())
+        callback->scheduleCollectionSoon();
+}
+
 void Heap::didFinishCollection()
 {
     m_afterGC = MonotonicTime::now();
+    m_didShrinkSinceLastCollection = false;
     CollectionScope scope = *m_collectionScope;
     if (scope == CollectionScope::Full)
         m_lastFullGCLength = m_afterGC - m_beforeGC;
@@ -2394,6 +2703,14 @@ IncrementalSweeper& Heap::sweeper()
     return m_sweeper.get();
 }
 
+void Heap::setGrowthPolicy(std::unique_ptr<HeapGrowthPolicy> policy)
+{
+    // The policy is only used at the end of a collection, when the world is stopped. Since we
+    // have heap access, no collection can be at that point right now.
+    ASSERT(hasHeapAccess());
+    m_growthPolicy = WTFMove(policy);
+}
+
 void Heap::setGarbageCollectionTimerEnabled(bool enable)
 {
     if (m_fullActivityCallback)
@@ -2407,6 +2724,11 @@ void Heap::didAllocate(size_t bytes)
     if (m_edenActivityCallback)
         m_edenActivityCallback->didAllocate(*this, m_bytesAllocatedThisCycle + m_bytesAbandonedSinceLastFullCollect);
     m_bytesAllocatedThisCycle += bytes;
+    if (m_isRegisteredWithBudgetCoordinator) {
+        m_bytesAllocatedSinceBudgetReport += bytes;
+        if (m_bytesAllocatedSinceBudgetReport >= Options::heapBudgetReportInterval())
+            reportFootprintToBudgetCoordinator();
+    }
     performIncrement(bytes);
 }
 
@@ -2747,6 +3069,9 @@ void Heap::addCoreConstraints()
                 SetRootMarkReasonScope rootScope(slotVisitor, SlotVisitor::RootMarkReason::ProtectedValues);
                 for (auto& pair : m_protectedValues)
                     slotVisitor.appendUnbarriered(pair.key);
+                m_protectedValueTable.forEachCell([&] (JSCell* cell) {
+                    slotVisitor.appendUnbarriered(cell);
+                });
             }
             
             if (m_markListSet && m_markListSet->size()) {
@@ -2995,6 +3320,19 @@ void Heap::removeHeapFinalizerCallback(const HeapFinalizerCallback& callback)
     m_heapFinalizerCallbacks.removeFirst(callback);
 }
 
+void Heap::startAllocationSampling(size_t sampleInterval)
+{
+    ASSERT(vm().currentThreadIsHoldingAPILock());
+    // Samples from a previous session refer to cells we have stopped tracking, so start over.
+    m_allocationSampler = makeUnique<HeapAllocationSampler>(vm(), sampleInterval);
+}
+
+std::unique_ptr<HeapAllocationSampler> Heap::stopAllocationSampling()
+{
+    ASSERT(vm().currentThreadIsHoldingAPILock());
+    return WTFMove(m_allocationSampler);
+}
+
 void Heap::setBonusVisitorTask(RefPtr<SharedTask<void(SlotVisitor&)>> task)
 {
     auto locker = holdLock(m_markingMutex);
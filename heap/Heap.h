@@ -38,6 +38,7 @@
 #include "MarkedSpace.h"
 #include "MutatorState.h"
 #include "Options.h"
+#include "ProtectedValueTable.h"
 #include "StructureIDTable.h"
 #include "Synchronousness.h"
 #include "WeakHandleOwner.h"
@@ -48,12 +49,14 @@
 #include <wtf/HashSet.h>
 #include <wtf/Markable.h>
 #include <wtf/ParallelHelperPool.h>
+#include <wtf/ScopedLambda.h>
 #include <wtf/Threading.h>
 
 namespace JSC {
 
 class CodeBlock;
 class CodeBlockSet;
+class ConcurrentSweeper;
 class CollectingScope;
 class ConservativeRoots;
 class GCDeferralContext;
@@ -62,6 +65,8 @@ class FullGCActivityCallback;
 class GCActivityCallback;
 class GCAwareJITStubRoutine;
 class Heap;
+class HeapAllocationSampler;
+class HeapGrowthPolicy;
 class HeapProfiler;
 class HeapVerifier;
 class IncrementalSweeper;
@@ -159,7 +164,29 @@ public:
     JS_EXPORT_PRIVATE GCActivityCallback* edenActivityCallback();
     JS_EXPORT_PRIVATE void setGarbageCollectionTimerEnabled(bool);
 
+    // Replaces the built-in proportional growth heuristics. Pass nullptr to go back to them.
+    JS_EXPORT_PRIVATE void setGrowthPolicy(std::unique_ptr<HeapGrowthPolicy>);
+    HeapGrowthPolicy* growthPolicy() const { return m_growthPolicy.get(); }
+
+    // Bumped at the start of marking, so it identifies a collection of either scope.
+    uint64_t collectionNumber() const { return m_collectionNumber; }
+
+    // May be called concurrently by the markers that execute output constraints.
+    void didVisitEphemeronTable(size_t bucketsScanned, size_t valuesVisited, bool wasIncremental)
+    {
+        m_ephemeronBucketsScanned.exchangeAdd(bucketsScanned);
+        m_ephemeronValuesVisited.exchangeAdd(valuesVisited);
+        if (wasIncremental)
+            m_ephemeronIncrementalTableVisits.exchangeAdd(1);
+        else
+            m_ephemeronFullTableVisits.exchangeAdd(1);
+    }
+
+    // Used by HeapBudgetCoordinator. May be called from any thread.
+    void scheduleCollectionForBudget(CollectionScope);
+
     JS_EXPORT_PRIVATE IncrementalSweeper& sweeper();
+    ConcurrentSweeper* concurrentSweeper() const { return m_concurrentSweeper.get(); }
 
     void addObserver(HeapObserver* observer) { m_observers.append(observer); }
     void removeObserver(HeapObserver* observer) { m_observers.removeFirst(observer); }
@@ -184,6 +211,10 @@ public:
     
     bool isShuttingDown() const { return m_isShuttingDown; }
 
+    // Totals since the Heap was created, for Options::useStringDeduplication().
+    uint64_t stringsDeduplicated() const { return m_stringsDeduplicated; }
+    uint64_t stringBytesDeduplicated() const { return m_stringBytesDeduplicated; }
+
     JS_EXPORT_PRIVATE bool isAnalyzingHeap() const;
 
     JS_EXPORT_PRIVATE void sweepSynchronously();
@@ -211,6 +242,19 @@ public:
     JS_EXPORT_PRIVATE void collectNow(Synchronousness, GCRequest = GCRequest());
     
     JS_EXPORT_PRIVATE void collectNowFullIfNotDoneRecently(Synchronousness);
+
+    // Tells the heap that the embedder expects to stay idle for idleTime. Within that time, this
+    // installs finished JIT plans, runs the collection the activity callbacks are waiting for if it
+    // fits, sweeps, and then returns empty blocks to the system.
+    JS_EXPORT_PRIVATE void notifyIdle(Seconds idleTime);
+
+    // The next full collection jettisons CodeBlocks that have not executed since time, as if they had
+    // aged out.
+    void jettisonCodeNotExecutedSince(MonotonicTime time) { m_requestedColdCodeThreshold = time; }
+
+    // While idle notifications keep coming, activity callbacks wait for the next one instead of
+    // collecting in the middle of the embedder's work, for a bounded time given in delay.
+    bool shouldDeferTimerCollection(Seconds& delay) const;
     
     void collectIfNecessaryOrDefer(GCDeferralContext* = nullptr);
 
@@ -235,6 +279,11 @@ public:
 
     JS_EXPORT_PRIVATE void protect(JSValue);
     JS_EXPORT_PRIVATE bool unprotect(JSValue); // True when the protect count drops to 0.
+
+    // Handle based protection. Each call hands out a distinct handle, so there is no per-value count.
+    JS_EXPORT_PRIVATE ProtectedValueTable::Handle protectWithHandle(JSValue);
+    JS_EXPORT_PRIVATE void releaseProtectHandle(ProtectedValueTable::Handle);
+    JSValue protectedValue(ProtectedValueTable::Handle handle) const { return m_protectedValueTable.get(handle); }
     
     JS_EXPORT_PRIVATE size_t extraMemorySize(); // Non-GC memory referenced by GC objects.
     JS_EXPORT_PRIVATE size_t size();
@@ -388,6 +437,10 @@ public:
     size_t numOpaqueRoots() const { return m_opaqueRoots.size(); }
 
     HeapVerifier* verifier() const { return m_verifier.get(); }
+
+    HeapAllocationSampler* allocationSampler() const { return m_allocationSampler.get(); }
+    JS_EXPORT_PRIVATE void startAllocationSampling(size_t sampleInterval);
+    JS_EXPORT_PRIVATE std::unique_ptr<HeapAllocationSampler> stopAllocationSampling();
     
     void addHeapFinalizerCallback(const HeapFinalizerCallback&);
     void removeHeapFinalizerCallback(const HeapFinalizerCallback&);
@@ -405,6 +458,21 @@ public:
     
     Seconds totalGCTime() const { return m_totalGCTime; }
 
+    // Only recorded while Options::recordGCPauseTimes() is set.
+    struct RecordedPause {
+        MonotonicTime start;
+        MonotonicTime end;
+    };
+    struct PauseRecording {
+        MonotonicTime start;
+        Vector<RecordedPause> pauses;
+        std::array<Seconds, numberOfCollectorPhases> phaseTimes;
+    };
+    JS_EXPORT_PRIVATE PauseRecording pauseRecording();
+    JS_EXPORT_PRIVATE void resetPauseRecording();
+
+    JS_EXPORT_PRIVATE void forEachMarkingConstraint(const ScopedLambda<void(MarkingConstraint&)>&);
+
     HashMap<JSImmutableButterfly*, JSString*> immutableButterflyToStringCache;
 
 private:
@@ -427,6 +495,7 @@ private:
     friend class MarkedBlock;
     friend class RunningScope;
     friend class SlotVisitor;
+    friend class PauseTimeMutatorScheduler;
     friend class SpaceTimeMutatorScheduler;
     friend class StochasticSpaceTimeMutatorScheduler;
     friend class SweepingScope;
@@ -530,6 +599,7 @@ private:
     void sweepArrayBuffers();
     void snapshotUnswept();
     void deleteSourceProviderCaches();
+    void deduplicateStrings();
     void notifyIncrementalSweeper();
     void harvestWeakReferences();
 
@@ -541,6 +611,7 @@ private:
     void deleteUnmarkedCompiledCode();
     JS_EXPORT_PRIVATE void addToRememberedSet(const JSCell*);
     void updateAllocationLimits();
+    void reportFootprintToBudgetCoordinator();
     void didFinishCollection();
     void resumeCompilerThreads();
     void gatherExtraHeapData(HeapProfiler&);
@@ -602,6 +673,8 @@ private:
 
     size_t m_bytesAllocatedThisCycle { 0 };
     size_t m_bytesAbandonedSinceLastFullCollect { 0 };
+    uint64_t m_stringsDeduplicated { 0 };
+    uint64_t m_stringBytesDeduplicated { 0 };
     size_t m_maxEdenSize;
     size_t m_maxEdenSizeWhenCritical;
     size_t m_maxHeapSize;
@@ -610,6 +683,14 @@ private:
     double m_incrementBalance { 0 };
     
     bool m_shouldDoFullCollection { false };
+    std::unique_ptr<HeapGrowthPolicy> m_growthPolicy;
+    uint64_t m_collectionNumber { 0 };
+    Atomic<size_t> m_ephemeronBucketsScanned { 0 };
+    Atomic<size_t> m_ephemeronValuesVisited { 0 };
+    Atomic<size_t> m_ephemeronFullTableVisits { 0 };
+    Atomic<size_t> m_ephemeronIncrementalTableVisits { 0 };
+    bool m_isRegisteredWithBudgetCoordinator { false };
+    size_t m_bytesAllocatedSinceBudgetReport { 0 };
     Markable<CollectionScope, EnumMarkableTraits<CollectionScope>> m_collectionScope;
     Markable<CollectionScope, EnumMarkableTraits<CollectionScope>> m_lastCollectionScope;
     Lock m_raceMarkStackLock;
@@ -626,6 +707,7 @@ private:
     HashSet<const JSCell*> m_copyingRememberedSet;
 
     ProtectCountSet m_protectedValues;
+    ProtectedValueTable m_protectedValueTable;
     std::unique_ptr<HashSet<MarkedArgumentBuffer*>> m_markListSet;
     SentinelLinkedList<MarkedJSValueRefArray, BasicRawSentinelNode<MarkedJSValueRefArray>> m_markedJSValueRefArrays;
 
@@ -642,6 +724,7 @@ private:
     // one GC to the next. GC marking threads claim these at the start of marking, and return
     // them at the end.
     Vector<std::unique_ptr<SlotVisitor>> m_parallelSlotVisitors;
+    Vector<SlotVisitor*> m_stealableSlotVisitors;
     Vector<SlotVisitor*> m_availableParallelSlotVisitors;
     
     HandleSet m_handleSet;
@@ -667,6 +750,7 @@ private:
     RefPtr<FullGCActivityCallback> m_fullActivityCallback;
     RefPtr<GCActivityCallback> m_edenActivityCallback;
     Ref<IncrementalSweeper> m_sweeper;
+    RefPtr<ConcurrentSweeper> m_concurrentSweeper;
     Ref<StopIfNecessaryTimer> m_stopIfNecessaryTimer;
 
     Vector<HeapObserver*> m_observers;
@@ -674,6 +758,7 @@ private:
     Vector<HeapFinalizerCallback> m_heapFinalizerCallbacks;
     
     std::unique_ptr<HeapVerifier> m_verifier;
+    std::unique_ptr<HeapAllocationSampler> m_allocationSampler;
 
 #if USE(FOUNDATION)
     Vector<RetainPtr<CFTypeRef>> m_delayedReleaseObjects;
@@ -747,7 +832,14 @@ private:
     MonotonicTime m_lastGCStartTime;
     MonotonicTime m_lastGCEndTime;
     MonotonicTime m_currentGCStartTime;
+    MonotonicTime m_lastIdleNotificationTime;
+    MonotonicTime m_requestedColdCodeThreshold;
+    bool m_didShrinkSinceLastCollection { false };
     Seconds m_totalGCTime;
+
+    Lock m_pauseRecordingLock;
+    PauseRecording m_pauseRecording { MonotonicTime::now(), { }, { } };
+    MonotonicTime m_currentPhaseStartTime { MonotonicTime::now() };
     
     uintptr_t m_barriersExecuted { 0 };
     
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "HeapAllocationSampler.h"
+
+#include "CallFrame.h"
+#include "HeapCell.h"
+#include "StackVisitor.h"
+#include "VM.h"
+#include <cmath>
+
+namespace JSC {
+
+HeapAllocationSampler::HeapAllocationSampler(VM& vm, size_t sampleInterval)
+    : m_vm(vm)
+    , m_sampleInterval(std::max<size_t>(sampleInterval, 1))
+{
+    m_bytesUntilNextSample = nextSampleDistance();
+}
+
+size_t HeapAllocationSampler::nextSampleDistance()
+{
+    // Exponentially distributed gaps make the sample points a Poisson process over allocated bytes,
+    // so an allocation's chance of being sampled does not depend on how it lines up with the others.
+    double distance = -std::log(1 - m_random.get()) * m_sampleInterval;
+    return std::max<size_t>(static_cast<size_t>(distance), 1);
+}
+
+unsigned HeapAllocationSampler::didCrossSamplePoint(size_t bytes)
+{
+    unsigned sampledIntervals = 0;
+    while (bytes >= m_bytesUntilNextSample) {
+        bytes -= m_bytesUntilNextSample;
+        m_bytesUntilNextSample = nextSampleDistance();
+        sampledIntervals++;
+    }
+    m_bytesUntilNextSample -= bytes;
+    return sampledIntervals;
+}
+
+void HeapAllocationSampler::recordSample(unsigned sampledIntervals, HeapCell* cell, unsigned cellSize)
+{
+    ASSERT(sampledIntervals);
+
+    Sample sample;
+    sample.bytes = static_cast<size_t>(sampledIntervals) * m_sampleInterval;
+    sample.cellSize = cellSize;
+    sample.cell = cell;
+
+    // We are in the middle of an allocation, so this must not allocate in the GC heap. StackVisitor
+    // only reads the frames and the metadata hanging off their CodeBlocks.
+    if (CallFrame* topCallFrame = m_vm.topCallFrame) {
+        topCallFrame->iterate(m_vm, [&] (StackVisitor& visitor) -> StackVisitor::Status {
+            if (sample.stackTrace.size() == maxStackTraceDepth)
+                return StackVisitor::Done;
+            Frame frame;
+            visitor->computeLineAndColumn(frame.line, frame.column);
+            frame.functionName = visitor->functionName();
+            frame.url = visitor->sourceURL();
+            frame.sourceID = visitor->sourceID();
+            sample.stackTrace.append(WTFMove(frame));
+            return StackVisitor::Continue;
+        });
+    }
+
+    auto locker = holdLock(m_lock);
+    if (m_samples.size() >= maxSampleCount) {
+        m_droppedSampleCount++;
+        return;
+    }
+    m_samples.append(WTFMove(sample));
+}
+
+void HeapAllocationSampler::didFinishMarking()
+{
+    auto locker = holdLock(m_lock);
+    for (Sample& sample : m_samples) {
+        if (sample.cell && !sample.cell->isLive())
+            sample.cell = nullptr;
+    }
+}
+
+auto HeapAllocationSampler::takeSamples() -> Vector<Sample>
+{
+    auto locker = holdLock(m_lock);
+    return std::exchange(m_samples, { });
+}
+
+} // namespace JSC
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <wtf/Lock.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
+#include <wtf/WeakRandom.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class HeapCell;
+class VM;
+
+// Poisson-samples allocations made through LocalAllocator's slow path. Every time a free list is
+// exhausted we learn how many bytes were bump- or list-allocated from it, which lets us take a
+// sample every sampleInterval() bytes on average without touching the inline allocation fast paths.
+// Each sample remembers the JS stack of the allocation that refilled the free list and the cell it
+// got, so that we can tell which sampled allocations are still alive after each GC.
+class HeapAllocationSampler {
+    WTF_MAKE_NONCOPYABLE(HeapAllocationSampler);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr unsigned maxStackTraceDepth = 32;
+    static constexpr size_t maxSampleCount = 100000;
+
+    struct Frame {
+        String functionName;
+        String url;
+        intptr_t sourceID { 0 };
+        unsigned line { 0 };
+        unsigned column { 0 };
+    };
+
+    struct Sample {
+        bool isLive() const { return !!cell; }
+
+        Vector<Frame> stackTrace;
+        // Bytes this sample stands for, which is a multiple of the sample interval.
+        size_t bytes { 0 };
+        unsigned cellSize { 0 };
+        // Cleared once a GC finds the cell dead, so it is only meaningful as an identity.
+        HeapCell* cell { nullptr };
+    };
+
+    HeapAllocationSampler(VM&, size_t sampleInterval);
+
+    size_t sampleInterval() const { return m_sampleInterval; }
+
+    // Called from the allocation slow path with the bytes handed out since the last refill. Returns
+    // how many sample points those bytes crossed; if nonzero the caller should recordSample().
+    unsigned didAllocate(size_t bytes)
+    {
+        if (LIKELY(bytes < m_bytesUntilNextSample)) {
+            m_bytesUntilNextSample -= bytes;
+            return 0;
+        }
+        return didCrossSamplePoint(bytes);
+    }
+
+    void recordSample(unsigned sampledIntervals, HeapCell*, unsigned cellSize);
+
+    // Called while the world is stopped after marking, before anything is swept.
+    void didFinishMarking();
+
+    Vector<Sample> takeSamples();
+    size_t droppedSampleCount() const { return m_droppedSampleCount; }
+
+private:
+    unsigned didCrossSamplePoint(size_t bytes);
+    size_t nextSampleDistance();
+
+    VM& m_vm;
+    size_t m_sampleInterval;
+    size_t m_bytesUntilNextSample;
+    WeakRandom m_random;
+    Lock m_lock;
+    Vector<Sample> m_samples;
+    size_t m_droppedSampleCount { 0 };
+};
+
+} // namespace JSC
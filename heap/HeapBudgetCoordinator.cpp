@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "HeapBudgetCoordinator.h"
+
+#include "JSCInlines.h"
+#include <mutex>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+// We do not want a burst of reports from many threads to turn into a burst of collections, nor a
+// heap that was just asked to collect to be asked again before it got the chance.
+static constexpr Seconds minimumTimeBetweenRequests = 100_ms;
+
+// How far ahead we look when weighing allocation rate against bytes that are already reclaimable.
+static constexpr Seconds allocationRateHorizon = 100_ms;
+
+bool HeapBudgetCoordinator::isEnabled()
+{
+    return !!Options::heapBudgetSoftLimit();
+}
+
+HeapBudgetCoordinator& HeapBudgetCoordinator::singleton()
+{
+    static std::once_flag onceFlag;
+    static HeapBudgetCoordinator* coordinator;
+    std::call_once(
+        onceFlag,
+        [] {
+            coordinator = new HeapBudgetCoordinator();
+        });
+    return *coordinator;
+}
+
+void HeapBudgetCoordinator::registerHeap(Heap& heap)
+{
+    auto locker = holdLock(m_lock);
+    auto result = m_heaps.add(&heap, Entry());
+    RELEASE_ASSERT(result.isNewEntry);
+    result.iterator->value.lastReport = MonotonicTime::now();
+}
+
+void HeapBudgetCoordinator::unregisterHeap(Heap& heap)
+{
+    auto locker = holdLock(m_lock);
+    auto iter = m_heaps.find(&heap);
+    if (iter == m_heaps.end())
+        return;
+    m_totalFootprint -= iter->value.footprint;
+    m_heaps.remove(iter);
+}
+
+void HeapBudgetCoordinator::didUpdateFootprint(Heap& heap, size_t footprint, size_t liveBytes, size_t sizeAfterLastFullCollection, bool isUnderMemoryPressure)
+{
+    auto locker = holdLock(m_lock);
+    auto iter = m_heaps.find(&heap);
+    if (iter == m_heaps.end())
+        return;
+    
+    Entry& entry = iter->value;
+    MonotonicTime now = MonotonicTime::now();
+    Seconds elapsed = now - entry.lastReport;
+    if (footprint > entry.footprint && elapsed > 0_s) {
+        double rate = (footprint - entry.footprint) / elapsed.seconds();
+        entry.allocationRate = entry.allocationRate ? (entry.allocationRate + rate) / 2 : rate;
+    }
+    
+    m_totalFootprint -= entry.footprint;
+    m_totalFootprint += footprint;
+    entry.footprint = footprint;
+    entry.liveBytes = liveBytes;
+    entry.sizeAfterLastFullCollection = sizeAfterLastFullCollection;
+    entry.lastReport = now;
+    
+    if (m_totalFootprint <= Options::heapBudgetSoftLimit() && !isUnderMemoryPressure)
+        return;
+    if (now - m_lastRequest < minimumTimeBetweenRequests)
+        return;
+    requestCollections(locker, now);
+}
+
+size_t HeapBudgetCoordinator::totalFootprint()
+{
+    auto locker = holdLock(m_lock);
+    return m_totalFootprint;
+}
+
+double HeapBudgetCoordinator::score(const Entry& entry)
+{
+    // Anything allocated since the last collection may be garbage. Heaps that allocate quickly
+    // will have the most of it by the time the collection actually runs.
+    double reclaimable = entry.footprint > entry.liveBytes ? entry.footprint - entry.liveBytes : 0;
+    return reclaimable + entry.allocationRate * allocationRateHorizon.seconds();
+}
+
+void HeapBudgetCoordinator::requestCollections(const AbstractLocker&, MonotonicTime now)
+{
+    Vector<std::pair<double, Heap*>, 16> candidates;
+    for (auto& pair : m_heaps) {
+        if (now - pair.value.lastRequest < minimumTimeBetweenRequests)
+            continue;
+        double score = HeapBudgetCoordinator::score(pair.value);
+        if (score > 0)
+            candidates.append({ score, pair.key });
+    }
+    
+    std::sort(
+        candidates.begin(), candidates.end(),
+        [] (const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+    
+    unsigned count = std::min<size_t>(candidates.size(), Options::heapBudgetCollectionsPerRequest());
+    for (unsigned i = 0; i < count; ++i) {
+        Heap* heap = candidates[i].second;
+        Entry& entry = m_heaps.find(heap)->value;
+        // If the heap has more than doubled since its last full collection, most of what it holds
+        // is probably old, and an eden collection would not get it back.
+        bool full = entry.footprint > 2 * entry.sizeAfterLastFullCollection;
+        // We hold m_lock, so the heap cannot unregister and be destroyed underneath us.
+        heap->scheduleCollectionForBudget(full ? CollectionScope::Full : CollectionScope::Eden);
+        entry.lastRequest = now;
+        
+        dataLogLnIf(Options::logGC(), "HeapBudgetCoordinator: total ", m_totalFootprint / 1024, "kb, asking heap ", RawPointer(heap), " with ", entry.footprint / 1024, "kb for a ", full ? "full" : "eden", " collection");
+    }
+    m_lastRequest = now;
+}
+
+} // namespace JSC
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Noncopyable.h>
+
+namespace JSC {
+
+class Heap;
+
+// Each Heap decides on its own when to collect, so a process with many VMs tends to let all
+// of them grow to their high watermarks. When Options::heapBudgetSoftLimit() is set, every Heap
+// reports its footprint here. Once the sum crosses the soft limit, or bmalloc says the process is
+// critically short of memory, the coordinator asks the heaps with the most to gain to collect
+// soon. It does that through their GC activity timers, so the collection runs on each VM's own
+// thread when it next gets to its run loop.
+class HeapBudgetCoordinator {
+    WTF_MAKE_NONCOPYABLE(HeapBudgetCoordinator);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static bool isEnabled();
+    static HeapBudgetCoordinator& singleton();
+
+    void registerHeap(Heap&);
+    void unregisterHeap(Heap&);
+
+    // Called by a Heap on its own thread. footprint is everything the heap holds right now and
+    // liveBytes is what survived its last collection.
+    void didUpdateFootprint(Heap&, size_t footprint, size_t liveBytes, size_t sizeAfterLastFullCollection, bool isUnderMemoryPressure);
+
+    size_t totalFootprint();
+
+private:
+    HeapBudgetCoordinator() = default;
+
+    struct Entry {
+        size_t footprint { 0 };
+        size_t liveBytes { 0 };
+        size_t sizeAfterLastFullCollection { 0 };
+        double allocationRate { 0 }; // Bytes per second, smoothed.
+        MonotonicTime lastReport;
+        MonotonicTime lastRequest;
+    };
+
+    static double score(const Entry&);
+    void requestCollections(const AbstractLocker&, MonotonicTime now);
+
+    Lock m_lock;
+    HashMap<Heap*, Entry> m_heaps;
+    size_t m_totalFootprint { 0 };
+    MonotonicTime m_lastRequest;
+};
+
+} // namespace JSC
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "CollectionScope.h"
+#include <wtf/FastMalloc.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Seconds.h>
+
+namespace JSC {
+
+// What the heap knows at the end of a collection when it decides when to start the next one.
+struct HeapGrowthInputs {
+    CollectionScope scope; // The scope of the collection that just finished.
+    size_t liveBytes; // Bytes visited plus extra memory, i.e. what survived.
+    size_t sizeAfterLastFullCollection;
+    size_t bytesAllocatedThisCycle; // Since the end of the previous collection.
+    Seconds mutatorTimeThisCycle; // From the end of the previous collection to the start of this one.
+    double allocationRate; // bytesAllocatedThisCycle / mutatorTimeThisCycle, in bytes per second.
+    Seconds lastFullCollectionDuration;
+    Seconds lastEdenCollectionDuration;
+    size_t ramSize;
+};
+
+// When the next collection is triggered. The heap fills this in with its own decision first, so a
+// policy only needs to change what it cares about.
+struct HeapGrowthLimits {
+    size_t maxHeapSize; // The next collection starts once the heap grows past this size.
+    bool shouldDoFullCollection; // Make the next collection a full one.
+};
+
+// Embedders that share a memory budget between many VMs can install a HeapGrowthPolicy on each
+// Heap to decide how far it may grow before collecting again. The policy is consulted on the
+// collector's thread at the end of every collection, with the world stopped.
+class HeapGrowthPolicy {
+    WTF_MAKE_NONCOPYABLE(HeapGrowthPolicy);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    HeapGrowthPolicy() = default;
+    virtual ~HeapGrowthPolicy() = default;
+
+    virtual void computeLimits(const HeapGrowthInputs&, HeapGrowthLimits&) = 0;
+};
+
+} // namespace JSC
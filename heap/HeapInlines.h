@@ -153,6 +153,7 @@ template<typename Functor> inline void Heap::forEachProtectedCell(const Functor&
 {
     for (auto& pair : m_protectedValues)
         functor(pair.key);
+    m_protectedValueTable.forEachCell(functor);
     m_handleSet.forEachStrongHandle(functor, m_protectedValues);
 }
 
@@ -86,7 +86,9 @@ void HeapSnapshot::shrinkToFit()
         m_nodes.removeAllMatching(
             [&] (const HeapSnapshotNode& node) -> bool {
                 bool willRemoveCell = bitwise_cast<intptr_t>(node.cell) & CellToSweepTag;
-                if (!willRemoveCell)
+                if (willRemoveCell)
+                    m_sweptIdentifiers.append(node.identifier);
+                else
                     m_filter.add(bitwise_cast<uintptr_t>(node.cell));
                 return willRemoveCell;
             });
@@ -103,6 +105,14 @@ void HeapSnapshot::finalize()
     ASSERT(!m_finalized);
     m_finalized = true;
 
+    // Only the most recent snapshot keeps what was collected before it, so that these lists stay
+    // bounded by the number of nodes there ever were.
+    for (HeapSnapshot* snapshot = m_previous; snapshot; snapshot = snapshot->m_previous) {
+        m_collectedIdentifiers.appendVector(snapshot->m_sweptIdentifiers);
+        snapshot->m_sweptIdentifiers.clear();
+        snapshot->m_collectedIdentifiers.clear();
+    }
+
     // Nodes are appended to the snapshot in identifier order.
     // Now that we have the complete list of nodes we will sort
     // them in a different order. Remember the range of identifiers
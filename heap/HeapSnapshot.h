@@ -52,6 +52,10 @@ private:
     static constexpr intptr_t CellToSweepTag = 1;
 
     Vector<HeapSnapshotNode> m_nodes;
+    // Identifiers of this snapshot's nodes that have been swept, until the next snapshot takes them.
+    Vector<NodeIdentifier> m_sweptIdentifiers;
+    // Identifiers of earlier snapshots' nodes that were swept before this snapshot was finalized.
+    Vector<NodeIdentifier> m_collectedIdentifiers;
     TinyBloomFilter m_filter;
     HeapSnapshot* m_previous { nullptr };
     unsigned m_firstObjectIdentifier { 0 };
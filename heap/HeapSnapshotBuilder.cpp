@@ -35,6 +35,7 @@
 #include "PreventCollectionScope.h"
 #include "VM.h"
 #include <wtf/HexNumber.h>
+#include <wtf/text/Base64.h>
 #include <wtf/text/StringBuilder.h>
 
 namespace JSC {
@@ -82,6 +83,13 @@ void HeapSnapshotBuilder::buildSnapshot()
     m_profiler.appendSnapshot(WTFMove(m_snapshot));
 }
 
+void HeapSnapshotBuilder::buildDeltaSnapshot()
+{
+    ASSERT(m_snapshotType == SnapshotType::InspectorSnapshot);
+    m_isDeltaSnapshot = true;
+    buildSnapshot();
+}
+
 void HeapSnapshotBuilder::analyzeNode(JSCell* cell)
 {
     ASSERT(m_profiler.activeHeapAnalyzer() == this);
@@ -108,6 +116,9 @@ void HeapSnapshotBuilder::analyzeEdge(JSCell* from, JSCell* to, SlotVisitor::Roo
     if (from == to)
         return;
 
+    if (!shouldRecordEdge(from, to))
+        return;
+
     auto locker = holdLock(m_buildingEdgeMutex);
 
     if (m_snapshotType == SnapshotType::GCDebuggingSnapshot && !from) {
@@ -127,6 +138,9 @@ void HeapSnapshotBuilder::analyzePropertyNameEdge(JSCell* from, JSCell* to, Uniq
     ASSERT(m_profiler.activeHeapAnalyzer() == this);
     ASSERT(to);
 
+    if (!shouldRecordEdge(from, to))
+        return;
+
     auto locker = holdLock(m_buildingEdgeMutex);
 
     m_edges.append(HeapSnapshotEdge(from, to, EdgeType::Property, propertyName));
@@ -137,6 +151,9 @@ void HeapSnapshotBuilder::analyzeVariableNameEdge(JSCell* from, JSCell* to, Uniq
     ASSERT(m_profiler.activeHeapAnalyzer() == this);
     ASSERT(to);
 
+    if (!shouldRecordEdge(from, to))
+        return;
+
     auto locker = holdLock(m_buildingEdgeMutex);
 
     m_edges.append(HeapSnapshotEdge(from, to, EdgeType::Variable, variableName));
@@ -147,6 +164,9 @@ void HeapSnapshotBuilder::analyzeIndexEdge(JSCell* from, JSCell* to, uint32_t in
     ASSERT(m_profiler.activeHeapAnalyzer() == this);
     ASSERT(to);
 
+    if (!shouldRecordEdge(from, to))
+        return;
+
     auto locker = holdLock(m_buildingEdgeMutex);
 
     m_edges.append(HeapSnapshotEdge(from, to, index));
@@ -183,6 +203,19 @@ bool HeapSnapshotBuilder::previousSnapshotHasNodeForCell(JSCell* cell, NodeIdent
     return false;
 }
 
+bool HeapSnapshotBuilder::shouldRecordEdge(JSCell* from, JSCell* to)
+{
+    if (!m_isDeltaSnapshot)
+        return true;
+
+    // A delta only describes edges that touch a new node. Edges from the root to older nodes and
+    // between two older nodes were either in an earlier snapshot or are changes we do not track.
+    NodeIdentifier identifier;
+    if (!previousSnapshotHasNodeForCell(to, identifier))
+        return true;
+    return from && !previousSnapshotHasNodeForCell(from, identifier);
+}
+
 // Heap Snapshot JSON Format:
 //
 //  Inspector snapshots:
@@ -246,6 +279,22 @@ bool HeapSnapshotBuilder::previousSnapshotHasNodeForCell(JSCell* cell, NodeIdent
 //      ]
 //   }
 //
+//  Delta snapshots are Inspector snapshots with two more members:
+//
+//   {
+//      ...
+//      "delta": true,
+//      ...
+//      "collectedNodes": [
+//          <nodeId>, <nodeId>, ...
+//      ]
+//   }
+//
+//   "nodes" then only lists the nodes new in this snapshot, and "edges" only the edges that
+//   touch one of them; the other end may be a node from an earlier snapshot.
+//   "collectedNodes" lists the nodes of earlier snapshots that have been collected since the
+//   previous snapshot was taken.
+//
 // Notes:
 //
 //     <nodeClassNameIndex>
@@ -368,6 +417,17 @@ String HeapSnapshotBuilder::descriptionForCell(JSCell *cell) const
 }
 
 String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowNodeCallback)
+{
+    // With an unbounded chunk size, writeJSON() produces exactly one chunk.
+    String result;
+    writeJSON([&] (String&& chunk) {
+        ASSERT(result.isNull());
+        result = WTFMove(chunk);
+    }, WTFMove(allowNodeCallback), std::numeric_limits<size_t>::max());
+    return result;
+}
+
+void HeapSnapshotBuilder::writeJSON(const Function<void(String&&)>& writeChunk, Function<bool (const HeapSnapshotNode&)> allowNodeCallback, size_t chunkSize, EdgeEncoding edgeEncoding)
 {
     VM& vm = m_profiler.vm();
     DeferGCForAWhile deferGC(vm.heap);
@@ -391,6 +451,13 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
 
     StringBuilder json;
 
+    auto flushIfNeeded = [&] {
+        if (json.length() < chunkSize)
+            return;
+        writeChunk(json.toString());
+        json.clear();
+    };
+
     auto appendNodeJSON = [&] (const HeapSnapshotNode& node) {
         // Let the client decide if they want to allow or disallow certain nodes.
         if (!allowNodeCallback(node))
@@ -476,6 +543,25 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
             json.append(hex(reinterpret_cast<uintptr_t>(wrappedAddress), Lowercase));
             json.append('"');
         }
+
+        flushIfNeeded();
+    };
+
+    auto edgeExtraData = [&] (const HeapSnapshotEdge& edge) -> uint32_t {
+        switch (edge.type) {
+        case EdgeType::Property:
+        case EdgeType::Variable: {
+            auto result = edgeNameIndexes.add(edge.u.name, nextEdgeNameIndex);
+            if (result.isNewEntry)
+                nextEdgeNameIndex++;
+            return result.iterator->value;
+        }
+        case EdgeType::Index:
+            return edge.u.index;
+        default:
+            // No data for this edge type.
+            return 0;
+        }
     };
 
     bool firstEdge = true;
@@ -491,24 +577,29 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
         json.append(',');
         json.appendNumber(edgeTypeToNumber(edge.type));
         json.append(',');
-        switch (edge.type) {
-        case EdgeType::Property:
-        case EdgeType::Variable: {
-            auto result = edgeNameIndexes.add(edge.u.name, nextEdgeNameIndex);
-            if (result.isNewEntry)
-                nextEdgeNameIndex++;
-            unsigned edgeNameIndex = result.iterator->value;
-            json.appendNumber(edgeNameIndex);
-            break;
-        }
-        case EdgeType::Index:
-            json.appendNumber(edge.u.index);
-            break;
-        default:
-            // No data for this edge type.
-            json.append('0');
-            break;
+        json.appendNumber(edgeExtraData(edge));
+
+        flushIfNeeded();
+    };
+
+    // Three edges are 48 bytes, which base64 encodes without padding, so batches of whole
+    // edges can be encoded independently and simply concatenated.
+    static constexpr size_t bytesPerEdge = 4 * sizeof(uint32_t);
+    static constexpr size_t edgesPerBase64Batch = 3 * 1024;
+    Vector<uint8_t> edgeBytes;
+    auto flushBinaryEdges = [&] {
+        json.append(base64Encode(edgeBytes.data(), edgeBytes.size()));
+        edgeBytes.shrink(0);
+        flushIfNeeded();
+    };
+    auto appendEdgeBinary = [&] (const HeapSnapshotEdge& edge) {
+        uint32_t words[] = { edge.from.identifier, edge.to.identifier, edgeTypeToNumber(edge.type), edgeExtraData(edge) };
+        for (uint32_t word : words) {
+            for (unsigned shift = 0; shift < 32; shift += 8)
+                edgeBytes.append(static_cast<uint8_t>(word >> shift));
         }
+        if (edgeBytes.size() >= edgesPerBase64Batch * bytesPerEdge)
+            flushBinaryEdges();
     };
 
     json.append('{');
@@ -521,6 +612,14 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
     json.appendLiteral("\"type\":");
     json.appendQuotedJSONString(snapshotTypeToString(m_snapshotType));
 
+    // edge encoding (only present when it is not the default array of numbers)
+    if (edgeEncoding == EdgeEncoding::Base64)
+        json.appendLiteral(",\"edgeEncoding\":\"base64\"");
+
+    // delta (only present for delta snapshots)
+    if (m_isDeltaSnapshot)
+        json.appendLiteral(",\"delta\":true");
+
     // nodes
     json.append(',');
     json.appendLiteral("\"nodes\":");
@@ -534,6 +633,8 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
     for (HeapSnapshot* snapshot = m_profiler.mostRecentSnapshot(); snapshot; snapshot = snapshot->previous()) {
         for (auto& node : snapshot->m_nodes)
             appendNodeJSON(node);
+        if (m_isDeltaSnapshot)
+            break;
     }
     json.append(']');
 
@@ -555,6 +656,23 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
     orderedClassNames.clear();
     json.append(']');
 
+    // In a delta, edges may point at nodes from earlier snapshots, which are not listed.
+    HeapSnapshot* previousSnapshot = m_isDeltaSnapshot ? m_profiler.mostRecentSnapshot()->previous() : nullptr;
+    auto lookUpIdentifier = [&] (JSCell* cell, NodeIdentifier& identifier) -> bool {
+        auto lookup = allowedNodeIdentifiers.find(cell);
+        if (lookup != allowedNodeIdentifiers.end()) {
+            identifier = lookup->value;
+            return true;
+        }
+        if (previousSnapshot) {
+            if (auto node = previousSnapshot->nodeForCell(cell)) {
+                identifier = node->identifier;
+                return true;
+            }
+        }
+        return false;
+    };
+
     // Process edges.
     // Replace pointers with identifiers.
     // Remove any edges that we won't need.
@@ -563,25 +681,25 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
         if (!edge.from.cell)
             edge.from.identifier = 0;
         else {
-            auto fromLookup = allowedNodeIdentifiers.find(edge.from.cell);
-            if (fromLookup == allowedNodeIdentifiers.end()) {
+            NodeIdentifier identifier;
+            if (!lookUpIdentifier(edge.from.cell, identifier)) {
                 if (m_snapshotType == SnapshotType::GCDebuggingSnapshot)
                     WTFLogAlways("Failed to find node for from-edge cell %p", edge.from.cell);
                 return true;
             }
-            edge.from.identifier = fromLookup->value;
+            edge.from.identifier = identifier;
         }
 
         if (!edge.to.cell)
             edge.to.identifier = 0;
         else {
-            auto toLookup = allowedNodeIdentifiers.find(edge.to.cell);
-            if (toLookup == allowedNodeIdentifiers.end()) {
+            NodeIdentifier identifier;
+            if (!lookUpIdentifier(edge.to.cell, identifier)) {
                 if (m_snapshotType == SnapshotType::GCDebuggingSnapshot)
                     WTFLogAlways("Failed to find node for to-edge cell %p", edge.to.cell);
                 return true;
             }
-            edge.to.identifier = toLookup->value;
+            edge.to.identifier = identifier;
         }
 
         return false;
@@ -598,10 +716,18 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
     // edges
     json.append(',');
     json.appendLiteral("\"edges\":");
-    json.append('[');
-    for (auto& edge : m_edges)
-        appendEdgeJSON(edge);
-    json.append(']');
+    if (edgeEncoding == EdgeEncoding::Base64) {
+        json.append('"');
+        for (auto& edge : m_edges)
+            appendEdgeBinary(edge);
+        flushBinaryEdges();
+        json.append('"');
+    } else {
+        json.append('[');
+        for (auto& edge : m_edges)
+            appendEdgeJSON(edge);
+        json.append(']');
+    }
 
     // edge types
     json.append(',');
@@ -701,8 +827,24 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
         json.append(']');
     }
 
+    if (m_isDeltaSnapshot) {
+        // collected nodes
+        json.append(',');
+        json.appendLiteral("\"collectedNodes\":");
+        json.append('[');
+        bool firstCollectedNode = true;
+        for (NodeIdentifier identifier : m_profiler.mostRecentSnapshot()->m_collectedIdentifiers) {
+            if (!firstCollectedNode)
+                json.append(',');
+            firstCollectedNode = false;
+            json.appendNumber(identifier);
+            flushIfNeeded();
+        }
+        json.append(']');
+    }
+
     json.append('}');
-    return json.toString();
+    writeChunk(json.toString());
 }
 
 } // namespace JSC
@@ -30,6 +30,7 @@
 #include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
 #include <wtf/Lock.h>
+#include <wtf/StdLibExtras.h>
 #include <wtf/Vector.h>
 
 namespace JSC {
@@ -115,6 +116,11 @@ public:
     // Performs a garbage collection that builds a snapshot of all live cells.
     void buildSnapshot();
 
+    // Like buildSnapshot(), but the JSON only describes what changed since the previous snapshot:
+    // the cells that are new in this one, the edges touching them, and the cells of earlier
+    // snapshots that have been collected since. Edges between older cells are not recorded.
+    void buildDeltaSnapshot();
+
     // A root or marked cell.
     void analyzeNode(JSCell*) final;
 
@@ -131,6 +137,18 @@ public:
     String json();
     String json(Function<bool (const HeapSnapshotNode&)> allowNodeCallback);
 
+    enum class EdgeEncoding : uint8_t {
+        JSON,   // "edges" is an array of numbers, four per edge.
+        Base64, // "edges" is a base64 string of four little-endian uint32_t per edge.
+    };
+
+    static constexpr size_t defaultChunkSize = 1 * MB;
+
+    // Serializes the same JSON as json(), but hands it to writeChunk in pieces of roughly
+    // chunkSize characters as they are produced, so the whole snapshot never has to be
+    // held in memory as a single string.
+    void writeJSON(const Function<void(String&&)>& writeChunk, Function<bool (const HeapSnapshotNode&)> allowNodeCallback, size_t chunkSize = defaultChunkSize, EdgeEncoding = EdgeEncoding::JSON);
+
 private:
     static NodeIdentifier nextAvailableObjectIdentifier;
     static NodeIdentifier getNextObjectIdentifier();
@@ -138,6 +156,7 @@ private:
     // Finalized snapshots are not modified during building. So searching them
     // for an existing node can be done concurrently without a lock.
     bool previousSnapshotHasNodeForCell(JSCell*, NodeIdentifier&);
+    bool shouldRecordEdge(JSCell* from, JSCell* to);
     
     String descriptionForCell(JSCell*) const;
     
@@ -158,6 +177,7 @@ private:
     HashMap<JSCell*, String> m_cellLabels;
     HashSet<JSCell*> m_appendedCells;
     SnapshotType m_snapshotType;
+    bool m_isDeltaSnapshot { false };
 };
 
 } // namespace JSC
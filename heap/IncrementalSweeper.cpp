@@ -71,6 +71,21 @@ void IncrementalSweeper::doSweep(VM& vm, MonotonicTime sweepBeginTime)
     cancelTimer();
 }
 
+bool IncrementalSweeper::sweepUntil(VM& vm, MonotonicTime deadline)
+{
+    while (MonotonicTime::now() < deadline) {
+        if (!sweepNextBlock(vm)) {
+            if (m_shouldFreeFastMallocMemoryAfterSweeping) {
+                WTF::releaseFastMallocFreeMemory();
+                m_shouldFreeFastMallocMemoryAfterSweeping = false;
+            }
+            cancelTimer();
+            return true;
+        }
+    }
+    return false;
+}
+
 bool IncrementalSweeper::sweepNextBlock(VM& vm)
 {
     vm.heap.stopIfNecessary();
@@ -42,6 +42,8 @@ public:
 
     void doWork(VM&) final;
     void stopSweeping();
+    // Returns true once there is nothing left to sweep.
+    bool sweepUntil(VM&, MonotonicTime deadline);
 
 private:
     bool sweepNextBlock(VM&);
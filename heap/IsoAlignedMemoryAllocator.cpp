@@ -98,6 +98,16 @@ void IsoAlignedMemoryAllocator::freeAlignedMemory(void* basePtr)
 #endif
 }
 
+size_t IsoAlignedMemoryAllocator::decommittedBytes()
+{
+#if ENABLE(MALLOC_HEAP_BREAKDOWN)
+    return 0;
+#else
+    auto locker = holdLock(m_lock);
+    return (m_blocks.size() - m_committed.bitCount()) * MarkedBlock::blockSize;
+#endif
+}
+
 void IsoAlignedMemoryAllocator::dump(PrintStream& out) const
 {
     out.print("Iso(", RawPointer(this), ")");
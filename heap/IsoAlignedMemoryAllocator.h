@@ -44,6 +44,8 @@ public:
 
     void dump(PrintStream&) const final;
 
+    size_t decommittedBytes() final;
+
     void* tryAllocateMemory(size_t) final;
     void freeMemory(void*) final;
     void* tryReallocateMemory(void*, size_t) final;
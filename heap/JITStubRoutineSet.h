@@ -60,6 +60,9 @@ public:
         markSlow(address);
     }
 
+    // Only valid between prepareForConservativeScan() and the end of the conservative scan.
+    Range<uintptr_t> range() const { return m_range; }
+
     void prepareForConservativeScan();
     
     void deleteUnmarkedJettisonedStubRoutines();
@@ -90,6 +93,7 @@ public:
     void add(GCAwareJITStubRoutine*) { }
     void clearMarks() { }
     void mark(void*) { }
+    Range<uintptr_t> range() const { return Range<uintptr_t> { 0, 0 }; }
     void prepareForConservativeScan() { }
     void deleteUnmarkedJettisonedStubRoutines() { }
     void traceMarkedStubRoutines(SlotVisitor&) { }
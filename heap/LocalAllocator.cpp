@@ -29,6 +29,7 @@
 #include "AllocatingScope.h"
 #include "FreeListInlines.h"
 #include "GCDeferralContext.h"
+#include "HeapAllocationSampler.h"
 #include "LocalAllocatorInlines.h"
 #include "Options.h"
 #include "SuperSampler.h"
@@ -49,6 +50,7 @@ void LocalAllocator::reset()
     m_currentBlock = nullptr;
     m_lastActiveBlock = nullptr;
     m_allocationCursor = 0;
+    m_denseAllocationCursor = 0;
 }
 
 LocalAllocator::~LocalAllocator()
@@ -110,6 +112,23 @@ void LocalAllocator::stopAllocatingForGood()
 }
 
 void* LocalAllocator::allocateSlowCase(Heap& heap, GCDeferralContext* deferralContext, AllocationFailureMode failureMode)
+{
+    HeapAllocationSampler* sampler = heap.allocationSampler();
+    if (LIKELY(!sampler))
+        return allocateSlowCaseImpl(heap, deferralContext, failureMode);
+
+    // Both the C++ and the JIT inline allocation fast paths land here once the free list runs dry,
+    // so sampling on the bytes handed out from each free list covers all of them.
+    unsigned sampledIntervals = sampler->didAllocate(m_freeList.originalSize());
+    void* result = allocateSlowCaseImpl(heap, deferralContext, failureMode);
+    // A GC callback may have stopped sampling while we were allocating.
+    sampler = heap.allocationSampler();
+    if (UNLIKELY(sampledIntervals && result && sampler))
+        sampler->recordSample(sampledIntervals, static_cast<HeapCell*>(result), cellSize());
+    return result;
+}
+
+void* LocalAllocator::allocateSlowCaseImpl(Heap& heap, GCDeferralContext* deferralContext, AllocationFailureMode failureMode)
 {
     SuperSamplerScope superSamplerScope(false);
     ASSERT(heap.vm().currentThreadIsHoldingAPILock());
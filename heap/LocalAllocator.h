@@ -62,6 +62,7 @@ private:
     
     void reset();
     JS_EXPORT_PRIVATE void* allocateSlowCase(Heap&, GCDeferralContext*, AllocationFailureMode);
+    void* allocateSlowCaseImpl(Heap&, GCDeferralContext*, AllocationFailureMode);
     void didConsumeFreeList();
     void* tryAllocateWithoutCollecting();
     void* tryAllocateIn(MarkedBlock::Handle*);
@@ -77,6 +78,7 @@ private:
     // After you do something to a block based on one of these cursors, you clear the bit in the
     // corresponding bitvector and leave the cursor where it was.
     unsigned m_allocationCursor { 0 }; // Points to the next block that is a candidate for allocation.
+    unsigned m_denseAllocationCursor { 0 }; // Like m_allocationCursor, but only visits blocks that are not sparse.
 };
 
 inline ptrdiff_t LocalAllocator::offsetOfFreeList()
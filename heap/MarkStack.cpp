@@ -155,4 +155,32 @@ void MarkStackArray::stealSomeCellsFrom(MarkStackArray& other, size_t idleThread
         append(other.removeLast());
 }
 
+GCArraySegment<const JSCell*>* MarkStackArray::takeOldestSegment()
+{
+    if (m_numberOfSegments <= 1)
+        return nullptr;
+
+    validatePrevious();
+    // The tail was filled first, so it holds the cells closest to the roots. Those tend to lead to
+    // the most remaining work, which makes them the best thing to give away.
+    GCArraySegment<const JSCell*>* segment = m_segments.tail();
+    ASSERT(segment != m_segments.head());
+    ASSERT(segment->m_top == s_segmentCapacity);
+    m_segments.remove(segment);
+    m_numberOfSegments--;
+    validatePrevious();
+    return segment;
+}
+
+void MarkStackArray::adoptSegment(GCArraySegment<const JSCell*>* segment)
+{
+    ASSERT(segment->m_top == s_segmentCapacity);
+    validatePrevious();
+    GCArraySegment<const JSCell*>* myHead = m_segments.removeHead();
+    m_segments.push(segment);
+    m_segments.push(myHead);
+    m_numberOfSegments++;
+    validatePrevious();
+}
+
 } // namespace JSC
@@ -39,6 +39,11 @@ public:
     size_t transferTo(MarkStackArray&, size_t limit); // Optimized for when `limit` is small.
     void donateSomeCellsTo(MarkStackArray&);
     void stealSomeCellsFrom(MarkStackArray&, size_t idleThreadCount);
+
+    // Full segments can move between mark stacks without copying. takeOldestSegment() never hands
+    // out the head segment and returns nullptr if there is nothing else.
+    GCArraySegment<const JSCell*>* takeOldestSegment();
+    void adoptSegment(GCArraySegment<const JSCell*>*);
 };
 
 } // namespace JSC
@@ -27,6 +27,7 @@
 #include "MarkedBlock.h"
 
 #include "AlignedMemoryAllocator.h"
+#include "ConcurrentSweeper.h"
 #include "FreeListInlines.h"
 #include "JSCJSValueInlines.h"
 #include "MarkedBlockInlines.h"
@@ -380,9 +381,48 @@ Subspace* MarkedBlock::Handle::subspace() const
     return directory()->subspace();
 }
 
+void MarkedBlock::Handle::buildFreeListConcurrently()
+{
+    // The mutator does not touch this block until we are done (see ConcurrentSweeper::willTouchBlock()),
+    // and the collector is not marking, so the mark bits are stable and the dead cells are ours to write.
+    ASSERT(m_attributes.destruction == DoesNotNeedDestruction);
+
+    MarkedBlock& block = this->block();
+    MarkedBlock::Footer& footer = block.footer();
+    HeapVersion markingVersion = space()->markingVersion();
+    if (m_isFreeListed || block.areMarksStale(markingVersion) || block.hasAnyNewlyAllocated())
+        return;
+
+    unsigned cellSize = this->cellSize();
+    FreeCell* head = nullptr;
+    size_t count = 0;
+    uintptr_t secret;
+    cryptographicallyRandomValues(&secret, sizeof(uintptr_t));
+    for (size_t i = 0; i < m_endAtom; i += m_atomsPerCell) {
+        if (footer.m_marks.get(i))
+            continue;
+        FreeCell* freeCell = reinterpret_cast_ptr<FreeCell*>(&block.atoms()[i]);
+        if (scribbleFreeCells())
+            scribble(freeCell, cellSize);
+        freeCell->setNext(head, secret);
+        head = freeCell;
+        ++count;
+    }
+
+    if (!count)
+        return;
+    m_concurrentlyBuiltFreeList = { head, secret, static_cast<unsigned>(count * cellSize), markingVersion };
+}
+
 void MarkedBlock::Handle::sweep(FreeList* freeList)
 {
     SweepingScope sweepingScope(*heap());
+
+    if (ConcurrentSweeper* concurrentSweeper = heap()->concurrentSweeper())
+        concurrentSweeper->willTouchBlock(this);
+    ConcurrentlyBuiltFreeList concurrentlyBuiltFreeList;
+    if (freeList)
+        concurrentlyBuiltFreeList = std::exchange(m_concurrentlyBuiltFreeList, { });
     
     SweepMode sweepMode = freeList ? SweepToFreeList : SweepOnly;
     
@@ -410,6 +450,19 @@ void MarkedBlock::Handle::sweep(FreeList* freeList)
         blockFooter().m_lock.lock();
     
     subspace()->didBeginSweepingToFreeList(this);
+
+    // Eden collections neither change the marking version nor unmark anything, so a free list built
+    // since the last full collection still describes exactly the dead cells of this block.
+    if (concurrentlyBuiltFreeList.head
+        && !needsDestruction
+        && concurrentlyBuiltFreeList.markingVersion == space()->markingVersion()
+        && !block().hasAnyNewlyAllocated()) {
+        if (space()->isMarking())
+            blockFooter().m_lock.unlock();
+        freeList->initializeList(concurrentlyBuiltFreeList.head, concurrentlyBuiltFreeList.secret, concurrentlyBuiltFreeList.bytes);
+        setIsFreeListed();
+        return;
+    }
     
     if (needsDestruction) {
         subspace()->finishSweep(*this, freeList);
@@ -38,6 +38,7 @@ namespace JSC {
 
 class AlignedMemoryAllocator;    
 class FreeList;
+struct FreeCell;
 class Heap;
 class JSCell;
 class BlockDirectory;
@@ -142,6 +143,10 @@ public:
         // the block. If it's not set and the block has nothing marked, then we'll make the
         // mistake of making a pop freelist rather than a bump freelist.
         void sweep(FreeList*);
+
+        // Called by the ConcurrentSweeper, off the mutator thread, for blocks that have no
+        // destructors. The result is adopted by the next sweep(FreeList*) if it is still valid.
+        void buildFreeListConcurrently();
         
         // This is to be called by Subspace.
         template<typename DestroyFunc>
@@ -230,8 +235,16 @@ public:
         unsigned m_atomsPerCell { std::numeric_limits<unsigned>::max() };
         unsigned m_endAtom { std::numeric_limits<unsigned>::max() }; // This is a fuzzy end. Always test for < m_endAtom.
             
+        struct ConcurrentlyBuiltFreeList {
+            FreeCell* head { nullptr };
+            uintptr_t secret { 0 };
+            unsigned bytes { 0 };
+            HeapVersion markingVersion { 0 };
+        };
+
         CellAttributes m_attributes;
         bool m_isFreeListed { false };
+        ConcurrentlyBuiltFreeList m_concurrentlyBuiltFreeList;
         unsigned m_index { std::numeric_limits<unsigned>::max() };
 
         AlignedMemoryAllocator* m_alignedMemoryAllocator { nullptr };
@@ -41,17 +41,26 @@ public:
     TinyBloomFilter filter() const;
     const HashSet<MarkedBlock*>& set() const;
 
+    // Addresses of the lowest and highest blocks in the set; lowest > highest when empty. Removing a
+    // block does not always shrink these, so they are only an upper bound on the blocks' extent.
+    uintptr_t lowestBlock() const { return m_lowestBlock; }
+    uintptr_t highestBlock() const { return m_highestBlock; }
+
 private:
     void recomputeFilter();
 
     TinyBloomFilter m_filter;
     HashSet<MarkedBlock*> m_set;
+    uintptr_t m_lowestBlock { std::numeric_limits<uintptr_t>::max() };
+    uintptr_t m_highestBlock { 0 };
 };
 
 inline void MarkedBlockSet::add(MarkedBlock* block)
 {
     m_filter.add(reinterpret_cast<Bits>(block));
     m_set.add(block);
+    m_lowestBlock = std::min(m_lowestBlock, reinterpret_cast<uintptr_t>(block));
+    m_highestBlock = std::max(m_highestBlock, reinterpret_cast<uintptr_t>(block));
 }
 
 inline void MarkedBlockSet::remove(MarkedBlock* block)
@@ -65,9 +74,16 @@ inline void MarkedBlockSet::remove(MarkedBlock* block)
 inline void MarkedBlockSet::recomputeFilter()
 {
     TinyBloomFilter filter;
-    for (HashSet<MarkedBlock*>::iterator it = m_set.begin(); it != m_set.end(); ++it)
+    uintptr_t lowestBlock = std::numeric_limits<uintptr_t>::max();
+    uintptr_t highestBlock = 0;
+    for (HashSet<MarkedBlock*>::iterator it = m_set.begin(); it != m_set.end(); ++it) {
         filter.add(reinterpret_cast<Bits>(*it));
+        lowestBlock = std::min(lowestBlock, reinterpret_cast<uintptr_t>(*it));
+        highestBlock = std::max(highestBlock, reinterpret_cast<uintptr_t>(*it));
+    }
     m_filter = filter;
+    m_lowestBlock = lowestBlock;
+    m_highestBlock = highestBlock;
 }
 
 inline TinyBloomFilter MarkedBlockSet::filter() const
@@ -21,7 +21,9 @@
 #include "config.h"
 #include "MarkedSpace.h"
 
+#include "AlignedMemoryAllocator.h"
 #include "BlockDirectoryInlines.h"
+#include "ConcurrentSweeper.h"
 #include "HeapInlines.h"
 #include "IncrementalSweeper.h"
 #include "MarkedBlockInlines.h"
@@ -195,6 +197,7 @@ void MarkedSpace::freeMemory()
         });
     for (PreciseAllocation* allocation : m_preciseAllocations)
         allocation->destroy();
+    freeRecycledPreciseAllocations();
     forEachSubspace([&](Subspace& subspace) {
         if (subspace.isIsoSubspace())
             static_cast<IsoSubspace&>(subspace).destroyLowerTierFreeList();
@@ -239,7 +242,8 @@ void MarkedSpace::sweepPreciseAllocations()
                 static_cast<IsoSubspace*>(allocation->subspace())->sweepLowerTierCell(allocation);
             else {
                 m_capacity -= allocation->cellSize();
-                allocation->destroy();
+                if (!recyclePreciseAllocation(allocation))
+                    allocation->destroy();
             }
             continue;
         }
@@ -250,6 +254,58 @@ void MarkedSpace::sweepPreciseAllocations()
     m_preciseAllocationsNurseryOffset = m_preciseAllocations.size();
 }
 
+size_t MarkedSpace::preciseAllocationSizeFor(size_t bytes)
+{
+    ASSERT(bytes > largeCutoff || bytes > Options::preciseAllocationCutoff());
+    if (Options::usePreciseAllocationRecycling() && bytes <= maxRecycledPreciseAllocationCellSize)
+        return WTF::roundUpToMultipleOf<recycledPreciseAllocationSizeStep>(bytes);
+    return WTF::roundUpToMultipleOf<sizeStep>(bytes);
+}
+
+void* MarkedSpace::takeRecycledPreciseAllocationMemory(AlignedMemoryAllocator* allocator, size_t cellSize)
+{
+    if (cellSize > maxRecycledPreciseAllocationCellSize || cellSize % recycledPreciseAllocationSizeStep)
+        return nullptr;
+
+    auto& recycled = m_recycledPreciseAllocations[cellSize / recycledPreciseAllocationSizeStep];
+    for (size_t i = recycled.size(); i--;) {
+        if (recycled[i].allocator != allocator)
+            continue;
+        void* basePointer = recycled[i].basePointer;
+        recycled.remove(i);
+        m_recycledPreciseAllocationBytes -= cellSize;
+        return basePointer;
+    }
+    return nullptr;
+}
+
+bool MarkedSpace::recyclePreciseAllocation(PreciseAllocation* allocation)
+{
+    // Reallocated cells keep their exact size and do not fit a size class, so they go back to malloc.
+    size_t cellSize = allocation->cellSize();
+    if (!Options::usePreciseAllocationRecycling()
+        || cellSize > maxRecycledPreciseAllocationCellSize
+        || cellSize % recycledPreciseAllocationSizeStep
+        || m_recycledPreciseAllocationBytes + cellSize > Options::maxRecycledPreciseAllocationBytes())
+        return false;
+
+    AlignedMemoryAllocator* allocator = allocation->subspace()->alignedMemoryAllocator();
+    void* basePointer = allocation->destroyAndReturnMemory();
+    m_recycledPreciseAllocations[cellSize / recycledPreciseAllocationSizeStep].append({ allocator, basePointer });
+    m_recycledPreciseAllocationBytes += cellSize;
+    return true;
+}
+
+void MarkedSpace::freeRecycledPreciseAllocations()
+{
+    for (auto& recycled : m_recycledPreciseAllocations) {
+        for (auto& entry : recycled)
+            entry.allocator->freeMemory(entry.basePointer);
+        recycled.clear();
+    }
+    m_recycledPreciseAllocationBytes = 0;
+}
+
 void MarkedSpace::prepareForAllocation()
 {
     ASSERT(!Thread::mayBeGCThread() || heap().worldIsStopped());
@@ -286,6 +342,36 @@ void MarkedSpace::visitWeakSets(SlotVisitor& visitor)
 
 void MarkedSpace::reapWeakSets()
 {
+    // Reaping only reads mark bits and flips dead handles to WeakImpl::Dead. Finalizers do not run
+    // until the WeakSet is swept, so disjoint WeakSets can be reaped concurrently.
+    if (Options::useParallelWeakReaping()) {
+        Vector<WeakSet*> weakSets;
+        auto append = [&] (WeakSet* weakSet) {
+            weakSets.append(weakSet);
+        };
+        m_newActiveWeakSets.forEach(append);
+        if (heap().collectionScope() == CollectionScope::Full)
+            m_activeWeakSets.forEach(append);
+
+        if (weakSets.size() >= Options::minimumWeakSetsForParallelReaping()) {
+            Atomic<size_t> nextIndex { 0 };
+            heap().m_helperClient.runFunctionInParallel(
+                [&] () {
+                    for (;;) {
+                        size_t index = nextIndex.exchangeAdd(1);
+                        if (index >= weakSets.size())
+                            return;
+                        weakSets[index]->reap();
+                    }
+                });
+            return;
+        }
+
+        for (WeakSet* weakSet : weakSets)
+            weakSet->reap();
+        return;
+    }
+
     auto visit = [&] (WeakSet* weakSet) {
         weakSet->reap();
     };
@@ -371,6 +457,8 @@ bool MarkedSpace::isPagedOut(MonotonicTime deadline)
 
 void MarkedSpace::freeBlock(MarkedBlock::Handle* block)
 {
+    if (ConcurrentSweeper* concurrentSweeper = heap().concurrentSweeper())
+        concurrentSweeper->willTouchBlock(block);
     block->directory()->removeBlock(block);
     m_capacity -= MarkedBlock::blockSize;
     m_blocks.remove(&block->block());
@@ -384,9 +472,43 @@ void MarkedSpace::freeOrShrinkBlock(MarkedBlock::Handle* block)
         return;
     }
 
+    if (block->directory()->shouldRetainEmptyBlock())
+        return;
+
+    m_emptyBlockBytesReleased += MarkedBlock::blockSize;
     freeBlock(block);
 }
 
+void MarkedSpace::releaseExcessEmptyBlocks()
+{
+    MonotonicTime now = MonotonicTime::now();
+    forEachDirectory(
+        [&] (BlockDirectory& directory) -> IterationStatus {
+            m_emptyBlockBytesReleased += directory.releaseExcessEmptyBlocks(now) * MarkedBlock::blockSize;
+            return IterationStatus::Continue;
+        });
+}
+
+MarkedSpace::BlockMemoryStatistics MarkedSpace::blockMemoryStatistics()
+{
+    BlockMemoryStatistics result;
+    result.committedBytes = m_capacity;
+
+    HashSet<AlignedMemoryAllocator*> allocators;
+    for (Subspace* subspace : m_subspaces) {
+        if (allocators.add(subspace->alignedMemoryAllocator()).isNewEntry)
+            result.decommittedBytes += subspace->alignedMemoryAllocator()->decommittedBytes();
+    }
+
+    forEachDirectory(
+        [&] (BlockDirectory& directory) -> IterationStatus {
+            result.emptyBlockBytes += directory.occupancyStatistics().emptyBlockCount * MarkedBlock::blockSize;
+            return IterationStatus::Continue;
+        });
+    result.emptyBlockBytesReleased = m_emptyBlockBytesReleased;
+    return result;
+}
+
 void MarkedSpace::shrink()
 {
     forEachDirectory(
@@ -394,6 +516,7 @@ void MarkedSpace::shrink()
             directory.shrink();
             return IterationStatus::Continue;
         });
+    freeRecycledPreciseAllocations();
 }
 
 void MarkedSpace::beginMarking()
@@ -37,6 +37,7 @@
 
 namespace JSC {
 
+class AlignedMemoryAllocator;
 class CompleteSubspace;
 class Heap;
 class HeapCell;
@@ -70,6 +71,12 @@ public:
     // We have an extra size class for size zero.
     static constexpr size_t numSizeClasses = largeCutoff / sizeStep + 1;
     
+    // PreciseAllocations just above largeCutoff are rounded up to this granule so that the memory of
+    // dead ones can be recycled by size class instead of going back to malloc.
+    static constexpr size_t recycledPreciseAllocationSizeStep = 1 * KB;
+    static constexpr size_t maxRecycledPreciseAllocationCellSize = 64 * KB;
+    static constexpr size_t numRecycledPreciseAllocationSizeClasses = maxRecycledPreciseAllocationCellSize / recycledPreciseAllocationSizeStep + 1;
+
     static constexpr HeapVersion nullVersion = 0; // The version of freshly allocated blocks.
     static constexpr HeapVersion initialVersion = 2; // The version that the heap starts out with. Set to make sure that nextVersion(nullVersion) != initialVersion.
     
@@ -132,6 +139,17 @@ public:
     void shrink();
     void freeBlock(MarkedBlock::Handle*);
     void freeOrShrinkBlock(MarkedBlock::Handle*);
+    void releaseExcessEmptyBlocks();
+
+    struct BlockMemoryStatistics {
+        size_t committedBytes { 0 };
+        // Memory that an AlignedMemoryAllocator still holds the address range of but has returned
+        // to the OS. Reserved memory is committedBytes + decommittedBytes.
+        size_t decommittedBytes { 0 };
+        size_t emptyBlockBytes { 0 };
+        size_t emptyBlockBytesReleased { 0 };
+    };
+    JS_EXPORT_PRIVATE BlockMemoryStatistics blockMemoryStatistics();
 
     void didAddBlock(MarkedBlock::Handle*);
     void didConsumeFreeList(MarkedBlock::Handle*);
@@ -159,6 +177,12 @@ public:
     HashSet<HeapCell*>* preciseAllocationSet() const { return m_preciseAllocationSet.get(); }
 
     void enablePreciseAllocationTracking();
+
+    static size_t preciseAllocationSizeFor(size_t);
+    void* takeRecycledPreciseAllocationMemory(AlignedMemoryAllocator*, size_t cellSize);
+    bool recyclePreciseAllocation(PreciseAllocation*);
+    void freeRecycledPreciseAllocations();
+    size_t recycledPreciseAllocationBytes() const { return m_recycledPreciseAllocationBytes; }
     
     // These are cached pointers and offsets for quickly searching the large allocations that are
     // relevant to this collection.
@@ -209,7 +233,15 @@ private:
     PreciseAllocation** m_preciseAllocationsForThisCollectionBegin { nullptr };
     PreciseAllocation** m_preciseAllocationsForThisCollectionEnd { nullptr };
 
+    struct RecycledPreciseAllocation {
+        AlignedMemoryAllocator* allocator;
+        void* basePointer;
+    };
+    std::array<Vector<RecycledPreciseAllocation>, numRecycledPreciseAllocationSizeClasses> m_recycledPreciseAllocations;
+    size_t m_recycledPreciseAllocationBytes { 0 };
+
     size_t m_capacity { 0 };
+    size_t m_emptyBlockBytesReleased { 0 };
     HeapVersion m_markingVersion { initialVersion };
     HeapVersion m_newlyAllocatedVersion { initialVersion };
     bool m_isIterating { false };
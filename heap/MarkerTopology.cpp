@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "MarkerTopology.h"
+
+#include <mutex>
+#include <wtf/ListDump.h>
+
+#if OS(LINUX)
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+namespace JSC {
+
+#if OS(LINUX)
+// Parses the kernel's cpulist format, e.g. "0-7,16-23".
+static Vector<unsigned> parseCPUList(const char* list)
+{
+    Vector<unsigned> result;
+    const char* cursor = list;
+    while (*cursor) {
+        char* end;
+        unsigned long first = strtoul(cursor, &end, 10);
+        if (end == cursor)
+            break;
+        unsigned long last = first;
+        cursor = end;
+        if (*cursor == '-') {
+            last = strtoul(cursor + 1, &end, 10);
+            if (end == cursor + 1)
+                break;
+            cursor = end;
+        }
+        for (unsigned long cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+            result.append(static_cast<unsigned>(cpu));
+        if (*cursor != ',')
+            break;
+        cursor++;
+    }
+    return result;
+}
+#endif
+
+MarkerTopology& MarkerTopology::singleton()
+{
+    static std::once_flag onceFlag;
+    static MarkerTopology* topology;
+    std::call_once(
+        onceFlag,
+        [] {
+            topology = new MarkerTopology();
+        });
+    return *topology;
+}
+
+MarkerTopology::MarkerTopology()
+{
+#if OS(LINUX)
+    for (unsigned node = 0; ; ++node) {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+        FILE* file = fopen(path, "r");
+        if (!file)
+            break;
+        char buffer[1024];
+        bool didRead = fgets(buffer, sizeof(buffer), file);
+        fclose(file);
+        if (!didRead)
+            break;
+        Vector<unsigned> cpus = parseCPUList(buffer);
+        if (!cpus.isEmpty())
+            m_cpusForNode.append(WTFMove(cpus));
+    }
+#endif
+    if (m_cpusForNode.isEmpty())
+        m_cpusForNode.append(Vector<unsigned>());
+}
+
+bool MarkerTopology::pinCurrentThreadToNode(unsigned node) const
+{
+    RELEASE_ASSERT(node < numberOfNodes());
+#if OS(LINUX)
+    const Vector<unsigned>& cpus = m_cpusForNode[node];
+    if (cpus.isEmpty() || numberOfNodes() == 1)
+        return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned cpu : cpus)
+        CPU_SET(cpu, &set);
+    return !sched_setaffinity(0, sizeof(set), &set);
+#else
+    UNUSED_PARAM(node);
+    return false;
+#endif
+}
+
+MarkerTopology::NodePinningScope::NodePinningScope(const MarkerTopology& topology, unsigned node)
+{
+#if OS(LINUX)
+    CPU_ZERO(&m_previousCPUs);
+    if (sched_getaffinity(0, sizeof(m_previousCPUs), &m_previousCPUs))
+        return;
+#endif
+    m_didPin = topology.pinCurrentThreadToNode(node);
+}
+
+MarkerTopology::NodePinningScope::~NodePinningScope()
+{
+#if OS(LINUX)
+    if (m_didPin)
+        sched_setaffinity(0, sizeof(m_previousCPUs), &m_previousCPUs);
+#endif
+}
+
+void MarkerTopology::dump(PrintStream& out) const
+{
+    out.print("MarkerTopology(");
+    CommaPrinter comma;
+    for (unsigned node = 0; node < numberOfNodes(); ++node)
+        out.print(comma, "node", node, ": [", listDump(m_cpusForNode[node]), "]");
+    out.print(")");
+}
+
+} // namespace JSC
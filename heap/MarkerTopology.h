@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <wtf/PrintStream.h>
+#include <wtf/Vector.h>
+
+#if OS(LINUX)
+#include <sched.h>
+#endif
+
+namespace JSC {
+
+// Describes how CPUs are grouped into NUMA nodes so that parallel markers can be kept close to
+// the memory they are most likely to touch. Where we cannot discover the topology, all CPUs are
+// treated as one node and pinning is a no-op.
+class MarkerTopology {
+    WTF_MAKE_NONCOPYABLE(MarkerTopology);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static MarkerTopology& singleton();
+
+    unsigned numberOfNodes() const { return m_cpusForNode.size(); }
+
+    // Markers are dealt out round-robin so that every node gets a share of the marking bandwidth.
+    unsigned nodeForMarker(unsigned markerIndex) const { return markerIndex % numberOfNodes(); }
+
+    // Restricts the current thread to the CPUs of a node for as long as it is alive, then gives the
+    // thread back the affinity it had before. Helper threads are shared with other clients of the
+    // parallel helper pool, so they must not stay pinned once marking is done.
+    class NodePinningScope {
+        WTF_MAKE_NONCOPYABLE(NodePinningScope);
+    public:
+        NodePinningScope(const MarkerTopology&, unsigned node);
+        ~NodePinningScope();
+
+        bool didPin() const { return m_didPin; }
+
+    private:
+#if OS(LINUX)
+        cpu_set_t m_previousCPUs;
+#endif
+        bool m_didPin { false };
+    };
+
+    void dump(PrintStream&) const;
+
+private:
+    MarkerTopology();
+
+    // Returns false if the current thread could not be restricted to the CPUs of the given node.
+    bool pinCurrentThreadToNode(unsigned node) const;
+
+    Vector<Vector<unsigned>> m_cpusForNode;
+};
+
+} // namespace JSC
@@ -51,11 +51,36 @@ void MarkingConstraint::resetStats()
     m_lastVisitCount = 0;
 }
 
+auto MarkingConstraint::recordedStats() -> RecordedStats
+{
+    auto locker = holdLock(m_lock);
+    return m_recordedStats;
+}
+
+void MarkingConstraint::resetRecordedStats()
+{
+    auto locker = holdLock(m_lock);
+    m_recordedStats = { };
+}
+
+void MarkingConstraint::record(MonotonicTime before, size_t visitCount)
+{
+    Seconds executionTime = MonotonicTime::now() - before;
+    auto locker = holdLock(m_lock);
+    m_recordedStats.executionTime += executionTime;
+    m_recordedStats.visitCount += visitCount;
+    m_recordedStats.executionCount++;
+}
+
 void MarkingConstraint::execute(SlotVisitor& visitor)
 {
+    bool shouldRecord = Options::recordGCPauseTimes();
+    MonotonicTime before = shouldRecord ? MonotonicTime::now() : MonotonicTime();
     VisitCounter visitCounter(visitor);
     executeImpl(visitor);
     m_lastVisitCount += visitCounter.visitCount();
+    if (UNLIKELY(shouldRecord))
+        record(before, visitCounter.visitCount());
     if (verboseMarkingConstraint && visitCounter.visitCount())
         dataLog("(", abbreviatedName(), " visited ", visitCounter.visitCount(), " in execute)");
 }
@@ -82,6 +107,8 @@ void MarkingConstraint::prepareToExecute(const AbstractLocker& constraintSolving
 
 void MarkingConstraint::doParallelWork(SlotVisitor& visitor, SharedTask<void(SlotVisitor&)>& task)
 {
+    bool shouldRecord = Options::recordGCPauseTimes();
+    MonotonicTime before = shouldRecord ? MonotonicTime::now() : MonotonicTime();
     VisitCounter visitCounter(visitor);
     task.run(visitor);
     if (verboseMarkingConstraint && visitCounter.visitCount())
@@ -90,6 +117,8 @@ void MarkingConstraint::doParallelWork(SlotVisitor& visitor, SharedTask<void(Slo
         auto locker = holdLock(m_lock);
         m_lastVisitCount += visitCounter.visitCount();
     }
+    if (UNLIKELY(shouldRecord))
+        record(before, visitCounter.visitCount());
 }
 
 void MarkingConstraint::prepareToExecuteImpl(const AbstractLocker&, SlotVisitor&)
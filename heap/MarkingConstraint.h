@@ -32,6 +32,7 @@
 #include <wtf/FastMalloc.h>
 #include <wtf/Lock.h>
 #include <wtf/Noncopyable.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/SharedTask.h>
 #include <wtf/text/CString.h>
 
@@ -59,6 +60,15 @@ public:
     void resetStats();
     
     size_t lastVisitCount() const { return m_lastVisitCount; }
+
+    // Totals across cycles, only recorded while Options::recordGCPauseTimes() is set.
+    struct RecordedStats {
+        Seconds executionTime;
+        size_t visitCount { 0 };
+        unsigned executionCount { 0 };
+    };
+    RecordedStats recordedStats();
+    void resetRecordedStats();
     
     void execute(SlotVisitor&);
     
@@ -81,10 +91,13 @@ protected:
     
 private:
     friend class MarkingConstraintSet; // So it can set m_index.
+
+    void record(MonotonicTime before, size_t visitCount);
     
     CString m_abbreviatedName;
     CString m_name;
     size_t m_lastVisitCount { 0 };
+    RecordedStats m_recordedStats;
     unsigned m_index { UINT_MAX };
     ConstraintVolatility m_volatility;
     ConstraintConcurrency m_concurrency;
@@ -73,6 +73,13 @@ public:
     
     // Simply runs all constraints without any shenanigans.
     void executeAll(SlotVisitor&);
+
+    template<typename Func>
+    void forEach(const Func& func)
+    {
+        for (auto& constraint : m_set)
+            func(*constraint);
+    }
     
 private:
     friend class MarkingConstraintSolver;
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "PauseTimeMutatorScheduler.h"
+
+#include "JSCInlines.h"
+
+namespace JSC {
+
+static Seconds updateAverage(Seconds average, Seconds sample)
+{
+    if (!average)
+        return sample;
+    return average * 0.5 + sample * 0.5;
+}
+
+PauseTimeMutatorScheduler::PauseTimeMutatorScheduler(Heap& heap)
+    : m_heap(heap)
+    , m_maximumPause(Seconds::fromMilliseconds(Options::maximumGCPauseMS()))
+    , m_window(Seconds::fromMilliseconds(Options::mutatorUtilizationWindowMS()))
+    , m_minimumMutatorUtilization(std::clamp(Options::minimumMutatorUtilizationInWindow(), 0.0, 0.99))
+{
+}
+
+PauseTimeMutatorScheduler::~PauseTimeMutatorScheduler()
+{
+}
+
+MutatorScheduler::State PauseTimeMutatorScheduler::state() const
+{
+    return m_state;
+}
+
+void PauseTimeMutatorScheduler::beginCollection()
+{
+    RELEASE_ASSERT(m_state == Normal);
+    m_state = Stopped;
+    
+    m_bytesAllocatedThisCycleAtTheBeginning = m_heap.m_bytesAllocatedThisCycle;
+    m_bytesAllocatedThisCycleAtTheEnd = 
+        Options::concurrentGCMaxHeadroom() *
+        std::max<double>(m_bytesAllocatedThisCycleAtTheBeginning, m_heap.m_maxEdenSize);
+    
+    dataLogIf(Options::logGC(), "ca=", m_bytesAllocatedThisCycleAtTheBeginning / 1024, "kb h=", (m_bytesAllocatedThisCycleAtTheEnd - m_bytesAllocatedThisCycleAtTheBeginning) / 1024, "kb ");
+    
+    m_stopTime = MonotonicTime::now();
+    m_beforeConstraints = m_stopTime;
+    m_plannedResumeTime = pauseDeadline();
+    m_longestPauseThisCycle = Seconds();
+}
+
+void PauseTimeMutatorScheduler::didStop()
+{
+    RELEASE_ASSERT(m_state == Stopped || m_state == Resumed);
+    if (m_state == Resumed) {
+        m_stopTime = MonotonicTime::now();
+        m_plannedResumeTime = pauseDeadline();
+    }
+    m_state = Stopped;
+}
+
+void PauseTimeMutatorScheduler::willResume()
+{
+    RELEASE_ASSERT(m_state == Stopped || m_state == Resumed);
+    if (m_state == Stopped) {
+        m_resumeTime = MonotonicTime::now();
+        m_lastPause = m_resumeTime - m_stopTime;
+        m_longestPauseThisCycle = std::max(m_longestPauseThisCycle, m_lastPause);
+    }
+    m_state = Resumed;
+}
+
+void PauseTimeMutatorScheduler::didReachTermination()
+{
+    m_beforeConstraints = MonotonicTime::now();
+}
+
+void PauseTimeMutatorScheduler::didExecuteConstraints()
+{
+    MonotonicTime now = MonotonicTime::now();
+    m_averageConstraintExecutionTime = updateAverage(m_averageConstraintExecutionTime, now - m_beforeConstraints);
+    
+    dataLogIf(Options::logGC(), "ct=", m_averageConstraintExecutionTime.milliseconds(), "ms ");
+    
+    m_beforeDraining = now;
+    m_plannedResumeTime = pauseDeadline();
+}
+
+void PauseTimeMutatorScheduler::synchronousDrainingDidStall()
+{
+    MonotonicTime now = MonotonicTime::now();
+    if (m_beforeDraining) {
+        m_averageDrainingTime = updateAverage(m_averageDrainingTime, now - m_beforeDraining);
+        m_beforeDraining = MonotonicTime();
+    }
+    
+    if (isOutOfHeadroom()) {
+        m_plannedResumeTime = MonotonicTime::infinity();
+        return;
+    }
+    
+    // The next thing the collector does while stopped is another termination check, which may
+    // well run the constraints again. If that is not going to fit, hand the world back now.
+    if (now + m_averageConstraintExecutionTime >= pauseDeadline()) {
+        m_plannedResumeTime = now;
+        return;
+    }
+    
+    m_plannedResumeTime = pauseDeadline();
+}
+
+MonotonicTime PauseTimeMutatorScheduler::timeToStop()
+{
+    switch (m_state) {
+    case Normal:
+        return MonotonicTime::infinity();
+    case Stopped:
+        return MonotonicTime::now();
+    case Resumed: {
+        if (!isOutOfHeadroom())
+            return MonotonicTime::infinity();
+        // Even when we have to catch up, give the mutator its share of the window first.
+        return m_resumeTime + minimumMutatorRunTime();
+    } }
+    
+    RELEASE_ASSERT_NOT_REACHED();
+    return MonotonicTime();
+}
+
+MonotonicTime PauseTimeMutatorScheduler::timeToResume()
+{
+    switch (m_state) {
+    case Normal:
+    case Resumed:
+        return MonotonicTime::now();
+    case Stopped:
+        return m_plannedResumeTime;
+    }
+    
+    RELEASE_ASSERT_NOT_REACHED();
+    return MonotonicTime();
+}
+
+void PauseTimeMutatorScheduler::log()
+{
+    ASSERT(Options::logGC());
+    dataLog(
+        "a=", format("%.0lf", bytesSinceBeginningOfCycle() / 1024), "kb ",
+        "hf=", format("%.3lf", headroomFullness()), " ",
+        "lp=", format("%.3lf", m_longestPauseThisCycle.milliseconds()), "ms ",
+        "dt=", format("%.3lf", m_averageDrainingTime.milliseconds()), "ms ");
+}
+
+void PauseTimeMutatorScheduler::endCollection()
+{
+    m_state = Normal;
+}
+
+double PauseTimeMutatorScheduler::bytesSinceBeginningOfCycle()
+{
+    return m_heap.m_bytesAllocatedThisCycle - m_bytesAllocatedThisCycleAtTheBeginning;
+}
+
+double PauseTimeMutatorScheduler::headroomFullness()
+{
+    double result = bytesSinceBeginningOfCycle() / (m_bytesAllocatedThisCycleAtTheEnd - m_bytesAllocatedThisCycleAtTheBeginning);
+    
+    // Same floating point defenses as SpaceTimeMutatorScheduler::headroomFullness().
+    if (!(result >= 0))
+        result = 0;
+    if (!(result <= 1))
+        result = 1;
+    
+    return result;
+}
+
+bool PauseTimeMutatorScheduler::isOutOfHeadroom()
+{
+    return headroomFullness() >= 1;
+}
+
+Seconds PauseTimeMutatorScheduler::minimumMutatorRunTime()
+{
+    // Any window that straddles a run of length r between two pauses is paused for at most
+    // window - r, so r >= utilization * window keeps the window's utilization in bounds. With
+    // short windows the last pause dominates instead: p / (p + r) must not exceed 1 - utilization.
+    Seconds pause = std::max(m_lastPause, m_maximumPause);
+    return std::max(
+        m_window * m_minimumMutatorUtilization,
+        pause * (m_minimumMutatorUtilization / (1 - m_minimumMutatorUtilization)));
+}
+
+MonotonicTime PauseTimeMutatorScheduler::pauseDeadline()
+{
+    return m_stopTime + m_maximumPause;
+}
+
+} // namespace JSC
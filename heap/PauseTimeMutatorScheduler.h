@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "MutatorScheduler.h"
+#include <wtf/Seconds.h>
+
+namespace JSC {
+
+class Heap;
+
+// A scheduler for latency-sensitive embedders. Rather than trading pause time against the space
+// that the mutator allocates, it bounds every synthetic pause by Options::maximumGCPauseMS() and
+// keeps the mutator running for at least Options::minimumMutatorUtilizationInWindow() of every
+// Options::mutatorUtilizationWindowMS() window. Constraint solving cannot be interrupted, so the
+// scheduler measures how long it takes and resumes early when the measured cost no longer fits
+// in what is left of the current pause. Running out of headroom still forces the world to stay
+// stopped, since that is the only way the collector can catch up.
+
+class PauseTimeMutatorScheduler final : public MutatorScheduler {
+public:
+    PauseTimeMutatorScheduler(Heap&);
+    ~PauseTimeMutatorScheduler() final;
+    
+    State state() const final;
+    
+    void beginCollection() final;
+    
+    void didStop() final;
+    void willResume() final;
+    void didReachTermination() final;
+    void didExecuteConstraints() final;
+    void synchronousDrainingDidStall() final;
+    
+    MonotonicTime timeToStop() final;
+    MonotonicTime timeToResume() final;
+    
+    void log() final;
+    
+    void endCollection() final;
+    
+private:
+    double bytesSinceBeginningOfCycle();
+    double headroomFullness();
+    bool isOutOfHeadroom();
+    Seconds minimumMutatorRunTime();
+    MonotonicTime pauseDeadline();
+    
+    Heap& m_heap;
+    State m_state { Normal };
+    
+    Seconds m_maximumPause;
+    Seconds m_window;
+    double m_minimumMutatorUtilization;
+    
+    // These survive across cycles, since constraint costs are fairly stable for a given program.
+    Seconds m_averageConstraintExecutionTime;
+    Seconds m_averageDrainingTime;
+    
+    double m_bytesAllocatedThisCycleAtTheBeginning { 0 };
+    double m_bytesAllocatedThisCycleAtTheEnd { 0 };
+    
+    MonotonicTime m_stopTime;
+    MonotonicTime m_resumeTime;
+    MonotonicTime m_beforeConstraints;
+    MonotonicTime m_beforeDraining;
+    MonotonicTime m_plannedResumeTime;
+    Seconds m_lastPause;
+    Seconds m_longestPauseThisCycle;
+};
+
+} // namespace JSC
@@ -49,7 +49,10 @@ PreciseAllocation* PreciseAllocation::tryCreate(Heap& heap, size_t size, Subspac
     static_assert(halfAlignment == 8, "We assume that memory returned by malloc has alignment >= 8.");
     
     // We must use tryAllocateMemory instead of tryAllocateAlignedMemory since we want to use "realloc" feature.
-    void* space = subspace->alignedMemoryAllocator()->tryAllocateMemory(adjustedAlignmentAllocationSize);
+    // Recycled memory came from the same allocator with the same size, so "realloc" keeps working on it.
+    void* space = heap.objectSpace().takeRecycledPreciseAllocationMemory(subspace->alignedMemoryAllocator(), size);
+    if (!space)
+        space = subspace->alignedMemoryAllocator()->tryAllocateMemory(adjustedAlignmentAllocationSize);
     if (!space)
         return nullptr;
 
@@ -258,9 +261,14 @@ void PreciseAllocation::sweep()
 void PreciseAllocation::destroy()
 {
     AlignedMemoryAllocator* allocator = m_subspace->alignedMemoryAllocator();
+    allocator->freeMemory(destroyAndReturnMemory());
+}
+
+void* PreciseAllocation::destroyAndReturnMemory()
+{
     void* basePointer = this->basePointer();
     this->~PreciseAllocation();
-    allocator->freeMemory(basePointer);
+    return basePointer;
 }
 
 void PreciseAllocation::dump(PrintStream& out) const
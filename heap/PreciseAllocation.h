@@ -49,6 +49,9 @@ public:
     PreciseAllocation* reuseForLowerTier();
 
     PreciseAllocation* tryReallocate(size_t, Subspace*);
+
+    // Runs the destructor but hands the underlying memory back to the caller instead of freeing it.
+    void* destroyAndReturnMemory();
     
     ~PreciseAllocation();
     
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "JSCJSValue.h"
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+// Dense table of values protected through stable handles. Unlike the protect count set, adding and
+// removing a value does not hash, and the collector visits the table as a flat array. Handle 0 is
+// never handed out, so embedders can use it to mean "no handle".
+class ProtectedValueTable {
+    WTF_MAKE_NONCOPYABLE(ProtectedValueTable);
+public:
+    using Handle = unsigned;
+
+    ProtectedValueTable() = default;
+
+    Handle add(JSValue value)
+    {
+        ASSERT(value);
+        ++m_size;
+        if (!m_freeHandles.isEmpty()) {
+            Handle handle = m_freeHandles.takeLast();
+            m_values[handle - 1] = value;
+            return handle;
+        }
+        m_values.append(value);
+        return m_values.size();
+    }
+
+    void remove(Handle handle)
+    {
+        // Removing a handle twice would put it on the free list twice and hand it out to two values.
+        RELEASE_ASSERT(get(handle));
+        m_values[handle - 1] = JSValue();
+        m_freeHandles.append(handle);
+        --m_size;
+    }
+
+    JSValue get(Handle handle) const
+    {
+        if (!handle || handle > m_values.size())
+            return JSValue();
+        return m_values[handle - 1];
+    }
+
+    size_t size() const { return m_size; }
+
+    template<typename Functor>
+    void forEachCell(const Functor& functor) const
+    {
+        for (JSValue value : m_values) {
+            if (value && value.isCell())
+                functor(value.asCell());
+        }
+    }
+
+private:
+    Vector<JSValue> m_values;
+    Vector<Handle> m_freeHandles;
+    size_t m_size { 0 };
+};
+
+} // namespace JSC
@@ -125,6 +125,8 @@ void SlotVisitor::reset()
 
 void SlotVisitor::clearMarkStacks()
 {
+    while (auto* segment = m_stealableSegments.pop())
+        GCArraySegment<const JSCell*>::destroy(segment);
     forEachMarkStack(
         [&] (MarkStackArray& stack) -> IterationStatus {
             stack.clear();
@@ -453,6 +455,12 @@ void SlotVisitor::donateKnownParallel(MarkStackArray& from, MarkStackArray& to)
 
 void SlotVisitor::donateKnownParallel()
 {
+    if (Options::useWorkStealingMarking()) {
+        publishStealableSegments();
+        donateKnownParallel(m_mutatorStack, correspondingGlobalStack(m_mutatorStack));
+        return;
+    }
+
     forEachMarkStack(
         [&] (MarkStackArray& stack) -> IterationStatus {
             donateKnownParallel(stack, correspondingGlobalStack(stack));
@@ -460,6 +468,58 @@ void SlotVisitor::donateKnownParallel()
         });
 }
 
+void SlotVisitor::publishStealableSegments()
+{
+    // Publishing only costs an atomic store per segment, so we do not try to guess whether anyone
+    // needs the work. We never give away our last cells though.
+    while (m_stealableSegments.size() < Options::numberOfGCMarkers()) {
+        GCArraySegment<const JSCell*>* segment = m_collectorStack.takeOldestSegment();
+        if (!segment)
+            break;
+        if (m_collectorStack.isEmpty() || !m_stealableSegments.push(segment)) {
+            m_collectorStack.adoptSegment(segment);
+            break;
+        }
+    }
+
+    // Waiting markers only look at the deques under the marking lock, so they may have gone to
+    // sleep just before we published. We keep nudging them for as long as there is something to
+    // steal; like donation, we give up if the lock is contended and retry on the next rebalance.
+    if (m_stealableSegments.isEmpty() || !m_heap.m_numberOfWaitingParallelMarkers)
+        return;
+    std::unique_lock<Lock> lock(m_heap.m_markingMutex, std::try_to_lock);
+    if (!lock.owns_lock())
+        return;
+    m_heap.m_markingConditionVariable.notifyAll();
+}
+
+bool SlotVisitor::reclaimStealableSegment()
+{
+    GCArraySegment<const JSCell*>* segment = m_stealableSegments.pop();
+    if (!segment)
+        return false;
+    m_collectorStack.adoptSegment(segment);
+    return true;
+}
+
+bool SlotVisitor::stealSegmentFromOtherVisitor(const AbstractLocker&)
+{
+    // We hold the marking lock so that taking the work and becoming active look atomic to
+    // didReachTermination(). Only the owners' push and pop are lock-free.
+    const Vector<SlotVisitor*>& visitors = m_heap.m_stealableSlotVisitors;
+    unsigned start = m_stealRandom.getUint32(visitors.size());
+    for (unsigned i = 0; i < visitors.size(); ++i) {
+        SlotVisitor* victim = visitors[(start + i) % visitors.size()];
+        if (victim == this)
+            continue;
+        if (GCArraySegment<const JSCell*>* segment = victim->m_stealableSegments.steal()) {
+            m_collectorStack.adoptSegment(segment);
+            return true;
+        }
+    }
+    return false;
+}
+
 void SlotVisitor::updateMutatorIsStopped(const AbstractLocker&)
 {
     m_mutatorIsStopped = (m_heap.worldIsStopped() & m_canOptimizeForStoppedMutator);
@@ -498,6 +558,8 @@ NEVER_INLINE void SlotVisitor::drain(MonotonicTime timeout)
     
     while (!hasElapsed(timeout)) {
         updateMutatorIsStopped(locker);
+        if (m_collectorStack.isEmpty())
+            reclaimStealableSegment();
         IterationStatus status = forEachMarkStack(
             [&] (MarkStackArray& stack) -> IterationStatus {
                 if (stack.isEmpty())
@@ -550,6 +612,8 @@ size_t SlotVisitor::performIncrementOfDraining(size_t bytesRequested)
         
         while (!isDone()) {
             updateMutatorIsStopped(locker);
+            if (m_collectorStack.isEmpty())
+                reclaimStealableSegment();
             IterationStatus status = forEachMarkStack(
                 [&] (MarkStackArray& stack) -> IterationStatus {
                     if (stack.isEmpty() || isDone())
@@ -595,9 +659,17 @@ bool SlotVisitor::didReachTermination(const AbstractLocker& locker)
 
 bool SlotVisitor::hasWork(const AbstractLocker&)
 {
-    return !isEmpty()
+    if (!isEmpty()
         || !m_heap.m_sharedCollectorMarkStack->isEmpty()
-        || !m_heap.m_sharedMutatorMarkStack->isEmpty();
+        || !m_heap.m_sharedMutatorMarkStack->isEmpty())
+        return true;
+    if (Options::useWorkStealingMarking()) {
+        for (SlotVisitor* visitor : m_heap.m_stealableSlotVisitors) {
+            if (visitor->hasStealableSegments())
+                return true;
+        }
+    }
+    return false;
 }
 
 NEVER_INLINE SlotVisitor::SharedDrainResult SlotVisitor::drainFromShared(SharedDrainMode sharedDrainMode, MonotonicTime timeout)
@@ -678,6 +750,15 @@ NEVER_INLINE SlotVisitor::SharedDrainResult SlotVisitor::drainFromShared(SharedD
                             m_heap.m_numberOfWaitingParallelMarkers);
                         return IterationStatus::Continue;
                     });
+                if (Options::useWorkStealingMarking() && isEmpty()) {
+                    stealSegmentFromOtherVisitor(locker);
+                    if (isEmpty()) {
+                        // We saw stealable work but lost every race for it. Go back to waiting.
+                        m_heap.m_numberOfWaitingParallelMarkers--;
+                        isActive = false;
+                        continue;
+                    }
+                }
             }
 
             m_heap.m_numberOfActiveParallelMarkers++;
@@ -756,6 +837,7 @@ void SlotVisitor::donateAll()
 
 void SlotVisitor::donateAll(const AbstractLocker&)
 {
+    while (reclaimStealableSegment()) { }
     forEachMarkStack(
         [&] (MarkStackArray& stack) -> IterationStatus {
             stack.transferTo(correspondingGlobalStack(stack));
@@ -29,9 +29,11 @@
 #include "IterationStatus.h"
 #include "MarkStack.h"
 #include "VisitRaceKey.h"
+#include "WorkStealingDeque.h"
 #include <wtf/Forward.h>
 #include <wtf/MonotonicTime.h>
 #include <wtf/SharedTask.h>
+#include <wtf/WeakRandom.h>
 #include <wtf/text/CString.h>
 
 namespace JSC {
@@ -117,7 +119,7 @@ public:
     
     bool containsOpaqueRoot(void*) const;
 
-    bool isEmpty() { return m_collectorStack.isEmpty() && m_mutatorStack.isEmpty(); }
+    bool isEmpty() { return m_collectorStack.isEmpty() && m_mutatorStack.isEmpty() && m_stealableSegments.isEmpty(); }
 
     bool isFirstVisit() const { return m_isFirstVisit; }
 
@@ -192,6 +194,9 @@ public:
     void donateAll();
     
     const char* codeName() const { return m_codeName.data(); }
+
+    unsigned markerNode() const { return m_markerNode; }
+    void setMarkerNode(unsigned node) { m_markerNode = node; }
     
     JS_EXPORT_PRIVATE void addParallelConstraintTask(RefPtr<SharedTask<void(SlotVisitor&)>>);
 
@@ -224,6 +229,13 @@ private:
 
     void donateAll(const AbstractLocker&);
 
+    // Work stealing mode. Full collector stack segments are published to m_stealableSegments,
+    // which idle markers steal from while holding the marking lock.
+    void publishStealableSegments();
+    bool reclaimStealableSegment();
+    bool stealSegmentFromOtherVisitor(const AbstractLocker&);
+    bool hasStealableSegments() const { return !m_stealableSegments.isEmpty(); }
+
     bool hasWork(const AbstractLocker&);
     bool didReachTermination(const AbstractLocker&);
 
@@ -234,6 +246,10 @@ private:
 
     MarkStackArray m_collectorStack;
     MarkStackArray m_mutatorStack;
+
+    static constexpr size_t maxStealableSegments = 64;
+    WorkStealingDeque<GCArraySegment<const JSCell*>, maxStealableSegments> m_stealableSegments;
+    WeakRandom m_stealRandom;
     
     size_t m_bytesVisited;
     size_t m_visitCount;
@@ -255,6 +271,7 @@ private:
     Lock m_rightToRun;
     
     CString m_codeName;
+    unsigned m_markerNode { 0 };
     
     MarkingConstraint* m_currentConstraint { nullptr };
     MarkingConstraintSolver* m_currentSolver { nullptr };
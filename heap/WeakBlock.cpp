@@ -80,11 +80,35 @@ void WeakBlock::sweep()
     if (isEmpty())
         return;
 
+    // Hand each owner all of its dead handles in this block at once. Blocks rarely mix more than a
+    // few owners, so a linear search is fine.
+    Vector<std::pair<WeakHandleOwner*, WeakHandleOwner::DeadHandles>, 4> deadHandlesByOwner;
+    for (size_t i = 0; i < weakImplCount(); ++i) {
+        WeakImpl* weakImpl = &weakImpls()[i];
+        if (weakImpl->state() != WeakImpl::Dead)
+            continue;
+        weakImpl->setState(WeakImpl::Finalized);
+        WeakHandleOwner* weakHandleOwner = weakImpl->weakHandleOwner();
+        if (!weakHandleOwner)
+            continue;
+        size_t ownerIndex = deadHandlesByOwner.findMatching(
+            [&] (auto& entry) { return entry.first == weakHandleOwner; });
+        if (ownerIndex == notFound) {
+            ownerIndex = deadHandlesByOwner.size();
+            deadHandlesByOwner.append({ weakHandleOwner, { } });
+        }
+        deadHandlesByOwner[ownerIndex].second.append({ Handle<Unknown>::wrapSlot(&const_cast<JSValue&>(weakImpl->jsValue())), weakImpl->context() });
+    }
+    // Earlier finalizers can deallocate handles that are still waiting for their owner's batch.
+    for (auto& entry : deadHandlesByOwner) {
+        entry.second.removeAllMatching([] (auto& deadHandle) { return WeakHandleOwner::wasDeallocated(deadHandle); });
+        if (!entry.second.isEmpty())
+            entry.first->finalizeBatch(entry.second);
+    }
+
     SweepResult sweepResult;
     for (size_t i = 0; i < weakImplCount(); ++i) {
         WeakImpl* weakImpl = &weakImpls()[i];
-        if (weakImpl->state() == WeakImpl::Dead)
-            finalize(weakImpl);
         if (weakImpl->state() == WeakImpl::Deallocated)
             addToFreeList(&sweepResult.freeList, weakImpl);
         else {
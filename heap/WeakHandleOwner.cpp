@@ -26,6 +26,8 @@
 #include "config.h"
 #include "WeakHandleOwner.h"
 
+#include "WeakImpl.h"
+
 namespace JSC {
 
 class SlotVisitor;
@@ -44,4 +46,17 @@ void WeakHandleOwner::finalize(Handle<Unknown>, void*)
 {
 }
 
+void WeakHandleOwner::finalizeBatch(const DeadHandles& deadHandles)
+{
+    for (const DeadHandle& deadHandle : deadHandles) {
+        if (!wasDeallocated(deadHandle))
+            finalize(deadHandle.handle, deadHandle.context);
+    }
+}
+
+bool WeakHandleOwner::wasDeallocated(const DeadHandle& deadHandle)
+{
+    return WeakImpl::asWeakImpl(deadHandle.handle.slot())->state() == WeakImpl::Deallocated;
+}
+
 } // namespace JSC
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "Handle.h"
+#include <wtf/Vector.h>
 
 namespace JSC {
 
@@ -37,6 +38,21 @@ public:
     // reason will only be non-null when generating a debug GC heap snapshot.
     virtual bool isReachableFromOpaqueRoots(Handle<Unknown>, void* context, SlotVisitor&, char const** reason = nullptr);
     virtual void finalize(Handle<Unknown>, void* context);
+
+    struct DeadHandle {
+        Handle<Unknown> handle;
+        void* context;
+    };
+    using DeadHandles = Vector<DeadHandle, 16>;
+
+    // Called with all of this owner's handles that died in one WeakBlock, in place of one finalize()
+    // per handle. Owners that can amortize work across handles (for example taking a lock or a
+    // runtime transition once) should override this. The default calls finalize() for each handle.
+    // A finalizer may deallocate handles later in the batch, so overrides must skip the handles for
+    // which wasDeallocated() has become true.
+    virtual void finalizeBatch(const DeadHandles&);
+
+    static bool wasDeallocated(const DeadHandle&);
 };
 
 } // namespace JSC
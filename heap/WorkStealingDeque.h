@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <atomic>
+#include <wtf/Noncopyable.h>
+
+namespace JSC {
+
+// A fixed-capacity Chase-Lev work-stealing deque of pointers. The owning thread pushes and pops at
+// the bottom without taking any lock; other threads steal from the top with a single CAS. A null
+// result means that the deque was empty or that the caller lost a race for the last item.
+//
+// See "Dynamic Circular Work-Stealing Deque" (Chase and Lev, SPAA 2005) and "Correct and
+// Efficient Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013) for the fences.
+template<typename T, size_t capacity>
+class WorkStealingDeque {
+    WTF_MAKE_NONCOPYABLE(WorkStealingDeque);
+    static_assert(!(capacity & (capacity - 1)), "capacity must be a power of two");
+public:
+    WorkStealingDeque() = default;
+
+    // Owner only. Returns false if the deque is full.
+    bool push(T* item)
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(capacity))
+            return false;
+        m_buffer[bottom & mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only.
+    T* pop()
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* item = m_buffer[bottom & mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // This is the last item, so we race with thieves for it.
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                item = nullptr;
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread.
+    T* steal()
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+            return nullptr;
+        T* item = m_buffer[top & mask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return item;
+    }
+
+    // These are racy when called from a thread other than the owner, and are only meant as hints.
+    size_t size() const
+    {
+        int64_t result = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+        return result > 0 ? static_cast<size_t>(result) : 0;
+    }
+    bool isEmpty() const { return !size(); }
+
+private:
+    static constexpr size_t mask = capacity - 1;
+
+    std::atomic<int64_t> m_top { 0 };
+    std::atomic<int64_t> m_bottom { 0 };
+    std::atomic<T*> m_buffer[capacity] { };
+};
+
+} // namespace JSC
@@ -142,7 +142,7 @@ void JSGlobalObjectConsoleClient::startConsoleProfile()
     }
 
     if (m_scriptProfilerAgent)
-        m_scriptProfilerAgent->startTracking(true);
+        m_scriptProfilerAgent->startTracking(true, false);
 }
 
 void JSGlobalObjectConsoleClient::stopConsoleProfile()
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "ScriptProfilerSampleEncoder.h"
+
+#if ENABLE(SAMPLING_PROFILER)
+
+#include <wtf/text/CString.h>
+
+namespace Inspector {
+
+using namespace JSC;
+
+enum class SampleRecordType : uint8_t {
+    String = 1,
+    Frame = 2,
+    Sample = 3,
+};
+
+static void appendVarint(Vector<uint8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80) {
+        buffer.append(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.append(static_cast<uint8_t>(value));
+}
+
+static void appendZigzag(Vector<uint8_t>& buffer, int64_t value)
+{
+    appendVarint(buffer, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+unsigned ScriptProfilerSampleEncoder::internString(Vector<uint8_t>& buffer, const String& string)
+{
+    const String& key = string.isNull() ? emptyString() : string;
+    auto addResult = m_strings.add(key, m_strings.size());
+    if (!addResult.isNewEntry)
+        return addResult.iterator->value;
+
+    CString utf8 = key.utf8();
+    buffer.append(static_cast<uint8_t>(SampleRecordType::String));
+    appendVarint(buffer, utf8.length());
+    buffer.append(reinterpret_cast<const uint8_t*>(utf8.data()), utf8.length());
+    return addResult.iterator->value;
+}
+
+unsigned ScriptProfilerSampleEncoder::internFrame(Vector<uint8_t>& buffer, VM& vm, SamplingProfiler::StackFrame& stackFrame)
+{
+    unsigned name = internString(buffer, stackFrame.displayName(vm));
+    unsigned url = internString(buffer, stackFrame.url());
+    int expressionLine = stackFrame.hasExpressionInfo() ? static_cast<int>(stackFrame.lineNumber()) : -1;
+    int expressionColumn = stackFrame.hasExpressionInfo() ? static_cast<int>(stackFrame.columnNumber()) : -1;
+    FrameKey key(name, url, stackFrame.sourceID(), stackFrame.functionStartLine(), static_cast<int>(stackFrame.functionStartColumn()), expressionLine, expressionColumn);
+
+    auto addResult = m_frames.add(key, m_frames.size());
+    if (!addResult.isNewEntry)
+        return addResult.iterator->value;
+
+    buffer.append(static_cast<uint8_t>(SampleRecordType::Frame));
+    appendVarint(buffer, key.name);
+    appendVarint(buffer, key.url);
+    appendZigzag(buffer, key.sourceID);
+    appendZigzag(buffer, key.line);
+    appendZigzag(buffer, key.column);
+    appendZigzag(buffer, key.expressionLine);
+    appendZigzag(buffer, key.expressionColumn);
+    return addResult.iterator->value;
+}
+
+Vector<uint8_t> ScriptProfilerSampleEncoder::encode(VM& vm, Vector<SamplingProfiler::StackTrace>&& stackTraces)
+{
+    Vector<uint8_t> buffer;
+    if (stackTraces.isEmpty())
+        return buffer;
+
+    buffer.append(formatVersion);
+
+    Vector<unsigned> stack;
+    for (SamplingProfiler::StackTrace& stackTrace : stackTraces) {
+        // Frames are interned before the sample record so that their definitions precede their first use.
+        stack.shrink(0);
+        for (SamplingProfiler::StackFrame& stackFrame : stackTrace.frames)
+            stack.append(internFrame(buffer, vm, stackFrame));
+
+        size_t sharedFrames = 0;
+        while (sharedFrames < stack.size() && sharedFrames < m_previousStack.size() && stack[sharedFrames] == m_previousStack[sharedFrames])
+            ++sharedFrames;
+
+        int64_t timestamp = static_cast<int64_t>(stackTrace.timestamp.microseconds());
+        buffer.append(static_cast<uint8_t>(SampleRecordType::Sample));
+        appendZigzag(buffer, timestamp - m_previousTimestamp);
+        appendVarint(buffer, sharedFrames);
+        appendVarint(buffer, stack.size() - sharedFrames);
+        for (size_t i = sharedFrames; i < stack.size(); ++i)
+            appendVarint(buffer, stack[i]);
+
+        m_previousTimestamp = timestamp;
+        std::swap(m_previousStack, stack);
+    }
+
+    return buffer;
+}
+
+void ScriptProfilerSampleEncoder::reset()
+{
+    m_strings.clear();
+    m_frames.clear();
+    m_previousStack.clear();
+    m_previousTimestamp = 0;
+}
+
+} // namespace Inspector
+
+#endif // ENABLE(SAMPLING_PROFILER)
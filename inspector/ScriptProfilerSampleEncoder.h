@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#if ENABLE(SAMPLING_PROFILER)
+
+#include "SamplingProfiler.h"
+#include <wtf/HashMap.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
+#include <wtf/text/StringHash.h>
+
+namespace Inspector {
+
+// Encodes SamplingProfiler stack traces into a compact binary stream. Names, URLs
+// and frames are interned, so that each is written once per tracking session and
+// later chunks refer to them by index. All integers are unsigned LEB128; values
+// that may be negative are zigzag encoded first.
+//
+// A chunk starts with the format version byte, followed by records:
+//
+//   0x01 String  length, UTF-8 bytes. Assigned the next string index.
+//   0x02 Frame   name string index, url string index, sourceID, function line (zigzag),
+//                function column (zigzag), expression line (zigzag), expression column
+//                (zigzag). Unavailable positions are -1. Assigned the next frame index.
+//   0x03 Sample  timestamp delta from the previous sample in microseconds (zigzag),
+//                number of bottom frames shared with the previous sample, number of
+//                remaining frames, then that many frame indices, bottom to top.
+class ScriptProfilerSampleEncoder {
+    WTF_MAKE_NONCOPYABLE(ScriptProfilerSampleEncoder);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr uint8_t formatVersion = 1;
+
+    ScriptProfilerSampleEncoder() = default;
+
+    // Returns an empty vector if there were no stack traces.
+    Vector<uint8_t> encode(JSC::VM&, Vector<JSC::SamplingProfiler::StackTrace>&&);
+    void reset();
+
+private:
+    struct FrameKey {
+        FrameKey() = default;
+
+        FrameKey(unsigned name, unsigned url, intptr_t sourceID, int line, int column, int expressionLine, int expressionColumn)
+            : name(name)
+            , url(url)
+            , sourceID(sourceID)
+            , line(line)
+            , column(column)
+            , expressionLine(expressionLine)
+            , expressionColumn(expressionColumn)
+        { }
+
+        FrameKey(WTF::HashTableDeletedValueType)
+            : name(deletedIndex)
+        { }
+
+        bool isHashTableDeletedValue() const { return name == deletedIndex; }
+        bool operator==(const FrameKey& other) const
+        {
+            return name == other.name
+                && url == other.url
+                && sourceID == other.sourceID
+                && line == other.line
+                && column == other.column
+                && expressionLine == other.expressionLine
+                && expressionColumn == other.expressionColumn;
+        }
+
+        unsigned hash() const
+        {
+            unsigned result = WTF::pairIntHash(name, url);
+            result = WTF::pairIntHash(result, static_cast<unsigned>(sourceID));
+            result = WTF::pairIntHash(result, WTF::pairIntHash(line, column));
+            return WTF::pairIntHash(result, WTF::pairIntHash(expressionLine, expressionColumn));
+        }
+
+        static constexpr unsigned emptyIndex = std::numeric_limits<unsigned>::max();
+        static constexpr unsigned deletedIndex = std::numeric_limits<unsigned>::max() - 1;
+
+        unsigned name { emptyIndex };
+        unsigned url { emptyIndex };
+        intptr_t sourceID { 0 };
+        int line { 0 };
+        int column { 0 };
+        int expressionLine { 0 };
+        int expressionColumn { 0 };
+    };
+
+    struct FrameKeyHash {
+        static unsigned hash(const FrameKey& key) { return key.hash(); }
+        static bool equal(const FrameKey& a, const FrameKey& b) { return a == b; }
+        static constexpr bool safeToCompareToEmptyOrDeleted = true;
+    };
+
+    struct FrameKeyHashTraits : WTF::SimpleClassHashTraits<FrameKey> {
+        static constexpr bool emptyValueIsZero = false;
+    };
+
+    unsigned internString(Vector<uint8_t>&, const String&);
+    unsigned internFrame(Vector<uint8_t>&, JSC::VM&, JSC::SamplingProfiler::StackFrame&);
+
+    HashMap<String, unsigned> m_strings;
+    HashMap<FrameKey, unsigned, FrameKeyHash, FrameKeyHashTraits> m_frames;
+    Vector<unsigned> m_previousStack;
+    int64_t m_previousTimestamp { 0 };
+};
+
+} // namespace Inspector
+
+#endif // ENABLE(SAMPLING_PROFILER)
@@ -26,12 +26,15 @@
 #include "config.h"
 #include "InspectorHeapAgent.h"
 
+#include "BlockDirectory.h"
+#include "HeapAllocationSampler.h"
 #include "HeapProfiler.h"
 #include "HeapSnapshot.h"
 #include "InjectedScript.h"
 #include "InjectedScriptManager.h"
 #include "InspectorEnvironment.h"
 #include "JSBigInt.h"
+#include "Subspace.h"
 #include "VM.h"
 #include <wtf/Stopwatch.h>
 
@@ -79,6 +82,13 @@ Protocol::ErrorStringOr<void> InspectorHeapAgent::disable()
     m_enabled = false;
     m_tracking = false;
 
+    if (m_samplingAllocations) {
+        m_samplingAllocations = false;
+        VM& vm = m_environment.vm();
+        JSLockHolder lock(vm);
+        vm.heap.stopAllocationSampling();
+    }
+
     m_environment.vm().heap.removeObserver(this);
 
     clearHeapSnapshots();
@@ -118,6 +128,86 @@ Protocol::ErrorStringOr<std::tuple<double, Protocol::Heap::HeapSnapshotData>> In
     return { { timestamp, snapshotData } };
 }
 
+Protocol::ErrorStringOr<Ref<JSON::ArrayOf<Protocol::Heap::SizeClassOccupancy>>> InspectorHeapAgent::getOccupancyStatistics()
+{
+    VM& vm = m_environment.vm();
+    JSLockHolder lock(vm);
+
+    auto sizeClasses = JSON::ArrayOf<Protocol::Heap::SizeClassOccupancy>::create();
+    vm.heap.objectSpace().forEachDirectory(
+        [&] (BlockDirectory& directory) -> IterationStatus {
+            auto statistics = directory.occupancyStatistics();
+
+            auto histogram = JSON::ArrayOf<int>::create();
+            for (size_t blockCount : statistics.occupancyHistogram)
+                histogram->addItem(static_cast<int>(blockCount));
+
+            sizeClasses->addItem(Protocol::Heap::SizeClassOccupancy::create()
+                .setSubspace(String(directory.subspace()->name()))
+                .setCellSize(static_cast<int>(directory.cellSize()))
+                .setBlockCount(static_cast<int>(statistics.blockCount))
+                .setEmptyBlockCount(static_cast<int>(statistics.emptyBlockCount))
+                .setLiveCellCount(statistics.liveCellCount)
+                .setFreeCellCount(statistics.cellCapacity - statistics.liveCellCount)
+                .setLiveBytes(statistics.liveCellCount * directory.cellSize())
+                .setCapacityBytes(statistics.cellCapacity * directory.cellSize())
+                .setOccupancyHistogram(WTFMove(histogram))
+                .release());
+            return IterationStatus::Continue;
+        });
+
+    return sizeClasses;
+}
+
+Protocol::ErrorStringOr<void> InspectorHeapAgent::startAllocationSampling(Optional<int>&& sampleInterval)
+{
+    if (sampleInterval && *sampleInterval <= 0)
+        return makeUnexpected("sampleInterval must be positive"_s);
+
+    VM& vm = m_environment.vm();
+    JSLockHolder lock(vm);
+    vm.heap.startAllocationSampling(sampleInterval.valueOr(32 * KB));
+    m_samplingAllocations = true;
+
+    return { };
+}
+
+Protocol::ErrorStringOr<std::tuple<Ref<JSON::ArrayOf<Protocol::Heap::AllocationSample>>, int>> InspectorHeapAgent::stopAllocationSampling()
+{
+    if (!m_samplingAllocations)
+        return makeUnexpected("Allocation sampling was not started"_s);
+    m_samplingAllocations = false;
+
+    VM& vm = m_environment.vm();
+    JSLockHolder lock(vm);
+    std::unique_ptr<HeapAllocationSampler> sampler = vm.heap.stopAllocationSampling();
+    if (!sampler)
+        return makeUnexpected("Allocation sampling was stopped by another client"_s);
+
+    auto samples = JSON::ArrayOf<Protocol::Heap::AllocationSample>::create();
+    for (auto& sample : sampler->takeSamples()) {
+        auto stackTrace = JSON::ArrayOf<Protocol::Console::CallFrame>::create();
+        for (auto& frame : sample.stackTrace) {
+            stackTrace->addItem(Protocol::Console::CallFrame::create()
+                .setFunctionName(frame.functionName)
+                .setUrl(frame.url)
+                .setScriptId(String::number(frame.sourceID))
+                .setLineNumber(frame.line)
+                .setColumnNumber(frame.column)
+                .release());
+        }
+
+        samples->addItem(Protocol::Heap::AllocationSample::create()
+            .setBytes(sample.bytes)
+            .setCellSize(sample.cellSize)
+            .setLive(sample.isLive())
+            .setStackTrace(WTFMove(stackTrace))
+            .release());
+    }
+
+    return { { WTFMove(samples), static_cast<int>(sampler->droppedSampleCount()) } };
+}
+
 Protocol::ErrorStringOr<void> InspectorHeapAgent::startTracking()
 {
     if (m_tracking)
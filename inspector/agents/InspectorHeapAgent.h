@@ -57,6 +57,9 @@ public:
     Protocol::ErrorStringOr<void> disable() override;
     Protocol::ErrorStringOr<void> gc() final;
     Protocol::ErrorStringOr<std::tuple<double, Protocol::Heap::HeapSnapshotData>> snapshot() final;
+    Protocol::ErrorStringOr<Ref<JSON::ArrayOf<Protocol::Heap::SizeClassOccupancy>>> getOccupancyStatistics() final;
+    Protocol::ErrorStringOr<void> startAllocationSampling(Optional<int>&& sampleInterval) final;
+    Protocol::ErrorStringOr<std::tuple<Ref<JSON::ArrayOf<Protocol::Heap::AllocationSample>>, int /* droppedSampleCount */>> stopAllocationSampling() final;
     Protocol::ErrorStringOr<void> startTracking() final;
     Protocol::ErrorStringOr<void> stopTracking() final;
     Protocol::ErrorStringOr<std::tuple<String, RefPtr<Protocol::Debugger::FunctionDetails>, RefPtr<Protocol::Runtime::ObjectPreview>>> getPreview(int heapObjectId) final;
@@ -81,6 +84,7 @@ private:
 
     bool m_enabled { false };
     bool m_tracking { false };
+    bool m_samplingAllocations { false };
     Seconds m_gcStartTime { Seconds::nan() };
 };
 
@@ -32,11 +32,17 @@
 #include "InspectorEnvironment.h"
 #include "SamplingProfiler.h"
 #include <wtf/Stopwatch.h>
+#include <wtf/text/Base64.h>
 
 namespace Inspector {
 
 using namespace JSC;
 
+#if ENABLE(SAMPLING_PROFILER)
+// Compact samples are flushed when a script evaluation finishes, at most this often.
+static constexpr Seconds compactSamplesFlushInterval = 250_ms;
+#endif
+
 InspectorScriptProfilerAgent::InspectorScriptProfilerAgent(AgentContext& context)
     : InspectorAgentBase("ScriptProfiler"_s)
     , m_frontendDispatcher(makeUnique<ScriptProfilerFrontendDispatcher>(context.frontendRouter))
@@ -64,7 +70,7 @@ void InspectorScriptProfilerAgent::willDestroyFrontendAndBackend(DisconnectReaso
     }
 }
 
-Protocol::ErrorStringOr<void> InspectorScriptProfilerAgent::startTracking(Optional<bool>&& includeSamples)
+Protocol::ErrorStringOr<void> InspectorScriptProfilerAgent::startTracking(Optional<bool>&& includeSamples, Optional<bool>&& compactSamples)
 {
     if (m_tracking)
         return { };
@@ -83,9 +89,14 @@ Protocol::ErrorStringOr<void> InspectorScriptProfilerAgent::startTracking(Option
         samplingProfiler.noticeCurrentThreadAsJSCExecutionThread(locker);
         samplingProfiler.start(locker);
         m_enabledSamplingProfiler = true;
+
+        m_compactSamples = compactSamples && *compactSamples;
+        m_sampleEncoder.reset();
+        m_lastCompactSamplesFlush = stopwatch.elapsedTime();
     }
 #else
     UNUSED_PARAM(includeSamples);
+    UNUSED_PARAM(compactSamples);
 #endif // ENABLE(SAMPLING_PROFILER)
 
     m_environment.debugger().setProfilingClient(this);
@@ -137,6 +148,13 @@ void InspectorScriptProfilerAgent::didEvaluateScript(Seconds startTime, Profilin
     Seconds endTime = m_environment.executionStopwatch().elapsedTime();
 
     addEvent(startTime, endTime, reason);
+
+#if ENABLE(SAMPLING_PROFILER)
+    if (m_compactSamples && endTime - m_lastCompactSamplesFlush >= compactSamplesFlushInterval) {
+        m_lastCompactSamplesFlush = endTime;
+        flushCompactSamples();
+    }
+#endif
 }
 
 static Protocol::ScriptProfiler::EventType toProtocol(ProfilingReason reason)
@@ -203,6 +221,27 @@ static Ref<Protocol::ScriptProfiler::Samples> buildSamples(VM& vm, Vector<Sampli
         .setStackTraces(WTFMove(stackTraces))
         .release();
 }
+
+void InspectorScriptProfilerAgent::flushCompactSamples()
+{
+    ASSERT(m_enabledSamplingProfiler);
+
+    VM& vm = m_environment.debugger().vm();
+    JSLockHolder lock(vm);
+    DeferGC deferGC(vm.heap); // This is required because we will have raw pointers into the heap after we releaseStackTraces().
+    SamplingProfiler* samplingProfiler = vm.samplingProfiler();
+    RELEASE_ASSERT(samplingProfiler);
+
+    LockHolder locker(samplingProfiler->getLock());
+    Vector<SamplingProfiler::StackTrace> stackTraces = samplingProfiler->releaseStackTraces(locker);
+    locker.unlockEarly();
+
+    Vector<uint8_t> data = m_sampleEncoder.encode(vm, WTFMove(stackTraces));
+    if (data.isEmpty())
+        return;
+
+    m_frontendDispatcher->compactSamplesUpdate(base64Encode(data.data(), data.size()));
+}
 #endif // ENABLE(SAMPLING_PROFILER)
 
 void InspectorScriptProfilerAgent::trackingComplete()
@@ -210,7 +249,24 @@ void InspectorScriptProfilerAgent::trackingComplete()
     auto timestamp = m_environment.executionStopwatch().elapsedTime().seconds();
 
 #if ENABLE(SAMPLING_PROFILER)
-    if (m_enabledSamplingProfiler) {
+    if (m_enabledSamplingProfiler && m_compactSamples) {
+        flushCompactSamples();
+
+        VM& vm = m_environment.debugger().vm();
+        JSLockHolder lock(vm);
+        SamplingProfiler* samplingProfiler = vm.samplingProfiler();
+        RELEASE_ASSERT(samplingProfiler);
+        LockHolder locker(samplingProfiler->getLock());
+        samplingProfiler->pause(locker);
+        samplingProfiler->clearData(locker);
+        locker.unlockEarly();
+
+        m_sampleEncoder.reset();
+        m_compactSamples = false;
+        m_enabledSamplingProfiler = false;
+
+        m_frontendDispatcher->trackingComplete(timestamp, nullptr);
+    } else if (m_enabledSamplingProfiler) {
         VM& vm = m_environment.debugger().vm();
         JSLockHolder lock(vm);
         DeferGC deferGC(vm.heap); // This is required because we will have raw pointers into the heap after we releaseStackTraces().
@@ -248,6 +304,8 @@ void InspectorScriptProfilerAgent::stopSamplingWhenDisconnecting()
     samplingProfiler->pause(locker);
     samplingProfiler->clearData(locker);
 
+    m_sampleEncoder.reset();
+    m_compactSamples = false;
     m_enabledSamplingProfiler = false;
 #endif
 }
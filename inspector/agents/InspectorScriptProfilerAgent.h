@@ -29,6 +29,7 @@
 #include "InspectorAgentBase.h"
 #include "InspectorBackendDispatchers.h"
 #include "InspectorFrontendDispatchers.h"
+#include "ScriptProfilerSampleEncoder.h"
 #include <wtf/Noncopyable.h>
 
 namespace JSC {
@@ -49,7 +50,7 @@ public:
     void willDestroyFrontendAndBackend(DisconnectReason) final;
 
     // ScriptProfilerBackendDispatcherHandler
-    Protocol::ErrorStringOr<void> startTracking(Optional<bool>&& includeSamples) final;
+    Protocol::ErrorStringOr<void> startTracking(Optional<bool>&& includeSamples, Optional<bool>&& compactSamples) final;
     Protocol::ErrorStringOr<void> stopTracking() final;
 
     // JSC::Debugger::ProfilingClient
@@ -61,6 +62,9 @@ private:
     void addEvent(Seconds startTime, Seconds endTime, JSC::ProfilingReason);
     void trackingComplete();
     void stopSamplingWhenDisconnecting();
+#if ENABLE(SAMPLING_PROFILER)
+    void flushCompactSamples();
+#endif
 
     std::unique_ptr<ScriptProfilerFrontendDispatcher> m_frontendDispatcher;
     RefPtr<ScriptProfilerBackendDispatcher> m_backendDispatcher;
@@ -68,6 +72,9 @@ private:
     bool m_tracking { false };
 #if ENABLE(SAMPLING_PROFILER)
     bool m_enabledSamplingProfiler { false };
+    bool m_compactSamples { false };
+    ScriptProfilerSampleEncoder m_sampleEncoder;
+    Seconds m_lastCompactSamplesFlush;
 #endif
     bool m_activeEvaluateScript { false };
 };
@@ -36,6 +36,7 @@
 #include "CatchScope.h"
 #include "CheckpointOSRExitSideState.h"
 #include "CodeBlock.h"
+#include "CodeCache.h"
 #include "DirectArguments.h"
 #include "Debugger.h"
 #include "DirectEvalCodeCache.h"
@@ -127,6 +128,7 @@ JSValue eval(JSGlobalObject* globalObject, CallFrame* callFrame, ECMAMode ecmaMo
         evalContextType = EvalContextType::None;
 
     DirectEvalExecutable* eval = callerCodeBlock->directEvalCodeCache().tryGet(programSource, callerCallSiteIndex);
+    vm.codeCache()->noteDirectEvalLookup(!!eval);
     if (!eval) {
         if (!ecmaMode.isStrict()) {
             if (programSource.is8Bit()) {
@@ -374,7 +376,6 @@ public:
         , m_framesToSkip(framesToSkip)
         , m_remainingCapacityForFrameCapture(capacity)
     {
-        m_results.reserveInitialCapacity(capacity);
     }
 
     StackVisitor::Status operator()(StackVisitor& visitor) const
@@ -417,22 +418,11 @@ void Interpreter::getStackTrace(JSCell* owner, Vector<StackFrame>& results, size
     if (!callFrame || !maxStackSize)
         return;
 
-    size_t framesCount = 0;
-    size_t maxFramesCountNeeded = maxStackSize + framesToSkip;
-    StackVisitor::visit(callFrame, vm, [&] (StackVisitor&) -> StackVisitor::Status {
-        if (++framesCount < maxFramesCountNeeded)
-            return StackVisitor::Continue;
-        return StackVisitor::Done;
-    });
-    if (framesCount <= framesToSkip)
-        return;
-
-    framesCount -= framesToSkip;
-    framesCount = std::min(maxStackSize, framesCount);
-
-    GetStackTraceFunctor functor(vm, owner, results, framesToSkip, framesCount);
+    // Walking the stack dominates the cost of creating an error, so we capture in a single walk instead of
+    // counting the frames first, and only trim the storage afterwards.
+    GetStackTraceFunctor functor(vm, owner, results, framesToSkip, maxStackSize);
     StackVisitor::visit(callFrame, vm, functor);
-    ASSERT(results.size() == results.capacity());
+    results.shrinkToFit();
 }
 
 String Interpreter::stackTraceAsString(VM& vm, const Vector<StackFrame>& stackTrace)
@@ -555,7 +545,7 @@ private:
     void copyCalleeSavesToEntryFrameCalleeSavesBuffer(StackVisitor& visitor) const
     {
 #if ENABLE(ASSEMBLER)
-        Optional<RegisterAtOffsetList> currentCalleeSaves = visitor->calleeSaveRegistersForUnwinding();
+        const RegisterAtOffsetList* currentCalleeSaves = visitor->calleeSaveRegistersForUnwinding();
 
         if (!currentCalleeSaves)
             return;
@@ -84,6 +84,12 @@ extern "C" {
 }
 #endif
 
+#if OS(LINUX)
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#endif
+
 namespace JSC {
 
 using namespace WTF;
@@ -309,6 +315,24 @@ static ALWAYS_INLINE void initializeSeparatedWXHeaps(void*, size_t, void*, size_
 }
 #endif
 
+#if OS(LINUX) && defined(MADV_HUGEPAGE)
+// Asks for transparent huge pages over the pool, or over its first jitTransparentHugePageRegionSize
+// bytes, to cut iTLB misses in hot JIT code. This is only a hint, and the kernel may still back the
+// range with small pages.
+static void adviseTransparentHugePages(void* base, size_t size)
+{
+    constexpr uintptr_t hugePageSize = 2 * MB;
+    size_t hintedSize = Options::jitTransparentHugePageRegionSize() ? std::min<size_t>(size, Options::jitTransparentHugePageRegionSize()) : size;
+    uintptr_t start = roundUpToMultipleOf(hugePageSize, bitwise_cast<uintptr_t>(base));
+    uintptr_t end = bitwise_cast<uintptr_t>(base) + hintedSize;
+    end -= end % hugePageSize;
+    if (start >= end)
+        return;
+    if (madvise(bitwise_cast<void*>(start), end - start, MADV_HUGEPAGE))
+        dataLogLnIf(Options::logExecutableAllocation(), "madvise(MADV_HUGEPAGE) on JIT memory failed: ", strerror(errno));
+}
+#endif
+
 struct JITReservation {
     PageReservation pageReservation;
     void* base { nullptr };
@@ -360,6 +384,11 @@ static ALWAYS_INLINE JITReservation initializeJITPageReservation()
         }
 #endif
 
+#if OS(LINUX) && defined(MADV_HUGEPAGE)
+        if (Options::useTransparentHugePagesForJIT())
+            adviseTransparentHugePages(reservation.base, reservation.size);
+#endif
+
         void* reservationEnd = reinterpret_cast<uint8_t*>(reservation.base) + reservation.size;
         g_jscConfig.startExecutableMemory = tagCodePtr<ExecutableMemoryPtrTag>(reservation.base);
         g_jscConfig.endExecutableMemory = tagCodePtr<ExecutableMemoryPtrTag>(reservationEnd);
@@ -834,7 +834,7 @@ void JIT::compileWithoutLinking(JITCompilationEffort effort)
     if (UNLIKELY(reportCompileTimes())) {
         CString codeBlockName = toCString(*m_codeBlock);
         
-        dataLog("Optimized ", codeBlockName, " with Baseline JIT into ", m_linkBuffer->size(), " bytes in ", (after - before).milliseconds(), " ms.\n");
+        dataLog("Optimized ", codeBlockName, " with Baseline JIT into ", m_linkBuffer->size(), " bytes (", static_cast<double>(m_linkBuffer->size()) / std::max(m_codeBlock->instructionsSize(), 1u), " per bytecode byte) in ", (after - before).milliseconds(), " ms.\n");
     }
 }
 
@@ -962,8 +962,14 @@ CompilationResult JIT::link()
         m_vm->m_perBytecodeProfiler->addCompilation(m_codeBlock, *m_compilation);
     }
 
-    if (m_pcToCodeOriginMapBuilder.didBuildMapping())
-        m_codeBlock->setPCToCodeOriginMap(makeUnique<PCToCodeOriginMap>(WTFMove(m_pcToCodeOriginMapBuilder), patchBuffer));
+    if (m_pcToCodeOriginMapBuilder.didBuildMapping()) {
+        auto map = makeUnique<PCToCodeOriginMap>(WTFMove(m_pcToCodeOriginMapBuilder), patchBuffer);
+#if OS(LINUX)
+        if (UNLIKELY(Options::logJITCodeForPerf()))
+            map->recordDebugInfoForPerf(m_codeBlock, patchBuffer);
+#endif
+        m_codeBlock->setPCToCodeOriginMap(WTFMove(map));
+    }
     
     CodeRef<JSEntryPtrTag> result = FINALIZE_CODE(
         patchBuffer, JSEntryPtrTag,
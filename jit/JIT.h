@@ -329,6 +329,8 @@ namespace JSC {
         void addJump(Jump, int);
         void addJump(const JumpList&, int);
         void emitJumpSlowToHot(Jump, int);
+        template<typename Metadata>
+        void emitProfiledBranch(Metadata&, JumpList taken, int relativeOffset);
 
         template<typename Op>
         void compileOpCall(const Instruction*, unsigned callLinkInfoIndex);
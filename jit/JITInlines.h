@@ -245,6 +245,18 @@ ALWAYS_INLINE void JIT::addJump(const JumpList& jumpList, int relativeOffset)
         addJump(jump, relativeOffset);
 }
 
+template<typename Metadata>
+ALWAYS_INLINE void JIT::emitProfiledBranch(Metadata& metadata, JumpList taken, int relativeOffset)
+{
+    // Keep the direction counts that the LLInt started so that the DFG can turn them into branch weights.
+    add32(TrustedImm32(1), AbsoluteAddress(&metadata.m_notTakenCount));
+    Jump done = jump();
+    taken.link(this);
+    add32(TrustedImm32(1), AbsoluteAddress(&metadata.m_takenCount));
+    addJump(jump(), relativeOffset);
+    done.link(this);
+}
+
 ALWAYS_INLINE void JIT::emitJumpSlowToHot(Jump jump, int relativeOffset)
 {
     ASSERT(m_bytecodeIndex); // This method should only be called during hot/cold path generation, so that m_bytecodeIndex is set.
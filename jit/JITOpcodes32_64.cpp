@@ -406,7 +406,7 @@ void JIT::emit_op_jfalse(const Instruction* currentInstruction)
     GPRReg scratch1 = regT2;
     GPRReg scratch2 = regT3;
     bool shouldCheckMasqueradesAsUndefined = true;
-    addJump(branchIfFalsey(vm(), value, scratch1, scratch2, fpRegT0, fpRegT1, shouldCheckMasqueradesAsUndefined, m_codeBlock->globalObject()), target);
+    emitProfiledBranch(bytecode.metadata(m_codeBlock), branchIfFalsey(vm(), value, scratch1, scratch2, fpRegT0, fpRegT1, shouldCheckMasqueradesAsUndefined, m_codeBlock->globalObject()), target);
 }
 
 void JIT::emit_op_jtrue(const Instruction* currentInstruction)
@@ -420,7 +420,7 @@ void JIT::emit_op_jtrue(const Instruction* currentInstruction)
     JSValueRegs value(regT1, regT0);
     GPRReg scratch1 = regT2;
     GPRReg scratch2 = regT3;
-    addJump(branchIfTruthy(vm(), value, scratch1, scratch2, fpRegT0, fpRegT1, shouldCheckMasqueradesAsUndefined, m_codeBlock->globalObject()), target);
+    emitProfiledBranch(bytecode.metadata(m_codeBlock), branchIfTruthy(vm(), value, scratch1, scratch2, fpRegT0, fpRegT1, shouldCheckMasqueradesAsUndefined, m_codeBlock->globalObject()), target);
 }
 
 void JIT::emit_op_jeq_null(const Instruction* currentInstruction)
@@ -1359,6 +1359,9 @@ void JIT::emit_op_profile_type(const Instruction* currentInstruction)
     TypeLocation* cachedTypeLocation = metadata.m_typeLocation;
     VirtualRegister valueToProfile = bytecode.m_targetVirtualRegister;
 
+    if (!cachedTypeLocation->m_isSampledInJIT)
+        return;
+
     // Load payload in T0. Load tag in T3.
     emitLoadPayload(valueToProfile, regT0);
     emitLoadTag(valueToProfile, regT3);
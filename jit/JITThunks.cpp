@@ -228,6 +228,17 @@ NativeExecutable* JITThunks::hostFunctionStub(VM& vm, TaggedNativeFunction funct
     return nativeExecutable;
 }
 
+NativeExecutable* JITThunks::uncachedHostFunctionStub(VM& vm, TaggedNativeFunction function, const DOMJIT::Signature* signature, const String& name)
+{
+    ASSERT(!isCompilationThread());
+    ASSERT(Options::useJIT());
+    ASSERT(signature);
+
+    Ref<JITCode> forCall = adoptRef(*new NativeDOMJITCode(MacroAssemblerCodeRef<JSEntryPtrTag>::createSelfManagedCodeRef(ctiNativeCall(vm).retagged<JSEntryPtrTag>()), JITType::HostCallThunk, NoIntrinsic, signature));
+    Ref<JITCode> forConstruct = adoptRef(*new NativeJITCode(MacroAssemblerCodeRef<JSEntryPtrTag>::createSelfManagedCodeRef(ctiNativeConstruct(vm).retagged<JSEntryPtrTag>()), JITType::HostCallThunk, NoIntrinsic));
+    return NativeExecutable::create(vm, WTFMove(forCall), function, WTFMove(forConstruct), callHostFunctionAsConstructor, name);
+}
+
 NativeExecutable* JITThunks::hostFunctionStub(VM& vm, TaggedNativeFunction function, ThunkGenerator generator, Intrinsic intrinsic, const String& name)
 {
     return hostFunctionStub(vm, function, callHostFunctionAsConstructor, generator, intrinsic, nullptr, name);
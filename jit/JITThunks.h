@@ -65,6 +65,8 @@ public:
     NativeExecutable* hostFunctionStub(VM&, TaggedNativeFunction, TaggedNativeFunction constructor, const String& name);
     NativeExecutable* hostFunctionStub(VM&, TaggedNativeFunction, TaggedNativeFunction constructor, ThunkGenerator, Intrinsic, const DOMJIT::Signature*, const String& name);
     NativeExecutable* hostFunctionStub(VM&, TaggedNativeFunction, ThunkGenerator, Intrinsic, const String& name);
+    // Not entered into the host function cache: the signature is what distinguishes these executables.
+    NativeExecutable* uncachedHostFunctionStub(VM&, TaggedNativeFunction, const DOMJIT::Signature*, const String& name);
 
 private:
     void finalize(Handle<Unknown>, void* context) final;
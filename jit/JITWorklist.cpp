@@ -308,6 +308,12 @@ void JITWorklist::compileNow(CodeBlock* codeBlock, BytecodeIndex loopOSREntryByt
     codeBlock->ownerExecutable()->installCode(codeBlock);
 }
 
+size_t JITWorklist::queueLength()
+{
+    LockHolder locker(*m_lock);
+    return m_queue.size();
+}
+
 void JITWorklist::finalizePlans(Plans& myPlans)
 {
     for (RefPtr<Plan>& plan : myPlans) {
@@ -29,8 +29,12 @@
 #if ENABLE(JIT)
 
 #include "B3PCToOriginMap.h"
+#include "CodeBlock.h"
 #include "DFGNode.h"
+#include "InlineCallFrame.h"
+#include "IterationStatus.h"
 #include "LinkBuffer.h"
+#include "PerfLog.h"
 #include <wtf/Optional.h>
 
 #if COMPILER(MSVC)
@@ -91,6 +95,8 @@ public:
         return result;
     }
 
+    bool atEnd() const { return m_offset >= m_size; }
+
 private:
     uint8_t* m_buffer;
     size_t m_size;
@@ -247,19 +253,16 @@ double PCToCodeOriginMap::memorySize()
     return size;
 }
 
-Optional<CodeOrigin> PCToCodeOriginMap::findPC(void* pc) const
+template<typename Functor>
+void PCToCodeOriginMap::forEachRange(const Functor& functor) const
 {
-    uintptr_t pcAsInt = bitwise_cast<uintptr_t>(pc);
-    if (!(m_pcRangeStart <= pcAsInt && pcAsInt <= m_pcRangeEnd))
-        return WTF::nullopt;
-
     uintptr_t currentPC = 0;
     BytecodeIndex currentBytecodeIndex = BytecodeIndex(0);
     InlineCallFrame* currentInlineCallFrame = nullptr;
 
     DeltaCompresseionReader pcReader(m_compressedPCs, m_compressedPCBufferSize);
     DeltaCompresseionReader codeOriginReader(m_compressedCodeOrigins, m_compressedCodeOriginsSize);
-    while (true) {
+    while (!pcReader.atEnd()) {
         uintptr_t previousPC = currentPC;
         {
             uint8_t value = pcReader.read<uint8_t>();
@@ -291,18 +294,52 @@ Optional<CodeOrigin> PCToCodeOriginMap::findPC(void* pc) const
         }
 
         if (previousPC) {
-            uintptr_t startOfRange = previousPC;
             // We subtract 1 because we generate end points inclusively in this table, even though we are interested in ranges of the form: [previousPC, currentPC)
-            uintptr_t endOfRange = currentPC - 1;
-            if (startOfRange <= pcAsInt && pcAsInt <= endOfRange)
-                return Optional<CodeOrigin>(previousOrigin); // We return previousOrigin here because CodeOrigin's are mapped to the startValue of the range.
+            // CodeOrigin's are mapped to the startValue of the range, hence previousOrigin.
+            if (functor(previousPC, currentPC - 1, previousOrigin) == IterationStatus::Done)
+                return;
         }
     }
+}
 
-    RELEASE_ASSERT_NOT_REACHED();
-    return WTF::nullopt;
+Optional<CodeOrigin> PCToCodeOriginMap::findPC(void* pc) const
+{
+    uintptr_t pcAsInt = bitwise_cast<uintptr_t>(pc);
+    if (!(m_pcRangeStart <= pcAsInt && pcAsInt <= m_pcRangeEnd))
+        return WTF::nullopt;
+
+    Optional<CodeOrigin> result;
+    forEachRange([&] (uintptr_t startOfRange, uintptr_t endOfRange, const CodeOrigin& codeOrigin) {
+        if (startOfRange <= pcAsInt && pcAsInt <= endOfRange) {
+            result = codeOrigin;
+            return IterationStatus::Done;
+        }
+        return IterationStatus::Continue;
+    });
+    ASSERT(result);
+    return result;
 }
 
+#if OS(LINUX)
+void PCToCodeOriginMap::recordDebugInfoForPerf(CodeBlock* codeBlock, LinkBuffer& linkBuffer) const
+{
+    Vector<PerfLog::DebugEntry> entries;
+    CodeBlock* lastCodeBlock = nullptr;
+    CString fileName;
+    forEachRange([&] (uintptr_t startOfRange, uintptr_t, const CodeOrigin& codeOrigin) {
+        // Inlined code is attributed to the line in the inlined function's own source.
+        CodeBlock* originCodeBlock = codeOrigin.inlineCallFrame() ? codeOrigin.inlineCallFrame()->baselineCodeBlock.get() : codeBlock;
+        if (originCodeBlock != lastCodeBlock) {
+            fileName = originCodeBlock->ownerExecutable()->sourceURL().utf8();
+            lastCodeBlock = originCodeBlock;
+        }
+        entries.append({ bitwise_cast<const uint8_t*>(startOfRange), originCodeBlock->lineNumberForBytecodeIndex(codeOrigin.bytecodeIndex()), fileName });
+        return IterationStatus::Continue;
+    });
+    linkBuffer.setPerfDebugInfo(WTFMove(entries));
+}
+#endif
+
 } // namespace JSC
 
 #endif // ENABLE(JIT)
@@ -40,6 +40,7 @@ class PCToOriginMap;
 }
 #endif
 
+class CodeBlock;
 class LinkBuffer;
 class PCToCodeOriginMapBuilder;
 
@@ -84,9 +85,17 @@ public:
 
     Optional<CodeOrigin> findPC(void* pc) const;
 
+#if OS(LINUX)
+    // Tells Linux perf which source line each range of the code in linkBuffer came from.
+    void recordDebugInfoForPerf(CodeBlock*, LinkBuffer&) const;
+#endif
+
     double memorySize();
 
 private:
+    template<typename Functor>
+    void forEachRange(const Functor&) const;
+
     size_t m_compressedPCBufferSize;
     size_t m_compressedCodeOriginsSize;
     uint8_t* m_compressedPCs;
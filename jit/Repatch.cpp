@@ -111,6 +111,20 @@ enum InlineCacheAction {
     AttemptToCache
 };
 
+static InlineCacheAction actionForFlattenedDictionary(VM& vm, Structure* structure)
+{
+    switch (vm.dictionaryFlatteningPolicy.observeFlattenedDictionary(structure)) {
+    case DictionaryFlatteningPolicy::Action::GiveUp:
+        return GiveUpOnCache;
+    case DictionaryFlatteningPolicy::Action::RetryLater:
+        return RetryCacheLater;
+    case DictionaryFlatteningPolicy::Action::Flatten:
+        return AttemptToCache;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return GiveUpOnCache;
+}
+
 static InlineCacheAction actionForCell(VM& vm, JSCell* cell)
 {
     Structure* structure = cell->structure(vm);
@@ -120,8 +134,11 @@ static InlineCacheAction actionForCell(VM& vm, JSCell* cell)
         return GiveUpOnCache;
 
     if (structure->isUncacheableDictionary()) {
-        if (structure->hasBeenFlattenedBefore())
-            return GiveUpOnCache;
+        if (structure->hasBeenFlattenedBefore()) {
+            InlineCacheAction action = actionForFlattenedDictionary(vm, structure);
+            if (action != AttemptToCache)
+                return action;
+        }
         // Flattening could have changed the offset, so return early for another try.
         asObject(cell)->flattenDictionaryObject(vm);
         return RetryCacheLater;
@@ -311,8 +328,13 @@ static InlineCacheAction tryCacheGetBy(JSGlobalObject* globalObject, CodeBlock*
                     return GiveUpOnCache;
 
                 if (structure->isDictionary()) {
-                    if (structure->hasBeenFlattenedBefore())
-                        return GiveUpOnCache;
+                    if (structure->hasBeenFlattenedBefore()) {
+                        if (!structure->isUncacheableDictionary())
+                            return GiveUpOnCache;
+                        InlineCacheAction action = actionForFlattenedDictionary(vm, structure);
+                        if (action != AttemptToCache)
+                            return action;
+                    }
                     structure->flattenDictionaryStructure(vm, jsCast<JSObject*>(baseCell));
                     return RetryCacheLater; // We may have changed property offsets.
                 }
@@ -1089,9 +1111,7 @@ static void linkSlowFor(VM& vm, CallLinkInfo& callLinkInfo, ThunkGenerator gener
 
 static void linkSlowFor(VM& vm, CallLinkInfo& callLinkInfo)
 {
-    MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunk = virtualThunkFor(vm, callLinkInfo);
-    linkSlowFor(vm, callLinkInfo, virtualThunk);
-    callLinkInfo.setSlowStub(GCAwareJITStubRoutine::create(virtualThunk, vm));
+    linkSlowFor(vm, callLinkInfo, virtualThunkFor(vm, callLinkInfo));
 }
 
 static JSCell* webAssemblyOwner(JSCell* callee)
@@ -1216,9 +1236,7 @@ static void linkVirtualFor(VM& vm, CallFrame* callFrame, CallLinkInfo& callLinkI
     dataLogLnIf(shouldDumpDisassemblyFor(callerCodeBlock),
         "Linking virtual call at ", FullCodeOrigin(callerCodeBlock, callerFrame->codeOrigin()));
 
-    MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunk = virtualThunkFor(vm, callLinkInfo);
-    revertCall(vm, callLinkInfo, virtualThunk);
-    callLinkInfo.setSlowStub(GCAwareJITStubRoutine::create(virtualThunk, vm));
+    revertCall(vm, callLinkInfo, virtualThunkFor(vm, callLinkInfo));
     callLinkInfo.setClearedByVirtual();
 }
 
@@ -27,6 +27,7 @@
 
 #include "CommonSlowPaths.h"
 #include "MacroAssemblerCodeRef.h"
+#include "ThunkGenerators.h"
 
 #if ENABLE(JIT)
 
@@ -48,6 +49,13 @@ public:
         if (m_jit->m_bytecodeOffset != std::numeric_limits<unsigned>::max())
             m_jit->sampleInstruction(&m_jit->m_codeBlock->instructions()[m_jit->m_bytecodeOffset], true);
 #endif
+#if USE(JSVALUE64) && !OS(WINDOWS) && !ENABLE(OPCODE_SAMPLING)
+        // slowPathCallThunkGenerator() does the rest of updateTopCallFrame(), the call and the exception check.
+        m_jit->store32(JIT::TrustedImm32(CallSiteIndex(m_jit->m_bytecodeIndex.offset()).bits()), JIT::tagFor(CallFrameSlot::argumentCountIncludingThis));
+        m_jit->move(JIT::TrustedImmPtr(m_pc), JIT::argumentGPR1);
+        m_jit->move(JIT::TrustedImmPtr(tagCFunction<OperationPtrTag>(m_slowPathFunction)), GPRInfo::nonArgGPR0);
+        return m_jit->emitNakedNearCall(m_jit->m_vm->getCTIStub(slowPathCallThunkGenerator).retaggedCode<NoPtrTag>());
+#else
         m_jit->updateTopCallFrame();
 #if CPU(X86_64) && OS(WINDOWS)
         m_jit->addPtr(MacroAssembler::TrustedImm32(-16), MacroAssembler::stackPointerRegister);
@@ -74,6 +82,7 @@ public:
         
         m_jit->exceptionCheck();
         return call;
+#endif
     }
 
 private:
@@ -79,6 +79,46 @@ MacroAssemblerCodeRef<JITThunkPtrTag> throwExceptionFromCallSlowPathGenerator(VM
     return FINALIZE_CODE(patchBuffer, JITThunkPtrTag, "Throw exception from call slow path thunk");
 }
 
+#if USE(JSVALUE64) && !OS(WINDOWS)
+// Baseline JIT slow path calls land here with the bytecode PC in argumentGPR1 and the slow path
+// function in nonArgGPR0. The caller has already stored its CallSiteIndex. Keeping the rest of the
+// sequence, including the exception check, out of line makes each call site about half as big.
+MacroAssemblerCodeRef<JITThunkPtrTag> slowPathCallThunkGenerator(VM& vm)
+{
+    CCallHelpers jit;
+
+    static_assert(GPRInfo::nonArgGPR0 != GPRInfo::argumentGPR0);
+    static_assert(GPRInfo::nonArgGPR0 != GPRInfo::argumentGPR1);
+    jit.storePtr(GPRInfo::callFrameRegister, &vm.topCallFrame);
+    jit.move(GPRInfo::callFrameRegister, GPRInfo::argumentGPR0);
+    jit.emitFunctionPrologue();
+    emitPointerValidation(jit, GPRInfo::nonArgGPR0, OperationPtrTag);
+    jit.call(GPRInfo::nonArgGPR0, OperationPtrTag);
+    jit.emitFunctionEpilogue();
+
+    // The slow path's two return values are still in returnValueGPR and returnValueGPR2.
+    // On ARM64E, ret() authenticates the return address that the prologue signed, so it must
+    // stay signed on this path.
+    CCallHelpers::Jump exception = jit.emitExceptionCheck(vm);
+    jit.ret();
+
+    exception.link(&jit);
+    // Like the exception handler of a baseline CodeBlock, except that we first drop our return address.
+    jit.untagReturnAddress();
+    jit.preserveReturnAddressAfterCall(GPRInfo::nonPreservedNonReturnGPR);
+    jit.copyCalleeSavesToEntryFrameCalleeSavesBuffer(vm.topEntryFrame);
+    jit.setupArguments<decltype(operationLookupExceptionHandler)>(CCallHelpers::TrustedImmPtr(&vm));
+    jit.prepareCallOperation(vm);
+    jit.move(CCallHelpers::TrustedImmPtr(tagCFunction<OperationPtrTag>(operationLookupExceptionHandler)), GPRInfo::nonArgGPR0);
+    emitPointerValidation(jit, GPRInfo::nonArgGPR0, OperationPtrTag);
+    jit.call(GPRInfo::nonArgGPR0, OperationPtrTag);
+    jit.jumpToExceptionHandler(vm);
+
+    LinkBuffer patchBuffer(jit, GLOBAL_THUNK_ID);
+    return FINALIZE_CODE(patchBuffer, JITThunkPtrTag, "Baseline slow path call thunk");
+}
+#endif
+
 static void slowPathFor(CCallHelpers& jit, VM& vm, Sprt_JITOperation_EGCli slowPathFunction)
 {
     jit.sanitizeStackInline(vm, GPRInfo::nonArgGPR0);
@@ -165,7 +205,7 @@ MacroAssemblerCodeRef<JITThunkPtrTag> linkPolymorphicCallThunkGenerator(VM& vm)
 // path virtual call so that we can enable fast tail calls for megamorphic
 // virtual calls by using the shuffler.
 // https://bugs.webkit.org/show_bug.cgi?id=148831
-MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM& vm, CallLinkInfo& callLinkInfo)
+static MacroAssemblerCodeRef<JITThunkPtrTag> virtualThunkFor(VM& vm, CallMode mode)
 {
     // The callee is in regT0 (for JSVALUE32_64, the tag is in regT1).
     // The return address is on the stack, or in the link register. We will hence
@@ -186,7 +226,7 @@ MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM& vm, CallLinkInfo
     // the DFG knows that the value is definitely a cell, or definitely a function.
     
 #if USE(JSVALUE64)
-    if (callLinkInfo.isTailCall()) {
+    if (mode == CallMode::Tail) {
         // Tail calls could have clobbered the GPRInfo::notCellMaskRegister because they
         // restore callee saved registers before getthing here. So, let's materialize
         // the NotCellMask in a temp register and use the temp instead.
@@ -207,7 +247,7 @@ MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM& vm, CallLinkInfo
     jit.loadPtr(
         CCallHelpers::Address(
             GPRInfo::regT4, ExecutableBase::offsetOfJITCodeWithArityCheckFor(
-                callLinkInfo.specializationKind())),
+                specializationKindFor(mode))),
         GPRInfo::regT4);
     slowCase.append(jit.branchTestPtr(CCallHelpers::Zero, GPRInfo::regT4));
     
@@ -217,7 +257,7 @@ MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM& vm, CallLinkInfo
     // Make a tail call. This will return back to JIT code.
     JSInterfaceJIT::Label callCode(jit.label());
     emitPointerValidation(jit, GPRInfo::regT4, JSEntryPtrTag);
-    if (callLinkInfo.isTailCall()) {
+    if (mode == CallMode::Tail) {
         jit.preserveReturnAddressAfterCall(GPRInfo::regT0);
         jit.prepareForTailCallSlow(GPRInfo::regT4);
     }
@@ -226,7 +266,7 @@ MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM& vm, CallLinkInfo
     // NullSetterFunctionType does not get the fast path support. But it is OK since using NullSetterFunctionType is extremely rare.
     notJSFunction.link(&jit);
     slowCase.append(jit.branchIfNotType(GPRInfo::regT0, InternalFunctionType));
-    void* executableAddress = vm.getCTIInternalFunctionTrampolineFor(callLinkInfo.specializationKind()).executableAddress();
+    void* executableAddress = vm.getCTIInternalFunctionTrampolineFor(specializationKindFor(mode)).executableAddress();
     jit.move(CCallHelpers::TrustedImmPtr(executableAddress), GPRInfo::regT4);
     jit.jump().linkTo(callCode, &jit);
 
@@ -237,9 +277,42 @@ MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM& vm, CallLinkInfo
 
     LinkBuffer patchBuffer(jit, GLOBAL_THUNK_ID);
     return FINALIZE_CODE(
-        patchBuffer, JITStubRoutinePtrTag,
+        patchBuffer, JITThunkPtrTag,
         "Virtual %s slow path thunk",
-        callLinkInfo.callMode() == CallMode::Regular ? "call" : callLinkInfo.callMode() == CallMode::Tail ? "tail call" : "construct");
+        mode == CallMode::Regular ? "call" : mode == CallMode::Tail ? "tail call" : "construct");
+}
+
+MacroAssemblerCodeRef<JITThunkPtrTag> virtualCallThunkGenerator(VM& vm)
+{
+    return virtualThunkFor(vm, CallMode::Regular);
+}
+
+MacroAssemblerCodeRef<JITThunkPtrTag> virtualTailCallThunkGenerator(VM& vm)
+{
+    return virtualThunkFor(vm, CallMode::Tail);
+}
+
+MacroAssemblerCodeRef<JITThunkPtrTag> virtualConstructThunkGenerator(VM& vm)
+{
+    return virtualThunkFor(vm, CallMode::Construct);
+}
+
+// The virtual thunk only depends on the call mode. The CallLinkInfo is passed in regT2 at run time,
+// so every megamorphic call site of a given mode can share one thunk instead of getting its own copy.
+MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM& vm, CallLinkInfo& callLinkInfo)
+{
+    ThunkGenerator generator = virtualCallThunkGenerator;
+    switch (callLinkInfo.callMode()) {
+    case CallMode::Regular:
+        break;
+    case CallMode::Tail:
+        generator = virtualTailCallThunkGenerator;
+        break;
+    case CallMode::Construct:
+        generator = virtualConstructThunkGenerator;
+        break;
+    }
+    return vm.getCTIStub(generator).retagged<JITStubRoutinePtrTag>();
 }
 
 enum ThunkEntryType { EnterViaCall, EnterViaJumpWithSavedTags, EnterViaJumpWithoutSavedTags };
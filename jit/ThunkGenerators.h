@@ -36,10 +36,16 @@ template<PtrTag> class MacroAssemblerCodeRef;
 class VM;
 
 MacroAssemblerCodeRef<JITThunkPtrTag> throwExceptionFromCallSlowPathGenerator(VM&);
+#if USE(JSVALUE64) && !OS(WINDOWS)
+MacroAssemblerCodeRef<JITThunkPtrTag> slowPathCallThunkGenerator(VM&);
+#endif
 
 MacroAssemblerCodeRef<JITThunkPtrTag> linkCallThunkGenerator(VM&);
 MacroAssemblerCodeRef<JITThunkPtrTag> linkPolymorphicCallThunkGenerator(VM&);
 
+MacroAssemblerCodeRef<JITThunkPtrTag> virtualCallThunkGenerator(VM&);
+MacroAssemblerCodeRef<JITThunkPtrTag> virtualTailCallThunkGenerator(VM&);
+MacroAssemblerCodeRef<JITThunkPtrTag> virtualConstructThunkGenerator(VM&);
 MacroAssemblerCodeRef<JITStubRoutinePtrTag> virtualThunkFor(VM&, CallLinkInfo&);
 
 MacroAssemblerCodeRef<JITThunkPtrTag> nativeCallGenerator(VM&);
@@ -23,10 +23,13 @@
 #include "config.h"
 
 #include "ArrayBuffer.h"
+#include "ArrayBufferPool.h"
 #include "BigIntConstructor.h"
 #include "BytecodeCacheError.h"
+#include "BytecodeCacheWriter.h"
 #include "CatchScope.h"
 #include "CodeBlock.h"
+#include "CodeBlockSet.h"
 #include "CodeCache.h"
 #include "CompilerTimingScope.h"
 #include "Completion.h"
@@ -167,6 +170,7 @@ namespace {
 NO_RETURN_WITH_VALUE static void jscExit(int status)
 {
     waitForAsynchronousDisassembly();
+    waitForAsynchronousBytecodeCacheWrites();
     
 #if ENABLE(DFG_JIT)
     if (DFG::isCrashing()) {
@@ -324,12 +328,15 @@ static JSC_DECLARE_HOST_FUNCTION(functionIs32BitPlatform);
 static JSC_DECLARE_HOST_FUNCTION(functionCheckModuleSyntax);
 static JSC_DECLARE_HOST_FUNCTION(functionPlatformSupportsSamplingProfiler);
 static JSC_DECLARE_HOST_FUNCTION(functionGenerateHeapSnapshot);
+static JSC_DECLARE_HOST_FUNCTION(functionGenerateHeapSnapshotDelta);
 static JSC_DECLARE_HOST_FUNCTION(functionGenerateHeapSnapshotForGCDebugging);
+static JSC_DECLARE_HOST_FUNCTION(functionWriteHeapSnapshotToFile);
 static JSC_DECLARE_HOST_FUNCTION(functionResetSuperSamplerState);
 static JSC_DECLARE_HOST_FUNCTION(functionEnsureArrayStorage);
 #if ENABLE(SAMPLING_PROFILER)
 static JSC_DECLARE_HOST_FUNCTION(functionStartSamplingProfiler);
 static JSC_DECLARE_HOST_FUNCTION(functionSamplingProfilerStackTraces);
+static JSC_DECLARE_HOST_FUNCTION(functionSamplingProfilerDrainCallTree);
 #endif
 
 static JSC_DECLARE_HOST_FUNCTION(functionMaxArguments);
@@ -365,6 +372,13 @@ static JSC_DECLARE_HOST_FUNCTION(functionFlashHeapAccess);
 static JSC_DECLARE_HOST_FUNCTION(functionDisableRichSourceInfo);
 static JSC_DECLARE_HOST_FUNCTION(functionMallocInALoop);
 static JSC_DECLARE_HOST_FUNCTION(functionTotalCompileTime);
+static JSC_DECLARE_HOST_FUNCTION(functionTierUpStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionCodeCacheStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionCodeMemoryStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionStringDeduplicationStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionBlockMemoryStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionArrayBufferPoolStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionRunWarmupBenchmark);
 
 static JSC_DECLARE_HOST_FUNCTION(functionSetUnhandledRejectionCallback);
 static JSC_DECLARE_HOST_FUNCTION(functionAsDoubleNumber);
@@ -593,12 +607,15 @@ private:
 
         addFunction(vm, "platformSupportsSamplingProfiler", functionPlatformSupportsSamplingProfiler, 0);
         addFunction(vm, "generateHeapSnapshot", functionGenerateHeapSnapshot, 0);
+        addFunction(vm, "generateHeapSnapshotDelta", functionGenerateHeapSnapshotDelta, 0);
         addFunction(vm, "generateHeapSnapshotForGCDebugging", functionGenerateHeapSnapshotForGCDebugging, 0);
+        addFunction(vm, "writeHeapSnapshotToFile", functionWriteHeapSnapshotToFile, 2);
         addFunction(vm, "resetSuperSamplerState", functionResetSuperSamplerState, 0);
         addFunction(vm, "ensureArrayStorage", functionEnsureArrayStorage, 0);
 #if ENABLE(SAMPLING_PROFILER)
         addFunction(vm, "startSamplingProfiler", functionStartSamplingProfiler, 0);
         addFunction(vm, "samplingProfilerStackTraces", functionSamplingProfilerStackTraces, 0);
+        addFunction(vm, "samplingProfilerDrainCallTree", functionSamplingProfilerDrainCallTree, 0);
 #endif
 
         addFunction(vm, "maxArguments", functionMaxArguments, 0);
@@ -657,6 +674,13 @@ private:
         addFunction(vm, "disableRichSourceInfo", functionDisableRichSourceInfo, 0);
         addFunction(vm, "mallocInALoop", functionMallocInALoop, 0);
         addFunction(vm, "totalCompileTime", functionTotalCompileTime, 0);
+        addFunction(vm, "tierUpStatistics", functionTierUpStatistics, 0);
+        addFunction(vm, "codeCacheStatistics", functionCodeCacheStatistics, 0);
+        addFunction(vm, "codeMemoryStatistics", functionCodeMemoryStatistics, 0);
+        addFunction(vm, "stringDeduplicationStatistics", functionStringDeduplicationStatistics, 0);
+        addFunction(vm, "blockMemoryStatistics", functionBlockMemoryStatistics, 0);
+        addFunction(vm, "arrayBufferPoolStatistics", functionArrayBufferPoolStatistics, 0);
+        addFunction(vm, "runWarmupBenchmark", functionRunWarmupBenchmark, 3);
 
         addFunction(vm, "setUnhandledRejectionCallback", functionSetUnhandledRejectionCallback, 1);
 
@@ -1064,15 +1088,15 @@ public:
             return;
         }
 
-        if (!FileSystem::truncateFile(fd, m_cachedBytecode->sizeForUpdate()))
-            return;
-
-        m_cachedBytecode->commitUpdates([&] (off_t offset, const void* data, size_t size) {
-            long long result = FileSystem::seekFile(fd, offset, FileSystem::FileSeekOrigin::Beginning);
-            ASSERT_UNUSED(result, result != -1);
-            size_t bytesWritten = static_cast<size_t>(FileSystem::writeToFile(fd, static_cast<const char*>(data), size));
-            ASSERT_UNUSED(bytesWritten, bytesWritten == size);
-        });
+        // Replace the file rather than patching it in place, so that another process mapping the
+        // cache never sees a half-written update.
+        Vector<uint8_t> contents = m_cachedBytecode->contentsWithUpdates();
+        if (Options::useAsynchronousBytecodeCacheWrites()) {
+            // The writer thread keeps the file locked until the new cache has been renamed into place.
+            closeFD.release();
+            writeBytecodeCacheFileAsynchronously(filename, WTFMove(contents), fd);
+        } else
+            writeBytecodeCacheFile(filename, contents);
     }
 
 private:
@@ -2199,6 +2223,203 @@ JSC_DEFINE_HOST_FUNCTION(functionTotalCompileTime, (JSGlobalObject*, CallFrame*)
 #endif
 }
 
+static double totalCompileTimeInMilliseconds()
+{
+#if ENABLE(JIT)
+    return JIT::totalCompileTime().milliseconds();
+#else
+    return 0;
+#endif
+}
+
+static JSObject* createTierUpStatisticsObject(VM& vm, JSGlobalObject* globalObject)
+{
+    TierUpSnapshot snapshot = takeTierUpSnapshot(vm);
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "llint"), jsNumber(snapshot.llintCodeBlocks));
+    result->putDirect(vm, Identifier::fromString(vm, "baseline"), jsNumber(snapshot.baselineCodeBlocks));
+    result->putDirect(vm, Identifier::fromString(vm, "dfg"), jsNumber(snapshot.dfgCodeBlocks));
+    result->putDirect(vm, Identifier::fromString(vm, "ftl"), jsNumber(snapshot.ftlCodeBlocks));
+    result->putDirect(vm, Identifier::fromString(vm, "baselineQueueLength"), jsNumber(snapshot.baselineQueueLength));
+    result->putDirect(vm, Identifier::fromString(vm, "dfgQueueLength"), jsNumber(snapshot.dfgQueueLength));
+    result->putDirect(vm, Identifier::fromString(vm, "ftlQueueLength"), jsNumber(snapshot.ftlQueueLength));
+    result->putDirect(vm, Identifier::fromString(vm, "osrExits"), jsNumber(snapshot.osrExits));
+    result->putDirect(vm, Identifier::fromString(vm, "compileTimeMs"), jsNumber(totalCompileTimeInMilliseconds()));
+    return result;
+}
+
+// Usage: tierUpStatistics()
+// Returns the number of live CodeBlocks in each tier, the depth of each compiler
+// queue, and the OSR exits taken by live optimized code.
+JSC_DEFINE_HOST_FUNCTION(functionTierUpStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    return JSValue::encode(createTierUpStatisticsObject(vm, globalObject));
+}
+
+static JSObject* createLookupCountsObject(VM& vm, JSGlobalObject* globalObject, const CodeCache::LookupCounts& counts)
+{
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "hits"), jsNumber(counts.hits));
+    result->putDirect(vm, Identifier::fromString(vm, "misses"), jsNumber(counts.misses));
+    return result;
+}
+
+// Usage: codeCacheStatistics()
+// Returns cache hits and misses for each way source reaches the compiler: programs, modules,
+// indirect eval, the Function constructor and direct eval.
+JSC_DEFINE_HOST_FUNCTION(functionCodeCacheStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    const CodeCache::PathStatistics& statistics = vm.codeCache()->pathStatistics();
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "program"), createLookupCountsObject(vm, globalObject, statistics.program));
+    result->putDirect(vm, Identifier::fromString(vm, "module"), createLookupCountsObject(vm, globalObject, statistics.module));
+    result->putDirect(vm, Identifier::fromString(vm, "indirectEval"), createLookupCountsObject(vm, globalObject, statistics.indirectEval));
+    result->putDirect(vm, Identifier::fromString(vm, "functionConstructor"), createLookupCountsObject(vm, globalObject, statistics.functionConstructor));
+    result->putDirect(vm, Identifier::fromString(vm, "directEval"), createLookupCountsObject(vm, globalObject, statistics.directEval));
+    return JSValue::encode(result);
+}
+
+static JSObject* createTierStatisticsObject(VM& vm, JSGlobalObject* globalObject, const CodeBlockSet::TierStatistics& tier)
+{
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "codeBlocks"), jsNumber(tier.codeBlocks));
+    result->putDirect(vm, Identifier::fromString(vm, "machineCodeBytes"), jsNumber(tier.machineCodeBytes));
+    result->putDirect(vm, Identifier::fromString(vm, "bytecodeBytes"), jsNumber(tier.bytecodeBytes));
+    return result;
+}
+
+// Usage: codeMemoryStatistics()
+// Returns the live CodeBlocks, machine code bytes and bytecode bytes of each tier, along with
+// how many CodeBlocks (and bytes) the last full GC found cold under --codeMemoryBudget.
+JSC_DEFINE_HOST_FUNCTION(functionCodeMemoryStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    CodeBlockSet::CodeMemoryStatistics statistics = vm.heap.codeBlockSet().codeMemoryStatistics();
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "llint"), createTierStatisticsObject(vm, globalObject, statistics.llint));
+    result->putDirect(vm, Identifier::fromString(vm, "baseline"), createTierStatisticsObject(vm, globalObject, statistics.baseline));
+    result->putDirect(vm, Identifier::fromString(vm, "dfg"), createTierStatisticsObject(vm, globalObject, statistics.dfg));
+    result->putDirect(vm, Identifier::fromString(vm, "ftl"), createTierStatisticsObject(vm, globalObject, statistics.ftl));
+    result->putDirect(vm, Identifier::fromString(vm, "budget"), jsNumber(Options::codeMemoryBudget()));
+    result->putDirect(vm, Identifier::fromString(vm, "coldCodeBlocks"), jsNumber(statistics.coldCodeBlocks));
+    result->putDirect(vm, Identifier::fromString(vm, "coldMachineCodeBytes"), jsNumber(statistics.coldMachineCodeBytes));
+    return JSValue::encode(result);
+}
+
+// Usage: stringDeduplicationStatistics()
+// Returns how many JSStrings --useStringDeduplication has pointed at an equal string, and the
+// string bytes that freed, since the VM started.
+JSC_DEFINE_HOST_FUNCTION(functionStringDeduplicationStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "strings"), jsNumber(vm.heap.stringsDeduplicated()));
+    result->putDirect(vm, Identifier::fromString(vm, "bytesReclaimed"), jsNumber(vm.heap.stringBytesDeduplicated()));
+    return JSValue::encode(result);
+}
+
+// Usage: blockMemoryStatistics()
+// Returns the committed and reserved bytes of the object heap, the bytes held in empty blocks, and
+// the bytes of empty blocks freed so far.
+JSC_DEFINE_HOST_FUNCTION(functionBlockMemoryStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    MarkedSpace::BlockMemoryStatistics statistics = vm.heap.objectSpace().blockMemoryStatistics();
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "committedBytes"), jsNumber(statistics.committedBytes));
+    result->putDirect(vm, Identifier::fromString(vm, "reservedBytes"), jsNumber(statistics.committedBytes + statistics.decommittedBytes));
+    result->putDirect(vm, Identifier::fromString(vm, "emptyBlockBytes"), jsNumber(statistics.emptyBlockBytes));
+    result->putDirect(vm, Identifier::fromString(vm, "emptyBlockBytesReleased"), jsNumber(statistics.emptyBlockBytesReleased));
+    return JSValue::encode(result);
+}
+
+// Usage: arrayBufferPoolStatistics()
+// Returns how many --useArrayBufferPool allocations reused pooled memory, how many needed fresh
+// memory, and how many bytes the pool holds right now.
+JSC_DEFINE_HOST_FUNCTION(functionArrayBufferPoolStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    ArrayBufferPool::Statistics statistics = ArrayBufferPool::singleton().statistics();
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "reusedAllocations"), jsNumber(statistics.reusedAllocations));
+    result->putDirect(vm, Identifier::fromString(vm, "freshAllocations"), jsNumber(statistics.freshAllocations));
+    result->putDirect(vm, Identifier::fromString(vm, "pooledBytes"), jsNumber(statistics.pooledBytes));
+    return JSValue::encode(result);
+}
+
+// Usage: runWarmupBenchmark(workload, [durationMs = 1000], [intervalMs = 100])
+// Calls workload back to back for durationMs of wall-clock time and returns one sample
+// per interval, holding the iterations per second achieved during that interval along
+// with tierUpStatistics() at its end. Running the same workload twice with
+// --diskCachePath=<dir> compares a cold bytecode cache against a warm one.
+JSC_DEFINE_HOST_FUNCTION(functionRunWarmupBenchmark, (JSGlobalObject* globalObject, CallFrame* callFrame))
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue workload = callFrame->argument(0);
+    auto callData = getCallData(vm, workload);
+    if (callData.type == CallData::Type::None)
+        return JSValue::encode(throwTypeError(globalObject, scope, "Expected a workload function"_s));
+
+    double durationMs = 1000;
+    if (!callFrame->argument(1).isUndefined()) {
+        durationMs = callFrame->argument(1).toNumber(globalObject);
+        RETURN_IF_EXCEPTION(scope, encodedJSValue());
+    }
+    double intervalMs = 100;
+    if (!callFrame->argument(2).isUndefined()) {
+        intervalMs = callFrame->argument(2).toNumber(globalObject);
+        RETURN_IF_EXCEPTION(scope, encodedJSValue());
+    }
+    if (!(durationMs > 0) || !(intervalMs > 0))
+        return JSValue::encode(throwRangeError(globalObject, scope, "Expected a positive duration and interval"_s));
+
+    JSArray* samples = constructEmptyArray(globalObject, nullptr);
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
+
+    MarkedArgumentBuffer args;
+    Seconds duration = Seconds::fromMilliseconds(durationMs);
+    Seconds interval = Seconds::fromMilliseconds(intervalMs);
+    MonotonicTime start = MonotonicTime::now();
+    MonotonicTime intervalStart = start;
+    uint64_t iterationsInInterval = 0;
+    uint64_t totalIterations = 0;
+    unsigned index = 0;
+    for (;;) {
+        call(globalObject, workload, callData, jsUndefined(), args);
+        RETURN_IF_EXCEPTION(scope, encodedJSValue());
+        iterationsInInterval++;
+        totalIterations++;
+
+        MonotonicTime now = MonotonicTime::now();
+        Seconds elapsedInInterval = now - intervalStart;
+        bool finished = now - start >= duration;
+        if (elapsedInInterval < interval && !finished)
+            continue;
+
+        JSObject* sample = createTierUpStatisticsObject(vm, globalObject);
+        sample->putDirect(vm, Identifier::fromString(vm, "time"), jsNumber((now - start).milliseconds()));
+        sample->putDirect(vm, Identifier::fromString(vm, "iterations"), jsNumber(iterationsInInterval));
+        sample->putDirect(vm, Identifier::fromString(vm, "totalIterations"), jsNumber(totalIterations));
+        sample->putDirect(vm, Identifier::fromString(vm, "throughput"), jsNumber(iterationsInInterval / elapsedInInterval.seconds()));
+        samples->putDirectIndex(globalObject, index++, sample);
+        RETURN_IF_EXCEPTION(scope, encodedJSValue());
+
+        if (finished)
+            break;
+        intervalStart = now;
+        iterationsInInterval = 0;
+    }
+
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "bytecodeCache"), jsBoolean(!!Options::diskCachePath()));
+    result->putDirect(vm, Identifier::fromString(vm, "samples"), samples);
+    return JSValue::encode(result);
+}
+
 template<typename ValueType>
 typename std::enable_if<!std::is_fundamental<ValueType>::value>::type addOption(VM&, JSObject*, const Identifier&, ValueType) { }
 
@@ -2538,6 +2759,21 @@ JSC_DEFINE_HOST_FUNCTION(functionGenerateHeapSnapshot, (JSGlobalObject* globalOb
     return result;
 }
 
+JSC_DEFINE_HOST_FUNCTION(functionGenerateHeapSnapshotDelta, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    JSLockHolder lock(vm);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    HeapSnapshotBuilder snapshotBuilder(vm.ensureHeapProfiler());
+    snapshotBuilder.buildDeltaSnapshot();
+
+    String jsonString = snapshotBuilder.json();
+    EncodedJSValue result = JSValue::encode(JSONParse(globalObject, jsonString));
+    scope.releaseAssertNoException();
+    return result;
+}
+
 JSC_DEFINE_HOST_FUNCTION(functionGenerateHeapSnapshotForGCDebugging, (JSGlobalObject* globalObject, CallFrame*))
 {
     VM& vm = globalObject->vm();
@@ -2556,6 +2792,39 @@ JSC_DEFINE_HOST_FUNCTION(functionGenerateHeapSnapshotForGCDebugging, (JSGlobalOb
     return JSValue::encode(jsString(vm, jsonString));
 }
 
+JSC_DEFINE_HOST_FUNCTION(functionWriteHeapSnapshotToFile, (JSGlobalObject* globalObject, CallFrame* callFrame))
+{
+    VM& vm = globalObject->vm();
+    JSLockHolder lock(vm);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    String fileName = callFrame->argument(0).toWTFString(globalObject);
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
+    bool useBase64Edges = callFrame->argument(1).toBoolean(globalObject);
+
+    auto fd = FileSystem::openFile(fileName, FileSystem::FileOpenMode::Write);
+    if (!FileSystem::isHandleValid(fd))
+        return JSValue::encode(throwException(globalObject, scope, createError(globalObject, "Could not open file."_s)));
+    auto closeFD = makeScopeExit([&] {
+        FileSystem::closeFile(fd);
+    });
+
+    HeapSnapshotBuilder snapshotBuilder(vm.ensureHeapProfiler());
+    snapshotBuilder.buildSnapshot();
+
+    bool succeeded = true;
+    auto edgeEncoding = useBase64Edges ? HeapSnapshotBuilder::EdgeEncoding::Base64 : HeapSnapshotBuilder::EdgeEncoding::JSON;
+    snapshotBuilder.writeJSON([&] (String&& chunk) {
+        CString utf8 = chunk.utf8();
+        if (FileSystem::writeToFile(fd, utf8.data(), utf8.length()) != static_cast<int>(utf8.length()))
+            succeeded = false;
+    }, [] (const HeapSnapshotNode&) { return true; }, HeapSnapshotBuilder::defaultChunkSize, edgeEncoding);
+
+    if (!succeeded)
+        return JSValue::encode(throwException(globalObject, scope, createError(globalObject, "Could not write heap snapshot."_s)));
+    return JSValue::encode(jsUndefined());
+}
+
 JSC_DEFINE_HOST_FUNCTION(functionResetSuperSamplerState, (JSGlobalObject*, CallFrame*))
 {
     resetSuperSamplerState();
@@ -2595,6 +2864,20 @@ JSC_DEFINE_HOST_FUNCTION(functionSamplingProfilerStackTraces, (JSGlobalObject* g
     scope.releaseAssertNoException();
     return result;
 }
+
+JSC_DEFINE_HOST_FUNCTION(functionSamplingProfilerDrainCallTree, (JSGlobalObject* globalObject, CallFrame*))
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    if (!vm.samplingProfiler())
+        return JSValue::encode(throwException(globalObject, scope, createError(globalObject, "Sampling profiler was never started"_s)));
+
+    String jsonString = vm.samplingProfiler()->drainCallTreeAsPprofJSON();
+    EncodedJSValue result = JSValue::encode(JSONParse(globalObject, jsonString));
+    scope.releaseAssertNoException();
+    return result;
+}
 #endif // ENABLE(SAMPLING_PROFILER)
 
 JSC_DEFINE_HOST_FUNCTION(functionMaxArguments, (JSGlobalObject*, CallFrame*))
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "PropertyOffset.h"
+#include "StructureIDTable.h"
+#include <array>
+
+#if USE(JSVALUE64)
+
+namespace JSC {
+
+class LLIntOffsetsExtractor;
+
+struct LLIntPolymorphicGetByIdCacheEntry {
+    StructureID structureID;
+    PropertyOffset offset;
+    const void* site;
+};
+static_assert(sizeof(LLIntPolymorphicGetByIdCacheEntry) == 16, "LowLevelInterpreter64.asm scales the probe index by 16");
+
+// The LLInt get_by_id metadata caches a single structure. Self accesses seen at sites that keep
+// switching structures are also recorded here, keyed by structure and by the address of the site's
+// GetByIdModeMetadata, so the LLInt can probe them without calling out or generating stubs. Both keys
+// can be reused once a GC frees their owners, so the whole cache is dropped at the end of every GC.
+class LLIntPolymorphicGetByIdCache {
+public:
+    static constexpr unsigned capacity = 1024;
+    static constexpr unsigned mask = capacity - 1;
+
+    LLIntPolymorphicGetByIdCache()
+    {
+        clear();
+    }
+
+    // Keep in sync with the probe in LowLevelInterpreter64.asm.
+    static unsigned index(StructureID structureID, const void* site)
+    {
+        return (static_cast<unsigned>(bitwise_cast<uintptr_t>(site) >> 4) ^ structureID) & mask;
+    }
+
+    void add(StructureID structureID, PropertyOffset offset, const void* site)
+    {
+        m_entries[index(structureID, site)] = { structureID, offset, site };
+    }
+
+    void clear()
+    {
+        m_entries.fill({ 0, invalidOffset, nullptr });
+    }
+
+private:
+    friend class LLIntOffsetsExtractor;
+
+    std::array<LLIntPolymorphicGetByIdCacheEntry, capacity> m_entries;
+};
+
+} // namespace JSC
+
+#endif // USE(JSVALUE64)
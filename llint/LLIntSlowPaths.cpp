@@ -56,6 +56,7 @@
 #include "LLIntExceptions.h"
 #include "LLIntPrototypeLoadAdaptiveStructureWatchpoint.h"
 #include "LLIntThunks.h"
+#include "MegamorphicCache.h"
 #include "ObjectConstructor.h"
 #include "ObjectPropertyConditionSet.h"
 #include "ProtoCallFrameInlines.h"
@@ -756,7 +757,12 @@ static JSValue performLLIntGetByID(const Instruction* pc, CodeBlock* codeBlock,
     auto throwScope = DECLARE_THROW_SCOPE(vm);
     PropertySlot slot(baseValue, PropertySlot::PropertySlot::InternalMethodType::Get);
 
-    JSValue result = baseValue.get(globalObject, ident, slot);
+    // The monomorphic cache holds a different structure, so this site has seen several of them.
+    StructureID previousStructureID = metadata.mode == GetByIdMode::Default ? metadata.defaultMode.structureID : 0;
+    PropertyOffset previousOffset = metadata.defaultMode.cachedOffset;
+    bool isPolymorphic = previousStructureID && baseValue.isCell() && baseValue.asCell()->structureID() != previousStructureID;
+
+    JSValue result = isPolymorphic ? getWithMegamorphicCache(globalObject, vm, baseValue, ident, slot) : baseValue.get(globalObject, ident, slot);
     RETURN_IF_EXCEPTION(throwScope, { });
 
     if (!LLINT_ALWAYS_ACCESS_SLOW
@@ -803,6 +809,14 @@ static JSValue performLLIntGetByID(const Instruction* pc, CodeBlock* codeBlock,
                 metadata.defaultMode.structureID = structure->id();
                 metadata.defaultMode.cachedOffset = slot.cachedOffset();
                 vm.heap.writeBarrier(codeBlock);
+#if USE(JSVALUE64)
+                // Dictionary structures can change their layout in place, so only record other structures.
+                if (isPolymorphic && Options::useLLIntPolymorphicGetByIdCache() && !structure->isDictionary()) {
+                    vm.llintPolymorphicGetByIdCache.add(structure->id(), slot.cachedOffset(), &metadata);
+                    if (!vm.heap.structureIDTable().get(previousStructureID)->isDictionary())
+                        vm.llintPolymorphicGetByIdCache.add(previousStructureID, previousOffset, &metadata);
+                }
+#endif
             }
         } else if (UNLIKELY(metadata.hitCountForLLIntCaching && slot.isValue())) {
             ASSERT(slot.slotBase() != baseValue);
@@ -903,6 +917,8 @@ LLINT_SLOW_PATH_DECL(slow_path_put_by_id)
     Structure* oldStructure = baseValue.isCell() ? baseValue.asCell()->structure(vm) : nullptr;
     if (bytecode.m_flags.isDirect())
         CommonSlowPaths::putDirectWithReify(vm, globalObject, asObject(baseValue), ident, getOperand(callFrame, bytecode.m_value), slot);
+    else if (oldStructure && metadata.m_oldStructureID && metadata.m_oldStructureID != oldStructure->id())
+        putWithMegamorphicCache(globalObject, vm, baseValue, ident, getOperand(callFrame, bytecode.m_value), slot);
     else
         baseValue.putInline(globalObject, ident, getOperand(callFrame, bytecode.m_value), slot);
     LLINT_CHECK_EXCEPTION();
@@ -1418,18 +1434,28 @@ LLINT_SLOW_PATH_DECL(slow_path_put_setter_by_val)
     LLINT_END();
 }
 
+template<typename Metadata>
+static ALWAYS_INLINE bool profileBranch(Metadata& metadata, bool taken)
+{
+    if (taken)
+        metadata.m_takenCount++;
+    else
+        metadata.m_notTakenCount++;
+    return taken;
+}
+
 LLINT_SLOW_PATH_DECL(slow_path_jtrue)
 {
     LLINT_BEGIN();
     auto bytecode = pc->as<OpJtrue>();
-    LLINT_BRANCH(getOperand(callFrame, bytecode.m_condition).toBoolean(globalObject));
+    LLINT_BRANCH(profileBranch(bytecode.metadata(codeBlock), getOperand(callFrame, bytecode.m_condition).toBoolean(globalObject)));
 }
 
 LLINT_SLOW_PATH_DECL(slow_path_jfalse)
 {
     LLINT_BEGIN();
     auto bytecode = pc->as<OpJfalse>();
-    LLINT_BRANCH(!getOperand(callFrame, bytecode.m_condition).toBoolean(globalObject));
+    LLINT_BRANCH(profileBranch(bytecode.metadata(codeBlock), !getOperand(callFrame, bytecode.m_condition).toBoolean(globalObject)));
 }
 
 LLINT_SLOW_PATH_DECL(slow_path_jless)
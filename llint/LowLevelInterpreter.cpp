@@ -442,7 +442,15 @@ JSValue CLoop::execute(OpcodeID entryOpcodeID, void* executableAddress, VM* vm,
 
 #if !ENABLE(COMPUTED_GOTO_OPCODES)
     default:
-        ASSERT(false);
+        // Every opcode we dispatch to has a case above. Telling the compiler so lets it drop the
+        // range check from the jump table that every single dispatch goes through. A release assert
+        // here would keep that check, so debug builds assert and release builds only get the hint.
+        ASSERT_NOT_REACHED();
+#if COMPILER(MSVC)
+        __assume(0);
+#else
+        __builtin_unreachable();
+#endif
 #endif
 
     } // END bytecode handler cases.
@@ -1868,14 +1868,19 @@ putByValOp(put_by_val_direct, OpPutByValDirect, macro (a, b) end)
 
 
 macro llintJumpTrueOrFalseOp(opcodeName, opcodeStruct, conditionOp, notUsed)
-    llintOpWithJump(op_%opcodeName%, opcodeStruct, macro (size, get, jump, dispatch)
+    llintOpWithMetadata(op_%opcodeName%, opcodeStruct, macro (size, get, dispatch, metadata, return)
         get(m_condition, t1)
         loadConstantOrVariablePayload(size, t1, BooleanTag, t0, .slow)
         conditionOp(t0, .target)
+        metadata(t5, t0)
+        addi 1, %opcodeStruct%::Metadata::m_notTakenCount[t5]
         dispatch()
 
     .target:
-        jump(m_targetLabel)
+        metadata(t5, t0)
+        addi 1, %opcodeStruct%::Metadata::m_takenCount[t5]
+        get(m_targetLabel, t0)
+        jumpImpl(dispatchIndirect, t0)
 
     .slow:
         callSlowPath(_llint_slow_path_%opcodeName%)
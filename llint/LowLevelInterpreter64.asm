@@ -1538,7 +1538,32 @@ end
 llintOpWithMetadata(op_get_by_id, OpGetById, macro (size, get, dispatch, metadata, return)
     get(m_base, t0)
     loadConstantOrVariableCell(size, t0, t3, .opGetByIdSlow)
-    performGetByIDHelper(OpGetById, m_modeMetadata, m_profile, .opGetByIdSlow, size, metadata, return)
+    performGetByIDHelper(OpGetById, m_modeMetadata, m_profile, .opGetByIdPolymorphic, size, metadata, return)
+
+.opGetByIdPolymorphic:
+    # The metadata cache missed. See if this site recorded a self access for the base's structure in the
+    # VM's LLIntPolymorphicGetByIdCache. The probe index must match LLIntPolymorphicGetByIdCache::index().
+    get(m_base, t0)
+    loadConstantOrVariableCell(size, t0, t3, .opGetByIdSlow)
+    metadata(t2, t1)
+    loadi JSCell::m_structureID[t3], t1
+    leap OpGetById::Metadata::m_modeMetadata[t2], t5
+    urshiftp 4, t5
+    xori t1, t5
+    andi constexpr LLIntPolymorphicGetByIdCache::mask, t5
+    lshifti 4, t5
+    loadp CodeBlock[cfr], t0
+    loadp CodeBlock::m_vm[t0], t0
+    addp t5, t0
+    loadi VM::llintPolymorphicGetByIdCache + LLIntPolymorphicGetByIdCache::m_entries + LLIntPolymorphicGetByIdCacheEntry::structureID[t0], t5
+    bineq t5, t1, .opGetByIdSlow
+    loadp VM::llintPolymorphicGetByIdCache + LLIntPolymorphicGetByIdCache::m_entries + LLIntPolymorphicGetByIdCacheEntry::site[t0], t1
+    leap OpGetById::Metadata::m_modeMetadata[t2], t5
+    bpneq t1, t5, .opGetByIdSlow
+    loadis VM::llintPolymorphicGetByIdCache + LLIntPolymorphicGetByIdCache::m_entries + LLIntPolymorphicGetByIdCacheEntry::offset[t0], t1
+    loadPropertyAtVariableOffset(t1, t3, t0)
+    valueProfile(OpGetById, m_profile, t2, t0)
+    return(t0)
 
 .opGetByIdSlow:
     callSlowPath(_llint_slow_path_get_by_id)
@@ -1919,21 +1944,30 @@ putByValOp(put_by_val_direct, OpPutByValDirect, macro (a, b) end)
 
 
 macro llintJumpTrueOrFalseOp(opcodeName, opcodeStruct, miscConditionOp, truthyCellConditionOp)
-    llintOpWithJump(op_%opcodeName%, opcodeStruct, macro (size, get, jump, dispatch)
+    llintOpWithMetadata(op_%opcodeName%, opcodeStruct, macro (size, get, dispatch, metadata, return)
+        macro notTaken()
+            metadata(t5, t0)
+            addi 1, %opcodeStruct%::Metadata::m_notTakenCount[t5]
+            dispatch()
+        end
+
         get(m_condition, t1)
         loadConstantOrVariable(size, t1, t0)
         btqnz t0, ~0xf, .maybeCell
         miscConditionOp(t0, .target)
-        dispatch()
+        notTaken()
 
     .maybeCell:
         btqnz t0, notCellMask, .slow
         bbbeq JSCell::m_type[t0], constexpr JSType::LastMaybeFalsyCellPrimitive, .slow
         btbnz JSCell::m_flags[t0], constexpr MasqueradesAsUndefined, .slow
-        truthyCellConditionOp(dispatch)
+        truthyCellConditionOp(notTaken)
 
     .target:
-        jump(m_targetLabel)
+        metadata(t5, t0)
+        addi 1, %opcodeStruct%::Metadata::m_takenCount[t5]
+        get(m_targetLabel, t0)
+        jumpImpl(dispatchIndirect, t0)
 
     .slow:
         callSlowPath(_llint_slow_path_%opcodeName%)
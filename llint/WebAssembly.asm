@@ -607,7 +607,15 @@ _wasm_enter:
     addq 1, t2
     btqnz t2, .opEnterLoop
 .opEnterDone:
+    loadp Wasm::Instance::m_pointerToNeedTrapHandling[wasmInstance], t0
+    loadb [t0], t0
+    btinz t0, .opEnterHandleTraps
+.opEnterAfterHandlingTraps:
     wasmDispatchIndirect(1)
+.opEnterHandleTraps:
+    callWasmSlowPath(_slow_path_wasm_check_traps)
+    reloadMemoryRegistersFromInstance(wasmInstance, ws0, ws1)
+    jmp .opEnterAfterHandlingTraps
 
 unprefixedWasmOp(wasm_nop, WasmNop, macro(ctx)
     dispatch(ctx)
@@ -615,7 +623,15 @@ end)
 
 wasmOp(loop_hint, WasmLoopHint, macro(ctx)
     checkSwitchToJITForLoop()
+    loadp Wasm::Instance::m_pointerToNeedTrapHandling[wasmInstance], t0
+    loadb [t0], t0
+    btinz t0, .handleTraps
+.afterHandlingTraps:
     dispatch(ctx)
+.handleTraps:
+    callWasmSlowPath(_slow_path_wasm_check_traps)
+    reloadMemoryRegistersFromInstance(wasmInstance, ws0, ws1)
+    jmp .afterHandlingTraps
 end)
 
 wasmOp(mov, WasmMov, macro(ctx)
@@ -37,6 +37,12 @@
 #include <wtf/Variant.h>
 #include <wtf/dtoa.h>
 
+#if CPU(X86_SSE2)
+#include <emmintrin.h>
+#elif CPU(ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace JSC {
 
 bool isLexerKeyword(const Identifier& identifier)
@@ -595,6 +601,16 @@ ALWAYS_INLINE void Lexer<T>::shift()
         m_current = *m_code;
 }
 
+template <typename T>
+ALWAYS_INLINE void Lexer<T>::shiftTo(const T* ptr)
+{
+    ASSERT(ptr >= m_code && ptr <= m_codeEnd);
+    if (ptr == m_code)
+        return;
+    m_code = ptr;
+    m_current = LIKELY(m_code < m_codeEnd) ? *m_code : 0;
+}
+
 template <typename T>
 ALWAYS_INLINE bool Lexer<T>::atEnd() const
 {
@@ -933,6 +949,196 @@ bool isSafeBuiltinIdentifier(VM& vm, const Identifier* ident)
 }
 #endif // ASSERT_ENABLED
     
+// Minified sources are dominated by long runs of identifier characters, literal bodies and comment text
+// that the per-character loops below merely shift() past. These helpers step over such runs 16 characters
+// at a time and return the first character the caller's loop has to look at. They are conservative: a
+// block containing anything unusual is left to the scalar loop, so stopping early is always correct.
+static constexpr ptrdiff_t charactersPerLexerScanBlock = 16;
+
+#if CPU(X86_SSE2)
+
+static ALWAYS_INLINE __m128i loadLexerScanVector(const LChar* ptr)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+}
+
+// Lanes are all-ones where the unsigned byte is in [0, limit].
+static ALWAYS_INLINE __m128i lessThanOrEqualBytes(__m128i value, uint8_t limit)
+{
+    return _mm_cmpeq_epi8(_mm_min_epu8(value, _mm_set1_epi8(limit)), value);
+}
+
+static ALWAYS_INLINE bool isPlainIdentifierBlock(__m128i characters)
+{
+    __m128i isAlpha = lessThanOrEqualBytes(_mm_sub_epi8(_mm_or_si128(characters, _mm_set1_epi8(0x20)), _mm_set1_epi8('a')), 'z' - 'a');
+    __m128i isDigit = lessThanOrEqualBytes(_mm_sub_epi8(characters, _mm_set1_epi8('0')), '9' - '0');
+    __m128i isOther = _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8('_')), _mm_cmpeq_epi8(characters, _mm_set1_epi8('$')));
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(isAlpha, isDigit), isOther)) == 0xFFFF;
+}
+
+static ALWAYS_INLINE bool isPlainIdentifierBlock(const LChar* ptr)
+{
+    return isPlainIdentifierBlock(loadLexerScanVector(ptr));
+}
+
+static ALWAYS_INLINE bool isPlainIdentifierBlock(const UChar* ptr)
+{
+    // Saturating to 0xFF maps every non-Latin-1 character onto a byte that is not an ASCII identifier part.
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 8));
+    return isPlainIdentifierBlock(_mm_packus_epi16(low, high));
+}
+
+static ALWAYS_INLINE bool isPlainLiteralBlock(const LChar* ptr, LChar terminator, LChar otherTerminator)
+{
+    __m128i characters = loadLexerScanVector(ptr);
+    __m128i stops = _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8(terminator)), _mm_cmpeq_epi8(characters, _mm_set1_epi8(otherTerminator)));
+    stops = _mm_or_si128(stops, _mm_cmpeq_epi8(characters, _mm_set1_epi8('\\')));
+    stops = _mm_or_si128(stops, lessThanOrEqualBytes(characters, 0xD));
+    return !_mm_movemask_epi8(stops);
+}
+
+static ALWAYS_INLINE __m128i literalStopsForHalfBlock(const UChar* ptr, UChar terminator, UChar otherTerminator)
+{
+    __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    __m128i stops = _mm_or_si128(_mm_cmpeq_epi16(characters, _mm_set1_epi16(terminator)), _mm_cmpeq_epi16(characters, _mm_set1_epi16(otherTerminator)));
+    stops = _mm_or_si128(stops, _mm_cmpeq_epi16(characters, _mm_set1_epi16('\\')));
+    // Anything outside [0xE, 0xFF]: bias the unsigned range check so that a signed compare can do it.
+    __m128i biased = _mm_xor_si128(_mm_sub_epi16(characters, _mm_set1_epi16(0xE)), _mm_set1_epi16(static_cast<int16_t>(0x8000)));
+    return _mm_or_si128(stops, _mm_cmpgt_epi16(biased, _mm_set1_epi16(static_cast<int16_t>((0xFF - 0xE) ^ 0x8000))));
+}
+
+static ALWAYS_INLINE bool isPlainLiteralBlock(const UChar* ptr, UChar terminator, UChar otherTerminator)
+{
+    return !_mm_movemask_epi8(_mm_or_si128(literalStopsForHalfBlock(ptr, terminator, otherTerminator), literalStopsForHalfBlock(ptr + 8, terminator, otherTerminator)));
+}
+
+static ALWAYS_INLINE bool isPlainCommentBlock(const LChar* ptr)
+{
+    __m128i characters = loadLexerScanVector(ptr);
+    __m128i stops = _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8('*')), _mm_cmpeq_epi8(characters, _mm_set1_epi8('\n')));
+    stops = _mm_or_si128(stops, _mm_cmpeq_epi8(characters, _mm_set1_epi8('\r')));
+    return !_mm_movemask_epi8(stops);
+}
+
+static ALWAYS_INLINE __m128i commentStopsForHalfBlock(const UChar* ptr)
+{
+    __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    __m128i stops = _mm_or_si128(_mm_cmpeq_epi16(characters, _mm_set1_epi16('*')), _mm_cmpeq_epi16(characters, _mm_set1_epi16('\n')));
+    stops = _mm_or_si128(stops, _mm_cmpeq_epi16(characters, _mm_set1_epi16('\r')));
+    // U+2028 and U+2029 differ only in the low bit.
+    return _mm_or_si128(stops, _mm_cmpeq_epi16(_mm_or_si128(characters, _mm_set1_epi16(1)), _mm_set1_epi16(0x2029)));
+}
+
+static ALWAYS_INLINE bool isPlainCommentBlock(const UChar* ptr)
+{
+    return !_mm_movemask_epi8(_mm_or_si128(commentStopsForHalfBlock(ptr), commentStopsForHalfBlock(ptr + 8)));
+}
+
+#elif CPU(ARM64)
+
+static ALWAYS_INLINE bool isPlainIdentifierBlock(uint8x16_t characters)
+{
+    uint8x16_t isAlpha = vcleq_u8(vsubq_u8(vorrq_u8(characters, vdupq_n_u8(0x20)), vdupq_n_u8('a')), vdupq_n_u8('z' - 'a'));
+    uint8x16_t isDigit = vcleq_u8(vsubq_u8(characters, vdupq_n_u8('0')), vdupq_n_u8('9' - '0'));
+    uint8x16_t isOther = vorrq_u8(vceqq_u8(characters, vdupq_n_u8('_')), vceqq_u8(characters, vdupq_n_u8('$')));
+    return vminvq_u8(vorrq_u8(vorrq_u8(isAlpha, isDigit), isOther)) == 0xFF;
+}
+
+static ALWAYS_INLINE bool isPlainIdentifierBlock(const LChar* ptr)
+{
+    return isPlainIdentifierBlock(vld1q_u8(ptr));
+}
+
+static ALWAYS_INLINE bool isPlainIdentifierBlock(const UChar* ptr)
+{
+    // Saturating to 0xFF maps every non-Latin-1 character onto a byte that is not an ASCII identifier part.
+    uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t*>(ptr));
+    uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t*>(ptr + 8));
+    return isPlainIdentifierBlock(vcombine_u8(vqmovn_u16(low), vqmovn_u16(high)));
+}
+
+static ALWAYS_INLINE bool isPlainLiteralBlock(const LChar* ptr, LChar terminator, LChar otherTerminator)
+{
+    uint8x16_t characters = vld1q_u8(ptr);
+    uint8x16_t stops = vorrq_u8(vceqq_u8(characters, vdupq_n_u8(terminator)), vceqq_u8(characters, vdupq_n_u8(otherTerminator)));
+    stops = vorrq_u8(stops, vceqq_u8(characters, vdupq_n_u8('\\')));
+    stops = vorrq_u8(stops, vcltq_u8(characters, vdupq_n_u8(0xE)));
+    return !vmaxvq_u8(stops);
+}
+
+static ALWAYS_INLINE uint16x8_t literalStopsForHalfBlock(const UChar* ptr, UChar terminator, UChar otherTerminator)
+{
+    uint16x8_t characters = vld1q_u16(reinterpret_cast<const uint16_t*>(ptr));
+    uint16x8_t stops = vorrq_u16(vceqq_u16(characters, vdupq_n_u16(terminator)), vceqq_u16(characters, vdupq_n_u16(otherTerminator)));
+    stops = vorrq_u16(stops, vceqq_u16(characters, vdupq_n_u16('\\')));
+    stops = vorrq_u16(stops, vcltq_u16(characters, vdupq_n_u16(0xE)));
+    return vorrq_u16(stops, vcgtq_u16(characters, vdupq_n_u16(0xFF)));
+}
+
+static ALWAYS_INLINE bool isPlainLiteralBlock(const UChar* ptr, UChar terminator, UChar otherTerminator)
+{
+    return !vmaxvq_u16(vorrq_u16(literalStopsForHalfBlock(ptr, terminator, otherTerminator), literalStopsForHalfBlock(ptr + 8, terminator, otherTerminator)));
+}
+
+static ALWAYS_INLINE bool isPlainCommentBlock(const LChar* ptr)
+{
+    uint8x16_t characters = vld1q_u8(ptr);
+    uint8x16_t stops = vorrq_u8(vceqq_u8(characters, vdupq_n_u8('*')), vceqq_u8(characters, vdupq_n_u8('\n')));
+    stops = vorrq_u8(stops, vceqq_u8(characters, vdupq_n_u8('\r')));
+    return !vmaxvq_u8(stops);
+}
+
+static ALWAYS_INLINE uint16x8_t commentStopsForHalfBlock(const UChar* ptr)
+{
+    uint16x8_t characters = vld1q_u16(reinterpret_cast<const uint16_t*>(ptr));
+    uint16x8_t stops = vorrq_u16(vceqq_u16(characters, vdupq_n_u16('*')), vceqq_u16(characters, vdupq_n_u16('\n')));
+    stops = vorrq_u16(stops, vceqq_u16(characters, vdupq_n_u16('\r')));
+    // U+2028 and U+2029 differ only in the low bit.
+    return vorrq_u16(stops, vceqq_u16(vorrq_u16(characters, vdupq_n_u16(1)), vdupq_n_u16(0x2029)));
+}
+
+static ALWAYS_INLINE bool isPlainCommentBlock(const UChar* ptr)
+{
+    return !vmaxvq_u16(vorrq_u16(commentStopsForHalfBlock(ptr), commentStopsForHalfBlock(ptr + 8)));
+}
+
+#else
+
+template <typename T> static ALWAYS_INLINE bool isPlainIdentifierBlock(const T*) { return false; }
+template <typename T> static ALWAYS_INLINE bool isPlainLiteralBlock(const T*, T, T) { return false; }
+template <typename T> static ALWAYS_INLINE bool isPlainCommentBlock(const T*) { return false; }
+
+#endif
+
+template <typename T, typename Functor>
+static ALWAYS_INLINE const T* skipPlainBlocks(const T* ptr, const T* end, const Functor& isPlainBlock)
+{
+    if (!Options::useVectorizedLexerScanning())
+        return ptr;
+    while (end - ptr >= charactersPerLexerScanBlock && isPlainBlock(ptr))
+        ptr += charactersPerLexerScanBlock;
+    return ptr;
+}
+
+template <typename T>
+static ALWAYS_INLINE const T* skipPlainIdentifierCharacters(const T* ptr, const T* end)
+{
+    return skipPlainBlocks(ptr, end, [] (const T* block) { return isPlainIdentifierBlock(block); });
+}
+
+template <typename T>
+static ALWAYS_INLINE const T* skipPlainLiteralCharacters(const T* ptr, const T* end, T terminator, T otherTerminator)
+{
+    return skipPlainBlocks(ptr, end, [=] (const T* block) { return isPlainLiteralBlock(block, terminator, otherTerminator); });
+}
+
+template <typename T>
+static ALWAYS_INLINE const T* skipPlainCommentCharacters(const T* ptr, const T* end)
+{
+    return skipPlainBlocks(ptr, end, [] (const T* block) { return isPlainCommentBlock(block); });
+}
+
 template <>
 template <bool shouldCreateIdentifier> ALWAYS_INLINE JSTokenType Lexer<LChar>::parseIdentifier(JSTokenData* tokenData, OptionSet<LexerFlags> lexerFlags, bool strictMode)
 {
@@ -964,6 +1170,7 @@ template <bool shouldCreateIdentifier> ALWAYS_INLINE JSTokenType Lexer<LChar>::p
         shift();
 
     ASSERT(isIdentStart(m_current) || m_current == '\\');
+    shiftTo(skipPlainIdentifierCharacters(currentSourcePtr(), m_codeEnd));
     while (isIdentPart(m_current))
         shift();
     
@@ -1036,6 +1243,8 @@ template <bool shouldCreateIdentifier> ALWAYS_INLINE JSTokenType Lexer<UChar>::p
 
     UChar orAllChars = 0;
     ASSERT(isSingleCharacterIdentStart(m_current) || U16_IS_SURROGATE(m_current) || m_current == '\\');
+    // Characters skipped in blocks are all ASCII, so they cannot affect orAllChars.
+    shiftTo(skipPlainIdentifierCharacters(currentSourcePtr(), m_codeEnd));
     while (isSingleCharacterIdentPart(m_current)) {
         orAllChars |= m_current;
         shift();
@@ -1192,6 +1401,7 @@ template <bool shouldBuildStrings> ALWAYS_INLINE typename Lexer<T>::StringParseR
     shift();
 
     const T* stringStart = currentSourcePtr();
+    shiftTo(skipPlainLiteralCharacters(stringStart, m_codeEnd, stringQuoteCharacter, stringQuoteCharacter));
 
     while (m_current != stringQuoteCharacter) {
         if (UNLIKELY(m_current == '\\')) {
@@ -1226,6 +1436,7 @@ template <bool shouldBuildStrings> ALWAYS_INLINE typename Lexer<T>::StringParseR
                 return parseStringSlowCase<shouldBuildStrings>(tokenData, strictMode);
             }
             stringStart = currentSourcePtr();
+            shiftTo(skipPlainLiteralCharacters(stringStart, m_codeEnd, stringQuoteCharacter, stringQuoteCharacter));
             continue;
         }
 
@@ -1412,6 +1623,7 @@ typename Lexer<T>::StringParseResult Lexer<T>::parseTemplateLiteral(JSTokenData*
     bool parseCookedFailed = false;
     const T* stringStart = currentSourcePtr();
     const T* rawStringStart = currentSourcePtr();
+    shiftTo(skipPlainLiteralCharacters<T>(stringStart, m_codeEnd, '`', '$'));
 
     while (m_current != '`') {
         if (UNLIKELY(m_current == '\\')) {
@@ -1801,6 +2013,8 @@ template <typename T>
 ALWAYS_INLINE bool Lexer<T>::parseMultilineComment()
 {
     while (true) {
+        shiftTo(skipPlainCommentCharacters(currentSourcePtr(), m_codeEnd));
+
         while (UNLIKELY(m_current == '*')) {
             shift();
             if (m_current == '/') {
@@ -138,6 +138,7 @@ private:
 
     UChar32 currentCodePoint() const;
     ALWAYS_INLINE void shift();
+    ALWAYS_INLINE void shiftTo(const T*);
     ALWAYS_INLINE bool atEnd() const;
     ALWAYS_INLINE T peek(int offset) const;
 
@@ -130,6 +130,7 @@ template <typename LexerType>
 Parser<LexerType>::Parser(VM& vm, const SourceCode& source, JSParserBuiltinMode builtinMode, JSParserStrictMode strictMode, JSParserScriptMode scriptMode, SourceParseMode parseMode, SuperBinding superBinding, ConstructorKind defaultConstructorKindForTopLevelFunction, DerivedContextType derivedContextType, bool isEvalContext, EvalContextType evalContextType, DebuggerParseData* debuggerParseData, bool isInsideOrdinaryFunction)
     : m_vm(vm)
     , m_source(&source)
+    , m_parserArena(Options::useParserArenaRecycling() ? &vm.parserArenaPool() : nullptr)
     , m_hasStackOverflow(false)
     , m_allowsIn(true)
     , m_statementDepth(0)
@@ -36,8 +36,39 @@ namespace JSC {
 DEFINE_ALLOCATOR_WITH_HEAP_IDENTIFIER(IdentifierArena);
 DEFINE_ALLOCATOR_WITH_HEAP_IDENTIFIER(ParserArena);
 
-ParserArena::ParserArena()
-    : m_freeableMemory(nullptr)
+ParserArenaPool::~ParserArenaPool()
+{
+    clear();
+}
+
+void ParserArenaPool::recycleFreeablePool(void* pool)
+{
+    if (m_freeablePools.size() >= Options::maximumRecycledParserArenaPools()) {
+        ParserArenaMalloc::free(pool);
+        return;
+    }
+    m_freeablePools.append(pool);
+}
+
+void ParserArenaPool::recycleIdentifierArena(std::unique_ptr<IdentifierArena>&& identifierArena)
+{
+    // Dropping the identifiers now releases their strings; the arena's lookup tables are kept.
+    identifierArena->clear();
+    if (!m_identifierArena)
+        m_identifierArena = WTFMove(identifierArena);
+}
+
+void ParserArenaPool::clear()
+{
+    for (void* pool : m_freeablePools)
+        ParserArenaMalloc::free(pool);
+    m_freeablePools.clear();
+    m_identifierArena = nullptr;
+}
+
+ParserArena::ParserArena(ParserArenaPool* pool)
+    : m_pool(pool)
+    , m_freeableMemory(nullptr)
     , m_freeablePoolEnd(nullptr)
 {
 }
@@ -54,6 +85,16 @@ inline void ParserArena::deallocateObjects()
     for (size_t i = 0; i < size; ++i)
         m_deletableObjects[i]->~ParserArenaDeletable();
 
+    if (m_pool) {
+        if (m_freeablePoolEnd)
+            m_pool->recycleFreeablePool(freeablePool());
+        for (void* pool : m_freeablePools)
+            m_pool->recycleFreeablePool(pool);
+        if (m_identifierArena)
+            m_pool->recycleIdentifierArena(WTFMove(m_identifierArena));
+        return;
+    }
+
     if (m_freeablePoolEnd)
         ParserArenaMalloc::free(freeablePool());
 
@@ -72,7 +113,9 @@ void ParserArena::allocateFreeablePool()
     if (m_freeablePoolEnd)
         m_freeablePools.append(freeablePool());
 
-    char* pool = static_cast<char*>(ParserArenaMalloc::malloc(freeablePoolSize));
+    char* pool = m_pool ? static_cast<char*>(m_pool->takeFreeablePool()) : nullptr;
+    if (!pool)
+        pool = static_cast<char*>(ParserArenaMalloc::malloc(freeablePoolSize));
     m_freeableMemory = pool;
     m_freeablePoolEnd = pool + freeablePoolSize;
     ASSERT(freeablePool() == pool);
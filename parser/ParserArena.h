@@ -141,14 +141,38 @@ namespace JSC {
 
     DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(ParserArena);
 
+    // Keeps the memory of finished parses, up to Options::maximumRecycledParserArenaPools() freeable
+    // pools and one IdentifierArena, so that a VM that parses many small programs (eval, new Function)
+    // does not go back to malloc for every parse. Only used while holding the VM's lock.
+    class ParserArenaPool {
+        WTF_MAKE_NONCOPYABLE(ParserArenaPool);
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        ParserArenaPool() = default;
+        ~ParserArenaPool();
+
+        void* takeFreeablePool() { return m_freeablePools.isEmpty() ? nullptr : m_freeablePools.takeLast(); }
+        void recycleFreeablePool(void*);
+
+        std::unique_ptr<IdentifierArena> takeIdentifierArena() { return WTFMove(m_identifierArena); }
+        void recycleIdentifierArena(std::unique_ptr<IdentifierArena>&&);
+
+        void clear();
+
+    private:
+        Vector<void*> m_freeablePools;
+        std::unique_ptr<IdentifierArena> m_identifierArena;
+    };
+
     class ParserArena {
         WTF_MAKE_NONCOPYABLE(ParserArena);
     public:
-        ParserArena();
+        ParserArena(ParserArenaPool* = nullptr);
         ~ParserArena();
 
         void swap(ParserArena& otherArena)
         {
+            std::swap(m_pool, otherArena.m_pool);
             std::swap(m_freeableMemory, otherArena.m_freeableMemory);
             std::swap(m_freeablePoolEnd, otherArena.m_freeablePoolEnd);
             m_identifierArena.swap(otherArena.m_identifierArena);
@@ -184,12 +208,18 @@ namespace JSC {
 
         IdentifierArena& identifierArena()
         {
-            if (UNLIKELY (!m_identifierArena))
-                m_identifierArena = makeUnique<IdentifierArena>();
+            if (UNLIKELY (!m_identifierArena)) {
+                if (m_pool)
+                    m_identifierArena = m_pool->takeIdentifierArena();
+                if (!m_identifierArena)
+                    m_identifierArena = makeUnique<IdentifierArena>();
+            }
             return *m_identifierArena;
         }
 
     private:
+        friend class ParserArenaPool;
+
         static const size_t freeablePoolSize = 8000;
 
         static size_t alignSize(size_t size)
@@ -201,6 +231,7 @@ namespace JSC {
         void allocateFreeablePool();
         void deallocateObjects();
 
+        ParserArenaPool* m_pool;
         char* m_freeableMemory;
         char* m_freeablePoolEnd;
 
@@ -124,6 +124,14 @@ public:
         return !(*this == other);
     }
 
+    // Keys for different kinds of code over the same text differ only in their flags.
+    bool hasSameSourceText(const SourceCodeKey& other) const
+    {
+        return (m_hash ^ m_flags.bits()) == (other.m_hash ^ other.m_flags.bits())
+            && length() == other.length()
+            && string() == other.string();
+    }
+
     struct Hash {
         static unsigned hash(const SourceCodeKey& key) { return key.hash(); }
         static bool equal(const SourceCodeKey& a, const SourceCodeKey& b) { return a == b; }
@@ -41,6 +41,8 @@ enum JettisonReason {
     JettisonDueToVMTraps
 };
 
+static constexpr unsigned numberOfJettisonReasons = static_cast<unsigned>(JettisonDueToVMTraps) + 1;
+
 } } // namespace JSC::Profiler
 
 namespace WTF {
@@ -26,8 +26,10 @@
 #include "config.h"
 #include "ArrayBuffer.h"
 
+#include "ArrayBufferPool.h"
 #include "JSArrayBufferView.h"
 #include "JSCellInlines.h"
+#include "Options.h"
 #include <wtf/Gigacage.h>
 
 namespace JSC {
@@ -124,7 +126,14 @@ void ArrayBufferContents::tryAllocate(unsigned numElements, unsigned elementByte
     if (!allocationSize)
         allocationSize = 1; // Make sure malloc actually allocates something, but not too much. We use null to mean that the buffer is detached.
 
-    void* data = Gigacage::tryMalloc(Gigacage::Primitive, allocationSize);
+    ArrayBufferDestructorFunction destructor;
+    void* data;
+    if (Options::useArrayBufferPool() && ArrayBufferPool::isPoolableSize(allocationSize))
+        data = ArrayBufferPool::singleton().tryAllocate(allocationSize, destructor);
+    else {
+        data = Gigacage::tryMalloc(Gigacage::Primitive, allocationSize);
+        destructor = ArrayBuffer::primitiveGigacageDestructor();
+    }
     m_data = DataType(data, sizeInBytes);
     if (!data) {
         reset();
@@ -136,7 +145,7 @@ void ArrayBufferContents::tryAllocate(unsigned numElements, unsigned elementByte
 
     m_sizeInBytes = sizeInBytes;
     RELEASE_ASSERT(m_sizeInBytes <= MAX_ARRAY_BUFFER_SIZE);
-    m_destructor = ArrayBuffer::primitiveGigacageDestructor();
+    m_destructor = WTFMove(destructor);
 }
 
 void ArrayBufferContents::makeShared()
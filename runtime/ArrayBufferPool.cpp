@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "ArrayBufferPool.h"
+
+#include "Options.h"
+#include <wtf/Gigacage.h>
+#include <wtf/NeverDestroyed.h>
+
+namespace JSC {
+
+ArrayBufferPool& ArrayBufferPool::singleton()
+{
+    static LazyNeverDestroyed<ArrayBufferPool> pool;
+    static std::once_flag onceKey;
+    std::call_once(onceKey, [&] {
+        pool.construct();
+    });
+    return pool.get();
+}
+
+ArrayBufferPool::ArrayBufferPool()
+{
+    static_assert(minimumSize << (numberOfSizeClasses - 1) == maximumSize);
+    for (unsigned i = 0; i < numberOfSizeClasses; ++i)
+        m_destructors[i] = createSharedTask<void(void*)>([this, i] (void* p) { release(i, p); });
+}
+
+unsigned ArrayBufferPool::sizeClassIndex(size_t size)
+{
+    ASSERT(isPoolableSize(size));
+    unsigned index = 0;
+    while (sizeClassSize(index) < size)
+        index++;
+    return index;
+}
+
+void* ArrayBufferPool::tryAllocate(size_t size, ArrayBufferDestructorFunction& destructor)
+{
+    unsigned sizeClass = sizeClassIndex(size);
+    void* result = nullptr;
+    {
+        auto locker = holdLock(m_lock);
+        if (!m_freeLists[sizeClass].isEmpty()) {
+            result = m_freeLists[sizeClass].takeLast();
+            m_pooledBytes -= sizeClassSize(sizeClass);
+            m_reusedAllocations++;
+        } else
+            m_freshAllocations++;
+    }
+    if (!result)
+        result = Gigacage::tryMalloc(Gigacage::Primitive, sizeClassSize(sizeClass));
+    if (result)
+        destructor = m_destructors[sizeClass];
+    return result;
+}
+
+void ArrayBufferPool::release(unsigned sizeClass, void* p)
+{
+    {
+        auto locker = holdLock(m_lock);
+        if (m_pooledBytes + sizeClassSize(sizeClass) <= Options::arrayBufferPoolMaximumBytes()) {
+            m_freeLists[sizeClass].append(p);
+            m_pooledBytes += sizeClassSize(sizeClass);
+            return;
+        }
+    }
+    Gigacage::free(Gigacage::Primitive, p);
+}
+
+void ArrayBufferPool::clear()
+{
+    std::array<Vector<void*>, numberOfSizeClasses> freeLists;
+    {
+        auto locker = holdLock(m_lock);
+        freeLists = WTFMove(m_freeLists);
+        m_pooledBytes = 0;
+    }
+    for (auto& freeList : freeLists) {
+        for (void* p : freeList)
+            Gigacage::free(Gigacage::Primitive, p);
+    }
+}
+
+auto ArrayBufferPool::statistics() -> Statistics
+{
+    auto locker = holdLock(m_lock);
+    Statistics result;
+    result.reusedAllocations = m_reusedAllocations;
+    result.freshAllocations = m_freshAllocations;
+    result.pooledBytes = m_pooledBytes;
+    return result;
+}
+
+} // namespace JSC
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "ArrayBuffer.h"
+#include <array>
+#include <wtf/Lock.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+// A process-wide cache of freed Primitive Gigacage ArrayBuffer contents, bucketed into power of
+// two size classes between minimumSize and maximumSize. Programs that keep creating and dropping
+// buffers of these sizes reuse memory that is already faulted in, instead of paying for a fresh
+// large allocation and its page faults each time. The pool holds at most
+// Options::arrayBufferPoolMaximumBytes().
+class ArrayBufferPool {
+    WTF_MAKE_NONCOPYABLE(ArrayBufferPool);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr size_t minimumSize = 64 * KB;
+    static constexpr size_t maximumSize = 4 * MB;
+    static constexpr unsigned numberOfSizeClasses = 7;
+
+    static bool isPoolableSize(size_t size) { return size >= minimumSize && size <= maximumSize; }
+
+    JS_EXPORT_PRIVATE static ArrayBufferPool& singleton();
+
+    // Returns uninitialized memory of at least the given size, which must be poolable, and sets
+    // destructor to the function that hands it back to the pool.
+    void* tryAllocate(size_t, ArrayBufferDestructorFunction& destructor);
+
+    JS_EXPORT_PRIVATE void clear();
+
+    struct Statistics {
+        size_t reusedAllocations { 0 };
+        size_t freshAllocations { 0 };
+        size_t pooledBytes { 0 };
+    };
+    JS_EXPORT_PRIVATE Statistics statistics();
+
+private:
+    friend class LazyNeverDestroyed<ArrayBufferPool>;
+    ArrayBufferPool();
+
+    static unsigned sizeClassIndex(size_t);
+    static size_t sizeClassSize(unsigned index) { return minimumSize << index; }
+
+    void release(unsigned sizeClass, void*);
+
+    Lock m_lock;
+    std::array<Vector<void*>, numberOfSizeClasses> m_freeLists;
+    std::array<RefPtr<SharedTask<void(void*)>>, numberOfSizeClasses> m_destructors;
+    size_t m_pooledBytes { 0 };
+    size_t m_reusedAllocations { 0 };
+    size_t m_freshAllocations { 0 };
+};
+
+} // namespace JSC
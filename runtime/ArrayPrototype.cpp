@@ -25,6 +25,7 @@
 #include "ArrayPrototype.h"
 
 #include "ArrayConstructor.h"
+#include "ArraySearch.h"
 #include "BuiltinNames.h"
 #include "IntegrityInlines.h"
 #include "JSArrayInlines.h"
@@ -37,6 +38,7 @@
 #include "StringRecursionChecker.h"
 #include <algorithm>
 #include <wtf/Assertions.h>
+#include <wtf/text/StringBuilder.h>
 
 namespace JSC {
 
@@ -449,6 +451,29 @@ inline bool containsHole(T* data, unsigned length)
     return false;
 }
 
+// Int32 and Double arrays are formatted straight into one buffer rather than going through
+// JSStringJoiner, which would materialize a String for every element before copying it again.
+static inline void reserveCapacityForNumberJoin(StringBuilder& builder, StringView separator, unsigned length)
+{
+    // Every element takes at least one character, so this never overshoots by more than the holes.
+    Checked<unsigned, RecordOverflow> capacity = separator.length();
+    capacity += 1;
+    capacity *= length;
+    if (!capacity.hasOverflowed() && capacity.unsafeGet() <= String::MaxLength)
+        builder.reserveCapacity(capacity.unsafeGet());
+}
+
+static inline JSValue finishNumberJoin(JSGlobalObject* globalObject, StringBuilder& builder)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    if (UNLIKELY(builder.hasOverflowed()))
+        return throwOutOfMemoryError(globalObject, scope);
+    if (builder.isEmpty())
+        return jsEmptyString(vm);
+    return jsString(vm, builder.toString());
+}
+
 inline JSValue fastJoin(JSGlobalObject* globalObject, JSObject* thisObject, StringView separator, unsigned length, bool& sawHoles, bool& genericCase)
 {
     VM& vm = globalObject->vm();
@@ -459,14 +484,16 @@ inline JSValue fastJoin(JSGlobalObject* globalObject, JSObject* thisObject, Stri
         auto& butterfly = *thisObject->butterfly();
         if (UNLIKELY(length > butterfly.publicLength()))
             break;
-        JSStringJoiner joiner(globalObject, separator, length);
-        RETURN_IF_EXCEPTION(scope, { });
+        StringBuilder builder;
+        reserveCapacityForNumberJoin(builder, separator, length);
         auto data = butterfly.contiguous().data();
         bool holesKnownToBeOK = false;
         for (unsigned i = 0; i < length; ++i) {
+            if (i)
+                builder.append(separator);
             JSValue value = data[i].get();
             if (LIKELY(value))
-                joiner.appendNumber(vm, value.asInt32());
+                builder.appendNumber(value.asInt32());
             else {
                 sawHoles = true;
                 if (!holesKnownToBeOK) {
@@ -474,10 +501,9 @@ inline JSValue fastJoin(JSGlobalObject* globalObject, JSObject* thisObject, Stri
                         goto generalCase;
                     holesKnownToBeOK = true;
                 }
-                joiner.appendEmptyString();
             }
         }
-        RELEASE_AND_RETURN(scope, joiner.join(globalObject));
+        RELEASE_AND_RETURN(scope, finishNumberJoin(globalObject, builder));
     }
     case ALL_CONTIGUOUS_INDEXING_TYPES: {
         auto& butterfly = *thisObject->butterfly();
@@ -508,14 +534,16 @@ inline JSValue fastJoin(JSGlobalObject* globalObject, JSObject* thisObject, Stri
         auto& butterfly = *thisObject->butterfly();
         if (UNLIKELY(length > butterfly.publicLength()))
             break;
-        JSStringJoiner joiner(globalObject, separator, length);
-        RETURN_IF_EXCEPTION(scope, { });
+        StringBuilder builder;
+        reserveCapacityForNumberJoin(builder, separator, length);
         auto data = butterfly.contiguousDouble().data();
         bool holesKnownToBeOK = false;
         for (unsigned i = 0; i < length; ++i) {
+            if (i)
+                builder.append(separator);
             double value = data[i];
             if (LIKELY(!isHole(value)))
-                joiner.appendNumber(vm, value);
+                builder.appendNumber(value);
             else {
                 sawHoles = true;
                 if (!holesKnownToBeOK) {
@@ -523,10 +551,9 @@ inline JSValue fastJoin(JSGlobalObject* globalObject, JSObject* thisObject, Stri
                         goto generalCase;
                     holesKnownToBeOK = true;
                 }
-                joiner.appendEmptyString();
             }
         }
-        RELEASE_AND_RETURN(scope, joiner.join(globalObject));
+        RELEASE_AND_RETURN(scope, finishNumberJoin(globalObject, builder));
     }
     case ALL_UNDECIDED_INDEXING_TYPES: {
         if (length && holesMustForwardToPrototype(vm, thisObject))
@@ -1292,30 +1319,26 @@ ALWAYS_INLINE JSValue fastIndexOf(JSGlobalObject* globalObject, VM& vm, JSArray*
                 return jsNumber(-1);
             searchInt32 = jsNumber(static_cast<int32_t>(searchNumber));
         }
-        auto& butterfly = *array->butterfly();
-        auto data = butterfly.contiguous().data();
-        if (direction == IndexOfDirection::Forward) {
-            for (; index < length; ++index) {
-                // Array#indexOf uses `===` semantics (not HashMap isEqual semantics).
-                // And the hole never matches against Int32 value.
-                if (searchInt32 == data[index].get())
-                    return jsNumber(index);
-            }
-        } else {
-            do {
-                ASSERT(index < length);
-                // Array#lastIndexOf uses `===` semantics (not HashMap isEqual semantics).
-                // And the hole never matches against Int32 value.
-                if (searchInt32 == data[index].get())
-                    return jsNumber(index);
-            } while (index--);
-        }
-        return jsNumber(-1);
+        // Array#indexOf uses `===` semantics (not HashMap isEqual semantics).
+        // And the hole never matches against Int32 value.
+        auto* data = bitwise_cast<const EncodedJSValue*>(array->butterfly()->contiguous().data());
+        size_t result = direction == IndexOfDirection::Forward
+            ? arraySearchForward(data, index, length, JSValue::encode(searchInt32))
+            : arraySearchBackward(data, index, JSValue::encode(searchInt32));
+        return result == notFound ? jsNumber(-1) : jsNumber(static_cast<uint32_t>(result));
     }
     case ALL_CONTIGUOUS_INDEXING_TYPES: {
         auto& butterfly = *array->butterfly();
         auto data = butterfly.contiguous().data();
 
+        if (isBitwiseStrictEqualityCandidate(searchElement)) {
+            auto* encodedData = bitwise_cast<const EncodedJSValue*>(data);
+            size_t result = direction == IndexOfDirection::Forward
+                ? arraySearchForward(encodedData, index, length, JSValue::encode(searchElement))
+                : arraySearchBackward(encodedData, index, JSValue::encode(searchElement));
+            return result == notFound ? jsNumber(-1) : jsNumber(static_cast<uint32_t>(result));
+        }
+
         if (direction == IndexOfDirection::Forward) {
             for (; index < length; ++index) {
                 JSValue value = data[index].get();
@@ -1344,25 +1367,13 @@ ALWAYS_INLINE JSValue fastIndexOf(JSGlobalObject* globalObject, VM& vm, JSArray*
         if (!searchElement.isNumber())
             return jsNumber(-1);
         double searchNumber = searchElement.asNumber();
-        auto& butterfly = *array->butterfly();
-        auto data = butterfly.contiguousDouble().data();
-        if (direction == IndexOfDirection::Forward) {
-            for (; index < length; ++index) {
-                // Array#indexOf uses `===` semantics (not HashMap isEqual semantics).
-                // And the hole never matches since it is NaN.
-                if (data[index] == searchNumber)
-                    return jsNumber(index);
-            }
-        } else {
-            do {
-                ASSERT(index < length);
-                // Array#lastIndexOf uses `===` semantics (not HashMap isEqual semantics).
-                // And the hole never matches since it is NaN.
-                if (data[index] == searchNumber)
-                    return jsNumber(index);
-            } while (index--);
-        }
-        return jsNumber(-1);
+        // Array#indexOf uses `===` semantics (not HashMap isEqual semantics).
+        // And the hole never matches since it is NaN.
+        const double* data = array->butterfly()->contiguousDouble().data();
+        size_t result = direction == IndexOfDirection::Forward
+            ? arraySearchForward(data, index, length, searchNumber)
+            : arraySearchBackward(data, index, searchNumber);
+        return result == notFound ? jsNumber(-1) : jsNumber(static_cast<uint32_t>(result));
     }
     default:
         return JSValue();
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "JSCJSValue.h"
+#include <wtf/NotFound.h>
+
+namespace JSC {
+
+// Linear searches over the raw storage of Int32, Double and Contiguous butterflies, shared by
+// Array.prototype.indexOf and lastIndexOf and by the DFG's ArrayIndexOf operations. They look at
+// a block of elements at a time with a branch-free comparison, which the compiler turns into
+// vector compares, and only narrow down to the exact index once a block has a match.
+//
+// For EncodedJSValue storage the comparison is bitwise, which is === for everything except
+// numbers, strings and BigInts. Holes are zero and never match a real value. For double storage
+// the comparison is IEEE ==, which is === as well: NaN never matches and -0 matches 0.
+
+static constexpr unsigned arraySearchBlockSize = 8;
+
+template<typename T>
+ALWAYS_INLINE size_t arraySearchForward(const T* data, uint32_t index, uint32_t length, T searchElement)
+{
+    for (; index < length && length - index >= arraySearchBlockSize; index += arraySearchBlockSize) {
+        bool found = false;
+        for (unsigned i = 0; i < arraySearchBlockSize; ++i)
+            found |= data[index + i] == searchElement;
+        if (found)
+            break;
+    }
+    for (; index < length; ++index) {
+        if (data[index] == searchElement)
+            return index;
+    }
+    return notFound;
+}
+
+// Searches index, index - 1, ..., 0.
+template<typename T>
+ALWAYS_INLINE size_t arraySearchBackward(const T* data, uint32_t index, T searchElement)
+{
+    size_t end = static_cast<size_t>(index) + 1;
+    for (; end >= arraySearchBlockSize; end -= arraySearchBlockSize) {
+        bool found = false;
+        for (unsigned i = 1; i <= arraySearchBlockSize; ++i)
+            found |= data[end - i] == searchElement;
+        if (found)
+            break;
+    }
+    while (end--) {
+        if (data[end] == searchElement)
+            return end;
+    }
+    return notFound;
+}
+
+// Whether === against value is the same as comparing the EncodedJSValue bits.
+ALWAYS_INLINE bool isBitwiseStrictEqualityCandidate(JSValue value)
+{
+    return !value.isNumber() && !value.isString() && !value.isBigInt();
+}
+
+} // namespace JSC
@@ -26,11 +26,15 @@
 #include "config.h"
 #include "AtomicsObject.h"
 
+#include "DeferredWorkTimer.h"
 #include "FrameTracers.h"
 #include "JSCInlines.h"
+#include "JSPromise.h"
 #include "JSTypedArrays.h"
+#include "ObjectConstructor.h"
 #include "ReleaseHeapAccessScope.h"
 #include "TypedArrayController.h"
+#include "WaiterListManager.h"
 
 namespace JSC {
 
@@ -55,6 +59,8 @@ STATIC_ASSERT_IS_TRIVIALLY_DESTRUCTIBLE(AtomicsObject);
 FOR_EACH_ATOMICS_FUNC(DECLARE_FUNC_PROTO)
 #undef DECLARE_FUNC_PROTO
 
+static JSC_DECLARE_HOST_FUNCTION(atomicsFuncWaitAsync);
+
 const ClassInfo AtomicsObject::s_info = { "Atomics", &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(AtomicsObject) };
 
 AtomicsObject::AtomicsObject(VM& vm, Structure* structure)
@@ -83,6 +89,7 @@ void AtomicsObject::finishCreation(VM& vm, JSGlobalObject* globalObject)
     putDirectNativeFunctionWithoutTransition(vm, globalObject, Identifier::fromString(vm, #lowerName), count, atomicsFunc ## upperName, Atomics ## upperName ## Intrinsic, static_cast<unsigned>(PropertyAttribute::DontEnum));
     FOR_EACH_ATOMICS_FUNC(PUT_DIRECT_NATIVE_FUNC)
 #undef PUT_DIRECT_NATIVE_FUNC
+    putDirectNativeFunctionWithoutTransition(vm, globalObject, Identifier::fromString(vm, "waitAsync"), 4, atomicsFuncWaitAsync, NoIntrinsic, static_cast<unsigned>(PropertyAttribute::DontEnum));
 
     JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
 }
@@ -389,6 +396,55 @@ JSC_DEFINE_HOST_FUNCTION(atomicsFuncSub, (JSGlobalObject* globalObject, CallFram
     return atomicReadModifyWrite(globalObject, callFrame, SubFunc());
 }
 
+template<typename ValueType>
+static AtomicsWaitResult atomicsWaitImpl(VM& vm, ValueType* pointer, ValueType expectedValue, Seconds timeout)
+{
+    // Answer without releasing heap access when the wait cannot block: releasing and reacquiring it
+    // is what makes polling with a mismatched value or a zero timeout expensive.
+    if (WTF::atomicLoad(pointer) != expectedValue)
+        return AtomicsWaitResult::NotEqual;
+    if (!(timeout > 0_s))
+        return AtomicsWaitResult::TimedOut;
+
+    bool didPassValidation = false;
+    ParkingLot::ParkResult result;
+    {
+        ReleaseHeapAccessScope releaseHeapAccessScope(vm.heap);
+        result = ParkingLot::parkConditionally(
+            pointer,
+            [&] () -> bool {
+                didPassValidation = WTF::atomicLoad(pointer) == expectedValue;
+                return didPassValidation;
+            },
+            [] () { },
+            MonotonicTime::now() + timeout);
+    }
+    if (!didPassValidation)
+        return AtomicsWaitResult::NotEqual;
+    if (!result.wasUnparked)
+        return AtomicsWaitResult::TimedOut;
+    return AtomicsWaitResult::OK;
+}
+
+AtomicsWaitResult atomicsWait(VM& vm, int32_t* pointer, int32_t expectedValue, Seconds timeout)
+{
+    return atomicsWaitImpl(vm, pointer, expectedValue, timeout);
+}
+
+AtomicsWaitResult atomicsWait(VM& vm, int64_t* pointer, int64_t expectedValue, Seconds timeout)
+{
+    return atomicsWaitImpl(vm, pointer, expectedValue, timeout);
+}
+
+unsigned atomicsNotify(void* pointer, unsigned count)
+{
+    // Blocked threads are woken before Atomics.waitAsync promises rather than strictly in the order they started waiting.
+    unsigned notified = ParkingLot::unparkCount(pointer, count);
+    if (notified < count)
+        notified += WaiterListManager::singleton().notifyWaiters(pointer, count - notified);
+    return notified;
+}
+
 JSC_DEFINE_HOST_FUNCTION(atomicsFuncWait, (JSGlobalObject* globalObject, CallFrame* callFrame))
 {
     VM& vm = globalObject->vm();
@@ -422,24 +478,70 @@ JSC_DEFINE_HOST_FUNCTION(atomicsFuncWait, (JSGlobalObject* globalObject, CallFra
         return JSValue::encode(jsUndefined());
     }
 
-    bool didPassValidation = false;
-    ParkingLot::ParkResult result;
-    {
-        ReleaseHeapAccessScope releaseHeapAccessScope(vm.heap);
-        result = ParkingLot::parkConditionally(
-            ptr,
-            [&] () -> bool {
-                didPassValidation = WTF::atomicLoad(ptr) == expectedValue;
-                return didPassValidation;
-            },
-            [] () { },
-            MonotonicTime::now() + timeout);
-    }
-    if (!didPassValidation)
+    switch (atomicsWait(vm, ptr, expectedValue, timeout)) {
+    case AtomicsWaitResult::OK:
+        return JSValue::encode(vm.smallStrings.okString());
+    case AtomicsWaitResult::NotEqual:
         return JSValue::encode(vm.smallStrings.notEqualString());
-    if (!result.wasUnparked)
+    case AtomicsWaitResult::TimedOut:
         return JSValue::encode(vm.smallStrings.timedOutString());
-    return JSValue::encode(vm.smallStrings.okString());
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return JSValue::encode(jsUndefined());
+}
+
+JSC_DEFINE_HOST_FUNCTION(atomicsFuncWaitAsync, (JSGlobalObject* globalObject, CallFrame* callFrame))
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* typedArrayBuffer = validateIntegerTypedArray<TypedArrayOperationMode::Write>(globalObject, callFrame->argument(0));
+    RETURN_IF_EXCEPTION(scope, { });
+    auto* typedArray = jsCast<JSInt32Array*>(typedArrayBuffer);
+
+    if (!typedArray->isShared()) {
+        throwTypeError(globalObject, scope, "Typed array for wait/notify must wrap a SharedArrayBuffer."_s);
+        return JSValue::encode(jsUndefined());
+    }
+
+    unsigned accessIndex = validateAtomicAccess(vm, globalObject, typedArray, callFrame->argument(1));
+    RETURN_IF_EXCEPTION(scope, { });
+
+    int32_t* ptr = typedArray->typedVector() + accessIndex;
+
+    int32_t expectedValue = callFrame->argument(2).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, JSValue::encode(jsUndefined()));
+
+    double timeoutInMilliseconds = callFrame->argument(3).toNumber(globalObject);
+    RETURN_IF_EXCEPTION(scope, JSValue::encode(jsUndefined()));
+    Seconds timeout = Seconds::infinity();
+    if (!std::isnan(timeoutInMilliseconds))
+        timeout = std::max(Seconds::fromMilliseconds(timeoutInMilliseconds), 0_s);
+
+    auto makeResult = [&] (bool isAsync, JSValue value) {
+        JSObject* result = constructEmptyObject(globalObject);
+        result->putDirect(vm, vm.propertyNames->async, jsBoolean(isAsync));
+        result->putDirect(vm, vm.propertyNames->value, value);
+        return JSValue::encode(result);
+    };
+
+    if (WTF::atomicLoad(ptr) != expectedValue)
+        return makeResult(false, vm.smallStrings.notEqualString());
+    if (!(timeout > 0_s))
+        return makeResult(false, vm.smallStrings.timedOutString());
+
+    // Unlike Atomics.wait, this never blocks, so it is allowed on every thread. The dependency keeps
+    // the memory being waited on alive until the promise settles.
+    JSPromise* promise = JSPromise::create(vm, globalObject->promiseStructure());
+    Vector<Strong<JSCell>> dependencies;
+    dependencies.append(Strong<JSCell>(vm, typedArray));
+    vm.deferredWorkTimer->addPendingWork(vm, promise, WTFMove(dependencies));
+
+    if (!WaiterListManager::singleton().addWaiterIfEqual(vm, ptr, expectedValue, promise, timeout)) {
+        vm.deferredWorkTimer->cancelPendingWork(promise);
+        return makeResult(false, vm.smallStrings.notEqualString());
+    }
+    return makeResult(true, promise);
 }
 
 JSC_DEFINE_HOST_FUNCTION(atomicsFuncNotify, (JSGlobalObject* globalObject, CallFrame* callFrame))
@@ -468,7 +570,7 @@ JSC_DEFINE_HOST_FUNCTION(atomicsFuncNotify, (JSGlobalObject* globalObject, CallF
         return JSValue::encode(jsNumber(0));
 
     int32_t* ptr = typedArray->typedVector() + accessIndex;
-    return JSValue::encode(jsNumber(ParkingLot::unparkCount(ptr, count)));
+    return JSValue::encode(jsNumber(atomicsNotify(ptr, count)));
 }
 
 JSC_DEFINE_HOST_FUNCTION(atomicsFuncXor, (JSGlobalObject* globalObject, CallFrame* callFrame))
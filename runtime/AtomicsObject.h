@@ -51,6 +51,18 @@ private:
     void finishCreation(VM&, JSGlobalObject*);
 };
 
+// The waiting and waking shared by Atomics.wait/notify and Wasm's memory.atomic.wait/notify. The
+// values match the results of memory.atomic.wait.
+enum class AtomicsWaitResult : int32_t {
+    OK = 0,
+    NotEqual = 1,
+    TimedOut = 2,
+};
+
+AtomicsWaitResult atomicsWait(VM&, int32_t* pointer, int32_t expectedValue, Seconds timeout);
+AtomicsWaitResult atomicsWait(VM&, int64_t* pointer, int64_t expectedValue, Seconds timeout);
+unsigned atomicsNotify(void* pointer, unsigned count);
+
 JSC_DECLARE_JIT_OPERATION(operationAtomicsAdd, EncodedJSValue, (JSGlobalObject*, EncodedJSValue base, EncodedJSValue index, EncodedJSValue operand));
 JSC_DECLARE_JIT_OPERATION(operationAtomicsAnd, EncodedJSValue, (JSGlobalObject*, EncodedJSValue base, EncodedJSValue index, EncodedJSValue operand));
 JSC_DECLARE_JIT_OPERATION(operationAtomicsCompareExchange, EncodedJSValue, (JSGlobalObject*, EncodedJSValue base, EncodedJSValue index, EncodedJSValue expected, EncodedJSValue newValue));
@@ -28,6 +28,7 @@
 #include "BasicBlockLocation.h"
 
 #include "CCallHelpers.h"
+#include "Options.h"
 #include <climits>
 #include <wtf/DataLog.h>
 
@@ -85,12 +86,22 @@ void BasicBlockLocation::dumpData() const
 void BasicBlockLocation::emitExecuteCode(CCallHelpers& jit) const
 {
     static_assert(sizeof(UCPURegister) == 8, "Assuming size_t is 64 bits on 64 bit platforms.");
+    if (Options::useControlFlowProfilerCoverageMode()) {
+        // Any non-zero count means the block has executed, so setting one byte is enough.
+        jit.store8(CCallHelpers::TrustedImm32(1), bitwise_cast<void*>(executionCountAddress()));
+        return;
+    }
     jit.add64(CCallHelpers::TrustedImm32(1), CCallHelpers::AbsoluteAddress(&m_executionCount));
 }
 #else
 void BasicBlockLocation::emitExecuteCode(CCallHelpers& jit, MacroAssembler::RegisterID scratch) const
 {
     static_assert(sizeof(size_t) == 4, "Assuming size_t is 32 bits on 32 bit platforms.");
+    if (Options::useControlFlowProfilerCoverageMode()) {
+        UNUSED_PARAM(scratch);
+        jit.store8(CCallHelpers::TrustedImm32(1), bitwise_cast<void*>(executionCountAddress()));
+        return;
+    }
     jit.load32(&m_executionCount, scratch);
     CCallHelpers::Jump done = jit.branchAdd32(CCallHelpers::Zero, scratch, CCallHelpers::TrustedImm32(1), scratch);
     jit.store32(scratch, bitwise_cast<void*>(&m_executionCount));
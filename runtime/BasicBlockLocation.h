@@ -48,6 +48,8 @@ public:
     void setEndOffset(int endOffset) { m_endOffset = endOffset; }
     bool hasExecuted() const { return m_executionCount > 0; }
     size_t executionCount() const { return m_executionCount; }
+    void resetExecutionCount() { m_executionCount = 0; }
+    const void* executionCountAddress() const { return &m_executionCount; }
     void insertGap(int, int);
     Vector<Gap> getExecutedRanges() const;
     JS_EXPORT_PRIVATE void dumpData() const;
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "BytecodeCacheWriter.h"
+
+#include <wtf/Condition.h>
+#include <wtf/Deque.h>
+#include <wtf/FileSystem.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/ProcessID.h>
+#include <wtf/Threading.h>
+#include <wtf/text/StringConcatenate.h>
+
+namespace JSC {
+
+bool writeBytecodeCacheFile(const String& path, const Vector<uint8_t>& contents)
+{
+    // Several threads or processes may be replacing the same cache, so each write gets its own temporary file.
+    static Atomic<unsigned> temporaryFileCount;
+    String temporaryPath = makeString(path, ".tmp.", getCurrentProcessID(), '.', temporaryFileCount.exchangeAdd(1));
+    auto fd = FileSystem::openFile(temporaryPath, FileSystem::FileOpenMode::Write);
+    if (!FileSystem::isHandleValid(fd))
+        return false;
+
+    bool succeeded = true;
+    size_t offset = 0;
+    while (offset < contents.size()) {
+        int bytesWritten = FileSystem::writeToFile(fd, reinterpret_cast<const char*>(contents.data() + offset), contents.size() - offset);
+        if (bytesWritten <= 0) {
+            succeeded = false;
+            break;
+        }
+        offset += bytesWritten;
+    }
+    FileSystem::closeFile(fd);
+
+    if (succeeded)
+        succeeded = FileSystem::moveFile(temporaryPath, path);
+    if (!succeeded)
+        FileSystem::deleteFile(temporaryPath);
+    return succeeded;
+}
+
+namespace {
+
+struct BytecodeCacheWriteTask {
+    WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+    String path;
+    Vector<uint8_t> contents;
+    FileSystem::PlatformFileHandle lockedFile;
+};
+
+class AsynchronousBytecodeCacheWriter {
+public:
+    AsynchronousBytecodeCacheWriter()
+    {
+        Thread::create("Bytecode Cache Writer", [&] () { run(); });
+    }
+
+    void enqueue(std::unique_ptr<BytecodeCacheWriteTask> task)
+    {
+        LockHolder locker(m_lock);
+        m_queue.append(WTFMove(task));
+        m_condition.notifyAll();
+    }
+
+    void waitUntilEmpty()
+    {
+        LockHolder locker(m_lock);
+        while (!m_queue.isEmpty() || m_working)
+            m_condition.wait(m_lock);
+    }
+
+private:
+    NO_RETURN void run()
+    {
+        for (;;) {
+            std::unique_ptr<BytecodeCacheWriteTask> task;
+            {
+                LockHolder locker(m_lock);
+                m_working = false;
+                m_condition.notifyAll();
+                while (m_queue.isEmpty())
+                    m_condition.wait(m_lock);
+                task = m_queue.takeFirst();
+                m_working = true;
+            }
+
+            writeBytecodeCacheFile(task->path, task->contents);
+            FileSystem::unlockAndCloseFile(task->lockedFile);
+        }
+    }
+
+    Lock m_lock;
+    Condition m_condition;
+    Deque<std::unique_ptr<BytecodeCacheWriteTask>> m_queue;
+    bool m_working { false };
+};
+
+bool hadAnyAsynchronousBytecodeCacheWrite = false;
+
+AsynchronousBytecodeCacheWriter& asynchronousBytecodeCacheWriter()
+{
+    static LazyNeverDestroyed<AsynchronousBytecodeCacheWriter> writer;
+    static std::once_flag onceKey;
+    std::call_once(onceKey, [&] {
+        writer.construct();
+        hadAnyAsynchronousBytecodeCacheWrite = true;
+    });
+    return writer.get();
+}
+
+} // anonymous namespace
+
+void writeBytecodeCacheFileAsynchronously(const String& path, Vector<uint8_t>&& contents, FileSystem::PlatformFileHandle lockedFile)
+{
+    auto task = makeUnique<BytecodeCacheWriteTask>();
+    task->path = path.isolatedCopy();
+    task->contents = WTFMove(contents);
+    task->lockedFile = lockedFile;
+    asynchronousBytecodeCacheWriter().enqueue(WTFMove(task));
+}
+
+void waitForAsynchronousBytecodeCacheWrites()
+{
+    if (!hadAnyAsynchronousBytecodeCacheWrite)
+        return;
+
+    asynchronousBytecodeCacheWriter().waitUntilEmpty();
+}
+
+} // namespace JSC
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <wtf/FileSystem.h>
+#include <wtf/Forward.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+// Bytecode cache files are replaced as a whole: the new contents go to a temporary sibling
+// that is then renamed over the old file, so a concurrent reader maps either the old cache
+// or the new one, never a partial update. The asynchronous variant does the file system work
+// on a dedicated thread so that committing a cache does not stall the thread that ran the code.
+// Callers hold an exclusive lock on the old file while it is replaced; the asynchronous variant
+// takes over lockedFile and unlocks and closes it once the new file is in place.
+JS_EXPORT_PRIVATE bool writeBytecodeCacheFile(const String& path, const Vector<uint8_t>& contents);
+JS_EXPORT_PRIVATE void writeBytecodeCacheFileAsynchronously(const String& path, Vector<uint8_t>&& contents, FileSystem::PlatformFileHandle lockedFile);
+JS_EXPORT_PRIVATE void waitForAsynchronousBytecodeCacheWrites();
+
+} // namespace JSC
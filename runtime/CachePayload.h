@@ -43,6 +43,7 @@ public:
 
     const uint8_t* data() const { return m_data; }
     size_t size() const { return m_size; }
+    bool isMapped() const { return m_mapped; }
 
 private:
     CachePayload(bool mapped, void* data, size_t size)
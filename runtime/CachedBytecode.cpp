@@ -89,4 +89,17 @@ void CachedBytecode::commitUpdates(const ForEachUpdateCallback& callback) const
     ASSERT(static_cast<size_t>(offset) == m_size);
 }
 
+Vector<uint8_t> CachedBytecode::contentsWithUpdates() const
+{
+    Vector<uint8_t> contents;
+    contents.grow(m_size);
+    if (m_payload.size())
+        memcpy(contents.data(), m_payload.data(), m_payload.size());
+    commitUpdates([&] (off_t offset, const void* data, size_t size) {
+        RELEASE_ASSERT(static_cast<size_t>(offset) + size <= contents.size());
+        memcpy(contents.data() + offset, data, size);
+    });
+    return contents;
+}
+
 } // namespace JSC
@@ -63,9 +63,12 @@ public:
 
     using ForEachUpdateCallback = Function<void(off_t, const void*, size_t)>;
     JS_EXPORT_PRIVATE void commitUpdates(const ForEachUpdateCallback&) const;
+    // The whole cache file with every pending update applied, for writers that replace the file instead of patching it.
+    JS_EXPORT_PRIVATE Vector<uint8_t> contentsWithUpdates() const;
 
     const uint8_t* data() const { return m_payload.data(); }
     size_t size() const { return m_payload.size(); }
+    bool isMapped() const { return m_payload.isMapped(); }
     bool hasUpdates() const { return !m_updates.isEmpty(); }
     size_t sizeForUpdate() const { return m_size; }
 
@@ -35,6 +35,7 @@
 #include "ScopedArgumentsTable.h"
 #include "SourceCodeKey.h"
 #include "SourceProvider.h"
+#include "SourceProviderCache.h"
 #include "UnlinkedEvalCodeBlock.h"
 #include "UnlinkedFunctionCodeBlock.h"
 #include "UnlinkedMetadataTableInlines.h"
@@ -622,6 +623,9 @@ public:
             ::JSC::encode(encoder, buffer[i], vector[i]);
     }
 
+    unsigned size() const { return m_size; }
+    const T* data() const { return m_size ? this->template buffer<T>() : nullptr; }
+
     template<typename... Args>
     void decode(Decoder& decoder, Vector<SourceType<T>, InlineCapacity, OverflowHandler, 16, Malloc>& vector, Args... args) const
     {
@@ -1301,17 +1305,39 @@ public:
     {
         m_patternString.encode(encoder, regExp.m_patternString);
         m_flags = regExp.m_flags;
+        m_isValid = regExp.isValid();
+        m_numSubpatterns = regExp.m_numSubpatterns;
+        m_hasRareData = !!regExp.m_rareData;
+        if (m_hasRareData) {
+            m_captureGroupNames.encode(encoder, regExp.m_rareData->m_captureGroupNames);
+            m_namedGroupToParenIndex.encode(encoder, regExp.m_rareData->m_namedGroupToParenIndex);
+        }
     }
 
     RegExp* decode(Decoder& decoder) const
     {
         String pattern { m_patternString.decode(decoder) };
-        return RegExp::create(decoder.vm(), pattern, m_flags);
+        if (!m_isValid)
+            return RegExp::create(decoder.vm(), pattern, m_flags);
+
+        // The pattern was parsed when it was encoded, so only recreate what parsing produced.
+        std::unique_ptr<RegExp::RareData> rareData;
+        if (m_hasRareData) {
+            rareData = makeUnique<RegExp::RareData>();
+            m_captureGroupNames.decode(decoder, rareData->m_captureGroupNames);
+            m_namedGroupToParenIndex.decode(decoder, rareData->m_namedGroupToParenIndex);
+        }
+        return RegExp::createWithoutParsing(decoder.vm(), pattern, m_flags, m_numSubpatterns, WTFMove(rareData));
     }
 
 private:
     CachedString m_patternString;
     OptionSet<Yarr::Flags> m_flags;
+    bool m_isValid;
+    bool m_hasRareData;
+    unsigned m_numSubpatterns;
+    CachedVector<CachedString> m_captureGroupNames;
+    CachedHashMap<CachedString, unsigned> m_namedGroupToParenIndex;
 };
 
 class CachedTemplateObjectDescriptor : public CachedObject<TemplateObjectDescriptor> {
@@ -1474,11 +1500,22 @@ class CachedInstructionStream : public CachedObject<InstructionStream> {
 public:
     void encode(Encoder& encoder, const InstructionStream& stream)
     {
+        if (stream.m_mappedInstructions) {
+            InstructionStream::InstructionBuffer instructions;
+            instructions.append(stream.data(), stream.size());
+            m_instructions.encode(encoder, instructions);
+            return;
+        }
         m_instructions.encode(encoder, stream.m_instructions);
     }
 
     InstructionStream* decode(Decoder& decoder) const
     {
+        // Instructions are never written to after generation, so when the cache is a file mapping
+        // they can be used in place and shared with other processes through the page cache.
+        if (Options::useBytecodeCacheInstructionsInPlace() && decoder.cachedBytecode().isMapped() && m_instructions.size())
+            return new InstructionStream(makeRef(decoder.cachedBytecode()), m_instructions.data(), m_instructions.size());
+
         Vector<uint8_t, 0, UnsafeVectorOverflow, 16, InstructionStreamMalloc> instructionsVector;
         m_instructions.decode(decoder, instructionsVector);
         return new InstructionStream(WTFMove(instructionsVector));
@@ -1938,6 +1975,7 @@ public:
     SourceParseMode parseMode() const { return m_parseMode; }
     OptionSet<CodeGenerationMode> codeGenerationMode() const { return m_codeGenerationMode; }
     unsigned codeType() const { return m_codeType; }
+    unsigned didOptimize() const { return m_didOptimize; }
 
     UnlinkedCodeBlock::RareData* rareData(Decoder& decoder) const { return m_rareData.decode(decoder); }
 
@@ -1960,6 +1998,7 @@ private:
     unsigned m_hasTailCalls : 1;
     unsigned m_codeType : 2;
     unsigned m_hasCheckpoints : 1;
+    unsigned m_didOptimize : 2;
 
     CodeFeatures m_features;
     SourceParseMode m_parseMode;
@@ -2155,7 +2194,7 @@ ALWAYS_INLINE UnlinkedCodeBlock::UnlinkedCodeBlock(Decoder& decoder, Structure*
     , m_evalContextType(cachedCodeBlock.evalContextType())
     , m_codeType(cachedCodeBlock.codeType())
 
-    , m_didOptimize(static_cast<unsigned>(TriState::Indeterminate))
+    , m_didOptimize(Options::useBytecodeCacheTierUpHints() ? cachedCodeBlock.didOptimize() : static_cast<unsigned>(TriState::Indeterminate))
     , m_age(0)
     , m_hasCheckpoints(cachedCodeBlock.hasCheckpoints())
 
@@ -2348,6 +2387,9 @@ ALWAYS_INLINE void CachedCodeBlock<CodeBlockType>::encode(Encoder& encoder, cons
     m_codeGenerationMode = codeBlock.m_codeGenerationMode;
     m_codeType = codeBlock.m_codeType;
     m_hasCheckpoints = codeBlock.m_hasCheckpoints;
+    // Whether this code block got optimized in the process that wrote the cache. CodeBlock uses it
+    // to scale its tier-up thresholds, so a warm cache also skips some of the warm-up.
+    m_didOptimize = Options::useBytecodeCacheTierUpHints() ? codeBlock.m_didOptimize : static_cast<unsigned>(TriState::Indeterminate);
 
     m_metadata.encode(encoder, codeBlock.m_metadata.get());
     m_rareData.encode(encoder, codeBlock.m_rareData.get());
@@ -2395,11 +2437,125 @@ private:
     int m_functionConstructorParametersEndPosition;
 };
 
+class CachedSourceProviderCacheItem : public CachedObject<SourceProviderCacheItem> {
+public:
+    void encode(Encoder& encoder, int sourcePosition, const SourceProviderCacheItem& item)
+    {
+        m_sourcePosition = sourcePosition;
+        m_lastTokenLine = item.lastTokenLine;
+        m_lastTokenStartOffset = item.lastTokenStartOffset;
+        m_lastTokenEndOffset = item.lastTokenEndOffset;
+        m_lastTokenLineStartOffset = item.lastTokenLineStartOffset;
+        m_endFunctionOffset = item.endFunctionOffset;
+        m_parameterCount = item.parameterCount;
+        m_tokenType = item.tokenType;
+        m_innerArrowFunctionFeatures = item.innerArrowFunctionFeatures;
+        m_constructorKind = item.constructorKind;
+        m_expectedSuperBinding = item.expectedSuperBinding;
+        m_needsFullActivation = item.needsFullActivation;
+        m_usesEval = item.usesEval;
+        m_strictMode = item.strictMode;
+        m_needsSuperBinding = item.needsSuperBinding;
+        m_isBodyArrowExpression = item.isBodyArrowExpression;
+
+        Vector<RefPtr<UniquedStringImpl>> usedVariables(item.usedVariablesCount);
+        for (unsigned i = 0; i < item.usedVariablesCount; ++i)
+            usedVariables[i] = item.usedVariables()[i].get();
+        m_usedVariables.encode(encoder, usedVariables);
+    }
+
+    int sourcePosition() const { return m_sourcePosition; }
+
+    std::unique_ptr<SourceProviderCacheItem> decode(Decoder& decoder) const
+    {
+        Vector<RefPtr<UniquedStringImpl>> usedVariables;
+        m_usedVariables.decode(decoder, usedVariables);
+
+        SourceProviderCacheItemCreationParameters parameters;
+        parameters.lastTokenLine = m_lastTokenLine;
+        parameters.lastTokenStartOffset = m_lastTokenStartOffset;
+        parameters.lastTokenEndOffset = m_lastTokenEndOffset;
+        parameters.lastTokenLineStartOffset = m_lastTokenLineStartOffset;
+        parameters.endFunctionOffset = m_endFunctionOffset;
+        parameters.parameterCount = m_parameterCount;
+        parameters.needsFullActivation = m_needsFullActivation;
+        parameters.usesEval = m_usesEval;
+        parameters.strictMode = m_strictMode;
+        parameters.needsSuperBinding = m_needsSuperBinding;
+        parameters.innerArrowFunctionFeatures = static_cast<InnerArrowFunctionCodeFeatures>(m_innerArrowFunctionFeatures);
+        for (auto& variable : usedVariables)
+            parameters.usedVariables.append(variable.get());
+        parameters.isBodyArrowExpression = m_isBodyArrowExpression;
+        parameters.tokenType = static_cast<JSTokenType>(m_tokenType);
+        parameters.constructorKind = static_cast<ConstructorKind>(m_constructorKind);
+        parameters.expectedSuperBinding = static_cast<SuperBinding>(m_expectedSuperBinding);
+        // The item takes its own references, so usedVariables can go away afterwards.
+        return SourceProviderCacheItem::create(parameters);
+    }
+
+private:
+    int m_sourcePosition;
+    unsigned m_lastTokenLine;
+    unsigned m_lastTokenStartOffset;
+    unsigned m_lastTokenEndOffset;
+    unsigned m_lastTokenLineStartOffset;
+    unsigned m_endFunctionOffset;
+    unsigned m_parameterCount;
+    unsigned m_tokenType : 24;
+    unsigned m_innerArrowFunctionFeatures : 6;
+    unsigned m_constructorKind : 2;
+    unsigned m_expectedSuperBinding : 1;
+    unsigned m_needsFullActivation : 1;
+    unsigned m_usesEval : 1;
+    unsigned m_strictMode : 1;
+    unsigned m_needsSuperBinding : 1;
+    unsigned m_isBodyArrowExpression : 1;
+    CachedVector<CachedRefPtr<CachedUniquedStringImpl>> m_usedVariables;
+};
+
+// The function boundaries the parser recorded while pre-parsing this source, so that a later parse in
+// another process can skip lazy function bodies even where the cached bytecode does not cover them.
+class CachedSourceProviderCache : public VariableLengthObject<SourceProviderCache> {
+public:
+    void encode(Encoder& encoder, const SourceProviderCache& cache)
+    {
+        m_size = cache.size();
+        if (!m_size)
+            return;
+        CachedSourceProviderCacheItem* buffer = this->template allocate<CachedSourceProviderCacheItem>(encoder, m_size);
+        unsigned i = 0;
+        cache.forEach([&] (int sourcePosition, const SourceProviderCacheItem& item) {
+            buffer[i++].encode(encoder, sourcePosition, item);
+        });
+    }
+
+    void decode(Decoder& decoder, SourceProviderCache& cache) const
+    {
+        if (!m_size)
+            return;
+        const CachedSourceProviderCacheItem* buffer = this->template buffer<CachedSourceProviderCacheItem>();
+        for (unsigned i = 0; i < m_size; ++i) {
+            int sourcePosition = buffer[i].sourcePosition();
+            if (!cache.get(sourcePosition))
+                cache.add(sourcePosition, buffer[i].decode(decoder));
+        }
+    }
+
+private:
+    unsigned m_size { 0 };
+};
+
 class GenericCacheEntry {
 public:
     bool decode(Decoder&, std::pair<SourceCodeKey, UnlinkedCodeBlock*>&) const;
     bool isStillValid(Decoder&, const SourceCodeKey&, CachedCodeBlockTag) const;
 
+    void decodeSourceProviderCache(Decoder& decoder, SourceProvider& provider) const
+    {
+        if (Options::useBytecodeCachePreParseData())
+            m_sourceProviderCache.decode(decoder, *decoder.vm().addSourceProviderCache(&provider));
+    }
+
 protected:
     GenericCacheEntry(Encoder& encoder, CachedCodeBlockTag tag)
         : m_tag(tag)
@@ -2409,6 +2565,14 @@ protected:
 
     CachedCodeBlockTag tag() const { return m_tag; }
 
+    void encodeSourceProviderCache(Encoder& encoder, SourceProvider& provider)
+    {
+        if (!Options::useBytecodeCachePreParseData())
+            return;
+        if (SourceProviderCache* cache = encoder.vm().sourceProviderCacheMap.get(&provider))
+            m_sourceProviderCache.encode(encoder, *cache);
+    }
+
     bool isUpToDate(Decoder& decoder) const
     {
         if (m_cacheVersion != jscBytecodeCacheVersion())
@@ -2422,6 +2586,7 @@ private:
     uint32_t m_cacheVersion { jscBytecodeCacheVersion() };
     CachedString m_bootSessionUUID;
     CachedCodeBlockTag m_tag;
+    CachedSourceProviderCache m_sourceProviderCache;
 };
 
 static_assert(alignof(GenericCacheEntry) <= alignof(std::max_align_t));
@@ -2438,6 +2603,7 @@ public:
     {
         m_key.encode(encoder, pair.first);
         m_codeBlock.encode(encoder, pair.second);
+        encodeSourceProviderCache(encoder, pair.first.source().provider());
     }
 
 private:
@@ -2551,6 +2717,11 @@ UnlinkedCodeBlock* decodeCodeBlockImpl(VM& vm, const SourceCodeKey& key, Ref<Cac
             return nullptr;
     }
 
+    // Even when the entry was generated for a different kind of code, the pre-parse data still
+    // describes this text.
+    if (entry.first.hasSameSourceText(key))
+        cachedEntry->decodeSourceProviderCache(decoder.get(), key.source().provider());
+
     if (entry.first != key)
         return nullptr;
     return entry.second;
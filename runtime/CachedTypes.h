@@ -84,6 +84,7 @@ public:
     ~Decoder();
 
     VM& vm() { return m_vm; }
+    CachedBytecode& cachedBytecode() { return m_cachedBytecode.get(); }
     size_t size() const;
 
     ptrdiff_t offsetOf(const void*);
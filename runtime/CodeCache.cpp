@@ -31,6 +31,35 @@
 
 namespace JSC {
 
+template<typename Predicate>
+void CodeCacheMap::evictLeastRecentlyUsed(const Predicate& needsEviction)
+{
+    if (!needsEviction())
+        return;
+
+    Vector<std::pair<int64_t, SourceCodeKey>> entriesByAge;
+    entriesByAge.reserveInitialCapacity(m_map.size());
+    for (auto& entry : m_map)
+        entriesByAge.uncheckedAppend({ entry.value.age, entry.key });
+    std::sort(entriesByAge.begin(), entriesByAge.end(), [] (const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    for (auto& entry : entriesByAge) {
+        if (!needsEviction())
+            break;
+        MapType::iterator it = m_map.find(entry.second);
+        ASSERT(it != m_map.end());
+
+        writeCodeBlock(it->value.cell->vm(), it->key, it->value);
+
+        m_size -= it->key.length();
+        m_bytes -= it->value.cost;
+        m_map.remove(it);
+        m_statistics.evictions++;
+    }
+}
+
 void CodeCacheMap::pruneSlowCase()
 {
     m_minCapacity = std::max(m_size - m_sizeAtLastPrune, static_cast<int64_t>(0));
@@ -40,14 +69,40 @@ void CodeCacheMap::pruneSlowCase()
     if (m_capacity < m_minCapacity)
         m_capacity = m_minCapacity;
 
-    while (m_size > m_capacity || !canPruneQuickly()) {
-        MapType::iterator it = m_map.begin();
+    // Evict down to a little under the byte limit so that a cache sitting at the limit does not
+    // re-sort its entries on every insertion.
+    size_t maximumBytes = Options::codeCacheMaximumBytes();
+    size_t targetBytes = maximumBytes ? maximumBytes - maximumBytes / 8 : std::numeric_limits<size_t>::max();
+    auto needsEviction = [&] {
+        return m_size > m_capacity || !canPruneQuickly() || m_bytes > targetBytes;
+    };
+    evictLeastRecentlyUsed(needsEviction);
+}
 
-        writeCodeBlock(it->value.cell->vm(), it->key, it->value);
+void CodeCacheMap::shrinkToBytes(size_t targetBytes)
+{
+    evictLeastRecentlyUsed([&] {
+        return m_bytes > targetBytes;
+    });
+}
 
-        m_size -= it->key.length();
-        m_map.remove(it);
-    }
+auto CodeCacheMap::addCache(const SourceCodeKey& key, const SourceCodeValue& value) -> AddResult
+{
+    prune();
+
+    AddResult addResult = m_map.add(key, value);
+    ASSERT(addResult.isNewEntry);
+
+    // The cost model charges for the source text the key holds on to and for the cached cell with
+    // its instructions and metadata.
+    size_t cost = key.length() * (key.source().provider().source().is8Bit() ? sizeof(LChar) : sizeof(UChar));
+    cost += value.cell->estimatedSizeInBytes(value.cell->vm());
+    addResult.iterator->value.cost = cost;
+
+    m_size += key.length();
+    m_bytes += cost;
+    m_age += key.length();
+    return addResult;
 }
 
 static void generateUnlinkedCodeBlockForFunctions(VM& vm, UnlinkedCodeBlock* unlinkedCodeBlock, const SourceCode& parentSource, OptionSet<CodeGenerationMode> codeGenerationMode, ParserError& error)
@@ -159,8 +214,11 @@ UnlinkedCodeBlockType* CodeCache::getUnlinkedGlobalCodeBlock(VM& vm, ExecutableT
         source, String(), CacheTypes<UnlinkedCodeBlockType>::codeType, strictMode, scriptMode, 
         derivedContextType, evalContextType, isArrowFunctionContext, codeGenerationMode,
         WTF::nullopt);
-    UnlinkedCodeBlockType* unlinkedCodeBlock = m_sourceCode.findCacheAndUpdateAge<UnlinkedCodeBlockType>(vm, key);
-    if (unlinkedCodeBlock && Options::useCodeCache()) {
+    CodeCacheMap& map = mapFor(CacheTypes<UnlinkedCodeBlockType>::codeType);
+    UnlinkedCodeBlockType* unlinkedCodeBlock = map.findCacheAndUpdateAge<UnlinkedCodeBlockType>(vm, key);
+    bool hit = unlinkedCodeBlock && Options::useCodeCache();
+    count(countsFor(CacheTypes<UnlinkedCodeBlockType>::codeType), hit);
+    if (hit) {
         unsigned lineCount = unlinkedCodeBlock->lineCount();
         unsigned startColumn = unlinkedCodeBlock->startColumn() + source.startColumn().oneBasedInt();
         bool endColumnIsOnStartLine = !lineCount;
@@ -176,11 +234,16 @@ UnlinkedCodeBlockType* CodeCache::getUnlinkedGlobalCodeBlock(VM& vm, ExecutableT
     unlinkedCodeBlock = generateUnlinkedCodeBlock<UnlinkedCodeBlockType, ExecutableType>(vm, executable, source, strictMode, scriptMode, codeGenerationMode, error, evalContextType);
 
     if (unlinkedCodeBlock && Options::useCodeCache()) {
-        m_sourceCode.addCache(key, SourceCodeValue(vm, unlinkedCodeBlock, m_sourceCode.age()));
+        map.addCache(key, SourceCodeValue(vm, unlinkedCodeBlock, map.age()));
 
         key.source().provider().cacheBytecode([&] {
             return encodeCodeBlock(vm, key, unlinkedCodeBlock);
         });
+
+        if (!std::is_same<UnlinkedCodeBlockType, UnlinkedEvalCodeBlock>::value && Options::useSharedBytecodeRepository()) {
+            if (RefPtr<CachedBytecode> cachedBytecode = encodeCodeBlock(vm, key, unlinkedCodeBlock))
+                SharedBytecodeRepository::singleton().add(key, *cachedBytecode);
+        }
     }
 
     return unlinkedCodeBlock;
@@ -213,8 +276,10 @@ UnlinkedFunctionExecutable* CodeCache::getUnlinkedGlobalFunctionExecutable(VM& v
         isArrowFunctionContext,
         codeGenerationMode,
         functionConstructorParametersEndPosition);
-    UnlinkedFunctionExecutable* executable = m_sourceCode.findCacheAndUpdateAge<UnlinkedFunctionExecutable>(vm, key);
-    if (executable && Options::useCodeCache()) {
+    UnlinkedFunctionExecutable* executable = m_dynamicCode.findCacheAndUpdateAge<UnlinkedFunctionExecutable>(vm, key);
+    bool hit = executable && Options::useCodeCache();
+    count(m_pathStatistics.functionConstructor, hit);
+    if (hit) {
         if (!executable->sourceURLDirective().isNull())
             source.provider()->setSourceURLDirective(executable->sourceURLDirective());
         if (!executable->sourceMappingURLDirective().isNull())
@@ -256,10 +321,51 @@ UnlinkedFunctionExecutable* CodeCache::getUnlinkedGlobalFunctionExecutable(VM& v
         functionExecutable->setSourceMappingURLDirective(source.provider()->sourceMappingURLDirective());
 
     if (Options::useCodeCache())
-        m_sourceCode.addCache(key, SourceCodeValue(vm, functionExecutable, m_sourceCode.age()));
+        m_dynamicCode.addCache(key, SourceCodeValue(vm, functionExecutable, m_dynamicCode.age()));
     return functionExecutable;
 }
 
+CodeCacheMap& CodeCache::mapFor(SourceCodeType codeType)
+{
+    switch (codeType) {
+    case SourceCodeType::EvalType:
+    case SourceCodeType::FunctionType:
+        return m_dynamicCode;
+    case SourceCodeType::ProgramType:
+    case SourceCodeType::ModuleType:
+        return m_sourceCode;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+auto CodeCache::countsFor(SourceCodeType codeType) -> LookupCounts&
+{
+    switch (codeType) {
+    case SourceCodeType::EvalType:
+        return m_pathStatistics.indirectEval;
+    case SourceCodeType::FunctionType:
+        return m_pathStatistics.functionConstructor;
+    case SourceCodeType::ProgramType:
+        return m_pathStatistics.program;
+    case SourceCodeType::ModuleType:
+        return m_pathStatistics.module;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+CodeCacheMap::Statistics CodeCache::statistics() const
+{
+    CodeCacheMap::Statistics result = m_sourceCode.statistics();
+    CodeCacheMap::Statistics dynamicCode = m_dynamicCode.statistics();
+    result.hits += dynamicCode.hits;
+    result.diskHits += dynamicCode.diskHits;
+    result.misses += dynamicCode.misses;
+    result.evictions += dynamicCode.evictions;
+    result.entries += dynamicCode.entries;
+    result.bytes += dynamicCode.bytes;
+    return result;
+}
+
 void CodeCache::updateCache(const UnlinkedFunctionExecutable* executable, const SourceCode& parentSource, CodeSpecializationKind kind, const UnlinkedFunctionCodeBlock* codeBlock)
 {
     parentSource.provider()->updateCache(executable, parentSource, kind, codeBlock);
@@ -269,6 +375,8 @@ void CodeCache::write(VM& vm)
 {
     for (auto& it : m_sourceCode)
         writeCodeBlock(vm, it.key, it.value);
+    for (auto& it : m_dynamicCode)
+        writeCodeBlock(vm, it.key, it.value);
 }
 
 void writeCodeBlock(VM& vm, const SourceCodeKey& key, const SourceCodeValue& value)
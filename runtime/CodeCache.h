@@ -30,6 +30,7 @@
 #include "JSCInlines.h"
 #include "Parser.h"
 #include "ParserModes.h"
+#include "SharedBytecodeRepository.h"
 #include "SourceCodeKey.h"
 #include "Strong.h"
 #include "StrongInlines.h"
@@ -70,6 +71,7 @@ struct SourceCodeValue {
 
     Strong<JSCell> cell;
     int64_t age;
+    size_t cost { 0 };
 };
 
 class CodeCacheMap {
@@ -78,6 +80,15 @@ public:
     typedef MapType::iterator iterator;
     typedef MapType::AddResult AddResult;
 
+    struct Statistics {
+        uint64_t hits { 0 };
+        uint64_t diskHits { 0 };
+        uint64_t misses { 0 };
+        uint64_t evictions { 0 };
+        size_t entries { 0 };
+        size_t bytes { 0 };
+    };
+
     CodeCacheMap()
         : m_size(0)
         , m_sizeAtLastPrune(0)
@@ -97,8 +108,15 @@ public:
         prune();
 
         iterator findResult = m_map.find(key);
-        if (findResult == m_map.end())
-            return fetchFromDisk<UnlinkedCodeBlockType>(vm, key);
+        if (findResult == m_map.end()) {
+            UnlinkedCodeBlockType* result = fetchFromDisk<UnlinkedCodeBlockType>(vm, key);
+            if (result)
+                m_statistics.diskHits++;
+            else
+                m_statistics.misses++;
+            return result;
+        }
+        m_statistics.hits++;
 
         int64_t age = m_age - findResult->value.age;
         if (age > m_capacity) {
@@ -121,38 +139,44 @@ public:
         return jsCast<UnlinkedCodeBlockType*>(findResult->value.cell.get());
     }
 
-    AddResult addCache(const SourceCodeKey& key, const SourceCodeValue& value)
-    {
-        prune();
-
-        AddResult addResult = m_map.add(key, value);
-        ASSERT(addResult.isNewEntry);
+    AddResult addCache(const SourceCodeKey&, const SourceCodeValue&);
 
-        m_size += key.length();
-        m_age += key.length();
-        return addResult;
-    }
+    // Evicts least recently used entries, writing them to disk when there is a bytecode cache, until
+    // the entries cost no more than targetBytes.
+    void shrinkToBytes(size_t targetBytes);
 
     void remove(iterator it)
     {
         m_size -= it->key.length();
+        m_bytes -= it->value.cost;
         m_map.remove(it);
     }
 
     void clear()
     {
         m_size = 0;
+        m_bytes = 0;
         m_age = 0;
         m_map.clear();
     }
 
     int64_t age() { return m_age; }
 
+    Statistics statistics() const
+    {
+        Statistics result = m_statistics;
+        result.entries = numberOfEntries();
+        result.bytes = m_bytes;
+        return result;
+    }
+
 private:
     template<typename UnlinkedCodeBlockType>
     UnlinkedCodeBlockType* fetchFromDiskImpl(VM& vm, const SourceCodeKey& key)
     {
         RefPtr<CachedBytecode> cachedBytecode = key.source().provider().cachedBytecode();
+        if ((!cachedBytecode || !cachedBytecode->size()) && Options::useSharedBytecodeRepository())
+            cachedBytecode = SharedBytecodeRepository::singleton().find(key);
         if (!cachedBytecode || !cachedBytecode->size())
             return nullptr;
         return decodeCodeBlock<UnlinkedCodeBlockType>(vm, key, *cachedBytecode);
@@ -189,10 +213,18 @@ private:
 
     size_t numberOfEntries() const { return static_cast<size_t>(m_map.size()); }
     bool canPruneQuickly() const { return numberOfEntries() < workingSetMaxEntries; }
+    bool isOverByteLimit() const { return Options::codeCacheMaximumBytes() && m_bytes > Options::codeCacheMaximumBytes(); }
 
     void pruneSlowCase();
+    template<typename Predicate> void evictLeastRecentlyUsed(const Predicate& needsEviction);
     void prune()
     {
+        // The byte limit is a hard cap, so it is enforced without waiting for the working set to settle.
+        if (UNLIKELY(isOverByteLimit())) {
+            pruneSlowCase();
+            return;
+        }
+
         if (m_size <= m_capacity && canPruneQuickly())
             return;
 
@@ -211,6 +243,8 @@ private:
     int64_t m_minCapacity;
     int64_t m_capacity;
     int64_t m_age;
+    size_t m_bytes { 0 };
+    Statistics m_statistics;
 };
 
 // Caches top-level code such as <script>, window.eval(), new Function, and JSEvaluateScript().
@@ -224,14 +258,59 @@ public:
 
     void updateCache(const UnlinkedFunctionExecutable*, const SourceCode&, CodeSpecializationKind, const UnlinkedFunctionCodeBlock*);
 
-    void clear() { m_sourceCode.clear(); }
+    void clear()
+    {
+        m_sourceCode.clear();
+        m_dynamicCode.clear();
+    }
+
+    // Keeps the more recently used half of each map's bytes.
+    void shrinkByHalf()
+    {
+        m_sourceCode.shrinkToBytes(m_sourceCode.statistics().bytes / 2);
+        m_dynamicCode.shrinkToBytes(m_dynamicCode.statistics().bytes / 2);
+    }
     JS_EXPORT_PRIVATE void write(VM&);
 
+    JS_EXPORT_PRIVATE CodeCacheMap::Statistics statistics() const;
+
+    struct LookupCounts {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+    };
+
+    // Hit rates for each way source text reaches the compiler. Direct eval is cached per CodeBlock
+    // by DirectEvalCodeCache, which reports its lookups here so that all paths are counted in one place.
+    struct PathStatistics {
+        LookupCounts program;
+        LookupCounts module;
+        LookupCounts indirectEval;
+        LookupCounts functionConstructor;
+        LookupCounts directEval;
+    };
+    const PathStatistics& pathStatistics() const { return m_pathStatistics; }
+    void noteDirectEvalLookup(bool hit) { count(m_pathStatistics.directEval, hit); }
+
 private:
     template <class UnlinkedCodeBlockType, class ExecutableType> 
     UnlinkedCodeBlockType* getUnlinkedGlobalCodeBlock(VM&, ExecutableType*, const SourceCode&, JSParserStrictMode, JSParserScriptMode, OptionSet<CodeGenerationMode>, ParserError&, EvalContextType);
 
+    static void count(LookupCounts& counts, bool hit)
+    {
+        if (hit)
+            counts.hits++;
+        else
+            counts.misses++;
+    }
+
+    CodeCacheMap& mapFor(SourceCodeType);
+    LookupCounts& countsFor(SourceCodeType);
+
     CodeCacheMap m_sourceCode;
+    // new Function() bodies and indirect eval strings are small and tend to repeat across global objects.
+    // They get their own map so that large scripts and modules do not age them out.
+    CodeCacheMap m_dynamicCode;
+    PathStatistics m_pathStatistics;
 };
 
 template <typename T> struct CacheTypes { };
@@ -41,8 +41,10 @@
 #include "JSInternalPromise.h"
 #include "JSInternalPromiseConstructor.h"
 #include "JSLexicalEnvironment.h"
+#include "JSMapIterator.h"
 #include "JSPromiseConstructor.h"
 #include "JSPropertyNameEnumerator.h"
+#include "JSSetIterator.h"
 #include "JSWithScope.h"
 #include "LLIntCommon.h"
 #include "LLIntExceptions.h"
@@ -891,6 +893,27 @@ ALWAYS_INLINE SlowPathReturnType iteratorOpenTryFastImpl(CallFrame* callFrame, c
             return encodeResult(pc, reinterpret_cast<void*>(IterationMode::FastArray));
     }
 
+    // Map.prototype[Symbol.iterator] is entries() and Set.prototype[Symbol.iterator] is values(). While
+    // they and their iterators' next() are unmodified we create the iterator ourselves and iterator_next
+    // walks its buckets, so neither next() nor its result objects are ever materialized.
+    if (auto* map = jsDynamicCast<JSMap*>(vm, iterable)) {
+        if (globalObject->mapIteratorProtocolWatchpointSet().isStillValid() && symbolIterator == globalObject->mapProtoSymbolIteratorFunction()) {
+            metadata.m_iterationMetadata.seenModes = metadata.m_iterationMetadata.seenModes | IterationMode::FastMap;
+            GET(bytecode.m_next) = JSValue();
+            iterator = JSMapIterator::create(vm, globalObject->mapIteratorStructure(), map, IterationKind::Entries);
+            PROFILE_VALUE_IN(iterator.jsValue(), m_iteratorProfile);
+            return encodeResult(pc, reinterpret_cast<void*>(IterationMode::FastMap));
+        }
+    } else if (auto* set = jsDynamicCast<JSSet*>(vm, iterable)) {
+        if (globalObject->setIteratorProtocolWatchpointSet().isStillValid() && symbolIterator == globalObject->setProtoSymbolIteratorFunction()) {
+            metadata.m_iterationMetadata.seenModes = metadata.m_iterationMetadata.seenModes | IterationMode::FastSet;
+            GET(bytecode.m_next) = JSValue();
+            iterator = JSSetIterator::create(vm, globalObject->setIteratorStructure(), set, IterationKind::Values);
+            PROFILE_VALUE_IN(iterator.jsValue(), m_iteratorProfile);
+            return encodeResult(pc, reinterpret_cast<void*>(IterationMode::FastSet));
+        }
+    }
+
     // Return to the bytecode to try in generic mode.
     metadata.m_iterationMetadata.seenModes = metadata.m_iterationMetadata.seenModes | IterationMode::Generic;
     return encodeResult(pc, reinterpret_cast<void*>(IterationMode::Generic));
@@ -950,6 +973,22 @@ ALWAYS_INLINE SlowPathReturnType iteratorNextTryFastImpl(CallFrame* callFrame, c
             return encodeResult(pc, reinterpret_cast<void*>(IterationMode::FastArray));
         }
     }
+
+    auto fastMapOrSetNext = [&] (auto* iterator, IterationMode mode) {
+        metadata.m_iterationMetadata.seenModes = metadata.m_iterationMetadata.seenModes | mode;
+        JSValue value;
+        bool done = !iterator->next(globalObject, value);
+        CHECK_EXCEPTION();
+        GET(bytecode.m_done) = jsBoolean(done);
+        if (!done)
+            PROFILE_VALUE_IN(value, m_valueProfile);
+        GET(bytecode.m_value) = value;
+        return encodeResult(pc, reinterpret_cast<void*>(mode));
+    };
+    if (auto mapIterator = jsDynamicCast<JSMapIterator*>(vm, iterator))
+        return fastMapOrSetNext(mapIterator, IterationMode::FastMap);
+    if (auto setIterator = jsDynamicCast<JSSetIterator*>(vm, iterator))
+        return fastMapOrSetNext(setIterator, IterationMode::FastSet);
     RELEASE_ASSERT_NOT_REACHED();
 }
 
@@ -1470,12 +1509,9 @@ JSC_DEFINE_COMMON_SLOW_PATH(slow_path_new_array_with_spread)
         if (bitVector.get(i)) {
             // We are spreading.
             JSImmutableButterfly* array = jsCast<JSImmutableButterfly*>(value);
-            for (unsigned i = 0; i < array->publicLength(); i++) {
-                RELEASE_ASSERT(array->get(i));
-                result->putDirectIndex(globalObject, index, array->get(i));
-                CHECK_EXCEPTION();
-                ++index;
-            }
+            CommonSlowPaths::copySpreadIntoNewArray(globalObject, result, index, array);
+            CHECK_EXCEPTION();
+            index += array->publicLength();
         } else {
             // We are not spreading.
             result->putDirectIndex(globalObject, index, value);
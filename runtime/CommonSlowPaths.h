@@ -30,6 +30,7 @@
 #include "DirectArguments.h"
 #include "ExceptionHelpers.h"
 #include "FunctionCodeBlock.h"
+#include "GCMemoryOperations.h"
 #include "JSImmutableButterfly.h"
 #include "ScopedArguments.h"
 #include "SlowPathReturnType.h"
@@ -194,6 +195,27 @@ inline JSArray* allocateNewArrayBuffer(VM& vm, Structure* structure, JSImmutable
     return result;
 }
 
+// Copies a spread (the immutable butterfly made by op_spread / Spread) into result, starting at index.
+// result must already have the length of the whole new_array_with_spread. Spread items never contain
+// holes, so a contiguous result takes each one with a single copy instead of a put per element.
+inline void copySpreadIntoNewArray(JSGlobalObject* globalObject, JSArray* result, unsigned index, JSImmutableButterfly* spread)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    unsigned length = spread->publicLength();
+    if (hasContiguous(result->indexingType()) && hasContiguous(spread->indexingType())) {
+        ASSERT(index + length <= result->butterfly()->publicLength());
+        gcSafeMemcpy(result->butterfly()->contiguous().data() + index, spread->toButterfly()->contiguous().data(), sizeof(JSValue) * length);
+        vm.heap.writeBarrier(result);
+        return;
+    }
+    for (unsigned i = 0; i < length; i++) {
+        RELEASE_ASSERT(spread->get(i));
+        result->putDirectIndex(globalObject, index + i, spread->get(i));
+        RETURN_IF_EXCEPTION(scope, void());
+    }
+}
+
 } // namespace CommonSlowPaths
 
 class CallFrame;
@@ -66,6 +66,14 @@ void ControlFlowProfiler::dumpData() const
     }
 }
 
+void ControlFlowProfiler::resetExecutionCounts()
+{
+    for (const BlockLocationCache& cache : m_sourceIDBuckets.values()) {
+        for (BasicBlockLocation* block : cache.values())
+            block->resetExecutionCount();
+    }
+}
+
 Vector<BasicBlockRange> ControlFlowProfiler::getBasicBlocksForSourceID(intptr_t sourceID, VM& vm) const 
 {
     Vector<BasicBlockRange> result(0);
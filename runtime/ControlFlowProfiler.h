@@ -93,6 +93,7 @@ public:
     ~ControlFlowProfiler();
     BasicBlockLocation* getBasicBlockLocation(intptr_t sourceID, int startOffset, int endOffset);
     JS_EXPORT_PRIVATE void dumpData() const;
+    JS_EXPORT_PRIVATE void resetExecutionCounts();
     Vector<BasicBlockRange> getBasicBlocksForSourceID(intptr_t sourceID, VM&) const;
     BasicBlockLocation* dummyBasicBlock() { return &m_dummyBasicBlock; }
     JS_EXPORT_PRIVATE bool hasBasicBlockAtTextOffsetBeenExecuted(int, intptr_t, VM&);  // This function exists for testing.
@@ -30,6 +30,7 @@
 #include <wtf/GregorianDateTime.h>
 #include <wtf/HashFunctions.h>
 #include <wtf/RefCounted.h>
+#include <wtf/text/WTFString.h>
 
 namespace JSC {
 
@@ -88,4 +89,53 @@ private:
     std::array<CacheEntry, cacheSize> m_cache;
 };
 
+// Remembers the strings recently produced by Date.prototype.toString(), toISOString() and friends, so
+// that formatting the same time value again does not recompute its GregorianDateTime or rebuild the
+// string. The variant distinguishes the different output formats of the same time value.
+class DateStringCache {
+public:
+    DateStringCache()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        for (size_t i = 0; i < cacheSize; ++i) {
+            m_cache[i].key = PNaN;
+            m_cache[i].string = String();
+        }
+    }
+
+    String get(double d, uint8_t variant) const
+    {
+        const CacheEntry& entry = lookup(d, variant);
+        if (d == entry.key && variant == entry.variant)
+            return entry.string;
+        return String();
+    }
+
+    void set(double d, uint8_t variant, const String& string)
+    {
+        CacheEntry& entry = lookup(d, variant);
+        entry.key = d;
+        entry.variant = variant;
+        entry.string = string;
+    }
+
+private:
+    static const size_t cacheSize = 16;
+
+    struct CacheEntry {
+        double key;
+        uint8_t variant { 0 };
+        String string;
+    };
+
+    CacheEntry& lookup(double d, uint8_t variant) { return m_cache[(WTF::FloatHash<double>::hash(d) + variant) & (cacheSize - 1)]; }
+    const CacheEntry& lookup(double d, uint8_t variant) const { return const_cast<DateStringCache*>(this)->lookup(d, variant); }
+
+    std::array<CacheEntry, cacheSize> m_cache;
+};
+
 } // namespace JSC
@@ -86,6 +86,10 @@ static JSC_DECLARE_HOST_FUNCTION(dateProtoFuncToJSON);
 
 namespace JSC {
 
+// Variants distinguishing the strings that DateCache remembers for one time value.
+static constexpr uint8_t dateStringVariantUTC = 1 << 2;
+static constexpr uint8_t dateStringVariantISO = 1 << 3;
+
 static EncodedJSValue formateDateInstance(JSGlobalObject* globalObject, CallFrame* callFrame, DateTimeFormat format, bool asUTCVariant)
 {
     VM& vm = globalObject->vm();
@@ -98,13 +102,21 @@ static EncodedJSValue formateDateInstance(JSGlobalObject* globalObject, CallFram
         return throwVMTypeError(globalObject, scope);
 
     Integrity::auditStructureID(vm, thisDateObj->structureID());
+    double milliseconds = thisDateObj->internalNumber();
+    uint8_t variant = static_cast<uint8_t>(format) | (asUTCVariant ? dateStringVariantUTC : 0);
+    String cachedString = cache.cachedDateString(milliseconds, variant);
+    if (!cachedString.isNull())
+        return JSValue::encode(jsNontrivialString(vm, WTFMove(cachedString)));
+
     const GregorianDateTime* gregorianDateTime = asUTCVariant
         ? thisDateObj->gregorianDateTimeUTC(cache)
         : thisDateObj->gregorianDateTime(cache);
     if (!gregorianDateTime)
         return JSValue::encode(jsNontrivialString(vm, String("Invalid Date"_s)));
 
-    return JSValue::encode(jsNontrivialString(vm, formatDateTime(*gregorianDateTime, format, asUTCVariant)));
+    String string = formatDateTime(*gregorianDateTime, format, asUTCVariant);
+    cache.cacheDateString(milliseconds, variant, string);
+    return JSValue::encode(jsNontrivialString(vm, WTFMove(string)));
 }
 
 // Converts a list of arguments sent to a Date member function into milliseconds, updating
@@ -312,6 +324,10 @@ JSC_DEFINE_HOST_FUNCTION(dateProtoFuncToISOString, (JSGlobalObject* globalObject
     if (!std::isfinite(thisDateObj->internalNumber()))
         return throwVMError(globalObject, scope, createRangeError(globalObject, "Invalid Date"_s));
 
+    String cachedString = vm.dateCache.cachedDateString(thisDateObj->internalNumber(), dateStringVariantISO);
+    if (!cachedString.isNull())
+        return JSValue::encode(jsNontrivialString(vm, WTFMove(cachedString)));
+
     const GregorianDateTime* gregorianDateTime = thisDateObj->gregorianDateTimeUTC(vm.dateCache);
     if (!gregorianDateTime)
         return JSValue::encode(jsNontrivialString(vm, String("Invalid Date"_s)));
@@ -333,7 +349,9 @@ JSC_DEFINE_HOST_FUNCTION(dateProtoFuncToISOString, (JSGlobalObject* globalObject
     if (static_cast<unsigned>(charactersWritten) >= sizeof(buffer))
         return JSValue::encode(jsEmptyString(vm));
 
-    return JSValue::encode(jsNontrivialString(vm, String(buffer, charactersWritten)));
+    String string(buffer, charactersWritten);
+    vm.dateCache.cacheDateString(thisDateObj->internalNumber(), dateStringVariantISO, string);
+    return JSValue::encode(jsNontrivialString(vm, WTFMove(string)));
 }
 
 JSC_DEFINE_HOST_FUNCTION(dateProtoFuncToDateString, (JSGlobalObject* globalObject, CallFrame* callFrame))
@@ -97,6 +97,12 @@ void DeferredWorkTimer::doWork(VM& vm)
     while (!suspendedTasks.isEmpty())
         m_tasks.prepend(suspendedTasks.takeLast());
 
+    if (!m_nextTurnTasks.isEmpty()) {
+        while (!m_nextTurnTasks.isEmpty())
+            m_tasks.append(m_nextTurnTasks.takeFirst());
+        setTimeUntilFire(0_s);
+    }
+
     if (m_pendingTickets.isEmpty() && m_shouldStopRunLoopWhenAllTicketsFinish) {
         ASSERT(m_tasks.isEmpty());
         RunLoop::current().stop();
@@ -165,6 +171,18 @@ void DeferredWorkTimer::scheduleWorkSoon(Ticket ticket, Task&& task)
         setTimeUntilFire(0_s);
 }
 
+void DeferredWorkTimer::scheduleWorkForNextTurn(Ticket ticket, Task&& task)
+{
+    LockHolder locker(m_taskLock);
+    if (!m_currentlyRunningTask) {
+        m_tasks.append(std::make_tuple(ticket, WTFMove(task)));
+        if (!isScheduled())
+            setTimeUntilFire(0_s);
+        return;
+    }
+    m_nextTurnTasks.append(std::make_tuple(ticket, WTFMove(task)));
+}
+
 void DeferredWorkTimer::didResumeScriptExecutionOwner()
 {
     ASSERT(!m_currentlyRunningTask);
@@ -58,6 +58,8 @@ public:
     // by a GC'd value in dependencies or by the Task lambda.
     using Task = Function<void()>;
     void scheduleWorkSoon(Ticket, Task&&);
+    // Like scheduleWorkSoon, but a task scheduled from another task only runs once the run loop has had a turn.
+    void scheduleWorkForNextTurn(Ticket, Task&&);
     void didResumeScriptExecutionOwner();
 
     void stopRunningTasks() { m_runTasks = false; }
@@ -72,6 +74,7 @@ private:
     bool m_shouldStopRunLoopWhenAllTicketsFinish { false };
     bool m_currentlyRunningTask { false };
     Deque<std::tuple<Ticket, Task>> m_tasks;
+    Deque<std::tuple<Ticket, Task>> m_nextTurnTasks;
     struct TicketData {
         Vector<Strong<JSCell>> dependencies;
         Strong<JSObject> scriptExecutionOwner;
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "DictionaryFlatteningPolicy.h"
+
+#include "JSCInlines.h"
+
+namespace JSC {
+
+auto DictionaryFlatteningPolicy::observeFlattenedDictionary(Structure* structure) -> Action
+{
+    ASSERT(structure->isUncacheableDictionary());
+    ASSERT(structure->hasBeenFlattenedBefore());
+
+    if (structure->timesReflattened() >= Structure::s_maximumTimesReflattened)
+        return Action::GiveUp;
+
+    unsigned& count = m_accessCounts.add(structure, 0).iterator->value;
+    if (++count < Options::dictionaryReflatteningThreshold())
+        return Action::RetryLater;
+
+    m_accessCounts.remove(structure);
+    structure->setTimesReflattened(structure->timesReflattened() + 1);
+    return Action::Flatten;
+}
+
+} // namespace JSC
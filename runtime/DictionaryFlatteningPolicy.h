@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <wtf/HashMap.h>
+
+namespace JSC {
+
+class Structure;
+
+// Inline caches give up on an object whose uncacheable dictionary Structure was already
+// flattened once, since flattening objects that keep adding and deleting properties wastes
+// time. Objects like configuration records may pass through one short mutation phase and
+// then be read heavily. This policy lets those objects recover: inline caches keep
+// retrying on them, and once the same dictionary has been seen often enough between two
+// collections it is flattened again. Each object's Structure lineage can be re-flattened
+// only a few times.
+class DictionaryFlatteningPolicy {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    enum class Action : uint8_t {
+        GiveUp,
+        RetryLater,
+        Flatten,
+    };
+
+    // Called when an inline cache wants to cache an access on an uncacheable dictionary
+    // whose Structure has been flattened before.
+    Action observeFlattenedDictionary(Structure*);
+
+    // Structures may die and their cells be reused by a collection, so the counts are reset then.
+    void clear() { m_accessCounts.clear(); }
+
+private:
+    HashMap<Structure*, unsigned> m_accessCounts;
+};
+
+} // namespace JSC
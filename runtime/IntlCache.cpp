@@ -53,4 +53,71 @@ Vector<UChar, 32> IntlCache::getBestDateTimePattern(const CString& locale, const
     return patternBuffer;
 }
 
+IntlCache::UCollatorPtr IntlCache::cloneCollator(const UCollator* collator, UErrorCode& status)
+{
+#if U_ICU_VERSION_MAJOR_NUM >= 71
+    return UCollatorPtr(ucol_clone(collator, &status));
+#else
+    return UCollatorPtr(ucol_safeClone(collator, nullptr, nullptr, &status));
+#endif
+}
+
+IntlCache::UCollatorPtr IntlCache::copyCollator(const String& key, const ScopedLambda<UCollatorPtr(UErrorCode&)>& create, UErrorCode& status)
+{
+    if (auto* cached = m_collators.find(key))
+        return cloneCollator(cached->get(), status);
+
+    auto collator = create(status);
+    if (U_FAILURE(status))
+        return nullptr;
+    auto copy = cloneCollator(collator.get(), status);
+    if (U_FAILURE(status))
+        return nullptr;
+    m_collators.add(key, WTFMove(collator));
+    return copy;
+}
+
+IntlCache::UDateFormatPtr IntlCache::copyDateFormat(const String& key, const ScopedLambda<UDateFormatPtr(UErrorCode&)>& create, UErrorCode& status)
+{
+    if (auto* cached = m_dateFormats.find(key))
+        return UDateFormatPtr(udat_clone(cached->get(), &status));
+
+    auto dateFormat = create(status);
+    if (U_FAILURE(status))
+        return nullptr;
+    auto copy = UDateFormatPtr(udat_clone(dateFormat.get(), &status));
+    if (U_FAILURE(status))
+        return nullptr;
+    m_dateFormats.add(key, WTFMove(dateFormat));
+    return copy;
+}
+
+#if HAVE(ICU_U_NUMBER_FORMATTER)
+RefPtr<IntlSharedNumberFormatter> IntlCache::sharedNumberFormatter(const String& key, const ScopedLambda<UNumberFormatterPtr(UErrorCode&)>& create, UErrorCode& status)
+{
+    if (auto* cached = m_numberFormatters.find(key))
+        return *cached;
+
+    auto numberFormatter = create(status);
+    if (U_FAILURE(status))
+        return nullptr;
+    return m_numberFormatters.add(key, IntlSharedNumberFormatter::create(WTFMove(numberFormatter)));
+}
+#else
+IntlCache::UNumberFormatPtr IntlCache::copyNumberFormat(const String& key, const ScopedLambda<UNumberFormatPtr(UErrorCode&)>& create, UErrorCode& status)
+{
+    if (auto* cached = m_numberFormats.find(key))
+        return UNumberFormatPtr(unum_clone(cached->get(), &status));
+
+    auto numberFormat = create(status);
+    if (U_FAILURE(status))
+        return nullptr;
+    auto copy = UNumberFormatPtr(unum_clone(numberFormat.get(), &status));
+    if (U_FAILURE(status))
+        return nullptr;
+    m_numberFormats.add(key, WTFMove(numberFormat));
+    return copy;
+}
+#endif
+
 } // namespace JSC
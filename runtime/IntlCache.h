@@ -25,9 +25,16 @@
 
 #pragma once
 
+#include "IntlNumberFormat.h"
+#include <unicode/ucol.h>
+#include <unicode/udat.h>
 #include <unicode/udatpg.h>
+#include <unicode/unum.h>
 #include <wtf/Noncopyable.h>
+#include <wtf/ScopedLambda.h>
+#include <wtf/Vector.h>
 #include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
 #include <wtf/unicode/icu/ICUHelpers.h>
 
 namespace JSC {
@@ -40,6 +47,24 @@ public:
 
     Vector<UChar, 32> getBestDateTimePattern(const CString& locale, const UChar* skeleton, unsigned skeletonSize, UErrorCode&);
 
+    // Opening an ICU formatter or collator loads and parses locale data, which dominates the cost of
+    // toLocaleString() and friends. These keep the most recently used fully configured instances,
+    // keyed by a string that must capture the resolved locale and every option applied to the instance,
+    // and hand out clones since ICU does not allow these objects to be used concurrently.
+    using UCollatorPtr = std::unique_ptr<UCollator, ICUDeleter<ucol_close>>;
+    using UDateFormatPtr = std::unique_ptr<UDateFormat, ICUDeleter<udat_close>>;
+    UCollatorPtr copyCollator(const String& key, const ScopedLambda<UCollatorPtr(UErrorCode&)>& create, UErrorCode&);
+    UDateFormatPtr copyDateFormat(const String& key, const ScopedLambda<UDateFormatPtr(UErrorCode&)>& create, UErrorCode&);
+    static UCollatorPtr cloneCollator(const UCollator*, UErrorCode&);
+#if HAVE(ICU_U_NUMBER_FORMATTER)
+    // UNumberFormatter is immutable, so instances are shared rather than cloned.
+    using UNumberFormatterPtr = std::unique_ptr<UNumberFormatter, ICUDeleter<unumf_close>>;
+    RefPtr<IntlSharedNumberFormatter> sharedNumberFormatter(const String& key, const ScopedLambda<UNumberFormatterPtr(UErrorCode&)>& create, UErrorCode&);
+#else
+    using UNumberFormatPtr = std::unique_ptr<UNumberFormat, ICUDeleter<unum_close>>;
+    UNumberFormatPtr copyNumberFormat(const String& key, const ScopedLambda<UNumberFormatPtr(UErrorCode&)>& create, UErrorCode&);
+#endif
+
 private:
     UDateTimePatternGenerator* getSharedPatternGenerator(const CString& locale, UErrorCode& status)
     {
@@ -52,8 +77,54 @@ private:
 
     UDateTimePatternGenerator* cacheSharedPatternGenerator(const CString& locale, UErrorCode&);
 
+    // A handful of locale and option combinations cover almost every page, so a short list kept in
+    // most recently used order is both simpler and faster than hashing.
+    template<typename Value>
+    class LRUCache {
+    public:
+        static constexpr unsigned capacity = 16;
+
+        Value* find(const String& key)
+        {
+            for (unsigned i = 0; i < m_entries.size(); ++i) {
+                if (m_entries[i].key != key)
+                    continue;
+                if (i) {
+                    Entry entry = WTFMove(m_entries[i]);
+                    m_entries.remove(i);
+                    m_entries.insert(0, WTFMove(entry));
+                }
+                return &m_entries[0].value;
+            }
+            return nullptr;
+        }
+
+        Value& add(const String& key, Value&& value)
+        {
+            if (m_entries.size() == capacity)
+                m_entries.removeLast();
+            m_entries.insert(0, Entry { key, WTFMove(value) });
+            return m_entries[0].value;
+        }
+
+    private:
+        struct Entry {
+            String key;
+            Value value;
+        };
+        Vector<Entry, capacity> m_entries;
+    };
+
     std::unique_ptr<UDateTimePatternGenerator, ICUDeleter<udatpg_close>> m_cachedDateTimePatternGenerator;
     CString m_cachedDateTimePatternGeneratorLocale;
+
+    LRUCache<UCollatorPtr> m_collators;
+    LRUCache<UDateFormatPtr> m_dateFormats;
+#if HAVE(ICU_U_NUMBER_FORMATTER)
+    LRUCache<RefPtr<IntlSharedNumberFormatter>> m_numberFormatters;
+#else
+    LRUCache<UNumberFormatPtr> m_numberFormats;
+#endif
 };
 
 } // namespace JSC
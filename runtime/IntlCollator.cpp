@@ -28,11 +28,12 @@
 #include "config.h"
 #include "IntlCollator.h"
 
+#include "IntlCache.h"
 #include "IntlObjectInlines.h"
 #include "JSBoundFunction.h"
 #include "JSCInlines.h"
 #include "ObjectConstructor.h"
-#include <wtf/HexNumber.h>
+#include <unicode/ucoleitr.h>
 
 namespace JSC {
 
@@ -246,13 +247,6 @@ void IntlCollator::initializeCollator(JSGlobalObject* globalObject, JSValue loca
     }
     dataLogLnIf(IntlCollatorInternal::verbose, "locale:(", resolved.locale, "),dataLocaleWithExtensions:(", dataLocaleWithExtensions, ")");
 
-    UErrorCode status = U_ZERO_ERROR;
-    m_collator = std::unique_ptr<UCollator, UCollatorDeleter>(ucol_open(dataLocaleWithExtensions.data(), &status));
-    if (U_FAILURE(status)) {
-        throwTypeError(globalObject, scope, "failed to initialize Collator"_s);
-        return;
-    }
-
     UColAttributeValue strength = UCOL_PRIMARY;
     UColAttributeValue caseLevel = UCOL_OFF;
     UColAttributeValue caseFirst = UCOL_OFF;
@@ -280,20 +274,79 @@ void IntlCollator::initializeCollator(JSGlobalObject* globalObject, JSValue loca
         break;
     }
 
-    // Keep in sync with canDoASCIIUCADUCETComparisonSlow about used attributes.
-    ucol_setAttribute(m_collator.get(), UCOL_STRENGTH, strength, &status);
-    ucol_setAttribute(m_collator.get(), UCOL_CASE_LEVEL, caseLevel, &status);
-    ucol_setAttribute(m_collator.get(), UCOL_CASE_FIRST, caseFirst, &status);
-    ucol_setAttribute(m_collator.get(), UCOL_NUMERIC_COLLATION, m_numeric ? UCOL_ON : UCOL_OFF, &status);
+    UErrorCode status = U_ZERO_ERROR;
+    String cacheKey = makeString(dataLocaleWithExtensions.data(), '|', static_cast<int>(strength), '|', static_cast<int>(caseLevel), '|', static_cast<int>(caseFirst), '|', static_cast<unsigned>(m_numeric), '|', static_cast<unsigned>(m_ignorePunctuation));
+    m_collator = vm.intlCache().copyCollator(cacheKey, scopedLambda<IntlCache::UCollatorPtr(UErrorCode&)>([&] (UErrorCode& openStatus) {
+        auto collator = IntlCache::UCollatorPtr(ucol_open(dataLocaleWithExtensions.data(), &openStatus));
+        if (U_FAILURE(openStatus))
+            return collator;
+
+        // computeLatin1Weights reads these attributes back from the collator to decide whether per-character
+        // ranks can stand in for it. Keep it in sync when setting a new attribute here.
+        ucol_setAttribute(collator.get(), UCOL_STRENGTH, strength, &openStatus);
+        ucol_setAttribute(collator.get(), UCOL_CASE_LEVEL, caseLevel, &openStatus);
+        ucol_setAttribute(collator.get(), UCOL_CASE_FIRST, caseFirst, &openStatus);
+        ucol_setAttribute(collator.get(), UCOL_NUMERIC_COLLATION, m_numeric ? UCOL_ON : UCOL_OFF, &openStatus);
+
+        // FIXME: Setting UCOL_ALTERNATE_HANDLING to UCOL_SHIFTED causes punctuation and whitespace to be
+        // ignored. There is currently no way to ignore only punctuation.
+        ucol_setAttribute(collator.get(), UCOL_ALTERNATE_HANDLING, m_ignorePunctuation ? UCOL_SHIFTED : UCOL_DEFAULT, &openStatus);
+
+        // "The method is required to return 0 when comparing Strings that are considered canonically
+        // equivalent by the Unicode standard."
+        ucol_setAttribute(collator.get(), UCOL_NORMALIZATION_MODE, UCOL_ON, &openStatus);
+        ASSERT(U_SUCCESS(openStatus));
+        return collator;
+    }), status);
+    if (U_FAILURE(status)) {
+        throwTypeError(globalObject, scope, "failed to initialize Collator"_s);
+        return;
+    }
+}
 
-    // FIXME: Setting UCOL_ALTERNATE_HANDLING to UCOL_SHIFTED causes punctuation and whitespace to be
-    // ignored. There is currently no way to ignore only punctuation.
-    ucol_setAttribute(m_collator.get(), UCOL_ALTERNATE_HANDLING, m_ignorePunctuation ? UCOL_SHIFTED : UCOL_DEFAULT, &status);
+template<typename CharacterType>
+static bool hasLatin1Weights(const IntlCollator::Latin1Weights& weights, const CharacterType* characters, unsigned length)
+{
+    for (unsigned i = 0; i < length; ++i) {
+        auto character = characters[i];
+        if constexpr (sizeof(CharacterType) > 1) {
+            if (character > 0xff)
+                return false;
+        }
+        if (!weights.primary[character])
+            return false;
+    }
+    return true;
+}
 
-    // "The method is required to return 0 when comparing Strings that are considered canonically
-    // equivalent by the Unicode standard."
-    ucol_setAttribute(m_collator.get(), UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
-    ASSERT(U_SUCCESS(status));
+template<typename CharacterType1, typename CharacterType2>
+static Optional<UCollationResult> compareWithLatin1Weights(const IntlCollator::Latin1Weights& weights, const CharacterType1* characters1, unsigned length1, const CharacterType2* characters2, unsigned length2)
+{
+    if (!hasLatin1Weights(weights, characters1, length1) || !hasLatin1Weights(weights, characters2, length2))
+        return WTF::nullopt;
+
+    auto compareLevel = [&] (const std::array<uint16_t, 256>& ranks) {
+        unsigned commonLength = std::min(length1, length2);
+        for (unsigned position = 0; position < commonLength; ++position) {
+            uint16_t leftRank = ranks[characters1[position]];
+            uint16_t rightRank = ranks[characters2[position]];
+            if (leftRank != rightRank)
+                return leftRank > rightRank ? UCOL_GREATER : UCOL_LESS;
+        }
+        if (length1 == length2)
+            return UCOL_EQUAL;
+        return length1 > length2 ? UCOL_GREATER : UCOL_LESS;
+    };
+
+    // Every character here has a non-zero primary weight, so strings that tie on the primary level have
+    // the same length and the later levels line up character by character.
+    UCollationResult result = compareLevel(weights.primary);
+    if (result != UCOL_EQUAL)
+        return result;
+    result = compareLevel(weights.secondary);
+    if (result != UCOL_EQUAL)
+        return result;
+    return compareLevel(weights.tertiary);
 }
 
 // https://tc39.es/ecma402/#sec-collator-comparestrings
@@ -306,20 +359,22 @@ JSValue IntlCollator::compareStrings(JSGlobalObject* globalObject, StringView x,
 
     UErrorCode status = U_ZERO_ERROR;
     UCollationResult result = ([&]() -> UCollationResult {
-        if (x.isAllSpecialCharacters<canUseASCIIUCADUCETComparison>() && y.isAllSpecialCharacters<canUseASCIIUCADUCETComparison>()) {
-            if (canDoASCIIUCADUCETComparison()) {
-                if (x.is8Bit() && y.is8Bit())
-                    return compareASCIIWithUCADUCET(x.characters8(), x.length(), y.characters8(), y.length());
-                if (x.is8Bit())
-                    return compareASCIIWithUCADUCET(x.characters8(), x.length(), y.characters16(), y.length());
-                if (y.is8Bit())
-                    return compareASCIIWithUCADUCET(x.characters16(), x.length(), y.characters8(), y.length());
-                return compareASCIIWithUCADUCET(x.characters16(), x.length(), y.characters16(), y.length());
-            }
-
+        if (const Latin1Weights* weights = latin1Weights()) {
+            Optional<UCollationResult> fastResult;
             if (x.is8Bit() && y.is8Bit())
-                return ucol_strcollUTF8(m_collator.get(), bitwise_cast<const char*>(x.characters8()), x.length(), bitwise_cast<const char*>(y.characters8()), y.length(), &status);
+                fastResult = compareWithLatin1Weights(*weights, x.characters8(), x.length(), y.characters8(), y.length());
+            else if (x.is8Bit())
+                fastResult = compareWithLatin1Weights(*weights, x.characters8(), x.length(), y.characters16(), y.length());
+            else if (y.is8Bit())
+                fastResult = compareWithLatin1Weights(*weights, x.characters16(), x.length(), y.characters8(), y.length());
+            else
+                fastResult = compareWithLatin1Weights(*weights, x.characters16(), x.length(), y.characters16(), y.length());
+            if (fastResult)
+                return *fastResult;
         }
+
+        if (x.is8Bit() && y.is8Bit() && x.isAllASCII() && y.isAllASCII())
+            return ucol_strcollUTF8(m_collator.get(), bitwise_cast<const char*>(x.characters8()), x.length(), bitwise_cast<const char*>(y.characters8()), y.length(), &status);
         return ucol_strcoll(m_collator.get(), x.upconvertedCharacters(), x.length(), y.upconvertedCharacters(), y.length());
     }());
     if (U_FAILURE(status))
@@ -389,151 +444,135 @@ void IntlCollator::setBoundCompare(VM& vm, JSBoundFunction* format)
     m_boundCompare.set(vm, this, format);
 }
 
-static bool canDoASCIIUCADUCETComparisonWithUCollator(UCollator& collator)
-{
-    // Attributes are default ones unless we set. So, non-configured attributes are default ones.
-    static constexpr std::pair<UColAttribute, UColAttributeValue> attributes[] = {
-        { UCOL_FRENCH_COLLATION, UCOL_OFF },
-        { UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE },
-        { UCOL_STRENGTH, UCOL_TERTIARY },
-        { UCOL_CASE_LEVEL, UCOL_OFF },
-        { UCOL_CASE_FIRST, UCOL_OFF },
-        { UCOL_NUMERIC_COLLATION, UCOL_OFF },
-        // We do not check UCOL_NORMALIZATION_MODE status since FCD normalization does nothing for ASCII strings.
-    };
-
-    for (auto& pair : attributes) {
-        UErrorCode status = U_ZERO_ERROR;
-        auto result = ucol_getAttribute(&collator, pair.first, &status);
-        ASSERT(U_SUCCESS(status));
-        if (result != pair.second)
-            return false;
-    }
-
-    // Check existence of tailoring rules. If they do not exist, collation algorithm is UCA DUCET.
-    int32_t length = 0;
-    ucol_getRules(&collator, &length);
-    return !length;
-}
+// Computing the ranks costs a few thousand single character ICU comparisons, which only pays off for
+// collators that compare many strings, such as one passed to Array.prototype.sort.
+static constexpr unsigned comparisonsBeforeComputingLatin1Weights = 32;
 
-bool IntlCollator::updateCanDoASCIIUCADUCETComparison() const
+const IntlCollator::Latin1Weights* IntlCollator::latin1Weights() const
 {
-    // ICU uses the CLDR root collation order as a default starting point for ordering. (The CLDR root collation is based on the UCA DUCET.)
-    // And customizes this root collation via rules.
-    // The root collation is UCA DUCET and it is code-point comparison if the characters are all ASCII.
-    // http://www.unicode.org/reports/tr10/
-    ASSERT(m_collator);
-    auto checkASCIIUCADUCETComparisonCompatibility = [&] {
-        if (m_usage != Usage::Sort)
-            return false;
-        if (m_collation != "default"_s)
-            return false;
-        if (m_sensitivity != Sensitivity::Variant)
-            return false;
-        if (m_caseFirst != CaseFirst::False)
-            return false;
-        if (m_numeric)
-            return false;
-        if (m_ignorePunctuation)
-            return false;
-        return canDoASCIIUCADUCETComparisonWithUCollator(*m_collator);
-    };
-    bool result = checkASCIIUCADUCETComparisonCompatibility();
-    m_canDoASCIIUCADUCETComparison = triState(result);
-    return result;
+    if (m_latin1Weights)
+        return m_latin1Weights.get();
+    if (m_cannotUseLatin1Weights || ++m_comparisonsBeforeLatin1Weights < comparisonsBeforeComputingLatin1Weights)
+        return nullptr;
+    m_latin1Weights = computeLatin1Weights();
+    m_cannotUseLatin1Weights = !m_latin1Weights;
+    return m_latin1Weights.get();
 }
 
-#if ASSERT_ENABLED
-void IntlCollator::checkICULocaleInvariants(const HashSet<String>& locales)
+std::unique_ptr<IntlCollator::Latin1Weights> IntlCollator::computeLatin1Weights() const
 {
-    for (auto& locale : locales) {
-        auto checkASCIIOrderingWithDUCET = [](const String& locale, UCollator& collator) {
-            bool allAreGood = true;
-            for (unsigned x = 0; x < 128; ++x) {
-                for (unsigned y = 0; y < 128; ++y) {
-                    if (canUseASCIIUCADUCETComparison(x) && canUseASCIIUCADUCETComparison(y)) {
-                        UErrorCode status = U_ZERO_ERROR;
-                        UChar xstring[] = { static_cast<UChar>(x), 0 };
-                        UChar ystring[] = { static_cast<UChar>(y), 0 };
-                        auto resultICU = ucol_strcoll(&collator, xstring, 1, ystring, 1);
-                        ASSERT(U_SUCCESS(status));
-                        auto resultJSC = compareASCIIWithUCADUCET(xstring, 1, ystring, 1);
-                        if (resultICU != resultJSC) {
-                            dataLogLn("BAD ", locale, " ", makeString(hex(x)), "(", StringView(xstring, 1), ") <=> ", makeString(hex(y)), "(", StringView(ystring, 1), ") ICU:(", static_cast<int32_t>(resultICU), "),JSC:(", static_cast<int32_t>(resultJSC), ")");
-                            allAreGood = false;
-                        }
-                    }
-                }
-            }
-            return allAreGood;
-        };
+    ASSERT(m_collator);
 
+    auto attribute = [&] (UColAttribute attribute) {
         UErrorCode status = U_ZERO_ERROR;
-        auto collator = std::unique_ptr<UCollator, ICUDeleter<ucol_close>>(ucol_open(locale.ascii().data(), &status));
-
-        ASSERT(U_SUCCESS(status));
-        ucol_setAttribute(collator.get(), UCOL_STRENGTH, UCOL_TERTIARY, &status);
-        ASSERT(U_SUCCESS(status));
-        ucol_setAttribute(collator.get(), UCOL_CASE_LEVEL, UCOL_OFF, &status);
-        ASSERT(U_SUCCESS(status));
-        ucol_setAttribute(collator.get(), UCOL_CASE_FIRST, UCOL_OFF, &status);
-        ASSERT(U_SUCCESS(status));
-        ucol_setAttribute(collator.get(), UCOL_NUMERIC_COLLATION, UCOL_OFF, &status);
-        ASSERT(U_SUCCESS(status));
-        ucol_setAttribute(collator.get(), UCOL_ALTERNATE_HANDLING, UCOL_DEFAULT, &status);
-        ASSERT(U_SUCCESS(status));
-        ucol_setAttribute(collator.get(), UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+        auto result = ucol_getAttribute(m_collator.get(), attribute, &status);
         ASSERT(U_SUCCESS(status));
+        return result;
+    };
+
+    // Numeric collation turns runs of digits into one collation element, shifted punctuation is compared on
+    // the quaternary level, and French collation compares secondary weights backwards. Per character ranks
+    // cannot express any of these.
+    if (attribute(UCOL_NUMERIC_COLLATION) == UCOL_ON || attribute(UCOL_ALTERNATE_HANDLING) == UCOL_SHIFTED || attribute(UCOL_FRENCH_COLLATION) == UCOL_ON)
+        return nullptr;
+    UColAttributeValue strength = attribute(UCOL_STRENGTH);
+    if (strength != UCOL_PRIMARY && strength != UCOL_SECONDARY && strength != UCOL_TERTIARY)
+        return nullptr;
 
-        if (!canDoASCIIUCADUCETComparisonWithUCollator(*collator))
+    UErrorCode status = U_ZERO_ERROR;
+    auto contractions = std::unique_ptr<USet, ICUDeleter<uset_close>>(uset_openEmpty());
+    ucol_getContractionsAndExpansions(m_collator.get(), contractions.get(), nullptr, true, &status);
+    if (U_FAILURE(status))
+        return nullptr;
+
+    std::array<bool, 256> isInContraction { };
+    Vector<UChar, 32> buffer;
+    for (int32_t index = 0, count = uset_getItemCount(contractions.get()); index < count; ++index) {
+        // start and end are inclusive.
+        UChar32 start = 0;
+        UChar32 end = 0;
+        status = callBufferProducingFunction(uset_getItem, contractions.get(), index, &start, &end, buffer);
+        if (U_FAILURE(status))
+            return nullptr;
+        if (buffer.isEmpty()) {
+            for (UChar32 character = start; character <= std::min<UChar32>(end, 0xff); ++character)
+                isInContraction[character] = true;
             continue;
+        }
+        for (UChar character : buffer) {
+            if (character <= 0xff)
+                isInContraction[character] = true;
+        }
+    }
 
-        // This should not have reorder.
-        int32_t length = ucol_getReorderCodes(collator.get(), nullptr, 0, &status);
-        ASSERT(U_SUCCESS(status));
-        ASSERT(!length);
-
-        // Contractions and Expansions are defined as a rule. If there is no tailoring rule, then they should be UCA DUCET's default.
-
-        auto ensureNotIncludingASCII = [&](USet& set) {
-            Vector<UChar, 32> buffer;
-            for (int32_t index = 0, count = uset_getItemCount(&set); index < count; ++index) {
-                // start and end are inclusive.
-                UChar32 start = 0;
-                UChar32 end = 0;
-                auto status = callBufferProducingFunction(uset_getItem, &set, index, &start, &end, buffer);
-                ASSERT(U_SUCCESS(status));
-                if (buffer.isEmpty()) {
-                    if (isASCII(start)) {
-                        dataLogLn("BAD ", locale, " including ASCII tailored characters");
-                        CRASH();
-                    }
-                } else {
-                    if (StringView(buffer.data(), buffer.size()).isAllASCII()) {
-                        dataLogLn("BAD ", locale, " ", String(buffer.data(), buffer.size()), " including ASCII tailored characters");
-                        CRASH();
-                    }
-                }
-            }
-        };
+    // Characters that expand to several collation elements, or whose only element is ignorable, would shift
+    // the positions that the per-level comparison lines up, so they are left to ICU.
+    Vector<UChar, 256> characters;
+    for (unsigned character = 0; character <= 0xff; ++character) {
+        if (isInContraction[character])
+            continue;
+        UChar string[] = { static_cast<UChar>(character) };
+        auto elements = std::unique_ptr<UCollationElements, ICUDeleter<ucol_closeElements>>(ucol_openElements(m_collator.get(), string, 1, &status));
+        if (U_FAILURE(status))
+            return nullptr;
+        int32_t element = ucol_next(elements.get(), &status);
+        int32_t nextElement = ucol_next(elements.get(), &status);
+        if (U_FAILURE(status))
+            return nullptr;
+        if (element == UCOL_NULLORDER || !ucol_primaryOrder(element) || nextElement != UCOL_NULLORDER)
+            continue;
+        characters.append(character);
+    }
+    if (characters.isEmpty())
+        return nullptr;
+
+    auto configuredClone = [&] (UColAttributeValue strength) {
+        auto collator = IntlCache::cloneCollator(m_collator.get(), status);
+        if (U_FAILURE(status))
+            return collator;
+        ucol_setAttribute(collator.get(), UCOL_STRENGTH, strength, &status);
+        ucol_setAttribute(collator.get(), UCOL_CASE_LEVEL, UCOL_OFF, &status);
+        return collator;
+    };
 
-        auto contractions = std::unique_ptr<USet, ICUDeleter<uset_close>>(uset_openEmpty());
-        auto expansions = std::unique_ptr<USet, ICUDeleter<uset_close>>(uset_openEmpty());
-        ucol_getContractionsAndExpansions(collator.get(), contractions.get(), expansions.get(), true, &status);
-        ASSERT(U_SUCCESS(status));
+    auto weights = makeUnique<Latin1Weights>();
 
-        ensureNotIncludingASCII(*contractions);
-        ensureNotIncludingASCII(*expansions);
+    // For each level, order the characters with a collator that compares up to that level and hand out
+    // increasing ranks. Ranks only need to be meaningful between characters that tie on every earlier
+    // level, since those are the only ones a later level ever compares.
+    auto rankCharacters = [&] (const UCollator* collator, std::array<uint16_t, 256>& ranks) {
+        auto compare = [&] (UChar a, UChar b) {
+            return ucol_strcoll(collator, &a, 1, &b, 1);
+        };
+        std::sort(characters.begin(), characters.end(), [&] (UChar a, UChar b) {
+            return compare(a, b) == UCOL_LESS;
+        });
+        uint16_t rank = 0;
+        for (unsigned i = 0; i < characters.size(); ++i) {
+            if (!i || compare(characters[i - 1], characters[i]) != UCOL_EQUAL)
+                ++rank;
+            ranks[characters[i]] = rank;
+        }
+    };
 
-        // This locale should not have tailoring.
-        auto tailored = std::unique_ptr<USet, ICUDeleter<uset_close>>(ucol_getTailoredSet(collator.get(), &status));
-        ensureNotIncludingASCII(*tailored);
+    auto primaryCollator = configuredClone(UCOL_PRIMARY);
+    if (U_FAILURE(status))
+        return nullptr;
+    rankCharacters(primaryCollator.get(), weights->primary);
+
+    if (strength != UCOL_PRIMARY) {
+        auto secondaryCollator = configuredClone(UCOL_SECONDARY);
+        if (U_FAILURE(status))
+            return nullptr;
+        rankCharacters(secondaryCollator.get(), weights->secondary);
+    }
 
-        dataLogLnIf(IntlCollatorInternal::verbose, "LOCALE ", locale);
+    // The configured collator itself orders characters that tie on the earlier levels by the one level it
+    // still compares, the case level for sensitivity "case" and the tertiary level for "variant".
+    rankCharacters(m_collator.get(), weights->tertiary);
 
-        ASSERT(checkASCIIOrderingWithDUCET(locale, *collator));
-    }
+    dataLogLnIf(IntlCollatorInternal::verbose, "locale:(", m_locale, ") ", characters.size(), " Latin-1 characters use precomputed weights");
+    return weights;
 }
-#endif
 
 } // namespace JSC
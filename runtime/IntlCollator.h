@@ -26,6 +26,7 @@
 #pragma once
 
 #include "JSObject.h"
+#include <array>
 #include <unicode/ucol.h>
 #include <wtf/unicode/icu/ICUHelpers.h>
 
@@ -64,25 +65,25 @@ public:
     JSBoundFunction* boundCompare() const { return m_boundCompare.get(); }
     void setBoundCompare(VM&, JSBoundFunction*);
 
-    bool canDoASCIIUCADUCETComparison() const
-    {
-        if (m_canDoASCIIUCADUCETComparison == TriState::Indeterminate)
-            updateCanDoASCIIUCADUCETComparison();
-        return m_canDoASCIIUCADUCETComparison == TriState::True;
-    }
-
-#if ASSERT_ENABLED
-    static void checkICULocaleInvariants(const HashSet<String>&);
-#else
-    static inline void checkICULocaleInvariants(const HashSet<String>&) { }
-#endif
+    // Per-level ranks of the Latin-1 characters that this collator maps to exactly one collation
+    // element, outside of any contraction. Comparing strings made only of such characters level by
+    // level over these ranks gives the same answer as ICU. A zero primary rank means the character
+    // has to go through ICU. The last level is whichever of the case level or the tertiary level the
+    // collator's sensitivity compares.
+    struct Latin1Weights {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        std::array<uint16_t, 256> primary { };
+        std::array<uint16_t, 256> secondary { };
+        std::array<uint16_t, 256> tertiary { };
+    };
 
 private:
     IntlCollator(VM&, Structure*);
     void finishCreation(VM&);
     static void visitChildren(JSCell*, SlotVisitor&);
 
-    bool updateCanDoASCIIUCADUCETComparison() const;
+    const Latin1Weights* latin1Weights() const;
+    std::unique_ptr<Latin1Weights> computeLatin1Weights() const;
 
     static Vector<String> sortLocaleData(const String&, RelevantExtensionKey);
     static Vector<String> searchLocaleData(const String&, RelevantExtensionKey);
@@ -105,7 +106,9 @@ private:
     Usage m_usage;
     Sensitivity m_sensitivity;
     CaseFirst m_caseFirst;
-    mutable TriState m_canDoASCIIUCADUCETComparison { TriState::Indeterminate };
+    mutable std::unique_ptr<Latin1Weights> m_latin1Weights;
+    mutable unsigned m_comparisonsBeforeLatin1Weights { 0 };
+    mutable bool m_cannotUseLatin1Weights { false };
     bool m_numeric;
     bool m_ignorePunctuation;
 };
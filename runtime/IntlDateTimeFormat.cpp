@@ -842,7 +842,10 @@ void IntlDateTimeFormat::initializeDateTimeFormat(JSGlobalObject* globalObject,
         // After updating this pattern string with hourCycle, we create a final UDateFormat with the updated pattern string.
         UErrorCode status = U_ZERO_ERROR;
         StringView timeZoneView(m_timeZone);
-        auto dateFormatFromStyle = std::unique_ptr<UDateFormat, UDateFormatDeleter>(udat_open(parseUDateFormatStyle(m_timeStyle), parseUDateFormatStyle(m_dateStyle), dataLocaleWithExtensions.data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), nullptr, -1, &status));
+        String styleCacheKey = makeString("style|", dataLocaleWithExtensions.data(), '|', m_timeZone, '|', static_cast<int>(parseUDateFormatStyle(m_timeStyle)), '|', static_cast<int>(parseUDateFormatStyle(m_dateStyle)));
+        auto dateFormatFromStyle = vm.intlCache().copyDateFormat(styleCacheKey, scopedLambda<IntlCache::UDateFormatPtr(UErrorCode&)>([&] (UErrorCode& openStatus) {
+            return IntlCache::UDateFormatPtr(udat_open(parseUDateFormatStyle(m_timeStyle), parseUDateFormatStyle(m_dateStyle), dataLocaleWithExtensions.data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), nullptr, -1, &openStatus));
+        }), status);
         if (U_FAILURE(status)) {
             throwTypeError(globalObject, scope, "failed to initialize DateTimeFormat"_s);
             return;
@@ -913,16 +916,23 @@ void IntlDateTimeFormat::initializeDateTimeFormat(JSGlobalObject* globalObject,
 
     UErrorCode status = U_ZERO_ERROR;
     StringView timeZoneView(m_timeZone);
-    m_dateFormat = std::unique_ptr<UDateFormat, UDateFormatDeleter>(udat_open(UDAT_PATTERN, UDAT_PATTERN, dataLocaleWithExtensions.data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), pattern.upconvertedCharacters(), pattern.length(), &status));
+    String cacheKey = makeString("pattern|", dataLocaleWithExtensions.data(), '|', m_timeZone, '|', pattern);
+    m_dateFormat = vm.intlCache().copyDateFormat(cacheKey, scopedLambda<IntlCache::UDateFormatPtr(UErrorCode&)>([&] (UErrorCode& openStatus) {
+        auto dateFormat = IntlCache::UDateFormatPtr(udat_open(UDAT_PATTERN, UDAT_PATTERN, dataLocaleWithExtensions.data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), pattern.upconvertedCharacters(), pattern.length(), &openStatus));
+        if (U_FAILURE(openStatus))
+            return dateFormat;
+
+        // Gregorian calendar should be used from the beginning of ECMAScript time.
+        // Failure here means unsupported calendar, and can safely be ignored.
+        UErrorCode calendarStatus = U_ZERO_ERROR;
+        UCalendar* cal = const_cast<UCalendar*>(udat_getCalendar(dateFormat.get()));
+        ucal_setGregorianChange(cal, minECMAScriptTime, &calendarStatus);
+        return dateFormat;
+    }), status);
     if (U_FAILURE(status)) {
         throwTypeError(globalObject, scope, "failed to initialize DateTimeFormat"_s);
         return;
     }
-
-    // Gregorian calendar should be used from the beginning of ECMAScript time.
-    // Failure here means unsupported calendar, and can safely be ignored.
-    UCalendar* cal = const_cast<UCalendar*>(udat_getCalendar(m_dateFormat.get()));
-    ucal_setGregorianChange(cal, minECMAScriptTime, &status);
 }
 
 ASCIILiteral IntlDateTimeFormat::hourCycleString(HourCycle hourCycle)
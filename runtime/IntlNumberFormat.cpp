@@ -30,6 +30,7 @@
 #include "IntlNumberFormat.h"
 
 #include "Error.h"
+#include "IntlCache.h"
 #include "IntlNumberFormatInlines.h"
 #include "IntlObjectInlines.h"
 #include "JSBoundFunction.h"
@@ -527,7 +528,10 @@ void IntlNumberFormat::initializeNumberFormat(JSGlobalObject* globalObject, JSVa
     dataLogLnIf(IntlNumberFormatInternal::verbose, skeleton);
     StringView skeletonView(skeleton);
     UErrorCode status = U_ZERO_ERROR;
-    m_numberFormatter = std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter>(unumf_openForSkeletonAndLocale(skeletonView.upconvertedCharacters().get(), skeletonView.length(), dataLocaleWithExtensions.data(), &status));
+    String cacheKey = makeString(dataLocaleWithExtensions.data(), '|', skeleton);
+    m_numberFormatter = vm.intlCache().sharedNumberFormatter(cacheKey, scopedLambda<IntlCache::UNumberFormatterPtr(UErrorCode&)>([&] (UErrorCode& openStatus) {
+        return IntlCache::UNumberFormatterPtr(unumf_openForSkeletonAndLocale(skeletonView.upconvertedCharacters().get(), skeletonView.length(), dataLocaleWithExtensions.data(), &openStatus));
+    }), status);
     if (U_FAILURE(status)) {
         throwTypeError(globalObject, scope, "Failed to initialize NumberFormat"_s);
         return;
@@ -589,38 +593,48 @@ void IntlNumberFormat::initializeNumberFormat(JSGlobalObject* globalObject, JSVa
         return;
     }
 
-    UErrorCode status = U_ZERO_ERROR;
-    m_numberFormat = std::unique_ptr<UNumberFormat, UNumberFormatDeleter>(unum_open(style, nullptr, 0, dataLocaleWithExtensions.data(), nullptr, &status));
-    if (U_FAILURE(status)) {
-        throwTypeError(globalObject, scope, "failed to initialize NumberFormat"_s);
+    if (m_roundingType == IntlRoundingType::CompactRounding) {
+        throwTypeError(globalObject, scope, "Failed to initialize NumberFormat since used feature is not supported in the linked ICU version"_s);
         return;
     }
 
-    if (m_style == Style::Currency) {
-        unum_setTextAttribute(m_numberFormat.get(), UNUM_CURRENCY_CODE, StringView(m_currency).upconvertedCharacters(), m_currency.length(), &status);
-        if (U_FAILURE(status)) {
-            throwTypeError(globalObject, scope, "failed to initialize NumberFormat"_s);
-            return;
+    UErrorCode status = U_ZERO_ERROR;
+    String cacheKey = makeString(dataLocaleWithExtensions.data(), '|', static_cast<unsigned>(style), '|', m_currency, '|', static_cast<unsigned>(m_roundingType), '|',
+        m_minimumIntegerDigits, '|', m_minimumFractionDigits, '|', m_maximumFractionDigits, '|', m_minimumSignificantDigits, '|', m_maximumSignificantDigits, '|', static_cast<unsigned>(m_useGrouping));
+    m_numberFormat = vm.intlCache().copyNumberFormat(cacheKey, scopedLambda<IntlCache::UNumberFormatPtr(UErrorCode&)>([&] (UErrorCode& openStatus) {
+        auto numberFormat = IntlCache::UNumberFormatPtr(unum_open(style, nullptr, 0, dataLocaleWithExtensions.data(), nullptr, &openStatus));
+        if (U_FAILURE(openStatus))
+            return numberFormat;
+
+        if (m_style == Style::Currency) {
+            unum_setTextAttribute(numberFormat.get(), UNUM_CURRENCY_CODE, StringView(m_currency).upconvertedCharacters(), m_currency.length(), &openStatus);
+            if (U_FAILURE(openStatus))
+                return numberFormat;
         }
-    }
 
-    switch (m_roundingType) {
-    case IntlRoundingType::FractionDigits:
-        unum_setAttribute(m_numberFormat.get(), UNUM_MIN_INTEGER_DIGITS, m_minimumIntegerDigits);
-        unum_setAttribute(m_numberFormat.get(), UNUM_MIN_FRACTION_DIGITS, m_minimumFractionDigits);
-        unum_setAttribute(m_numberFormat.get(), UNUM_MAX_FRACTION_DIGITS, m_maximumFractionDigits);
-        break;
-    case IntlRoundingType::SignificantDigits:
-        unum_setAttribute(m_numberFormat.get(), UNUM_SIGNIFICANT_DIGITS_USED, true);
-        unum_setAttribute(m_numberFormat.get(), UNUM_MIN_SIGNIFICANT_DIGITS, m_minimumSignificantDigits);
-        unum_setAttribute(m_numberFormat.get(), UNUM_MAX_SIGNIFICANT_DIGITS, m_maximumSignificantDigits);
-        break;
-    case IntlRoundingType::CompactRounding:
-        throwTypeError(globalObject, scope, "Failed to initialize NumberFormat since used feature is not supported in the linked ICU version"_s);
+        switch (m_roundingType) {
+        case IntlRoundingType::FractionDigits:
+            unum_setAttribute(numberFormat.get(), UNUM_MIN_INTEGER_DIGITS, m_minimumIntegerDigits);
+            unum_setAttribute(numberFormat.get(), UNUM_MIN_FRACTION_DIGITS, m_minimumFractionDigits);
+            unum_setAttribute(numberFormat.get(), UNUM_MAX_FRACTION_DIGITS, m_maximumFractionDigits);
+            break;
+        case IntlRoundingType::SignificantDigits:
+            unum_setAttribute(numberFormat.get(), UNUM_SIGNIFICANT_DIGITS_USED, true);
+            unum_setAttribute(numberFormat.get(), UNUM_MIN_SIGNIFICANT_DIGITS, m_minimumSignificantDigits);
+            unum_setAttribute(numberFormat.get(), UNUM_MAX_SIGNIFICANT_DIGITS, m_maximumSignificantDigits);
+            break;
+        case IntlRoundingType::CompactRounding:
+            RELEASE_ASSERT_NOT_REACHED();
+            break;
+        }
+        unum_setAttribute(numberFormat.get(), UNUM_GROUPING_USED, m_useGrouping);
+        unum_setAttribute(numberFormat.get(), UNUM_ROUNDING_MODE, UNUM_ROUND_HALFUP);
+        return numberFormat;
+    }), status);
+    if (U_FAILURE(status)) {
+        throwTypeError(globalObject, scope, "failed to initialize NumberFormat"_s);
         return;
     }
-    unum_setAttribute(m_numberFormat.get(), UNUM_GROUPING_USED, m_useGrouping);
-    unum_setAttribute(m_numberFormat.get(), UNUM_ROUNDING_MODE, UNUM_ROUND_HALFUP);
 #endif
 }
 
@@ -637,7 +651,7 @@ JSValue IntlNumberFormat::format(JSGlobalObject* globalObject, double value) con
     auto formattedNumber = std::unique_ptr<UFormattedNumber, UFormattedNumberDeleter>(unumf_openResult(&status));
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "Failed to format a number."_s);
-    unumf_formatDouble(m_numberFormatter.get(), value, formattedNumber.get(), &status);
+    unumf_formatDouble(m_numberFormatter->get(), value, formattedNumber.get(), &status);
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "Failed to format a number."_s);
     status = callBufferProducingFunction(unumf_resultToString, formattedNumber.get(), buffer);
@@ -671,7 +685,7 @@ JSValue IntlNumberFormat::format(JSGlobalObject* globalObject, JSBigInt* value)
     auto formattedNumber = std::unique_ptr<UFormattedNumber, UFormattedNumberDeleter>(unumf_openResult(&status));
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "Failed to format a BigInt."_s);
-    unumf_formatDecimal(m_numberFormatter.get(), rawString, string.length(), formattedNumber.get(), &status);
+    unumf_formatDecimal(m_numberFormatter->get(), rawString, string.length(), formattedNumber.get(), &status);
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "Failed to format a BigInt."_s);
     status = callBufferProducingFunction(unumf_resultToString, formattedNumber.get(), buffer);
@@ -953,7 +967,7 @@ JSValue IntlNumberFormat::formatToParts(JSGlobalObject* globalObject, double val
     auto formattedNumber = std::unique_ptr<UFormattedNumber, UFormattedNumberDeleter>(unumf_openResult(&status));
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "Failed to format a number."_s);
-    unumf_formatDouble(m_numberFormatter.get(), value, formattedNumber.get(), &status);
+    unumf_formatDouble(m_numberFormatter->get(), value, formattedNumber.get(), &status);
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "Failed to format a number."_s);
     status = callBufferProducingFunction(unumf_resultToString, formattedNumber.get(), result);
@@ -39,6 +39,7 @@
 
 #if HAVE(ICU_U_NUMBER_FORMATTER)
 #include <unicode/unumberformatter.h>
+#include <wtf/ThreadSafeRefCounted.h>
 #endif
 
 namespace JSC {
@@ -51,6 +52,30 @@ enum class IntlRoundingType : uint8_t { FractionDigits, SignificantDigits, Compa
 enum class IntlNotation : uint8_t { Standard, Scientific, Engineering, Compact };
 template<typename IntlType> void setNumberFormatDigitOptions(JSGlobalObject*, IntlType*, JSObject*, unsigned minimumFractionDigitsDefault, unsigned maximumFractionDigitsDefault, IntlNotation);
 
+#if HAVE(ICU_U_NUMBER_FORMATTER)
+// UNumberFormatter never changes once created, so every NumberFormat that resolves to the same
+// skeleton and locale can format through one instance handed out by IntlCache.
+class IntlSharedNumberFormatter : public ThreadSafeRefCounted<IntlSharedNumberFormatter> {
+public:
+    using UNumberFormatterDeleter = ICUDeleter<unumf_close>;
+
+    static Ref<IntlSharedNumberFormatter> create(std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter>&& numberFormatter)
+    {
+        return adoptRef(*new IntlSharedNumberFormatter(WTFMove(numberFormatter)));
+    }
+
+    const UNumberFormatter* get() const { return m_numberFormatter.get(); }
+
+private:
+    IntlSharedNumberFormatter(std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter>&& numberFormatter)
+        : m_numberFormatter(WTFMove(numberFormatter))
+    {
+    }
+
+    std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter> m_numberFormatter;
+};
+#endif
+
 class IntlNumberFormat final : public JSNonFinalObject {
 public:
     using Base = JSNonFinalObject;
@@ -115,9 +140,8 @@ private:
 
     WriteBarrier<JSBoundFunction> m_boundFormat;
 #if HAVE(ICU_U_NUMBER_FORMATTER)
-    using UNumberFormatterDeleter = ICUDeleter<unumf_close>;
     using UFormattedNumberDeleter = ICUDeleter<unumf_closeResult>;
-    std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter> m_numberFormatter;
+    RefPtr<IntlSharedNumberFormatter> m_numberFormatter;
 #else
     using UNumberFormatDeleter = ICUDeleter<unum_close>;
     std::unique_ptr<UNumberFormat, ICUDeleter<unum_close>> m_numberFormat;
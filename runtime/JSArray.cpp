@@ -759,6 +759,30 @@ JSArray* JSArray::fastSlice(JSGlobalObject* globalObject, unsigned startIndex, u
         ASSERT(resultButterfly.publicLength() == count);
         return resultArray;
     }
+    case ArrayWithArrayStorage: {
+        // Arrays that shift() moved to ArrayStorage keep their values in the vector, so they slice
+        // like contiguous arrays. Holes are copied as holes, which is what slice and splice produce
+        // when holes do not forward to the prototype.
+        ArrayStorage* storage = arrayStorage();
+        unsigned vectorLength = storage->vectorLength();
+        if (count >= MIN_SPARSE_ARRAY_INDEX || storage->m_sparseMap || count > vectorLength || startIndex > vectorLength - count)
+            return nullptr;
+        if (structure(vm)->holesMustForwardToPrototype(vm, this))
+            return nullptr;
+
+        Structure* resultStructure = globalObject->arrayStructureForIndexingTypeDuringAllocation(ArrayWithContiguous);
+        if (UNLIKELY(hasAnyArrayStorage(resultStructure->indexingType())))
+            return nullptr;
+
+        ObjectInitializationScope scope(vm);
+        JSArray* resultArray = JSArray::tryCreateUninitializedRestricted(scope, resultStructure, count);
+        if (UNLIKELY(!resultArray))
+            return nullptr;
+
+        gcSafeMemcpy(resultArray->butterfly()->contiguous().data(), storage->m_vector + startIndex, sizeof(JSValue) * count);
+        ASSERT(resultArray->butterfly()->publicLength() == count);
+        return resultArray;
+    }
     default:
         return nullptr;
     }
@@ -881,19 +905,30 @@ bool JSArray::shiftCountWithAnyIndexingType(JSGlobalObject* globalObject, unsign
         if (oldLength - (startIndex + count) >= MIN_SPARSE_ARRAY_INDEX)
             return shiftCountWithArrayStorage(vm, startIndex, count, ensureArrayStorage(vm));
 
+        // Shifting from the front of a big array moves the whole vector every time, which makes
+        // queue-like use quadratic. ArrayStorage shifts from the front by bumping its index bias
+        // instead, so move there once. We don't scan for holes first: an array with holes ends up on the
+        // generic path after the move, which is why this is opt-in.
+        if (Options::useBiasedShiftForLargeArrays() && !startIndex && oldLength - count >= Options::minimumArrayLengthForBiasedShift())
+            return shiftCountWithArrayStorage(vm, startIndex, count, ensureArrayStorage(vm));
+
         // Storing to a hole is fine since we're still having a good time. But reading from a hole 
         // is totally not fine, since we might have to read from the proto chain.
         // We have to check for holes before we start moving things around so that we don't get halfway 
         // through shifting and then realize we should have been in ArrayStorage mode.
         unsigned end = oldLength - count;
         if (this->structure(vm)->holesMustForwardToPrototype(vm, this)) {
-            for (unsigned i = startIndex; i < end; ++i) {
-                JSValue v = butterfly->contiguous().at(this, i + count).get();
-                if (UNLIKELY(!v)) {
-                    startIndex = i;
-                    return shiftCountWithArrayStorage(vm, startIndex, count, ensureArrayStorage(vm));
-                }
-                butterfly->contiguous().at(this, i).setWithoutWriteBarrier(v);
+            unsigned firstHole = startIndex;
+            while (firstHole < end && butterfly->contiguous().at(this, firstHole + count).get())
+                ++firstHole;
+            gcSafeMemmove(butterfly->contiguous().data() + startIndex,
+                butterfly->contiguous().data() + startIndex + count,
+                sizeof(JSValue) * (firstHole - startIndex));
+            if (UNLIKELY(firstHole < end)) {
+                if (indexingType == ArrayWithContiguous)
+                    vm.heap.writeBarrier(this);
+                startIndex = firstHole;
+                return shiftCountWithArrayStorage(vm, startIndex, count, ensureArrayStorage(vm));
             }
         } else {
             gcSafeMemmove(butterfly->contiguous().data() + startIndex, 
@@ -929,13 +964,15 @@ bool JSArray::shiftCountWithAnyIndexingType(JSGlobalObject* globalObject, unsign
         // through shifting and then realize we should have been in ArrayStorage mode.
         unsigned end = oldLength - count;
         if (this->structure(vm)->holesMustForwardToPrototype(vm, this)) {
-            for (unsigned i = startIndex; i < end; ++i) {
-                double v = butterfly->contiguousDouble().at(this, i + count);
-                if (UNLIKELY(v != v)) {
-                    startIndex = i;
-                    return shiftCountWithArrayStorage(vm, startIndex, count, ensureArrayStorage(vm));
-                }
-                butterfly->contiguousDouble().at(this, i) = v;
+            unsigned firstHole = startIndex;
+            while (firstHole < end && butterfly->contiguousDouble().at(this, firstHole + count) == butterfly->contiguousDouble().at(this, firstHole + count))
+                ++firstHole;
+            gcSafeMemmove(butterfly->contiguousDouble().data() + startIndex,
+                butterfly->contiguousDouble().data() + startIndex + count,
+                sizeof(JSValue) * (firstHole - startIndex));
+            if (UNLIKELY(firstHole < end)) {
+                startIndex = firstHole;
+                return shiftCountWithArrayStorage(vm, startIndex, count, ensureArrayStorage(vm));
             }
         } else {
             gcSafeMemmove(butterfly->contiguousDouble().data() + startIndex,
@@ -68,6 +68,8 @@ JSArrayBufferView::ConstructionContext::ConstructionContext(
         if (!temp)
             return;
 
+        static_assert(!(MarkedBlock::atomSize % 16), "Fast typed array vectors must be 16-byte aligned");
+        ASSERT(!(bitwise_cast<uintptr_t>(temp) % MarkedBlock::atomSize));
         m_structure = structure;
         m_vector = VectorType(temp, length);
         m_mode = FastTypedArray;
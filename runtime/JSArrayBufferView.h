@@ -62,7 +62,9 @@ enum TypedArrayMode : uint32_t {
 
     // Small and fast typed array. B is unused, V points to a vector
     // allocated in the primitive Gigacage, and M = FastTypedArray. V's
-    // liveness is determined entirely by the view's liveness.
+    // liveness is determined entirely by the view's liveness. V is a GC
+    // auxiliary cell, so it is always aligned to MarkedBlock::atomSize
+    // (16 bytes), which lets vector code use aligned 16-byte loads.
     FastTypedArray,
 
     // A large typed array that still attempts not to waste too much
@@ -593,6 +593,14 @@ JSBigInt::ImplResult JSBigInt::multiplyImpl(JSGlobalObject* globalObject, BigInt
     RETURN_IF_EXCEPTION(scope, nullptr);
     result->initialize(InitializationType::WithZero);
 
+    if constexpr (std::is_same_v<BigIntImpl1, HeapBigIntImpl> && std::is_same_v<BigIntImpl2, HeapBigIntImpl>) {
+        if (std::min(x.length(), y.length()) >= karatsubaThreshold) {
+            karatsubaMultiply(x.toHeapBigInt(globalObject)->dataStorage(), x.length(), y.toHeapBigInt(globalObject)->dataStorage(), y.length(), result->dataStorage());
+            result->setSign(x.sign() != y.sign());
+            RELEASE_AND_RETURN(scope, result->rightTrim(globalObject));
+        }
+    }
+
     for (unsigned i = 0; i < x.length(); i++)
         multiplyAccumulate(y, x.digit(i), result, i);
 
@@ -1357,6 +1365,130 @@ void JSBigInt::multiplyAccumulate(BigIntImpl multiplicand, Digit multiplier, JSB
     }
 }
 
+// Adds {y} to {x} in place. {x} must be large enough to absorb the final carry.
+void JSBigInt::digitsAddInto(Digit* x, unsigned xLength, const Digit* y, unsigned yLength)
+{
+    while (yLength && !y[yLength - 1])
+        yLength--;
+    ASSERT(yLength <= xLength);
+
+    Digit carry = 0;
+    unsigned i = 0;
+    for (; i < yLength; i++) {
+        Digit newCarry = 0;
+        Digit sum = digitAdd(x[i], y[i], newCarry);
+        x[i] = digitAdd(sum, carry, newCarry);
+        carry = newCarry;
+    }
+    for (; carry; i++) {
+        ASSERT(i < xLength);
+        Digit newCarry = 0;
+        x[i] = digitAdd(x[i], carry, newCarry);
+        carry = newCarry;
+    }
+}
+
+// Subtracts {y} from {x} in place. The caller guarantees that {x} >= {y}.
+void JSBigInt::digitsSubtractFrom(Digit* x, unsigned xLength, const Digit* y, unsigned yLength)
+{
+    while (yLength && !y[yLength - 1])
+        yLength--;
+    ASSERT(yLength <= xLength);
+
+    Digit borrow = 0;
+    unsigned i = 0;
+    for (; i < yLength; i++) {
+        Digit newBorrow = 0;
+        Digit difference = digitSub(x[i], y[i], newBorrow);
+        x[i] = digitSub(difference, borrow, newBorrow);
+        borrow = newBorrow;
+    }
+    for (; borrow; i++) {
+        ASSERT(i < xLength);
+        Digit newBorrow = 0;
+        x[i] = digitSub(x[i], borrow, newBorrow);
+        borrow = newBorrow;
+    }
+}
+
+// Adds {x} * {y} to {result}, which has xLength + yLength digits and must start out zero. Karatsuba splits
+// each operand in halves, x = x1 * B^h + x0, and gets by with three half-sized products:
+// x * y = z2 * B^2h + (z1 - z2 - z0) * B^h + z0, where z0 = x0 * y0, z2 = x1 * y1 and z1 = (x0 + x1) * (y0 + y1).
+void JSBigInt::karatsubaMultiply(const Digit* x, unsigned xLength, const Digit* y, unsigned yLength, Digit* result)
+{
+    if (xLength < yLength) {
+        std::swap(x, y);
+        std::swap(xLength, yLength);
+    }
+
+    if (yLength < karatsubaThreshold) {
+        for (unsigned i = 0; i < yLength; i++) {
+            Digit multiplier = y[i];
+            if (!multiplier)
+                continue;
+            Digit carry = 0;
+            Digit high = 0;
+            unsigned resultIndex = i;
+            for (unsigned j = 0; j < xLength; j++, resultIndex++) {
+                Digit newCarry = 0;
+                Digit acc = digitAdd(result[resultIndex], high, newCarry);
+                acc = digitAdd(acc, carry, newCarry);
+                Digit low = digitMul(multiplier, x[j], high);
+                result[resultIndex] = digitAdd(acc, low, newCarry);
+                carry = newCarry;
+            }
+            while (carry || high) {
+                ASSERT(resultIndex < xLength + yLength);
+                Digit newCarry = 0;
+                Digit acc = digitAdd(result[resultIndex], high, newCarry);
+                high = 0;
+                result[resultIndex++] = digitAdd(acc, carry, newCarry);
+                carry = newCarry;
+            }
+        }
+        return;
+    }
+
+    unsigned resultLength = xLength + yLength;
+
+    if (xLength >= 2 * yLength) {
+        // Multiply {y} by pieces of {x} that are no longer than {y}, so that every product is balanced.
+        Vector<Digit> piece(2 * yLength);
+        for (unsigned start = 0; start < xLength; start += yLength) {
+            unsigned pieceLength = std::min(yLength, xLength - start);
+            std::fill(piece.begin(), piece.end(), 0);
+            karatsubaMultiply(x + start, pieceLength, y, yLength, piece.data());
+            digitsAddInto(result + start, resultLength - start, piece.data(), pieceLength + yLength);
+        }
+        return;
+    }
+
+    unsigned half = (xLength + 1) / 2;
+    ASSERT(yLength >= half);
+    unsigned x1Length = xLength - half;
+    unsigned y1Length = yLength - half;
+
+    Vector<Digit> z0(2 * half, 0);
+    karatsubaMultiply(x, half, y, half, z0.data());
+    Vector<Digit> z2(x1Length + y1Length, 0);
+    karatsubaMultiply(x + half, x1Length, y + half, y1Length, z2.data());
+
+    Vector<Digit> xSum(half + 1, 0);
+    std::copy(x, x + half, xSum.begin());
+    digitsAddInto(xSum.data(), xSum.size(), x + half, x1Length);
+    Vector<Digit> ySum(half + 1, 0);
+    std::copy(y, y + half, ySum.begin());
+    digitsAddInto(ySum.data(), ySum.size(), y + half, y1Length);
+    Vector<Digit> z1(2 * half + 2, 0);
+    karatsubaMultiply(xSum.data(), xSum.size(), ySum.data(), ySum.size(), z1.data());
+    digitsSubtractFrom(z1.data(), z1.size(), z0.data(), z0.size());
+    digitsSubtractFrom(z1.data(), z1.size(), z2.data(), z2.size());
+
+    digitsAddInto(result, resultLength, z0.data(), z0.size());
+    digitsAddInto(result + half, resultLength - half, z1.data(), z1.size());
+    digitsAddInto(result + 2 * half, resultLength - 2 * half, z2.data(), z2.size());
+}
+
 bool JSBigInt::equals(JSBigInt* x, JSBigInt* y)
 {
     if (x->sign() != y->sign())
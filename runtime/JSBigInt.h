@@ -491,6 +491,12 @@ private:
     static void internalMultiplyAdd(BigIntImpl source, Digit factor, Digit summand, unsigned, JSBigInt* result);
     template <typename BigIntImpl>
     static void multiplyAccumulate(BigIntImpl multiplicand, Digit multiplier, JSBigInt* accumulator, unsigned accumulatorIndex);
+
+    // Below this many digits in the shorter operand, schoolbook multiplication beats Karatsuba.
+    static constexpr unsigned karatsubaThreshold = 40;
+    static void karatsubaMultiply(const Digit* x, unsigned xLength, const Digit* y, unsigned yLength, Digit* result);
+    static void digitsAddInto(Digit* x, unsigned xLength, const Digit* y, unsigned yLength);
+    static void digitsSubtractFrom(Digit* x, unsigned xLength, const Digit* y, unsigned yLength);
     template <typename BigIntImpl1>
     static void absoluteDivWithBigIntDivisor(JSGlobalObject*, BigIntImpl1 dividend, JSBigInt* divisor, JSBigInt** quotient, JSBigInt** remainder);
     
@@ -246,12 +246,109 @@ void DateCache::msToGregorianDateTime(double millisecondsFromEpoch, WTF::TimeTyp
     tm = GregorianDateTime(millisecondsFromEpoch, localTime);
 }
 
+// Parses the common complete forms of the ECMAScript date time string format, YYYY-MM-DD optionally
+// followed by THH:mm, THH:mm:ss or THH:mm:ss.sss and Z or an offset, straight from the string's
+// characters. Anything else, including out of range fields, returns NaN so that the caller can defer
+// to the general parsers.
+template<typename CharacterType>
+static double parseCommonISODate(const CharacterType* characters, unsigned length, bool& isLocalTime)
+{
+    constexpr double failure = std::numeric_limits<double>::quiet_NaN();
+    unsigned index = 0;
+    auto readDigits = [&] (unsigned count, int& result) {
+        if (length - index < count)
+            return false;
+        int value = 0;
+        for (unsigned i = 0; i < count; ++i) {
+            CharacterType character = characters[index + i];
+            if (!isASCIIDigit(character))
+                return false;
+            value = value * 10 + (character - '0');
+        }
+        index += count;
+        result = value;
+        return true;
+    };
+    auto consume = [&] (char expected) {
+        if (index >= length || characters[index] != expected)
+            return false;
+        ++index;
+        return true;
+    };
+
+    int year;
+    int month;
+    int day;
+    if (!readDigits(4, year) || !consume('-') || !readDigits(2, month) || !consume('-') || !readDigits(2, day))
+        return failure;
+    if (month < 1 || month > 12 || day < 1)
+        return failure;
+    static constexpr uint8_t daysInMonths[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool isLeapYear = !(year % 4) && ((year % 100) || !(year % 400));
+    if (day > daysInMonths[month - 1] + (month == 2 && isLeapYear))
+        return failure;
+
+    double result = dateToDaysFrom1970(year, month - 1, day) * WTF::msPerDay;
+    isLocalTime = false;
+    if (index == length)
+        return result;
+
+    int hour;
+    int minute;
+    int second = 0;
+    int millisecond = 0;
+    if (!consume('T') || !readDigits(2, hour) || !consume(':') || !readDigits(2, minute))
+        return failure;
+    if (consume(':')) {
+        if (!readDigits(2, second))
+            return failure;
+        if (consume('.') && !readDigits(3, millisecond))
+            return failure;
+    }
+    if (hour > 23 || minute > 59 || second > 59)
+        return failure;
+    result += timeToMS(hour, minute, second, millisecond);
+
+    if (index == length) {
+        isLocalTime = true;
+        return result;
+    }
+    if (consume('Z'))
+        return index == length ? result : failure;
+
+    int sign = 1;
+    if (!consume('+')) {
+        if (!consume('-'))
+            return failure;
+        sign = -1;
+    }
+    int offsetHour;
+    int offsetMinute;
+    if (!readDigits(2, offsetHour) || !consume(':') || !readDigits(2, offsetMinute) || index != length)
+        return failure;
+    if (offsetHour > 23 || offsetMinute > 59)
+        return failure;
+    return result - sign * (offsetHour * WTF::minutesPerHour + offsetMinute) * WTF::msPerMinute;
+}
+
 double DateCache::parseDate(JSGlobalObject* globalObject, VM& vm, const String& date)
 {
     auto scope = DECLARE_THROW_SCOPE(vm);
 
     if (date == m_cachedDateString)
         return m_cachedDateStringValue;
+
+    {
+        bool isLocalTime = false;
+        double value = date.is8Bit()
+            ? parseCommonISODate(date.characters8(), date.length(), isLocalTime)
+            : parseCommonISODate(date.characters16(), date.length(), isLocalTime);
+        if (!std::isnan(value)) {
+            if (isLocalTime)
+                value -= localTimeOffset(value, WTF::LocalTime).offset;
+            return value;
+        }
+    }
     auto expectedString = date.tryGetUtf8();
     if (!expectedString) {
         if (expectedString.error() == UTF8ConversionError::OutOfMemory)
@@ -326,6 +423,7 @@ void DateCache::reset()
     m_cachedDateString = String();
     m_cachedDateStringValue = std::numeric_limits<double>::quiet_NaN();
     m_dateInstanceCache.reset();
+    m_dateStringCache.reset();
 }
 
 } // namespace JSC
@@ -81,6 +81,9 @@ public:
 
     Ref<DateInstanceData> cachedDateInstanceData(double millisecondsFromEpoch);
 
+    String cachedDateString(double millisecondsFromEpoch, uint8_t variant) const { return m_dateStringCache.get(millisecondsFromEpoch, variant); }
+    void cacheDateString(double millisecondsFromEpoch, uint8_t variant, const String& string) { m_dateStringCache.set(millisecondsFromEpoch, variant, string); }
+
     void msToGregorianDateTime(double millisecondsFromEpoch, WTF::TimeType outputTimeType, GregorianDateTime&);
     double gregorianDateTimeToMS(const GregorianDateTime&, double milliseconds, WTF::TimeType inputTimeType);
     double parseDate(JSGlobalObject*, VM&, const WTF::String&);
@@ -103,6 +106,7 @@ private:
     String m_cachedDateString;
     double m_cachedDateStringValue;
     DateInstanceCache m_dateInstanceCache;
+    DateStringCache m_dateStringCache;
 };
 
 ALWAYS_INLINE bool isUTCEquivalent(StringView timeZone)
@@ -145,29 +145,46 @@ void JSFinalizationRegistry::finalizeUnconditionally(VM& vm)
         return !bucket.value.size();
     });
 
-    if (!vm.deferredWorkTimer->hasPendingWork(this) && (readiedCell || deadCount(locker))) {
-        vm.deferredWorkTimer->addPendingWork(vm, this, { });
-        ASSERT(vm.deferredWorkTimer->hasPendingWork(this));
-        vm.deferredWorkTimer->scheduleWorkSoon(this, [this] {
-            JSGlobalObject* globalObject = this->globalObject();
-            VM& vm = globalObject->vm();
-            this->runFinalizationCleanup(globalObject);
-            vm.deferredWorkTimer->cancelPendingWork(this);
-        });
-    }
+    if (!vm.deferredWorkTimer->hasPendingWork(this) && (readiedCell || hasDeadHoldings(locker)))
+        scheduleFinalizationCleanup(vm);
+}
+
+void JSFinalizationRegistry::scheduleFinalizationCleanup(VM& vm)
+{
+    vm.deferredWorkTimer->addPendingWork(vm, this, { });
+    ASSERT(vm.deferredWorkTimer->hasPendingWork(this));
+    vm.deferredWorkTimer->scheduleWorkForNextTurn(this, [this] {
+        JSGlobalObject* globalObject = this->globalObject();
+        VM& vm = globalObject->vm();
+        bool finished = this->runFinalizationCleanup(globalObject);
+        vm.deferredWorkTimer->cancelPendingWork(this);
+        if (finished)
+            return;
+        // Our time slice ran out. Let the run loop get to other work before we continue with the rest.
+        auto locker = holdLock(cellLock());
+        if (hasDeadHoldings(locker))
+            scheduleFinalizationCleanup(vm);
+    });
 }
 
-void JSFinalizationRegistry::runFinalizationCleanup(JSGlobalObject* globalObject)
+bool JSFinalizationRegistry::runFinalizationCleanup(JSGlobalObject* globalObject)
 {
     VM& vm = globalObject->vm();
     auto scope = DECLARE_THROW_SCOPE(vm);
 
+    MonotonicTime deadline;
+    if (double sliceMilliseconds = Options::finalizationRegistryCleanupSliceMilliseconds())
+        deadline = MonotonicTime::now() + Seconds::fromMilliseconds(sliceMilliseconds);
+
     while (JSValue value = takeDeadHoldingsValue()) {
         MarkedArgumentBuffer args;
         args.append(value);
         call(globalObject, callback(), args, "This should not be visible: please report a bug to bugs.webkit.org");
-        RETURN_IF_EXCEPTION(scope, void());
+        RETURN_IF_EXCEPTION(scope, true);
+        if (deadline && MonotonicTime::now() >= deadline)
+            return false;
     }
+    return true;
 }
 
 JSValue JSFinalizationRegistry::takeDeadHoldingsValue()
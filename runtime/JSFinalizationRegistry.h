@@ -65,7 +65,8 @@ public:
     static JSFinalizationRegistry* createWithInitialValues(VM&, Structure*);
     static Structure* createStructure(VM&, JSGlobalObject*, JSValue prototype);
 
-    void runFinalizationCleanup(JSGlobalObject*);
+    // Returns false if it stopped early because its time slice ran out.
+    bool runFinalizationCleanup(JSGlobalObject*);
 
     DECLARE_EXPORT_INFO;
 
@@ -84,6 +85,9 @@ public:
     JS_EXPORT_PRIVATE size_t deadCount(const Locker<JSCellLock>&);
 
 private:
+    bool hasDeadHoldings(const Locker<JSCellLock>&) const { return !m_noUnregistrationDead.isEmpty() || !m_deadRegistrations.isEmpty(); }
+    void scheduleFinalizationCleanup(VM&);
+
     JSFinalizationRegistry(VM& vm, Structure* structure)
         : Base(vm, structure)
     {
@@ -98,6 +98,14 @@ JSFunction* JSFunction::create(VM& vm, JSGlobalObject* globalObject, unsigned le
     return function;
 }
 
+JSFunction* JSFunction::create(VM& vm, JSGlobalObject* globalObject, NativeExecutable* executable, unsigned length, const String& name)
+{
+    Structure* structure = globalObject->hostFunctionStructure();
+    JSFunction* function = new (NotNull, allocateCell<JSFunction>(vm.heap)) JSFunction(vm, executable, globalObject, structure);
+    function->finishCreation(vm, executable, length, name);
+    return function;
+}
+
 JSFunction::JSFunction(VM& vm, NativeExecutable* executable, JSGlobalObject* globalObject, Structure* structure)
     : Base(vm, globalObject, structure)
     , m_executableOrRareData(bitwise_cast<uintptr_t>(executable))
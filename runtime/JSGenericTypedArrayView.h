@@ -26,6 +26,8 @@
 #pragma once
 
 #include "JSArrayBufferView.h"
+#include "Options.h"
+#include "RadixSort.h"
 #include "ThrowScope.h"
 #include "ToNativeFromValue.h"
 
@@ -194,7 +196,8 @@ public:
             break;
         default: {
             ElementType* array = typedVector();
-            std::sort(array, array + m_length);
+            if (!radixSortIntegers(array))
+                std::sort(array, array + m_length);
             break;
         }
         }
@@ -315,6 +318,11 @@ private:
         JSGlobalObject*, unsigned offset, JSGenericTypedArrayView<OtherAdaptor>*,
         unsigned objectOffset, unsigned length, CopyType);
 
+    // Converts the leading elements of a JSArray with Int32, Double or Contiguous storage straight
+    // from its butterfly, which cannot have side effects. Stops at the first hole, non-number or
+    // the end of the butterfly, and returns how many elements were copied.
+    unsigned setFromIndexedStorage(unsigned offset, JSObject*, unsigned objectOffset, unsigned length);
+
     // The ECMA 6 spec states that floating point Typed Arrays should have the following ordering:
     //
     // -Inifinity < negative finite numbers < -0.0 < 0.0 < positive finite numbers < Infinity < NaN
@@ -360,6 +368,8 @@ private:
         purifyArray();
 
         IntegralType* array = reinterpret_cast_ptr<IntegralType*>(typedVector());
+        if (radixSortFloatBits(array))
+            return;
         std::sort(array, array + m_length, [] (IntegralType a, IntegralType b) {
             if (a >= 0 || b >= 0)
                 return a < b;
@@ -368,6 +378,48 @@ private:
 
     }
 
+    // Large arrays are radix sorted as unsigned keys whose order matches the element order: signed
+    // integers get their sign bit flipped, and floats, viewed as sign-magnitude integers, get every bit
+    // flipped when negative and the sign bit set otherwise. These return false if the array should be
+    // sorted with std::sort instead.
+    template<typename T>
+    bool radixSortIntegers(T* array)
+    {
+        if constexpr (std::is_integral<T>::value) {
+            using UnsignedType = std::make_unsigned_t<T>;
+            constexpr UnsignedType signBit = static_cast<UnsignedType>(1) << (sizeof(UnsignedType) * 8 - 1);
+            constexpr UnsignedType keyMask = std::is_signed<T>::value ? signBit : 0;
+            if (m_length < Options::minimumTypedArrayLengthForRadixSort())
+                return false;
+            UnsignedType* keys = reinterpret_cast_ptr<UnsignedType*>(array);
+            for (unsigned i = 0; i < m_length; ++i)
+                keys[i] ^= keyMask;
+            bool sorted = radixSort(keys, m_length);
+            for (unsigned i = 0; i < m_length; ++i)
+                keys[i] ^= keyMask;
+            return sorted;
+        } else {
+            UNUSED_PARAM(array);
+            return false;
+        }
+    }
+
+    template<typename IntegralType>
+    bool radixSortFloatBits(IntegralType* array)
+    {
+        using UnsignedType = std::make_unsigned_t<IntegralType>;
+        constexpr UnsignedType signBit = static_cast<UnsignedType>(1) << (sizeof(UnsignedType) * 8 - 1);
+        if (m_length < Options::minimumTypedArrayLengthForRadixSort())
+            return false;
+        UnsignedType* keys = reinterpret_cast_ptr<UnsignedType*>(array);
+        for (unsigned i = 0; i < m_length; ++i)
+            keys[i] = (keys[i] & signBit) ? ~keys[i] : keys[i] | signBit;
+        bool sorted = radixSort(keys, m_length);
+        for (unsigned i = 0; i < m_length; ++i)
+            keys[i] = (keys[i] & signBit) ? keys[i] ^ signBit : ~keys[i];
+        return sorted;
+    }
+
 };
 
 template<typename Adaptor>
@@ -29,6 +29,7 @@
 #include "DeferGC.h"
 #include "Error.h"
 #include "ExceptionHelpers.h"
+#include "JSArray.h"
 #include "JSArrayBuffer.h"
 #include "JSCellInlines.h"
 #include "JSGenericTypedArrayView.h"
@@ -208,11 +209,11 @@ bool JSGenericTypedArrayView<Adaptor>::setWithSpecificType(
         || existingBuffer() != other->existingBuffer()
         || (elementSize == otherElementSize && vector() <= other->vector())
         || type == CopyType::LeftToRight) {
-        for (unsigned i = 0; i < length; ++i) {
-            setIndexQuicklyToNativeValue(
-                offset + i, OtherAdaptor::template convertTo<Adaptor>(
-                    other->getIndexQuicklyAsNativeValue(i + otherOffset)));
-        }
+        // Work on the raw vectors so that the compiler sees a simple conversion loop it can vectorize.
+        typename Adaptor::Type* destination = typedVector() + offset;
+        const typename OtherAdaptor::Type* source = other->typedVector() + otherOffset;
+        for (unsigned i = 0; i < length; ++i)
+            destination[i] = OtherAdaptor::template convertTo<Adaptor>(source[i]);
         return true;
     }
 
@@ -296,8 +297,10 @@ bool JSGenericTypedArrayView<Adaptor>::set(
         if (!success)
             return false;
 
-        // We could optimize this case. But right now, we don't.
-        for (unsigned i = 0; i < length; ++i) {
+        // Arrays of numbers are converted in bulk. Whatever is left after a hole or a
+        // non-number goes through get() so that prototype lookups and valueOf() still happen
+        // in order.
+        for (unsigned i = setFromIndexedStorage(offset, object, objectOffset, length); i < length; ++i) {
             JSValue value = object->get(globalObject, i + objectOffset);
             RETURN_IF_EXCEPTION(scope, false);
             bool success = setIndex(globalObject, offset + i, value);
@@ -315,6 +318,61 @@ bool JSGenericTypedArrayView<Adaptor>::set(
     return false;
 }
 
+template<typename Adaptor>
+unsigned JSGenericTypedArrayView<Adaptor>::setFromIndexedStorage(unsigned offset, JSObject* object, unsigned objectOffset, unsigned length)
+{
+    if (!isJSArray(object))
+        return 0;
+
+    Butterfly* butterfly = object->butterfly();
+    if (!hasIndexedProperties(object->indexingType()) || objectOffset >= butterfly->publicLength())
+        return 0;
+    length = std::min(length, butterfly->publicLength() - objectOffset);
+
+    typename Adaptor::Type* destination = typedVector() + offset;
+    switch (object->indexingType()) {
+    case ALL_INT32_INDEXING_TYPES: {
+        const WriteBarrier<Unknown>* source = butterfly->indexingPayload<WriteBarrier<Unknown>>() + objectOffset;
+        for (unsigned i = 0; i < length; ++i) {
+            JSValue value = source[i].get();
+            if (!value)
+                return i;
+            destination[i] = Adaptor::toNativeFromInt32(value.asInt32());
+        }
+        return length;
+    }
+
+    case ALL_DOUBLE_INDEXING_TYPES: {
+        const double* source = butterfly->indexingPayload<double>() + objectOffset;
+        for (unsigned i = 0; i < length; ++i) {
+            double value = source[i];
+            // Holes are NaN. Real NaNs make the array Contiguous.
+            if (value != value)
+                return i;
+            destination[i] = Adaptor::toNativeFromDouble(value);
+        }
+        return length;
+    }
+
+    case ALL_CONTIGUOUS_INDEXING_TYPES: {
+        const WriteBarrier<Unknown>* source = butterfly->indexingPayload<WriteBarrier<Unknown>>() + objectOffset;
+        for (unsigned i = 0; i < length; ++i) {
+            JSValue value = source[i].get();
+            if (value.isInt32())
+                destination[i] = Adaptor::toNativeFromInt32(value.asInt32());
+            else if (value.isDouble())
+                destination[i] = Adaptor::toNativeFromDouble(value.asDouble());
+            else
+                return i;
+        }
+        return length;
+    }
+
+    default:
+        return 0;
+    }
+}
+
 template<typename Adaptor>
 RefPtr<typename Adaptor::ViewType> JSGenericTypedArrayView<Adaptor>::possiblySharedTypedImpl()
 {
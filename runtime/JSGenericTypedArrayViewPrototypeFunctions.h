@@ -38,8 +38,124 @@
 #include "TypedArrayController.h"
 #include <wtf/StdLibExtras.h>
 
+#if CPU(X86_SSE2)
+#include <emmintrin.h>
+#elif CPU(ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace JSC {
 
+// indexOf and includes compare 16 bytes of elements at a time and only fall back to a scalar loop,
+// inside the first block with a hit, to find the exact index. Integers compare by bits; floats use
+// the vector float compares, which share == semantics for +0/-0 and NaN.
+static constexpr unsigned bytesPerTypedArraySearchBlock = 16;
+
+#if CPU(X86_SSE2)
+
+template<typename ElementType>
+static ALWAYS_INLINE bool typedArrayBlockContains(const ElementType* block, ElementType target)
+{
+    if constexpr (std::is_same<ElementType, float>::value)
+        return _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(block), _mm_set1_ps(target)));
+    else if constexpr (std::is_same<ElementType, double>::value)
+        return _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(block), _mm_set1_pd(target)));
+    else {
+        __m128i elements = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        if constexpr (sizeof(ElementType) == 1)
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(elements, _mm_set1_epi8(static_cast<char>(target))));
+        else if constexpr (sizeof(ElementType) == 2)
+            return _mm_movemask_epi8(_mm_cmpeq_epi16(elements, _mm_set1_epi16(static_cast<short>(target))));
+        else
+            return _mm_movemask_epi8(_mm_cmpeq_epi32(elements, _mm_set1_epi32(static_cast<int>(target))));
+    }
+}
+
+template<typename ElementType>
+static ALWAYS_INLINE bool typedArrayBlockContainsNaN(const ElementType* block)
+{
+    if constexpr (std::is_same<ElementType, float>::value) {
+        __m128 elements = _mm_loadu_ps(block);
+        return _mm_movemask_ps(_mm_cmpunord_ps(elements, elements));
+    } else {
+        __m128d elements = _mm_loadu_pd(block);
+        return _mm_movemask_pd(_mm_cmpunord_pd(elements, elements));
+    }
+}
+
+#elif CPU(ARM64)
+
+template<typename ElementType>
+static ALWAYS_INLINE bool typedArrayBlockContains(const ElementType* block, ElementType target)
+{
+    if constexpr (std::is_same<ElementType, float>::value)
+        return vmaxvq_u32(vceqq_f32(vld1q_f32(block), vdupq_n_f32(target)));
+    else if constexpr (std::is_same<ElementType, double>::value)
+        return vmaxvq_u32(vreinterpretq_u32_u64(vceqq_f64(vld1q_f64(block), vdupq_n_f64(target))));
+    else if constexpr (sizeof(ElementType) == 1)
+        return vmaxvq_u8(vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(block)), vdupq_n_u8(static_cast<uint8_t>(target))));
+    else if constexpr (sizeof(ElementType) == 2)
+        return vmaxvq_u16(vceqq_u16(vld1q_u16(reinterpret_cast<const uint16_t*>(block)), vdupq_n_u16(static_cast<uint16_t>(target))));
+    else
+        return vmaxvq_u32(vceqq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(block)), vdupq_n_u32(static_cast<uint32_t>(target))));
+}
+
+template<typename ElementType>
+static ALWAYS_INLINE bool typedArrayBlockContainsNaN(const ElementType* block)
+{
+    // A lane compares unequal to itself only if it holds a NaN.
+    if constexpr (std::is_same<ElementType, float>::value) {
+        float32x4_t elements = vld1q_f32(block);
+        return vminvq_u32(vceqq_f32(elements, elements)) != 0xFFFFFFFF;
+    } else {
+        float64x2_t elements = vld1q_f64(block);
+        return vminvq_u32(vreinterpretq_u32_u64(vceqq_f64(elements, elements))) != 0xFFFFFFFF;
+    }
+}
+
+#else
+
+template<typename ElementType> static ALWAYS_INLINE bool typedArrayBlockContains(const ElementType*, ElementType) { return true; }
+template<typename ElementType> static ALWAYS_INLINE bool typedArrayBlockContainsNaN(const ElementType*) { return true; }
+
+#endif
+
+// Returns the index of the first element at or after index that matches, or length if there is none.
+template<typename ElementType, typename BlockContains, typename ElementMatches>
+static ALWAYS_INLINE unsigned findInTypedArray(const ElementType* array, unsigned index, unsigned length, const BlockContains& blockContains, const ElementMatches& elementMatches)
+{
+    constexpr unsigned elementsPerBlock = bytesPerTypedArraySearchBlock / sizeof(ElementType);
+    static_assert(elementsPerBlock >= 2, "");
+    while (index < length) {
+        if (length - index >= elementsPerBlock && !blockContains(array + index)) {
+            index += elementsPerBlock;
+            continue;
+        }
+        unsigned blockEnd = std::min(length, index + elementsPerBlock);
+        for (; index < blockEnd; ++index) {
+            if (elementMatches(array[index]))
+                return index;
+        }
+    }
+    return length;
+}
+
+template<typename ElementType>
+static ALWAYS_INLINE unsigned findElementInTypedArray(const ElementType* array, unsigned index, unsigned length, ElementType target)
+{
+    return findInTypedArray(array, index, length,
+        [=] (const ElementType* block) { return typedArrayBlockContains(block, target); },
+        [=] (ElementType element) { return element == target; });
+}
+
+template<typename ElementType>
+static ALWAYS_INLINE unsigned findNaNInTypedArray(const ElementType* array, unsigned index, unsigned length)
+{
+    return findInTypedArray(array, index, length,
+        [] (const ElementType* block) { return typedArrayBlockContainsNaN(block); },
+        [] (ElementType element) { return std::isnan(element); });
+}
+
 // This implements 22.2.4.7 TypedArraySpeciesCreate
 // Note, that this function throws.
 template<typename Functor>
@@ -208,19 +324,11 @@ ALWAYS_INLINE EncodedJSValue genericTypedArrayViewProtoFuncIncludes(VM& vm, JSGl
     scope.assertNoException();
     RELEASE_ASSERT(!thisObject->isDetached());
 
-    if (std::isnan(static_cast<double>(*targetOption))) {
-        for (; index < length; ++index) {
-            if (std::isnan(static_cast<double>(array[index])))
-                return JSValue::encode(jsBoolean(true));
-        }
-    } else {
-        for (; index < length; ++index) {
-            if (array[index] == targetOption)
-                return JSValue::encode(jsBoolean(true));
-        }
+    if constexpr (std::is_floating_point<typename ViewClass::ElementType>::value) {
+        if (std::isnan(*targetOption))
+            return JSValue::encode(jsBoolean(findNaNInTypedArray(array, index, length) != length));
     }
-
-    return JSValue::encode(jsBoolean(false));
+    return JSValue::encode(jsBoolean(findElementInTypedArray(array, index, length, *targetOption) != length));
 }
 
 template<typename ViewClass>
@@ -252,11 +360,9 @@ ALWAYS_INLINE EncodedJSValue genericTypedArrayViewProtoFuncIndexOf(VM& vm, JSGlo
     scope.assertNoException();
     RELEASE_ASSERT(!thisObject->isDetached());
 
-    for (; index < length; ++index) {
-        if (array[index] == targetOption)
-            return JSValue::encode(jsNumber(index));
-    }
-
+    index = findElementInTypedArray(array, index, length, *targetOption);
+    if (index != length)
+        return JSValue::encode(jsNumber(index));
     return JSValue::encode(jsNumber(-1));
 }
 
@@ -401,6 +507,31 @@ ALWAYS_INLINE EncodedJSValue genericTypedArrayViewProtoFuncReverse(VM& vm, JSGlo
     return JSValue::encode(thisObject);
 }
 
+template<typename ViewClass>
+ALWAYS_INLINE EncodedJSValue genericTypedArrayViewPrivateFuncFill(VM& vm, JSGlobalObject* globalObject, CallFrame* callFrame)
+{
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // 22.2.3.8. The builtin has already converted the value to a number and clamped start and end.
+    ViewClass* thisObject = jsCast<ViewClass*>(callFrame->argument(0));
+    if (thisObject->isDetached())
+        return throwVMTypeError(globalObject, scope, typedArrayBufferHasBeenDetachedErrorMessage);
+
+    auto value = ViewClass::toAdaptorNativeFromValue(globalObject, callFrame->argument(1));
+    scope.assertNoException();
+    unsigned start = static_cast<unsigned>(callFrame->argument(2).asNumber());
+    unsigned end = static_cast<unsigned>(callFrame->argument(3).asNumber());
+    // Clamping leaves start past end for fill(value, 5, 2), which fills nothing.
+    if (start >= end)
+        return JSValue::encode(thisObject);
+    RELEASE_ASSERT(end <= thisObject->length());
+
+    typename ViewClass::ElementType* array = thisObject->typedVector();
+    std::fill(array + start, array + end, value);
+
+    return JSValue::encode(thisObject);
+}
+
 template<typename ViewClass>
 ALWAYS_INLINE EncodedJSValue genericTypedArrayViewPrivateFuncSort(VM& vm, JSGlobalObject* globalObject, CallFrame* callFrame)
 {
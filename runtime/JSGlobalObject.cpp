@@ -1149,13 +1149,22 @@ capitalName ## Constructor* lowerName ## Constructor = featureFlag ? capitalName
     JSC_FOREACH_BUILTIN_FUNCTION_PRIVATE_GLOBAL_NAME(INIT_PRIVATE_GLOBAL)
 #undef INIT_PRIVATE_GLOBAL
 
-    // FIXME: Initializing them lazily.
-    // https://bugs.webkit.org/show_bug.cgi?id=203795
-    JSObject* asyncFromSyncIteratorPrototype = AsyncFromSyncIteratorPrototype::create(vm, this, AsyncFromSyncIteratorPrototype::createStructure(vm, this, m_iteratorPrototype.get()));
-    jsCast<JSObject*>(linkTimeConstant(LinkTimeConstant::AsyncFromSyncIterator))->putDirect(vm, vm.propertyNames->prototype, asyncFromSyncIteratorPrototype);
-
-    JSObject* regExpStringIteratorPrototype = RegExpStringIteratorPrototype::create(vm, this, RegExpStringIteratorPrototype::createStructure(vm, this, m_iteratorPrototype.get()));
-    jsCast<JSObject*>(linkTimeConstant(LinkTimeConstant::RegExpStringIterator))->putDirect(vm, vm.propertyNames->prototype, regExpStringIteratorPrototype);
+    // These constructors carry a native prototype object, so build both together on first use
+    // instead of paying for them in every new global object.
+    m_linkTimeConstants[static_cast<unsigned>(LinkTimeConstant::AsyncFromSyncIterator)].initLater([] (const Initializer<JSCell>& init) {
+            JSGlobalObject* globalObject = jsCast<JSGlobalObject*>(init.owner);
+            JSFunction* constructor = JSFunction::create(init.vm, asyncFromSyncIteratorPrototypeAsyncFromSyncIteratorCodeGenerator(init.vm), globalObject);
+            JSObject* prototype = AsyncFromSyncIteratorPrototype::create(init.vm, globalObject, AsyncFromSyncIteratorPrototype::createStructure(init.vm, globalObject, globalObject->iteratorPrototype()));
+            constructor->putDirect(init.vm, init.vm.propertyNames->prototype, prototype);
+            init.set(constructor);
+        });
+    m_linkTimeConstants[static_cast<unsigned>(LinkTimeConstant::RegExpStringIterator)].initLater([] (const Initializer<JSCell>& init) {
+            JSGlobalObject* globalObject = jsCast<JSGlobalObject*>(init.owner);
+            JSFunction* constructor = JSFunction::create(init.vm, regExpPrototypeRegExpStringIteratorCodeGenerator(init.vm), globalObject);
+            JSObject* prototype = RegExpStringIteratorPrototype::create(init.vm, globalObject, RegExpStringIteratorPrototype::createStructure(init.vm, globalObject, globalObject->iteratorPrototype()));
+            constructor->putDirect(init.vm, init.vm.propertyNames->prototype, prototype);
+            init.set(constructor);
+        });
 
     // Map and Set helpers.
     m_linkTimeConstants[static_cast<unsigned>(LinkTimeConstant::Set)].initLater([] (const Initializer<JSCell>& init) {
@@ -1208,6 +1217,9 @@ capitalName ## Constructor* lowerName ## Constructor = featureFlag ? capitalName
     m_linkTimeConstants[static_cast<unsigned>(LinkTimeConstant::typedArrayGetOriginalConstructor)].initLater([] (const Initializer<JSCell>& init) {
             init.set(JSFunction::create(init.vm, jsCast<JSGlobalObject*>(init.owner), 0, String(), typedArrayViewPrivateFuncGetOriginalConstructor));
         });
+    m_linkTimeConstants[static_cast<unsigned>(LinkTimeConstant::typedArrayFill)].initLater([] (const Initializer<JSCell>& init) {
+            init.set(JSFunction::create(init.vm, jsCast<JSGlobalObject*>(init.owner), 4, String(), typedArrayViewPrivateFuncFill));
+        });
     m_linkTimeConstants[static_cast<unsigned>(LinkTimeConstant::typedArraySort)].initLater([] (const Initializer<JSCell>& init) {
             init.set(JSFunction::create(init.vm, jsCast<JSGlobalObject*>(init.owner), 0, String(), typedArrayViewPrivateFuncSort));
         });
@@ -1947,6 +1959,8 @@ void JSGlobalObject::visitChildren(JSCell* cell, SlotVisitor& visitor)
     thisObject->m_iteratorProtocolFunction.visit(visitor);
     thisObject->m_promiseResolveFunction.visit(visitor);
     visitor.append(thisObject->m_objectProtoValueOfFunction);
+    visitor.append(thisObject->m_mapProtoSymbolIteratorFunction);
+    visitor.append(thisObject->m_setProtoSymbolIteratorFunction);
     thisObject->m_numberProtoToStringFunction.visit(visitor);
     visitor.append(thisObject->m_functionProtoHasInstanceSymbolFunction);
     thisObject->m_throwTypeErrorGetterSetter.visit(visitor);
@@ -2222,6 +2236,7 @@ void JSGlobalObject::installMapPrototypeWatchpoint(MapPrototype* mapPrototype)
     VM& vm = this->vm();
     if (m_mapIteratorProtocolWatchpointSet.isStillValid()) {
         ObjectPropertyCondition condition = setupAdaptiveWatchpoint(this, mapPrototype, vm.propertyNames->iteratorSymbol);
+        m_mapProtoSymbolIteratorFunction.set(vm, this, jsCast<JSFunction*>(condition.requiredValue()));
         m_mapPrototypeSymbolIteratorWatchpoint = makeUnique<ObjectPropertyChangeAdaptiveWatchpoint<InlineWatchpointSet>>(this, condition, m_mapIteratorProtocolWatchpointSet);
         m_mapPrototypeSymbolIteratorWatchpoint->install(vm);
     }
@@ -2236,6 +2251,7 @@ void JSGlobalObject::installSetPrototypeWatchpoint(SetPrototype* setPrototype)
     VM& vm = this->vm();
     if (m_setIteratorProtocolWatchpointSet.isStillValid()) {
         ObjectPropertyCondition condition = setupAdaptiveWatchpoint(this, setPrototype, vm.propertyNames->iteratorSymbol);
+        m_setProtoSymbolIteratorFunction.set(vm, this, jsCast<JSFunction*>(condition.requiredValue()));
         m_setPrototypeSymbolIteratorWatchpoint = makeUnique<ObjectPropertyChangeAdaptiveWatchpoint<InlineWatchpointSet>>(this, condition, m_setIteratorProtocolWatchpointSet);
         m_setPrototypeSymbolIteratorWatchpoint->install(vm);
     }
@@ -36,6 +36,7 @@
 #include "JSPromise.h"
 #include "Lexer.h"
 #include "LiteralParser.h"
+#include "ObjectCloneCache.h"
 #include "ObjectConstructor.h"
 #include "ParseInt.h"
 #include <stdio.h>
@@ -396,6 +397,36 @@ static double toDouble(const CharType* characters, unsigned size)
     return number;
 }
 
+// Strings like "42" or "-17" are the overwhelmingly common input to ToNumber. Up to 15
+// digits are exactly representable in a double, so they can be accumulated directly
+// without going through the general decimal parser. Returns false if the string is
+// not of that form.
+template <typename CharType>
+static ALWAYS_INLINE bool toDoubleFromDecimalInteger(const CharType* characters, unsigned size, double& result)
+{
+    static constexpr unsigned maxExactDigits = 15;
+
+    if (!size)
+        return false;
+
+    bool negative = characters[0] == '-';
+    unsigned index = negative ? 1 : 0;
+    unsigned digitCount = size - index;
+    if (!digitCount || digitCount > maxExactDigits)
+        return false;
+
+    uint64_t value = 0;
+    for (; index < size; ++index) {
+        unsigned digit = static_cast<unsigned>(characters[index]) - '0';
+        if (digit > 9)
+            return false;
+        value = value * 10 + digit;
+    }
+
+    result = negative ? -static_cast<double>(value) : static_cast<double>(value);
+    return true;
+}
+
 // See ecma-262 6th 11.8.3
 double jsToNumber(StringView s)
 {
@@ -410,8 +441,14 @@ double jsToNumber(StringView s)
         return PNaN;
     }
 
-    if (s.is8Bit())
+    double result;
+    if (s.is8Bit()) {
+        if (toDoubleFromDecimalInteger(s.characters8(), size, result))
+            return result;
         return toDouble(s.characters8(), size);
+    }
+    if (toDoubleFromDecimalInteger(s.characters16(), size, result))
+        return result;
     return toDouble(s.characters16(), size);
 }
 
@@ -841,7 +878,7 @@ JSC_DEFINE_HOST_FUNCTION(globalFuncPropertyIsEnumerable, (JSGlobalObject* global
     return JSValue::encode(jsBoolean(enumerable));
 }
 
-static bool canPerformFastPropertyEnumerationForCopyDataProperties(Structure* structure)
+bool canPerformFastPropertyEnumerationForCopyDataProperties(Structure* structure)
 {
     if (structure->typeInfo().overridesGetOwnPropertySlot())
         return false;
@@ -896,7 +933,17 @@ JSC_DEFINE_HOST_FUNCTION(globalFuncCopyDataProperties, (JSGlobalObject* globalOb
     }
 
     if (canPerformFastPropertyEnumerationForCopyDataProperties(source->structure(vm))) {
+        ObjectCloneCache* cloneCache = nullptr;
+        if (!excludedSet && Options::useObjectCloneCache()) {
+            cloneCache = vm.ensureObjectCloneCache();
+            if (cloneCache->tryCopy(vm, target, source))
+                return JSValue::encode(jsUndefined());
+        }
+
+        Structure* sourceStructure = source->structure(vm);
+        Structure* targetStructure = target->structure(vm);
         Vector<RefPtr<UniquedStringImpl>, 8> properties;
+        Vector<PropertyOffset, 8> offsets;
         MarkedArgumentBuffer values;
 
         // FIXME: It doesn't seem like we should have to do this in two phases, but
@@ -915,6 +962,7 @@ JSC_DEFINE_HOST_FUNCTION(globalFuncCopyDataProperties, (JSGlobalObject* globalOb
                 return true;
 
             properties.append(entry.key);
+            offsets.append(entry.offset);
             values.appendWithCrashOnOverflow(source->getDirect(entry.offset));
             return true;
         });
@@ -930,6 +978,8 @@ JSC_DEFINE_HOST_FUNCTION(globalFuncCopyDataProperties, (JSGlobalObject* globalOb
                 continue;
             target->putDirect(vm, properties[i].get(), values.at(i));
         }
+        if (cloneCache)
+            cloneCache->tryAdd(vm, sourceStructure, targetStructure, target, properties, offsets);
     } else {
         PropertyNameArray propertyNames(vm, PropertyNameMode::StringsAndSymbols, PrivateSymbolMode::Exclude);
         source->methodTable(vm)->getOwnPropertyNames(source, globalObject, propertyNames, DontEnumPropertiesMode::Include);
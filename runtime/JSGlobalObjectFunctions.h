@@ -31,6 +31,7 @@ namespace JSC {
 class ArgList;
 class CallFrame;
 class JSObject;
+class Structure;
 
 // FIXME: These functions should really be in JSGlobalObject.cpp, but putting them there
 // is a 0.5% reduction.
@@ -62,4 +63,8 @@ JSC_DECLARE_HOST_FUNCTION(globalFuncDateTimeFormat);
 
 JS_EXPORT_PRIVATE double jsToNumber(StringView);
 
+// Enumerating the properties of an object with such a Structure has no observable side effects,
+// and its non-indexed property table order is its own property key order.
+bool canPerformFastPropertyEnumerationForCopyDataProperties(Structure*);
+
 } // namespace JSC
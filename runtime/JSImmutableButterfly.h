@@ -26,6 +26,7 @@
 #pragma once
 
 #include "Butterfly.h"
+#include "GCMemoryOperations.h"
 #include "IndexingHeader.h"
 #include "JSCJSValueInlines.h"
 #include "JSCell.h"
@@ -91,11 +92,16 @@ public:
             return result;
 
         if (indexingType == ContiguousShape || indexingType == Int32Shape) {
+            // Copy the vector in one go and then turn holes into undefined, rather than paying for a
+            // barrier per element. Int32 vectors hold no cells, so they need no barrier at all.
+            auto& contiguous = result->toButterfly()->contiguous();
+            gcSafeMemcpy(contiguous.data(), array->butterfly()->contiguous().data(), sizeof(JSValue) * length);
             for (unsigned i = 0; i < length; i++) {
-                JSValue value = array->butterfly()->contiguous().at(array, i).get();
-                value = !!value ? value : jsUndefined();
-                result->setIndex(vm, i, value);
+                if (!contiguous.atUnsafe(i).get())
+                    contiguous.atUnsafe(i).setWithoutWriteBarrier(jsUndefined());
             }
+            if (indexingType == ContiguousShape)
+                vm.heap.writeBarrier(result);
             return result;
         }
 
@@ -70,6 +70,7 @@ const ClassInfo JSModuleLoader::s_info = { "ModuleLoader", &Base::s_info, &modul
     fulfillFetch                   JSBuiltin                                  DontEnum|Function 2
     requestFetch                   JSBuiltin                                  DontEnum|Function 3
     requestInstantiate             JSBuiltin                                  DontEnum|Function 3
+    startDependencyInstantiate     JSBuiltin                                  DontEnum|Function 2
     requestSatisfy                 JSBuiltin                                  DontEnum|Function 3
     link                           JSBuiltin                                  DontEnum|Function 2
     moduleDeclarationInstantiation moduleLoaderModuleDeclarationInstantiation DontEnum|Function 2
@@ -30,6 +30,8 @@
 #include "ArrayConstructor.h"
 #include "BigIntObject.h"
 #include "BooleanObject.h"
+#include "DOMJITSignature.h"
+#include "FrameTracers.h"
 #include "JSArrayInlines.h"
 #include "JSCInlines.h"
 #include "LiteralParser.h"
@@ -44,6 +46,7 @@ STATIC_ASSERT_IS_TRIVIALLY_DESTRUCTIBLE(JSONObject);
 
 static JSC_DECLARE_HOST_FUNCTION(JSONProtoFuncParse);
 static JSC_DECLARE_HOST_FUNCTION(JSONProtoFuncStringify);
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(JSONProtoFuncParseWithoutTypeCheck, EncodedJSValue, (JSGlobalObject*, JSONObject*, JSString*));
 
 }
 
@@ -56,10 +59,14 @@ JSONObject::JSONObject(VM& vm, Structure* structure)
 {
 }
 
+// Lets the DFG and FTL call JSON.parse(string) directly, without going through a native call frame.
+static const DOMJIT::Signature DOMJITSignatureForJSONParse(JSONProtoFuncParseWithoutTypeCheck, JSONObject::info(), DOMJIT::Effect(), SpecHeapTop, SpecString);
+
 void JSONObject::finishCreation(VM& vm)
 {
     Base::finishCreation(vm);
     ASSERT(inherits(vm, info()));
+    putDirectNativeFunction(vm, globalObject(vm), vm.propertyNames->parse, 2, JSONProtoFuncParse, NoIntrinsic, &DOMJITSignatureForJSONParse, static_cast<unsigned>(PropertyAttribute::DontEnum));
     JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
 }
 
@@ -85,6 +92,16 @@ public:
     JSValue stringify(JSValue);
 
 private:
+    // Property names, pre-quoted keys and storage offsets of a plain object shape. Arrays of same-shaped
+    // objects then skip getOwnPropertyNames(), the generic get() and key escaping for every element.
+    struct CachedObjectShape : RefCounted<CachedObjectShape> {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        Strong<Structure> structure;
+        RefPtr<PropertyNameArrayData> propertyNames;
+        Vector<String> quotedKeys;
+        Vector<PropertyOffset> offsets;
+    };
+
     class Holder {
     public:
         enum RootHolderTag { RootHolder };
@@ -103,10 +120,13 @@ private:
         unsigned m_index { 0 };
         unsigned m_size { 0 };
         RefPtr<PropertyNameArrayData> m_propertyNames;
+        RefPtr<CachedObjectShape> m_shape;
     };
 
     friend class Holder;
 
+    RefPtr<CachedObjectShape> objectShapeFor(JSObject*);
+
     JSValue toJSON(JSValue, const PropertyNameForFunctionCall&);
 
     enum StringifyResult { StringifyFailed, StringifySucceeded, StringifyFailedDueToUndefinedOrSymbolValue };
@@ -129,6 +149,10 @@ private:
     Vector<Holder, 16, UnsafeVectorOverflow> m_holderStack;
     String m_repeatedGap;
     String m_indent;
+
+    static constexpr unsigned maximumCachedObjectShapes = 4;
+    Vector<RefPtr<CachedObjectShape>, maximumCachedObjectShapes> m_cachedObjectShapes;
+    unsigned m_nextCachedObjectShapeToReplace { 0 };
 };
 
 // ------------------------------ helper functions --------------------------------
@@ -461,6 +485,53 @@ inline void Stringifier::startNewLine(StringBuilder& builder) const
     builder.append(m_indent);
 }
 
+auto Stringifier::objectShapeFor(JSObject* object) -> RefPtr<CachedObjectShape>
+{
+    if (!Options::useJSONStringifyObjectShapeCache())
+        return nullptr;
+
+    VM& vm = m_globalObject->vm();
+    Structure* structure = object->structure(vm);
+    for (auto& shape : m_cachedObjectShapes) {
+        if (shape->structure.get() == structure)
+            return shape;
+    }
+
+    // Only ordinary objects whose own enumerable properties are exactly the plain data properties recorded
+    // in a non-dictionary structure can be read back through offsets. Dictionaries change in place.
+    if (object->type() != FinalObjectType || structure->isDictionary() || hasIndexedProperties(structure->indexingType()))
+        return nullptr;
+    if (!structure->canAccessPropertiesQuicklyForEnumeration())
+        return nullptr;
+
+    PropertyNameArray propertyNames(vm, PropertyNameMode::Strings, PrivateSymbolMode::Exclude);
+    structure->getPropertyNamesFromStructure(vm, propertyNames, DontEnumPropertiesMode::Exclude);
+
+    auto shape = adoptRef(*new CachedObjectShape);
+    shape->structure.set(vm, structure);
+    shape->quotedKeys.reserveInitialCapacity(propertyNames.size());
+    shape->offsets.reserveInitialCapacity(propertyNames.size());
+    for (auto& propertyName : propertyNames) {
+        unsigned attributes;
+        PropertyOffset offset = structure->get(vm, propertyName, attributes);
+        if (!isValidOffset(offset) || (attributes & PropertyAttribute::Accessor))
+            return nullptr;
+        StringBuilder quotedKey;
+        quotedKey.appendQuotedJSONString(propertyName.string());
+        shape->quotedKeys.uncheckedAppend(quotedKey.toString());
+        shape->offsets.uncheckedAppend(offset);
+    }
+    shape->propertyNames = propertyNames.releaseData();
+
+    if (m_cachedObjectShapes.size() < maximumCachedObjectShapes)
+        m_cachedObjectShapes.append(shape.copyRef());
+    else {
+        m_cachedObjectShapes[m_nextCachedObjectShapeToReplace] = shape.copyRef();
+        m_nextCachedObjectShapeToReplace = (m_nextCachedObjectShapeToReplace + 1) % maximumCachedObjectShapes;
+    }
+    return shape;
+}
+
 inline Stringifier::Holder::Holder(JSGlobalObject* globalObject, JSObject* object)
     : m_object(object)
     , m_isJSArray(isJSArray(object))
@@ -498,6 +569,8 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
         } else {
             if (stringifier.m_usingArrayReplacer)
                 m_propertyNames = stringifier.m_arrayReplacerPropertyNames.data();
+            else if ((m_shape = stringifier.objectShapeFor(m_object)))
+                m_propertyNames = m_shape->propertyNames;
             else {
                 PropertyNameArray objectPropertyNames(vm, PropertyNameMode::Strings, PrivateSymbolMode::Exclude);
                 m_object->methodTable(vm)->getOwnPropertyNames(m_object, globalObject, objectPropertyNames, DontEnumPropertiesMode::Exclude);
@@ -546,8 +619,15 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
     } else {
         // Get the value.
         Identifier& propertyName = m_propertyNames->propertyNameVector()[index];
-        JSValue value = m_object->get(globalObject, propertyName);
-        RETURN_IF_EXCEPTION(scope, false);
+        JSValue value;
+        // An earlier toJSON or replacer call may have reshaped the object, so the offsets are only
+        // trusted while the structure is unchanged.
+        if (m_shape && m_object->structure(vm) == m_shape->structure.get())
+            value = m_object->getDirect(m_shape->offsets[index]);
+        else {
+            value = m_object->get(globalObject, propertyName);
+            RETURN_IF_EXCEPTION(scope, false);
+        }
 
         rollBackPoint = builder.length();
 
@@ -557,7 +637,10 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
         stringifier.startNewLine(builder);
 
         // Append the property name.
-        builder.appendQuotedJSONString(propertyName.string());
+        if (m_shape)
+            builder.append(m_shape->quotedKeys[index]);
+        else
+            builder.appendQuotedJSONString(propertyName.string());
         builder.append(':');
         if (stringifier.willIndent())
             builder.append(' ');
@@ -594,7 +677,6 @@ const ClassInfo JSONObject::s_info = { "JSON", &JSNonFinalObject::s_info, &jsonT
 
 /* Source for JSONObject.lut.h
 @begin jsonTable
-  parse         JSONProtoFuncParse             DontEnum|Function 2
   stringify     JSONProtoFuncStringify         DontEnum|Function 3
 @end
 */
@@ -791,13 +873,10 @@ NEVER_INLINE JSValue Walker::walk(JSValue unfiltered)
     RELEASE_AND_RETURN(scope, callReviver(finalHolder, jsEmptyString(vm), outValue));
 }
 
-// ECMA-262 v5 15.12.2
-JSC_DEFINE_HOST_FUNCTION(JSONProtoFuncParse, (JSGlobalObject* globalObject, CallFrame* callFrame))
+static JSValue parseJSONString(JSGlobalObject* globalObject, JSString* string)
 {
     VM& vm = globalObject->vm();
     auto scope = DECLARE_THROW_SCOPE(vm);
-    auto* string = callFrame->argument(0).toString(globalObject);
-    RETURN_IF_EXCEPTION(scope, { });
     auto viewWithString = string->viewWithUnderlyingString(globalObject);
     RETURN_IF_EXCEPTION(scope, { });
     StringView view = viewWithString.view;
@@ -809,7 +888,8 @@ JSC_DEFINE_HOST_FUNCTION(JSONProtoFuncParse, (JSGlobalObject* globalObject, Call
         EXCEPTION_ASSERT(!scope.exception() || !unfiltered);
         if (!unfiltered) {
             RETURN_IF_EXCEPTION(scope, { });
-            return throwVMError(globalObject, scope, createSyntaxError(globalObject, jsonParser.getErrorMessage()));
+            throwException(globalObject, scope, createSyntaxError(globalObject, jsonParser.getErrorMessage()));
+            return { };
         }
     } else {
         LiteralParser<UChar> jsonParser(globalObject, view.characters16(), view.length(), StrictJSON);
@@ -817,9 +897,22 @@ JSC_DEFINE_HOST_FUNCTION(JSONProtoFuncParse, (JSGlobalObject* globalObject, Call
         EXCEPTION_ASSERT(!scope.exception() || !unfiltered);
         if (!unfiltered) {
             RETURN_IF_EXCEPTION(scope, { });
-            return throwVMError(globalObject, scope, createSyntaxError(globalObject, jsonParser.getErrorMessage()));
+            throwException(globalObject, scope, createSyntaxError(globalObject, jsonParser.getErrorMessage()));
+            return { };
         }
     }
+    return unfiltered;
+}
+
+// ECMA-262 v5 15.12.2
+JSC_DEFINE_HOST_FUNCTION(JSONProtoFuncParse, (JSGlobalObject* globalObject, CallFrame* callFrame))
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto* string = callFrame->argument(0).toString(globalObject);
+    RETURN_IF_EXCEPTION(scope, { });
+    JSValue unfiltered = parseJSONString(globalObject, string);
+    RETURN_IF_EXCEPTION(scope, { });
     
     if (callFrame->argumentCount() < 2)
         return JSValue::encode(unfiltered);
@@ -833,6 +926,14 @@ JSC_DEFINE_HOST_FUNCTION(JSONProtoFuncParse, (JSGlobalObject* globalObject, Call
     return JSValue::encode(walker.walk(unfiltered));
 }
 
+JSC_DEFINE_JIT_OPERATION(JSONProtoFuncParseWithoutTypeCheck, EncodedJSValue, (JSGlobalObject* globalObject, JSONObject*, JSString* string))
+{
+    VM& vm = globalObject->vm();
+    CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
+    JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+    return JSValue::encode(parseJSONString(globalObject, string));
+}
+
 // ECMA-262 v5 15.12.3
 JSC_DEFINE_HOST_FUNCTION(JSONProtoFuncStringify, (JSGlobalObject* globalObject, CallFrame* callFrame))
 {
@@ -3421,12 +3421,14 @@ bool JSObject::increaseVectorLength(VM& vm, unsigned newLength)
     ASSERT(newLength > vectorLength);
     unsigned newVectorLength = getNewVectorLength(vm, newLength);
 
-    // Fast case - there is no precapacity. In these cases a realloc makes sense.
+    // Fast case - there is no precapacity. In these cases a realloc makes sense. Large vectors live
+    // in PreciseAllocations, which reallocArrayRightIfPossible extends without a copy when it can.
     Structure* structure = this->structure(vm);
     if (LIKELY(!indexBias)) {
-        DeferGC deferGC(vm.heap);
-        Butterfly* newButterfly = storage->butterfly()->growArrayRight(
-            vm, this, structure, structure->outOfLineCapacity(), true,
+        GCDeferralContext deferralContext(vm.heap);
+        DisallowGC disallowGC;
+        Butterfly* newButterfly = storage->butterfly()->reallocArrayRightIfPossible(
+            vm, deferralContext, this, structure, structure->outOfLineCapacity(), true,
             ArrayStorage::sizeFor(vectorLength), ArrayStorage::sizeFor(newVectorLength));
         if (!newButterfly)
             return false;
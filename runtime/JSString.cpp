@@ -307,11 +307,124 @@ const String& JSRopeString::resolveRopeWithFunction(JSGlobalObject* nullOrGlobal
 
 const String& JSRopeString::resolveRope(JSGlobalObject* nullOrGlobalObjectForOOM) const
 {
+    if (Options::useRopeAppendBuffers() && !isSubstring() && length() >= Options::minimumRopeLengthForAppendBuffer()) {
+        VM& vm = this->vm();
+        if (resolveRopeInAppendBuffer(vm))
+            return valueInternal();
+        const String& result = resolveRopeWithFunction(nullOrGlobalObjectForOOM, [] (Ref<StringImpl>&& newImpl) {
+            return WTFMove(newImpl);
+        });
+        vm.lastRopeResolvedOutsideAppendBuffer = result.impl();
+        return result;
+    }
     return resolveRopeWithFunction(nullOrGlobalObjectForOOM, [] (Ref<StringImpl>&& newImpl) {
         return WTFMove(newImpl);
     });
 }
 
+// `s += chunk` in a loop that also reads s builds ropes whose leftmost fiber is the previous, already
+// resolved value of s. Resolving each of them into a fresh buffer copies the whole string every time.
+// Instead, such ropes are resolved into a VM-wide buffer with spare capacity, and the result is a
+// substring of that buffer. When the next rope starts with exactly the characters in use, only its
+// suffix has to be written, behind them. Characters that a string already refers to are never
+// overwritten, so every string sharing the buffer stays immutable. A buffer is only started for the
+// second of two appends in a row, so that resolving one long concatenation costs no extra memory.
+bool JSRopeString::resolveRopeInAppendBuffer(VM& vm) const
+{
+    ASSERT(isRope() && !isSubstring());
+
+    const JSString* prefix = this;
+    while (prefix->isRope()) {
+        auto* rope = static_cast<const JSRopeString*>(prefix);
+        if (rope->isSubstring())
+            return false;
+        prefix = rope->fiber0();
+    }
+
+    StringImpl* prefixImpl = prefix->valueInternal().impl();
+    if (prefixImpl->is8Bit() != is8Bit())
+        return false;
+
+    auto characters = [&] (StringImpl* impl) -> const void* {
+        if (impl->is8Bit())
+            return impl->characters8();
+        return impl->characters16();
+    };
+
+    unsigned length = this->length();
+    StringImpl* buffer = vm.ropeAppendBuffer.get();
+    bool appendsToBuffer = buffer
+        && buffer->is8Bit() == is8Bit()
+        && prefixImpl->length() == vm.ropeAppendBufferLength
+        && characters(prefixImpl) == characters(buffer);
+
+    if (appendsToBuffer && length <= buffer->length()) {
+        if (is8Bit())
+            resolveRopeSuffix(const_cast<LChar*>(buffer->characters8()), prefix);
+        else
+            resolveRopeSuffix(const_cast<UChar*>(buffer->characters16()), prefix);
+    } else {
+        // Only ropes that append to the result of the previous long rope get a buffer with spare capacity.
+        if (!appendsToBuffer && (prefixImpl != vm.lastRopeResolvedOutsideAppendBuffer || prefixImpl->length() < length / 2))
+            return false;
+
+        unsigned capacity = std::min<uint64_t>(static_cast<uint64_t>(length) * 2, StringImpl::MaxLength);
+        RefPtr<StringImpl> newBuffer;
+        if (is8Bit()) {
+            LChar* data;
+            newBuffer = StringImpl::tryCreateUninitialized(capacity, data);
+            if (!newBuffer)
+                return false;
+            resolveRopeInternalNoSubstring(data);
+        } else {
+            UChar* data;
+            newBuffer = StringImpl::tryCreateUninitialized(capacity, data);
+            if (!newBuffer)
+                return false;
+            resolveRopeInternalNoSubstring(data);
+        }
+        vm.heap.reportExtraMemoryAllocated(newBuffer->cost());
+        vm.ropeAppendBuffer = WTFMove(newBuffer);
+    }
+
+    vm.ropeAppendBufferLength = length;
+    convertToNonRope(StringImpl::createSubstringSharingImpl(*vm.ropeAppendBuffer, 0, length));
+    return true;
+}
+
+JSString* JSRopeString::fiberContaining(unsigned& offset, unsigned length) const
+{
+    ASSERT(offset + length <= this->length());
+    const JSString* current = this;
+    for (unsigned depth = 0; depth < Options::maximumRopeFiberWalkDepth() && current->isRope(); ++depth) {
+        auto* rope = static_cast<const JSRopeString*>(current);
+        if (rope->isSubstring()) {
+            offset += rope->substringOffset();
+            return rope->substringBase();
+        }
+
+        JSString* next = nullptr;
+        unsigned fiberOffset = offset;
+        for (unsigned i = 0; i < s_maxInternalRopeLength; ++i) {
+            JSString* fiber = rope->fiber(i);
+            if (!fiber)
+                break;
+            unsigned fiberLength = fiber->length();
+            if (fiberOffset < fiberLength) {
+                if (length <= fiberLength - fiberOffset)
+                    next = fiber;
+                break;
+            }
+            fiberOffset -= fiberLength;
+        }
+        if (!next)
+            break;
+        offset = fiberOffset;
+        current = next;
+    }
+    return const_cast<JSString*>(current);
+}
+
 // Overview: These functions convert a JSString from holding a string in rope form
 // down to a simple String representation. It does so by building up the string
 // backwards, since we want to avoid recursion, we expect that the tree structure
@@ -367,6 +480,54 @@ void JSRopeString::resolveRopeSlowCase(CharacterType* buffer) const
     ASSERT(buffer == position);
 }
 
+// Like resolveRopeSlowCase(), except that the leftmost leaf, prefix, is already at the start of buffer.
+template<typename CharacterType>
+void JSRopeString::resolveRopeSuffix(CharacterType* buffer, const JSString* prefix) const
+{
+    CharacterType* position = buffer + length();
+    Vector<JSString*, 32, UnsafeVectorOverflow> workQueue; // These strings are kept alive by the parent rope, so using a Vector is OK.
+
+    for (size_t i = 0; i < s_maxInternalRopeLength && fiber(i); ++i)
+        workQueue.append(fiber(i));
+
+    while (!workQueue.isEmpty()) {
+        JSString* currentFiber = workQueue.last();
+        workQueue.removeLast();
+
+        // The leftmost leaf is the last one we get to. The same string may also appear further right.
+        if (currentFiber == prefix && workQueue.isEmpty())
+            break;
+
+        if (currentFiber->isRope()) {
+            JSRopeString* currentFiberAsRope = static_cast<JSRopeString*>(currentFiber);
+            if (currentFiberAsRope->isSubstring()) {
+                StringImpl* string = currentFiberAsRope->substringBase()->valueInternal().impl();
+                unsigned offset = currentFiberAsRope->substringOffset();
+                unsigned length = currentFiberAsRope->length();
+                position -= length;
+                if (string->is8Bit())
+                    StringImpl::copyCharacters(position, string->characters8() + offset, length);
+                else
+                    StringImpl::copyCharacters(position, string->characters16() + offset, length);
+                continue;
+            }
+            for (size_t i = 0; i < s_maxInternalRopeLength && currentFiberAsRope->fiber(i); ++i)
+                workQueue.append(currentFiberAsRope->fiber(i));
+            continue;
+        }
+
+        StringImpl* string = currentFiber->valueInternal().impl();
+        unsigned length = string->length();
+        position -= length;
+        if (string->is8Bit())
+            StringImpl::copyCharacters(position, string->characters8(), length);
+        else
+            StringImpl::copyCharacters(position, string->characters16(), length);
+    }
+
+    ASSERT(buffer + prefix->length() == position);
+}
+
 void JSRopeString::outOfMemory(JSGlobalObject* nullOrGlobalObjectForOOM) const
 {
     ASSERT(isRope());
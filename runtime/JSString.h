@@ -27,6 +27,7 @@
 #include "CommonIdentifiers.h"
 #include "GetVM.h"
 #include "Identifier.h"
+#include "Options.h"
 #include "PropertyDescriptor.h"
 #include "PropertySlot.h"
 #include "Structure.h"
@@ -80,6 +81,7 @@ JSString* asString(JSValue);
 //                                            x:(is8Bit),y:(isSubstring),z:(isRope) bit flags
 class JSString : public JSCell {
 public:
+    friend class Heap;
     friend class JIT;
     friend class VM;
     friend class SpecializedThunkJIT;
@@ -560,6 +562,11 @@ public:
         return newString;
     }
 
+    // Walks down the fibers, without resolving anything, to the deepest string that still covers
+    // [offset, offset + length), and rebases offset onto it. The result is this rope itself if no
+    // single fiber covers the range, and it may still be a rope if the walk stops early.
+    JSString* fiberContaining(unsigned& offset, unsigned length) const;
+
 private:
     static JSRopeString* create(VM& vm, JSString* s1, JSString* s2)
     {
@@ -597,6 +604,8 @@ private:
     JS_EXPORT_PRIVATE RefPtr<AtomStringImpl> resolveRopeToExistingAtomString(JSGlobalObject*) const;
     template<typename CharacterType> NEVER_INLINE void resolveRopeSlowCase(CharacterType*) const;
     template<typename CharacterType> void resolveRopeInternalNoSubstring(CharacterType*) const;
+    template<typename CharacterType> void resolveRopeSuffix(CharacterType*, const JSString* prefix) const;
+    bool resolveRopeInAppendBuffer(VM&) const;
     void outOfMemory(JSGlobalObject* nullOrGlobalObjectForOOM) const;
     void resolveRopeInternal8(LChar*) const;
     void resolveRopeInternal16(UChar*) const;
@@ -754,6 +763,17 @@ inline JSString* jsNontrivialString(VM& vm, String&& s)
     return JSString::create(vm, s.releaseImpl().releaseNonNull());
 }
 
+ALWAYS_INLINE JSString* jsDecimalInt32String(VM& vm, int32_t integer)
+{
+    if (static_cast<unsigned>(integer) <= 9)
+        return vm.smallStrings.singleCharacterString(integer + '0');
+    if (JSString* cached = vm.numericStrings.cachedSmallIntJSString(integer))
+        return cached;
+    JSString* result = jsNontrivialString(vm, vm.numericStrings.add(integer));
+    vm.numericStrings.cacheSmallIntJSString(integer, result);
+    return result;
+}
+
 ALWAYS_INLINE Identifier JSString::toIdentifier(JSGlobalObject* globalObject) const
 {
     VM& vm = getVM(globalObject);
@@ -811,6 +831,12 @@ inline JSString* JSString::getIndex(JSGlobalObject* globalObject, unsigned i)
     VM& vm = getVM(globalObject);
     auto scope = DECLARE_THROW_SCOPE(vm);
     ASSERT(canGetIndex(i));
+    if (isRope() && Options::useRopeFiberWalking() && length() >= Options::minimumRopeLengthForFiberWalking()) {
+        unsigned offset = i;
+        JSString* fiber = static_cast<JSRopeString*>(this)->fiberContaining(offset, 1);
+        if (!fiber->isRope())
+            return jsSingleCharacterString(vm, fiber->valueInternal()[offset]);
+    }
     StringView view = unsafeView(globalObject);
     RETURN_IF_EXCEPTION(scope, nullptr);
     return jsSingleCharacterString(vm, view[i]);
@@ -850,8 +876,16 @@ inline JSString* jsSubstring(VM& vm, JSGlobalObject* globalObject, JSString* bas
         offset = baseRope->substringOffset() + offset;
         ASSERT(!base->isRope());
     } else if (base->isRope()) {
-        jsCast<JSRopeString*>(base)->resolveRope(globalObject);
-        RETURN_IF_EXCEPTION(scope, nullptr);
+        // Only the fiber that covers the requested range needs to be resolved, not the whole rope.
+        if (Options::useRopeFiberWalking()) {
+            base = jsCast<JSRopeString*>(base)->fiberContaining(offset, length);
+            if (!offset && length == base->length())
+                return base;
+        }
+        if (base->isRope()) {
+            jsCast<JSRopeString*>(base)->resolveRope(globalObject);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+        }
     }
     return jsSubstringOfResolved(vm, nullptr, base, offset, length);
 }
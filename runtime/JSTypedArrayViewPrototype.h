@@ -55,6 +55,7 @@ JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncIsTypedArrayView);
 JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncIsSharedTypedArrayView);
 JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncIsDetached);
 JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncDefaultComparator);
+JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncFill);
 JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncSort);
 JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncLength);
 JSC_DECLARE_HOST_FUNCTION(typedArrayViewPrivateFuncGetOriginalConstructor);
@@ -36,6 +36,12 @@
 #include <wtf/dtoa.h>
 #include <wtf/text/StringConcatenate.h>
 
+#if CPU(X86_SSE2)
+#include <emmintrin.h>
+#elif CPU(ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace JSC {
 
 template <typename CharType>
@@ -145,10 +151,12 @@ ALWAYS_INLINE const Identifier LiteralParser<CharType>::makeIdentifier(const LCh
         m_shortIdentifiers[characters[0]] = Identifier::fromString(vm, characters, length);
         return m_shortIdentifiers[characters[0]];
     }
-    if (!m_recentIdentifiers[characters[0]].isNull() && Identifier::equal(m_recentIdentifiers[characters[0]].impl(), characters, length))
-        return m_recentIdentifiers[characters[0]];
-    m_recentIdentifiers[characters[0]] = Identifier::fromString(vm, characters, length);
-    return m_recentIdentifiers[characters[0]];
+    RefPtr<AtomStringImpl>& recent = vm.recentIdentifiers.slotFor(characters, length);
+    if (recent && Identifier::equal(recent.get(), characters, length))
+        return Identifier::fromString(vm, recent.get());
+    Identifier result = Identifier::fromString(vm, characters, length);
+    recent = static_cast<AtomStringImpl*>(result.impl());
+    return result;
 }
 
 template <typename CharType>
@@ -166,10 +174,12 @@ ALWAYS_INLINE const Identifier LiteralParser<CharType>::makeIdentifier(const UCh
         m_shortIdentifiers[characters[0]] = Identifier::fromString(vm, characters, length);
         return m_shortIdentifiers[characters[0]];
     }
-    if (!m_recentIdentifiers[characters[0]].isNull() && Identifier::equal(m_recentIdentifiers[characters[0]].impl(), characters, length))
-        return m_recentIdentifiers[characters[0]];
-    m_recentIdentifiers[characters[0]] = Identifier::fromString(vm, characters, length);
-    return m_recentIdentifiers[characters[0]];
+    RefPtr<AtomStringImpl>& recent = vm.recentIdentifiers.slotFor(characters, length);
+    if (recent && Identifier::equal(recent.get(), characters, length))
+        return Identifier::fromString(vm, recent.get());
+    Identifier result = Identifier::fromString(vm, characters, length);
+    recent = static_cast<AtomStringImpl*>(result.impl());
+    return result;
 }
 
 // 256 Latin-1 codes
@@ -581,6 +591,73 @@ static ALWAYS_INLINE bool isSafeStringCharacter(UChar c, UChar terminator)
     return (c >= ' ' && (set == SafeStringCharacterSet::Strict || isLatin1(c)) && c != '\\' && c != terminator) || (c == '\t' && set != SafeStringCharacterSet::Strict);
 }
 
+// JSON.parse inputs are dominated by long string bodies with nothing to unescape. In strict mode a
+// string character is safe unless it is a control character, a backslash or the terminator, so whole
+// 16-character blocks can be checked at once before the scalar loop takes over at the first stop.
+static constexpr ptrdiff_t charactersPerSafeStringBlock = 16;
+
+#if CPU(X86_SSE2)
+
+static ALWAYS_INLINE bool isStrictSafeStringBlock(const LChar* ptr, LChar terminator)
+{
+    __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    __m128i stops = _mm_or_si128(_mm_cmpeq_epi8(characters, _mm_set1_epi8(terminator)), _mm_cmpeq_epi8(characters, _mm_set1_epi8('\\')));
+    stops = _mm_or_si128(stops, _mm_cmpeq_epi8(_mm_min_epu8(characters, _mm_set1_epi8(' ' - 1)), characters));
+    return !_mm_movemask_epi8(stops);
+}
+
+static ALWAYS_INLINE __m128i strictSafeStringStopsForHalfBlock(const UChar* ptr, UChar terminator)
+{
+    __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    __m128i stops = _mm_or_si128(_mm_cmpeq_epi16(characters, _mm_set1_epi16(terminator)), _mm_cmpeq_epi16(characters, _mm_set1_epi16('\\')));
+    // Bias the unsigned compare against ' ' so that a signed compare can do it.
+    __m128i biased = _mm_xor_si128(characters, _mm_set1_epi16(static_cast<int16_t>(0x8000)));
+    return _mm_or_si128(stops, _mm_cmplt_epi16(biased, _mm_set1_epi16(static_cast<int16_t>(' ' ^ 0x8000))));
+}
+
+static ALWAYS_INLINE bool isStrictSafeStringBlock(const UChar* ptr, UChar terminator)
+{
+    return !_mm_movemask_epi8(_mm_or_si128(strictSafeStringStopsForHalfBlock(ptr, terminator), strictSafeStringStopsForHalfBlock(ptr + 8, terminator)));
+}
+
+#elif CPU(ARM64)
+
+static ALWAYS_INLINE bool isStrictSafeStringBlock(const LChar* ptr, LChar terminator)
+{
+    uint8x16_t characters = vld1q_u8(ptr);
+    uint8x16_t stops = vorrq_u8(vceqq_u8(characters, vdupq_n_u8(terminator)), vceqq_u8(characters, vdupq_n_u8('\\')));
+    stops = vorrq_u8(stops, vcltq_u8(characters, vdupq_n_u8(' ')));
+    return !vmaxvq_u8(stops);
+}
+
+static ALWAYS_INLINE uint16x8_t strictSafeStringStopsForHalfBlock(const UChar* ptr, UChar terminator)
+{
+    uint16x8_t characters = vld1q_u16(reinterpret_cast<const uint16_t*>(ptr));
+    uint16x8_t stops = vorrq_u16(vceqq_u16(characters, vdupq_n_u16(terminator)), vceqq_u16(characters, vdupq_n_u16('\\')));
+    return vorrq_u16(stops, vcltq_u16(characters, vdupq_n_u16(' ')));
+}
+
+static ALWAYS_INLINE bool isStrictSafeStringBlock(const UChar* ptr, UChar terminator)
+{
+    return !vmaxvq_u16(vorrq_u16(strictSafeStringStopsForHalfBlock(ptr, terminator), strictSafeStringStopsForHalfBlock(ptr + 8, terminator)));
+}
+
+#else
+
+template <typename CharType> static ALWAYS_INLINE bool isStrictSafeStringBlock(const CharType*, CharType) { return false; }
+
+#endif
+
+template <typename CharType>
+static ALWAYS_INLINE const CharType* skipStrictSafeStringBlocks(const CharType* ptr, const CharType* end, CharType terminator)
+{
+    if (!Options::useVectorizedJSONStringScanning())
+        return ptr;
+    while (end - ptr >= charactersPerSafeStringBlock && isStrictSafeStringBlock(ptr, terminator))
+        ptr += charactersPerSafeStringBlock;
+    return ptr;
+}
+
 template <typename CharType>
 ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserToken<CharType>& token, CharType terminator)
 {
@@ -588,6 +665,7 @@ ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserT
     const CharType* runStart = m_ptr;
 
     if (m_mode == StrictJSON) {
+        m_ptr = skipStrictSafeStringBlocks(m_ptr, m_end, terminator);
         while (m_ptr < m_end && isSafeStringCharacter<SafeStringCharacterSet::Strict>(*m_ptr, terminator))
             ++m_ptr;
     } else {
@@ -613,6 +691,7 @@ TokenType LiteralParser<CharType>::Lexer::lexStringSlow(LiteralParserToken<CharT
     do {
         runStart = m_ptr;
         if (m_mode == StrictJSON) {
+            m_ptr = skipStrictSafeStringBlocks(m_ptr, m_end, terminator);
             while (m_ptr < m_end && isSafeStringCharacter<SafeStringCharacterSet::Strict>(*m_ptr, terminator))
                 ++m_ptr;
         } else {
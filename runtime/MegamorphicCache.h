@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "JSObject.h"
+#include "PropertySlot.h"
+#include "PutPropertySlot.h"
+#include "Structure.h"
+
+namespace JSC {
+
+// A VM-wide (StructureID, UniquedStringImpl*) -> PropertyOffset cache for get_by_id and put_by_id
+// sites whose inline caches have given up. Entries only describe plain data properties of
+// non-dictionary structures, whose layout can never change, so they are validated by structure
+// checks alone. Like HasOwnPropertyCache, it is cleared at the end of every GC, which takes care
+// of StructureIDs being reused.
+class MegamorphicCache {
+    WTF_MAKE_NONCOPYABLE(MegamorphicCache);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr uint32_t size = 2 * 1024;
+    static_assert(hasOneBitSet(size), "size should be a power of two.");
+    static constexpr uint32_t mask = size - 1;
+
+    struct GetEntry {
+        RefPtr<UniquedStringImpl> impl;
+        StructureID structureID { 0 };
+        // Zero when the property is an own property. Otherwise the property lives on holder, which
+        // is the mono proto of structureID.
+        StructureID holderStructureID { 0 };
+        JSObject* holder { nullptr };
+        PropertyOffset offset { invalidOffset };
+        unsigned attributes { 0 };
+    };
+
+    struct PutEntry {
+        RefPtr<UniquedStringImpl> impl;
+        StructureID structureID { 0 };
+        PropertyOffset offset { invalidOffset };
+    };
+
+    MegamorphicCache() = default;
+
+    ALWAYS_INLINE static uint32_t hash(StructureID structureID, UniquedStringImpl* impl)
+    {
+        return bitwise_cast<uint32_t>(structureID) + impl->hash();
+    }
+
+    // On a hit, fills slot the way the lookup that added the entry did.
+    ALWAYS_INLINE bool get(JSObject* object, UniquedStringImpl* impl, PropertySlot& slot)
+    {
+        StructureID id = object->structureID();
+        GetEntry& entry = m_getEntries[hash(id, impl) & mask];
+        if (entry.structureID != id || entry.impl.get() != impl)
+            return false;
+        JSObject* slotBase = object;
+        if (entry.holderStructureID) {
+            if (entry.holder->structureID() != entry.holderStructureID)
+                return false;
+            slotBase = entry.holder;
+        }
+        slot.setValue(slotBase, entry.attributes, slotBase->getDirect(entry.offset), entry.offset);
+        return true;
+    }
+
+    ALWAYS_INLINE bool put(VM& vm, JSObject* object, UniquedStringImpl* impl, JSValue value)
+    {
+        StructureID id = object->structureID();
+        PutEntry& entry = m_putEntries[hash(id, impl) & mask];
+        if (entry.structureID != id || entry.impl.get() != impl)
+            return false;
+        object->putDirect(vm, entry.offset, value);
+        return true;
+    }
+
+    void tryAddGet(VM&, JSObject*, UniquedStringImpl*, const PropertySlot&);
+    void tryAddPut(VM&, JSObject*, UniquedStringImpl*, const PutPropertySlot&);
+
+    void clear()
+    {
+        for (auto& entry : m_getEntries)
+            entry = GetEntry();
+        for (auto& entry : m_putEntries)
+            entry = PutEntry();
+    }
+
+private:
+    static bool isCacheableStructure(Structure* structure)
+    {
+        return !structure->typeInfo().prohibitsPropertyCaching()
+            && structure->propertyAccessesAreCacheable()
+            && !structure->isDictionary();
+    }
+
+    std::array<GetEntry, size> m_getEntries;
+    std::array<PutEntry, size> m_putEntries;
+};
+
+inline void MegamorphicCache::tryAddGet(VM& vm, JSObject* object, UniquedStringImpl* impl, const PropertySlot& slot)
+{
+    if (!slot.isCacheableValue() || slot.isTaintedByOpaqueObject())
+        return;
+    if (parseIndex(PropertyName(impl)))
+        return;
+    if (object->type() == PureForwardingProxyType || object->type() == ImpureProxyType)
+        return;
+
+    // Structures that need an impure property watchpoint can change what a lookup finds without a
+    // transition, and the cache has no watchpoint to notice.
+    Structure* structure = object->structure(vm);
+    if (!isCacheableStructure(structure) || structure->needImpurePropertyWatchpoint())
+        return;
+
+    GetEntry entry { RefPtr<UniquedStringImpl>(impl), structure->id(), 0, nullptr, slot.cachedOffset(), slot.attributes() };
+    JSObject* slotBase = slot.slotBase();
+    if (slotBase != object) {
+        // We only cache hits one prototype away. The property being absent from object then follows
+        // from object's structure, as long as looking it up is pure.
+        if (!structure->hasMonoProto() || structure->storedPrototypeObject() != slotBase)
+            return;
+        if (!structure->propertyAccessesAreCacheableForAbsence()
+            || structure->typeInfo().getOwnPropertySlotIsImpure()
+            || structure->typeInfo().getOwnPropertySlotIsImpureForPropertyAbsence())
+            return;
+        Structure* holderStructure = slotBase->structure(vm);
+        if (!isCacheableStructure(holderStructure) || holderStructure->needImpurePropertyWatchpoint() || holderStructure->typeInfo().getOwnPropertySlotIsImpure())
+            return;
+        entry.holderStructureID = holderStructure->id();
+        entry.holder = slotBase;
+    }
+
+    m_getEntries[hash(entry.structureID, impl) & mask] = WTFMove(entry);
+}
+
+inline void MegamorphicCache::tryAddPut(VM& vm, JSObject* object, UniquedStringImpl* impl, const PutPropertySlot& slot)
+{
+    if (!slot.isCacheablePut() || slot.type() != PutPropertySlot::ExistingProperty || slot.base() != object)
+        return;
+    if (parseIndex(PropertyName(impl)))
+        return;
+    if (object->type() == PureForwardingProxyType || object->type() == ImpureProxyType)
+        return;
+
+    Structure* structure = object->structure(vm);
+    if (!isCacheableStructure(structure))
+        return;
+
+    // Puts that hit the cache skip didReplaceProperty(), so invalidate the replacement watchpoint
+    // up front, as the Replace access case does.
+    structure->didCachePropertyReplacement(vm, slot.cachedOffset());
+    m_putEntries[hash(structure->id(), impl) & mask] = PutEntry { RefPtr<UniquedStringImpl>(impl), structure->id(), slot.cachedOffset() };
+}
+
+ALWAYS_INLINE MegamorphicCache* VM::ensureMegamorphicCache()
+{
+    if (UNLIKELY(!m_megamorphicCache))
+        m_megamorphicCache = makeUnique<MegamorphicCache>();
+    return m_megamorphicCache.get();
+}
+
+// Used by get_by_id and get_by_val sites whose inline cache gave up on caching, and by polymorphic LLInt get_by_id sites.
+ALWAYS_INLINE JSValue getWithMegamorphicCache(JSGlobalObject* globalObject, VM& vm, JSValue baseValue, PropertyName ident, PropertySlot& slot)
+{
+    if (!Options::useMegamorphicPropertyCache() || !baseValue.isObject())
+        return baseValue.get(globalObject, ident, slot);
+
+    MegamorphicCache* cache = vm.ensureMegamorphicCache();
+    JSObject* baseObject = asObject(baseValue);
+    if (cache->get(baseObject, ident.uid(), slot))
+        return slot.getValue(globalObject, ident);
+
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JSValue result = baseValue.get(globalObject, ident, slot);
+    RETURN_IF_EXCEPTION(scope, JSValue());
+    cache->tryAddGet(vm, baseObject, ident.uid(), slot);
+    return result;
+}
+
+// Used by put_by_id and put_by_val sites whose inline cache gave up on caching, and by polymorphic LLInt put_by_id sites.
+ALWAYS_INLINE void putWithMegamorphicCache(JSGlobalObject* globalObject, VM& vm, JSValue baseValue, PropertyName ident, JSValue value, PutPropertySlot& slot)
+{
+    if (!Options::useMegamorphicPropertyCache() || !baseValue.isObject()) {
+        baseValue.putInline(globalObject, ident, value, slot);
+        return;
+    }
+
+    MegamorphicCache* cache = vm.ensureMegamorphicCache();
+    JSObject* baseObject = asObject(baseValue);
+    if (cache->put(vm, baseObject, ident.uid(), value))
+        return;
+
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    baseValue.putInline(globalObject, ident, value, slot);
+    RETURN_IF_EXCEPTION(scope, void());
+    cache->tryAddPut(vm, baseObject, ident.uid(), slot);
+}
+
+} // namespace JSC
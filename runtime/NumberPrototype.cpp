@@ -492,7 +492,7 @@ static ALWAYS_INLINE JSString* int32ToStringInternal(VM& vm, int32_t value, int3
     }
 
     if (radix == 10)
-        return jsNontrivialString(vm, vm.numericStrings.add(value));
+        return jsDecimalInt32String(vm, value);
 
     return jsNontrivialString(vm, toStringWithRadixInternal(value, radix));
 
@@ -31,6 +31,8 @@
 
 namespace JSC {
 
+class JSString;
+
 class NumericStrings {
 public:
     ALWAYS_INLINE const String& add(double d)
@@ -66,8 +68,29 @@ public:
         entry.value = String::number(i);
         return entry.value;
     }
+
+    // JSStrings for small non-negative integers are cached as raw cells so that
+    // repeated conversions (array indices, loop counters) do not allocate. The
+    // cells are not kept alive by this cache; Heap::finalize clears it.
+    static constexpr unsigned smallIntJSStringCacheSize = 1024;
+
+    ALWAYS_INLINE JSString* cachedSmallIntJSString(int i) const
+    {
+        if (static_cast<unsigned>(i) < smallIntJSStringCacheSize)
+            return smallIntJSStringCache[i];
+        return nullptr;
+    }
+
+    ALWAYS_INLINE void cacheSmallIntJSString(int i, JSString* string)
+    {
+        if (static_cast<unsigned>(i) < smallIntJSStringCacheSize)
+            smallIntJSStringCache[i] = string;
+    }
+
+    void clearJSStringCache() { smallIntJSStringCache.fill(nullptr); }
+
 private:
-    static const size_t cacheSize = 64;
+    static const size_t cacheSize = 256;
 
     template<typename T>
     struct CacheEntry {
@@ -90,6 +113,7 @@ private:
     std::array<CacheEntry<int>, cacheSize> intCache;
     std::array<CacheEntry<unsigned>, cacheSize> unsignedCache;
     std::array<String, cacheSize> smallIntCache;
+    std::array<JSString*, smallIntJSStringCacheSize> smallIntJSStringCache { };
 };
 
 } // namespace JSC
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "JSObject.h"
+#include "Structure.h"
+#include <wtf/RefCountedArray.h>
+
+namespace JSC {
+
+// A VM-wide cache for copying all enumerable own data properties of one object into another, as
+// Object.assign() and object spread do. An entry says that copying from an object with structure
+// sourceStructureID into an object with structure targetStructureID adds every property as a new
+// one and ends up at resultStructureID. A hit therefore jumps the target straight to the result
+// structure and copies the values slot by slot, instead of looking up one transition per property.
+// Only non-dictionary structures are cached, since their layout never changes. Like
+// MegamorphicCache, it is cleared at the end of every GC, which takes care of StructureIDs being
+// reused.
+class ObjectCloneCache {
+    WTF_MAKE_NONCOPYABLE(ObjectCloneCache);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr uint32_t size = 256;
+    static_assert(hasOneBitSet(size), "size should be a power of two.");
+    static constexpr uint32_t mask = size - 1;
+
+    struct OffsetPair {
+        PropertyOffset source;
+        PropertyOffset target;
+    };
+
+    struct Entry {
+        StructureID sourceStructureID { 0 };
+        StructureID targetStructureID { 0 };
+        StructureID resultStructureID { 0 };
+        RefCountedArray<OffsetPair> offsets;
+    };
+
+    ObjectCloneCache() = default;
+
+    ALWAYS_INLINE static uint32_t hash(StructureID sourceStructureID, StructureID targetStructureID)
+    {
+        return WTF::pairIntHash(bitwise_cast<uint32_t>(sourceStructureID), bitwise_cast<uint32_t>(targetStructureID));
+    }
+
+    // Returns false, having done nothing, if the pair of structures is not cached.
+    bool tryCopy(VM&, JSObject* target, JSObject* source);
+
+    // Called after the properties of source have been copied into target one by one. Both
+    // structures are the ones from before the copy.
+    void tryAdd(VM&, Structure* sourceStructure, Structure* targetStructure, JSObject* target, const Vector<RefPtr<UniquedStringImpl>, 8>& properties, const Vector<PropertyOffset, 8>& sourceOffsets);
+
+    void clear()
+    {
+        for (auto& entry : m_entries)
+            entry = Entry();
+    }
+
+private:
+    std::array<Entry, size> m_entries;
+};
+
+inline bool ObjectCloneCache::tryCopy(VM& vm, JSObject* target, JSObject* source)
+{
+    Entry& entry = m_entries[hash(source->structureID(), target->structureID()) & mask];
+    if (entry.sourceStructureID != source->structureID() || entry.targetStructureID != target->structureID())
+        return false;
+
+    // Hold on to these, since allocating the butterfly may GC and clear the entry. Being on the
+    // stack keeps the result structure alive.
+    Structure* targetStructure = target->structure(vm);
+    Structure* resultStructure = vm.getStructure(entry.resultStructureID);
+    RefCountedArray<OffsetPair> offsets = entry.offsets;
+
+    size_t oldCapacity = targetStructure->outOfLineCapacity();
+    size_t newCapacity = resultStructure->outOfLineCapacity();
+    if (oldCapacity != newCapacity) {
+        Butterfly* newButterfly = target->allocateMoreOutOfLineStorage(vm, oldCapacity, newCapacity);
+        target->nukeStructureAndSetButterfly(vm, targetStructure->id(), newButterfly);
+    }
+    for (const OffsetPair& pair : offsets)
+        target->putDirect(vm, pair.target, source->getDirect(pair.source));
+    target->setStructure(vm, resultStructure);
+    return true;
+}
+
+inline void ObjectCloneCache::tryAdd(VM& vm, Structure* sourceStructure, Structure* targetStructure, JSObject* target, const Vector<RefPtr<UniquedStringImpl>, 8>& properties, const Vector<PropertyOffset, 8>& sourceOffsets)
+{
+    ASSERT(properties.size() == sourceOffsets.size());
+    Structure* resultStructure = target->structure(vm);
+    if (sourceStructure->isDictionary() || targetStructure->isDictionary() || resultStructure->isDictionary())
+        return;
+    // Every property has to have been added by the copy. Replacing an existing one would have
+    // needed a replacement watchpoint check that a hit does not do.
+    if (resultStructure->inlineSize() + resultStructure->outOfLineSize() != targetStructure->inlineSize() + targetStructure->outOfLineSize() + properties.size())
+        return;
+
+    Entry entry;
+    entry.sourceStructureID = sourceStructure->id();
+    entry.targetStructureID = targetStructure->id();
+    entry.resultStructureID = resultStructure->id();
+    entry.offsets = RefCountedArray<OffsetPair>(properties.size());
+    for (size_t i = 0; i < properties.size(); ++i) {
+        PropertyOffset targetOffset = resultStructure->get(vm, properties[i].get());
+        if (!isValidOffset(targetOffset))
+            return;
+        entry.offsets[i] = OffsetPair { sourceOffsets[i], targetOffset };
+    }
+    m_entries[hash(entry.sourceStructureID, entry.targetStructureID) & mask] = WTFMove(entry);
+}
+
+ALWAYS_INLINE ObjectCloneCache* VM::ensureObjectCloneCache()
+{
+    if (UNLIKELY(!m_objectCloneCache))
+        m_objectCloneCache = makeUnique<ObjectCloneCache>();
+    return m_objectCloneCache.get();
+}
+
+} // namespace JSC
@@ -24,7 +24,9 @@
 #include "BuiltinNames.h"
 #include "JSArray.h"
 #include "JSCInlines.h"
+#include "JSGlobalObjectFunctions.h"
 #include "JSImmutableButterfly.h"
+#include "ObjectCloneCache.h"
 #include "PropertyDescriptor.h"
 #include "PropertyNameArray.h"
 #include "Symbol.h"
@@ -276,6 +278,7 @@ JSC_DEFINE_HOST_FUNCTION(objectConstructorAssign, (JSGlobalObject* globalObject,
     bool targetCanPerformFastPut = jsDynamicCast<JSFinalObject*>(vm, target) && target->canPerformFastPutInlineExcludingProto(vm);
 
     Vector<RefPtr<UniquedStringImpl>, 8> properties;
+    Vector<PropertyOffset, 8> offsets;
     MarkedArgumentBuffer values;
     unsigned argsCount = callFrame->argumentCount();
     for (unsigned i = 1; i < argsCount; ++i) {
@@ -317,6 +320,11 @@ JSC_DEFINE_HOST_FUNCTION(objectConstructorAssign, (JSGlobalObject* globalObject,
             if (canPerformFastPropertyEnumerationForObjectAssign(source->structure(vm))) {
                 // |source| Structure does not have any getters. And target can perform fast put.
                 // So enumerating properties and putting properties are non observable.
+                ObjectCloneCache* cloneCache = Options::useObjectCloneCache() ? vm.ensureObjectCloneCache() : nullptr;
+                if (cloneCache && cloneCache->tryCopy(vm, target, source))
+                    continue;
+                Structure* sourceStructure = source->structure(vm);
+                Structure* targetStructure = target->structure(vm);
 
                 // FIXME: It doesn't seem like we should have to do this in two phases, but
                 // we're running into crashes where it appears that source is transitioning
@@ -327,6 +335,7 @@ JSC_DEFINE_HOST_FUNCTION(objectConstructorAssign, (JSGlobalObject* globalObject,
 
                 // Do not clear since Vector::clear shrinks the backing store.
                 properties.resize(0);
+                offsets.resize(0);
                 values.clear();
                 source->structure(vm)->forEachProperty(vm, [&] (const PropertyMapEntry& entry) -> bool {
                     if (entry.attributes & PropertyAttribute::DontEnum)
@@ -337,6 +346,7 @@ JSC_DEFINE_HOST_FUNCTION(objectConstructorAssign, (JSGlobalObject* globalObject,
                         return true;
 
                     properties.append(entry.key);
+                    offsets.append(entry.offset);
                     values.appendWithCrashOnOverflow(source->getDirect(entry.offset));
 
                     return true;
@@ -348,6 +358,8 @@ JSC_DEFINE_HOST_FUNCTION(objectConstructorAssign, (JSGlobalObject* globalObject,
                     PutPropertySlot putPropertySlot(target, true);
                     target->putOwnDataProperty(vm, properties[i].get(), values.at(i), putPropertySlot);
                 }
+                if (cloneCache)
+                    cloneCache->tryAdd(vm, sourceStructure, targetStructure, target, properties, offsets);
                 continue;
             }
         }
@@ -399,6 +411,20 @@ JSC_DEFINE_HOST_FUNCTION(objectConstructorValues, (JSGlobalObject* globalObject,
     JSObject* target = targetValue.toObject(globalObject);
     RETURN_IF_EXCEPTION(scope, { });
 
+    if (target->staticPropertiesReified(vm) && canPerformFastPropertyEnumerationForCopyDataProperties(target->structure(vm))) {
+        MarkedArgumentBuffer buffer;
+        target->structure(vm)->forEachProperty(vm, [&] (const PropertyMapEntry& entry) -> bool {
+            if (entry.attributes & PropertyAttribute::DontEnum)
+                return true;
+            // This also skips private names.
+            if (PropertyName(entry.key).isSymbol())
+                return true;
+            buffer.appendWithCrashOnOverflow(target->getDirect(entry.offset));
+            return true;
+        });
+        RELEASE_AND_RETURN(scope, JSValue::encode(constructArray(globalObject, static_cast<ArrayAllocationProfile*>(nullptr), buffer)));
+    }
+
     JSArray* values = constructEmptyArray(globalObject, nullptr);
     RETURN_IF_EXCEPTION(scope, { });
 
@@ -133,8 +133,12 @@ size_t normalizePrototypeChain(JSGlobalObject* globalObject, JSCell* base, bool&
         current = prototype.asCell();
         structure = current->structure(vm);
         if (structure->isDictionary()) {
-            if (structure->hasBeenFlattenedBefore())
-                return InvalidPrototypeChain;
+            if (structure->hasBeenFlattenedBefore()) {
+                if (!structure->isUncacheableDictionary())
+                    return InvalidPrototypeChain;
+                if (vm.dictionaryFlatteningPolicy.observeFlattenedDictionary(structure) != DictionaryFlatteningPolicy::Action::Flatten)
+                    return InvalidPrototypeChain;
+            }
             structure->flattenDictionaryStructure(vm, asObject(current));
         }
 
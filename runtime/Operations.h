@@ -262,10 +262,57 @@ ALWAYS_INLINE JSString* jsString(JSGlobalObject* globalObject, const String& u1,
     return JSString::create(vm, newString.releaseImpl().releaseNonNull());
 }
 
+template<typename CharacterType>
+ALWAYS_INLINE JSString* jsFlatStringFromRegisterArray(VM& vm, Register* strings, unsigned count, unsigned length)
+{
+    CharacterType* data;
+    String result = StringImpl::tryCreateUninitialized(length, data);
+    if (UNLIKELY(result.isNull()))
+        return nullptr;
+    for (unsigned i = 0; i < count; ++i) {
+        StringView view = *asString(strings[-static_cast<int>(i)].jsValue())->tryGetValueImpl();
+        view.getCharactersWithUpconvert(data);
+        data += view.length();
+    }
+    return JSString::create(vm, result.releaseImpl().releaseNonNull());
+}
+
 ALWAYS_INLINE JSValue jsStringFromRegisterArray(JSGlobalObject* globalObject, Register* strings, unsigned count)
 {
     VM& vm = getVM(globalObject);
     auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // When every operand is already a resolved string we know the final length up front. If the
+    // characters cost less than the rope cells needed to hold count fibers, build the flat string
+    // once, like jsString() does for three strings.
+    {
+        static_assert(JSString::MaxLength == std::numeric_limits<int32_t>::max(), "");
+        Checked<int32_t, RecordOverflow> length = 0;
+        bool is8Bit = true;
+        bool allResolved = true;
+        for (unsigned i = 0; i < count; ++i) {
+            JSValue v = strings[-static_cast<int>(i)].jsValue();
+            const StringImpl* impl = v.isString() ? asString(v)->tryGetValueImpl() : nullptr;
+            if (!impl) {
+                allResolved = false;
+                break;
+            }
+            length += impl->length();
+            is8Bit = is8Bit && impl->is8Bit();
+        }
+        if (allResolved && !length.hasOverflowed() && length.unsafeGet()) {
+            size_t flatSize = is8Bit ? StringImpl::headerSize<LChar>() + length.unsafeGet() : StringImpl::headerSize<UChar>() + length.unsafeGet() * sizeof(UChar);
+            if (flatSize < sizeof(JSRopeString) * (count / 2)) {
+                JSString* result = is8Bit
+                    ? jsFlatStringFromRegisterArray<LChar>(vm, strings, count, length.unsafeGet())
+                    : jsFlatStringFromRegisterArray<UChar>(vm, strings, count, length.unsafeGet());
+                if (UNLIKELY(!result))
+                    return throwOutOfMemoryError(globalObject, scope);
+                return result;
+            }
+        }
+    }
+
     JSRopeString::RopeBuilder<RecordOverflow> ropeBuilder(vm);
 
     for (unsigned i = 0; i < count; ++i) {
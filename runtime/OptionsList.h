@@ -88,6 +88,7 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, useBaselineJIT, true, Normal, "allows the baseline JIT to be used if true") \
     v(Bool, useDFGJIT, true, Normal, "allows the DFG JIT to be used if true") \
     v(Bool, useRegExpJIT, jitEnabledByDefault(), Normal, "allows the RegExp JIT to be used if true") \
+    v(Bool, useLinearTimeRegExpEngine, false, Normal, "match RegExps that need no backtracking semantics with a linear-time NFA simulation instead of the JIT or the backtracking interpreter") \
     v(Bool, useDOMJIT, is64Bit(), Normal, "allows the DOMJIT to be used if true") \
     \
     v(Bool, reportMustSucceedExecutableAllocations, false, Normal, nullptr) \
@@ -99,6 +100,8 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, crashOnDisallowedVMEntry, ASSERT_ENABLED, Normal, "Forces a crash if we attempt to enter the VM when disallowed") \
     v(Bool, crashIfCantAllocateJITMemory, false, Normal, nullptr) \
     v(Unsigned, jitMemoryReservationSize, 0, Normal, "Set this number to change the executable allocation size in ExecutableAllocatorFixedVMPool. (In bytes.)") \
+    v(Bool, useTransparentHugePagesForJIT, false, Normal, "On Linux, ask for transparent huge pages (madvise MADV_HUGEPAGE) over the executable memory pool.") \
+    v(Size, jitTransparentHugePageRegionSize, 0, Normal, "How many bytes at the start of the executable memory pool useTransparentHugePagesForJIT covers. 0 means the whole pool.") \
     \
     v(Bool, forceCodeBlockLiveness, false, Normal, nullptr) \
     v(Bool, forceICFailure, false, Normal, nullptr) \
@@ -106,8 +109,15 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Unsigned, repatchCountForCoolDown, 8, Normal, nullptr) \
     v(Unsigned, initialCoolDownCount, 20, Normal, nullptr) \
     v(Unsigned, repatchBufferingCountdown, 8, Normal, nullptr) \
+    v(Unsigned, dictionaryReflatteningThreshold, 32, Normal, "number of inline cache attempts on a previously flattened dictionary, between two collections, before it is flattened again") \
+    v(Bool, useBiasedShiftForLargeArrays, false, Normal, "move large Int32 or Contiguous arrays to ArrayStorage on shift(), where shifting from the front does not move the remaining elements; arrays with holes then use the generic shift") \
+    v(Unsigned, minimumArrayLengthForBiasedShift, 1024, Normal, "length at which useBiasedShiftForLargeArrays moves an array to ArrayStorage") \
+    v(Unsigned, maximumStructureTransitionFanOut, 1024, Normal, "number of property transitions a structure may have before further property additions turn the object into a dictionary; 0 means no limit") \
+    v(Bool, recordStructureTransitionSites, false, Normal, "count new property transitions by the source location that created them, for $vm.structureTransitionSites()") \
     \
     v(Bool, dumpGeneratedBytecodes, false, Normal, nullptr) \
+    v(Bool, useBytecodeJumpThreading, true, Normal, "retarget bytecode jumps that land on an unconditional jump to that jump's destination when a code block is generated") \
+    v(Bool, dumpGeneratedBytecodePairs, false, Normal, "counts adjacent opcode pairs in all generated bytecode and dumps the most frequent ones at exit") \
     v(Bool, dumpGeneratedWasmBytecodes, false, Normal, nullptr) \
     v(Bool, dumpBytecodeLivenessResults, false, Normal, nullptr) \
     v(Bool, validateBytecode, false, Normal, nullptr) \
@@ -166,11 +176,13 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, verboseCallLink, false, Normal, nullptr) \
     v(Bool, verboseCompilationQueue, false, Normal, nullptr) \
     v(Bool, reportCompileTimes, false, Normal, "dumps JS function signature and the time it took to compile in all tiers") \
+    v(Bool, reportCompilationQueueLatency, false, Normal, "dumps how long each DFG and FTL plan waited in its worklist before a compiler thread took it") \
     v(Bool, reportBaselineCompileTimes, false, Normal, "dumps JS function signature and the time it took to BaselineJIT compile") \
     v(Bool, reportDFGCompileTimes, false, Normal, "dumps JS function signature and the time it took to DFG and FTL compile") \
     v(Bool, reportFTLCompileTimes, false, Normal, "dumps JS function signature and the time it took to FTL compile") \
     v(Bool, reportTotalCompileTimes, false, Normal, nullptr) \
     v(Bool, reportTotalPhaseTimes, false, Normal, "This prints phase times at the end of running script inside jsc.cpp") \
+    v(Bool, collectCompilerPhaseStatistics, false, Normal, "Aggregates per-phase and per-plan compile time histograms, which $vm.compilerPhaseStatistics() returns") \
     v(Bool, reportParseTimes, false, Normal, "dumps JS function signature and the time it took to parse") \
     v(Bool, reportBytecodeCompileTimes, false, Normal, "dumps JS function signature and the time it took to bytecode compile") \
     v(Bool, countParseTimes, false, Normal, "counts parse times") \
@@ -205,6 +217,13 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Double, concurrentGCPeriodMS, 2, Normal, nullptr) \
     v(Bool, useStochasticMutatorScheduler, true, Normal, nullptr) \
     v(Double, minimumGCPauseMS, 0.3, Normal, nullptr) \
+    v(Size, heapBudgetSoftLimit, 0, Normal, "If non-zero, all Heaps in the process report to a coordinator that asks the most profitable ones to collect once their combined footprint exceeds this many bytes") \
+    v(Size, heapBudgetReportInterval, 512 * KB, Normal, "how many bytes a Heap may allocate between footprint reports to the heapBudgetSoftLimit coordinator") \
+    v(Unsigned, heapBudgetCollectionsPerRequest, 2, Normal, "how many Heaps the heapBudgetSoftLimit coordinator asks to collect each time the limit is crossed") \
+    v(Bool, usePauseTimeMutatorScheduler, false, Normal, "If true, the concurrent GC schedules its pauses to stay under maximumGCPauseMS while keeping minimumMutatorUtilizationInWindow") \
+    v(Double, maximumGCPauseMS, 2, Normal, "pause time target used by usePauseTimeMutatorScheduler") \
+    v(Double, mutatorUtilizationWindowMS, 10, Normal, "length of the window over which usePauseTimeMutatorScheduler guarantees mutator utilization") \
+    v(Double, minimumMutatorUtilizationInWindow, 0.5, Normal, "fraction of every mutatorUtilizationWindowMS window that usePauseTimeMutatorScheduler leaves to the mutator") \
     v(Double, gcPauseScale, 0.3, Normal, nullptr) \
     v(Double, gcIncrementBytes, 10000, Normal, nullptr) \
     v(Double, gcIncrementMaxBytes, 100000, Normal, nullptr) \
@@ -223,6 +242,8 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     \
     v(Bool, useFTLJIT, true, Normal, "allows the FTL JIT to be used if true") \
     v(Bool, validateFTLOSRExitLiveness, false, Normal, nullptr) \
+    v(Bool, useProfiledBranchWeights, true, Normal, "use the jtrue/jfalse directions recorded by the LLInt and Baseline JIT as branch weights") \
+    v(Unsigned, minimumProfiledBranchCount, 100, Normal, "how many times a branch must have executed before its recorded directions are trusted") \
     v(Unsigned, defaultB3OptLevel, 2, Normal, nullptr) \
     v(Bool, b3AlwaysFailsBeforeCompile, false, Normal, nullptr) \
     v(Bool, b3AlwaysFailsBeforeLink, false, Normal, nullptr) \
@@ -231,6 +252,9 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, enableJITDebugAssertions, ASSERT_ENABLED, Normal, nullptr) \
     v(Bool, useAccessInlining, true, Normal, nullptr) \
     v(Unsigned, maxAccessVariantListSize, 8, Normal, nullptr) \
+    v(Bool, useObjectCloneCache, true, Normal, "let Object.assign() and object spread copy the properties of a previously seen source structure into a previously seen target structure slot by slot") \
+    v(Bool, useMegamorphicPropertyCache, true, Normal, "consult a VM-wide property offset cache from get_by_id and put_by_id sites that gave up on inline caching") \
+    v(Bool, useLLIntPolymorphicGetByIdCache, true, Normal, "record the self accesses of polymorphic LLInt get_by_id sites in a VM-wide table that the LLInt probes inline") \
     v(Bool, usePolyvariantDevirtualization, true, Normal, nullptr) \
     v(Bool, usePolymorphicAccessInlining, true, Normal, nullptr) \
     v(Unsigned, maxPolymorphicAccessInliningListSize, 8, Normal, nullptr) \
@@ -253,6 +277,8 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, useConcurrentJIT, true, Normal, "allows the DFG / FTL compilation in threads other than the executing JS thread") \
     v(Unsigned, numberOfDFGCompilerThreads, computeNumberOfWorkerThreads(3, 2) - 1, Normal, nullptr) \
     v(Unsigned, numberOfFTLCompilerThreads, computeNumberOfWorkerThreads(MAXIMUM_NUMBER_OF_FTL_COMPILER_THREADS, 2) - 1, Normal, nullptr) \
+    v(Bool, useCostAwareCompilationQueue, true, Normal, "DFG and FTL compiler threads take the queued plan with the smallest bytecode cost instead of the oldest one.") \
+    v(Double, maximumCompilationQueueDelayMilliseconds, 50, Normal, "A queued DFG or FTL plan that has waited this long is compiled next regardless of its cost.") \
     v(Int32, priorityDeltaOfDFGCompilerThreads, computePriorityDeltaOfWorkerThreads(-1, 0), Normal, nullptr) \
     v(Int32, priorityDeltaOfFTLCompilerThreads, computePriorityDeltaOfWorkerThreads(-2, 0), Normal, nullptr) \
     v(Int32, priorityDeltaOfWasmCompilerThreads, computePriorityDeltaOfWorkerThreads(-1, 0), Normal, nullptr) \
@@ -271,6 +297,7 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Unsigned, maximumFunctionForConstructInlineCandidateBytecoodeCost, 100, Normal, nullptr) \
     \
     v(Unsigned, maximumFTLCandidateBytecodeCost, 20000, Normal, nullptr) \
+    v(Bool, useFTLLoopRegionCompilation, false, Normal, "If true, hot loops in code blocks over maximumFTLCandidateBytecodeCost are FTL compiled for OSR entry alone, OSR exiting wherever control leaves the loop.") \
     \
     /* Depth of inline stack, so 1 = no inlining, 2 = one level, etc. */ \
     v(Unsigned, maximumInliningDepth, 5, Normal, "maximum allowed inlining depth.  Depth of 1 means no inlining") \
@@ -317,6 +344,7 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Unsigned, osrExitCountForReoptimizationFromLoop, 5, Normal, nullptr) \
     \
     v(Unsigned, reoptimizationRetryCounterMax, 0, Normal, nullptr)  \
+    v(Bool, shareReoptimizationRetryCounter, false, Normal, "start a new CodeBlock's reoptimization backoff where the other CodeBlocks of its UnlinkedCodeBlock left off") \
     \
     v(Unsigned, minimumOptimizationDelay, 1, Normal, nullptr) \
     v(Unsigned, maximumOptimizationDelay, 5, Normal, nullptr) \
@@ -331,10 +359,24 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     \
     v(Unsigned, minimumNumberOfScansBetweenRebalance, 100, Normal, nullptr) \
     v(Unsigned, numberOfGCMarkers, computeNumberOfGCMarkers(8), Normal, nullptr) \
+    v(Bool, useWorkStealingMarking, false, Normal, "If true, parallel markers publish full mark stack segments to per-marker lock-free deques that idle markers steal from, instead of donating through the shared mark stack") \
+    v(Bool, useNUMAAwareMarking, false, Normal, "If true, parallel GC markers are spread across NUMA nodes and pinned to the CPUs of their node") \
     v(Bool, useParallelMarkingConstraintSolver, true, Normal, nullptr) \
+    v(Bool, useStructureIDTableCompaction, false, Normal, "rebuild the StructureID free list toward low indices at full collections, at the cost of less random StructureIDs") \
+    v(Bool, useParallelWeakReaping, true, Normal, "reap weak handles of disjoint WeakSets on the GC helper threads") \
+    v(Unsigned, minimumWeakSetsForParallelReaping, 64, Normal, "below this many active WeakSets, reaping stays on the collector thread") \
+    v(Double, maximumIdleGCDeferralMilliseconds, 1000, Normal, "after an embedder's idle notification, GC activity timers wait up to this long for the next one before collecting on their own") \
+    v(Bool, useStringDeduplication, false, Normal, "at full collections started outside the VM, point JSStrings that solely own a StringImpl at an equal one so the copy is freed") \
+    v(Unsigned, stringDeduplicationMinimumLength, 64, Normal, "strings shorter than this are never considered by useStringDeduplication") \
     v(Unsigned, opaqueRootMergeThreshold, 1000, Normal, nullptr) \
     v(Double, minHeapUtilization, 0.8, Normal, nullptr) \
     v(Double, minMarkedBlockUtilization, 0.9, Normal, nullptr) \
+    v(Bool, useSparseBlockAvoidance, false, Normal, "If true, allocation prefers densely occupied blocks over sparse ones so that sparse blocks can drain and be returned to the OS") \
+    v(Double, sparseMarkedBlockUtilization, 0.3, Normal, "blocks whose marked occupancy is below this fraction are considered sparse by useSparseBlockAvoidance") \
+    v(Bool, useArrayBufferPool, false, Normal, "If true, freed ArrayBuffer contents between 64KB and 4MB are kept in size classes for reuse by later ArrayBuffers") \
+    v(Size, arrayBufferPoolMaximumBytes, 32 * MB, Normal, "the most memory that useArrayBufferPool keeps for reuse") \
+    v(Bool, useEmptyBlockRetention, false, Normal, "If true, empty MarkedBlocks are kept for reuse only in proportion to recent block demand, and the rest are freed after each collection") \
+    v(Double, emptyBlockRetentionHalfLifeMilliseconds, 10000, Normal, "half-life of the block demand that useEmptyBlockRetention keeps empty blocks for") \
     v(Unsigned, slowPathAllocsBetweenGCs, 0, Normal, "force a GC on every Nth slow path alloc, where N is specified by this option") \
     \
     v(Double, percentCPUPerMBForFullTimer, 0.0003125, Normal, nullptr) \
@@ -347,6 +389,9 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, useZombieMode, false, Normal, "debugging option to scribble over dead objects with 0xbadbeef0") \
     v(Bool, useImmortalObjects, false, Normal, "debugging option to keep all objects alive forever") \
     v(Bool, sweepSynchronously, false, Normal, "debugging option to sweep all dead objects synchronously at GC end before resuming mutator") \
+    v(Bool, useConcurrentSweeping, false, Normal, "If true, free lists for blocks without destructors are built on a helper thread between collections") \
+    v(Bool, usePreciseAllocationRecycling, false, Normal, "If true, the memory of dead medium-sized PreciseAllocations is kept in size-segregated lists and reused instead of being returned to malloc") \
+    v(Unsigned, maxRecycledPreciseAllocationBytes, 4 * MB, Normal, "upper bound on the bytes of memory kept by usePreciseAllocationRecycling") \
     v(Unsigned, maxSingleAllocationSize, 0, Configurable, "debugging option to limit individual allocations to a max size (0 = limit not set, N = limit size in bytes)") \
     \
     v(GCLogLevel, logGC, GCLogging::None, Normal, "debugging option to log GC activity (0 = None, 1 = Basic, 2 = Verbose)") \
@@ -356,13 +401,18 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, forceDidDeferGCWork, false, Normal, "If true, we will force all DeferGC destructions to perform a GC.") \
     v(Unsigned, gcMaxHeapSize, 0, Normal, nullptr) \
     v(Unsigned, forceRAMSize, 0, Normal, nullptr) \
-    v(Bool, recordGCPauseTimes, false, Normal, nullptr) \
+    v(Bool, recordGCPauseTimes, false, Normal, "records collector pauses, phase times and marking constraint costs for $vm.gcPauseStatistics()") \
     v(Bool, dumpHeapStatisticsAtVMDestruction, false, Normal, nullptr) \
     v(Bool, forceCodeBlockToJettisonDueToOldAge, false, Normal, "If true, this means that anytime we can jettison a CodeBlock due to old age, we do.") \
     v(Bool, useEagerCodeBlockJettisonTiming, false, Normal, "If true, the time slices for jettisoning a CodeBlock due to old age are shrunk significantly.") \
+    v(Double, memoryPressureColdCodeSeconds, 10, Normal, "under moderate memory pressure, CodeBlocks that have not executed for this many seconds are jettisoned") \
+    v(Size, codeMemoryBudget, 0, Normal, "If non-zero, each full GC jettisons the least recently executed CodeBlocks until the machine code of the rest fits in this many bytes, and UnlinkedCodeBlocks can be jettisoned") \
     \
     v(Bool, useTypeProfiler, false, Normal, nullptr) \
+    v(Unsigned, typeProfilerLogSize, 50000, Normal, "Number of entries the type profiler log holds before the mutator has to process it.") \
+    v(Unsigned, typeProfilerJITSamplingPeriod, 1, Normal, "If greater than 1, the baseline JIT and the DFG only log values at one in this many type profiling sites. The TypeSets of the other sites are partial: they only hold the types seen by the LLInt, and miss types that only show up once the code has tiered up.") \
     v(Bool, useControlFlowProfiler, false, Normal, nullptr) \
+    v(Bool, useControlFlowProfilerCoverageMode, false, Normal, "If true, the JIT tiers record only whether each basic block has executed, with a single byte store, so that profiled code can tier up to the FTL. Execution counts are then only meaningful as zero or non-zero.") \
     \
     v(Bool, useSamplingProfiler, false, Normal, nullptr) \
     v(Unsigned, sampleInterval, 1000, Normal, "Time between stack traces in microseconds.") \
@@ -371,6 +421,9 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Unsigned, samplingProfilerTopBytecodesCount, 40, Normal, "Number of top bytecodes to report when using the command line interface.") \
     v(OptionString, samplingProfilerPath, nullptr, Normal, "The path to the directory to write sampiling profiler output to. This probably will not work with WK2 unless the path is in the sandbox.") \
     v(Bool, sampleCCode, false, Normal, "Causes the sampling profiler to record profiling data for C frames.") \
+    v(Bool, samplingProfilerAggregateStackTraces, false, Normal, "Causes the sampling profiler to fold stack traces into a bounded call tree as they are processed instead of keeping every trace.") \
+    v(Unsigned, samplingProfilerMaxUnprocessedStackTraces, 10000, Normal, "When aggregating, the number of stack traces buffered until the next processing. The oldest trace is dropped when full.") \
+    v(Unsigned, samplingProfilerMaxCallTreeNodes, 100000, Normal, "When aggregating, the maximum number of call tree nodes. Deeper frames of samples that need more nodes are attributed to their deepest recorded caller.") \
     \
     v(Bool, alwaysGeneratePCToCodeOriginMap, false, Normal, "This will make sure we always generate a PCToCodeOriginMap for JITed code.") \
     \
@@ -416,6 +469,7 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, logPhaseTimes, false, Normal, nullptr) \
     v(Double, rareBlockPenalty, 0.001, Normal, nullptr) \
     v(Unsigned, maximumTmpsForGraphColoring, 25000, Normal, "The maximum number of tmps an Air program can have before always register allocating with Linear Scan") \
+    v(Unsigned, maximumInstsForGraphColoring, 80000, Normal, "The maximum number of instructions an Air program can have before always register allocating with Linear Scan") \
     v(Bool, airLinearScanVerbose, false, Normal, nullptr) \
     v(Bool, airLinearScanSpillsEverything, false, Normal, nullptr) \
     v(Bool, airForceBriggsAllocator, false, Normal, nullptr) \
@@ -428,6 +482,7 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Unsigned, maxB3TailDupBlockSize, 3, Normal, nullptr) \
     v(Unsigned, maxB3TailDupBlockSuccessors, 3, Normal, nullptr) \
     v(Bool, useB3HoistLoopInvariantValues, false, Normal, nullptr) \
+    v(Bool, useB3WasmBoundsCheckElimination, true, Normal, "Hoist Wasm bounds checks out of loops and remove ones implied by dominating checks.") \
     \
     v(Bool, useDollarVM, false, Restricted, "installs the $vm debugging tool in global objects") \
     v(OptionString, functionOverrides, nullptr, Restricted, "file with debugging overrides for function bodies") \
@@ -451,7 +506,22 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, useSuperSampler, false, Normal, nullptr) \
     \
     v(Bool, useSourceProviderCache, true, Normal, "If false, the parser will not use the source provider cache. It's good to verify everything works when this is false. Because the cache is so successful, it can mask bugs.") \
+    v(Bool, useParserArenaRecycling, true, Normal, "If true, each VM keeps the memory of finished parses for reuse by later parses") \
+    v(Unsigned, maximumRecycledParserArenaPools, 16, Normal, "maximum number of freeable parser arena pools a VM retains for reuse") \
+    v(Bool, useVectorizedLexerScanning, true, Normal, "If true, the lexer skips runs of plain identifier, literal and comment characters a block at a time") \
+    v(Bool, useVectorizedJSONStringScanning, true, Normal, "If true, JSON.parse skips runs of plain string characters a block at a time") \
+    v(Bool, useJSONStringifyObjectShapeCache, true, Normal, "If true, JSON.stringify caches property names, quoted keys and offsets per plain object structure") \
+    v(Bool, useRopeFiberWalking, true, Normal, "If true, substring, charAt, charCodeAt, startsWith and endsWith read large ropes through their fibers instead of resolving them") \
+    v(Unsigned, maximumRopeFiberWalkDepth, 32, Normal, "maximum number of rope levels walked before a rope is resolved instead") \
+    v(Unsigned, minimumRopeLengthForFiberWalking, 1024, Normal, "ropes shorter than this are resolved rather than walked for single character and prefix reads") \
+    v(Bool, useRopeAppendBuffers, true, Normal, "If true, ropes that append to a long string are resolved into a buffer with spare capacity that later appends can fill in place") \
+    v(Unsigned, minimumRopeLengthForAppendBuffer, 4096, Normal, "ropes shorter than this are always resolved into a buffer of their own") \
+    v(Bool, useExactSizeStringSplit, true, Normal, "If true, String.prototype.split on a single character counts the pieces first and allocates the result array at its final length") \
+    v(Unsigned, minimumTypedArrayLengthForRadixSort, 256, Normal, "typed arrays at least this long are radix sorted by %TypedArray%.prototype.sort without a comparator") \
     v(Bool, useCodeCache, true, Normal, "If false, the unlinked byte code cache will not be used.") \
+    v(Unsigned, codeCacheMaximumBytes, 0, Normal, "If non-zero, a hard limit on the estimated bytes of the unlinked code cache; the least recently used entries are evicted to stay under it") \
+    v(Bool, useSharedBytecodeRepository, false, Normal, "If true, program and module bytecode is published to a process-wide repository so that other VMs loading the same source can decode it instead of compiling it") \
+    v(Unsigned, sharedBytecodeRepositoryMaximumBytes, 64 * MB, Normal, "maximum bytes of serialized bytecode and source kept in the process-wide bytecode repository") \
     \
     v(Bool, useWebAssembly, true, Normal, "Expose the WebAssembly global object.") \
     \
@@ -469,13 +539,21 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Int32, thresholdForOMGOptimizeSoon, 500, Normal, nullptr) \
     v(Int32, omgTierUpCounterIncrementForLoop, 1, Normal, "The amount the tier up counter is incremented on each loop backedge.") \
     v(Int32, omgTierUpCounterIncrementForEntry, 15, Normal, "The amount the tier up counter is incremented on each function entry.") \
+    v(Bool, prioritizeWebAssemblyTierUpPlans, true, Normal, "Schedule OMG and OSR entry plans ahead of compiling new modules on the Wasm worklist.") \
+    v(Bool, interleaveWebAssemblyCompilationPlans, true, Normal, "Rotate Wasm worklist plans of the same priority after each partial compile, so that one big module cannot hold up the others.") \
+    v(Bool, reportWasmWorklistQueueLatency, false, Normal, "dumps how long each Wasm plan waited on the worklist before a thread started working on it") \
+    v(Bool, reportWasmTierUpTimes, false, Normal, "dumps how long each Wasm function ran in BBQ before its OMG code was installed, and how long OMG took to compile it") \
     /* FIXME: enable fast memories on iOS and pre-allocate them. https://bugs.webkit.org/show_bug.cgi?id=170774 */ \
     v(Bool, useWebAssemblyFastMemory, OS_CONSTANT(EFFECTIVE_ADDRESS_WIDTH) >= 48, Normal, "If true, we will try to use a 32-bit address space with a signal handler to bounds check wasm memory.") \
     v(Bool, logWebAssemblyMemory, false, Normal, nullptr) \
+    v(Bool, useWebAssemblyBoundsCheckingMemoryReservations, OS_CONSTANT(EFFECTIVE_ADDRESS_WIDTH) >= 48, Normal, "If true, bounds checked WebAssembly memories that are not shared reserve address space to grow into, so that memory.grow can commit pages in place instead of copying. The reservation is at most webAssemblyBoundsCheckingMemoryReservationFactor times the current size, and no more than the declared maximum.") \
+    v(Size, webAssemblyBoundsCheckingMemoryDefaultReservation, 1024 * MB, Normal, "The most bytes a bounds checked WebAssembly memory without a declared maximum reserves.") \
+    v(Unsigned, webAssemblyBoundsCheckingMemoryReservationFactor, 4, Normal, "A bounds checked WebAssembly memory reserves at most this many times its current size, or one WebAssembly page if it is empty.") \
     v(Unsigned, webAssemblyFastMemoryRedzonePages, 128, Normal, "WebAssembly fast memories use 4GiB virtual allocations, plus a redzone (counted as multiple of 64KiB WebAssembly pages) at the end to catch reg+imm accesses which exceed 32-bit, anything beyond the redzone is explicitly bounds-checked") \
     v(Bool, crashIfWebAssemblyCantFastMemory, false, Normal, "If true, we will crash if we can't obtain fast memory for wasm.") \
     v(Bool, crashOnFailedWebAssemblyValidate, false, Normal, "If true, we will crash if we can't validate a wasm module instead of throwing an exception.") \
     v(Unsigned, maxNumWebAssemblyFastMemories, 4, Normal, nullptr) \
+    v(Unsigned, maxNumWebAssemblyRecycledFastMemories, 2, Normal, "How many freed fast memory reservations are kept, zeroed, for reuse instead of being unmapped.") \
     v(Bool, useFastTLSForWasmContext, true, Normal, "If true, we will store context in fast TLS. If false, we will pin it to a register.") \
     v(Bool, wasmBBQUsesAir, true, Normal, nullptr) \
     v(Bool, useWasmLLInt, true, Normal, nullptr) \
@@ -489,10 +567,14 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Size, webAssemblyBBQAirModeThreshold, isIOS() ? (10 * MB) : 0, Normal, "If 0, we always use BBQ Air. If Wasm module code size hits this threshold, we compile Wasm module with B3 BBQ mode.") \
     v(Bool, useWebAssemblyStreamingApi, enableWebAssemblyStreamingApi, Normal, "Allow to run WebAssembly's Streaming API") \
     v(Bool, useEagerWebAssemblyModuleHashing, false, Normal, "Unnamed WebAssembly modules are identified in backtraces through their hash, if available.") \
+    v(Bool, useWebAssemblyModuleCache, false, Normal, "Share validated WebAssembly modules, and the code compiled for them, between compilations of identical bytes in this process.") \
+    v(Size, webAssemblyModuleCacheMaximumBytes, 256 * MB, Normal, "Total size of module bytes the WebAssembly module cache may retain.") \
+    v(Unsigned, maximumWebAssemblyInlineBulkMemorySize, 32, Normal, "memory.copy and memory.fill with a constant length up to this many bytes are inlined by the B3 Wasm tiers.") \
     v(Bool, useWebAssemblyReferences, false, Normal, "Allow types from the wasm references spec.") \
     v(Bool, useWebAssemblyMultiValues, true, Normal, "Allow types from the wasm mulit-values spec.") \
     v(Bool, useWebAssemblyThreading, true, Normal, "Allow instructions from the wasm threading spec.") \
     v(Bool, useWeakRefs, true, Normal, "Expose the WeakRef constructor.") \
+    v(Double, finalizationRegistryCleanupSliceMilliseconds, 0, Normal, "If non-zero, a FinalizationRegistry stops calling its cleanup callback after this many milliseconds and schedules the rest of its cleanup for later.") \
     v(Bool, useIntlDateTimeFormatDayPeriod, true, Normal, "Expose the Intl.DateTimeFormat dayPeriod feature.") \
     v(Bool, useIntlDateTimeFormatRangeToParts, true, Normal, "Expose the Intl.DateTimeFormat#formatRangeToParts feature.") \
     v(Bool, useAtMethod, false, Normal, "Expose the at() method on Array, %TypedArray%, and String.") \
@@ -506,6 +588,10 @@ JS_EXPORT_PRIVATE bool canUseJITCage();
     v(Bool, traceBaselineJITExecution, false, Normal, nullptr) \
     v(Unsigned, thresholdForGlobalLexicalBindingEpoch, UINT_MAX, Normal, "Threshold for global lexical binding epoch. If the epoch reaches to this value, CodeBlock metadata for scope operations will be revised globally. It needs to be greater than 1.") \
     v(OptionString, diskCachePath, nullptr, Restricted, nullptr) \
+    v(Bool, useAsynchronousBytecodeCacheWrites, true, Normal, "write committed bytecode cache files on a background thread instead of the thread that ran the code") \
+    v(Bool, useBytecodeCacheInstructionsInPlace, true, Normal, "use instruction streams directly from a memory-mapped bytecode cache instead of copying them") \
+    v(Bool, useBytecodeCacheTierUpHints, true, Normal, "store whether each code block got optimized in the bytecode cache and use it to scale tier-up thresholds on load") \
+    v(Bool, useBytecodeCachePreParseData, true, Normal, "store the parser's function boundary cache in the bytecode cache and restore it on load so that lazily parsed functions are pre-parsed at most once") \
     v(Bool, forceDiskCache, false, Restricted, nullptr) \
     v(Bool, validateAbstractInterpreterState, false, Restricted, nullptr) \
     v(Double, validateAbstractInterpreterStateProbability, 0.5, Normal, nullptr) \
@@ -195,8 +195,9 @@ public:
     // Copy this PropertyTable, ensuring the copy has at least the capacity provided.
     PropertyTable* copy(VM&, unsigned newCapacity);
 
-#ifndef NDEBUG
     size_t sizeInMemory();
+
+#ifndef NDEBUG
     void checkConsistency();
 #endif
     
@@ -256,6 +257,16 @@ private:
     // Check if capacity is available.
     bool canInsert();
 
+    // Index slots hold a 1-based entry index. While the table is small enough, the top byte of
+    // a slot also holds bits of the key's hash, so most colliding probes are rejected without
+    // loading the entry they point to.
+    static constexpr unsigned EntryIndexBits = 24;
+    static constexpr unsigned EntryIndexMask = (1u << EntryIndexBits) - 1;
+    bool usesHashTags() const { return deletedEntryIndex() <= EntryIndexMask; }
+    unsigned hashTagMask() const { return usesHashTags() ? ~EntryIndexMask : 0; }
+    unsigned entryIndexMask() const { return usesHashTags() ? EntryIndexMask : std::numeric_limits<unsigned>::max(); }
+    unsigned hashTagFor(unsigned hash) const { return usesHashTags() ? ((hash >> 16) & 0xff) << EntryIndexBits : 0; }
+
     unsigned m_indexSize;
     unsigned m_indexMask;
     unsigned* m_index;
@@ -300,12 +311,18 @@ inline PropertyTable::find_iterator PropertyTable::find(const KeyType& key)
     ++propertyMapHashTableStats->numFinds;
 #endif
 
+    unsigned tag = hashTagFor(hash);
+    unsigned tagMask = hashTagMask();
+    unsigned indexMask = entryIndexMask();
     while (true) {
-        unsigned entryIndex = m_index[hash & m_indexMask];
-        if (entryIndex == EmptyEntryIndex)
+        unsigned slot = m_index[hash & m_indexMask];
+        if (slot == EmptyEntryIndex)
             return std::make_pair((ValueType*)nullptr, hash & m_indexMask);
-        if (key == table()[entryIndex - 1].key)
-            return std::make_pair(&table()[entryIndex - 1], hash & m_indexMask);
+        if ((slot & tagMask) == tag) {
+            unsigned entryIndex = slot & indexMask;
+            if (key == table()[entryIndex - 1].key)
+                return std::make_pair(&table()[entryIndex - 1], hash & m_indexMask);
+        }
 
 #if DUMP_PROPERTYMAP_STATS
         ++propertyMapHashTableStats->numCollisions;
@@ -313,7 +330,7 @@ inline PropertyTable::find_iterator PropertyTable::find(const KeyType& key)
 
 #if DUMP_PROPERTYMAP_COLLISIONS
         dataLog("PropertyTable collision for ", key, " (", hash, ")\n");
-        dataLog("Collided with ", table()[entryIndex - 1].key, "(", IdentifierRepHash::hash(table()[entryIndex - 1].key), ")\n");
+        dataLog("Collided with ", table()[(slot & indexMask) - 1].key, "(", IdentifierRepHash::hash(table()[(slot & indexMask) - 1].key), ")\n");
 #endif
 
         hash++;
@@ -335,13 +352,19 @@ inline PropertyTable::ValueType* PropertyTable::get(const KeyType& key)
     ++propertyMapHashTableStats->numLookups;
 #endif
 
+    unsigned tag = hashTagFor(hash);
+    unsigned tagMask = hashTagMask();
+    unsigned indexMask = entryIndexMask();
     while (true) {
-        unsigned entryIndex = m_index[hash & m_indexMask];
-        if (entryIndex == EmptyEntryIndex)
+        unsigned slot = m_index[hash & m_indexMask];
+        if (slot == EmptyEntryIndex)
             return nullptr;
-        if (key == table()[entryIndex - 1].key) {
-            ASSERT(!m_deletedOffsets || !m_deletedOffsets->contains(table()[entryIndex - 1].offset));
-            return &table()[entryIndex - 1];
+        if ((slot & tagMask) == tag) {
+            unsigned entryIndex = slot & indexMask;
+            if (key == table()[entryIndex - 1].key) {
+                ASSERT(!m_deletedOffsets || !m_deletedOffsets->contains(table()[entryIndex - 1].offset));
+                return &table()[entryIndex - 1];
+            }
         }
 
 #if DUMP_PROPERTYMAP_STATS
@@ -377,7 +400,7 @@ inline std::pair<PropertyTable::find_iterator, bool> WARN_UNUSED_RETURN Property
 
     // Allocate a slot in the hashtable, and set the index to reference this.
     unsigned entryIndex = usedCount() + 1;
-    m_index[iter.second] = entryIndex;
+    m_index[iter.second] = entryIndex | hashTagFor(IdentifierRepHash::hash(entry.key));
     iter.first = &table()[entryIndex - 1];
     *iter.first = entry;
 
@@ -475,7 +498,6 @@ inline PropertyTable* PropertyTable::copy(VM& vm, unsigned newCapacity)
     return PropertyTable::clone(vm, newCapacity, *this);
 }
 
-#ifndef NDEBUG
 inline size_t PropertyTable::sizeInMemory()
 {
     size_t result = sizeof(PropertyTable) + dataSize();
@@ -483,7 +505,6 @@ inline size_t PropertyTable::sizeInMemory()
         result += (m_deletedOffsets->capacity() * sizeof(PropertyOffset));
     return result;
 }
-#endif
 
 inline void PropertyTable::reinsert(const ValueType& entry)
 {
@@ -492,13 +513,18 @@ inline void PropertyTable::reinsert(const ValueType& entry)
 #endif
 
     // Used to insert a value known not to be in the table, and where
-    // we know capacity to be available.
+    // we know capacity to be available. Since the key cannot be present, only
+    // an empty slot needs to be found; no keys are compared.
     ASSERT(canInsert());
-    find_iterator iter = find(entry.key);
-    ASSERT(!iter.first);
+    ASSERT(!find(entry.key).first);
+
+    unsigned hash = IdentifierRepHash::hash(entry.key);
+    unsigned tag = hashTagFor(hash);
+    while (m_index[hash & m_indexMask] != EmptyEntryIndex)
+        ++hash;
 
     unsigned entryIndex = usedCount() + 1;
-    m_index[iter.second] = entryIndex;
+    m_index[hash & m_indexMask] = entryIndex | tag;
     table()[entryIndex - 1] = entry;
 
     ++m_keyCount;
@@ -82,6 +82,67 @@ void ProxyObject::finishCreation(VM& vm, JSGlobalObject* globalObject, JSValue t
     m_handler.set(vm, this, handler);
 }
 
+JSValue ProxyObject::getHandlerTrap(JSGlobalObject* globalObject, JSObject* handler, HandlerTrap trap, CallData& callData, const String& errorMessage)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    HandlerTrapCache& cache = handlerTrapCache(trap);
+    JSValue method;
+    if (cache.holder && handler->structure(vm) == cache.handlerStructure.get() && cache.holder->structure(vm) == cache.holderStructure.get())
+        method = cache.holder->getDirect(cache.offset);
+    else {
+        const Identifier& name = trap == HandlerTrap::Get ? vm.propertyNames->get : vm.propertyNames->set;
+        PropertySlot slot(handler, PropertySlot::InternalMethodType::Get);
+        bool hasProperty = handler->getPropertySlot(globalObject, name, slot);
+        RETURN_IF_EXCEPTION(scope, { });
+        if (hasProperty) {
+            method = slot.getValue(globalObject, name);
+            RETURN_IF_EXCEPTION(scope, { });
+        } else
+            method = jsUndefined();
+
+        cache.holder.clear();
+        if (hasProperty && slot.isCacheableValue()) {
+            JSObject* holder = slot.slotBase();
+            Structure* handlerStructure = handler->structure(vm);
+            Structure* holderStructure = holder->structure(vm);
+            // A trap found on the handler's prototype is only cached if the handler's structure also
+            // proves that the handler itself does not have the trap.
+            bool holderIsReachable = holder == handler
+                || (!handlerStructure->hasPolyProto() && handlerStructure->storedPrototype() == JSValue(holder)
+                    && handlerStructure->propertyAccessesAreCacheableForAbsence()
+                    && !handlerStructure->typeInfo().getOwnPropertySlotIsImpure()
+                    && !handlerStructure->typeInfo().getOwnPropertySlotIsImpureForPropertyAbsence());
+            if (holderIsReachable
+                && !handlerStructure->isDictionary() && handlerStructure->propertyAccessesAreCacheable()
+                && !holderStructure->isDictionary() && holderStructure->propertyAccessesAreCacheable()
+                && !holderStructure->typeInfo().getOwnPropertySlotIsImpure()) {
+                cache.handlerStructure.set(vm, this, handlerStructure);
+                cache.holderStructure.set(vm, this, holderStructure);
+                cache.offset = slot.cachedOffset();
+                cache.holder.set(vm, this, holder);
+            }
+        }
+    }
+
+    if (!method.isCell()) {
+        if (method.isUndefinedOrNull())
+            return jsUndefined();
+
+        throwVMTypeError(globalObject, scope, errorMessage);
+        return jsUndefined();
+    }
+
+    callData = JSC::getCallData(vm, method);
+    if (callData.type == CallData::Type::None) {
+        throwVMTypeError(globalObject, scope, errorMessage);
+        return jsUndefined();
+    }
+
+    return method;
+}
+
 static const ASCIILiteral s_proxyAlreadyRevokedErrorMessage { "Proxy has already been revoked. No more operations are allowed to be performed on it"_s };
 
 static JSValue performProxyGet(JSGlobalObject* globalObject, ProxyObject* proxyObject, JSValue receiver, PropertyName propertyName)
@@ -117,7 +178,7 @@ static JSValue performProxyGet(JSGlobalObject* globalObject, ProxyObject* proxyO
 
     JSObject* handler = jsCast<JSObject*>(handlerValue);
     CallData callData;
-    JSValue getHandler = handler->getMethod(globalObject, callData, vm.propertyNames->get, "'get' property of a Proxy's handler object should be callable"_s);
+    JSValue getHandler = proxyObject->getHandlerTrap(globalObject, handler, ProxyObject::HandlerTrap::Get, callData, "'get' property of a Proxy's handler object should be callable"_s);
     RETURN_IF_EXCEPTION(scope, { });
 
     if (getHandler.isUndefined())
@@ -398,7 +459,7 @@ bool ProxyObject::performPut(JSGlobalObject* globalObject, JSValue putValue, JSV
 
     JSObject* handler = jsCast<JSObject*>(handlerValue);
     CallData callData;
-    JSValue setMethod = handler->getMethod(globalObject, callData, vm.propertyNames->set, "'set' property of a Proxy's handler should be callable"_s);
+    JSValue setMethod = getHandlerTrap(globalObject, handler, HandlerTrap::Set, callData, "'set' property of a Proxy's handler should be callable"_s);
     RETURN_IF_EXCEPTION(scope, false);
     JSObject* target = this->target();
     if (setMethod.isUndefined())
@@ -1166,6 +1227,11 @@ void ProxyObject::visitChildren(JSCell* cell, SlotVisitor& visitor)
 
     visitor.append(thisObject->m_target);
     visitor.append(thisObject->m_handler);
+    for (HandlerTrapCache* cache : { &thisObject->m_getTrapCache, &thisObject->m_setTrapCache }) {
+        visitor.append(cache->handlerStructure);
+        visitor.append(cache->holderStructure);
+        visitor.append(cache->holder);
+    }
 }
 
 } // namespace JSC
@@ -74,6 +74,14 @@ public:
     void revoke(VM&);
     bool isRevoked() const;
 
+    // Looks up a trap on the handler like JSObject::getMethod(), remembering where it was found.
+    // Handlers are usually shared, unchanging objects, so later lookups for the same trap only
+    // need to check the handler's Structure (and its prototype's, if the trap lives there) and
+    // load the trap from a known offset. The value is reloaded each time, so reassigning the
+    // trap needs no invalidation; adding or removing properties changes the Structure.
+    enum class HandlerTrap : uint8_t { Get, Set };
+    JSValue getHandlerTrap(JSGlobalObject*, JSObject* handler, HandlerTrap, CallData&, const String& errorMessage);
+
 private:
     JS_EXPORT_PRIVATE ProxyObject(VM&, Structure*);
     JS_EXPORT_PRIVATE void finishCreation(VM&, JSGlobalObject*, JSValue target, JSValue handler);
@@ -108,8 +116,20 @@ private:
     void performGetOwnEnumerablePropertyNames(JSGlobalObject*, PropertyNameArray&);
     bool performSetPrototype(JSGlobalObject*, JSValue prototype, bool shouldThrowIfCantSet);
 
+    struct HandlerTrapCache {
+        // The structures are kept alive so that their StructureIDs cannot be reused by other structures.
+        WriteBarrier<Structure> handlerStructure;
+        WriteBarrier<Structure> holderStructure;
+        PropertyOffset offset { invalidOffset };
+        WriteBarrier<JSObject> holder;
+    };
+
+    HandlerTrapCache& handlerTrapCache(HandlerTrap trap) { return trap == HandlerTrap::Get ? m_getTrapCache : m_setTrapCache; }
+
     WriteBarrier<JSObject> m_target;
     WriteBarrier<Unknown> m_handler;
+    HandlerTrapCache m_getTrapCache;
+    HandlerTrapCache m_setTrapCache;
     bool m_isCallable : 1;
     bool m_isConstructible : 1;
 };
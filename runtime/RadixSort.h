@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <wtf/FastMalloc.h>
+#include <wtf/StdLibExtras.h>
+
+namespace JSC {
+
+// Sorts unsigned keys in ascending order with a least significant digit radix sort, one byte per pass.
+// Passes on which every key has the same digit are skipped, so narrow value ranges cost fewer passes.
+// Returns false, leaving the keys untouched, if the scratch buffer could not be allocated.
+template<typename UnsignedType>
+bool radixSort(UnsignedType* keys, size_t length)
+{
+    static_assert(std::is_unsigned<UnsignedType>::value, "radixSort sorts unsigned keys");
+    constexpr unsigned digitCount = sizeof(UnsignedType);
+    constexpr unsigned radix = 256;
+
+    if (length < 2)
+        return true;
+
+    void* memory = nullptr;
+    if (!tryFastMalloc(length * sizeof(UnsignedType)).getValue(memory))
+        return false;
+    UnsignedType* scratch = static_cast<UnsignedType*>(memory);
+
+    std::array<std::array<size_t, radix>, digitCount> histograms { };
+    for (size_t i = 0; i < length; ++i) {
+        UnsignedType key = keys[i];
+        for (unsigned digit = 0; digit < digitCount; ++digit)
+            histograms[digit][(key >> (digit * 8)) & (radix - 1)]++;
+    }
+
+    UnsignedType* source = keys;
+    UnsignedType* destination = scratch;
+    for (unsigned digit = 0; digit < digitCount; ++digit) {
+        auto& histogram = histograms[digit];
+        if (histogram[(source[0] >> (digit * 8)) & (radix - 1)] == length)
+            continue;
+
+        size_t offset = 0;
+        for (auto& count : histogram) {
+            size_t bucketSize = count;
+            count = offset;
+            offset += bucketSize;
+        }
+        for (size_t i = 0; i < length; ++i) {
+            UnsignedType key = source[i];
+            destination[histogram[(key >> (digit * 8)) & (radix - 1)]++] = key;
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != keys)
+        memcpy(keys, source, length * sizeof(UnsignedType));
+    fastFree(scratch);
+    return true;
+}
+
+} // namespace JSC
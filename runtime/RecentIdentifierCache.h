@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <array>
+#include <wtf/text/AtomStringImpl.h>
+
+namespace JSC {
+
+// Remembers the atoms most recently produced for JSON property names, so that parsing the same
+// shape of document again (the common case for an API client) finds its keys without going
+// through the atom string table. It lives on the VM to survive from one JSON.parse to the next.
+class RecentIdentifierCache {
+public:
+    static constexpr unsigned capacity = 512;
+
+    template<typename CharacterType>
+    ALWAYS_INLINE RefPtr<AtomStringImpl>& slotFor(const CharacterType* characters, unsigned length)
+    {
+        ASSERT(length);
+        unsigned hash = static_cast<unsigned>(characters[0]);
+        hash = hash * 31 + static_cast<unsigned>(characters[length - 1]);
+        hash = hash * 31 + length;
+        if (length > 2)
+            hash = hash * 31 + static_cast<unsigned>(characters[length / 2]);
+        return m_atoms[hash & (capacity - 1)];
+    }
+
+    void clear()
+    {
+        for (auto& atom : m_atoms)
+            atom = nullptr;
+    }
+
+private:
+    std::array<RefPtr<AtomStringImpl>, capacity> m_atoms;
+};
+
+} // namespace JSC
@@ -181,6 +181,13 @@ void RegExp::finishCreation(VM& vm)
     }
 }
 
+void RegExp::finishCreation(VM& vm, unsigned numSubpatterns, std::unique_ptr<RareData>&& rareData)
+{
+    Base::finishCreation(vm);
+    m_numSubpatterns = numSubpatterns;
+    m_rareData = WTFMove(rareData);
+}
+
 void RegExp::destroy(JSCell* cell)
 {
     RegExp* thisObject = static_cast<RegExp*>(cell);
@@ -213,12 +220,43 @@ RegExp* RegExp::create(VM& vm, const String& patternString, OptionSet<Yarr::Flag
     return vm.regExpCache()->lookupOrCreate(patternString, flags);
 }
 
+RegExp* RegExp::createWithoutCachingOrParsing(VM& vm, const String& patternString, OptionSet<Yarr::Flags> flags, unsigned numSubpatterns, std::unique_ptr<RareData>&& rareData)
+{
+    RegExp* regExp = new (NotNull, allocateCell<RegExp>(vm.heap)) RegExp(vm, patternString, flags);
+    regExp->finishCreation(vm, numSubpatterns, WTFMove(rareData));
+    return regExp;
+}
+
+RegExp* RegExp::createWithoutParsing(VM& vm, const String& patternString, OptionSet<Yarr::Flags> flags, unsigned numSubpatterns, std::unique_ptr<RareData>&& rareData)
+{
+    return vm.regExpCache()->lookupOrCreateWithoutParsing(patternString, flags, numSubpatterns, WTFMove(rareData));
+}
+
 
 static std::unique_ptr<Yarr::BytecodePattern> byteCodeCompilePattern(VM* vm, Yarr::YarrPattern& pattern, Yarr::ErrorCode& errorCode)
 {
     return Yarr::byteCompile(pattern, &vm->m_regExpAllocator, errorCode, &vm->m_regExpAllocatorLock);
 }
 
+bool RegExp::compileLinearTimeMatcherIfPossible(VM* vm, Yarr::YarrPattern& pattern)
+{
+    if (!Options::useLinearTimeRegExpEngine())
+        return false;
+
+    auto matcher = Yarr::LinearTimeMatcher::tryCreate(pattern);
+    if (!matcher)
+        return false;
+
+    m_state = ByteCode;
+    m_regExpBytecode = byteCodeCompilePattern(vm, pattern, m_constructionErrorCode);
+    if (!m_regExpBytecode) {
+        m_state = ParseError;
+        return true;
+    }
+    m_regExpBytecode->m_linearTimeMatcher = WTFMove(matcher);
+    return true;
+}
+
 void RegExp::byteCodeCompileIfNecessary(VM* vm)
 {
     if (m_regExpBytecode)
@@ -255,6 +293,9 @@ void RegExp::compile(VM* vm, Yarr::YarrCharSize charSize)
         m_state = ByteCode;
     }
 
+    if (compileLinearTimeMatcherIfPossible(vm, pattern))
+        return;
+
 #if ENABLE(YARR_JIT)
     if (!pattern.containsUnsignedLengthPattern() && Options::useRegExpJIT()
 #if !ENABLE(YARR_JIT_BACKREFERENCES)
@@ -319,6 +360,9 @@ void RegExp::compileMatchOnly(VM* vm, Yarr::YarrCharSize charSize)
         m_state = ByteCode;
     }
 
+    if (compileLinearTimeMatcherIfPossible(vm, pattern))
+        return;
+
 #if ENABLE(YARR_JIT)
     if (!pattern.containsUnsignedLengthPattern() && Options::useRegExpJIT()
 #if !ENABLE(YARR_JIT_BACKREFERENCES)
@@ -154,6 +154,7 @@ private:
     };
 
     void byteCodeCompileIfNecessary(VM*);
+    bool compileLinearTimeMatcherIfPossible(VM*, Yarr::YarrPattern&);
 
     void compile(VM*, Yarr::YarrCharSize);
     void compileIfNecessary(VM&, Yarr::YarrCharSize);
@@ -180,6 +181,12 @@ private:
         HashMap<String, unsigned> m_namedGroupToParenIndex;
     };
 
+    // For patterns that were already validated, e.g. when they were written to the
+    // bytecode cache, this skips the parse finishCreation(VM&) would do.
+    static RegExp* createWithoutParsing(VM&, const String&, OptionSet<Yarr::Flags>, unsigned numSubpatterns, std::unique_ptr<RareData>&&);
+    static RegExp* createWithoutCachingOrParsing(VM&, const String&, OptionSet<Yarr::Flags>, unsigned numSubpatterns, std::unique_ptr<RareData>&&);
+    void finishCreation(VM&, unsigned numSubpatterns, std::unique_ptr<RareData>&&);
+
     String m_patternString;
     RegExpState m_state { NotCompiled };
     OptionSet<Yarr::Flags> m_flags;
@@ -39,7 +39,20 @@ RegExp* RegExpCache::lookupOrCreate(const String& patternString, OptionSet<Yarr:
     if (RegExp* regExp = m_weakCache.get(key))
         return regExp;
 
-    RegExp* regExp = RegExp::createWithoutCaching(*m_vm, patternString, flags);
+    return addToWeakCache(key, RegExp::createWithoutCaching(*m_vm, patternString, flags));
+}
+
+RegExp* RegExpCache::lookupOrCreateWithoutParsing(const String& patternString, OptionSet<Yarr::Flags> flags, unsigned numSubpatterns, std::unique_ptr<RegExp::RareData>&& rareData)
+{
+    RegExpKey key(flags, patternString);
+    if (RegExp* regExp = m_weakCache.get(key))
+        return regExp;
+
+    return addToWeakCache(key, RegExp::createWithoutCachingOrParsing(*m_vm, patternString, flags, numSubpatterns, WTFMove(rareData)));
+}
+
+RegExp* RegExpCache::addToWeakCache(const RegExpKey& key, RegExp* regExp)
+{
 #if ENABLE(REGEXP_TRACING)
     m_vm->addRegExpToTrace(regExp);
 #endif
@@ -78,19 +91,23 @@ void RegExpCache::addToStrongCache(RegExp* regExp)
         m_nextEntryInStrongCache = 0;
 }
 
-void RegExpCache::deleteAllCode()
+size_t RegExpCache::deleteAllCode()
 {
     for (int i = 0; i < maxStrongCacheableEntries; i++)
         m_strongCache[i].clear();
     m_nextEntryInStrongCache = 0;
 
+    size_t bytesReleased = 0;
     RegExpCacheMap::iterator end = m_weakCache.end();
     for (RegExpCacheMap::iterator it = m_weakCache.begin(); it != end; ++it) {
         RegExp* regExp = it->value.get();
         if (!regExp) // Skip zombies.
             continue;
+        size_t sizeWithCode = RegExp::estimatedSize(regExp, *m_vm);
         regExp->deleteCode();
+        bytesReleased += sizeWithCode - RegExp::estimatedSize(regExp, *m_vm);
     }
+    return bytesReleased;
 }
 
 }
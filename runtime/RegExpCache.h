@@ -49,7 +49,8 @@ class RegExpCache final : private WeakHandleOwner {
 
 public:
     RegExpCache(VM* vm);
-    void deleteAllCode();
+    // Returns the bytes of compiled code, both bytecode and JIT code, that were released.
+    size_t deleteAllCode();
 
     RegExp* ensureEmptyRegExp(VM& vm)
     {
@@ -68,6 +69,8 @@ private:
     RegExp* ensureEmptyRegExpSlow(VM&);
 
     RegExp* lookupOrCreate(const WTF::String& patternString, OptionSet<Yarr::Flags>);
+    RegExp* lookupOrCreateWithoutParsing(const WTF::String& patternString, OptionSet<Yarr::Flags>, unsigned numSubpatterns, std::unique_ptr<RegExp::RareData>&&);
+    RegExp* addToWeakCache(const RegExpKey&, RegExp*);
     void addToStrongCache(RegExp*);
     RegExpCacheMap m_weakCache; // Holds all regular expressions currently live.
     int m_nextEntryInStrongCache;
@@ -52,6 +52,11 @@ public:
     MatchResult performMatch(JSGlobalObject*, RegExp*, JSString*, const String&, int startOffset);
     void recordMatch(VM&, JSGlobalObject*, RegExp*, JSString*, const MatchResult&);
 
+    // Like performMatch, but leaves the cached result alone. Loops that cannot be
+    // observed between iterations use these and recordMatch() the last match only.
+    MatchResult performMatchWithoutRecording(JSGlobalObject*, RegExp*, const String&, int startOffset, int** ovector);
+    MatchResult performMatchWithoutRecording(JSGlobalObject*, RegExp*, const String&, int startOffset);
+
     static ptrdiff_t offsetOfCachedResult() { return OBJECT_OFFSETOF(RegExpGlobalData, m_cachedResult); }
 
 private:
@@ -75,6 +75,27 @@ ALWAYS_INLINE MatchResult RegExpGlobalData::performMatch(JSGlobalObject* owner,
     return result;
 }
 
+ALWAYS_INLINE MatchResult RegExpGlobalData::performMatchWithoutRecording(JSGlobalObject* owner, RegExp* regExp, const String& input, int startOffset, int** ovector)
+{
+    ASSERT(owner);
+    VM& vm = owner->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    int position = regExp->match(owner, input, startOffset, m_ovector);
+    RETURN_IF_EXCEPTION(scope, MatchResult::failed());
+
+    *ovector = m_ovector.data();
+    if (position == -1)
+        return MatchResult::failed();
+    ASSERT(m_ovector[0] == position);
+    return MatchResult(position, m_ovector[1]);
+}
+
+ALWAYS_INLINE MatchResult RegExpGlobalData::performMatchWithoutRecording(JSGlobalObject* owner, RegExp* regExp, const String& input, int startOffset)
+{
+    ASSERT(owner);
+    return regExp->match(owner, input, startOffset);
+}
+
 ALWAYS_INLINE void RegExpGlobalData::recordMatch(VM& vm, JSGlobalObject* owner, RegExp* regExp, JSString* string, const MatchResult& result)
 {
     ASSERT(result);
@@ -428,6 +428,10 @@ void SamplingProfiler::takeSample(const AbstractLocker&, Seconds& stackTraceProc
                     stackTrace.uncheckedAppend(frame);
                 }
 
+                if (Options::samplingProfilerAggregateStackTraces() && m_unprocessedStackTraces.size() >= std::max(1u, Options::samplingProfilerMaxUnprocessedStackTraces())) {
+                    m_unprocessedStackTraces.removeFirst();
+                    m_droppedStackTraces++;
+                }
                 m_unprocessedStackTraces.append(UnprocessedStackTrace { nowTime, machinePC, topFrameIsLLInt, llintPC, WTFMove(stackTrace) });
 
                 if (didRunOutOfVectorSpace)
@@ -647,9 +651,87 @@ void SamplingProfiler::processUnverifiedStackTraces(const AbstractLocker&)
             if (!unprocessedStackFrame.cCodePC)
                 storeCalleeIntoLastFrame(unprocessedStackFrame);
         }
+
+        if (Options::samplingProfilerAggregateStackTraces()) {
+            addToCallTree(stackTrace);
+            m_stackTraces.removeLast();
+        }
     }
 
     m_unprocessedStackTraces.clear();
+
+    if (Options::samplingProfilerAggregateStackTraces()) {
+        // Only the representative frames in the call tree still point into the heap.
+        m_liveCellPointers.clear();
+        for (CallTreeNode& node : m_callTree) {
+            if (node.frame.executable)
+                m_liveCellPointers.add(node.frame.executable);
+            if (node.frame.callee)
+                m_liveCellPointers.add(node.frame.callee);
+            if (node.frame.machineLocation)
+                m_liveCellPointers.add(node.frame.machineLocation->second);
+        }
+    }
+}
+
+static bool isSameCallTreeFrame(const SamplingProfiler::StackFrame& a, const SamplingProfiler::StackFrame& b)
+{
+    if (a.frameType != b.frameType)
+        return false;
+
+    switch (a.frameType) {
+    case SamplingProfiler::FrameType::Executable:
+        return a.executable == b.executable
+            && a.semanticLocation.lineNumber == b.semanticLocation.lineNumber
+            && a.semanticLocation.columnNumber == b.semanticLocation.columnNumber;
+    case SamplingProfiler::FrameType::Wasm:
+#if ENABLE(WEBASSEMBLY)
+        return a.wasmIndexOrName == b.wasmIndexOrName;
+#else
+        return true;
+#endif
+    case SamplingProfiler::FrameType::Host:
+        return a.callee == b.callee;
+    case SamplingProfiler::FrameType::C:
+        return a.cCodePC == b.cCodePC;
+    case SamplingProfiler::FrameType::Unknown:
+        return true;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return false;
+}
+
+void SamplingProfiler::addToCallTree(const StackTrace& stackTrace)
+{
+    ASSERT(m_lock.isLocked());
+    if (m_callTree.isEmpty())
+        m_callTree.append(CallTreeNode { StackFrame(), std::numeric_limits<unsigned>::max(), 0, { } });
+
+    // Frames are ordered from the top of the stack, so walk them backwards from the root.
+    unsigned nodeIndex = 0;
+    for (size_t i = stackTrace.frames.size(); i--;) {
+        const StackFrame& frame = stackTrace.frames[i];
+        unsigned childIndex = std::numeric_limits<unsigned>::max();
+        for (unsigned candidate : m_callTree[nodeIndex].children) {
+            if (isSameCallTreeFrame(m_callTree[candidate].frame, frame)) {
+                childIndex = candidate;
+                break;
+            }
+        }
+
+        if (childIndex == std::numeric_limits<unsigned>::max()) {
+            if (m_callTree.size() >= Options::samplingProfilerMaxCallTreeNodes()) {
+                m_truncatedStackTraces++;
+                break;
+            }
+            childIndex = m_callTree.size();
+            m_callTree.append(CallTreeNode { frame, nodeIndex, 0, { } });
+            m_callTree[nodeIndex].children.append(childIndex);
+        }
+        nodeIndex = childIndex;
+    }
+
+    m_callTree[nodeIndex].selfSamples++;
 }
 
 void SamplingProfiler::visit(SlotVisitor& slotVisitor)
@@ -718,6 +800,9 @@ void SamplingProfiler::clearData(const AbstractLocker&)
     m_stackTraces.clear();
     m_liveCellPointers.clear();
     m_unprocessedStackTraces.clear();
+    m_callTree.clear();
+    m_droppedStackTraces = 0;
+    m_truncatedStackTraces = 0;
 }
 
 String SamplingProfiler::StackFrame::nameFromCallee(VM& vm)
@@ -974,6 +1059,91 @@ String SamplingProfiler::stackTracesAsJSON()
     return json.toString();
 }
 
+String SamplingProfiler::drainCallTreeAsPprofJSON()
+{
+    DeferGC deferGC(m_vm.heap);
+    auto locker = holdLock(m_lock);
+
+    {
+        HeapIterationScope heapIterationScope(m_vm.heap);
+        processUnverifiedStackTraces(locker);
+    }
+
+    // pprof refers to strings by their index in a table whose first entry is the empty string.
+    Vector<String> stringTable { emptyString() };
+    HashMap<String, unsigned> stringIndices;
+    auto stringIndex = [&] (const String& string) -> unsigned {
+        if (string.isEmpty())
+            return 0;
+        auto result = stringIndices.add(string, stringTable.size());
+        if (result.isNewEntry)
+            stringTable.append(string);
+        return result.iterator->value;
+    };
+
+    // Each call tree node becomes a location. Nodes for the same function share a function entry.
+    HashMap<String, unsigned> functionIds;
+    StringBuilder functions;
+    StringBuilder locations;
+    for (unsigned nodeIndex = 1; nodeIndex < m_callTree.size(); ++nodeIndex) {
+        StackFrame& frame = m_callTree[nodeIndex].frame;
+        String name = frame.displayName(m_vm);
+        String url = frame.url();
+        int startLine = frame.functionStartLine();
+        auto result = functionIds.add(makeString(name, '\n', url, '\n', startLine), functionIds.size() + 1);
+        if (result.isNewEntry) {
+            if (result.iterator->value > 1)
+                functions.append(',');
+            functions.append("{\"id\":", result.iterator->value, ",\"name\":", stringIndex(name), ",\"filename\":", stringIndex(url), ",\"startLine\":", std::max(startLine, 0), '}');
+        }
+
+        if (nodeIndex > 1)
+            locations.append(',');
+        unsigned line = frame.hasExpressionInfo() ? frame.lineNumber() : 0;
+        locations.append("{\"id\":", nodeIndex, ",\"line\":[{\"functionId\":", result.iterator->value, ",\"line\":", line, "}]}");
+    }
+
+    StringBuilder json;
+    json.append("{\"sampleType\":[{\"type\":", stringIndex("samples"_s), ",\"unit\":", stringIndex("count"_s), "}],");
+    json.append("\"periodType\":{\"type\":", stringIndex("wall"_s), ",\"unit\":", stringIndex("nanoseconds"_s), "},");
+    json.append("\"period\":", static_cast<uint64_t>(m_timingInterval.nanoseconds()), ',');
+    json.append("\"droppedSamples\":", m_droppedStackTraces, ",\"truncatedSamples\":", m_truncatedStackTraces, ',');
+
+    json.append("\"sample\":[");
+    bool first = true;
+    for (unsigned nodeIndex = 1; nodeIndex < m_callTree.size(); ++nodeIndex) {
+        if (!m_callTree[nodeIndex].selfSamples)
+            continue;
+        if (!first)
+            json.append(',');
+        first = false;
+        // pprof lists a sample's locations starting from the leaf.
+        json.append("{\"locationId\":[");
+        for (unsigned index = nodeIndex; index; index = m_callTree[index].parent) {
+            if (index != nodeIndex)
+                json.append(',');
+            json.append(index);
+        }
+        json.append("],\"value\":[", m_callTree[nodeIndex].selfSamples, "]}");
+    }
+    json.append("],");
+
+    json.append("\"location\":[", locations.toString(), "],");
+    json.append("\"function\":[", functions.toString(), "],");
+
+    json.append("\"stringTable\":[");
+    for (unsigned i = 0; i < stringTable.size(); ++i) {
+        if (i)
+            json.append(',');
+        json.appendQuotedJSONString(stringTable[i]);
+    }
+    json.append("]}");
+
+    clearData(locker);
+
+    return json.toString();
+}
+
 void SamplingProfiler::registerForReportAtExit()
 {
     static Lock registrationLock;
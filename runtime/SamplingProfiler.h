@@ -33,6 +33,7 @@
 #include "MachineStackMarker.h"
 #include "WasmCompilationMode.h"
 #include "WasmIndexOrName.h"
+#include <wtf/Deque.h>
 #include <wtf/HashSet.h>
 #include <wtf/Lock.h>
 #include <wtf/Stopwatch.h>
@@ -166,6 +167,16 @@ public:
         { }
     };
 
+    // With Options::samplingProfilerAggregateStackTraces(), processed stack traces are folded
+    // into this call tree instead of being kept one by one, so memory use is bounded by the
+    // number of distinct call paths rather than growing with the number of samples.
+    struct CallTreeNode {
+        StackFrame frame;
+        unsigned parent;
+        uint64_t selfSamples { 0 };
+        Vector<unsigned> children;
+    };
+
     SamplingProfiler(VM&, Ref<Stopwatch>&&);
     ~SamplingProfiler();
     void noticeJSLockAcquisition();
@@ -178,6 +189,8 @@ public:
     void start(const AbstractLocker&);
     Vector<StackTrace> releaseStackTraces(const AbstractLocker&);
     JS_EXPORT_PRIVATE String stackTracesAsJSON();
+    // Returns the aggregated call tree as JSON mirroring pprof's profile.proto and starts a new one.
+    JS_EXPORT_PRIVATE String drainCallTreeAsPprofJSON();
     JS_EXPORT_PRIVATE void noticeCurrentThreadAsJSCExecutionThread();
     void noticeCurrentThreadAsJSCExecutionThread(const AbstractLocker&);
     void processUnverifiedStackTraces(const AbstractLocker&);
@@ -199,6 +212,7 @@ private:
     void createThreadIfNecessary(const AbstractLocker&);
     void timerLoop();
     void takeSample(const AbstractLocker&, Seconds& stackTraceProcessingTime);
+    void addToCallTree(const StackTrace&);
 
     Lock m_lock;
     bool m_isPaused;
@@ -208,7 +222,10 @@ private:
     WeakRandom m_weakRandom;
     Ref<Stopwatch> m_stopwatch;
     Vector<StackTrace> m_stackTraces;
-    Vector<UnprocessedStackTrace> m_unprocessedStackTraces;
+    Deque<UnprocessedStackTrace> m_unprocessedStackTraces;
+    Vector<CallTreeNode> m_callTree;
+    uint64_t m_droppedStackTraces { 0 };
+    uint64_t m_truncatedStackTraces { 0 };
     Seconds m_timingInterval;
     Seconds m_lastTime;
     RefPtr<Thread> m_thread;
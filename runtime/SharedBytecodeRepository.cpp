@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "SharedBytecodeRepository.h"
+
+#include "SourceCodeKey.h"
+#include <wtf/NeverDestroyed.h>
+
+namespace JSC {
+
+SharedBytecodeRepository& SharedBytecodeRepository::singleton()
+{
+    static LazyNeverDestroyed<SharedBytecodeRepository> repository;
+    static std::once_flag onceKey;
+    std::call_once(onceKey, [] {
+        repository.construct();
+    });
+    return repository.get();
+}
+
+RefPtr<CachedBytecode> SharedBytecodeRepository::find(const SourceCodeKey& key)
+{
+    MallocPtr<uint8_t, VMMalloc> buffer;
+    size_t size;
+    {
+        auto locker = holdLock(m_lock);
+        auto iter = m_entries.find(key.hash());
+        if (iter == m_entries.end())
+            return nullptr;
+        Entry& entry = *iter->value;
+        if (StringView(entry.source) != key.source().view())
+            return nullptr;
+
+        size = entry.bytecode.size();
+        buffer = MallocPtr<uint8_t, VMMalloc>::malloc(size);
+        memcpy(buffer.get(), entry.bytecode.data(), size);
+    }
+    return CachedBytecode::create(WTFMove(buffer), size, { });
+}
+
+void SharedBytecodeRepository::add(const SourceCodeKey& key, const CachedBytecode& cachedBytecode)
+{
+    if (!cachedBytecode.size())
+        return;
+
+    auto entry = makeUnique<Entry>();
+    entry->source = key.source().view().toString().isolatedCopy();
+    entry->bytecode.append(cachedBytecode.data(), cachedBytecode.size());
+    size_t entryBytes = entry->source.length() * (entry->source.is8Bit() ? sizeof(LChar) : sizeof(UChar)) + entry->bytecode.size();
+
+    auto locker = holdLock(m_lock);
+    if (m_bytes + entryBytes > Options::sharedBytecodeRepositoryMaximumBytes())
+        return;
+    auto addResult = m_entries.add(key.hash(), WTFMove(entry));
+    if (addResult.isNewEntry)
+        m_bytes += entryBytes;
+}
+
+void SharedBytecodeRepository::clear()
+{
+    auto locker = holdLock(m_lock);
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+} // namespace JSC
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "CachedBytecode.h"
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class SourceCodeKey;
+
+// A process-wide store of serialized program and module bytecode. VMs in the same process that
+// evaluate the same source can decode it, which is much cheaper than parsing and generating the
+// bytecode again. UnlinkedCodeBlocks are cells in one VM's heap and cannot be shared themselves,
+// so the repository holds the VM-independent bytecode cache format and gives each VM its own copy.
+class SharedBytecodeRepository {
+    WTF_MAKE_NONCOPYABLE(SharedBytecodeRepository);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    SharedBytecodeRepository() = default;
+
+    JS_EXPORT_PRIVATE static SharedBytecodeRepository& singleton();
+
+    RefPtr<CachedBytecode> find(const SourceCodeKey&);
+    void add(const SourceCodeKey&, const CachedBytecode&);
+
+    JS_EXPORT_PRIVATE void clear();
+
+private:
+    struct Entry {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        String source;
+        Vector<uint8_t> bytecode;
+    };
+
+    Lock m_lock;
+    // Keyed by SourceCodeKey::hash(). Since the hash mixes in the key's flags, an entry whose hash
+    // and source both match was generated for an equivalent key.
+    HashMap<unsigned, std::unique_ptr<Entry>, WTF::IntHash<unsigned>, WTF::UnsignedWithZeroKeyHashTraits<unsigned>> m_entries;
+    size_t m_bytes { 0 };
+};
+
+} // namespace JSC
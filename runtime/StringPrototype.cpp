@@ -49,6 +49,12 @@
 #include <wtf/text/StringView.h>
 #include <wtf/unicode/icu/ICUHelpers.h>
 
+#if CPU(X86_SSE2)
+#include <emmintrin.h>
+#elif CPU(ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace JSC {
 
 STATIC_ASSERT_IS_TRIVIALLY_DESTRUCTIBLE(StringPrototype);
@@ -474,12 +480,14 @@ static ALWAYS_INLINE JSString* removeUsingRegExpSearch(VM& vm, JSGlobalObject* g
 
     Vector<StringRange, 16> sourceRanges;
     unsigned sourceLen = source.length();
+    MatchResult lastResult = MatchResult::failed();
 
     while (true) {
-        MatchResult result = globalObject->regExpGlobalData().performMatch(globalObject, regExp, string, source, startPosition);
+        MatchResult result = globalObject->regExpGlobalData().performMatchWithoutRecording(globalObject, regExp, source, startPosition);
         RETURN_IF_EXCEPTION(scope, nullptr);
         if (!result)
             break;
+        lastResult = result;
 
         if (lastIndex < result.start) {
             if (UNLIKELY(!sourceRanges.tryConstructAndAppend(lastIndex, result.start - lastIndex)))
@@ -496,6 +504,10 @@ static ALWAYS_INLINE JSString* removeUsingRegExpSearch(VM& vm, JSGlobalObject* g
         }
     }
 
+    // Nothing can observe the RegExp statics while the loop runs, so only the final match is recorded.
+    if (lastResult)
+        globalObject->regExpGlobalData().recordMatch(vm, globalObject, regExp, string, lastResult);
+
     if (!lastIndex)
         return string;
 
@@ -604,75 +616,99 @@ static ALWAYS_INLINE JSString* replaceUsingRegExpSearch(
                     break;
             }
         }
-    } else {
+    } else if (callData.type == CallData::Type::None) {
+        // A replacement string cannot observe the RegExp statics, so skip recording
+        // every match and record the final one once the loop is done.
+        bool replacementHasSubstitutions = replacementString.find('$') != notFound;
+        MatchResult lastResult = MatchResult::failed();
         do {
             int* ovector;
-            MatchResult result = globalObject->regExpGlobalData().performMatch(globalObject, regExp, string, source, startPosition, &ovector);
+            MatchResult result = globalObject->regExpGlobalData().performMatchWithoutRecording(globalObject, regExp, source, startPosition, &ovector);
             RETURN_IF_EXCEPTION(scope, nullptr);
             if (!result)
                 break;
+            lastResult = result;
 
-            if (callData.type != CallData::Type::None) {
+            int replLen = replacementString.length();
+            if (lastIndex < result.start || replLen) {
                 if (UNLIKELY(!sourceRanges.tryConstructAndAppend(lastIndex, result.start - lastIndex)))
                     OUT_OF_MEMORY(globalObject, scope);
 
-                MarkedArgumentBuffer args;
-                JSObject* groups = hasNamedCaptures ? constructEmptyObject(vm, globalObject->nullPrototypeObjectStructure()) : nullptr;
+                if (replacementHasSubstitutions) {
+                    StringBuilder replacement(StringBuilder::OverflowHandler::RecordOverflow);
+                    substituteBackreferences(replacement, replacementString, source, ovector, regExp);
+                    if (UNLIKELY(replacement.hasOverflowed()))
+                        OUT_OF_MEMORY(globalObject, scope);
+                    replacements.append(replacement.toString());
+                } else
+                    replacements.append(replacementString);
+            }
 
-                for (unsigned i = 0; i < regExp->numSubpatterns() + 1; ++i) {
-                    int matchStart = ovector[i * 2];
-                    int matchLen = ovector[i * 2 + 1] - matchStart;
+            lastIndex = result.end;
+            startPosition = lastIndex;
 
-                    JSValue patternValue;
+            // special case of empty match
+            if (result.empty()) {
+                startPosition++;
+                if (startPosition > sourceLen)
+                    break;
+            }
+        } while (global);
 
-                    if (matchStart < 0)
-                        patternValue = jsUndefined();
-                    else {
-                        patternValue = jsSubstring(vm, source, matchStart, matchLen);
-                        RETURN_IF_EXCEPTION(scope, nullptr);
-                    }
+        if (lastResult)
+            globalObject->regExpGlobalData().recordMatch(vm, globalObject, regExp, string, lastResult);
+    } else {
+        do {
+            int* ovector;
+            MatchResult result = globalObject->regExpGlobalData().performMatch(globalObject, regExp, string, source, startPosition, &ovector);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            if (!result)
+                break;
 
-                    args.append(patternValue);
+            if (UNLIKELY(!sourceRanges.tryConstructAndAppend(lastIndex, result.start - lastIndex)))
+                OUT_OF_MEMORY(globalObject, scope);
 
-                    if (i && hasNamedCaptures) {
-                        String groupName = regExp->getCaptureGroupName(i);
-                        if (!groupName.isEmpty())
-                            groups->putDirect(vm, Identifier::fromString(vm, groupName), patternValue);
-                    }
-                }
+            MarkedArgumentBuffer args;
+            JSObject* groups = hasNamedCaptures ? constructEmptyObject(vm, globalObject->nullPrototypeObjectStructure()) : nullptr;
 
-                args.append(jsNumber(result.start));
-                args.append(string);
-                if (hasNamedCaptures)
-                    args.append(groups);
-                if (UNLIKELY(args.hasOverflowed())) {
-                    throwOutOfMemoryError(globalObject, scope);
-                    return nullptr;
+            for (unsigned i = 0; i < regExp->numSubpatterns() + 1; ++i) {
+                int matchStart = ovector[i * 2];
+                int matchLen = ovector[i * 2 + 1] - matchStart;
+
+                JSValue patternValue;
+
+                if (matchStart < 0)
+                    patternValue = jsUndefined();
+                else {
+                    patternValue = jsSubstring(vm, source, matchStart, matchLen);
+                    RETURN_IF_EXCEPTION(scope, nullptr);
                 }
 
-                JSValue replacement = call(globalObject, replaceValue, callData, jsUndefined(), args);
-                RETURN_IF_EXCEPTION(scope, nullptr);
-                String replacementString = replacement.toWTFString(globalObject);
-                RETURN_IF_EXCEPTION(scope, nullptr);
-                replacements.append(replacementString);
-                RETURN_IF_EXCEPTION(scope, nullptr);
-            } else {
-                int replLen = replacementString.length();
-                if (lastIndex < result.start || replLen) {
-                    if (UNLIKELY(!sourceRanges.tryConstructAndAppend(lastIndex, result.start - lastIndex)))
-                        OUT_OF_MEMORY(globalObject, scope);
+                args.append(patternValue);
 
-                    if (replLen) {
-                        StringBuilder replacement(StringBuilder::OverflowHandler::RecordOverflow);
-                        substituteBackreferences(replacement, replacementString, source, ovector, regExp);
-                        if (UNLIKELY(replacement.hasOverflowed()))
-                            OUT_OF_MEMORY(globalObject, scope);
-                        replacements.append(replacement.toString());
-                    } else
-                        replacements.append(String());
+                if (i && hasNamedCaptures) {
+                    String groupName = regExp->getCaptureGroupName(i);
+                    if (!groupName.isEmpty())
+                        groups->putDirect(vm, Identifier::fromString(vm, groupName), patternValue);
                 }
             }
 
+            args.append(jsNumber(result.start));
+            args.append(string);
+            if (hasNamedCaptures)
+                args.append(groups);
+            if (UNLIKELY(args.hasOverflowed())) {
+                throwOutOfMemoryError(globalObject, scope);
+                return nullptr;
+            }
+
+            JSValue replacement = call(globalObject, replaceValue, callData, jsUndefined(), args);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            String replacementString = replacement.toWTFString(globalObject);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            replacements.append(replacementString);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+
             lastIndex = result.end;
             startPosition = lastIndex;
 
@@ -974,6 +1010,20 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncToString, (JSGlobalObject* globalObject,
     return JSValue::encode(stringObject->internalValue());
 }
 
+// Large ropes are typically built by concatenation and then probed only a few times. If the characters
+// asked for lie within one resolved fiber, read them there instead of flattening the whole rope. Returns
+// a null view when the rope should be resolved after all.
+static StringView ropeFiberView(JSString* string, unsigned offset, unsigned length)
+{
+    ASSERT(offset + length <= string->length());
+    if (!string->isRope() || !length || !Options::useRopeFiberWalking() || string->length() < Options::minimumRopeLengthForFiberWalking())
+        return { };
+    JSString* fiber = jsCast<JSRopeString*>(string)->fiberContaining(offset, length);
+    if (fiber->isRope())
+        return { };
+    return StringView(fiber->tryGetValue()).substring(offset, length);
+}
+
 JSC_DEFINE_HOST_FUNCTION(stringProtoFuncCharAt, (JSGlobalObject* globalObject, CallFrame* callFrame))
 {
     VM& vm = globalObject->vm();
@@ -984,10 +1034,15 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncCharAt, (JSGlobalObject* globalObject, C
         return throwVMTypeError(globalObject, scope);
     auto* thisString = thisValue.toString(globalObject);
     RETURN_IF_EXCEPTION(scope, { });
+    JSValue a0 = callFrame->argument(0);
+    if (a0.isUInt32() && a0.asUInt32() < thisString->length()) {
+        StringView fiberView = ropeFiberView(thisString, a0.asUInt32(), 1);
+        if (!fiberView.isNull())
+            return JSValue::encode(jsSingleCharacterString(vm, fiberView[0]));
+    }
     auto viewWithString = thisString->viewWithUnderlyingString(globalObject);
     RETURN_IF_EXCEPTION(scope, { });
     StringView view = viewWithString.view;
-    JSValue a0 = callFrame->argument(0);
     if (a0.isUInt32()) {
         uint32_t i = a0.asUInt32();
         if (i < view.length())
@@ -1011,10 +1066,15 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncCharCodeAt, (JSGlobalObject* globalObjec
         return throwVMTypeError(globalObject, scope);
     auto* thisString = thisValue.toString(globalObject);
     RETURN_IF_EXCEPTION(scope, { });
+    JSValue a0 = callFrame->argument(0);
+    if (a0.isUInt32() && a0.asUInt32() < thisString->length()) {
+        StringView fiberView = ropeFiberView(thisString, a0.asUInt32(), 1);
+        if (!fiberView.isNull())
+            return JSValue::encode(jsNumber(fiberView[0]));
+    }
     auto viewWithString = thisString->viewWithUnderlyingString(globalObject);
     RETURN_IF_EXCEPTION(scope, { });
     StringView view = viewWithString.view;
-    JSValue a0 = callFrame->argument(0);
     if (a0.isUInt32()) {
         uint32_t i = a0.asUInt32();
         if (i < view.length())
@@ -1198,6 +1258,55 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncSlice, (JSGlobalObject* globalObject, Ca
     RELEASE_AND_RETURN(scope, JSValue::encode(stringSlice(globalObject, vm, string, length, start, end)));
 }
 
+// Counts the occurrences of character, stopping soon after maximumCount has been reached, so that split()
+// can allocate its result at its final size before filling it.
+static ALWAYS_INLINE unsigned countCharacter(const LChar* characters, unsigned length, UChar character, unsigned maximumCount)
+{
+    if (!isLatin1(character))
+        return 0;
+    unsigned count = 0;
+    unsigned i = 0;
+#if CPU(X86_SSE2)
+    __m128i pattern = _mm_set1_epi8(static_cast<char>(character));
+    for (; i + 16 <= length && count < maximumCount; i += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i));
+        count += WTF::bitCount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern))));
+    }
+#elif CPU(ARM64)
+    uint8x16_t pattern = vdupq_n_u8(static_cast<uint8_t>(character));
+    for (; i + 16 <= length && count < maximumCount; i += 16) {
+        uint8x16_t matches = vandq_u8(vceqq_u8(vld1q_u8(characters + i), pattern), vdupq_n_u8(1));
+        count += vaddvq_u8(matches);
+    }
+#endif
+    for (; i < length && count < maximumCount; ++i)
+        count += characters[i] == character;
+    return count;
+}
+
+static ALWAYS_INLINE unsigned countCharacter(const UChar* characters, unsigned length, UChar character, unsigned maximumCount)
+{
+    unsigned count = 0;
+    unsigned i = 0;
+#if CPU(X86_SSE2)
+    __m128i pattern = _mm_set1_epi16(static_cast<short>(character));
+    for (; i + 8 <= length && count < maximumCount; i += 8) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i));
+        // Each matching lane sets two mask bits.
+        count += WTF::bitCount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(block, pattern)))) / 2;
+    }
+#elif CPU(ARM64)
+    uint16x8_t pattern = vdupq_n_u16(character);
+    for (; i + 8 <= length && count < maximumCount; i += 8) {
+        uint16x8_t matches = vandq_u16(vceqq_u16(vld1q_u16(reinterpret_cast<const uint16_t*>(characters + i)), pattern), vdupq_n_u16(1));
+        count += vaddvq_u16(matches);
+    }
+#endif
+    for (; i < length && count < maximumCount; ++i)
+        count += characters[i] == character;
+    return count;
+}
+
 // Return true in case of early return (resultLength got to limitLength).
 template<typename CharacterType>
 static ALWAYS_INLINE bool splitStringByOneCharacterImpl(JSGlobalObject* globalObject, JSArray* result, JSValue originalValue, const String& input, StringImpl* string, UChar separatorCharacter, size_t& position, unsigned& resultLength, unsigned limitLength)
@@ -1324,6 +1433,22 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncSplitFast, (JSGlobalObject* globalObject
         else
             separatorCharacter = separatorImpl->characters16()[0];
 
+        // Count the pieces first so that the result array is allocated once, at its final length, and then
+        // filled in order instead of growing one substring at a time.
+        if (Options::useExactSizeStringSplit()) {
+            unsigned separatorCount;
+            if (stringImpl->is8Bit())
+                separatorCount = countCharacter(stringImpl->characters8(), stringImpl->length(), separatorCharacter, limit);
+            else
+                separatorCount = countCharacter(stringImpl->characters16(), stringImpl->length(), separatorCharacter, limit);
+            unsigned pieceCount = separatorCount >= limit ? limit : separatorCount + 1;
+            result = JSArray::tryCreate(vm, globalObject->arrayStructureForIndexingTypeDuringAllocation(ArrayWithContiguous), pieceCount);
+            if (UNLIKELY(!result)) {
+                throwOutOfMemoryError(globalObject, scope);
+                return encodedJSValue();
+            }
+        }
+
         if (stringImpl->is8Bit()) {
             if (splitStringByOneCharacterImpl<LChar>(globalObject, result, thisValue, input, stringImpl, separatorCharacter, position, resultLength, limit)) 
                 RELEASE_AND_RETURN(scope, JSValue::encode(result));
@@ -1649,6 +1774,27 @@ enum {
     TrimEnd = 2
 };
 
+static ALWAYS_INLINE bool isStrWhiteSpace(LChar c)
+{
+    // The StrWhiteSpaceChars that fit in Latin-1 are TAB, LF, VT, FF, CR, SP and NBSP.
+    if (c <= ' ')
+        return c == ' ' || (c >= '\t' && c <= '\r');
+    return c == 0xA0;
+}
+
+template<typename CharacterType>
+static ALWAYS_INLINE void trimRange(const CharacterType* characters, int trimKind, unsigned& left, unsigned& right)
+{
+    if (trimKind & TrimStart) {
+        while (left < right && isStrWhiteSpace(characters[left]))
+            left++;
+    }
+    if (trimKind & TrimEnd) {
+        while (right > left && isStrWhiteSpace(characters[right - 1]))
+            right--;
+    }
+}
+
 static inline JSValue trimString(JSGlobalObject* globalObject, JSValue thisValue, int trimKind)
 {
     VM& vm = globalObject->vm();
@@ -1660,15 +1806,11 @@ static inline JSValue trimString(JSGlobalObject* globalObject, JSValue thisValue
     RETURN_IF_EXCEPTION(scope, { });
 
     unsigned left = 0;
-    if (trimKind & TrimStart) {
-        while (left < str.length() && isStrWhiteSpace(str[left]))
-            left++;
-    }
     unsigned right = str.length();
-    if (trimKind & TrimEnd) {
-        while (right > left && isStrWhiteSpace(str[right - 1]))
-            right--;
-    }
+    if (str.is8Bit())
+        trimRange(str.characters8(), trimKind, left, right);
+    else
+        trimRange(str.characters16(), trimKind, left, right);
 
     // Don't gc allocate a new string if we don't have to.
     if (left == 0 && right == str.length() && thisValue.isString())
@@ -1713,7 +1855,7 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncStartsWith, (JSGlobalObject* globalObjec
     if (!checkObjectCoercible(thisValue))
         return throwVMTypeError(globalObject, scope);
 
-    String stringToSearchIn = thisValue.toWTFString(globalObject);
+    JSString* thisString = thisValue.toString(globalObject);
     RETURN_IF_EXCEPTION(scope, encodedJSValue());
 
     JSValue a0 = callFrame->argument(0);
@@ -1725,16 +1867,24 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncStartsWith, (JSGlobalObject* globalObjec
     String searchString = a0.toWTFString(globalObject);
     RETURN_IF_EXCEPTION(scope, encodedJSValue());
 
+    unsigned length = thisString->length();
     JSValue positionArg = callFrame->argument(1);
     unsigned start = 0;
     if (positionArg.isInt32())
         start = std::max(0, positionArg.asInt32());
     else {
-        unsigned length = stringToSearchIn.length();
         start = clampAndTruncateToUnsigned(positionArg.toInteger(globalObject), 0, length);
         RETURN_IF_EXCEPTION(scope, encodedJSValue());
     }
 
+    if (start <= length && searchString.length() <= length - start) {
+        StringView fiberView = ropeFiberView(thisString, start, searchString.length());
+        if (!fiberView.isNull())
+            return JSValue::encode(jsBoolean(fiberView == searchString));
+    }
+
+    String stringToSearchIn = thisString->value(globalObject);
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
     return JSValue::encode(jsBoolean(stringToSearchIn.hasInfixStartingAt(searchString, start)));
 }
 
@@ -1747,7 +1897,7 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncEndsWith, (JSGlobalObject* globalObject,
     if (!checkObjectCoercible(thisValue))
         return throwVMTypeError(globalObject, scope);
 
-    String stringToSearchIn = thisValue.toWTFString(globalObject);
+    JSString* thisString = thisValue.toString(globalObject);
     RETURN_IF_EXCEPTION(scope, encodedJSValue());
 
     JSValue a0 = callFrame->argument(0);
@@ -1759,7 +1909,7 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncEndsWith, (JSGlobalObject* globalObject,
     String searchString = a0.toWTFString(globalObject);
     RETURN_IF_EXCEPTION(scope, encodedJSValue());
 
-    unsigned length = stringToSearchIn.length();
+    unsigned length = thisString->length();
 
     JSValue endPositionArg = callFrame->argument(1);
     unsigned end = length;
@@ -1770,7 +1920,16 @@ JSC_DEFINE_HOST_FUNCTION(stringProtoFuncEndsWith, (JSGlobalObject* globalObject,
         RETURN_IF_EXCEPTION(scope, encodedJSValue());
     }
 
-    return JSValue::encode(jsBoolean(stringToSearchIn.hasInfixEndingAt(searchString, std::min(end, length))));
+    end = std::min(end, length);
+    if (searchString.length() <= end) {
+        StringView fiberView = ropeFiberView(thisString, end - searchString.length(), searchString.length());
+        if (!fiberView.isNull())
+            return JSValue::encode(jsBoolean(fiberView == searchString));
+    }
+
+    String stringToSearchIn = thisString->value(globalObject);
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
+    return JSValue::encode(jsBoolean(stringToSearchIn.hasInfixEndingAt(searchString, end)));
 }
 
 static EncodedJSValue stringIncludesImpl(JSGlobalObject* globalObject, VM& vm, String stringToSearchIn, String searchString, JSValue positionArg)
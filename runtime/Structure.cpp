@@ -32,6 +32,7 @@
 #include "JSCInlines.h"
 #include "PropertyMapHashTable.h"
 #include "PropertyNameArray.h"
+#include "StackVisitor.h"
 #include <wtf/CommaPrinter.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/RefPtr.h>
@@ -97,6 +98,13 @@ inline Structure* StructureTransitionTable::get(UniquedStringImpl* rep, unsigned
     return map()->get(StructureTransitionTable::Hash::Key(rep, attributes, transitionKind));
 }
 
+unsigned StructureTransitionTable::size() const
+{
+    if (isUsingSingleSlot())
+        return singleTransition() ? 1 : 0;
+    return map()->size();
+}
+
 void StructureTransitionTable::add(VM& vm, Structure* structure)
 {
     if (isUsingSingleSlot()) {
@@ -303,6 +311,7 @@ Structure::Structure(VM& vm, Structure* previous, DeferredStructureTransitionWat
     setDictionaryKind(previous->dictionaryKind());
     setIsPinnedPropertyTable(false);
     setHasBeenFlattenedBefore(previous->hasBeenFlattenedBefore());
+    setTimesReflattened(previous->timesReflattened());
     setHasGetterSetterProperties(previous->hasGetterSetterProperties());
     setHasCustomGetterSetterProperties(previous->hasCustomGetterSetterProperties());
     setHasReadOnlyOrGetterSetterPropertiesExcludingProto(previous->hasReadOnlyOrGetterSetterPropertiesExcludingProto());
@@ -527,6 +536,25 @@ bool Structure::holesMustForwardToPrototype(VM& vm, JSObject* base) const
     return false;
 }
 
+// Attributes a new property transition to the innermost JS frame, so $vm.structureTransitionSites()
+// can point at the code that creates the most shapes.
+static void recordTransitionSite(VM& vm)
+{
+    String site;
+    StackVisitor::visit(vm.topCallFrame, vm, [&] (StackVisitor& visitor) -> StackVisitor::Status {
+        if (visitor->isWasmFrame() || !visitor->codeBlock())
+            return StackVisitor::Continue;
+        unsigned line = 0;
+        unsigned column = 0;
+        visitor->computeLineAndColumn(line, column);
+        site = makeString(visitor->sourceURL(), ':', line, ':', column);
+        return StackVisitor::Done;
+    });
+    if (site.isNull())
+        site = "<native>"_s;
+    vm.structureTransitionSites.add(site, 0).iterator->value++;
+}
+
 Structure* Structure::addPropertyTransition(VM& vm, Structure* structure, PropertyName propertyName, unsigned attributes, PropertyOffset& offset)
 {
     Structure* newStructure = addPropertyTransitionToExistingStructure(structure, propertyName, attributes, offset);
@@ -548,7 +576,13 @@ Structure* Structure::addNewPropertyTransition(VM& vm, Structure* structure, Pro
         maxTransitionLength = s_maxTransitionLengthForNonEvalPutById;
     else
         maxTransitionLength = s_maxTransitionLength;
-    if (structure->transitionCountEstimate() > maxTransitionLength) {
+    // A structure that has already spawned too many property transitions (typically objects built
+    // with many different key orders) sends further additions to a dictionary instead of growing
+    // the transition tree without bound.
+    bool hasTooManyTransitions = Options::maximumStructureTransitionFanOut()
+        && !isCopyOnWrite(structure->indexingMode())
+        && structure->m_transitionTable.size() >= Options::maximumStructureTransitionFanOut();
+    if (structure->transitionCountEstimate() > maxTransitionLength || hasTooManyTransitions) {
         ASSERT(!isCopyOnWrite(structure->indexingMode()));
         Structure* transition = toCacheableDictionaryTransition(vm, structure, deferred);
         ASSERT(structure != transition);
@@ -594,6 +628,8 @@ Structure* Structure::addNewPropertyTransition(VM& vm, Structure* structure, Pro
         GCSafeConcurrentJSLocker locker(structure->m_lock, vm.heap);
         structure->m_transitionTable.add(vm, transition);
     }
+    if (UNLIKELY(Options::recordStructureTransitionSites()))
+        recordTransitionSite(vm);
     transition->checkOffsetConsistency();
     structure->checkOffsetConsistency();
     return transition;
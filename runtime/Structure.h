@@ -715,10 +715,15 @@ public:
     DEFINE_BITFIELD(bool, hasBeenDictionary, HasBeenDictionary, 1, 27);
     DEFINE_BITFIELD(bool, protectPropertyTableWhileTransitioning, ProtectPropertyTableWhileTransitioning, 1, 28);
     DEFINE_BITFIELD(bool, hasUnderscoreProtoPropertyExcludingOriginalProto, HasUnderscoreProtoPropertyExcludingOriginalProto, 1, 29);
+    DEFINE_BITFIELD(unsigned, timesReflattened, TimesReflattened, 2, 30);
+
+    static constexpr unsigned s_maximumTimesReflattened = s_timesReflattenedMask;
 
     static_assert(s_bitWidthOfTransitionPropertyAttributes <= sizeof(TransitionPropertyAttributes) * 8);
     static_assert(s_bitWidthOfTransitionKind <= sizeof(TransitionKind) * 8);
 
+    unsigned transitionTableSize() const { return m_transitionTable.size(); }
+
 private:
     friend class LLIntOffsetsExtractor;
 
@@ -26,8 +26,11 @@
 #include "config.h"
 #include "StructureIDTable.h"
 
+#include "Options.h"
 #include <wtf/Atomics.h>
+#include <wtf/BitVector.h>
 #include <wtf/DataLog.h>
+#include <wtf/PageBlock.h>
 #include <wtf/RawPointer.h>
 
 namespace JSC {
@@ -42,6 +45,7 @@ StructureIDTable::StructureIDTable()
     : m_table(makeUniqueArray<StructureOrOffset>(s_initialSize))
     , m_size(1)
     , m_capacity(s_initialSize)
+    , m_reserveStart(s_initialSize)
 {
     // We pre-allocate the first offset so that the null Structure
     // can still be represented as the StructureID '0'.
@@ -128,6 +132,7 @@ void StructureIDTable::resize(size_t newCapacity)
 
     // Update the capacity.
     m_capacity = newCapacity;
+    m_reserveStart = newCapacity;
 
     makeFreeListFromRange(m_size, m_capacity - 1);
 }
@@ -139,6 +144,11 @@ void StructureIDTable::flushOldTables()
 
 StructureID StructureIDTable::allocateID(Structure* structure)
 {
+    if (UNLIKELY(!m_firstFreeOffset && m_reserveStart < m_capacity)) {
+        makeFreeListFromRange(m_reserveStart, m_capacity - 1);
+        m_reserveStart = m_capacity;
+    }
+
     if (UNLIKELY(!m_firstFreeOffset)) {
         RELEASE_ASSERT(m_capacity <= s_maximumNumberOfStructures);
         ASSERT(m_size == m_capacity);
@@ -198,6 +208,73 @@ void StructureIDTable::deallocateID(Structure* structure, StructureID structureI
     }
 }
 
+void StructureIDTable::compactFreeList()
+{
+    BitVector isFree(m_capacity);
+    for (uint32_t index = m_firstFreeOffset; index; index = table()[index].offset)
+        isFree.quickSet(index);
+    for (size_t index = m_reserveStart; index < m_capacity; ++index)
+        isFree.quickSet(index);
+
+    size_t highestUsedIndex = 0;
+    Vector<uint32_t> freeIndices;
+    for (size_t index = 1; index < m_capacity; ++index) {
+        if (isFree.quickGet(index))
+            freeIndices.append(index);
+        else
+            highestUsedIndex = index;
+    }
+    m_highestUsedIndex = highestUsedIndex;
+
+    // Everything past the page holding the highest used entry can leave the free list. It is put
+    // back by allocateID() once the remaining free entries run out.
+    size_t pageSizeInEntries = WTF::pageSize() / sizeof(StructureOrOffset);
+    size_t newReserveStart = m_capacity;
+    if (pageSizeInEntries) {
+        uintptr_t tableStart = bitwise_cast<uintptr_t>(table());
+        uintptr_t firstFreePage = WTF::roundUpToMultipleOf(WTF::pageSize(), tableStart + (highestUsedIndex + 1) * sizeof(StructureOrOffset));
+        size_t firstFreePageIndex = (firstFreePage - tableStart) / sizeof(StructureOrOffset);
+        if (firstFreePageIndex + pageSizeInEntries <= m_capacity)
+            newReserveStart = firstFreePageIndex;
+    }
+    while (!freeIndices.isEmpty() && freeIndices.last() >= newReserveStart)
+        freeIndices.removeLast();
+
+    // Ascending order, shuffled within each window.
+    for (size_t windowStart = 0; windowStart < freeIndices.size(); windowStart += s_freeListShuffleWindow) {
+        size_t windowSize = std::min(s_freeListShuffleWindow, freeIndices.size() - windowStart);
+        for (size_t i = windowSize; i > 1; --i)
+            std::swap(freeIndices[windowStart + i - 1], freeIndices[windowStart + m_weakRandom.getUint32(i)]);
+    }
+
+    m_firstFreeOffset = 0;
+    m_lastFreeOffset = 0;
+    for (size_t i = freeIndices.size(); i--;) {
+        uint32_t index = freeIndices[i];
+        table()[index].offset = m_firstFreeOffset;
+        m_firstFreeOffset = index;
+        if (!m_lastFreeOffset)
+            m_lastFreeOffset = index;
+    }
+
+    // The table comes from fastMalloc, so its pages are not ours to return to the OS; the reserved
+    // tail only stays out of the free list.
+    m_reserveStart = newReserveStart;
+
+    if (UNLIKELY(Options::logGC() == GCLogging::Verbose))
+        dataLogLn("StructureIDTable: ", m_size, " of ", m_capacity, " entries used, highest used index ", highestUsedIndex, ", ", m_capacity - m_reserveStart, " entries reserved");
+}
+
+StructureIDTable::Statistics StructureIDTable::statistics() const
+{
+    Statistics result;
+    result.size = m_size;
+    result.capacity = m_capacity;
+    result.highestUsedIndex = m_highestUsedIndex;
+    result.reservedEntries = m_capacity - m_reserveStart;
+    return result;
+}
+
 #endif // USE(JSVALUE64)
 
 } // namespace JSC
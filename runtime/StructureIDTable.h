@@ -103,7 +103,20 @@ public:
     StructureID allocateID(Structure*);
 
     void flushOldTables();
-    
+
+    // Must only be called while the world is stopped. Rebuilds the free list so that allocation
+    // favors low indices, and holds a free tail of the table back until the rest is used up.
+    void compactFreeList();
+
+    struct Statistics {
+        size_t size { 0 };
+        size_t capacity { 0 };
+        // These are as of the last compactFreeList().
+        size_t highestUsedIndex { 0 };
+        size_t reservedEntries { 0 };
+    };
+    Statistics statistics() const;
+
     size_t size() const { return m_size; }
 
 private:
@@ -122,6 +135,9 @@ private:
     static EncodedStructureBits encode(Structure*, StructureID);
 
     static constexpr size_t s_initialSize = 512;
+    // compactFreeList() shuffles free indices within windows of this many entries, so that IDs stay
+    // dense without the next ID becoming predictable.
+    static constexpr size_t s_freeListShuffleWindow = 64;
 
     Vector<UniqueArray<StructureOrOffset>> m_oldTables;
 
@@ -131,6 +147,9 @@ private:
 
     size_t m_size { 0 };
     size_t m_capacity;
+    // Entries from here to m_capacity are free but not on the free list.
+    size_t m_reserveStart;
+    size_t m_highestUsedIndex { 0 };
 
     WeakRandom m_weakRandom;
 
@@ -217,6 +236,7 @@ public:
     };
 
     void flushOldTables() { }
+    void compactFreeList() { }
     void validate(StructureID) { }
 };
 
@@ -254,6 +254,10 @@ public:
     bool contains(UniquedStringImpl*, unsigned attributes, TransitionKind) const;
     Structure* get(UniquedStringImpl*, unsigned attributes, TransitionKind) const;
 
+    // Number of transitions out of this structure. Transitions that died since the last
+    // collection may still be counted.
+    unsigned size() const;
+
 private:
     friend class SingleSlotTransitionWeakOwner;
 
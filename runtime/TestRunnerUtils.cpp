@@ -27,7 +27,9 @@
 #include "TestRunnerUtils.h"
 
 #include "CodeBlock.h"
+#include "DFGWorklist.h"
 #include "FunctionCodeBlock.h"
+#include "JITWorklist.h"
 #include "JSCInlines.h"
 
 namespace JSC {
@@ -153,6 +155,45 @@ JSValue optimizeNextInvocation(JSGlobalObject*, CallFrame* callFrame)
     return optimizeNextInvocation(callFrame->uncheckedArgument(0));
 }
 
+TierUpSnapshot takeTierUpSnapshot(VM& vm)
+{
+    TierUpSnapshot snapshot;
+    vm.heap.forEachCodeBlock([&] (CodeBlock* codeBlock) {
+        switch (codeBlock->jitType()) {
+        case JITType::InterpreterThunk:
+            snapshot.llintCodeBlocks++;
+            break;
+        case JITType::BaselineJIT:
+            snapshot.baselineCodeBlocks++;
+            break;
+        case JITType::DFGJIT:
+            snapshot.dfgCodeBlocks++;
+            break;
+        case JITType::FTLJIT:
+            snapshot.ftlCodeBlocks++;
+            break;
+        default:
+            break;
+        }
+#if ENABLE(JIT)
+        if (JITCode::isOptimizingJIT(codeBlock->jitType()))
+            snapshot.osrExits += codeBlock->osrExitCounter();
+#endif
+    });
+
+#if ENABLE(JIT)
+    if (JITWorklist* worklist = JITWorklist::existingGlobalWorklistOrNull())
+        snapshot.baselineQueueLength = worklist->queueLength();
+#endif
+#if ENABLE(DFG_JIT)
+    if (DFG::Worklist* worklist = DFG::existingGlobalDFGWorklistOrNull())
+        snapshot.dfgQueueLength = worklist->queueLength();
+    if (DFG::Worklist* worklist = DFG::existingGlobalFTLWorklistOrNull())
+        snapshot.ftlQueueLength = worklist->queueLength();
+#endif
+    return snapshot;
+}
+
 // This is a hook called at the bitter end of some of our tests.
 void finalizeStatsAtEndOfTesting()
 {
@@ -31,6 +31,21 @@ namespace JSC {
 
 class CodeBlock;
 class FunctionExecutable;
+class VM;
+
+// A point-in-time view of how far the VM's code has tiered up. Counts only cover
+// CodeBlocks that are currently live, so a jettisoned optimized block stops
+// contributing its OSR exits once it has been collected.
+struct TierUpSnapshot {
+    unsigned llintCodeBlocks { 0 };
+    unsigned baselineCodeBlocks { 0 };
+    unsigned dfgCodeBlocks { 0 };
+    unsigned ftlCodeBlocks { 0 };
+    size_t baselineQueueLength { 0 };
+    size_t dfgQueueLength { 0 };
+    size_t ftlQueueLength { 0 };
+    uint64_t osrExits { 0 };
+};
 
 JS_EXPORT_PRIVATE FunctionExecutable* getExecutableForFunction(JSValue theFunctionValue);
 JS_EXPORT_PRIVATE CodeBlock* getSomeBaselineCodeBlockForFunction(JSValue theFunctionValue);
@@ -52,6 +67,8 @@ JS_EXPORT_PRIVATE unsigned numberOfExecutableAllocationFuzzChecks();
 JS_EXPORT_PRIVATE unsigned numberOfStaticOSRExitFuzzChecks();
 JS_EXPORT_PRIVATE unsigned numberOfOSRExitFuzzChecks();
 
+JS_EXPORT_PRIVATE TierUpSnapshot takeTierUpSnapshot(VM&);
+
 JS_EXPORT_PRIVATE void finalizeStatsAtEndOfTesting();
 
 JS_EXPORT_PRIVATE void waitForVMDestruction();
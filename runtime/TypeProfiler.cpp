@@ -26,6 +26,7 @@
 #include "config.h"
 #include "TypeProfiler.h"
 
+#include "Options.h"
 #include "TypeLocation.h"
 #include <wtf/text/StringBuilder.h>
 
@@ -142,7 +143,10 @@ TypeLocation* TypeProfiler::findLocation(unsigned divot, intptr_t sourceID, Type
 
 TypeLocation* TypeProfiler::nextTypeLocation() 
 { 
-    return m_typeLocationInfo.add(); 
+    TypeLocation* location = m_typeLocationInfo.add();
+    if (unsigned period = Options::typeProfilerJITSamplingPeriod())
+        location->m_isSampledInJIT = !(m_typeLocationCount++ % period);
+    return location;
 }
 
 void TypeProfiler::invalidateTypeSetCache(VM& vm)
@@ -133,6 +133,7 @@ private:
     TypeLocationQueryCache m_queryCache;
     GlobalVariableID m_nextUniqueVariableID;
     Bag<TypeLocation> m_typeLocationInfo;
+    unsigned m_typeLocationCount { 0 };
 };
 
 } // namespace JSC
@@ -30,6 +30,7 @@
 #include "TypeProfilerLog.h"
 
 #include "JSCJSValueInlines.h"
+#include "Options.h"
 #include "TypeLocation.h"
 
 namespace JSC {
@@ -40,7 +41,7 @@ static constexpr bool verbose = false;
 
 TypeProfilerLog::TypeProfilerLog(VM& vm)
     : m_vm(vm)
-    , m_logSize(50000)
+    , m_logSize(std::max(Options::typeProfilerLogSize(), 1u))
     , m_logStartPtr(new LogEntry[m_logSize])
     , m_currentLogEntryPtr(m_logStartPtr)
     , m_logEndPtr(m_logStartPtr + m_logSize)
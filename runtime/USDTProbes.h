@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+// Statically defined tracepoints for Linux tracers. A USDT probe compiles to one nop at the
+// call site and an ELF note naming it, so perf, bpftrace, SystemTap and LTTng can attach by
+// name (for example "usdt:libJavaScriptCore.so:jsc:gc__phase") without any cost until they
+// do. Unlike Options::useTracePoints(), which drives the kdebug tracePoint() backend on
+// Darwin, these need no option to be turned on.
+//
+// Probes:
+//     gc__phase(int from, int to)                    CollectorPhase transition.
+//     vm__entry() / vm__exit()                       Outermost VMEntryScope push and pop.
+//     dfg__compile__start(int mode, void* codeBlock) DFG::Plan::compileInThread, before compiling.
+//     dfg__compile__end(int mode, void* codeBlock, int path)
+//     wasm__compile__start(void* plan) / wasm__compile__end(void* plan)
+//                                                    Wasm::EntryPlan::compileFunctions, for BBQ and LLInt.
+//     wasm__omg__compile__start(unsigned functionIndex) / wasm__omg__compile__end(unsigned functionIndex)
+//     osr__exit__compile(int jitType, void* codeBlock, unsigned exitIndex)
+//                                                    First exit through a DFG or FTL OSR exit site.
+
+#if OS(LINUX) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define JSC_HAVE_USDT_PROBES 1
+#endif
+#endif
+
+#if defined(JSC_HAVE_USDT_PROBES)
+#define JSC_USDT_PROBE(name) DTRACE_PROBE(jsc, name)
+#define JSC_USDT_PROBE1(name, a) DTRACE_PROBE1(jsc, name, a)
+#define JSC_USDT_PROBE2(name, a, b) DTRACE_PROBE2(jsc, name, a, b)
+#define JSC_USDT_PROBE3(name, a, b, c) DTRACE_PROBE3(jsc, name, a, b, c)
+#else
+#define JSC_USDT_PROBE(name) do { } while (false)
+#define JSC_USDT_PROBE1(name, a) do { } while (false)
+#define JSC_USDT_PROBE2(name, a, b) do { } while (false)
+#define JSC_USDT_PROBE3(name, a, b, c) do { } while (false)
+#endif
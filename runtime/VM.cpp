@@ -31,6 +31,7 @@
 
 #include "AggregateError.h"
 #include "ArgList.h"
+#include "ArrayBufferPool.h"
 #include "BigIntObject.h"
 #include "BooleanObject.h"
 #include "BuiltinExecutables.h"
@@ -38,6 +39,7 @@
 #include "CheckpointOSRExitSideState.h"
 #include "ClonedArguments.h"
 #include "CodeBlock.h"
+#include "CodeBlockSet.h"
 #include "CodeCache.h"
 #include "CommonIdentifiers.h"
 #include "ControlFlowProfiler.h"
@@ -133,12 +135,15 @@
 #include "JSWebAssemblyTable.h"
 #include "JSWithScope.h"
 #include "LLIntData.h"
+#include "MegamorphicCache.h"
 #include "MinimumReservedZoneSize.h"
 #include "ModuleProgramCodeBlock.h"
 #include "ModuleProgramExecutable.h"
 #include "NarrowingNumberPredictionFuzzerAgent.h"
 #include "NativeExecutable.h"
 #include "NumberObject.h"
+#include "ObjectCloneCache.h"
+#include "ParserArena.h"
 #include "PredictionFileCreatingFuzzerAgent.h"
 #include "ProfilerDatabase.h"
 #include "ProgramCodeBlock.h"
@@ -167,6 +172,7 @@
 #include "VMInlines.h"
 #include "VMInspector.h"
 #include "VariableEnvironment.h"
+#include "WaiterListManager.h"
 #include "WasmWorklist.h"
 #include "Watchdog.h"
 #include "WeakGCMapInlines.h"
@@ -549,6 +555,10 @@ VM::VM(VMType vmType, HeapType heapType, WTF::RunLoop* runLoop, bool* success)
 
     if (Options::alwaysGeneratePCToCodeOriginMap())
         setShouldBuildPCToCodeOriginMapping();
+#if OS(LINUX)
+    if (Options::logJITCodeForPerf())
+        setShouldBuildPCToCodeOriginMapping();
+#endif
 
     if (Options::watchdog()) {
         Watchdog& watchdog = ensureWatchdog();
@@ -589,6 +599,7 @@ VM::~VM()
     
     Gigacage::removePrimitiveDisableCallback(primitiveGigacageDisabledCallback, this);
     deferredWorkTimer->stopRunningTasks();
+    WaiterListManager::singleton().unregister(*this);
 #if ENABLE(WEBASSEMBLY)
     if (Wasm::Worklist* worklist = Wasm::existingWorklistOrNull())
         worklist->stopAllPlansForContext(wasmContext);
@@ -644,6 +655,7 @@ VM::~VM()
 
     delete emptyList;
 
+    recentIdentifiers.clear();
     delete propertyNames;
     if (vmType != Default)
         delete m_atomStringTable;
@@ -923,12 +935,75 @@ void VM::shrinkFootprintWhenIdle()
         sanitizeStackForVM(*this);
         deleteAllCode(DeleteAllCodeIfNotCollecting);
         heap.collectNow(Synchronousness::Sync, CollectionScope::Full);
+        if (m_parserArenaPool)
+            m_parserArenaPool->clear();
+        ArrayBufferPool::singleton().clear();
         // FIXME: Consider stopping various automatic threads here.
         // https://bugs.webkit.org/show_bug.cgi?id=185447
         WTF::releaseFastMallocFreeMemory();
     });
 }
 
+auto VM::respondToMemoryPressure(MemoryPressure pressure) -> MemoryPressureResponse
+{
+    RELEASE_ASSERT(!entryScope);
+    MemoryPressureResponse response;
+    auto released = [] (size_t before, size_t after) -> size_t {
+        return before > after ? before - after : 0;
+    };
+
+    sanitizeStackForVM(*this);
+
+    size_t codeCacheBytes = m_codeCache->statistics().bytes;
+    if (pressure == MemoryPressure::Critical)
+        m_codeCache->clear();
+    else
+        m_codeCache->shrinkByHalf();
+    response.codeCacheBytes = released(codeCacheBytes, m_codeCache->statistics().bytes);
+
+    response.regExpCodeBytes = m_regExpCache->deleteAllCode();
+
+    for (auto& cache : sourceProviderCacheMap.values()) {
+        cache->forEach([&] (int, const SourceProviderCacheItem& item) {
+            response.sourceProviderCacheBytes += sizeof(SourceProviderCacheItem) + sizeof(UniquedStringImpl*) * item.usedVariablesCount;
+        });
+    }
+    clearSourceProviderCaches();
+
+    auto codeMemoryBefore = heap.codeBlockSet().codeMemoryStatistics();
+    size_t executableMemoryBefore = ExecutableAllocator::committedByteCount();
+    size_t heapBefore = heap.capacity();
+
+    if (pressure == MemoryPressure::Critical) {
+        heap.deleteAllCodeBlocks(DeleteAllCodeIfNotCollecting);
+        heap.deleteAllUnlinkedCodeBlocks(DeleteAllCodeIfNotCollecting);
+    } else {
+        // Execution times are otherwise only as fresh as the last collection, which may be long past.
+        heap.forEachCodeBlock([] (CodeBlock* codeBlock) {
+            codeBlock->updateActivity();
+        });
+        heap.jettisonCodeNotExecutedSince(MonotonicTime::now() - Seconds(Options::memoryPressureColdCodeSeconds()));
+    }
+    heap.collectNow(Synchronousness::Sync, CollectionScope::Full);
+
+    auto codeMemoryAfter = heap.codeBlockSet().codeMemoryStatistics();
+    auto totalBytes = [] (const CodeBlockSet::CodeMemoryStatistics& statistics, size_t CodeBlockSet::TierStatistics::* field) {
+        return statistics.llint.*field + statistics.baseline.*field + statistics.dfg.*field + statistics.ftl.*field;
+    };
+    response.machineCodeBytes = released(totalBytes(codeMemoryBefore, &CodeBlockSet::TierStatistics::machineCodeBytes), totalBytes(codeMemoryAfter, &CodeBlockSet::TierStatistics::machineCodeBytes));
+    response.bytecodeBytes = released(totalBytes(codeMemoryBefore, &CodeBlockSet::TierStatistics::bytecodeBytes), totalBytes(codeMemoryAfter, &CodeBlockSet::TierStatistics::bytecodeBytes));
+    response.executableMemoryBytes = released(executableMemoryBefore, ExecutableAllocator::committedByteCount());
+    response.heapBytes = released(heapBefore, heap.capacity());
+
+    if (pressure == MemoryPressure::Critical) {
+        if (m_parserArenaPool)
+            m_parserArenaPool->clear();
+        ArrayBufferPool::singleton().clear();
+        WTF::releaseFastMallocFreeMemory();
+    }
+    return response;
+}
+
 SourceProviderCache* VM::addSourceProviderCache(SourceProvider* sourceProvider)
 {
     auto addResult = sourceProviderCacheMap.add(sourceProvider, nullptr);
@@ -942,6 +1017,13 @@ void VM::clearSourceProviderCaches()
     sourceProviderCacheMap.clear();
 }
 
+ParserArenaPool& VM::parserArenaPool()
+{
+    if (UNLIKELY(!m_parserArenaPool))
+        m_parserArenaPool = makeUnique<ParserArenaPool>();
+    return *m_parserArenaPool;
+}
+
 Exception* VM::throwException(JSGlobalObject* globalObject, Exception* exception)
 {
     CallFrame* throwOriginFrame = topJSCallFrame();
@@ -1282,7 +1364,7 @@ void VM::dumpTypeProfilerData()
 
 void VM::queueMicrotask(JSGlobalObject& globalObject, Ref<Microtask>&& task)
 {
-    m_microtaskQueue.append(makeUnique<QueuedTask>(*this, &globalObject, WTFMove(task)));
+    m_microtaskQueue.append(QueuedTask { *this, &globalObject, WTFMove(task) });
 }
 
 void VM::callPromiseRejectionCallback(Strong<JSPromise>& promise)
@@ -1323,7 +1405,7 @@ void VM::drainMicrotasks()
 {
     do {
         while (!m_microtaskQueue.isEmpty()) {
-            m_microtaskQueue.takeFirst()->run();
+            m_microtaskQueue.takeFirst().run();
             if (m_onEachMicrotaskTick)
                 m_onEachMicrotaskTick(*this);
         }
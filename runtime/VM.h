@@ -33,6 +33,7 @@
 #include "CompleteSubspace.h"
 #include "ConcurrentJSLock.h"
 #include "DeleteAllCodeEffort.h"
+#include "DictionaryFlatteningPolicy.h"
 #include "DisallowVMEntry.h"
 #include "ExceptionEventLocation.h"
 #include "FunctionHasExecutedCache.h"
@@ -45,9 +46,12 @@
 #include "JSCJSValue.h"
 #include "JSDateMath.h"
 #include "JSLock.h"
+#include "LLIntPolymorphicGetByIdCache.h"
 #include "MacroAssemblerCodeRef.h"
 #include "Microtask.h"
 #include "NumericStrings.h"
+#include "RecentIdentifierCache.h"
+#include "RuntimeCounters.h"
 #include "SmallStrings.h"
 #include "Strong.h"
 #include "StructureCache.h"
@@ -163,8 +167,11 @@ class JSWebAssemblyModule;
 class JSWebAssemblyTable;
 class JITThunks;
 class LLIntOffsetsExtractor;
+class MegamorphicCache;
 class NativeExecutable;
 class ObjCCallbackFunction;
+class ObjectCloneCache;
+class ParserArenaPool;
 class DeferredWorkTimer;
 class RegExp;
 class RegExpCache;
@@ -233,6 +240,14 @@ public:
     {
     }
 
+    // Tasks live inline in the microtask queue, so moving one must hand over its handle rather
+    // than allocate a new one the way copying a Strong would.
+    QueuedTask(QueuedTask&& other)
+        : m_microtask(WTFMove(other.m_microtask))
+    {
+        m_globalObject.swap(other.m_globalObject);
+    }
+
 private:
     Strong<JSGlobalObject> m_globalObject;
     Ref<Microtask> m_microtask;
@@ -315,6 +330,8 @@ public:
     JS_EXPORT_PRIVATE SamplingProfiler& ensureSamplingProfiler(Ref<Stopwatch>&&);
 #endif
 
+    RuntimeCounters& runtimeCounters() { return m_runtimeCounters; }
+
     FuzzerAgent* fuzzerAgent() const { return m_fuzzerAgent.get(); }
     void setFuzzerAgent(std::unique_ptr<FuzzerAgent>&& fuzzerAgent)
     {
@@ -719,10 +736,22 @@ public:
     const ArgList* emptyList;
     SmallStrings smallStrings;
     NumericStrings numericStrings;
+    RecentIdentifierCache recentIdentifiers;
+#if USE(JSVALUE64)
+    LLIntPolymorphicGetByIdCache llintPolymorphicGetByIdCache;
+#endif
+    DictionaryFlatteningPolicy dictionaryFlatteningPolicy;
+    HashMap<String, unsigned> structureTransitionSites;
     std::unique_ptr<SimpleStats> machineCodeBytesPerBytecodeWordForBaselineJIT;
     WeakGCMap<std::pair<CustomGetterSetter*, int>, JSCustomGetterSetterFunction> customGetterSetterFunctionMap;
     WeakGCMap<StringImpl*, JSString, PtrHash<StringImpl*>> stringCache;
     Strong<JSString> lastCachedString;
+    // Ropes that append to the string last resolved into this buffer are resolved in place behind it.
+    // Only the first ropeAppendBufferLength characters are in use. See JSRopeString::resolveRopeInAppendBuffer().
+    RefPtr<StringImpl> ropeAppendBuffer;
+    unsigned ropeAppendBufferLength { 0 };
+    // Only ever compared against, never dereferenced, so it does not matter if it is stale.
+    const StringImpl* lastRopeResolvedOutsideAppendBuffer { nullptr };
 
     AtomStringTable* atomStringTable() const { return m_atomStringTable; }
     WTF::SymbolRegistry& symbolRegistry() { return m_symbolRegistry; }
@@ -793,7 +822,7 @@ public:
 
     static bool useUnlinkedCodeBlockJettisoning()
     {
-        return Options::useUnlinkedCodeBlockJettisoning() || isInMiniMode();
+        return Options::useUnlinkedCodeBlockJettisoning() || Options::codeMemoryBudget() || isInMiniMode();
     }
 
     static void computeCanUseJIT();
@@ -801,6 +830,8 @@ public:
     SourceProviderCache* addSourceProviderCache(SourceProvider*);
     void clearSourceProviderCaches();
 
+    ParserArenaPool& parserArenaPool();
+
     StructureCache structureCache;
 
     typedef HashMap<RefPtr<SourceProvider>, RefPtr<SourceProviderCache>> SourceProviderCacheMap;
@@ -985,6 +1016,14 @@ public:
     ALWAYS_INLINE HasOwnPropertyCache* hasOwnPropertyCache() { return m_hasOwnPropertyCache.get(); }
     HasOwnPropertyCache* ensureHasOwnPropertyCache();
 
+    std::unique_ptr<MegamorphicCache> m_megamorphicCache;
+    ALWAYS_INLINE MegamorphicCache* megamorphicCache() { return m_megamorphicCache.get(); }
+    MegamorphicCache* ensureMegamorphicCache();
+
+    std::unique_ptr<ObjectCloneCache> m_objectCloneCache;
+    ALWAYS_INLINE ObjectCloneCache* objectCloneCache() { return m_objectCloneCache.get(); }
+    ObjectCloneCache* ensureObjectCloneCache();
+
 #if ENABLE(REGEXP_TRACING)
     typedef ListHashSet<RegExp*> RTTraceList;
     RTTraceList* m_rtTraceList;
@@ -1018,6 +1057,23 @@ public:
 
     void shrinkFootprintWhenIdle();
 
+    enum class MemoryPressure : uint8_t { Moderate, Critical };
+    // Bytes released by each step of respondToMemoryPressure().
+    struct MemoryPressureResponse {
+        size_t codeCacheBytes { 0 };
+        size_t regExpCodeBytes { 0 };
+        size_t sourceProviderCacheBytes { 0 };
+        size_t machineCodeBytes { 0 };
+        size_t bytecodeBytes { 0 };
+        size_t executableMemoryBytes { 0 };
+        size_t heapBytes { 0 };
+    };
+    // Moderate pressure halves the CodeCache and jettisons code that has not run for
+    // Options::memoryPressureColdCodeSeconds(). Critical pressure empties the CodeCache and
+    // throws away all code. Both drop RegExp code and SourceProviderCaches, then run a full
+    // collection that returns empty blocks. This must be called from outside the VM.
+    JS_EXPORT_PRIVATE MemoryPressureResponse respondToMemoryPressure(MemoryPressure);
+
     WatchpointSet* ensureWatchpointSetForImpureProperty(UniquedStringImpl*);
     
     // FIXME: Use AtomString once it got merged with Identifier.
@@ -1036,8 +1092,8 @@ public:
     FunctionHasExecutedCache* functionHasExecutedCache() { return &m_functionHasExecutedCache; }
 
     ControlFlowProfiler* controlFlowProfiler() { return m_controlFlowProfiler.get(); }
-    bool enableControlFlowProfiler();
-    bool disableControlFlowProfiler();
+    JS_EXPORT_PRIVATE bool enableControlFlowProfiler();
+    JS_EXPORT_PRIVATE bool disableControlFlowProfiler();
 
     void queueMicrotask(JSGlobalObject&, Ref<Microtask>&&);
     JS_EXPORT_PRIVATE void drainMicrotasks();
@@ -1197,6 +1253,7 @@ private:
     bool m_shouldBuildPCToCodeOriginMapping { false };
     std::unique_ptr<CodeCache> m_codeCache;
     std::unique_ptr<IntlCache> m_intlCache;
+    std::unique_ptr<ParserArenaPool> m_parserArenaPool;
     std::unique_ptr<BuiltinExecutables> m_builtinExecutables;
     HashMap<RefPtr<UniquedStringImpl>, RefPtr<WatchpointSet>> m_impurePropertyWatchpointSets;
     std::unique_ptr<TypeProfiler> m_typeProfiler;
@@ -1211,7 +1268,7 @@ private:
     FunctionHasExecutedCache m_functionHasExecutedCache;
     std::unique_ptr<ControlFlowProfiler> m_controlFlowProfiler;
     unsigned m_controlFlowProfilerEnabledCount;
-    Deque<std::unique_ptr<QueuedTask>> m_microtaskQueue;
+    Deque<QueuedTask> m_microtaskQueue;
     MallocPtr<EncodedJSValue, VMMalloc> m_exceptionFuzzBuffer;
     VMTraps m_traps;
     RefPtr<Watchdog> m_watchdog;
@@ -1219,6 +1276,7 @@ private:
 #if ENABLE(SAMPLING_PROFILER)
     RefPtr<SamplingProfiler> m_samplingProfiler;
 #endif
+    RuntimeCounters m_runtimeCounters;
     std::unique_ptr<FuzzerAgent> m_fuzzerAgent;
     std::unique_ptr<ShadowChicken> m_shadowChicken;
     std::unique_ptr<BytecodeIntrinsicRegistry> m_bytecodeIntrinsicRegistry;
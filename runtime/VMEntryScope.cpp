@@ -28,6 +28,7 @@
 
 #include "Options.h"
 #include "SamplingProfiler.h"
+#include "USDTProbes.h"
 #include "VM.h"
 #include "WasmCapabilities.h"
 #include "WasmMachineThreads.h"
@@ -72,6 +73,7 @@ VMEntryScope::VMEntryScope(VM& vm, JSGlobalObject* globalObject)
 #endif
         if (UNLIKELY(Options::useTracePoints()))
             tracePoint(VMEntryScopeStart);
+        JSC_USDT_PROBE(vm__entry);
     }
 
     vm.clearLastException();
@@ -91,6 +93,7 @@ VMEntryScope::~VMEntryScope()
 
     if (Options::useTracePoints())
         tracePoint(VMEntryScopeEnd);
+    JSC_USDT_PROBE(vm__exit);
     
     if (m_vm.watchdog())
         m_vm.watchdog()->exitedVM();
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "WaiterListManager.h"
+
+#include "DeferredWorkTimer.h"
+#include "JSCInlines.h"
+#include "JSPromise.h"
+#include <wtf/NeverDestroyed.h>
+
+namespace JSC {
+
+class WaiterListManager::Waiter : public ThreadSafeRefCounted<Waiter>, public DoublyLinkedListNode<Waiter> {
+public:
+    friend class WTF::DoublyLinkedListNode<Waiter>;
+
+    Waiter(VM& vm, void* pointer, JSPromise* promise)
+        : vm(&vm)
+        , pointer(pointer)
+        , promise(promise)
+    {
+    }
+
+    VM* vm;
+    void* pointer;
+    // Kept alive by the pending work on vm's DeferredWorkTimer.
+    JSPromise* promise;
+    // Guarded by the manager's lock; cleared once the waiter leaves its list.
+    bool isWaiting { true };
+
+private:
+    Waiter* m_prev { nullptr };
+    Waiter* m_next { nullptr };
+};
+
+WaiterListManager::WaiterListManager()
+    : m_timeoutQueue(WorkQueue::create("jsc.waitAsync.queue", WorkQueue::Type::Serial, WorkQueue::QOS::Utility))
+{
+}
+
+WaiterListManager& WaiterListManager::singleton()
+{
+    static NeverDestroyed<WaiterListManager> manager;
+    return manager;
+}
+
+bool WaiterListManager::addWaiterIfEqual(VM& vm, int32_t* pointer, int32_t expectedValue, JSPromise* promise, Seconds timeout)
+{
+    auto locker = holdLock(m_lock);
+    if (WTF::atomicLoad(pointer) != expectedValue)
+        return false;
+
+    Ref<Waiter> waiter = adoptRef(*new Waiter(vm, pointer, promise));
+    auto& list = m_waiterLists.ensure(pointer, [] {
+        return makeUnique<WaiterList>();
+    }).iterator->value;
+    list->append(waiter.ptr());
+    // The list's reference, dropped by removeWaiter.
+    waiter->ref();
+
+    if (timeout != Seconds::infinity()) {
+        m_timeoutQueue->dispatchAfter(timeout, [this, waiter = WTFMove(waiter)] {
+            auto locker = holdLock(m_lock);
+            if (waiter->isWaiting)
+                resolveWaiter(locker, waiter.get(), true);
+        });
+    }
+    return true;
+}
+
+unsigned WaiterListManager::notifyWaiters(void* pointer, unsigned count)
+{
+    auto locker = holdLock(m_lock);
+    unsigned notified = 0;
+    while (notified < count) {
+        // Resolving the last waiter removes the list.
+        auto iterator = m_waiterLists.find(pointer);
+        if (iterator == m_waiterLists.end())
+            break;
+        resolveWaiter(locker, *iterator->value->head(), false);
+        ++notified;
+    }
+    return notified;
+}
+
+void WaiterListManager::unregister(VM& vm)
+{
+    auto locker = holdLock(m_lock);
+    Vector<Waiter*> waiters;
+    for (auto& entry : m_waiterLists) {
+        for (Waiter* waiter = entry.value->head(); waiter; waiter = waiter->next()) {
+            if (waiter->vm == &vm)
+                waiters.append(waiter);
+        }
+    }
+    for (Waiter* waiter : waiters)
+        removeWaiter(locker, *waiter);
+}
+
+void WaiterListManager::removeWaiter(const AbstractLocker&, Waiter& waiter)
+{
+    ASSERT(waiter.isWaiting);
+    waiter.isWaiting = false;
+
+    auto iterator = m_waiterLists.find(waiter.pointer);
+    ASSERT(iterator != m_waiterLists.end());
+    iterator->value->remove(&waiter);
+    if (iterator->value->isEmpty())
+        m_waiterLists.remove(iterator);
+    waiter.deref();
+}
+
+void WaiterListManager::resolveWaiter(const AbstractLocker& locker, Waiter& waiter, bool didTimeOut)
+{
+    VM& vm = *waiter.vm;
+    JSPromise* promise = waiter.promise;
+    removeWaiter(locker, waiter);
+
+    // The VM cannot be destroyed while we hold the lock, since it unregisters its waiters first.
+    vm.deferredWorkTimer->scheduleWorkSoon(promise, [promise, didTimeOut, &vm] {
+        JSString* result = didTimeOut ? vm.smallStrings.timedOutString() : vm.smallStrings.okString();
+        promise->resolve(promise->globalObject(), result);
+    });
+}
+
+} // namespace JSC
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include <wtf/DoublyLinkedList.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/Seconds.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/WorkQueue.h>
+
+namespace JSC {
+
+class JSPromise;
+class VM;
+
+// Tracks the promises returned by Atomics.waitAsync. Waiters can be woken by a notify from any
+// thread, in any VM sharing the memory, and are resolved through their own VM's
+// DeferredWorkTimer, so nothing ever polls or blocks a thread on their behalf.
+class WaiterListManager {
+    WTF_MAKE_NONCOPYABLE(WaiterListManager);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    WaiterListManager();
+
+    static WaiterListManager& singleton();
+
+    // Returns false, without registering anything, if *pointer no longer holds expectedValue. The
+    // check and the registration are atomic with respect to notifyWaiters. The promise must already
+    // be pending work on vm's DeferredWorkTimer.
+    bool addWaiterIfEqual(VM&, int32_t* pointer, int32_t expectedValue, JSPromise*, Seconds timeout);
+
+    // Wakes up to count waiters on pointer in the order they started waiting and returns how many were woken.
+    unsigned notifyWaiters(void* pointer, unsigned count);
+
+    // Forgets every waiter from a VM that is going away, since its DeferredWorkTimer cannot be used anymore.
+    void unregister(VM&);
+
+private:
+    class Waiter;
+    using WaiterList = DoublyLinkedList<Waiter>;
+
+    void removeWaiter(const AbstractLocker&, Waiter&);
+    void resolveWaiter(const AbstractLocker&, Waiter&, bool didTimeOut);
+
+    Lock m_lock;
+    HashMap<void*, std::unique_ptr<WaiterList>> m_waiterLists;
+    Ref<WorkQueue> m_timeoutQueue;
+};
+
+} // namespace JSC
@@ -85,6 +85,12 @@ public:
         return false;
     }
 
+    // Counts entries whose value may already be dead but has not been pruned yet.
+    unsigned size() const
+    {
+        return m_map.size();
+    }
+
     inline iterator find(const KeyType& key);
 
     inline const_iterator find(const KeyType& key) const;
@@ -68,14 +68,56 @@ void WeakMapImpl<WeakMapBucket<WeakMapBucketDataKeyValue>>::visitOutputConstrain
     auto* thisObject = jsCast<WeakMapImpl*>(cell);
     auto locker = holdLock(thisObject->cellLock());
     auto* buffer = thisObject->buffer();
-    for (uint32_t index = 0; index < thisObject->m_capacity; ++index) {
-        auto* bucket = buffer + index;
-        if (bucket->isEmpty() || bucket->isDeleted())
-            continue;
-        if (!vm.heap.isMarked(bucket->key()))
-            continue;
-        bucket->visitAggregate(visitor);
+
+    // This constraint is executed again every time marking makes progress. Big tables would make
+    // each of those passes expensive, so after the first pass of a collection we only look at the
+    // buckets whose key was unmarked last time. Removal only ever turns buckets into deleted ones,
+    // so the remembered indices stay valid until the table is added to or rehashed.
+    uint64_t collectionNumber = vm.heap.collectionNumber();
+    uint32_t mutationCount = thisObject->m_ephemeronMutationCount;
+    WTF::loadLoadFence();
+    bool isIncremental = thisObject->m_ephemeronCollectionNumber == collectionNumber
+        && thisObject->m_ephemeronMutationCountAtLastScan == mutationCount;
+    Vector<uint32_t>& unmarkedKeyIndices = thisObject->m_unmarkedKeyIndices;
+    size_t bucketsScanned = 0;
+    size_t valuesVisited = 0;
+
+    if (isIncremental) {
+        size_t dstIndex = 0;
+        for (uint32_t index : unmarkedKeyIndices) {
+            auto* bucket = buffer + index;
+            bucketsScanned++;
+            if (bucket->isEmpty() || bucket->isDeleted())
+                continue;
+            if (!vm.heap.isMarked(bucket->key())) {
+                unmarkedKeyIndices[dstIndex++] = index;
+                continue;
+            }
+            bucket->visitAggregate(visitor);
+            valuesVisited++;
+        }
+        unmarkedKeyIndices.shrink(dstIndex);
+    } else {
+        unmarkedKeyIndices.shrink(0);
+        for (uint32_t index = 0; index < thisObject->m_capacity; ++index) {
+            auto* bucket = buffer + index;
+            bucketsScanned++;
+            if (bucket->isEmpty() || bucket->isDeleted())
+                continue;
+            if (!vm.heap.isMarked(bucket->key())) {
+                unmarkedKeyIndices.append(index);
+                continue;
+            }
+            bucket->visitAggregate(visitor);
+            valuesVisited++;
+        }
+        thisObject->m_ephemeronCollectionNumber = collectionNumber;
+        thisObject->m_ephemeronMutationCountAtLastScan = mutationCount;
     }
+
+    vm.heap.didVisitEphemeronTable(bucketsScanned, valuesVisited, isIncremental);
+    if (UNLIKELY(Options::logGC() == GCLogging::Verbose))
+        dataLogLn("Ephemeron table ", RawPointer(thisObject), ": capacity ", thisObject->m_capacity, ", scanned ", bucketsScanned, isIncremental ? " incrementally" : "", ", visited ", valuesVisited, ", unmarked keys ", unmarkedKeyIndices.size());
 }
 
 template <typename WeakMapBucket>
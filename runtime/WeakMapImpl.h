@@ -369,6 +369,7 @@ private:
             if (canUseBucket(bucket, key)) {
                 ASSERT(!bucket->isDeleted());
                 bucket->setValue(vm, this, value);
+                didMutateForEphemeronProcessing();
                 return;
             }
             index = (index + 1) & mask;
@@ -379,6 +380,16 @@ private:
         newEntry->setKey(vm, this, key);
         newEntry->setValue(vm, this, value);
         ++m_keyCount;
+        didMutateForEphemeronProcessing();
+    }
+
+    // The GC may now have to visit a value it has not seen, so it cannot trust the unmarked key
+    // indices it remembered from an earlier pass. The count is bumped after the bucket is written
+    // so that a concurrent marker that sees the new count also sees the bucket.
+    ALWAYS_INLINE void didMutateForEphemeronProcessing()
+    {
+        WTF::storeStoreFence();
+        ++m_ephemeronMutationCount;
     }
 
     ALWAYS_INLINE WeakMapBucketType* findBucketAlreadyHashed(JSObject* key, uint32_t hash)
@@ -409,6 +420,7 @@ private:
         // This rehash modifies m_buffer which is not GC-managed buffer. But m_buffer can be touched in
         // visitOutputConstraints. Thus, we should guard it with cellLock.
         auto locker = holdLock(cellLock());
+        ++m_ephemeronMutationCount;
 
         uint32_t oldCapacity = m_capacity;
         MallocPtr<WeakMapBufferType, JSValueMalloc> oldBuffer = WTFMove(m_buffer);
@@ -482,6 +494,14 @@ private:
     uint32_t m_capacity { 0 };
     uint32_t m_keyCount { 0 };
     uint32_t m_deleteCount { 0 };
+
+    // State for incremental ephemeron processing in visitOutputConstraints(). The GC remembers
+    // which buckets still had an unmarked key, and only needs to look at those again as long as
+    // it is the same collection and the mutator has not added anything or rehashed since.
+    Vector<uint32_t> m_unmarkedKeyIndices;
+    uint64_t m_ephemeronCollectionNumber { 0 };
+    uint32_t m_ephemeronMutationCount { 0 };
+    uint32_t m_ephemeronMutationCountAtLastScan { 0 };
 };
 
 } // namespace JSC
@@ -48,6 +48,8 @@ void WeakMapImpl<WeakMapBucket>::finalizeUnconditionally(VM& vm)
         --m_keyCount;
     }
 
+    m_unmarkedKeyIndices.clear();
+
     if (shouldShrink())
         rehash(RehashMode::RemoveBatching);
 }
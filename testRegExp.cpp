@@ -24,6 +24,9 @@
 #include "InitializeThreading.h"
 #include "JSCInlines.h"
 #include "YarrFlags.h"
+#include "YarrInterpreter.h"
+#include "YarrLinearTimeMatcher.h"
+#include "YarrPattern.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -405,6 +408,343 @@ static RegExpTest* parseTestLine(char* line, int lineLength)
     return result;
 }
 
+struct DifferentialTest {
+    const char* pattern;
+    const char* flags;
+    String subject;
+    unsigned start;
+};
+
+static String make16Bit(const char* characters)
+{
+    Vector<UChar> result;
+    for (const char* character = characters; *character; ++character)
+        result.append(static_cast<unsigned char>(*character));
+    return String(result.data(), result.size());
+}
+
+static void printDifferentialTest(const char* description, const DifferentialTest& test)
+{
+    printf("%s: /%s/%s on \"%s\" (%s-bit) from %u\n", description, test.pattern, test.flags, test.subject.utf8().data(), test.subject.is8Bit() ? "8" : "16", test.start);
+}
+
+// Matches with the backtracking interpreter. With useLinearTimeMatcher, a linear-time matcher is then
+// attached to the same BytecodePattern, and interpret() runs it instead for the second output.
+static bool interpretWithAndWithoutLinearTimeMatcher(VM& vm, const DifferentialTest& test, bool useLinearTimeMatcher, unsigned& interpreterResult, Vector<unsigned>& interpreterOutput, unsigned& linearTimeResult, Vector<unsigned>& linearTimeOutput)
+{
+    auto flags = Yarr::parseFlags(test.flags);
+    RELEASE_ASSERT(flags);
+    Yarr::ErrorCode errorCode = Yarr::ErrorCode::NoError;
+    Yarr::YarrPattern pattern(String::fromUTF8(test.pattern), flags.value(), errorCode);
+    if (Yarr::hasError(errorCode)) {
+        printDifferentialTest(Yarr::errorMessage(errorCode), test);
+        return false;
+    }
+
+    std::unique_ptr<Yarr::LinearTimeMatcher> matcher;
+    if (useLinearTimeMatcher) {
+        matcher = Yarr::LinearTimeMatcher::tryCreate(pattern);
+        if (!matcher) {
+            printDifferentialTest("Not handled by the linear-time matcher", test);
+            return false;
+        }
+    }
+
+    auto bytecode = Yarr::byteCompile(pattern, &vm.m_regExpAllocator, errorCode, &vm.m_regExpAllocatorLock);
+    if (!bytecode) {
+        printDifferentialTest(Yarr::errorMessage(errorCode), test);
+        return false;
+    }
+
+    unsigned offsetVectorSize = (pattern.m_numSubpatterns + 1) * 2;
+    interpreterOutput = Vector<unsigned>(offsetVectorSize, Yarr::offsetNoMatch);
+    interpreterResult = Yarr::interpret(bytecode.get(), test.subject, test.start, interpreterOutput.data());
+
+    if (matcher) {
+        bytecode->m_linearTimeMatcher = WTFMove(matcher);
+        linearTimeOutput = Vector<unsigned>(offsetVectorSize, Yarr::offsetNoMatch);
+        linearTimeResult = Yarr::interpret(bytecode.get(), test.subject, test.start, linearTimeOutput.data());
+    }
+    return true;
+}
+
+// Captures that did not participate only need to agree on their start.
+static bool sameMatch(unsigned expectedResult, const Vector<unsigned>& expected, unsigned actualResult, const Vector<unsigned>& actual)
+{
+    if (expectedResult != actualResult || expected.size() != actual.size())
+        return false;
+    if (expectedResult == Yarr::offsetNoMatch)
+        return true;
+    for (size_t i = 0; i < expected.size(); i += 2) {
+        if (expected[i] != actual[i])
+            return false;
+        if (expected[i] != Yarr::offsetNoMatch && expected[i + 1] != actual[i + 1])
+            return false;
+    }
+    return true;
+}
+
+static void printMatch(const char* engine, unsigned result, const Vector<unsigned>& output)
+{
+    printf("    %s:", engine);
+    if (result == Yarr::offsetNoMatch) {
+        printf(" no match\n");
+        return;
+    }
+    for (size_t i = 0; i < output.size(); i += 2) {
+        if (output[i] == Yarr::offsetNoMatch)
+            printf(" (-)");
+        else
+            printf(" (%u, %u)", output[i], output[i + 1]);
+    }
+    printf("\n");
+}
+
+static bool runLinearTimeMatcherTests(VM& vm, bool verbose)
+{
+    String emoji = String::fromUTF8("\xF0\x9F\x98\x80");
+    Vector<DifferentialTest> tests = {
+        // Captures, including ones that are reset by a later loop iteration.
+        { "(a|ab)(c|bcd)(d*)", "", "abcd", 0 },
+        { "(\\d+)-(\\d+)", "", "tel 12-345 or 6-7", 0 },
+        { "(?:(a)|b)+", "", "ab", 0 },
+        { "(?:(a)|(b))+", "", "aba", 0 },
+        { "((a)|b)+c", "", "abbc", 0 },
+        { "(a+?)(a*)", "", "aaa", 0 },
+        { "(x)?y", "", "y", 0 },
+        { "(?<year>\\d{4})-(?<month>\\d{2})", "", "on 2026-10-14", 0 },
+        // Anchors and word boundaries.
+        { "^abc$", "", "abc", 0 },
+        { "^abc$", "", "abcd", 0 },
+        { "^b", "", "a\nb", 0 },
+        { "^b", "m", "a\nb", 0 },
+        { "a$", "m", "a\nb", 0 },
+        { "\\bfoo\\b", "", "a foo.", 0 },
+        { "\\bfoo\\b", "", "afoo", 0 },
+        { "\\Bo", "", "foo", 0 },
+        { "^", "", "abc", 1 },
+        { "$", "", "abc", 0 },
+        // Case-folding.
+        { "[a-z]+", "i", "123 HeLLo", 0 },
+        { "hello", "i", "HELLO", 0 },
+        { "\\u212a", "i", "k", 0 },
+        { "\\u212a", "iu", "k", 0 },
+        { "\\u03c3+", "iu", String::fromUTF8("\xCE\xA3\xCF\x82\xCF\x83"), 0 },
+        { "\\w", "iu", String::fromUTF8("\xE2\x84\xAA"), 0 },
+        // Unicode patterns and 16-bit input.
+        { ".", "", emoji, 0 },
+        { ".", "u", emoji, 0 },
+        { "^.$", "u", emoji, 0 },
+        { "^..$", "", emoji, 0 },
+        { "[\\u{1F600}-\\u{1F602}]", "u", makeString("x", emoji), 0 },
+        { "\\((.+)\\)", "", String::fromUTF8("\xE6\x97\xA5\xE6\x9C\xAC(\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88)"), 0 },
+        { "(b+)c", "", make16Bit("aabbbc"), 0 },
+        { "\\bbar", "i", make16Bit("foo BAR"), 0 },
+        // Empty matches.
+        { "a*", "", "bbb", 0 },
+        { "a*?", "", "aaa", 0 },
+        { "x*", "", "abc", 3 },
+        { "(a*)b", "", "b", 0 },
+        { "", "", "abc", 1 },
+        { "(?:)", "", make16Bit("abc"), 2 },
+        // Start offsets, as lastIndex sets them, and sticky matching.
+        { "a", "", "aaa", 2 },
+        { "a", "", "aaa", 3 },
+        { "a", "", "aaa", 4 },
+        { "b", "y", "ab", 0 },
+        { "b", "y", "ab", 1 },
+        { "(a)(b)?", "y", "xaab", 2 },
+        { ".", "uy", makeString(emoji, emoji), 2 },
+        { "b", "g", make16Bit("abab"), 2 },
+    };
+
+    unsigned failures = 0;
+    for (auto& test : tests) {
+        unsigned interpreterResult = Yarr::offsetNoMatch;
+        unsigned linearTimeResult = Yarr::offsetNoMatch;
+        Vector<unsigned> interpreterOutput;
+        Vector<unsigned> linearTimeOutput;
+        if (!interpretWithAndWithoutLinearTimeMatcher(vm, test, true, interpreterResult, interpreterOutput, linearTimeResult, linearTimeOutput)) {
+            failures++;
+            continue;
+        }
+        if (sameMatch(interpreterResult, interpreterOutput, linearTimeResult, linearTimeOutput))
+            continue;
+        failures++;
+        printDifferentialTest("Linear-time matcher disagrees with the interpreter", test);
+        if (verbose) {
+            printMatch("interpreter", interpreterResult, interpreterOutput);
+            printMatch("linear-time", linearTimeResult, linearTimeOutput);
+        }
+    }
+
+    if (failures)
+        printf("%zu linear-time matcher tests run, %u failures\n", tests.size(), failures);
+    else
+        printf("%zu linear-time matcher tests passed\n", tests.size());
+    return !failures;
+}
+
+// Matches each test through RegExp, which uses YarrJIT when it can, with and without subpatterns, and
+// counts the tests where either disagrees with the interpreter.
+static unsigned countRegExpDisagreementsWithInterpreter(JSGlobalObject* globalObject, const Vector<DifferentialTest>& tests, bool verbose)
+{
+    VM& vm = globalObject->vm();
+    unsigned failures = 0;
+    for (auto& test : tests) {
+        unsigned interpreterResult = Yarr::offsetNoMatch;
+        unsigned unusedResult = Yarr::offsetNoMatch;
+        Vector<unsigned> interpreterOutput;
+        Vector<unsigned> unusedOutput;
+        if (!interpretWithAndWithoutLinearTimeMatcher(vm, test, false, interpreterResult, interpreterOutput, unusedResult, unusedOutput)) {
+            failures++;
+            continue;
+        }
+
+        RegExp* regexp = RegExp::create(vm, String::fromUTF8(test.pattern), Yarr::parseFlags(test.flags).value());
+        Vector<int> ovector;
+        int result = regexp->match(globalObject, test.subject, test.start, ovector);
+        Vector<unsigned> output;
+        for (int offset : ovector)
+            output.append(static_cast<unsigned>(offset));
+        bool matches = sameMatch(interpreterResult, interpreterOutput, static_cast<unsigned>(result), output);
+
+        MatchResult matchOnlyResult = regexp->match(globalObject, test.subject, test.start);
+        if (interpreterResult == Yarr::offsetNoMatch)
+            matches &= !matchOnlyResult;
+        else
+            matches &= matchOnlyResult.start == interpreterOutput[0] && matchOnlyResult.end == interpreterOutput[1];
+
+        if (matches)
+            continue;
+        failures++;
+        printDifferentialTest("RegExp disagrees with the interpreter", test);
+        if (verbose) {
+            printMatch("interpreter", interpreterResult, interpreterOutput);
+            printMatch("RegExp", static_cast<unsigned>(result), output);
+            printf("    RegExp without subpatterns: (%zu, %zu)\n", matchOnlyResult.start, matchOnlyResult.end);
+        }
+    }
+
+    return failures;
+}
+
+// The patterns start with a literal, so the JIT scans ahead for it.
+static bool runLeadingCharacterScanTests(JSGlobalObject* globalObject, bool verbose)
+{
+    Vector<DifferentialTest> tests = {
+        // The literal at the end of the input, around word boundaries; no match at all.
+        { "x", "", "x", 0 },
+        { "x", "", "aaaaaaax", 0 },
+        { "x", "", "aaaaaaaax", 0 },
+        { "x", "", "aaaaaaaaaaaaaaax", 0 },
+        { "x", "", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaax", 0 },
+        { "xyz", "", "aaaaaaaaaaaaaxyz", 0 },
+        { "xyz", "", "aaaaaaaaaaaaaaxy", 0 },
+        { "x", "", "", 0 },
+        { "x", "", "a", 0 },
+        { "x", "", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", 0 },
+        { "xyz", "", "xyxyxyxyxyxyxyxyxyxyxyxy", 0 },
+        // Neighbouring code units that differ from the literal in one bit, or by a borrow.
+        { "a", "", "`c`c`c`c`c`c`c`ca", 0 },
+        { "a", "", "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01" "a", 0 },
+        { "\\x80", "", String::fromUTF8("\x7F\x7F\x7F\x7F\x7F\x7F\x7F\x7F\xC2\x81\xC2\x80"), 0 },
+        // Candidates that fail to match, so the scan resumes after them.
+        { "x\\d", "", "x x xx xaaaaaaaaaax1", 0 },
+        { "a.c", "", "abxabxabxabxabxabcabc", 0 },
+        { "(x)(\\d+)", "", "aaaaaaaaaaaaaaaax12", 0 },
+        { "ab*c", "", "aaaaaaaaaabbbbbc", 0 },
+        { "ab*c", "", "aaaaaaaaaabbbbbb", 0 },
+        { "-x", "i", "aaaaaaaaaa-X", 0 },
+        // 16-bit input, including code units that share a byte with the literal.
+        { "x", "", make16Bit("aaaaaaax"), 0 },
+        { "x", "", make16Bit("aaaaaaaaaaaaaaaa"), 0 },
+        { "(x)(\\d+)", "", make16Bit("aaaaaaaaaaaaaaaax12"), 0 },
+        { "ab*c", "", make16Bit("aaaaaaaaaabbbbbc"), 0 },
+        { "a", "", String::fromUTF8("\xE6\x84\x80\xC5\xA1\xE6\x84\x80\xC5\xA1\xE6\x84\x80\xC5\xA1" "a"), 0 },
+        { "\\u65e5", "", String::fromUTF8("\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x97\xA5"), 0 },
+        { "\\u65e5", "", String::fromUTF8("\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x9C\xAC\xE6\x9C\xAC"), 0 },
+        { "\\u0161", "", String::fromUTF8("a\xE6\x85\xA1" "aaaaaaaa\xC5\xA1"), 0 },
+        // Non-zero start offsets, as lastIndex sets them.
+        { "x", "", "xaaaaaaaaaaax", 1 },
+        { "x", "", "xaaaaaaaaaaax", 12 },
+        { "x", "", "xaaaaaaaaaaax", 13 },
+        { "x", "", "xaaaaaaaaaaax", 14 },
+        { "xyz", "", "xyzaaaaaaaaaaaaaxyz", 1 },
+        { "xyz", "", "xyzaaaaaaaaaaaaaxyz", 17 },
+        { "ab*c", "", "abcaaaaaaaaaabbc", 1 },
+        { "x", "", make16Bit("xaaaaaaaaaaax"), 5 },
+        { "x", "", make16Bit("xaaaaaaaaaaax"), 13 },
+        { "x", "g", "aaxaaaaaaaaaax", 3 },
+    };
+
+    unsigned failures = countRegExpDisagreementsWithInterpreter(globalObject, tests, verbose);
+    if (failures)
+        printf("%zu leading character scan tests run, %u failures\n", tests.size(), failures);
+    else
+        printf("%zu leading character scan tests passed\n", tests.size());
+    return !failures;
+}
+
+// Both the non-ASCII matches and the non-ASCII ranges of these classes are long enough for YarrJIT
+// to bisect them. Each entry is tried with its neighbours, in 8-bit and 16-bit subjects, since 8-bit
+// code only keeps the entries that a Latin-1 character can match.
+static bool runLargeCharacterClassTests(JSGlobalObject* globalObject, bool verbose)
+{
+    static constexpr UChar rangeBegins[] = { 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0, 0x100, 0x110, 0x120, 0x130, 0x140, 0x150, 0x160, 0x170, 0x180, 0x190 };
+    static constexpr UChar rangeLength = 3;
+    static constexpr UChar singles[] = { 0xa8, 0xb8, 0xc8, 0xd8, 0xe8, 0xf8, 0x108, 0x118, 0x128, 0x138, 0x148, 0x158, 0x168, 0x178, 0x188, 0x198 };
+    const char* patterns[] = {
+        "[\\xa0-\\xa2\\xb0-\\xb2\\xc0-\\xc2\\xd0-\\xd2\\xe0-\\xe2\\xf0-\\xf2\\u0100-\\u0102\\u0110-\\u0112\\u0120-\\u0122\\u0130-\\u0132\\u0140-\\u0142\\u0150-\\u0152\\u0160-\\u0162\\u0170-\\u0172\\u0180-\\u0182\\u0190-\\u0192]",
+        "[\\xa8\\xb8\\xc8\\xd8\\xe8\\xf8\\u0108\\u0118\\u0128\\u0138\\u0148\\u0158\\u0168\\u0178\\u0188\\u0198]",
+        "[a\\xa0-\\xa2\\xb0-\\xb2\\xc0-\\xc2\\xd0-\\xd2\\xe0-\\xe2\\xf0-\\xf2\\u0100-\\u0102\\u0110-\\u0112\\u0120-\\u0122\\u0130-\\u0132\\u0140-\\u0142\\u0150-\\u0152\\u0160-\\u0162\\u0170-\\u0172\\u0180-\\u0182\\u0190-\\u0192\\xa8\\xb8\\xc8\\xd8\\xe8\\xf8\\u0108\\u0118\\u0128\\u0138\\u0148\\u0158\\u0168\\u0178\\u0188\\u0198]+",
+        "[^\\xa0-\\xa2\\xb0-\\xb2\\xc0-\\xc2\\xd0-\\xd2\\xe0-\\xe2\\xf0-\\xf2\\u0100-\\u0102\\u0110-\\u0112\\u0120-\\u0122\\u0130-\\u0132\\u0140-\\u0142\\u0150-\\u0152\\u0160-\\u0162\\u0170-\\u0172\\u0180-\\u0182\\u0190-\\u0192]",
+    };
+
+    Vector<UChar> characters;
+    for (UChar begin : rangeBegins) {
+        characters.append(begin - 1);
+        characters.append(begin);
+        characters.append(begin + rangeLength - 1);
+        characters.append(begin + rangeLength);
+    }
+    for (UChar single : singles) {
+        characters.append(single - 1);
+        characters.append(single);
+        characters.append(single + 1);
+    }
+
+    Vector<DifferentialTest> tests;
+    for (const char* pattern : patterns) {
+        for (UChar character : characters) {
+            if (character <= 0xff) {
+                LChar subject[] = { 'x', static_cast<LChar>(character), 'x' };
+                tests.append({ pattern, "", String(subject, 3), 0 });
+            }
+            UChar subject[] = { 'x', character, 'x' };
+            tests.append({ pattern, "", String(subject, 3), 0 });
+        }
+    }
+
+    // Unicode property escapes have hundreds of ranges, some of them outside the BMP.
+    const char* propertyPatterns[] = { "\\p{L}", "\\P{L}", "\\p{L}+", "\\p{Sc}", "[\\p{Lu}\\p{Nd}]" };
+    const char* propertySubjects[] = {
+        "!!\xC2\xAA", "!!\xC3\x97", "!!\xC3\xB7\xC3\xBF", "!!\xE2\x84\xB5", "!!\xF0\x9F\x98\x80",
+        "!!\xF0\x9D\x90\x80\xF0\x9D\x90\x81", "aa\xE2\x82\xAC", "\xD9\xA3", "\xF0\x9D\x9F\x8E",
+    };
+    for (const char* pattern : propertyPatterns) {
+        for (const char* subject : propertySubjects)
+            tests.append({ pattern, "u", String::fromUTF8(subject), 0 });
+    }
+
+    unsigned failures = countRegExpDisagreementsWithInterpreter(globalObject, tests, verbose);
+    if (failures)
+        printf("%zu large character class tests run, %u failures\n", tests.size(), failures);
+    else
+        printf("%zu large character class tests passed\n", tests.size());
+    return !failures;
+}
+
 static bool runFromFiles(GlobalObject* globalObject, const Vector<String>& files, bool verbose)
 {
     String script;
@@ -523,7 +863,10 @@ int realMain(int argc, char** argv)
     parseArguments(argc, argv, options);
 
     GlobalObject* globalObject = GlobalObject::create(*vm, GlobalObject::createStructure(*vm, jsNull()), options.arguments);
-    bool success = runFromFiles(globalObject, options.files, options.verbose);
+    bool success = runLinearTimeMatcherTests(*vm, options.verbose);
+    success &= runLeadingCharacterScanTests(globalObject, options.verbose);
+    success &= runLargeCharacterClassTests(globalObject, options.verbose);
+    success &= runFromFiles(globalObject, options.files, options.verbose);
 
     return success ? 0 : 3;
 }
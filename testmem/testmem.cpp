@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+
+#include "APICast.h"
+#include "BlockDirectoryInlines.h"
+#include "CodeCache.h"
+#include "ExecutableAllocator.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "Subspace.h"
+#include "VM.h"
+#include <JavaScriptCore/JavaScript.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Vector.h>
+
+#if OS(DARWIN) && __has_include(<libproc.h>)
+#define HAS_LIBPROC 1
+#include <libproc.h>
+#else
+#define HAS_LIBPROC 0
+#endif
+
+#if OS(UNIX)
+#include <sys/resource.h>
+#endif
+
+using namespace JSC;
+
+namespace {
+
+struct Footprint {
+    uint64_t current { 0 };
+    uint64_t peak { 0 };
+
+    static Footprint now();
+};
+
+#if HAS_LIBPROC && RUSAGE_INFO_CURRENT >= 4
+Footprint Footprint::now()
+{
+    rusage_info_v4 rusage;
+    if (proc_pid_rusage(getpid(), RUSAGE_INFO_V4, (rusage_info_t *)&rusage)) {
+        printf("Failure when calling rusage\n");
+        exit(1);
+    }
+    return { rusage.ri_phys_footprint, rusage.ri_lifetime_max_phys_footprint };
+}
+#elif OS(LINUX)
+Footprint Footprint::now()
+{
+    // VmRSS and VmHWM are the current and peak resident set size, in kB.
+    Footprint footprint;
+    FILE* status = fopen("/proc/self/status", "r");
+    if (!status) {
+        printf("Can't open /proc/self/status\n");
+        exit(1);
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), status)) {
+        unsigned long long kilobytes;
+        if (sscanf(line, "VmRSS: %llu kB", &kilobytes) == 1)
+            footprint.current = kilobytes * KB;
+        else if (sscanf(line, "VmHWM: %llu kB", &kilobytes) == 1)
+            footprint.peak = kilobytes * KB;
+    }
+    fclose(status);
+    return footprint;
+}
+#elif OS(UNIX)
+Footprint Footprint::now()
+{
+    // Only the peak is portably available; ru_maxrss is in kB.
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return { 0, static_cast<uint64_t>(usage.ru_maxrss) * KB };
+}
+#else
+Footprint Footprint::now()
+{
+    return { };
+}
+#endif
+
+bool readFile(const char* path, Vector<char>& buffer)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return false;
+    char chunk[4096];
+    while (size_t length = fread(chunk, 1, sizeof(chunk), file))
+        buffer.append(chunk, length);
+    fclose(file);
+    buffer.append('\0');
+    return true;
+}
+
+void description()
+{
+    printf("usage \n testmem [--iterations <count>] [--baseline-peak <bytes>] [--baseline-steady <bytes>] [--tolerance <percent>] <path-to-file-to-run>...\n");
+}
+
+bool exceedsBaseline(const char* name, uint64_t value, uint64_t baseline, double tolerance)
+{
+    if (!baseline)
+        return false;
+    double limit = baseline * (1 + tolerance / 100);
+    if (value <= limit)
+        return false;
+    printf("FAIL: %s footprint %" PRIu64 " exceeds baseline %" PRIu64 " by more than %.1lf%%\n", name, value, baseline, tolerance);
+    return true;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    size_t iterations = 20;
+    uint64_t baselinePeak = 0;
+    uint64_t baselineSteady = 0;
+    double tolerance = 5;
+
+    int argumentIndex = 1;
+    for (; argumentIndex + 1 < argc && argv[argumentIndex][0] == '-'; argumentIndex += 2) {
+        const char* option = argv[argumentIndex];
+        const char* value = argv[argumentIndex + 1];
+        bool parsed;
+        if (!strcmp(option, "--iterations"))
+            parsed = sscanf(value, "%zu", &iterations) == 1;
+        else if (!strcmp(option, "--baseline-peak"))
+            parsed = sscanf(value, "%" SCNu64, &baselinePeak) == 1;
+        else if (!strcmp(option, "--baseline-steady"))
+            parsed = sscanf(value, "%" SCNu64, &baselineSteady) == 1;
+        else if (!strcmp(option, "--tolerance"))
+            parsed = sscanf(value, "%lf", &tolerance) == 1 && tolerance >= 0;
+        else
+            parsed = false;
+        if (!parsed) {
+            description();
+            exit(1);
+        }
+    }
+
+    if (argumentIndex >= argc) {
+        description();
+        exit(1);
+    }
+
+    Vector<JSStringRef> scripts;
+    for (int i = argumentIndex; i < argc; ++i) {
+        Vector<char> buffer;
+        if (!readFile(argv[i], buffer)) {
+            printf("Can't open file: %s\n", argv[i]);
+            exit(1);
+        }
+        scripts.append(JSStringCreateWithUTF8CString(buffer.data()));
+    }
+
+    WTF::initializeMainThread();
+    JSC::initialize();
+
+    auto startTime = MonotonicTime::now();
+    JSContextGroupRef group = JSContextGroupCreate();
+    for (size_t i = 0; i < iterations; ++i) {
+        for (JSStringRef script : scripts) {
+            JSGlobalContextRef context = JSGlobalContextCreateInGroup(group, nullptr);
+            JSValueRef exception = nullptr;
+            JSEvaluateScript(context, script, nullptr, nullptr, 1, &exception);
+            if (exception) {
+                printf("Unexpected exception thrown\n");
+                exit(1);
+            }
+            JSGlobalContextRelease(context);
+        }
+    }
+    auto time = MonotonicTime::now() - startTime;
+
+    VM& vm = *toJS(group);
+    Footprint peakFootprint = Footprint::now();
+    Footprint steadyFootprint;
+    {
+        JSLockHolder locker(vm);
+
+        // Peak is measured while garbage from the runs is still around; steady state is what
+        // survives a full collection.
+        vm.heap.collectNow(Synchronousness::Sync, CollectionScope::Full);
+        steadyFootprint = Footprint::now();
+
+        printf("time: %lf\n", time.seconds()); // Seconds
+        printf("peak footprint: %" PRIu64 "\n", peakFootprint.peak); // Bytes
+        printf("footprint at end: %" PRIu64 "\n", steadyFootprint.current); // Bytes
+        printf("heap size: %zu\n", vm.heap.size()); // Bytes
+        printf("heap capacity: %zu\n", vm.heap.capacity()); // Bytes
+        printf("heap extra memory: %zu\n", vm.heap.extraMemorySize()); // Bytes
+        printf("JIT memory: %zu\n", ExecutableAllocator::committedByteCount()); // Bytes
+        printf("code cache: %zu\n", vm.codeCache()->statistics().bytes); // Bytes
+
+        struct SubspaceCapacity {
+            const char* name;
+            size_t liveBytes;
+            size_t capacityBytes;
+        };
+        Vector<SubspaceCapacity> subspaces;
+        vm.heap.objectSpace().forEachDirectory(
+            [&] (BlockDirectory& directory) -> IterationStatus {
+                const char* name = directory.subspace()->name();
+                size_t index = subspaces.findMatching([&] (const SubspaceCapacity& subspace) { return !strcmp(subspace.name, name); });
+                if (index == notFound) {
+                    index = subspaces.size();
+                    subspaces.append({ name, 0, 0 });
+                }
+                BlockDirectory::OccupancyStatistics statistics = directory.occupancyStatistics();
+                subspaces[index].liveBytes += statistics.liveCellCount * directory.cellSize();
+                subspaces[index].capacityBytes += statistics.cellCapacity * directory.cellSize();
+                return IterationStatus::Continue;
+            });
+        for (auto& subspace : subspaces)
+            printf("subspace %s: live %zu, capacity %zu\n", subspace.name, subspace.liveBytes, subspace.capacityBytes); // Bytes
+    }
+
+    for (JSStringRef script : scripts)
+        JSStringRelease(script);
+    JSContextGroupRelease(group);
+
+    bool failed = exceedsBaseline("peak", peakFootprint.peak, baselinePeak, tolerance);
+    failed |= exceedsBaseline("steady", steadyFootprint.current, baselineSteady, tolerance);
+    return failed ? 1 : 0;
+}
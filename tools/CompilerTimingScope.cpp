@@ -30,7 +30,6 @@
 #include <wtf/DataLog.h>
 #include <wtf/Lock.h>
 #include <wtf/Vector.h>
-#include <wtf/text/WTFString.h>
 
 namespace JSC {
 
@@ -46,27 +45,59 @@ public:
     {
         auto locker = holdLock(lock);
 
-        for (auto& tuple : totals) {
-            if (String(std::get<0>(tuple)) == String(compilerName) && String(std::get<1>(tuple)) == String(name)) {
-                std::get<2>(tuple) += duration;
-                return std::get<2>(tuple);
-            }
-        }
-
-        totals.append({ compilerName, name, duration });
-        return duration;
+        CompilerPhaseStatistics& statistics = statisticsFor(compilerName, name);
+        statistics.count++;
+        statistics.total += duration;
+        statistics.max = std::max(statistics.max, duration);
+        statistics.histogram[histogramBucket(duration)]++;
+        return statistics.total;
     }
 
     void logTotals()
     {
-        for (auto& tuple : totals) {
+        auto locker = holdLock(lock);
+        for (auto& statistics : totals) {
             dataLogLn(
-                "[", std::get<0>(tuple), "] ", std::get<1>(tuple), " total ms: ", std::get<2>(tuple).milliseconds());
+                "[", statistics.compilerName, "] ", statistics.name, " total ms: ", statistics.total.milliseconds());
         }
     }
+
+    Vector<CompilerPhaseStatistics> snapshot()
+    {
+        auto locker = holdLock(lock);
+        return totals;
+    }
     
 private:
-    Vector<std::tuple<const char*, const char*, Seconds>> totals;
+    CompilerPhaseStatistics& statisticsFor(const char* compilerName, const char* name)
+    {
+        // Names are nearly always string literals, so pointer equality catches most lookups.
+        for (auto& statistics : totals) {
+            if (statistics.compilerName == compilerName && statistics.name == name)
+                return statistics;
+        }
+        for (auto& statistics : totals) {
+            if (!strcmp(statistics.compilerName, compilerName) && !strcmp(statistics.name, name))
+                return statistics;
+        }
+
+        CompilerPhaseStatistics statistics;
+        statistics.compilerName = compilerName;
+        statistics.name = name;
+        totals.append(statistics);
+        return totals.last();
+    }
+
+    static unsigned histogramBucket(Seconds duration)
+    {
+        double microseconds = duration.microseconds();
+        unsigned bucket = 0;
+        while (bucket < CompilerPhaseStatistics::numberOfHistogramBuckets - 1 && microseconds >= static_cast<double>(1u << bucket))
+            bucket++;
+        return bucket;
+    }
+
+    Vector<CompilerPhaseStatistics> totals;
     Lock lock;
 };
 
@@ -76,19 +107,24 @@ CompilerTimingScopeState& compilerTimingScopeState()
     return ensurePointer(s_state, [] { return new CompilerTimingScopeState(); });
 }
 
+bool shouldMeasurePhaseTimes()
+{
+    return Options::logPhaseTimes() || Options::reportTotalPhaseTimes() || Options::collectCompilerPhaseStatistics();
+}
+
 } // anonymous namespace
 
 CompilerTimingScope::CompilerTimingScope(const char* compilerName, const char* name)
     : m_compilerName(compilerName)
     , m_name(name)
 {
-    if (UNLIKELY(Options::logPhaseTimes() || Options::reportTotalPhaseTimes()))
+    if (UNLIKELY(shouldMeasurePhaseTimes()))
         m_before = MonotonicTime::now();
 }
 
 CompilerTimingScope::~CompilerTimingScope()
 {
-    if (UNLIKELY(Options::logPhaseTimes() || Options::reportTotalPhaseTimes())) {
+    if (UNLIKELY(shouldMeasurePhaseTimes())) {
         Seconds duration = MonotonicTime::now() - m_before;
         auto total = compilerTimingScopeState().addToTotal(m_compilerName, m_name, duration);
         if (Options::logPhaseTimes()) {
@@ -100,9 +136,20 @@ CompilerTimingScope::~CompilerTimingScope()
     }
 }
 
+void recordCompilerTime(const char* compilerName, const char* name, Seconds duration)
+{
+    if (UNLIKELY(shouldMeasurePhaseTimes()))
+        compilerTimingScopeState().addToTotal(compilerName, name, duration);
+}
+
 void logTotalPhaseTimes()
 {
     compilerTimingScopeState().logTotals();
 }
 
+Vector<CompilerPhaseStatistics> compilerPhaseStatistics()
+{
+    return compilerTimingScopeState().snapshot();
+}
+
 } // namespace JSC
@@ -25,8 +25,10 @@
 
 #pragma once
 
+#include <array>
 #include <wtf/MonotonicTime.h>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 namespace JSC {
 
@@ -47,6 +49,23 @@ private:
     MonotonicTime m_before;
 };
 
+struct CompilerPhaseStatistics {
+    // Bucket i counts runs that took less than 2^i microseconds; the last bucket also counts
+    // everything slower than that.
+    static constexpr unsigned numberOfHistogramBuckets = 24;
+
+    const char* compilerName;
+    const char* name;
+    unsigned count { 0 };
+    Seconds total;
+    Seconds max;
+    std::array<unsigned, numberOfHistogramBuckets> histogram { };
+};
+
+// For durations measured outside a CompilerTimingScope, such as how long a plan was queued.
+void recordCompilerTime(const char* compilerName, const char* name, Seconds duration);
+
 JS_EXPORT_PRIVATE void logTotalPhaseTimes();
+JS_EXPORT_PRIVATE Vector<CompilerPhaseStatistics> compilerPhaseStatistics();
 
 } // namespace JSC
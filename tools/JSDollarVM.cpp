@@ -29,6 +29,7 @@
 #include "ArrayPrototype.h"
 #include "BuiltinNames.h"
 #include "CodeBlock.h"
+#include "CompilerTimingScope.h"
 #include "ControlFlowProfiler.h"
 #include "DOMAttributeGetterSetter.h"
 #include "DOMJITGetterSetter.h"
@@ -36,13 +37,16 @@
 #include "FrameTracers.h"
 #include "FunctionCodeBlock.h"
 #include "GetterSetter.h"
+#include "HeapIterationScope.h"
 #include "JSArray.h"
 #include "JSCInlines.h"
 #include "JSONObject.h"
 #include "JSString.h"
+#include "MarkingConstraint.h"
 #include "Options.h"
 #include "Parser.h"
 #include "ProbeContext.h"
+#include "PropertyMapHashTable.h"
 #include "ShadowChicken.h"
 #include "Snippet.h"
 #include "SnippetParams.h"
@@ -50,6 +54,7 @@
 #include "TypeProfilerLog.h"
 #include "VMInspector.h"
 #include "WasmCapabilities.h"
+#include "YarrJIT.h"
 #include <unicode/uversion.h>
 #include <wtf/Atomics.h>
 #include <wtf/CPUTime.h>
@@ -82,6 +87,8 @@ public:
 
     void updateVMStackLimits() { return m_vm.updateStackLimits(); };
 
+    static PropertyTable* propertyTableOrNull(Structure* structure) { return structure->propertyTableOrNull(); }
+
     VM& m_vm;
 };
 
@@ -1849,6 +1856,7 @@ static JSC_DECLARE_HOST_FUNCTION(functionFlattenDictionaryObject);
 static JSC_DECLARE_HOST_FUNCTION(functionDumpBasicBlockExecutionRanges);
 static JSC_DECLARE_HOST_FUNCTION(functionHasBasicBlockExecuted);
 static JSC_DECLARE_HOST_FUNCTION(functionBasicBlockExecutionCount);
+static JSC_DECLARE_HOST_FUNCTION(functionResetBasicBlockExecutionCounts);
 static JSC_DECLARE_HOST_FUNCTION(functionEnableDebuggerModeWhenIdle);
 static JSC_DECLARE_HOST_FUNCTION(functionDisableDebuggerModeWhenIdle);
 static JSC_DECLARE_HOST_FUNCTION(functionDeleteAllCodeWhenIdle);
@@ -1876,6 +1884,16 @@ static JSC_DECLARE_HOST_FUNCTION(functionUseJIT);
 static JSC_DECLARE_HOST_FUNCTION(functionIsGigacageEnabled);
 static JSC_DECLARE_HOST_FUNCTION(functionToUncacheableDictionary);
 static JSC_DECLARE_HOST_FUNCTION(functionIsPrivateSymbol);
+static JSC_DECLARE_HOST_FUNCTION(functionCompilerPhaseStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionGCPauseStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionResetGCPauseStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionStructureStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionStructureIDTableStatistics);
+static JSC_DECLARE_HOST_FUNCTION(functionStructureTransitionSites);
+static JSC_DECLARE_HOST_FUNCTION(functionResetStructureTransitionSites);
+#if ENABLE(YARR_JIT)
+static JSC_DECLARE_HOST_FUNCTION(functionYarrJITFailureCounts);
+#endif
 
 const ClassInfo JSDollarVM::s_info = { "DollarVM", &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSDollarVM) };
 
@@ -3036,6 +3054,18 @@ JSC_DEFINE_HOST_FUNCTION(functionBasicBlockExecutionCount, (JSGlobalObject* glob
     return JSValue::encode(JSValue(executionCount));
 }
 
+// Usage: $vm.resetBasicBlockExecutionCounts()
+// Marks every basic block known to the control flow profiler as not executed, so that coverage
+// can be harvested again for a fresh interval.
+JSC_DEFINE_HOST_FUNCTION(functionResetBasicBlockExecutionCounts, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    RELEASE_ASSERT(vm.controlFlowProfiler());
+    vm.controlFlowProfiler()->resetExecutionCounts();
+    return JSValue::encode(jsUndefined());
+}
+
 class DoNothingDebugger final : public Debugger {
     WTF_MAKE_NONCOPYABLE(DoNothingDebugger);
     WTF_MAKE_FAST_ALLOCATED;
@@ -3394,6 +3424,277 @@ JSC_DEFINE_HOST_FUNCTION(functionIsPrivateSymbol, (JSGlobalObject*, CallFrame* c
     return JSValue::encode(jsBoolean(asSymbol(callFrame->argument(0))->uid().isPrivate()));
 }
 
+// Usage: $vm.compilerPhaseStatistics()
+// Returns one object per compiler phase seen so far. Only populated while collectCompilerPhaseStatistics,
+// logPhaseTimes or reportTotalPhaseTimes is set.
+JSC_DEFINE_HOST_FUNCTION(functionCompilerPhaseStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSArray* result = constructEmptyArray(globalObject, nullptr);
+    RETURN_IF_EXCEPTION(scope, { });
+    for (auto& statistics : compilerPhaseStatistics()) {
+        JSObject* entry = constructEmptyObject(globalObject);
+        entry->putDirect(vm, Identifier::fromString(vm, "compiler"), jsString(vm, String(statistics.compilerName)));
+        entry->putDirect(vm, Identifier::fromString(vm, "phase"), jsString(vm, String(statistics.name)));
+        entry->putDirect(vm, Identifier::fromString(vm, "count"), jsNumber(statistics.count));
+        entry->putDirect(vm, Identifier::fromString(vm, "totalMilliseconds"), jsNumber(statistics.total.milliseconds()));
+        entry->putDirect(vm, Identifier::fromString(vm, "maxMilliseconds"), jsNumber(statistics.max.milliseconds()));
+
+        JSArray* histogram = constructEmptyArray(globalObject, nullptr);
+        RETURN_IF_EXCEPTION(scope, { });
+        for (unsigned bucketCount : statistics.histogram) {
+            histogram->push(globalObject, jsNumber(bucketCount));
+            RETURN_IF_EXCEPTION(scope, { });
+        }
+        entry->putDirect(vm, Identifier::fromString(vm, "microsecondLog2Histogram"), histogram);
+
+        result->push(globalObject, entry);
+        RETURN_IF_EXCEPTION(scope, { });
+    }
+    return JSValue::encode(result);
+}
+
+static Seconds pausedTimeInWindow(const Vector<Heap::RecordedPause>& pauses, MonotonicTime windowStart, MonotonicTime windowEnd)
+{
+    Seconds result;
+    for (auto& pause : pauses) {
+        MonotonicTime start = std::max(pause.start, windowStart);
+        MonotonicTime end = std::min(pause.end, windowEnd);
+        if (start < end)
+            result += end - start;
+    }
+    return result;
+}
+
+// The worst window either starts when a pause starts or ends when a pause ends, so only those need checking.
+static double minimumMutatorUtilization(const Heap::PauseRecording& recording, MonotonicTime end, Seconds window)
+{
+    if (window >= end - recording.start)
+        return 1 - pausedTimeInWindow(recording.pauses, recording.start, end).seconds() / (end - recording.start).seconds();
+
+    double result = 1;
+    auto consider = [&] (MonotonicTime windowStart) {
+        windowStart = std::min(std::max(windowStart, recording.start), end - window);
+        result = std::min(result, 1 - pausedTimeInWindow(recording.pauses, windowStart, windowStart + window).seconds() / window.seconds());
+    };
+    for (auto& pause : recording.pauses) {
+        consider(pause.start);
+        consider(pause.end - window);
+    }
+    return std::max(result, 0.0);
+}
+
+// Usage: $vm.gcPauseStatistics([windowMilliseconds, ...])
+// Summarizes the collector pauses recorded since the VM started or since $vm.resetGCPauseStatistics():
+// pause percentiles, the minimum mutator utilization over each window (1, 2, 5, 10, 20, 50 and 100ms by
+// default), the time spent in each collector phase and the cost of each marking constraint. Requires
+// --recordGCPauseTimes=true.
+JSC_DEFINE_HOST_FUNCTION(functionGCPauseStatistics, (JSGlobalObject* globalObject, CallFrame* callFrame))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    Vector<double> windows;
+    for (unsigned i = 0; i < callFrame->argumentCount(); ++i) {
+        double window = callFrame->uncheckedArgument(i).toNumber(globalObject);
+        RETURN_IF_EXCEPTION(scope, { });
+        if (!(window > 0))
+            return throwVMTypeError(globalObject, scope, "Windows must be positive numbers of milliseconds"_s);
+        windows.append(window);
+    }
+    if (windows.isEmpty())
+        windows = { 1, 2, 5, 10, 20, 50, 100 };
+
+    MonotonicTime now = MonotonicTime::now();
+    Heap::PauseRecording recording = vm.heap.pauseRecording();
+    Vector<Seconds> pauseTimes;
+    Seconds totalPauseTime;
+    for (auto& pause : recording.pauses) {
+        pauseTimes.append(pause.end - pause.start);
+        totalPauseTime += pause.end - pause.start;
+    }
+    std::sort(pauseTimes.begin(), pauseTimes.end());
+    auto percentile = [&] (double fraction) -> double {
+        if (pauseTimes.isEmpty())
+            return 0;
+        size_t rank = static_cast<size_t>(std::ceil(fraction * pauseTimes.size()));
+        return pauseTimes[std::min(std::max<size_t>(rank, 1), pauseTimes.size()) - 1].milliseconds();
+    };
+
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "recordedMilliseconds"), jsNumber((now - recording.start).milliseconds()));
+    result->putDirect(vm, Identifier::fromString(vm, "pauseCount"), jsNumber(pauseTimes.size()));
+    result->putDirect(vm, Identifier::fromString(vm, "totalPauseMilliseconds"), jsNumber(totalPauseTime.milliseconds()));
+    result->putDirect(vm, Identifier::fromString(vm, "p50PauseMilliseconds"), jsNumber(percentile(0.5)));
+    result->putDirect(vm, Identifier::fromString(vm, "p99PauseMilliseconds"), jsNumber(percentile(0.99)));
+    result->putDirect(vm, Identifier::fromString(vm, "maxPauseMilliseconds"), jsNumber(pauseTimes.isEmpty() ? 0 : pauseTimes.last().milliseconds()));
+
+    JSArray* utilizations = constructEmptyArray(globalObject, nullptr);
+    RETURN_IF_EXCEPTION(scope, { });
+    for (double window : windows) {
+        JSObject* entry = constructEmptyObject(globalObject);
+        entry->putDirect(vm, Identifier::fromString(vm, "windowMilliseconds"), jsNumber(window));
+        entry->putDirect(vm, Identifier::fromString(vm, "utilization"), jsNumber(minimumMutatorUtilization(recording, now, Seconds::fromMilliseconds(window))));
+        utilizations->push(globalObject, entry);
+        RETURN_IF_EXCEPTION(scope, { });
+    }
+    result->putDirect(vm, Identifier::fromString(vm, "minimumMutatorUtilization"), utilizations);
+
+    // NotRunning is mutator time, not collector work.
+    JSObject* phases = constructEmptyObject(globalObject);
+    for (unsigned i = static_cast<unsigned>(CollectorPhase::NotRunning) + 1; i < numberOfCollectorPhases; ++i)
+        phases->putDirect(vm, Identifier::fromString(vm, toCString(static_cast<CollectorPhase>(i)).data()), jsNumber(recording.phaseTimes[i].milliseconds()));
+    result->putDirect(vm, Identifier::fromString(vm, "phaseMilliseconds"), phases);
+
+    JSArray* constraints = constructEmptyArray(globalObject, nullptr);
+    RETURN_IF_EXCEPTION(scope, { });
+    vm.heap.forEachMarkingConstraint(scopedLambda<void(MarkingConstraint&)>([&] (MarkingConstraint& constraint) {
+        if (scope.exception())
+            return;
+        MarkingConstraint::RecordedStats stats = constraint.recordedStats();
+        JSObject* entry = constructEmptyObject(globalObject);
+        entry->putDirect(vm, Identifier::fromString(vm, "name"), jsString(vm, String(constraint.name())));
+        entry->putDirect(vm, Identifier::fromString(vm, "abbreviatedName"), jsString(vm, String(constraint.abbreviatedName())));
+        entry->putDirect(vm, Identifier::fromString(vm, "totalMilliseconds"), jsNumber(stats.executionTime.milliseconds()));
+        entry->putDirect(vm, Identifier::fromString(vm, "visitCount"), jsNumber(stats.visitCount));
+        entry->putDirect(vm, Identifier::fromString(vm, "executionCount"), jsNumber(stats.executionCount));
+        constraints->push(globalObject, entry);
+    }));
+    RETURN_IF_EXCEPTION(scope, { });
+    result->putDirect(vm, Identifier::fromString(vm, "constraints"), constraints);
+
+    return JSValue::encode(result);
+}
+
+// Usage: $vm.resetGCPauseStatistics()
+// Starts a new recording for $vm.gcPauseStatistics().
+JSC_DEFINE_HOST_FUNCTION(functionResetGCPauseStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    globalObject->vm().heap.resetPauseRecording();
+    return JSValue::encode(jsUndefined());
+}
+
+// Usage: $vm.structureStatistics()
+// Returns, for each subspace holding live Structures, how many there are, the bytes their cells and
+// property tables use, how many are dictionaries, and the largest number of transitions out of one
+// of them.
+JSC_DEFINE_HOST_FUNCTION(functionStructureStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    struct SubspaceStatistics {
+        size_t count { 0 };
+        size_t cellBytes { 0 };
+        size_t propertyTableCount { 0 };
+        size_t propertyTableBytes { 0 };
+        size_t dictionaryCount { 0 };
+        unsigned maximumTransitionFanOut { 0 };
+    };
+    HashMap<Subspace*, SubspaceStatistics> statistics;
+
+    {
+        HeapIterationScope iterationScope(vm.heap);
+        vm.heap.objectSpace().forEachLiveCell(iterationScope, [&] (HeapCell* cell, HeapCell::Kind kind) {
+            if (!isJSCellKind(kind))
+                return IterationStatus::Continue;
+            Structure* structure = jsDynamicCast<Structure*>(vm, static_cast<JSCell*>(cell));
+            if (!structure)
+                return IterationStatus::Continue;
+
+            SubspaceStatistics& stats = statistics.add(cell->subspace(), SubspaceStatistics()).iterator->value;
+            stats.count++;
+            stats.cellBytes += cell->cellSize();
+            if (PropertyTable* table = JSDollarVMHelper::propertyTableOrNull(structure)) {
+                stats.propertyTableCount++;
+                stats.propertyTableBytes += table->sizeInMemory();
+            }
+            if (structure->isDictionary())
+                stats.dictionaryCount++;
+            stats.maximumTransitionFanOut = std::max(stats.maximumTransitionFanOut, structure->transitionTableSize());
+            return IterationStatus::Continue;
+        });
+    }
+
+    JSObject* result = constructEmptyObject(globalObject);
+    for (auto& [subspace, stats] : statistics) {
+        JSObject* entry = constructEmptyObject(globalObject);
+        entry->putDirect(vm, Identifier::fromString(vm, "count"), jsNumber(stats.count));
+        entry->putDirect(vm, Identifier::fromString(vm, "cellBytes"), jsNumber(stats.cellBytes));
+        entry->putDirect(vm, Identifier::fromString(vm, "propertyTableCount"), jsNumber(stats.propertyTableCount));
+        entry->putDirect(vm, Identifier::fromString(vm, "propertyTableBytes"), jsNumber(stats.propertyTableBytes));
+        entry->putDirect(vm, Identifier::fromString(vm, "dictionaryCount"), jsNumber(stats.dictionaryCount));
+        entry->putDirect(vm, Identifier::fromString(vm, "maximumTransitionFanOut"), jsNumber(stats.maximumTransitionFanOut));
+        result->putDirect(vm, Identifier::fromString(vm, subspace->name()), entry);
+    }
+    RELEASE_AND_RETURN(scope, JSValue::encode(result));
+}
+
+// Usage: $vm.structureIDTableStatistics()
+// Returns the StructureID table's size and capacity, and the highest used index and the number of
+// entries held back from the free list as of the last compaction, or undefined on 32-bit platforms.
+JSC_DEFINE_HOST_FUNCTION(functionStructureIDTableStatistics, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+#if USE(JSVALUE64)
+    VM& vm = globalObject->vm();
+    StructureIDTable::Statistics statistics = vm.heap.structureIDTable().statistics();
+    JSObject* result = constructEmptyObject(globalObject);
+    result->putDirect(vm, Identifier::fromString(vm, "size"), jsNumber(statistics.size));
+    result->putDirect(vm, Identifier::fromString(vm, "capacity"), jsNumber(statistics.capacity));
+    result->putDirect(vm, Identifier::fromString(vm, "highestUsedIndex"), jsNumber(statistics.highestUsedIndex));
+    result->putDirect(vm, Identifier::fromString(vm, "reservedEntries"), jsNumber(statistics.reservedEntries));
+    return JSValue::encode(result);
+#else
+    UNUSED_PARAM(globalObject);
+    return JSValue::encode(jsUndefined());
+#endif
+}
+
+// Usage: $vm.structureTransitionSites()
+// Returns an object mapping "url:line:column" to the number of property transitions created there
+// since the last $vm.resetStructureTransitionSites(). Requires --recordStructureTransitionSites=true.
+JSC_DEFINE_HOST_FUNCTION(functionStructureTransitionSites, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    JSObject* result = constructEmptyObject(globalObject);
+    for (auto& entry : vm.structureTransitionSites)
+        result->putDirect(vm, Identifier::fromString(vm, entry.key), jsNumber(entry.value));
+    return JSValue::encode(result);
+}
+
+// Usage: $vm.resetStructureTransitionSites()
+JSC_DEFINE_HOST_FUNCTION(functionResetStructureTransitionSites, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    globalObject->vm().structureTransitionSites.clear();
+    return JSValue::encode(jsUndefined());
+}
+
+#if ENABLE(YARR_JIT)
+// Usage: $vm.yarrJITFailureCounts()
+// Returns an object mapping each reason a regular expression could not be JIT compiled to how many
+// compiles fell back to the interpreter for it.
+JSC_DEFINE_HOST_FUNCTION(functionYarrJITFailureCounts, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    JSObject* result = constructEmptyObject(globalObject);
+    for (unsigned i = 0; i < Yarr::numberOfJITFailureReasons; ++i) {
+        auto reason = static_cast<Yarr::JITFailureReason>(i);
+        result->putDirect(vm, Identifier::fromString(vm, Yarr::jitFailureReasonName(reason)), jsNumber(Yarr::jitFailureCount(reason)));
+    }
+    return JSValue::encode(result);
+}
+#endif
+
 constexpr unsigned jsDollarVMPropertyAttributes = PropertyAttribute::ReadOnly | PropertyAttribute::DontEnum | PropertyAttribute::DontDelete;
 
 void JSDollarVM::finishCreation(VM& vm)
@@ -3503,6 +3804,7 @@ void JSDollarVM::finishCreation(VM& vm)
     addFunction(vm, "dumpBasicBlockExecutionRanges", functionDumpBasicBlockExecutionRanges , 0);
     addFunction(vm, "hasBasicBlockExecuted", functionHasBasicBlockExecuted, 2);
     addFunction(vm, "basicBlockExecutionCount", functionBasicBlockExecutionCount, 2);
+    addFunction(vm, "resetBasicBlockExecutionCounts", functionResetBasicBlockExecutionCounts, 0);
 
     addFunction(vm, "enableDebuggerModeWhenIdle", functionEnableDebuggerModeWhenIdle, 0);
     addFunction(vm, "disableDebuggerModeWhenIdle", functionDisableDebuggerModeWhenIdle, 0);
@@ -3546,6 +3848,17 @@ void JSDollarVM::finishCreation(VM& vm)
 
     addFunction(vm, "isPrivateSymbol", functionIsPrivateSymbol, 1);
 
+    addFunction(vm, "compilerPhaseStatistics", functionCompilerPhaseStatistics, 0);
+    addFunction(vm, "gcPauseStatistics", functionGCPauseStatistics, 0);
+    addFunction(vm, "resetGCPauseStatistics", functionResetGCPauseStatistics, 0);
+    addFunction(vm, "structureStatistics", functionStructureStatistics, 0);
+    addFunction(vm, "structureIDTableStatistics", functionStructureIDTableStatistics, 0);
+    addFunction(vm, "structureTransitionSites", functionStructureTransitionSites, 0);
+    addFunction(vm, "resetStructureTransitionSites", functionResetStructureTransitionSites, 0);
+#if ENABLE(YARR_JIT)
+    addFunction(vm, "yarrJITFailureCounts", functionYarrJITFailureCounts, 0);
+#endif
+
     m_objectDoingSideEffectPutWithoutCorrectSlotStatusStructure.set(vm, this, ObjectDoingSideEffectPutWithoutCorrectSlotStatus::createStructure(vm, globalObject, jsNull()));
 }
 
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "RuntimeCounters.h"
+
+#include "CodeBlock.h"
+#include "HeapInlines.h"
+#include "StructureStubInfo.h"
+#include "VM.h"
+#include <wtf/text/StringBuilder.h>
+
+namespace JSC {
+
+String RuntimeCounters::snapshotAsJSON(VM& vm, unsigned maxCodeBlocks) const
+{
+    ASSERT(vm.currentThreadIsHoldingAPILock());
+
+    StringBuilder json;
+    json.append("{\"osrExits\":{");
+    for (unsigned kind = 0; kind < numberOfExitKinds; ++kind) {
+        if (kind)
+            json.append(',');
+        json.appendQuotedJSONString(String(exitKindToString(static_cast<ExitKind>(kind))));
+        json.append(':', m_osrExitCounts[kind]);
+    }
+
+    json.append("},\"jettisons\":{");
+    // Skip NotJettisoned, which is never counted.
+    for (unsigned reason = Profiler::NotJettisoned + 1; reason < Profiler::numberOfJettisonReasons; ++reason) {
+        if (reason > Profiler::NotJettisoned + 1)
+            json.append(',');
+        json.appendQuotedJSONString(String(toCString(static_cast<Profiler::JettisonReason>(reason)).data()));
+        json.append(':', m_jettisonCounts[reason]);
+    }
+
+    struct CodeBlockICCounts {
+        CodeBlock* codeBlock;
+        unsigned inlineCacheCount;
+        uint64_t slowPathCount;
+    };
+
+    std::array<unsigned, static_cast<unsigned>(JITType::FTLJIT) + 1> tierCounts { };
+    Vector<CodeBlockICCounts> icCounts;
+
+    // Waiting for in-flight compilations would make snapshots too expensive to take routinely, so
+    // CodeBlocks that are still being compiled are left out.
+    auto codeBlockSetLocker = holdLock(vm.heap.codeBlockSet().getLock());
+    vm.heap.forEachCodeBlockIgnoringJITPlans(codeBlockSetLocker, [&] (CodeBlock* codeBlock) {
+        // Only the CodeBlock installed on its executable says which tier the function is running in.
+        if (codeBlock->replacement() == codeBlock)
+            tierCounts[static_cast<unsigned>(codeBlock->jitType())]++;
+
+#if ENABLE(JIT)
+        CodeBlockICCounts counts { codeBlock, 0, 0 };
+        codeBlock->forEachStructureStubInfo([&] (StructureStubInfo& stubInfo) {
+            counts.inlineCacheCount++;
+            counts.slowPathCount += stubInfo.slowPathCount;
+        });
+        if (counts.slowPathCount)
+            icCounts.append(counts);
+#endif
+    });
+
+    json.append("},\"functionsByTier\":{");
+    for (unsigned tier = 0; tier < tierCounts.size(); ++tier) {
+        if (tier)
+            json.append(',');
+        json.appendQuotedJSONString(String(JITCode::typeName(static_cast<JITType>(tier))));
+        json.append(':', tierCounts[tier]);
+    }
+
+    std::sort(icCounts.begin(), icCounts.end(), [] (const CodeBlockICCounts& a, const CodeBlockICCounts& b) {
+        return a.slowPathCount > b.slowPathCount;
+    });
+    if (icCounts.size() > maxCodeBlocks)
+        icCounts.shrink(maxCodeBlocks);
+
+    json.append("},\"inlineCacheSlowPaths\":[");
+    for (unsigned i = 0; i < icCounts.size(); ++i) {
+        const CodeBlockICCounts& counts = icCounts[i];
+        if (i)
+            json.append(',');
+        json.append("{\"name\":");
+        json.appendQuotedJSONString(String(counts.codeBlock->inferredName().data()));
+        json.append(",\"hash\":\"", toCString(counts.codeBlock->hash()).data(), "\",\"tier\":\"", JITCode::typeName(counts.codeBlock->jitType()), '"');
+        json.append(",\"inlineCacheCount\":", counts.inlineCacheCount, ",\"slowPathCount\":", counts.slowPathCount);
+        json.append(",\"osrExitCount\":", counts.codeBlock->osrExitCounter(), '}');
+    }
+    json.append("]}");
+
+    return json.toString();
+}
+
+} // namespace JSC
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "ExitKind.h"
+#include "ProfilerJettisonReason.h"
+#include <array>
+#include <wtf/Forward.h>
+#include <wtf/Noncopyable.h>
+
+namespace JSC {
+
+class VM;
+
+// Always-on counters for the events that tell you a deploy is deoptimizing: OSR exits by kind and
+// jettisons by reason. Tier occupancy and per-CodeBlock IC slow path counts are not tracked here;
+// they are read off the live CodeBlocks when a snapshot is taken. Counts are cumulative for the
+// lifetime of the VM, so rates come from diffing successive snapshots.
+class RuntimeCounters {
+    WTF_MAKE_NONCOPYABLE(RuntimeCounters);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    RuntimeCounters() = default;
+
+    // Bumped by OSR exit ramps, which run on the mutator thread.
+    uint64_t* addressOfOSRExitCount(ExitKind kind) { return &m_osrExitCounts[kind]; }
+
+    // Jettisons happen on the mutator thread or while the GC has the world stopped, so this does not
+    // need to be atomic.
+    void didJettison(Profiler::JettisonReason reason) { m_jettisonCounts[reason]++; }
+
+    // Includes at most maxCodeBlocks CodeBlocks, picking those whose ICs took the slow path most.
+    JS_EXPORT_PRIVATE String snapshotAsJSON(VM&, unsigned maxCodeBlocks) const;
+
+private:
+    std::array<uint64_t, numberOfExitKinds> m_osrExitCounts { };
+    std::array<uint64_t, Profiler::numberOfJettisonReasons> m_jettisonCounts { };
+};
+
+} // namespace JSC
@@ -657,6 +657,7 @@ private:
 
     void emitEntryTierUpCheck();
     void emitLoopTierUpCheck(uint32_t loopIndex, const Stack& enclosingStack);
+    void emitTrapCheck();
 
     void emitWriteBarrierForJSWrapper();
     ExpressionType emitCheckAndPreparePointer(ExpressionType pointer, uint32_t offset, uint32_t sizeOfOp);
@@ -914,6 +915,7 @@ AirIRGenerator::AirIRGenerator(const ModuleInformation& info, B3::Procedure& pro
     }
 
     emitEntryTierUpCheck();
+    emitTrapCheck();
 }
 
 B3::Type AirIRGenerator::toB3ResultType(BlockSignature returnType)
@@ -2710,6 +2712,38 @@ void AirIRGenerator::emitLoopTierUpCheck(uint32_t loopIndex, const Stack& enclos
     emitPatchpoint(m_currentBlock, patch, ResultList { }, WTFMove(patchArgs));
 }
 
+void AirIRGenerator::emitTrapCheck()
+{
+    if (!Options::usePollingTraps())
+        return;
+
+    BasicBlock* handleTraps = m_code.addBlock();
+    BasicBlock* continuation = m_code.addBlock();
+
+    auto pointerToNeedTrapHandling = g64();
+    auto needTrapHandling = g32();
+    RELEASE_ASSERT(Arg::isValidAddrForm(Instance::offsetOfPointerToNeedTrapHandling(), B3::Width64));
+    append(Move, Arg::addr(instanceValue(), Instance::offsetOfPointerToNeedTrapHandling()), pointerToNeedTrapHandling);
+    append(Load8, Arg::addr(pointerToNeedTrapHandling), needTrapHandling);
+    append(BranchTest32, Arg::resCond(MacroAssembler::NonZero), needTrapHandling, needTrapHandling);
+    m_currentBlock->setSuccessors(B3::Air::FrequentedBlock(handleTraps, B3::FrequencyClass::Rare), continuation);
+
+    m_currentBlock = handleTraps;
+    auto shouldTerminate = g32();
+    emitCCall(&operationWasmHandleTraps, shouldTerminate, TypedTmp { Tmp(GPRInfo::callFrameRegister), Type::I64 }, instanceValue());
+    emitCheck([&] {
+        return Inst(BranchTest32, nullptr, Arg::resCond(MacroAssembler::NonZero), shouldTerminate, shouldTerminate);
+    }, [=] (CCallHelpers& jit, const B3::StackmapGenerationParams&) {
+        this->emitThrowException(jit, ExceptionType::Termination);
+    });
+    // Handling traps can run JS, for example a debugger hook, which may grow this instance's memory.
+    restoreWebAssemblyGlobalState(RestoreCachedStackLimit::No, m_info.memory, instanceValue(), m_currentBlock);
+    append(Jump);
+    m_currentBlock->setSuccessors(continuation);
+
+    m_currentBlock = continuation;
+}
+
 AirIRGenerator::ControlData AirIRGenerator::addTopLevel(BlockSignature signature)
 {
     return ControlData(B3::Origin(), signature, tmpsForSignature(signature), BlockType::TopLevel, m_code.addBlock());
@@ -2732,6 +2766,7 @@ auto AirIRGenerator::addLoop(BlockSignature signature, Stack& enclosingStack, Co
 
     m_currentBlock = body;
     emitLoopTierUpCheck(loopIndex, enclosingStack);
+    emitTrapCheck();
 
     return { };
 }
@@ -3080,11 +3115,9 @@ auto AirIRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signa
     append(Move, instanceValue(), currentInstance);
 
     ExpressionType callableFunctionBuffer = g64();
-    ExpressionType instancesBuffer = g64();
     ExpressionType callableFunctionBufferLength = g64();
     {
         RELEASE_ASSERT(Arg::isValidAddrForm(FuncRefTable::offsetOfFunctions(), B3::Width64));
-        RELEASE_ASSERT(Arg::isValidAddrForm(FuncRefTable::offsetOfInstances(), B3::Width64));
         RELEASE_ASSERT(Arg::isValidAddrForm(FuncRefTable::offsetOfLength(), B3::Width64));
 
         if (UNLIKELY(!Arg::isValidAddrForm(Instance::offsetOfTablePtr(m_numImportFunctions, tableIndex), B3::Width64))) {
@@ -3094,7 +3127,6 @@ auto AirIRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signa
         } else
             append(Move, Arg::addr(instanceValue(), Instance::offsetOfTablePtr(m_numImportFunctions, tableIndex)), callableFunctionBufferLength);
         append(Move, Arg::addr(callableFunctionBufferLength, FuncRefTable::offsetOfFunctions()), callableFunctionBuffer);
-        append(Move, Arg::addr(callableFunctionBufferLength, FuncRefTable::offsetOfInstances()), instancesBuffer);
         append(Move32, Arg::addr(callableFunctionBufferLength, Table::offsetOfLength()), callableFunctionBufferLength);
     }
 
@@ -3107,15 +3139,17 @@ auto AirIRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signa
         this->emitThrowException(jit, ExceptionType::OutOfBoundsCallIndirect);
     });
 
+    // The signature index, instance and entrypoint of the callee all live in one FuncRefTable::Function.
+    ExpressionType callableFunction = g64();
     ExpressionType calleeCode = g64();
     {
         ExpressionType calleeSignatureIndex = g64();
         // Compute the offset in the table index space we are looking for.
-        append(Move, Arg::imm(sizeof(WasmToWasmImportableFunction)), calleeSignatureIndex);
-        append(Mul64, calleeIndex, calleeSignatureIndex);
-        append(Add64, callableFunctionBuffer, calleeSignatureIndex);
-        
-        append(Move, Arg::addr(calleeSignatureIndex, WasmToWasmImportableFunction::offsetOfEntrypointLoadLocation()), calleeCode); // Pointer to callee code.
+        append(Move, Arg::imm(sizeof(FuncRefTable::Function)), callableFunction);
+        append(Mul64, calleeIndex, callableFunction);
+        append(Add64, callableFunctionBuffer, callableFunction);
+
+        append(Move, Arg::addr(callableFunction, FuncRefTable::Function::offsetOfFunction() + WasmToWasmImportableFunction::offsetOfEntrypointLoadLocation()), calleeCode); // Pointer to callee code.
 
         // Check that the WasmToWasmImportableFunction is initialized. We trap if it isn't. An "invalid" SignatureIndex indicates it's not initialized.
         // FIXME: when we have trap handlers, we can just let the call fail because Signature::invalidIndex is 0. https://bugs.webkit.org/show_bug.cgi?id=177210
@@ -3125,7 +3159,7 @@ auto AirIRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signa
         // We should move just to use a single branch and then figure out what
         // error to use in the exception handler.
 
-        append(Move, Arg::addr(calleeSignatureIndex, WasmToWasmImportableFunction::offsetOfSignatureIndex()), calleeSignatureIndex);
+        append(Move, Arg::addr(callableFunction, FuncRefTable::Function::offsetOfFunction() + WasmToWasmImportableFunction::offsetOfSignatureIndex()), calleeSignatureIndex);
 
         emitCheck([&] {
             static_assert(Signature::invalidIndex == 0, "");
@@ -3146,7 +3180,7 @@ auto AirIRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signa
     // Do a context switch if needed.
     {
         auto newContextInstance = g64();
-        append(Move, Arg::index(instancesBuffer, calleeIndex, 8, 0), newContextInstance);
+        append(Move, Arg::addr(callableFunction, FuncRefTable::Function::offsetOfInstance()), newContextInstance);
 
         BasicBlock* doContextSwitch = m_code.addBlock();
         BasicBlock* continuation = m_code.addBlock();
@@ -296,12 +296,16 @@ private:
 
     void emitEntryTierUpCheck();
     void emitLoopTierUpCheck(uint32_t loopIndex, const Stack& enclosingStack);
+    void emitTrapCheck();
 
     void emitWriteBarrierForJSWrapper();
     ExpressionType emitCheckAndPreparePointer(ExpressionType pointer, uint32_t offset, uint32_t sizeOfOp);
     B3::Kind memoryKind(B3::Opcode memoryOp);
     ExpressionType emitLoadOp(LoadOpType, ExpressionType pointer, uint32_t offset);
     void emitStoreOp(StoreOpType, ExpressionType pointer, ExpressionType value, uint32_t offset);
+    bool shouldInlineBulkMemoryOperation(ExpressionType count);
+    void emitInlineMemoryFill(ExpressionType dstAddress, ExpressionType targetValue, uint32_t count);
+    void emitInlineMemoryCopy(ExpressionType dstAddress, ExpressionType srcAddress, uint32_t count);
 
     ExpressionType sanitizeAtomicResult(ExtAtomicOpType, Type, ExpressionType result);
     ExpressionType emitAtomicLoadOp(ExtAtomicOpType, Type, ExpressionType pointer, uint32_t offset);
@@ -553,6 +557,8 @@ B3IRGenerator::B3IRGenerator(const ModuleInformation& info, Procedure& procedure
 
     if (m_compilationMode == CompilationMode::OMGForOSREntryMode)
         m_currentBlock = m_proc.addBlock();
+    else
+        emitTrapCheck();
 }
 
 void B3IRGenerator::restoreWebAssemblyGlobalState(RestoreCachedStackLimit restoreCachedStackLimit, const MemoryInformation& memory, Value* instance, Procedure& proc, BasicBlock* block)
@@ -887,8 +893,114 @@ auto B3IRGenerator::addCurrentMemory(ExpressionType& result) -> PartialResult
     return { };
 }
 
+// Splits a small bulk memory operation into the widest loads and stores that fit, in ascending order.
+template<typename Functor>
+static void forEachBulkMemoryChunk(uint32_t count, const Functor& functor)
+{
+    uint32_t offset = 0;
+    for (uint32_t chunkSize = 8; chunkSize; chunkSize >>= 1) {
+        for (; count - offset >= chunkSize; offset += chunkSize)
+            functor(offset, chunkSize);
+    }
+}
+
+bool B3IRGenerator::shouldInlineBulkMemoryOperation(ExpressionType count)
+{
+    if (!count->hasInt32())
+        return false;
+    // A zero-length operation still has to trap when an address is past the end of memory, which the
+    // call handles.
+    uint32_t constantCount = count->asInt32();
+    return constantCount && constantCount <= Options::maximumWebAssemblyInlineBulkMemorySize();
+}
+
+void B3IRGenerator::emitInlineMemoryFill(ExpressionType dstAddress, ExpressionType targetValue, uint32_t count)
+{
+    Value* dstPointer = emitCheckAndPreparePointer(dstAddress, 0, count);
+    if (m_mode == MemoryMode::Signaling) {
+        // Nothing may be written when the fill traps, so touch its last byte before the first store.
+        m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Load8Z), origin(), dstPointer, safeCast<int32_t>(count - 1));
+    }
+
+    Value* byte = m_currentBlock->appendNew<Value>(m_proc, BitAnd, origin(), targetValue, constant(Int32, 0xff));
+    Value* pattern = m_currentBlock->appendNew<Value>(m_proc, Mul, origin(),
+        m_currentBlock->appendNew<Value>(m_proc, ZExt32, origin(), byte), constant(Int64, 0x0101010101010101ull));
+    Value* narrowPattern = m_currentBlock->appendNew<Value>(m_proc, Trunc, origin(), pattern);
+
+    forEachBulkMemoryChunk(count, [&] (uint32_t offset, uint32_t chunkSize) {
+        int32_t storeOffset = safeCast<int32_t>(offset);
+        switch (chunkSize) {
+        case 8:
+            m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Store), origin(), pattern, dstPointer, storeOffset);
+            break;
+        case 4:
+            m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Store), origin(), narrowPattern, dstPointer, storeOffset);
+            break;
+        case 2:
+            m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Store16), origin(), narrowPattern, dstPointer, storeOffset);
+            break;
+        case 1:
+            m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Store8), origin(), narrowPattern, dstPointer, storeOffset);
+            break;
+        }
+    });
+}
+
+void B3IRGenerator::emitInlineMemoryCopy(ExpressionType dstAddress, ExpressionType srcAddress, uint32_t count)
+{
+    Value* srcPointer = emitCheckAndPreparePointer(srcAddress, 0, count);
+    Value* dstPointer = emitCheckAndPreparePointer(dstAddress, 0, count);
+
+    // Every chunk is loaded before anything is stored, which gives memmove semantics for overlapping
+    // ranges and means a trapping load leaves memory untouched.
+    Vector<Value*, 8> chunks;
+    forEachBulkMemoryChunk(count, [&] (uint32_t offset, uint32_t chunkSize) {
+        int32_t loadOffset = safeCast<int32_t>(offset);
+        switch (chunkSize) {
+        case 8:
+            chunks.append(m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Load), Int64, origin(), srcPointer, loadOffset));
+            break;
+        case 4:
+            chunks.append(m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Load), Int32, origin(), srcPointer, loadOffset));
+            break;
+        case 2:
+            chunks.append(m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Load16Z), origin(), srcPointer, loadOffset));
+            break;
+        case 1:
+            chunks.append(m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Load8Z), origin(), srcPointer, loadOffset));
+            break;
+        }
+    });
+
+    if (m_mode == MemoryMode::Signaling)
+        m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Load8Z), origin(), dstPointer, safeCast<int32_t>(count - 1));
+
+    unsigned chunkIndex = 0;
+    forEachBulkMemoryChunk(count, [&] (uint32_t offset, uint32_t chunkSize) {
+        int32_t storeOffset = safeCast<int32_t>(offset);
+        Value* chunk = chunks[chunkIndex++];
+        switch (chunkSize) {
+        case 8:
+        case 4:
+            m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Store), origin(), chunk, dstPointer, storeOffset);
+            break;
+        case 2:
+            m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Store16), origin(), chunk, dstPointer, storeOffset);
+            break;
+        case 1:
+            m_currentBlock->appendNew<MemoryValue>(m_proc, memoryKind(Store8), origin(), chunk, dstPointer, storeOffset);
+            break;
+        }
+    });
+}
+
 auto B3IRGenerator::addMemoryFill(ExpressionType dstAddress, ExpressionType targetValue, ExpressionType count) -> PartialResult
 {
+    if (shouldInlineBulkMemoryOperation(count)) {
+        emitInlineMemoryFill(dstAddress, targetValue, count->asInt32());
+        return { };
+    }
+
     auto result = m_currentBlock->appendNew<CCallValue>(
         m_proc, toB3Type(I32), origin(),
         m_currentBlock->appendNew<ConstPtrValue>(m_proc, origin(), tagCFunction<OperationPtrTag>(operationWasmMemoryFill)),
@@ -930,6 +1042,11 @@ auto B3IRGenerator::addMemoryInit(unsigned dataSegmentIndex, ExpressionType dstA
 
 auto B3IRGenerator::addMemoryCopy(ExpressionType dstAddress, ExpressionType srcAddress, ExpressionType count) -> PartialResult
 {
+    if (shouldInlineBulkMemoryOperation(count)) {
+        emitInlineMemoryCopy(dstAddress, srcAddress, count->asInt32());
+        return { };
+    }
+
     auto result = m_currentBlock->appendNew<CCallValue>(
         m_proc, toB3Type(I32), origin(),
         m_currentBlock->appendNew<ConstPtrValue>(m_proc, origin(), tagCFunction<OperationPtrTag>(operationWasmMemoryCopy)),
@@ -1879,6 +1996,36 @@ void B3IRGenerator::emitLoopTierUpCheck(uint32_t loopIndex, const Stack& enclosi
     });
 }
 
+void B3IRGenerator::emitTrapCheck()
+{
+    if (!Options::usePollingTraps())
+        return;
+
+    BasicBlock* handleTraps = m_proc.addBlock();
+    BasicBlock* continuation = m_proc.addBlock();
+
+    Value* pointerToNeedTrapHandling = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, pointerType(), origin(), instanceValue(), safeCast<int32_t>(Instance::offsetOfPointerToNeedTrapHandling()));
+    Value* needTrapHandling = m_currentBlock->appendNew<MemoryValue>(m_proc, Load8Z, origin(), pointerToNeedTrapHandling);
+    m_currentBlock->appendNewControlValue(m_proc, B3::Branch, origin(), needTrapHandling,
+        FrequentedBlock(handleTraps, FrequencyClass::Rare), FrequentedBlock(continuation));
+
+    m_currentBlock = handleTraps;
+    Value* shouldTerminate = m_currentBlock->appendNew<CCallValue>(m_proc, B3::Int32, origin(),
+        m_currentBlock->appendNew<ConstPtrValue>(m_proc, origin(), tagCFunction<OperationPtrTag>(operationWasmHandleTraps)),
+        framePointer(), instanceValue());
+    {
+        CheckValue* check = m_currentBlock->appendNew<CheckValue>(m_proc, Check, origin(), shouldTerminate);
+        check->setGenerator([=] (CCallHelpers& jit, const B3::StackmapGenerationParams&) {
+            this->emitExceptionCheck(jit, ExceptionType::Termination);
+        });
+    }
+    // Handling traps can run JS, for example a debugger hook, which may grow this instance's memory.
+    restoreWebAssemblyGlobalState(RestoreCachedStackLimit::No, m_info.memory, instanceValue(), m_proc, m_currentBlock);
+    m_currentBlock->appendNewControlValue(m_proc, Jump, origin(), continuation);
+
+    m_currentBlock = continuation;
+}
+
 auto B3IRGenerator::addLoop(BlockSignature signature, Stack& enclosingStack, ControlType& block, Stack& newStack, uint32_t loopIndex) -> PartialResult
 {
     BasicBlock* body = m_proc.addBlock();
@@ -1967,6 +2114,7 @@ auto B3IRGenerator::addLoop(BlockSignature signature, Stack& enclosingStack, Con
 
     m_currentBlock = body;
     emitLoopTierUpCheck(loopIndex, enclosingStack);
+    emitTrapCheck();
     return { };
 }
 
@@ -2289,15 +2437,12 @@ auto B3IRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signat
     m_maxNumJSCallArguments = std::max(m_maxNumJSCallArguments, static_cast<uint32_t>(args.size()));
 
     ExpressionType callableFunctionBuffer;
-    ExpressionType instancesBuffer;
     ExpressionType callableFunctionBufferLength;
     {
         ExpressionType table = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, pointerType(), origin(),
             instanceValue(), safeCast<int32_t>(Instance::offsetOfTablePtr(m_numImportFunctions, tableIndex)));
         callableFunctionBuffer = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, pointerType(), origin(),
             table, safeCast<int32_t>(FuncRefTable::offsetOfFunctions()));
-        instancesBuffer = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, pointerType(), origin(),
-            table, safeCast<int32_t>(FuncRefTable::offsetOfInstances()));
         callableFunctionBufferLength = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, Int32, origin(),
             table, safeCast<int32_t>(Table::offsetOfLength()));
     }
@@ -2314,46 +2459,39 @@ auto B3IRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signat
 
     calleeIndex = m_currentBlock->appendNew<Value>(m_proc, ZExt32, origin(), calleeIndex);
 
+    // The signature index, instance and entrypoint of the callee all live in one FuncRefTable::Function.
     ExpressionType callableFunction;
     {
         // Compute the offset in the table index space we are looking for.
         ExpressionType offset = m_currentBlock->appendNew<Value>(m_proc, Mul, origin(),
-            calleeIndex, constant(pointerType(), sizeof(WasmToWasmImportableFunction)));
+            calleeIndex, constant(pointerType(), sizeof(FuncRefTable::Function)));
         callableFunction = m_currentBlock->appendNew<Value>(m_proc, Add, origin(), callableFunctionBuffer, offset);
 
-        // Check that the WasmToWasmImportableFunction is initialized. We trap if it isn't. An "invalid" SignatureIndex indicates it's not initialized.
+        // Check that the WasmToWasmImportableFunction is initialized and that its signature matches the one we expect.
+        // An uninitialized entry has Signature::invalidIndex, which never matches, so a single check covers both and
+        // the slow path figures out which error to throw.
         // FIXME: when we have trap handlers, we can just let the call fail because Signature::invalidIndex is 0. https://bugs.webkit.org/show_bug.cgi?id=177210
         static_assert(sizeof(WasmToWasmImportableFunction::signatureIndex) == sizeof(uint64_t), "Load codegen assumes i64");
-        ExpressionType calleeSignatureIndex = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, Int64, origin(), callableFunction, safeCast<int32_t>(WasmToWasmImportableFunction::offsetOfSignatureIndex()));
-        {
-            CheckValue* check = m_currentBlock->appendNew<CheckValue>(m_proc, Check, origin(),
-                m_currentBlock->appendNew<Value>(m_proc, Equal, origin(),
-                    calleeSignatureIndex,
-                    m_currentBlock->appendNew<Const64Value>(m_proc, origin(), Signature::invalidIndex)));
-
-            check->setGenerator([=] (CCallHelpers& jit, const B3::StackmapGenerationParams&) {
-                this->emitExceptionCheck(jit, ExceptionType::NullTableEntry);
-            });
-        }
-
-        // Check the signature matches the value we expect.
-        {
-            ExpressionType expectedSignatureIndex = m_currentBlock->appendNew<Const64Value>(m_proc, origin(), SignatureInformation::get(signature));
-            CheckValue* check = m_currentBlock->appendNew<CheckValue>(m_proc, Check, origin(),
-                m_currentBlock->appendNew<Value>(m_proc, NotEqual, origin(), calleeSignatureIndex, expectedSignatureIndex));
-
-            check->setGenerator([=] (CCallHelpers& jit, const B3::StackmapGenerationParams&) {
-                this->emitExceptionCheck(jit, ExceptionType::BadSignature);
-            });
-        }
+        static_assert(Signature::invalidIndex == 0, "The slow path tests for a zero signature index");
+        ExpressionType calleeSignatureIndex = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, Int64, origin(), callableFunction,
+            safeCast<int32_t>(FuncRefTable::Function::offsetOfFunction() + WasmToWasmImportableFunction::offsetOfSignatureIndex()));
+        ExpressionType expectedSignatureIndex = m_currentBlock->appendNew<Const64Value>(m_proc, origin(), SignatureInformation::get(signature));
+        CheckValue* check = m_currentBlock->appendNew<CheckValue>(m_proc, Check, origin(),
+            m_currentBlock->appendNew<Value>(m_proc, NotEqual, origin(), calleeSignatureIndex, expectedSignatureIndex));
+        check->appendSomeRegister(calleeSignatureIndex);
+
+        check->setGenerator([=] (CCallHelpers& jit, const B3::StackmapGenerationParams& params) {
+            auto isNullTableEntry = jit.branchTest64(CCallHelpers::Zero, params[0].gpr());
+            this->emitExceptionCheck(jit, ExceptionType::BadSignature);
+            isNullTableEntry.link(&jit);
+            this->emitExceptionCheck(jit, ExceptionType::NullTableEntry);
+        });
     }
 
     // Do a context switch if needed.
     {
-        Value* offset = m_currentBlock->appendNew<Value>(m_proc, Mul, origin(),
-            calleeIndex, constant(pointerType(), sizeof(Instance*)));
         Value* newContextInstance = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, pointerType(), origin(),
-            m_currentBlock->appendNew<Value>(m_proc, Add, origin(), instancesBuffer, offset));
+            callableFunction, safeCast<int32_t>(FuncRefTable::Function::offsetOfInstance()));
 
         BasicBlock* continuation = m_proc.addBlock();
         BasicBlock* doContextSwitch = m_proc.addBlock();
@@ -2401,7 +2539,7 @@ auto B3IRGenerator::addCallIndirect(unsigned tableIndex, const Signature& signat
 
     ExpressionType calleeCode = m_currentBlock->appendNew<MemoryValue>(m_proc, Load, pointerType(), origin(),
         m_currentBlock->appendNew<MemoryValue>(m_proc, Load, pointerType(), origin(), callableFunction,
-            safeCast<int32_t>(WasmToWasmImportableFunction::offsetOfEntrypointLoadLocation())));
+            safeCast<int32_t>(FuncRefTable::Function::offsetOfFunction() + WasmToWasmImportableFunction::offsetOfEntrypointLoadLocation())));
 
     B3::Type returnType = toB3ResultType(&signature);
     ExpressionType callResult = createCallPatchpoint(m_currentBlock, origin(), signature, args,
@@ -26,10 +26,12 @@
 #include "config.h"
 #include "WasmEntryPlan.h"
 
+#include "USDTProbes.h"
 #include "WasmBinding.h"
 #include <wtf/DataLog.h>
 #include <wtf/Locker.h>
 #include <wtf/MonotonicTime.h>
+#include <wtf/Scope.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/SystemTracing.h>
 
@@ -192,6 +194,10 @@ void EntryPlan::compileFunctions(CompilationEffort effort)
     Optional<TraceScope> traceScope;
     if (Options::useTracePoints())
         traceScope.emplace(WebAssemblyCompileStart, WebAssemblyCompileEnd);
+    JSC_USDT_PROBE1(wasm__compile__start, this);
+    auto probeCompileEnd = makeScopeExit([&] {
+        JSC_USDT_PROBE1(wasm__compile__end, this);
+    });
     ThreadCountHolder holder(*this);
 
     size_t bytesCompiled = 0;
@@ -42,7 +42,8 @@ namespace Wasm {
     macro(DivisionByZero, "Division by zero") \
     macro(IntegerOverflow, "Integer overflow") \
     macro(StackOverflow, "Stack overflow") \
-    macro(FuncrefNotWasm, "Funcref must be an exported wasm function")
+    macro(FuncrefNotWasm, "Funcref must be an exported wasm function") \
+    macro(Termination, "Execution terminated")
 
 enum class ExceptionType : uint32_t {
 #define MAKE_ENUM(enumName, error) enumName,
@@ -47,6 +47,11 @@ struct IndexOrName {
     bool isName() const { return !(isEmpty() || isName()); }
     NameSection* nameSection() const { return m_nameSection.get(); }
 
+    bool operator==(const IndexOrName& other) const
+    {
+        return bitwise_cast<Index>(m_indexName) == bitwise_cast<Index>(other.m_indexName) && m_nameSection == other.m_nameSection;
+    }
+
     friend String makeString(const IndexOrName&);
 
 private:
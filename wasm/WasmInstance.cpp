@@ -44,49 +44,29 @@ size_t globalMemoryByteSize(Module& module)
 }
 }
 
-Instance::Instance(Context* context, Ref<Module>&& module, EntryFrame** pointerToTopEntryFrame, void** pointerToActualStackLimit, StoreTopCallFrameCallback&& storeTopCallFrame)
+Instance::Instance(Context* context, Ref<Module>&& module, EntryFrame** pointerToTopEntryFrame, void** pointerToActualStackLimit, void* pointerToNeedTrapHandling, StoreTopCallFrameCallback&& storeTopCallFrame)
     : m_context(context)
     , m_module(WTFMove(module))
     , m_globals(MallocPtr<Global::Value, VMMalloc>::malloc(globalMemoryByteSize(m_module.get())))
-    , m_globalsToMark(m_module.get().moduleInformation().globals.size())
-    , m_globalsToBinding(m_module.get().moduleInformation().globals.size())
+    , m_globalsToMark(m_module->instanceTemplate().globalsToMark)
+    , m_globalsToBinding(m_module->instanceTemplate().globalsToBinding)
     , m_pointerToTopEntryFrame(pointerToTopEntryFrame)
     , m_pointerToActualStackLimit(pointerToActualStackLimit)
+    , m_pointerToNeedTrapHandling(pointerToNeedTrapHandling)
     , m_storeTopCallFrame(WTFMove(storeTopCallFrame))
     , m_numImportFunctions(m_module->moduleInformation().importFunctionCount())
-    , m_passiveElements(m_module->moduleInformation().elementCount())
-    , m_passiveDataSegments(m_module->moduleInformation().dataSegmentsCount())
+    , m_passiveElements(m_module->instanceTemplate().passiveElements)
+    , m_passiveDataSegments(m_module->instanceTemplate().passiveDataSegments)
 {
     for (unsigned i = 0; i < m_numImportFunctions; ++i)
         new (importFunctionInfo(i)) ImportFunctionInfo();
     memset(static_cast<void*>(m_globals.get()), 0, globalMemoryByteSize(m_module.get()));
-    for (unsigned i = 0; i < m_module->moduleInformation().globals.size(); ++i) {
-        const Wasm::GlobalInformation& global = m_module.get().moduleInformation().globals[i];
-        if (global.bindingMode == Wasm::GlobalInformation::BindingMode::Portable) {
-            // This is kept alive by JSWebAssemblyInstance -> JSWebAssemblyGlobal -> binding.
-            m_globalsToBinding.set(i);
-        } else if (isRefType(global.type)) {
-            // This is kept alive by JSWebAssemblyInstance -> binding.
-            m_globalsToMark.set(i);
-        }
-    }
     memset(bitwise_cast<char*>(this) + offsetOfTablePtr(m_numImportFunctions, 0), 0, m_module->moduleInformation().tableCount() * sizeof(Table*));
-    for (unsigned elementIndex = 0; elementIndex < m_module->moduleInformation().elementCount(); ++elementIndex) {
-        const auto& element = m_module->moduleInformation().elements[elementIndex];
-        if (element.isPassive())
-            m_passiveElements.quickSet(elementIndex);
-    }
-
-    for (unsigned dataSegmentIndex = 0; dataSegmentIndex < m_module->moduleInformation().dataSegmentsCount(); ++dataSegmentIndex) {
-        const auto& dataSegment = m_module->moduleInformation().data[dataSegmentIndex];
-        if (dataSegment->isPassive())
-            m_passiveDataSegments.quickSet(dataSegmentIndex);
-    }
 }
 
-Ref<Instance> Instance::create(Context* context, Ref<Module>&& module, EntryFrame** pointerToTopEntryFrame, void** pointerToActualStackLimit, StoreTopCallFrameCallback&& storeTopCallFrame)
+Ref<Instance> Instance::create(Context* context, Ref<Module>&& module, EntryFrame** pointerToTopEntryFrame, void** pointerToActualStackLimit, void* pointerToNeedTrapHandling, StoreTopCallFrameCallback&& storeTopCallFrame)
 {
-    return adoptRef(*new (NotNull, fastMalloc(allocationSize(module->moduleInformation().importFunctionCount(), module->moduleInformation().tableCount()))) Instance(context, WTFMove(module), pointerToTopEntryFrame, pointerToActualStackLimit, WTFMove(storeTopCallFrame)));
+    return adoptRef(*new (NotNull, fastMalloc(allocationSize(module->moduleInformation().importFunctionCount(), module->moduleInformation().tableCount()))) Instance(context, WTFMove(module), pointerToTopEntryFrame, pointerToActualStackLimit, pointerToNeedTrapHandling, WTFMove(storeTopCallFrame)));
 }
 
 Instance::~Instance() { }
@@ -34,6 +34,8 @@
 #include <wtf/DataLog.h>
 #include <wtf/Gigacage.h>
 #include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/PageBlock.h>
 #include <wtf/Platform.h>
 #include <wtf/PrintStream.h>
 #include <wtf/RAMSize.h>
@@ -106,6 +108,12 @@ public:
     {
         MemoryResult result = [&] {
             auto holder = holdLock(m_lock);
+            if (!m_recycledFastMemories.isEmpty()) {
+                void* result = m_recycledFastMemories.takeLast();
+                m_fastMemories.append(result);
+                return MemoryResult(result, MemoryResult::Success);
+            }
+
             if (m_fastMemories.size() >= m_maxFastMemoryCount)
                 return MemoryResult(nullptr, MemoryResult::SyncTryToReclaimMemory);
             
@@ -125,12 +133,17 @@ public:
         return result;
     }
     
-    void freeFastMemory(void* basePtr)
+    // Only the first dirtyBytes of the reservation can have been written, since everything above the
+    // memory's size was PROT_NONE.
+    void freeFastMemory(void* basePtr, size_t dirtyBytes)
     {
         {
             auto holder = holdLock(m_lock);
-            Gigacage::freeVirtualPages(Gigacage::Primitive, basePtr, Memory::fastMappedBytes());
             m_fastMemories.removeFirst(basePtr);
+            if (m_recycledFastMemories.size() < Options::maxNumWebAssemblyRecycledFastMemories() && tryZeroFastMemory(basePtr, dirtyBytes))
+                m_recycledFastMemories.append(basePtr);
+            else
+                Gigacage::freeVirtualPages(Gigacage::Primitive, basePtr, Memory::fastMappedBytes());
         }
         
         dataLogLnIf(Options::logWebAssemblyMemory(), "Freed virtual; state: ", *this);
@@ -226,13 +239,24 @@ public:
     
     void dump(PrintStream& out) const
     {
-        out.print("fast memories =  ", m_fastMemories.size(), "/", m_maxFastMemoryCount, ", bytes = ", m_physicalBytes, "/", memoryLimit());
+        out.print("fast memories =  ", m_fastMemories.size(), "/", m_maxFastMemoryCount, ", recycled = ", m_recycledFastMemories.size(), ", bytes = ", m_physicalBytes, "/", memoryLimit());
     }
     
 private:
+    // Mapping fresh anonymous pages over the used range both zeroes it and gives its physical pages back,
+    // while keeping the reservation and its redzone for the next fast memory.
+    static bool tryZeroFastMemory(void* basePtr, size_t dirtyBytes)
+    {
+        if (!dirtyBytes)
+            return true;
+        size_t bytes = roundUpToMultipleOf(pageSize(), dirtyBytes);
+        return mmap(basePtr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_FIXED, -1, 0) == basePtr;
+    }
+
     Lock m_lock;
     unsigned m_maxFastMemoryCount { 0 };
     Vector<void*> m_fastMemories;
+    Vector<void*> m_recycledFastMemories;
     StdSet<std::pair<uintptr_t, size_t>> m_growableBoundsCheckingMemories;
     size_t m_physicalBytes { 0 };
 };
@@ -275,6 +299,39 @@ bool tryAllocate(const Func& allocate, const WTF::Function<void(Memory::NotifyPr
     return done;
 }
 
+// Bounds checked memories that are not shared reserve room to grow into, so that growing them only
+// has to make more of the reservation accessible. We end up in BoundsChecking mode mostly when the
+// address space for fast memories is short, and the reservation comes out of the same Gigacage as
+// every ArrayBuffer, so it is only a small multiple of the current size. Growing past it copies into
+// a new, proportionally larger reservation.
+size_t boundsCheckingMappedCapacity(size_t bytes, PageCount maximum)
+{
+    if (!Options::useWebAssemblyBoundsCheckingMemoryReservations())
+        return bytes;
+    size_t reservation = maximum ? maximum.bytes() : Options::webAssemblyBoundsCheckingMemoryDefaultReservation();
+    reservation = std::min<size_t>(reservation, std::max<size_t>(bytes, PageCount::pageSize) * Options::webAssemblyBoundsCheckingMemoryReservationFactor());
+    reservation = std::min<size_t>(reservation, MAX_ARRAY_BUFFER_SIZE);
+    reservation = WTF::roundDownToMultipleOf(PageCount::pageSize, reservation);
+    return std::max(bytes, reservation);
+}
+
+void* tryAllocateBoundsCheckingMemory(size_t bytes, size_t& mappedCapacity)
+{
+    ASSERT(mappedCapacity >= bytes);
+    if (mappedCapacity > bytes) {
+        if (void* memory = Gigacage::tryAllocateZeroedVirtualPages(Gigacage::Primitive, mappedCapacity)) {
+            if (mprotect(static_cast<uint8_t*>(memory) + bytes, mappedCapacity - bytes, PROT_NONE)) {
+                dataLog("mprotect failed: ", strerror(errno), "\n");
+                RELEASE_ASSERT_NOT_REACHED();
+            }
+            return memory;
+        }
+        // We couldn't get the whole reservation. Settle for what we need now, and copy if we grow.
+        mappedCapacity = bytes;
+    }
+    return Gigacage::tryAllocateZeroedVirtualPages(Gigacage::Primitive, bytes);
+}
+
 } // anonymous namespace
 
 
@@ -289,7 +346,7 @@ MemoryHandle::MemoryHandle(void* memory, size_t size, size_t mappedCapacity, Pag
 {
 #if ASSERT_ENABLED
     if (sharingMode == MemorySharingMode::Default && mode == MemoryMode::BoundsChecking)
-        ASSERT(mappedCapacity == size);
+        ASSERT(mappedCapacity >= size);
 #endif
 }
 
@@ -304,12 +361,18 @@ MemoryHandle::~MemoryHandle()
                 dataLog("mprotect failed: ", strerror(errno), "\n");
                 RELEASE_ASSERT_NOT_REACHED();
             }
-            memoryManager().freeFastMemory(memory);
+            memoryManager().freeFastMemory(memory, m_size);
             break;
         case MemoryMode::BoundsChecking: {
             switch (m_sharingMode) {
             case MemorySharingMode::Default:
-                Gigacage::freeVirtualPages(Gigacage::Primitive, memory, m_size);
+                if (m_mappedCapacity > m_size) {
+                    if (mprotect(memory, m_mappedCapacity, PROT_READ | PROT_WRITE)) {
+                        dataLog("mprotect failed: ", strerror(errno), "\n");
+                        RELEASE_ASSERT_NOT_REACHED();
+                    }
+                }
+                Gigacage::freeVirtualPages(Gigacage::Primitive, memory, m_mappedCapacity);
                 break;
             case MemorySharingMode::Shared: {
                 if (mprotect(memory, m_mappedCapacity, PROT_READ | PROT_WRITE)) {
@@ -421,12 +484,13 @@ RefPtr<Memory> Memory::tryCreate(PageCount initial, PageCount maximum, MemorySha
 
     switch (sharingMode) {
     case MemorySharingMode::Default: {
-        void* slowMemory = Gigacage::tryAllocateZeroedVirtualPages(Gigacage::Primitive, initialBytes);
+        size_t mappedCapacity = boundsCheckingMappedCapacity(initialBytes, maximum);
+        void* slowMemory = tryAllocateBoundsCheckingMemory(initialBytes, mappedCapacity);
         if (!slowMemory) {
             memoryManager().freePhysicalBytes(initialBytes);
             return nullptr;
         }
-        return Memory::create(adoptRef(*new MemoryHandle(slowMemory, initialBytes, initialBytes, initial, maximum, sharingMode, MemoryMode::BoundsChecking)), WTFMove(notifyMemoryPressure), WTFMove(syncTryToReclaimMemory), WTFMove(growSuccessCallback));
+        return Memory::create(adoptRef(*new MemoryHandle(slowMemory, initialBytes, mappedCapacity, initial, maximum, sharingMode, MemoryMode::BoundsChecking)), WTFMove(notifyMemoryPressure), WTFMove(syncTryToReclaimMemory), WTFMove(growSuccessCallback));
     }
     case MemorySharingMode::Shared: {
         char* slowMemory = nullptr;
@@ -567,6 +631,30 @@ Expected<PageCount, Memory::GrowFailReason> Memory::grow(PageCount delta)
     RELEASE_ASSERT(desiredSize > size());
     switch (mode()) {
     case MemoryMode::BoundsChecking: {
+        MonotonicTime before = MonotonicTime::now();
+        size_t oldSize = size();
+
+        if (desiredSize <= m_handle->mappedCapacity()) {
+            size_t extraBytes = desiredSize - oldSize;
+            bool allocationSuccess = tryAllocate(
+                [&] () -> MemoryResult::Kind {
+                    return memoryManager().tryAllocatePhysicalBytes(extraBytes);
+                }, m_notifyMemoryPressure, m_syncTryToReclaimMemory);
+            if (!allocationSuccess)
+                return makeUnexpected(GrowFailReason::OutOfMemory);
+
+            uint8_t* startAddress = static_cast<uint8_t*>(memory()) + oldSize;
+            dataLogLnIf(verbose, "Marking WebAssembly memory's ", RawPointer(memory()), " as read+write in range [", RawPointer(startAddress), ", ", RawPointer(startAddress + extraBytes), ")");
+            if (mprotect(startAddress, extraBytes, PROT_READ | PROT_WRITE)) {
+                dataLog("mprotect failed: ", strerror(errno), "\n");
+                RELEASE_ASSERT_NOT_REACHED();
+            }
+
+            m_handle->growToSize(desiredSize);
+            dataLogLnIf(Options::logWebAssemblyMemory(), "Grew bounds checking memory in place from ", oldSize, "B to ", desiredSize, "B in ", (MonotonicTime::now() - before).milliseconds(), "ms; ", *this);
+            return success();
+        }
+
         bool allocationSuccess = tryAllocate(
             [&] () -> MemoryResult::Kind {
                 return memoryManager().tryAllocatePhysicalBytes(desiredSize);
@@ -576,15 +664,19 @@ Expected<PageCount, Memory::GrowFailReason> Memory::grow(PageCount delta)
 
         RELEASE_ASSERT(maximum().bytes() != 0);
 
-        void* newMemory = Gigacage::tryAllocateZeroedVirtualPages(Gigacage::Primitive, desiredSize);
-        if (!newMemory)
+        size_t mappedCapacity = boundsCheckingMappedCapacity(desiredSize, maximum());
+        void* newMemory = tryAllocateBoundsCheckingMemory(desiredSize, mappedCapacity);
+        if (!newMemory) {
+            memoryManager().freePhysicalBytes(desiredSize);
             return makeUnexpected(GrowFailReason::OutOfMemory);
+        }
 
-        memcpy(newMemory, memory(), size());
-        auto newHandle = adoptRef(*new MemoryHandle(newMemory, desiredSize, desiredSize, initial(), maximum(), sharingMode(), MemoryMode::BoundsChecking));
+        memcpy(newMemory, memory(), oldSize);
+        auto newHandle = adoptRef(*new MemoryHandle(newMemory, desiredSize, mappedCapacity, initial(), maximum(), sharingMode(), MemoryMode::BoundsChecking));
         m_handle = WTFMove(newHandle);
 
         ASSERT(memory() == newMemory);
+        dataLogLnIf(Options::logWebAssemblyMemory(), "Grew bounds checking memory by copying ", oldSize, "B into ", desiredSize, "B in ", (MonotonicTime::now() - before).milliseconds(), "ms; ", *this);
         return success();
     }
     case MemoryMode::Signaling: {
@@ -645,7 +737,7 @@ bool Memory::copy(uint32_t dstAddress, uint32_t srcAddress, uint32_t count)
         return true;
 
     uint8_t* base = reinterpret_cast<uint8_t*>(memory());
-    memcpy(base + dstAddress, base + srcAddress, count);
+    memmove(base + dstAddress, base + srcAddress, count);
     return true;
 }
 
@@ -63,8 +63,11 @@ public:
     size_t mappedCapacity() const { return m_mappedCapacity; }
     size_t boundsCheckingSize() const
     {
-        if (m_mode == MemoryMode::BoundsChecking)
-            return m_mappedCapacity;
+        if (m_mode == MemoryMode::BoundsChecking) {
+            // Shared memories can be grown by another thread without updating our instances, so they rely
+            // on their inaccessible reserved pages to trap instead.
+            return m_sharingMode == MemorySharingMode::Shared ? m_mappedCapacity : m_size;
+        }
         return UINT32_MAX;
     }
     PageCount initial() const { return m_initial; }
@@ -29,6 +29,7 @@
 #if ENABLE(WEBASSEMBLY)
 
 #include "WasmLLIntPlan.h"
+#include "WasmModuleCache.h"
 #include "WasmModuleInformation.h"
 #include "WasmWorklist.h"
 
@@ -39,6 +40,32 @@ Module::Module(LLIntPlan& plan)
     , m_llintCallees(LLIntCallees::create(plan.takeCallees()))
     , m_llintEntryThunks(plan.takeEntryThunks())
 {
+    const ModuleInformation& info = m_moduleInformation.get();
+
+    m_instanceTemplate.globalsToMark.ensureSize(info.globals.size());
+    m_instanceTemplate.globalsToBinding.ensureSize(info.globals.size());
+    for (unsigned i = 0; i < info.globals.size(); ++i) {
+        const GlobalInformation& global = info.globals[i];
+        if (global.bindingMode == GlobalInformation::BindingMode::Portable) {
+            // This is kept alive by JSWebAssemblyInstance -> JSWebAssemblyGlobal -> binding.
+            m_instanceTemplate.globalsToBinding.quickSet(i);
+        } else if (isRefType(global.type)) {
+            // This is kept alive by JSWebAssemblyInstance -> binding.
+            m_instanceTemplate.globalsToMark.quickSet(i);
+        }
+    }
+
+    m_instanceTemplate.passiveElements.ensureSize(info.elementCount());
+    for (unsigned elementIndex = 0; elementIndex < info.elementCount(); ++elementIndex) {
+        if (info.elements[elementIndex].isPassive())
+            m_instanceTemplate.passiveElements.quickSet(elementIndex);
+    }
+
+    m_instanceTemplate.passiveDataSegments.ensureSize(info.dataSegmentsCount());
+    for (unsigned dataSegmentIndex = 0; dataSegmentIndex < info.dataSegmentsCount(); ++dataSegmentIndex) {
+        if (info.data[dataSegmentIndex]->isPassive())
+            m_instanceTemplate.passiveDataSegments.quickSet(dataSegmentIndex);
+    }
 }
 
 Module::~Module() { }
@@ -56,25 +83,58 @@ static Module::ValidationResult makeValidationResult(LLIntPlan& plan)
     return Module::ValidationResult(Module::create(plan));
 }
 
-static Plan::CompletionTask makeValidationCallback(Module::AsyncValidationCallback&& callback)
+static void addToModuleCache(const Optional<SHA1::Digest>& digest, const Module::ValidationResult& result, size_t sourceSize)
+{
+    if (digest && result.has_value())
+        ModuleCache::singleton().add(*digest, *result.value(), sourceSize);
+}
+
+static Plan::CompletionTask makeValidationCallback(Module::AsyncValidationCallback&& callback, Optional<SHA1::Digest> digest, size_t sourceSize)
 {
-    return createSharedTask<Plan::CallbackType>([callback = WTFMove(callback)] (Plan& plan) {
+    return createSharedTask<Plan::CallbackType>([callback = WTFMove(callback), digest, sourceSize] (Plan& plan) {
         ASSERT(!plan.hasWork());
-        callback->run(makeValidationResult(static_cast<LLIntPlan&>(plan)));
+        auto result = makeValidationResult(static_cast<LLIntPlan&>(plan));
+        addToModuleCache(digest, result, sourceSize);
+        callback->run(WTFMove(result));
     });
 }
 
+static Optional<SHA1::Digest> moduleCacheDigest(const Vector<uint8_t>& source)
+{
+    if (!Options::useWebAssemblyModuleCache())
+        return WTF::nullopt;
+    return ModuleCache::digest(source);
+}
+
 Module::ValidationResult Module::validateSync(Context* context, Vector<uint8_t>&& source)
 {
+    auto digest = moduleCacheDigest(source);
+    if (digest) {
+        if (RefPtr<Module> module = ModuleCache::singleton().find(*digest))
+            return Module::ValidationResult(WTFMove(module));
+    }
+
+    size_t sourceSize = source.size();
     Ref<LLIntPlan> plan = adoptRef(*new LLIntPlan(context, WTFMove(source), EntryPlan::Validation, Plan::dontFinalize()));
     Wasm::ensureWorklist().enqueue(plan.get());
     plan->waitForCompletion();
-    return makeValidationResult(plan.get());
+    auto result = makeValidationResult(plan.get());
+    addToModuleCache(digest, result, sourceSize);
+    return result;
 }
 
 void Module::validateAsync(Context* context, Vector<uint8_t>&& source, Module::AsyncValidationCallback&& callback)
 {
-    Ref<Plan> plan = adoptRef(*new LLIntPlan(context, WTFMove(source), EntryPlan::Validation, makeValidationCallback(WTFMove(callback))));
+    auto digest = moduleCacheDigest(source);
+    if (digest) {
+        if (RefPtr<Module> module = ModuleCache::singleton().find(*digest)) {
+            callback->run(Module::ValidationResult(WTFMove(module)));
+            return;
+        }
+    }
+
+    size_t sourceSize = source.size();
+    Ref<Plan> plan = adoptRef(*new LLIntPlan(context, WTFMove(source), EntryPlan::Validation, makeValidationCallback(WTFMove(callback), digest, sourceSize)));
     Wasm::ensureWorklist().enqueue(WTFMove(plan));
 }
 
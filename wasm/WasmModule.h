@@ -30,6 +30,7 @@
 #include "WasmCodeBlock.h"
 #include "WasmEmbedder.h"
 #include "WasmMemory.h"
+#include <wtf/BitVector.h>
 #include <wtf/Expected.h>
 #include <wtf/Lock.h>
 #include <wtf/SharedTask.h>
@@ -57,8 +58,18 @@ public:
         return adoptRef(*new Module(plan));
     }
 
+    // The parts of an Instance's initial state that only depend on the module. They are computed once
+    // so that instantiating the same module many times only has to copy them.
+    struct InstanceTemplate {
+        BitVector globalsToMark;
+        BitVector globalsToBinding;
+        BitVector passiveElements;
+        BitVector passiveDataSegments;
+    };
+
     Wasm::SignatureIndex signatureIndexFromFunctionIndexSpace(unsigned functionIndexSpace) const;
     const Wasm::ModuleInformation& moduleInformation() const { return m_moduleInformation.get(); }
+    const InstanceTemplate& instanceTemplate() const { return m_instanceTemplate; }
 
     Ref<CodeBlock> compileSync(Context*, MemoryMode);
     void compileAsync(Context*, MemoryMode, CodeBlock::AsyncCompilationCallback&&);
@@ -71,6 +82,7 @@ private:
 
     Module(LLIntPlan&);
     Ref<ModuleInformation> m_moduleInformation;
+    InstanceTemplate m_instanceTemplate;
     RefPtr<CodeBlock> m_codeBlocks[Wasm::NumberOfMemoryModes];
     RefPtr<LLIntCallees> m_llintCallees;
     MacroAssemblerCodeRef<B3CompilationPtrTag> m_llintEntryThunks;
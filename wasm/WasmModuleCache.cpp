@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "WasmModuleCache.h"
+
+#if ENABLE(WEBASSEMBLY)
+
+#include "Options.h"
+#include "WasmModule.h"
+#include <wtf/NeverDestroyed.h>
+
+namespace JSC { namespace Wasm {
+
+static unsigned keyForDigest(const SHA1::Digest& digest)
+{
+    return digest[0] | (digest[1] << 8) | (digest[2] << 16) | (digest[3] << 24);
+}
+
+ModuleCache& ModuleCache::singleton()
+{
+    static LazyNeverDestroyed<ModuleCache> cache;
+    static std::once_flag onceKey;
+    std::call_once(onceKey, [] {
+        cache.construct();
+    });
+    return cache.get();
+}
+
+SHA1::Digest ModuleCache::digest(const Vector<uint8_t>& source)
+{
+    SHA1 sha1;
+    sha1.addBytes(source.data(), source.size());
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return digest;
+}
+
+RefPtr<Module> ModuleCache::find(const SHA1::Digest& digest)
+{
+    auto locker = holdLock(m_lock);
+    auto iter = m_entries.find(keyForDigest(digest));
+    if (iter == m_entries.end() || iter->value->digest != digest)
+        return nullptr;
+    return iter->value->module.copyRef();
+}
+
+void ModuleCache::add(const SHA1::Digest& digest, Module& module, size_t sourceSize)
+{
+    auto locker = holdLock(m_lock);
+    if (m_sourceBytes + sourceSize > Options::webAssemblyModuleCacheMaximumBytes())
+        return;
+    auto addResult = m_entries.add(keyForDigest(digest), nullptr);
+    if (!addResult.isNewEntry)
+        return;
+    addResult.iterator->value = std::unique_ptr<Entry>(new Entry { digest, module, sourceSize });
+    m_sourceBytes += sourceSize;
+}
+
+void ModuleCache::clear()
+{
+    auto locker = holdLock(m_lock);
+    m_entries.clear();
+    m_sourceBytes = 0;
+}
+
+} } // namespace JSC::Wasm
+
+#endif // ENABLE(WEBASSEMBLY)
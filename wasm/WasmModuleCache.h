@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#if ENABLE(WEBASSEMBLY)
+
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/SHA1.h>
+#include <wtf/Vector.h>
+
+namespace JSC { namespace Wasm {
+
+class Module;
+
+// A process-wide cache of validated modules keyed by a digest of their bytes. A Wasm::Module is not
+// tied to a VM, and its per-memory-mode CodeBlocks keep whatever BBQ and OMG code has been compiled,
+// so compiling the same bytes again, in any VM of the process, hands back the warm module.
+class ModuleCache {
+    WTF_MAKE_NONCOPYABLE(ModuleCache);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    ModuleCache() = default;
+
+    static ModuleCache& singleton();
+
+    static SHA1::Digest digest(const Vector<uint8_t>& source);
+
+    RefPtr<Module> find(const SHA1::Digest&);
+    void add(const SHA1::Digest&, Module&, size_t sourceSize);
+
+    JS_EXPORT_PRIVATE void clear();
+
+private:
+    struct Entry {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        SHA1::Digest digest;
+        Ref<Module> module;
+        size_t sourceSize;
+    };
+
+    Lock m_lock;
+    // Keyed by the leading bytes of the digest; the full digest is compared on lookup.
+    HashMap<unsigned, std::unique_ptr<Entry>, WTF::IntHash<unsigned>, WTF::UnsignedWithZeroKeyHashTraits<unsigned>> m_entries;
+    size_t m_sourceBytes { 0 };
+};
+
+} } // namespace JSC::Wasm
+
+#endif // ENABLE(WEBASSEMBLY)
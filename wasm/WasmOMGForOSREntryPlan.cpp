@@ -72,6 +72,10 @@ void OMGForOSREntryPlan::work(CompilationEffort)
     SignatureIndex signatureIndex = m_moduleInformation->internalFunctionSignatureIndices[m_functionIndex];
     const Signature& signature = SignatureInformation::get(signatureIndex);
 
+    MonotonicTime startTime;
+    if (Options::reportWasmTierUpTimes())
+        startTime = MonotonicTime::now();
+
     Vector<UnlinkedWasmToWasmCall> unlinkedCalls;
     CompilationContext context;
     unsigned osrEntryScratchBufferSize = 0;
@@ -129,6 +133,10 @@ void OMGForOSREntryPlan::work(CompilationEffort)
                 bbqCallee->setOSREntryCallee(callee.copyRef());
                 bbqCallee->tierUpCount()->osrEntryTriggers()[m_loopIndex] = TierUpCount::TriggerReason::CompilationDone;
                 bbqCallee->tierUpCount()->m_compilationStatusForOMGForOSREntry = TierUpCount::CompilationStatus::Compiled;
+                if (Options::reportWasmTierUpTimes()) {
+                    MonotonicTime now = MonotonicTime::now();
+                    dataLogLn("Wasm function ", m_functionIndex, " ran ", (now - bbqCallee->tierUpCount()->creationTime()).milliseconds(), " ms in BBQ before OMG OSR entry at loop ", m_loopIndex, "; OMG compile took ", (now - startTime).milliseconds(), " ms");
+                }
                 break;
             }
             default:
@@ -30,12 +30,14 @@
 
 #include "B3Compilation.h"
 #include "LinkBuffer.h"
+#include "USDTProbes.h"
 #include "WasmB3IRGenerator.h"
 #include "WasmCallee.h"
 #include "WasmNameSection.h"
 #include "WasmSignatureInlines.h"
 #include <wtf/DataLog.h>
 #include <wtf/Locker.h>
+#include <wtf/Scope.h>
 #include <wtf/StdLibExtras.h>
 
 namespace JSC { namespace Wasm {
@@ -69,6 +71,15 @@ void OMGPlan::work(CompilationEffort)
     SignatureIndex signatureIndex = m_moduleInformation->internalFunctionSignatureIndices[m_functionIndex];
     const Signature& signature = SignatureInformation::get(signatureIndex);
 
+    JSC_USDT_PROBE1(wasm__omg__compile__start, m_functionIndex);
+    auto probeCompileEnd = makeScopeExit([&] {
+        JSC_USDT_PROBE1(wasm__omg__compile__end, m_functionIndex);
+    });
+
+    MonotonicTime startTime;
+    if (Options::reportWasmTierUpTimes())
+        startTime = MonotonicTime::now();
+
     Vector<UnlinkedWasmToWasmCall> unlinkedCalls;
     unsigned osrEntryScratchBufferSize;
     CompilationContext context;
@@ -125,6 +136,10 @@ void OMGPlan::work(CompilationEffort)
                 auto locker = holdLock(bbqCallee->tierUpCount()->getLock());
                 bbqCallee->setReplacement(callee.copyRef());
                 bbqCallee->tierUpCount()->m_compilationStatusForOMG = TierUpCount::CompilationStatus::Compiled;
+                if (Options::reportWasmTierUpTimes()) {
+                    MonotonicTime now = MonotonicTime::now();
+                    dataLogLn("Wasm function ", m_functionIndex, " ran ", (now - bbqCallee->tierUpCount()->creationTime()).milliseconds(), " ms in BBQ before OMG; OMG compile took ", (now - startTime).milliseconds(), " ms");
+                }
             }
             if (m_codeBlock->m_llintCallees) {
                 LLIntCallee& llintCallee = m_codeBlock->m_llintCallees->at(m_functionIndex).get();
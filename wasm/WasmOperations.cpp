@@ -28,6 +28,7 @@
 
 #if ENABLE(WEBASSEMBLY)
 
+#include "AtomicsObject.h"
 #include "ButterflyInlines.h"
 #include "FrameTracers.h"
 #include "IteratorOperations.h"
@@ -38,7 +39,6 @@
 #include "JSWebAssemblyInstance.h"
 #include "JSWebAssemblyRuntimeError.h"
 #include "ProbeContext.h"
-#include "ReleaseHeapAccessScope.h"
 #include "TypedArrayController.h"
 #include "WasmCallee.h"
 #include "WasmCallingConvention.h"
@@ -95,7 +95,7 @@ static void triggerOMGReplacementCompile(TierUpCount& tierUp, OMGCallee* replace
         dataLogLnIf(Options::verboseOSR(), "triggerOMGReplacement for ", functionIndex);
         // We need to compile the code.
         Ref<Plan> plan = adoptRef(*new OMGPlan(instance->context(), Ref<Wasm::Module>(instance->module()), functionIndex, codeBlock.mode(), Plan::dontFinalize()));
-        ensureWorklist().enqueue(plan.copyRef());
+        ensureWorklist().enqueueTierUp(plan.copyRef());
         if (UNLIKELY(!Options::useConcurrentJIT()))
             plan->waitForCompletion();
         else
@@ -395,7 +395,7 @@ JSC_DEFINE_JIT_OPERATION(operationWasmTriggerOSREntryNow, void, (Probe::Context&
     if (startOSREntryCompilation) {
         dataLogLnIf(Options::verboseOSR(), "triggerOMGOSR for ", functionIndex);
         Ref<Plan> plan = adoptRef(*new OMGForOSREntryPlan(instance->context(), Ref<Wasm::Module>(instance->module()), Ref<Wasm::BBQCallee>(callee), functionIndex, loopIndex, codeBlock.mode(), Plan::dontFinalize()));
-        ensureWorklist().enqueue(plan.copyRef());
+        ensureWorklist().enqueueTierUp(plan.copyRef());
         if (UNLIKELY(!Options::useConcurrentJIT()))
             plan->waitForCompletion();
         else
@@ -823,67 +823,38 @@ JSC_DEFINE_JIT_OPERATION(operationGetWasmTableSize, int32_t, (Instance* instance
 }
 
 template<typename ValueType>
-static int32_t wait(VM& vm, ValueType* pointer, ValueType expectedValue, int64_t timeoutInNanoseconds)
-{
-    Seconds timeout = Seconds::infinity();
-    if (timeoutInNanoseconds >= 0) {
-        int64_t timeoutInMilliseconds = timeoutInNanoseconds / 1000;
-        timeout = Seconds::fromMilliseconds(timeoutInMilliseconds);
-    }
-    bool didPassValidation = false;
-    ParkingLot::ParkResult result;
-    {
-        ReleaseHeapAccessScope releaseHeapAccessScope(vm.heap);
-        result = ParkingLot::parkConditionally(
-            pointer,
-            [&] () -> bool {
-                didPassValidation = WTF::atomicLoad(pointer) == expectedValue;
-                return didPassValidation;
-            },
-            [] () { },
-            MonotonicTime::now() + timeout);
-    }
-    if (!didPassValidation)
-        return 1;
-    if (!result.wasUnparked)
-        return 2;
-    return 0;
-}
-
-JSC_DEFINE_JIT_OPERATION(operationMemoryAtomicWait32, int32_t, (Instance* instance, unsigned base, unsigned offset, uint32_t value, int64_t timeoutInNanoseconds))
+static int32_t memoryAtomicWait(Instance* instance, unsigned base, unsigned offset, ValueType value, int64_t timeoutInNanoseconds)
 {
     VM& vm = instance->owner<JSWebAssemblyInstance>()->vm();
     uint64_t offsetInMemory = static_cast<uint64_t>(base) + offset;
-    if (offsetInMemory & (0x4 - 1))
+    if (offsetInMemory & (sizeof(ValueType) - 1))
         return -1;
     if (!instance->memory())
         return -1;
-    if (offsetInMemory >= instance->memory()->size())
+    if (offsetInMemory + sizeof(ValueType) > instance->memory()->size())
         return -1;
     if (instance->memory()->sharingMode() != MemorySharingMode::Shared)
         return -1;
     if (!vm.m_typedArrayController->isAtomicsWaitAllowedOnCurrentThread())
         return -1;
-    uint32_t* pointer = bitwise_cast<uint32_t*>(instance->memory()->memory()) + offsetInMemory;
-    return wait<uint32_t>(vm, pointer, value, timeoutInNanoseconds);
+
+    Seconds timeout = Seconds::infinity();
+    if (timeoutInNanoseconds >= 0)
+        timeout = Seconds::fromNanoseconds(timeoutInNanoseconds);
+
+    using SignedType = std::make_signed_t<ValueType>;
+    auto* pointer = bitwise_cast<SignedType*>(bitwise_cast<uint8_t*>(instance->memory()->memory()) + offsetInMemory);
+    return static_cast<int32_t>(atomicsWait(vm, pointer, static_cast<SignedType>(value), timeout));
+}
+
+JSC_DEFINE_JIT_OPERATION(operationMemoryAtomicWait32, int32_t, (Instance* instance, unsigned base, unsigned offset, uint32_t value, int64_t timeoutInNanoseconds))
+{
+    return memoryAtomicWait<uint32_t>(instance, base, offset, value, timeoutInNanoseconds);
 }
 
 JSC_DEFINE_JIT_OPERATION(operationMemoryAtomicWait64, int32_t, (Instance* instance, unsigned base, unsigned offset, uint64_t value, int64_t timeoutInNanoseconds))
 {
-    VM& vm = instance->owner<JSWebAssemblyInstance>()->vm();
-    uint64_t offsetInMemory = static_cast<uint64_t>(base) + offset;
-    if (offsetInMemory & (0x8 - 1))
-        return -1;
-    if (!instance->memory())
-        return -1;
-    if (offsetInMemory >= instance->memory()->size())
-        return -1;
-    if (instance->memory()->sharingMode() != MemorySharingMode::Shared)
-        return -1;
-    if (!vm.m_typedArrayController->isAtomicsWaitAllowedOnCurrentThread())
-        return -1;
-    uint64_t* pointer = bitwise_cast<uint64_t*>(instance->memory()->memory()) + offsetInMemory;
-    return wait<uint64_t>(vm, pointer, value, timeoutInNanoseconds);
+    return memoryAtomicWait<uint64_t>(instance, base, offset, value, timeoutInNanoseconds);
 }
 
 JSC_DEFINE_JIT_OPERATION(operationMemoryAtomicNotify, int32_t, (Instance* instance, unsigned base, unsigned offset, int32_t countValue))
@@ -893,7 +864,7 @@ JSC_DEFINE_JIT_OPERATION(operationMemoryAtomicNotify, int32_t, (Instance* instan
         return -1;
     if (!instance->memory())
         return -1;
-    if (offsetInMemory >= instance->memory()->size())
+    if (offsetInMemory + sizeof(uint32_t) > instance->memory()->size())
         return -1;
     if (instance->memory()->sharingMode() != MemorySharingMode::Shared)
         return 0;
@@ -901,7 +872,7 @@ JSC_DEFINE_JIT_OPERATION(operationMemoryAtomicNotify, int32_t, (Instance* instan
     unsigned count = UINT_MAX;
     if (countValue >= 0)
         count = static_cast<unsigned>(countValue);
-    return ParkingLot::unparkCount(pointer, count);
+    return atomicsNotify(pointer, count);
 }
 
 JSC_DEFINE_JIT_OPERATION(operationWasmMemoryInit, bool, (Instance* instance, unsigned dataSegmentIndex, uint32_t dstAddress, uint32_t srcAddress, uint32_t length))
@@ -916,6 +887,25 @@ JSC_DEFINE_JIT_OPERATION(operationWasmDataDrop, void, (Instance* instance, unsig
     instance->dataDrop(dataSegmentIndex);
 }
 
+// Returns true if the traps asked for execution to stop. Wasm cannot take a pending JS exception on its
+// own, so the caller throws ExceptionType::Termination through the usual wasm exception path instead.
+JSC_DEFINE_JIT_OPERATION(operationWasmHandleTraps, bool, (void* callFrame, Instance* instance))
+{
+    instance->storeTopCallFrame(callFrame);
+    JSGlobalObject* globalObject = instance->owner<JSWebAssemblyInstance>()->globalObject();
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    if (!vm.needTrapHandling())
+        return false;
+    vm.handleTraps(globalObject, static_cast<CallFrame*>(callFrame));
+    if (UNLIKELY(scope.exception())) {
+        scope.clearException();
+        return true;
+    }
+    return false;
+}
+
 JSC_DEFINE_JIT_OPERATION(operationWasmToJSException, void*, (CallFrame* callFrame, Wasm::ExceptionType type, Instance* wasmInstance))
 {
     wasmInstance->storeTopCallFrame(callFrame);
@@ -931,6 +921,8 @@ JSC_DEFINE_JIT_OPERATION(operationWasmToJSException, void*, (CallFrame* callFram
         JSObject* error;
         if (type == ExceptionType::StackOverflow)
             error = createStackOverflowError(globalObject);
+        else if (type == ExceptionType::Termination)
+            error = createTerminatedExecutionException(&vm);
         else
             error = JSWebAssemblyRuntimeError::create(globalObject, vm, globalObject->webAssemblyRuntimeErrorStructure(), Wasm::errorMessageForExceptionType(type));
         throwException(globalObject, throwScope, error);
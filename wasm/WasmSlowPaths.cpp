@@ -131,7 +131,7 @@ inline bool jitCompileAndSetHeuristics(Wasm::LLIntCallee* callee, Wasm::Function
         else
             plan = adoptRef(*new Wasm::OMGPlan(instance->context(), Ref<Wasm::Module>(instance->module()), functionIndex, instance->memory()->mode(), Wasm::Plan::dontFinalize()));
 
-        Wasm::ensureWorklist().enqueue(makeRef(*plan));
+        Wasm::ensureWorklist().enqueueTierUp(makeRef(*plan));
         if (UNLIKELY(!Options::useConcurrentJIT()))
             plan->waitForCompletion();
         else
@@ -224,7 +224,7 @@ WASM_SLOW_PATH_DECL(loop_osr)
 
     if (compile) {
         Ref<Wasm::Plan> plan = adoptRef(*static_cast<Wasm::Plan*>(new Wasm::OMGForOSREntryPlan(instance->context(), Ref<Wasm::Module>(instance->module()), Ref<Wasm::Callee>(*callee), codeBlock->functionIndex(), osrEntryData.loopIndex, instance->memory()->mode(), Wasm::Plan::dontFinalize())));
-        Wasm::ensureWorklist().enqueue(plan.copyRef());
+        Wasm::ensureWorklist().enqueueTierUp(plan.copyRef());
         if (UNLIKELY(!Options::useConcurrentJIT()))
             plan->waitForCompletion();
         else
@@ -256,6 +256,13 @@ WASM_SLOW_PATH_DECL(epilogue_osr)
 }
 
 
+WASM_SLOW_PATH_DECL(check_traps)
+{
+    if (Wasm::operationWasmHandleTraps(callFrame, instance))
+        WASM_THROW(Wasm::ExceptionType::Termination);
+    WASM_END();
+}
+
 WASM_SLOW_PATH_DECL(trace)
 {
     UNUSED_PARAM(instance);
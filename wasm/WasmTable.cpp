@@ -119,8 +119,6 @@ Optional<uint32_t> Table::grow(uint32_t delta, JSValue defaultValue)
     if (auto* funcRefTable = asFuncrefTable()) {
         if (!checkedGrow(funcRefTable->m_importableFunctions, [] (auto&) { }))
             return WTF::nullopt;
-        if (!checkedGrow(funcRefTable->m_instances, [] (auto&) { }))
-            return WTF::nullopt;
     }
 
     if (!checkedGrow(m_jsValues, [defaultValue] (WriteBarrier<Unknown>& slot) { slot.setStartingValue(defaultValue); }))
@@ -143,9 +141,8 @@ void Table::clear(uint32_t index)
     RELEASE_ASSERT(index < length());
     RELEASE_ASSERT(m_owner);
     if (auto* funcRefTable = asFuncrefTable()) {
-        funcRefTable->m_importableFunctions.get()[index & m_mask] = WasmToWasmImportableFunction();
-        ASSERT(funcRefTable->m_importableFunctions.get()[index & m_mask].signatureIndex == Wasm::Signature::invalidIndex); // We rely on this in compiled code.
-        funcRefTable->m_instances.get()[index & m_mask] = nullptr;
+        funcRefTable->m_importableFunctions.get()[index & m_mask] = FuncRefTable::Function();
+        ASSERT(funcRefTable->m_importableFunctions.get()[index & m_mask].importableFunction.signatureIndex == Wasm::Signature::invalidIndex); // We rely on this in compiled code.
     }
     m_jsValues.get()[index & m_mask].setStartingValue(jsNull());
 }
@@ -184,13 +181,11 @@ FuncRefTable::FuncRefTable(uint32_t initial, Optional<uint32_t> maximum)
 {
     // FIXME: It might be worth trying to pre-allocate maximum here. The spec recommends doing so.
     // But for now, we're not doing that.
-    m_importableFunctions = MallocPtr<WasmToWasmImportableFunction, VMMalloc>::malloc((sizeof(WasmToWasmImportableFunction) * Checked<size_t>(allocatedLength(m_length))).unsafeGet());
     // FIXME this over-allocates and could be smarter about not committing all of that memory https://bugs.webkit.org/show_bug.cgi?id=181425
-    m_instances = MallocPtr<Instance*, VMMalloc>::malloc((sizeof(Instance*) * Checked<size_t>(allocatedLength(m_length))).unsafeGet());
+    m_importableFunctions = MallocPtr<Function, VMMalloc>::malloc((sizeof(Function) * Checked<size_t>(allocatedLength(m_length))).unsafeGet());
     for (uint32_t i = 0; i < allocatedLength(m_length); ++i) {
-        new (&m_importableFunctions.get()[i]) WasmToWasmImportableFunction();
-        ASSERT(m_importableFunctions.get()[i].signatureIndex == Wasm::Signature::invalidIndex); // We rely on this in compiled code.
-        m_instances.get()[i] = nullptr;
+        new (&m_importableFunctions.get()[i]) Function();
+        ASSERT(m_importableFunctions.get()[i].importableFunction.signatureIndex == Wasm::Signature::invalidIndex); // We rely on this in compiled code.
     }
 }
 
@@ -201,18 +196,19 @@ void FuncRefTable::setFunction(uint32_t index, JSObject* optionalWrapper, WasmTo
     clear(index);
     if (optionalWrapper)
         m_jsValues.get()[index & m_mask].set(m_owner->vm(), m_owner, optionalWrapper);
-    m_importableFunctions.get()[index & m_mask] = function;
-    m_instances.get()[index & m_mask] = instance;
+    Function& slot = m_importableFunctions.get()[index & m_mask];
+    slot.importableFunction = function;
+    slot.instance = instance;
 }
 
 const WasmToWasmImportableFunction& FuncRefTable::function(uint32_t index) const
 {
-    return m_importableFunctions.get()[index & m_mask];
+    return m_importableFunctions.get()[index & m_mask].importableFunction;
 }
 
 Instance* FuncRefTable::instance(uint32_t index) const
 {
-    return m_instances.get()[index & m_mask];
+    return m_importableFunctions.get()[index & m_mask].instance;
 }
 
 void FuncRefTable::copyFunction(const FuncRefTable* srcTable, uint32_t dstIndex, uint32_t srcIndex)
@@ -99,6 +99,17 @@ class FuncRefTable : public Table {
 public:
     JS_EXPORT_PRIVATE ~FuncRefTable() = default;
 
+    // call_indirect loads everything it needs about the callee from one of these, so they are kept
+    // together rather than in parallel arrays.
+    struct Function {
+        WasmToWasmImportableFunction importableFunction;
+        // call_indirect needs to do an Instance check to potentially context switch when calling a function to another instance. We can hold raw pointers to Instance here because the embedder ensures that Table keeps all the instances alive. We couldn't hold a Ref here because it would cause cycles.
+        Instance* instance { nullptr };
+
+        static ptrdiff_t offsetOfFunction() { return OBJECT_OFFSETOF(Function, importableFunction); }
+        static ptrdiff_t offsetOfInstance() { return OBJECT_OFFSETOF(Function, instance); }
+    };
+
     void setFunction(uint32_t, JSObject*, WasmToWasmImportableFunction, Instance*);
     const WasmToWasmImportableFunction& function(uint32_t) const;
     Instance* instance(uint32_t) const;
@@ -106,14 +117,11 @@ public:
     void copyFunction(const FuncRefTable* srcTable, uint32_t dstIndex, uint32_t srcIndex);
 
     static ptrdiff_t offsetOfFunctions() { return OBJECT_OFFSETOF(FuncRefTable, m_importableFunctions); }
-    static ptrdiff_t offsetOfInstances() { return OBJECT_OFFSETOF(FuncRefTable, m_instances); }
 
 private:
     FuncRefTable(uint32_t initial, Optional<uint32_t> maximum);
 
-    MallocPtr<WasmToWasmImportableFunction, VMMalloc> m_importableFunctions;
-    // call_indirect needs to do an Instance check to potentially context switch when calling a function to another instance. We can hold raw pointers to Instance here because the embedder ensures that Table keeps all the instances alive. We couldn't hold a Ref here because it would cause cycles.
-    MallocPtr<Instance*, VMMalloc> m_instances;
+    MallocPtr<Function, VMMalloc> m_importableFunctions;
 
     friend class Table;
 };
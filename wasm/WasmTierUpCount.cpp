@@ -35,6 +35,8 @@ namespace JSC { namespace Wasm {
 TierUpCount::TierUpCount()
 {
     setNewThreshold(Options::thresholdForOMGOptimizeAfterWarmUp(), nullptr);
+    if (Options::reportWasmTierUpTimes())
+        m_creationTime = MonotonicTime::now();
 }
 
 TierUpCount::~TierUpCount() = default;
@@ -31,6 +31,7 @@
 #include "ExecutionCounter.h"
 #include "Options.h"
 #include <wtf/Atomics.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/SegmentedVector.h>
 #include <wtf/StdLibExtras.h>
 
@@ -70,6 +71,9 @@ public:
 
     OSREntryData& addOSREntryData(uint32_t functionIndex, uint32_t loopIndex);
 
+    // Only recorded when reportWasmTierUpTimes is set.
+    MonotonicTime creationTime() const { return m_creationTime; }
+
     void optimizeAfterWarmUp(uint32_t functionIndex)
     {
         dataLogLnIf(Options::verboseOSR(), functionIndex, ": OMG-optimizing after warm-up.");
@@ -131,6 +135,7 @@ public:
     SegmentedVector<TriggerReason, 16> m_osrEntryTriggers;
     Vector<uint32_t> m_outerLoops;
     Vector<std::unique_ptr<OSREntryData>> m_osrEntryData;
+    MonotonicTime m_creationTime;
 };
     
 } } // namespace JSC::Wasm
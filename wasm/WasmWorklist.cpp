@@ -43,6 +43,7 @@ const char* Worklist::priorityString(Priority priority)
     switch (priority) {
     case Priority::Preparation: return "Preparation";
     case Priority::Shutdown: return "Shutdown";
+    case Priority::TierUp: return "TierUp";
     case Priority::Compilation: return "Compilation";
     case Priority::Synchronous: return "Synchronous";
     }
@@ -75,17 +76,27 @@ private:
             if (priority == Worklist::Priority::Shutdown)
                 return PollResult::Stop;
 
-            element = queue.peek();
-            // Only one thread should validate/prepare.
-            if (!queue.peek().plan->multiThreaded())
-                queue.dequeue();
+            element = queue.dequeue();
+            // There must be a another thread linking this plan so we can see if there is other work.
+            if (!element.plan->hasWork()) {
+                element = QueueElement();
+                continue;
+            }
 
-            if (element.plan->hasWork())
-                return PollResult::Work;
+            if (element.enqueueTime) {
+                dataLogLn("Wasm worklist: ", worklist.priorityString(element.priority), " plan waited ", (MonotonicTime::now() - element.enqueueTime).milliseconds(), "ms");
+                element.enqueueTime = MonotonicTime();
+            }
 
-            // There must be a another thread linking this plan so we can deque and see if there is other work.
-            queue.dequeue();
-            element = QueueElement();
+            // Only one thread should validate/prepare. Other threads can help compile, but we move
+            // the plan behind the others of its priority so that they all make progress.
+            if (element.plan->multiThreaded()) {
+                QueueElement remaining = element;
+                if (Options::interleaveWebAssemblyCompilationPlans())
+                    remaining.ticket = worklist.nextTicket();
+                queue.enqueue(WTFMove(remaining));
+            }
+            return PollResult::Work;
         }
         return PollResult::Wait;
     }
@@ -109,6 +120,8 @@ private:
         if (plan->hasWork() && !wasMultiThreaded && plan->multiThreaded()) {
             LockHolder locker(*worklist.m_lock);
             element.setToNextPriority();
+            if (Options::reportWasmWorklistQueueLatency())
+                element.enqueueTime = MonotonicTime::now();
             worklist.m_queue.enqueue(WTFMove(element));
             worklist.m_planEnqueued->notifyAll(locker);
             return complete(locker);
@@ -136,6 +149,7 @@ void Worklist::QueueElement::setToNextPriority()
         priority = Priority::Compilation;
         return;
     case Priority::Synchronous:
+    case Priority::TierUp:
         return;
     default:
         break;
@@ -144,6 +158,21 @@ void Worklist::QueueElement::setToNextPriority()
 }
 
 void Worklist::enqueue(Ref<Plan> plan)
+{
+    Priority priority = plan->multiThreaded() ? Priority::Compilation : Priority::Preparation;
+    enqueue(WTFMove(plan), priority);
+}
+
+void Worklist::enqueueTierUp(Ref<Plan> plan)
+{
+    if (!Options::prioritizeWebAssemblyTierUpPlans()) {
+        enqueue(WTFMove(plan));
+        return;
+    }
+    enqueue(WTFMove(plan), Priority::TierUp);
+}
+
+void Worklist::enqueue(Ref<Plan> plan, Priority priority)
 {
     LockHolder locker(*m_lock);
 
@@ -154,7 +183,8 @@ void Worklist::enqueue(Ref<Plan> plan)
 
     dataLogLnIf(WasmWorklistInternal::verbose, "Enqueuing plan");
     bool multiThreaded = plan->multiThreaded();
-    m_queue.enqueue({ multiThreaded ? Priority::Compilation : Priority::Preparation, nextTicket(),  WTFMove(plan) });
+    MonotonicTime enqueueTime = Options::reportWasmWorklistQueueLatency() ? MonotonicTime::now() : MonotonicTime();
+    m_queue.enqueue({ priority, nextTicket(), WTFMove(plan), enqueueTime });
     if (multiThreaded)
         m_planEnqueued->notifyAll(locker);
     else
@@ -30,6 +30,7 @@
 #include <queue>
 
 #include <wtf/AutomaticThread.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/PriorityQueue.h>
 #include <wtf/Vector.h>
 
@@ -47,6 +48,8 @@ public:
     ~Worklist();
 
     JS_EXPORT_PRIVATE void enqueue(Ref<Plan>);
+    // Tier-up plans replace code that is already running hot, so they go ahead of compiling new modules.
+    void enqueueTierUp(Ref<Plan>);
     void stopAllPlansForContext(Context&);
 
     JS_EXPORT_PRIVATE void completePlanSynchronously(Plan&);
@@ -54,6 +57,7 @@ public:
     enum class Priority {
         Shutdown,
         Synchronous,
+        TierUp,
         Compilation,
         Preparation
     };
@@ -63,6 +67,8 @@ private:
     class Thread;
     friend class Thread;
 
+    void enqueue(Ref<Plan>, Priority);
+
     typedef uint64_t Ticket;
     Ticket nextTicket() { return m_lastGrantedTicket++; }
 
@@ -70,6 +76,8 @@ private:
         Priority priority;
         Ticket ticket;
         RefPtr<Plan> plan;
+        // Only set when reporting queue latency, and cleared once a thread has picked the plan up.
+        MonotonicTime enqueueTime;
 
         void setToNextPriority();
     };
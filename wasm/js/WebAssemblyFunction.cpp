@@ -165,9 +165,15 @@ RegisterSet WebAssemblyFunction::calleeSaves() const
     return Wasm::PinnedRegisterInfo::get().toSave(Wasm::MemoryMode::BoundsChecking);
 }
 
-RegisterAtOffsetList WebAssemblyFunction::usedCalleeSaveRegisters() const
+const RegisterAtOffsetList& WebAssemblyFunction::usedCalleeSaveRegisters() const
 {
-    return RegisterAtOffsetList { calleeSaves(), RegisterAtOffsetList::OffsetBaseType::FramePointerBased };
+    // The callee saves do not depend on the function, and the unwinder asks for them on every frame it pops.
+    static RegisterAtOffsetList* result;
+    static std::once_flag calleeSavesFlag;
+    std::call_once(calleeSavesFlag, [&] () {
+        result = new RegisterAtOffsetList { calleeSaves(), RegisterAtOffsetList::OffsetBaseType::FramePointerBased };
+    });
+    return *result;
 }
 
 ptrdiff_t WebAssemblyFunction::previousInstanceOffset() const
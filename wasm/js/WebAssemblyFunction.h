@@ -86,7 +86,7 @@ public:
         return jsCallEntrypointSlow();
     }
 
-    RegisterAtOffsetList usedCalleeSaveRegisters() const;
+    const RegisterAtOffsetList& usedCalleeSaveRegisters() const;
     Wasm::Instance* previousInstance(CallFrame*);
 
 private:
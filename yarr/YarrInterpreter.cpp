@@ -2437,6 +2437,11 @@ std::unique_ptr<BytecodePattern> byteCompile(YarrPattern& pattern, BumpPointerAl
 unsigned interpret(BytecodePattern* bytecode, const String& input, unsigned start, unsigned* output)
 {
     SuperSamplerScope superSamplerScope(false);
+    if (bytecode->m_linearTimeMatcher) {
+        if (input.is8Bit())
+            return bytecode->m_linearTimeMatcher->match(input.characters8(), input.length(), start, output);
+        return bytecode->m_linearTimeMatcher->match(input.characters16(), input.length(), start, output);
+    }
     if (input.is8Bit())
         return Interpreter<LChar>(bytecode, output, input.characters8(), input.length(), start).interpret();
     return Interpreter<UChar>(bytecode, output, input.characters16(), input.length(), start).interpret();
@@ -2445,12 +2450,16 @@ unsigned interpret(BytecodePattern* bytecode, const String& input, unsigned star
 unsigned interpret(BytecodePattern* bytecode, const LChar* input, unsigned length, unsigned start, unsigned* output)
 {
     SuperSamplerScope superSamplerScope(false);
+    if (bytecode->m_linearTimeMatcher)
+        return bytecode->m_linearTimeMatcher->match(input, length, start, output);
     return Interpreter<LChar>(bytecode, output, input, length, start).interpret();
 }
 
 unsigned interpret(BytecodePattern* bytecode, const UChar* input, unsigned length, unsigned start, unsigned* output)
 {
     SuperSamplerScope superSamplerScope(false);
+    if (bytecode->m_linearTimeMatcher)
+        return bytecode->m_linearTimeMatcher->match(input, length, start, output);
     return Interpreter<UChar>(bytecode, output, input, length, start).interpret();
 }
 
@@ -28,6 +28,7 @@
 #include "ConcurrentJSLock.h"
 #include "YarrErrorCode.h"
 #include "YarrFlags.h"
+#include "YarrLinearTimeMatcher.h"
 #include "YarrPattern.h"
 
 namespace WTF {
@@ -385,6 +386,9 @@ public:
     CharacterClass* newlineCharacterClass;
     CharacterClass* wordcharCharacterClass;
 
+    // When present, interpret() runs this instead of the backtracking interpreter.
+    std::unique_ptr<LinearTimeMatcher> m_linearTimeMatcher;
+
 private:
     Vector<std::unique_ptr<ByteDisjunction>> m_allParenthesesInfo;
     Vector<std::unique_ptr<CharacterClass>> m_userCharacterClasses;
@@ -33,6 +33,7 @@
 #include "YarrCanonicalize.h"
 #include "YarrDisassembler.h"
 #include <wtf/ASCIICType.h>
+#include <wtf/Atomics.h>
 #include <wtf/Threading.h>
 
 
@@ -405,6 +406,51 @@ class YarrGenerator final : public YarrJITInfo, private MacroAssembler {
         } while (count);
     }
 
+    static constexpr unsigned thresholdForBinarySearch = 6;
+
+    // The non-ASCII matches and ranges of a class are sorted and disjoint, so large classes such as
+    // Unicode property escapes are bisected instead of tested one entry at a time. Falls through if
+    // nothing matches.
+    void matchUnicodeCharacters(RegisterID character, JumpList& matchDest, const UChar32* matches, unsigned count)
+    {
+        if (count <= thresholdForBinarySearch) {
+            for (unsigned i = 0; i < count; ++i)
+                matchDest.append(branch32(Equal, character, Imm32(matches[i])));
+            return;
+        }
+
+        unsigned middle = count >> 1;
+        Jump aboveMiddle = branch32(GreaterThan, character, Imm32(matches[middle]));
+        matchUnicodeCharacters(character, matchDest, matches, middle);
+        matchDest.append(branch32(Equal, character, Imm32(matches[middle])));
+        Jump noMatch = jump();
+        aboveMiddle.link(this);
+        matchUnicodeCharacters(character, matchDest, matches + middle + 1, count - middle - 1);
+        noMatch.link(this);
+    }
+
+    void matchUnicodeRanges(RegisterID character, JumpList& matchDest, const CharacterRange* ranges, unsigned count)
+    {
+        if (count <= thresholdForBinarySearch) {
+            for (unsigned i = 0; i < count; ++i) {
+                Jump below = branch32(LessThan, character, Imm32(ranges[i].begin));
+                matchDest.append(branch32(LessThanOrEqual, character, Imm32(ranges[i].end)));
+                below.link(this);
+            }
+            return;
+        }
+
+        unsigned middle = count >> 1;
+        ASSERT(ranges[middle - 1].end < ranges[middle].begin);
+        Jump aboveMiddle = branch32(GreaterThan, character, Imm32(ranges[middle].end));
+        matchUnicodeRanges(character, matchDest, ranges, middle);
+        matchDest.append(branch32(GreaterThanOrEqual, character, Imm32(ranges[middle].begin)));
+        Jump noMatch = jump();
+        aboveMiddle.link(this);
+        matchUnicodeRanges(character, matchDest, ranges + middle + 1, count - middle - 1);
+        noMatch.link(this);
+    }
+
     void matchCharacterClass(RegisterID character, JumpList& matchDest, const CharacterClass* charClass)
     {
         if (charClass->m_table && !m_decodeSurrogatePairs) {
@@ -419,23 +465,22 @@ class YarrGenerator final : public YarrJITInfo, private MacroAssembler {
             if (charClass->m_matches.size() || charClass->m_ranges.size())
                 isAscii.append(branch32(LessThanOrEqual, character, TrustedImm32(0x7f)));
 
-            if (charClass->m_matchesUnicode.size()) {
-                for (unsigned i = 0; i < charClass->m_matchesUnicode.size(); ++i) {
-                    UChar32 ch = charClass->m_matchesUnicode[i];
-                    matchDest.append(branch32(Equal, character, Imm32(ch)));
-                }
+            // A Latin-1 subject can never reach the entries above 0xff, so 8-bit code only tests the prefix
+            // of each sorted list that can match.
+            unsigned matchesUnicodeCount = charClass->m_matchesUnicode.size();
+            unsigned rangesUnicodeCount = charClass->m_rangesUnicode.size();
+            if (m_charSize == Char8) {
+                while (matchesUnicodeCount && charClass->m_matchesUnicode[matchesUnicodeCount - 1] > 0xff)
+                    --matchesUnicodeCount;
+                while (rangesUnicodeCount && charClass->m_rangesUnicode[rangesUnicodeCount - 1].begin > 0xff)
+                    --rangesUnicodeCount;
             }
 
-            if (charClass->m_rangesUnicode.size()) {
-                for (unsigned i = 0; i < charClass->m_rangesUnicode.size(); ++i) {
-                    UChar32 lo = charClass->m_rangesUnicode[i].begin;
-                    UChar32 hi = charClass->m_rangesUnicode[i].end;
+            if (matchesUnicodeCount)
+                matchUnicodeCharacters(character, matchDest, charClass->m_matchesUnicode.data(), matchesUnicodeCount);
 
-                    Jump below = branch32(LessThan, character, Imm32(lo));
-                    matchDest.append(branch32(LessThanOrEqual, character, Imm32(hi)));
-                    below.link(this);
-                }
-            }
+            if (rangesUnicodeCount)
+                matchUnicodeRanges(character, matchDest, charClass->m_rangesUnicode.data(), rangesUnicodeCount);
 
             if (charClass->m_matches.size() || charClass->m_ranges.size())
                 unicodeFail = jump();
@@ -2239,6 +2284,95 @@ class YarrGenerator final : public YarrJITInfo, private MacroAssembler {
         }
     }
 
+#if CPU(X86_64) || CPU(ARM64)
+    // If every match has to begin with one particular code unit, returns it so that
+    // the body can skip ahead to candidate start positions instead of attempting a
+    // match at each index in turn.
+    Optional<UChar32> leadingCharacterForScan()
+    {
+        if (m_pattern.sticky() || m_pattern.m_body->m_alternatives.size() != 1)
+            return WTF::nullopt;
+
+        PatternAlternative* alternative = m_pattern.m_body->m_alternatives[0].get();
+        if (alternative->onceThrough() || alternative->m_terms.isEmpty())
+            return WTF::nullopt;
+
+        PatternTerm& term = alternative->m_terms[0];
+        if (term.type != PatternTerm::TypePatternCharacter
+            || term.quantityType != QuantifierFixedCount
+            || !term.quantityMaxCount
+            || term.inputPosition)
+            return WTF::nullopt;
+
+        UChar32 ch = term.patternCharacter;
+        if (U16_LENGTH(ch) != 1 || (m_charSize == Char8 && !isLatin1(ch)))
+            return WTF::nullopt;
+        if (m_pattern.ignoreCase() && isASCIIAlpha(ch))
+            return WTF::nullopt;
+        return ch;
+    }
+
+    // Emits a loop that advances index until the code unit at the start of the
+    // candidate match equals ch. A whole machine word of input is tested per
+    // iteration using the "has zero lane" bit trick on (word ^ broadcast(ch)): only
+    // once a word contains a candidate do we fall back to testing code units one by
+    // one. Leaves index as it would be after a failed input check if the input is
+    // exhausted without finding a candidate.
+    void generateLeadingCharacterScan(YarrOp& op, UChar32 ch)
+    {
+        PatternAlternative* alternative = op.m_alternative;
+        unsigned minimumSize = alternative->m_minimumSize;
+        unsigned charactersPerWord = m_charSize == Char8 ? 8 : 4;
+        uint64_t lowBits = m_charSize == Char8 ? 0x0101010101010101ULL : 0x0001000100010001ULL;
+        uint64_t highBits = m_charSize == Char8 ? 0x8080808080808080ULL : 0x8000800080008000ULL;
+
+        // The word starting at the candidate, index - minimumSize, must lie within the input.
+        // This is checked on every iteration, and the remaining tail is scanned unit by unit.
+        JumpList candidateWord;
+        Label wordLoop(this);
+        Jump tooShortForWord;
+        if (minimumSize < charactersPerWord) {
+            move(index, regT1);
+            add32(Imm32(charactersPerWord - minimumSize), regT1);
+            tooShortForWord = branch32(Above, regT1, length);
+        } else
+            tooShortForWord = branch32(Above, index, length);
+        load64(negativeOffsetIndexedAddress(minimumSize, regT0), regT0);
+        move(TrustedImm64(lowBits * ch), regT1);
+        xor64(regT1, regT0);
+        move(regT0, regT2);
+        not64(regT2);
+        move(TrustedImm64(lowBits), regT1);
+        sub64(regT1, regT0);
+        and64(regT2, regT0);
+        move(TrustedImm64(highBits), regT1);
+        candidateWord.append(branchTest64(NonZero, regT0, regT1));
+        add32(TrustedImm32(charactersPerWord), index);
+        jump(wordLoop);
+
+        candidateWord.link(this);
+        tooShortForWord.link(this);
+        Label characterLoop(this);
+        op.m_jumps.append(branch32(Above, index, length));
+        BaseIndex address = negativeOffsetIndexedAddress(minimumSize, regT0);
+        if (m_charSize == Char8)
+            load8(address, regT0);
+        else
+            load16Unaligned(address, regT0);
+        Jump found = branch32(Equal, regT0, Imm32(ch));
+        add32(TrustedImm32(1), index);
+        jump(characterLoop);
+
+        found.link(this);
+        if (!m_pattern.m_body->m_hasFixedSize) {
+            move(index, regT0);
+            if (minimumSize)
+                sub32(Imm32(minimumSize), regT0);
+            setMatchStart(regT0);
+        }
+    }
+#endif
+
     void generate()
     {
         // Forwards generate the matching code.
@@ -2287,6 +2421,10 @@ class YarrGenerator final : public YarrJITInfo, private MacroAssembler {
                 // We will reenter after the check, and assume the input position to have been
                 // set as appropriate to this alternative.
                 op.m_reentry = label();
+#if CPU(X86_64) || CPU(ARM64)
+                if (auto ch = leadingCharacterForScan())
+                    generateLeadingCharacterScan(op, *ch);
+#endif
 
                 m_checkedOffset += alternative->m_minimumSize;
                 break;
@@ -4249,6 +4387,37 @@ private:
     std::unique_ptr<YarrDisassembler> m_disassembler;
 };
 
+static Atomic<unsigned> s_jitFailureCounts[numberOfJITFailureReasons];
+
+unsigned jitFailureCount(JITFailureReason failure)
+{
+    return s_jitFailureCounts[static_cast<unsigned>(failure)].load(std::memory_order_relaxed);
+}
+
+const char* jitFailureReasonName(JITFailureReason failure)
+{
+    switch (failure) {
+    case JITFailureReason::DecodeSurrogatePair:
+        return "DecodeSurrogatePair";
+    case JITFailureReason::BackReference:
+        return "BackReference";
+    case JITFailureReason::ForwardReference:
+        return "ForwardReference";
+    case JITFailureReason::VariableCountedParenthesisWithNonZeroMinimum:
+        return "VariableCountedParenthesisWithNonZeroMinimum";
+    case JITFailureReason::ParenthesizedSubpattern:
+        return "ParenthesizedSubpattern";
+    case JITFailureReason::FixedCountParenthesizedSubpattern:
+        return "FixedCountParenthesizedSubpattern";
+    case JITFailureReason::ParenthesisNestedTooDeep:
+        return "ParenthesisNestedTooDeep";
+    case JITFailureReason::ExecutableMemoryAllocationFailure:
+        return "ExecutableMemoryAllocationFailure";
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return nullptr;
+}
+
 static void dumpCompileFailure(JITFailureReason failure)
 {
     switch (failure) {
@@ -4287,6 +4456,7 @@ void jitCompile(YarrPattern& pattern, String& patternString, YarrCharSize charSi
         YarrGenerator<IncludeSubpatterns>(vm, pattern, patternString, codeBlock, charSize).compile();
 
     if (auto failureReason = codeBlock.failureReason()) {
+        s_jitFailureCounts[static_cast<unsigned>(*failureReason)].exchangeAdd(1, std::memory_order_relaxed);
         if (UNLIKELY(Options::dumpCompiledRegExpPatterns())) {
             pattern.dumpPatternString(WTF::dataFile(), patternString);
             dataLog(" : ");
@@ -54,6 +54,7 @@ enum class JITFailureReason : uint8_t {
     ParenthesisNestedTooDeep,
     ExecutableMemoryAllocationFailure,
 };
+static constexpr unsigned numberOfJITFailureReasons = static_cast<unsigned>(JITFailureReason::ExecutableMemoryAllocationFailure) + 1;
 
 class MatchingContextHolder {
     WTF_FORBID_HEAP_ALLOCATION;
@@ -214,6 +215,10 @@ enum YarrJITCompileMode {
 };
 void jitCompile(YarrPattern&, String& patternString, YarrCharSize, VM*, YarrCodeBlock& jitObject, YarrJITCompileMode = IncludeSubpatterns);
 
+// How many regular expression compiles fell back to the interpreter for each reason, process-wide.
+JS_EXPORT_PRIVATE unsigned jitFailureCount(JITFailureReason);
+JS_EXPORT_PRIVATE const char* jitFailureReasonName(JITFailureReason);
+
 } } // namespace JSC::Yarr
 
 #endif
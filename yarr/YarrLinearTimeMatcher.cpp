@@ -0,0 +1,496 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "YarrLinearTimeMatcher.h"
+
+#include "Yarr.h"
+#include <algorithm>
+#include <unicode/uchar.h>
+#include <wtf/ASCIICType.h>
+
+namespace JSC { namespace Yarr {
+
+// Counted quantifiers are unrolled, so bound the program size to keep both
+// compilation and the per-step thread lists small.
+static constexpr unsigned maximumProgramSize = 16384;
+
+class LinearTimeMatcher::ThreadList {
+public:
+    ThreadList(unsigned programSize, unsigned numSlots)
+        : m_numSlots(numSlots)
+    {
+        m_visited.fill(0, programSize);
+    }
+
+    bool markVisited(unsigned pc)
+    {
+        if (m_visited[pc] == m_generation)
+            return false;
+        m_visited[pc] = m_generation;
+        return true;
+    }
+
+    void append(unsigned pc, const unsigned* captures)
+    {
+        m_pcs.append(pc);
+        m_captures.append(captures, m_numSlots);
+    }
+
+    void clear()
+    {
+        m_pcs.shrink(0);
+        m_captures.shrink(0);
+        ++m_generation;
+    }
+
+    bool isEmpty() const { return m_pcs.isEmpty(); }
+    unsigned size() const { return m_pcs.size(); }
+    unsigned pc(unsigned index) const { return m_pcs[index]; }
+    const unsigned* captures(unsigned index) const { return m_captures.data() + index * m_numSlots; }
+
+private:
+    Vector<unsigned> m_visited;
+    Vector<unsigned> m_pcs;
+    Vector<unsigned> m_captures;
+    unsigned m_numSlots;
+    unsigned m_generation { 1 };
+};
+
+struct LinearTimeMatcher::AddThreadEntry {
+    unsigned pc;
+    unsigned slot;
+    unsigned value;
+    bool isRestore;
+};
+
+static bool alwaysConsumesInput(PatternDisjunction*);
+
+static bool alwaysConsumesInput(PatternTerm& term)
+{
+    switch (term.type) {
+    case PatternTerm::TypePatternCharacter:
+    case PatternTerm::TypeCharacterClass:
+        return term.quantityMinCount.unsafeGet();
+    case PatternTerm::TypeParenthesesSubpattern:
+        return term.quantityMinCount.unsafeGet() && alwaysConsumesInput(term.parentheses.disjunction);
+    default:
+        return false;
+    }
+}
+
+static bool alwaysConsumesInput(PatternDisjunction* disjunction)
+{
+    for (auto& alternative : disjunction->m_alternatives) {
+        if (!std::any_of(alternative->m_terms.begin(), alternative->m_terms.end(), [] (PatternTerm& term) { return alwaysConsumesInput(term); }))
+            return false;
+    }
+    return true;
+}
+
+std::unique_ptr<LinearTimeMatcher> LinearTimeMatcher::tryCreate(YarrPattern& pattern)
+{
+    if (pattern.m_containsBackreferences)
+        return nullptr;
+
+    std::unique_ptr<LinearTimeMatcher> matcher(new LinearTimeMatcher(pattern));
+    if (!matcher->compile(pattern))
+        return nullptr;
+    return matcher;
+}
+
+LinearTimeMatcher::LinearTimeMatcher(YarrPattern& pattern)
+    : m_flags(pattern.m_flags)
+    , m_numSlots((pattern.m_numSubpatterns + 1) * 2)
+{
+    // These must be the same classes BytecodePattern picks, so that they end up
+    // owned by it once the pattern's character classes are handed over.
+    m_newlineCharacterClass = pattern.newlineCharacterClass();
+    if (unicode() && ignoreCase())
+        m_wordcharCharacterClass = pattern.wordUnicodeIgnoreCaseCharCharacterClass();
+    else
+        m_wordcharCharacterClass = pattern.wordcharCharacterClass();
+}
+
+unsigned LinearTimeMatcher::emit(Opcode opcode)
+{
+    unsigned index = m_program.size();
+    Instruction instruction;
+    instruction.opcode = opcode;
+    m_program.append(instruction);
+    return index;
+}
+
+bool LinearTimeMatcher::compile(YarrPattern& pattern)
+{
+    m_program[emit(Opcode::Save)].firstSlot = 0;
+    if (!compileDisjunction(pattern.m_body))
+        return false;
+    m_program[emit(Opcode::Save)].firstSlot = 1;
+    emit(Opcode::Match);
+
+    if (m_program.size() > maximumProgramSize)
+        return false;
+    m_program.shrinkToFit();
+    return true;
+}
+
+bool LinearTimeMatcher::compileDisjunction(PatternDisjunction* disjunction)
+{
+    Vector<unsigned, 4> jumpsToEnd;
+    auto& alternatives = disjunction->m_alternatives;
+    for (unsigned i = 0; i < alternatives.size(); ++i) {
+        bool isLast = i + 1 == alternatives.size();
+        unsigned split = 0;
+        if (!isLast) {
+            split = emit(Opcode::Split);
+            m_program[split].target = m_program.size();
+        }
+
+        for (auto& term : alternatives[i]->m_terms) {
+            if (!compileTerm(term))
+                return false;
+        }
+
+        if (!isLast) {
+            jumpsToEnd.append(emit(Opcode::Jump));
+            m_program[split].alternative = m_program.size();
+        }
+
+        if (m_program.size() > maximumProgramSize)
+            return false;
+    }
+
+    for (unsigned jump : jumpsToEnd)
+        m_program[jump].target = m_program.size();
+    return true;
+}
+
+template<typename EmitFunctor>
+bool LinearTimeMatcher::compileQuantified(PatternTerm& term, const EmitFunctor& emitOnce)
+{
+    unsigned minCount = term.quantityMinCount.unsafeGet();
+    unsigned maxCount = term.quantityMaxCount.unsafeGet();
+    bool greedy = term.quantityType != QuantifierNonGreedy;
+
+    auto emitSplit = [&] (unsigned body, unsigned exit) {
+        unsigned split = emit(Opcode::Split);
+        m_program[split].target = greedy ? body : exit;
+        m_program[split].alternative = greedy ? exit : body;
+        return split;
+    };
+
+    for (unsigned i = 0; i < minCount; ++i) {
+        if (!emitOnce() || m_program.size() > maximumProgramSize)
+            return false;
+    }
+
+    auto patchExit = [&] (unsigned split, unsigned exit) {
+        if (greedy)
+            m_program[split].alternative = exit;
+        else
+            m_program[split].target = exit;
+    };
+
+    if (maxCount == quantifyInfinite) {
+        unsigned loop = emitSplit(m_program.size() + 1, 0);
+        if (!emitOnce())
+            return false;
+        m_program[emit(Opcode::Jump)].target = loop;
+        patchExit(loop, m_program.size());
+        return m_program.size() <= maximumProgramSize;
+    }
+
+    Vector<unsigned, 4> optionalSplits;
+    for (unsigned i = minCount; i < maxCount; ++i) {
+        optionalSplits.append(emitSplit(m_program.size() + 1, 0));
+        if (!emitOnce() || m_program.size() > maximumProgramSize)
+            return false;
+    }
+    for (unsigned split : optionalSplits)
+        patchExit(split, m_program.size());
+    return true;
+}
+
+bool LinearTimeMatcher::compileTerm(PatternTerm& term)
+{
+    switch (term.type) {
+    case PatternTerm::TypeAssertionBOL:
+        emit(Opcode::AssertBOL);
+        return true;
+
+    case PatternTerm::TypeAssertionEOL:
+        emit(Opcode::AssertEOL);
+        return true;
+
+    case PatternTerm::TypeAssertionWordBoundary:
+        m_program[emit(Opcode::AssertWordBoundary)].invert = term.invert();
+        return true;
+
+    case PatternTerm::TypeForwardReference:
+        // A reference to a group that has not been entered yet always matches the empty string.
+        return true;
+
+    case PatternTerm::TypePatternCharacter: {
+        UChar32 lo = term.patternCharacter;
+        UChar32 hi = term.patternCharacter;
+        if (ignoreCase()) {
+            lo = u_tolower(term.patternCharacter);
+            hi = u_toupper(term.patternCharacter);
+        }
+        return compileQuantified(term, [&] {
+            unsigned index = emit(Opcode::Character);
+            m_program[index].lo = lo;
+            m_program[index].hi = hi;
+            return true;
+        });
+    }
+
+    case PatternTerm::TypeCharacterClass:
+        return compileQuantified(term, [&] {
+            unsigned index = emit(Opcode::CharacterClass);
+            m_program[index].characterClass = term.characterClass;
+            m_program[index].invert = term.invert();
+            return true;
+        });
+
+    case PatternTerm::TypeParenthesesSubpattern: {
+        PatternDisjunction* disjunction = term.parentheses.disjunction;
+        // ES requires a loop iteration that consumes nothing to fail, which depends
+        // on the path taken so far and so cannot be decided per NFA state.
+        if (term.quantityType != QuantifierFixedCount && !alwaysConsumesInput(disjunction))
+            return false;
+
+        bool resetsCaptures = term.containsAnyCaptures() && (term.quantityType != QuantifierFixedCount || term.quantityMaxCount != 1);
+        unsigned subpatternId = term.parentheses.subpatternId;
+        unsigned lastSubpatternId = term.parentheses.lastSubpatternId;
+        return compileQuantified(term, [&] {
+            if (resetsCaptures) {
+                unsigned index = emit(Opcode::ResetCaptures);
+                m_program[index].firstSlot = subpatternId * 2;
+                m_program[index].lastSlot = lastSubpatternId * 2 + 1;
+            }
+            if (term.capture())
+                m_program[emit(Opcode::Save)].firstSlot = subpatternId * 2;
+            if (!compileDisjunction(disjunction))
+                return false;
+            if (term.capture())
+                m_program[emit(Opcode::Save)].firstSlot = subpatternId * 2 + 1;
+            return true;
+        });
+    }
+
+    case PatternTerm::TypeBackReference:
+    case PatternTerm::TypeParentheticalAssertion:
+    case PatternTerm::TypeDotStarEnclosure:
+        return false;
+    }
+
+    RELEASE_ASSERT_NOT_REACHED();
+    return false;
+}
+
+bool LinearTimeMatcher::testCharacterClass(CharacterClass* characterClass, UChar32 ch) const
+{
+    auto searchMatches = [&ch](const Vector<UChar32>& matches) {
+        return std::binary_search(matches.begin(), matches.end(), ch);
+    };
+
+    auto searchRanges = [&ch](const Vector<CharacterRange>& ranges) {
+        for (auto& range : ranges) {
+            if (ch >= range.begin && ch <= range.end)
+                return true;
+        }
+        return false;
+    };
+
+    if (characterClass->m_anyCharacter)
+        return true;
+
+    if (!isASCII(ch))
+        return searchMatches(characterClass->m_matchesUnicode) || searchRanges(characterClass->m_rangesUnicode);
+    return searchMatches(characterClass->m_matches) || searchRanges(characterClass->m_ranges);
+}
+
+template<typename CharType>
+void LinearTimeMatcher::addThread(ThreadList& list, unsigned pc, unsigned position, unsigned* captures, Vector<AddThreadEntry, 64>& stack, const CharType* input, unsigned length) const
+{
+    auto isWordchar = [&] (unsigned index) {
+        return testCharacterClass(m_wordcharCharacterClass, input[index]);
+    };
+
+    // Follow the non-consuming instructions reachable from pc in priority order.
+    // Capture writes are undone through restore entries so that lower priority
+    // branches see the captures as they were at the split.
+    stack.append({ pc, 0, 0, false });
+    while (!stack.isEmpty()) {
+        AddThreadEntry entry = stack.takeLast();
+        if (entry.isRestore) {
+            captures[entry.slot] = entry.value;
+            continue;
+        }
+
+        pc = entry.pc;
+        while (list.markVisited(pc)) {
+            const Instruction& instruction = m_program[pc];
+            switch (instruction.opcode) {
+            case Opcode::Jump:
+                pc = instruction.target;
+                continue;
+            case Opcode::Split:
+                stack.append({ instruction.alternative, 0, 0, false });
+                pc = instruction.target;
+                continue;
+            case Opcode::Save:
+                stack.append({ 0, instruction.firstSlot, captures[instruction.firstSlot], true });
+                captures[instruction.firstSlot] = position;
+                ++pc;
+                continue;
+            case Opcode::ResetCaptures:
+                for (unsigned slot = instruction.firstSlot; slot <= instruction.lastSlot; ++slot) {
+                    stack.append({ 0, slot, captures[slot], true });
+                    captures[slot] = offsetNoMatch;
+                }
+                ++pc;
+                continue;
+            case Opcode::AssertBOL:
+                if (position && !(multiline() && testCharacterClass(m_newlineCharacterClass, input[position - 1])))
+                    break;
+                ++pc;
+                continue;
+            case Opcode::AssertEOL:
+                if (position != length && !(multiline() && testCharacterClass(m_newlineCharacterClass, input[position])))
+                    break;
+                ++pc;
+                continue;
+            case Opcode::AssertWordBoundary: {
+                bool previousIsWordchar = position && isWordchar(position - 1);
+                bool nextIsWordchar = position < length && isWordchar(position);
+                if ((previousIsWordchar != nextIsWordchar) == instruction.invert)
+                    break;
+                ++pc;
+                continue;
+            }
+            case Opcode::Character:
+            case Opcode::CharacterClass:
+            case Opcode::Match:
+                list.append(pc, captures);
+                break;
+            }
+            break;
+        }
+    }
+}
+
+template<typename CharType>
+unsigned LinearTimeMatcher::matchImpl(const CharType* input, unsigned length, unsigned start, unsigned* output) const
+{
+    for (unsigned i = 0; i < m_numSlots; ++i)
+        output[i] = offsetNoMatch;
+
+    if (start > length)
+        return offsetNoMatch;
+
+    ThreadList firstList(m_program.size(), m_numSlots);
+    ThreadList secondList(m_program.size(), m_numSlots);
+    ThreadList* current = &firstList;
+    ThreadList* next = &secondList;
+    Vector<AddThreadEntry, 64> stack;
+    Vector<unsigned, 32> captures;
+    captures.grow(m_numSlots);
+
+    bool matched = false;
+    unsigned position = start;
+    while (true) {
+        // A thread starting here has lower priority than every thread that started earlier.
+        if (!matched && (position == start || !sticky())) {
+            captures.fill(offsetNoMatch);
+            addThread(*current, 0, position, captures.data(), stack, input, length);
+        }
+        if (current->isEmpty())
+            break;
+
+        // In unicode mode all threads advance by whole code points, so no match
+        // can begin between the two halves of a surrogate pair.
+        UChar32 character = 0;
+        unsigned width = 0;
+        if (position < length) {
+            character = input[position];
+            width = 1;
+            if (unicode() && U16_IS_LEAD(character) && position + 1 < length && U16_IS_TRAIL(input[position + 1])) {
+                character = U16_GET_SUPPLEMENTARY(character, input[position + 1]);
+                width = 2;
+            }
+        }
+
+        for (unsigned i = 0; i < current->size(); ++i) {
+            unsigned pc = current->pc(i);
+            const Instruction& instruction = m_program[pc];
+            const unsigned* threadCaptures = current->captures(i);
+
+            if (instruction.opcode == Opcode::Match) {
+                // Everything after this thread has lower priority, so drop it.
+                memcpy(output, threadCaptures, m_numSlots * sizeof(unsigned));
+                matched = true;
+                break;
+            }
+
+            if (!width)
+                continue;
+
+            bool consumes;
+            if (instruction.opcode == Opcode::Character)
+                consumes = character == instruction.lo || character == instruction.hi;
+            else
+                consumes = testCharacterClass(instruction.characterClass, character) != instruction.invert;
+            if (!consumes)
+                continue;
+
+            memcpy(captures.data(), threadCaptures, m_numSlots * sizeof(unsigned));
+            addThread(*next, pc + 1, position + width, captures.data(), stack, input, length);
+        }
+
+        if (position >= length)
+            break;
+
+        std::swap(current, next);
+        next->clear();
+        position += width;
+    }
+
+    return matched ? output[0] : offsetNoMatch;
+}
+
+unsigned LinearTimeMatcher::match(const LChar* input, unsigned length, unsigned start, unsigned* output) const
+{
+    return matchImpl(input, length, start, output);
+}
+
+unsigned LinearTimeMatcher::match(const UChar* input, unsigned length, unsigned start, unsigned* output) const
+{
+    return matchImpl(input, length, start, output);
+}
+
+} } // namespace JSC::Yarr
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#pragma once
+
+#include "YarrPattern.h"
+#include <wtf/Vector.h>
+
+namespace JSC { namespace Yarr {
+
+// A backtracking-free matcher for the subset of patterns that can be expressed
+// as an NFA. All candidate paths through the pattern are simulated in lockstep
+// (a Pike VM), so the running time is O(input length * program size) no matter
+// how ambiguous the pattern is. Patterns that need backtracking semantics
+// (backreferences, lookaround, empty-checked loops) are rejected by tryCreate()
+// and left to the interpreter and the JIT.
+class LinearTimeMatcher {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    JS_EXPORT_PRIVATE static std::unique_ptr<LinearTimeMatcher> tryCreate(YarrPattern&);
+
+    JS_EXPORT_PRIVATE unsigned match(const LChar* input, unsigned length, unsigned start, unsigned* output) const;
+    JS_EXPORT_PRIVATE unsigned match(const UChar* input, unsigned length, unsigned start, unsigned* output) const;
+
+    size_t programSize() const { return m_program.size(); }
+
+private:
+    enum class Opcode : uint8_t {
+        Character,
+        CharacterClass,
+        Split,
+        Jump,
+        Save,
+        ResetCaptures,
+        AssertBOL,
+        AssertEOL,
+        AssertWordBoundary,
+        Match,
+    };
+
+    struct Instruction {
+        Opcode opcode;
+        bool invert { false };
+        UChar32 lo { 0 };
+        UChar32 hi { 0 };
+        CharacterClass* characterClass { nullptr };
+        // Split prefers target over alternative; Jump only uses target.
+        unsigned target { 0 };
+        unsigned alternative { 0 };
+        // Save writes firstSlot; ResetCaptures clears firstSlot through lastSlot.
+        unsigned firstSlot { 0 };
+        unsigned lastSlot { 0 };
+    };
+
+    class ThreadList;
+    struct AddThreadEntry;
+
+    LinearTimeMatcher(YarrPattern&);
+
+    bool compile(YarrPattern&);
+    bool compileDisjunction(PatternDisjunction*);
+    bool compileTerm(PatternTerm&);
+    template<typename EmitFunctor> bool compileQuantified(PatternTerm&, const EmitFunctor&);
+    unsigned emit(Opcode);
+
+    template<typename CharType> unsigned matchImpl(const CharType* input, unsigned length, unsigned start, unsigned* output) const;
+    template<typename CharType> void addThread(ThreadList&, unsigned pc, unsigned position, unsigned* captures, Vector<AddThreadEntry, 64>&, const CharType* input, unsigned length) const;
+    bool testCharacterClass(CharacterClass*, UChar32) const;
+
+    bool ignoreCase() const { return m_flags.contains(Flags::IgnoreCase); }
+    bool multiline() const { return m_flags.contains(Flags::Multiline); }
+    bool sticky() const { return m_flags.contains(Flags::Sticky); }
+    bool unicode() const { return m_flags.contains(Flags::Unicode); }
+
+    Vector<Instruction> m_program;
+    OptionSet<Flags> m_flags;
+    unsigned m_numSlots;
+    CharacterClass* m_newlineCharacterClass;
+    CharacterClass* m_wordcharCharacterClass;
+};
+
+} } // namespace JSC::Yarr